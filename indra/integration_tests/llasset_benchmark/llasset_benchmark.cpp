@@ -0,0 +1,311 @@
+/**
+ * @file llasset_benchmark.cpp
+ * @brief Micro-benchmarks for the asset pipeline hot codecs
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+#include "linden_common.h"
+#include "llpointer.h"
+#include "lltimer.h"
+
+#include "llasset_benchmark.h"
+
+// Linden library includes
+#include "llimage.h"
+#include "llimagej2c.h"
+#include "llsd.h"
+#include "llsdjson.h"
+#include "llsdserialize.h"
+#include "lluuid.h"
+#include "llvolume.h"
+#include "llcleanup.h"
+
+// system libraries
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// doc string provided when invoking the program with --help
+static const char USAGE[] = "\n"
+"usage:\tllasset_benchmark [options]\n"
+"\n"
+"Runs micro-benchmarks over the asset pipeline hot codecs (LLSD binary\n"
+"serialization, LLVolume generation, JPEG2000 decode) on synthetic,\n"
+"deterministic inputs and reports per-benchmark throughput as JSON.\n"
+"Diff the output of two builds to spot codec regressions.\n"
+"\n"
+" -h, --help\n"
+"        Print this help\n"
+" -o, --output <file>\n"
+"        Write the JSON report to <file> instead of standard out.\n"
+" -n, --repeats <n>\n"
+"        Iteration multiplier. Default is 1. Larger values trade run time\n"
+"        for steadier numbers.\n"
+"\n";
+
+// Deterministic pseudo-random stream so every build benchmarks identical input
+static U32 bench_rand(U32& state)
+{
+    state = state * 1664525u + 1013904223u;
+    return state;
+}
+
+// Representative simulator-style payload : a map of object updates with ids,
+// transforms, names and a small binary blob each
+static LLSD build_llsd_payload()
+{
+    U32 seed = 12345u;
+    LLSD updates = LLSD::emptyArray();
+    for (S32 i = 0; i < 64; i++)
+    {
+        LLSD update = LLSD::emptyMap();
+        LLUUID id;
+        id.generate();
+        update["id"] = id;
+        update["local_id"] = (S32)bench_rand(seed);
+        update["name"] = llformat("Object %d", i);
+        LLSD position = LLSD::emptyArray();
+        for (S32 j = 0; j < 3; j++)
+        {
+            position.append((F64)(bench_rand(seed) % 25600) / 100.0);
+        }
+        update["position"] = position;
+        std::vector<U8> blob(256);
+        for (size_t j = 0; j < blob.size(); j++)
+        {
+            blob[j] = (U8)bench_rand(seed);
+        }
+        update["data"] = blob;
+        updates.append(update);
+    }
+    LLSD payload = LLSD::emptyMap();
+    payload["updates"] = updates;
+    return payload;
+}
+
+// Serialize and reparse a payload repeatedly, reporting round-trip MB/s of
+// encoded bytes
+static LLSD bench_llsd_binary(S32 repeats)
+{
+    const S32 iterations = 500 * repeats;
+    LLSD payload = build_llsd_payload();
+
+    // Measure the encoded size once so throughput is over real bytes moved
+    std::stringstream size_probe;
+    LLSDSerialize::toBinary(payload, size_probe);
+    const S32 encoded_bytes = (S32)size_probe.str().size();
+
+    LLTimer timer;
+    for (S32 i = 0; i < iterations; i++)
+    {
+        std::stringstream buffer;
+        LLSDSerialize::toBinary(payload, buffer);
+        LLSD parsed;
+        if (LLSDSerialize::fromBinary(parsed, buffer, encoded_bytes) == LLSDParser::PARSE_FAILURE)
+        {
+            std::cerr << "llsd_binary_roundtrip : parse failure" << std::endl;
+            break;
+        }
+    }
+    F64 seconds = timer.getElapsedTimeF64();
+
+    LLSD result = LLSD::emptyMap();
+    result["name"] = "llsd_binary_roundtrip";
+    result["iterations"] = iterations;
+    result["bytes_per_iteration"] = encoded_bytes;
+    result["seconds"] = seconds;
+    result["mb_per_sec"] = (seconds > 0.0) ? ((F64)encoded_bytes * iterations / seconds) / (1024.0 * 1024.0) : 0.0;
+    return result;
+}
+
+// Run LLVolume::generate() plus face creation for one profile/path
+// combination at one detail level, reporting verts/s
+static LLSD bench_volume_generate(const std::string& name, U8 profile, U8 path, F32 detail, S32 repeats)
+{
+    const S32 iterations = 50 * repeats;
+    LLVolumeParams volume_params;
+    volume_params.setType(profile, path);
+    volume_params.setBeginAndEndS(0.f, 1.f);
+    volume_params.setBeginAndEndT(0.f, 1.f);
+    volume_params.setRatio(1.f, 1.f);
+    volume_params.setShear(0.f, 0.f);
+
+    S32 verts_per_iteration = 0;
+    LLTimer timer;
+    for (S32 i = 0; i < iterations; i++)
+    {
+        LLPointer<LLVolume> volume = new LLVolume(volume_params, detail);
+        verts_per_iteration = 0;
+        for (S32 face = 0; face < volume->getNumVolumeFaces(); face++)
+        {
+            verts_per_iteration += volume->getVolumeFace(face).mNumVertices;
+        }
+    }
+    F64 seconds = timer.getElapsedTimeF64();
+
+    LLSD result = LLSD::emptyMap();
+    result["name"] = llformat("volume_generate_%s_detail_%.1f", name.c_str(), detail);
+    result["iterations"] = iterations;
+    result["verts_per_iteration"] = verts_per_iteration;
+    result["seconds"] = seconds;
+    result["verts_per_sec"] = (seconds > 0.0) ? (F64)verts_per_iteration * iterations / seconds : 0.0;
+    return result;
+}
+
+// Decode a synthetic JPEG2000 texture repeatedly, reporting MB/s of raw
+// pixels produced. The input is encoded in-process so no corpus files need
+// to ship with the source tree.
+static LLSD bench_j2c_decode(S32 dimension, S32 repeats)
+{
+    LLSD result = LLSD::emptyMap();
+    result["name"] = llformat("j2c_decode_%d", dimension);
+
+    // Gradient plus deterministic noise : compresses like a typical texture,
+    // not like a flat card
+    LLPointer<LLImageRaw> raw_image = new LLImageRaw(dimension, dimension, 3);
+    U8* data = raw_image->getData();
+    U32 seed = 54321u;
+    for (S32 y = 0; y < dimension; y++)
+    {
+        for (S32 x = 0; x < dimension; x++)
+        {
+            U8* pixel = data + (y * dimension + x) * 3;
+            pixel[0] = (U8)((x * 255) / dimension);
+            pixel[1] = (U8)((y * 255) / dimension);
+            pixel[2] = (U8)(bench_rand(seed) & 0x3F);
+        }
+    }
+
+    LLPointer<LLImageJ2C> j2c_image = new LLImageJ2C();
+    if (!j2c_image->encode(raw_image, 0.0f))
+    {
+        // No codec available in this build configuration : report the
+        // benchmark as skipped rather than aborting the whole run
+        std::cerr << "j2c_decode : encode failed, skipping (" << LLImage::getLastThreadError() << ")" << std::endl;
+        result["skipped"] = true;
+        return result;
+    }
+
+    const S32 iterations = 10 * repeats;
+    const S32 raw_bytes = raw_image->getDataSize();
+    LLTimer timer;
+    for (S32 i = 0; i < iterations; i++)
+    {
+        LLPointer<LLImageJ2C> decode_image = new LLImageJ2C();
+        decode_image->copyData(j2c_image->getData(), j2c_image->getDataSize());
+        LLPointer<LLImageRaw> decoded = new LLImageRaw();
+        if (!decode_image->decode(decoded, 0.0f))
+        {
+            std::cerr << "j2c_decode : decode failure" << std::endl;
+            result["skipped"] = true;
+            return result;
+        }
+    }
+    F64 seconds = timer.getElapsedTimeF64();
+
+    result["iterations"] = iterations;
+    result["encoded_bytes"] = j2c_image->getDataSize();
+    result["raw_bytes_per_iteration"] = raw_bytes;
+    result["seconds"] = seconds;
+    result["mb_per_sec"] = (seconds > 0.0) ? ((F64)raw_bytes * iterations / seconds) / (1024.0 * 1024.0) : 0.0;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    // Optional parsed arguments
+    std::string output_filename;
+    S32 repeats = 1;
+
+    // Init whatever is necessary
+    ll_init_apr();
+    LLImage::initClass();
+
+    // Analyze command line arguments
+    for (int arg = 1; arg < argc; ++arg)
+    {
+        if (!strcmp(argv[arg], "--help") || !strcmp(argv[arg], "-h"))
+        {
+            // Send the usage to standard out
+            std::cout << USAGE << std::endl;
+            return 0;
+        }
+        else if ((!strcmp(argv[arg], "--output") || !strcmp(argv[arg], "-o")) && arg < argc-1)
+        {
+            output_filename = argv[arg+1];
+            arg += 1;
+        }
+        else if ((!strcmp(argv[arg], "--repeats") || !strcmp(argv[arg], "-n")) && arg < argc-1)
+        {
+            repeats = atoi(argv[arg+1]);
+            arg += 1;
+            if (repeats < 1)
+            {
+                std::cout << "No valid --repeats argument given, using 1" << std::endl;
+                repeats = 1;
+            }
+        }
+    }
+
+    // Run the suite. Each benchmark reports its own throughput so a failing
+    // or skipped entry does not hide the others.
+    LLSD benchmarks = LLSD::emptyArray();
+    benchmarks.append(bench_llsd_binary(repeats));
+    for (F32 detail : {1.f, 2.f, 4.f})
+    {
+        benchmarks.append(bench_volume_generate("cube", LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE, detail, repeats));
+        benchmarks.append(bench_volume_generate("cylinder", LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_LINE, detail, repeats));
+        benchmarks.append(bench_volume_generate("torus", LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_CIRCLE, detail, repeats));
+        benchmarks.append(bench_volume_generate("sphere", LL_PCODE_PROFILE_CIRCLE_HALF, LL_PCODE_PATH_CIRCLE, detail, repeats));
+    }
+    benchmarks.append(bench_j2c_decode(512, repeats));
+
+    LLSD report = LLSD::emptyMap();
+    report["repeats"] = repeats;
+    report["benchmarks"] = benchmarks;
+
+    // Emit the report as JSON so runs can be diffed between builds
+    std::string json = boost::json::serialize(LlsdToJson(report));
+    if (output_filename.empty())
+    {
+        std::cout << json << std::endl;
+    }
+    else
+    {
+        std::ofstream output_stream(output_filename.c_str());
+        if (!output_stream.is_open())
+        {
+            std::cerr << "Error: report " << output_filename << " could not be written" << std::endl;
+            std::cout << json << std::endl;
+        }
+        else
+        {
+            output_stream << json << std::endl;
+            std::cout << "Report written to : " << output_filename << std::endl;
+        }
+    }
+
+    // Cleanup and exit
+    SUBSYSTEM_CLEANUP(LLImage);
+
+    return 0;
+}
@@ -72,6 +72,7 @@ LLPolyMeshSharedData::LLPolyMeshSharedData()
         mTexCoords = NULL;
         mDetailTexCoords = NULL;
         mWeights = NULL;
+        mBaseClothingWeights = NULL;
         mHasWeights = false;
         mHasDetailTexCoords = false;
 
@@ -114,6 +115,7 @@ void LLPolyMeshSharedData::setupLOD(LLPolyMeshSharedData* reference_data)
                 mTexCoords = reference_data->mTexCoords;
                 mDetailTexCoords = reference_data->mDetailTexCoords;
                 mWeights = reference_data->mWeights;
+                mBaseClothingWeights = reference_data->mBaseClothingWeights;
                 mHasWeights = reference_data->mHasWeights;
                 mHasDetailTexCoords = reference_data->mHasDetailTexCoords;
         }
@@ -145,6 +147,9 @@ void LLPolyMeshSharedData::freeMeshData()
 
                 ll_aligned_free_16(mWeights);
                 mWeights = NULL;
+
+                ll_aligned_free_16(mBaseClothingWeights);
+                mBaseClothingWeights = NULL;
         }
 
         mNumFaces = 0;
@@ -234,6 +239,7 @@ bool LLPolyMeshSharedData::allocateVertexData( U32 numVertices )
         mTexCoords = (LLVector2*) ll_aligned_malloc_16(numVertices*sizeof(LLVector2));
         mDetailTexCoords = (LLVector2*) ll_aligned_malloc_16(numVertices*sizeof(LLVector2));
         mWeights = (F32*) ll_aligned_malloc_16(numVertices*sizeof(F32));
+        mBaseClothingWeights = (LLVector4a*) ll_aligned_malloc_16(numVertices*sizeof(LLVector4a));
         for (i = 0; i < numVertices; i++)
         {
             mBaseCoords[i].clear();
@@ -241,6 +247,7 @@ bool LLPolyMeshSharedData::allocateVertexData( U32 numVertices )
             mBaseBinormals[i].clear();
             mTexCoords[i].clear();
             mWeights[i] = 0.f;
+            mBaseClothingWeights[i].clear();
         }
         mNumVertices = numVertices;
         return true;
@@ -773,34 +780,23 @@ LLPolyMesh::LLPolyMesh(LLPolyMeshSharedData *shared_data, LLPolyMesh *reference_
         mScaledBinormals = reference_mesh->mScaledBinormals;
         mTexCoords = reference_mesh->mTexCoords;
         mClothingWeights = reference_mesh->mClothingWeights;
+        // so the reference mesh can repoint us if it materializes later
+        reference_mesh->mDependentLODs.push_back(this);
     }
     else
     {
-        // Allocate memory without initializing every vector
-        // NOTE: This makes asusmptions about the size of LLVector[234]
-        S32 nverts = mSharedData->mNumVertices;
-        //make sure it's an even number of verts for alignment
-        nverts += nverts%2;
-        S32 nfloats = nverts * (
-                    4 + //coords
-                    4 + //normals
-                    4 + //weights
-                    2 + //coords
-                    4 + //scaled normals
-                    4 + //binormals
-                    4); //scaled binormals
-
-        //use 16 byte aligned vertex data to make LLPolyMesh SSE friendly
-        mVertexData = (F32*) ll_aligned_malloc_16(nfloats*4);
-        S32 offset = 0;
-        mCoords             =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        mNormals            =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        mClothingWeights    =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        mTexCoords          =   (LLVector2*)(mVertexData + offset);  offset += 2*nverts;
-        mScaledNormals      =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        mBinormals          =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        mScaledBinormals    =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
-        initializeForMorph();
+        // alias the shared base arrays until a morph actually writes;
+        // materializeVertexData() makes the private copy on demand, so
+        // un-morphed instances carry no per-avatar vertex storage
+        mCoords = mSharedData->mBaseCoords;
+        mNormals = mSharedData->mBaseNormals;
+        // initializeForMorph() seeds the scaled/binormal arrays from
+        // the base normals, so mirror that here
+        mScaledNormals = mSharedData->mBaseNormals;
+        mBinormals = mSharedData->mBaseNormals;
+        mScaledBinormals = mSharedData->mBaseNormals;
+        mTexCoords = mSharedData->mTexCoords;
+        mClothingWeights = mSharedData->mBaseClothingWeights;
     }
 }
 
@@ -810,10 +806,77 @@ LLPolyMesh::LLPolyMesh(LLPolyMeshSharedData *shared_data, LLPolyMesh *reference_
 //-----------------------------------------------------------------------------
 LLPolyMesh::~LLPolyMesh()
 {
+    // break the storage-sharing links in both directions; deletion
+    // order between a reference mesh and its LODs is not guaranteed
+    for (LLPolyMesh* lod : mDependentLODs)
+    {
+        lod->mReferenceMesh = NULL;
+    }
+    if (mReferenceMesh)
+    {
+        vector_replace_with_last(mReferenceMesh->mDependentLODs, this);
+    }
     delete_and_clear(mJointRenderData);
     ll_aligned_free_16(mVertexData);
 }
 
+//-----------------------------------------------------------------------------
+// materializeVertexData()
+//-----------------------------------------------------------------------------
+void LLPolyMesh::materializeVertexData()
+{
+    if (mVertexData)
+    {
+        return;
+    }
+
+    if (mSharedData->isLOD() && mReferenceMesh)
+    {
+        // LOD meshes share vertex storage with their reference mesh;
+        // its dependent list repoints us once the copy exists
+        mReferenceMesh->materializeVertexData();
+        return;
+    }
+
+    // Allocate memory without initializing every vector
+    // NOTE: This makes asusmptions about the size of LLVector[234]
+    S32 nverts = mSharedData->mNumVertices;
+    //make sure it's an even number of verts for alignment
+    nverts += nverts%2;
+    S32 nfloats = nverts * (
+                4 + //coords
+                4 + //normals
+                4 + //weights
+                2 + //coords
+                4 + //scaled normals
+                4 + //binormals
+                4); //scaled binormals
+
+    //use 16 byte aligned vertex data to make LLPolyMesh SSE friendly
+    mVertexData = (F32*) ll_aligned_malloc_16(nfloats*4);
+    S32 offset = 0;
+    mCoords             =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    mNormals            =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    mClothingWeights    =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    mTexCoords          =   (LLVector2*)(mVertexData + offset);  offset += 2*nverts;
+    mScaledNormals      =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    mBinormals          =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    mScaledBinormals    =   (LLVector4a*)(mVertexData + offset); offset += 4*nverts;
+    initializeForMorph();
+
+    // repoint any LOD meshes aliasing the old shared arrays
+    for (LLPolyMesh* lod : mDependentLODs)
+    {
+        lod->mCoords = mCoords;
+        lod->mNormals = mNormals;
+        lod->mScaledNormals = mScaledNormals;
+        lod->mBinormals = mBinormals;
+        lod->mScaledBinormals = mScaledBinormals;
+        lod->mTexCoords = mTexCoords;
+        lod->mClothingWeights = mClothingWeights;
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // LLPolyMesh::getMesh()
@@ -918,6 +981,7 @@ void LLPolyMesh::dumpDiagInfo()
 //-----------------------------------------------------------------------------
 LLVector4a *LLPolyMesh::getWritableCoords()
 {
+        materializeVertexData();
         return mCoords;
 }
 
@@ -926,6 +990,7 @@ LLVector4a *LLPolyMesh::getWritableCoords()
 //-----------------------------------------------------------------------------
 LLVector4a *LLPolyMesh::getWritableNormals()
 {
+        materializeVertexData();
         return mNormals;
 }
 
@@ -934,6 +999,7 @@ LLVector4a *LLPolyMesh::getWritableNormals()
 //-----------------------------------------------------------------------------
 LLVector4a *LLPolyMesh::getWritableBinormals()
 {
+        materializeVertexData();
         return mBinormals;
 }
 
@@ -943,6 +1009,7 @@ LLVector4a *LLPolyMesh::getWritableBinormals()
 //-----------------------------------------------------------------------------
 LLVector4a       *LLPolyMesh::getWritableClothingWeights()
 {
+        materializeVertexData();
         return mClothingWeights;
 }
 
@@ -951,6 +1018,7 @@ LLVector4a       *LLPolyMesh::getWritableClothingWeights()
 //-----------------------------------------------------------------------------
 LLVector2       *LLPolyMesh::getWritableTexCoords()
 {
+        materializeVertexData();
         return mTexCoords;
 }
 
@@ -959,6 +1027,7 @@ LLVector2       *LLPolyMesh::getWritableTexCoords()
 //-----------------------------------------------------------------------------
 LLVector4a *LLPolyMesh::getScaledNormals()
 {
+        materializeVertexData();
         return mScaledNormals;
 }
 
@@ -967,6 +1036,7 @@ LLVector4a *LLPolyMesh::getScaledNormals()
 //-----------------------------------------------------------------------------
 LLVector4a *LLPolyMesh::getScaledBinormals()
 {
+        materializeVertexData();
         return mScaledBinormals;
 }
 
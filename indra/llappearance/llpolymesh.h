@@ -78,6 +78,8 @@ private:
     LLVector2               *mTexCoords;
     LLVector2               *mDetailTexCoords;
     F32                     *mWeights;
+    // all-zero clothing weights, aliased by un-morphed instances
+    LLVector4a              *mBaseClothingWeights;
 
     bool                    mHasWeights;
     bool                    mHasDetailTexCoords;
@@ -331,13 +333,19 @@ public:
 private:
     void initializeForMorph();
 
+    // Allocates the private vertex copy on first write access.
+    // Until then the instance aliases the shared base arrays.
+    void materializeVertexData();
+
     // Dumps diagnostic information about the global mesh table
     static void dumpDiagInfo();
 
 protected:
     // mesh data shared across all instances of a given mesh
     LLPolyMeshSharedData    *mSharedData;
-    // Single array of floats for allocation / deletion
+    // Single array of floats for allocation / deletion.
+    // NULL until a morph writes; the pointers below then alias the
+    // shared base arrays instead of a private copy.
     F32                     *mVertexData;
     // deformed vertices (resulting from application of morph targets)
     LLVector4a              *mCoords;
@@ -356,6 +364,10 @@ protected:
 
     LLPolyMesh              *mReferenceMesh;
 
+    // LOD meshes sharing this mesh's vertex storage; repointed when
+    // the private vertex copy is materialized
+    std::vector<LLPolyMesh*> mDependentLODs;
+
     // global mesh list
     typedef std::map<std::string, LLPolyMeshSharedData*> LLPolyMeshSharedDataTable;
     static LLPolyMeshSharedDataTable sGlobalSharedMeshList;
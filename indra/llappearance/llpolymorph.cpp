@@ -581,61 +581,118 @@ void LLPolyMorphTarget::apply( ESex avatar_sex )
 
         F32 *maskWeightArray = (mVertMask) ? mVertMask->getMorphMaskWeights() : NULL;
 
-        for(U32 vert_index_morph = 0; vert_index_morph < mMorphData->mNumIndices; vert_index_morph++)
-        {
-            S32 vert_index_mesh = mMorphData->mVertexIndices[vert_index_morph];
+        // hoisted out of the per-vertex loops below
+        const bool is_clothing_morph = getInfo()->mIsClothingMorph && clothing_weights;
 
-            F32 maskWeight = 1.f;
-            if (maskWeightArray)
+        if (!maskWeightArray && !is_clothing_morph)
+        {
+            // fast path for the common case (no morph mask, not a clothing
+            // morph):  the per-vertex weights collapse to two splatted
+            // constants, leaving pure LLVector4a arithmetic in the loop
+            LLVector4a delta;
+            delta.splat(delta_weight);
+            LLVector4a delta_soften;
+            delta_soften.splat(delta_weight * NORMAL_SOFTEN_FACTOR);
+
+            for (U32 vert_index_morph = 0; vert_index_morph < mMorphData->mNumIndices; vert_index_morph++)
             {
-                maskWeight = maskWeightArray[vert_index_morph];
-            }
+                S32 vert_index_mesh = mMorphData->mVertexIndices[vert_index_morph];
 
+                LLVector4a pos;
+                pos.setMul(mMorphData->mCoords[vert_index_morph], delta);
+                coords[vert_index_mesh].add(pos);
 
-            LLVector4a pos = mMorphData->mCoords[vert_index_morph];
-            pos.mul(delta_weight*maskWeight);
-            coords[vert_index_mesh].add(pos);
+                // calculate new normals based on half angles
+                LLVector4a norm;
+                norm.setMul(mMorphData->mNormals[vert_index_morph], delta_soften);
+                scaled_normals[vert_index_mesh].add(norm);
+                norm = scaled_normals[vert_index_mesh];
 
-            if (getInfo()->mIsClothingMorph && clothing_weights)
-            {
-                LLVector4a clothing_offset = mMorphData->mCoords[vert_index_morph];
-                clothing_offset.mul(delta_weight * maskWeight);
-                LLVector4a* clothing_weight = &clothing_weights[vert_index_mesh];
-                clothing_weight->add(clothing_offset);
-                clothing_weight->getF32ptr()[VW] = maskWeight;
-            }
+                // guard against degenerate input data before we create NaNs below!
+                //
+                norm.normalize3fast();
+                normals[vert_index_mesh] = norm;
+
+                // calculate new binormals
+                LLVector4a binorm = mMorphData->mBinormals[vert_index_morph];
 
-            // calculate new normals based on half angles
-            LLVector4a norm = mMorphData->mNormals[vert_index_morph];
-            norm.mul(delta_weight*maskWeight*NORMAL_SOFTEN_FACTOR);
-            scaled_normals[vert_index_mesh].add(norm);
-            norm = scaled_normals[vert_index_mesh];
+                // guard against degenerate input data before we create NaNs below!
+                //
+                if (!binorm.isFinite3() || (binorm.dot3(binorm).getF32() <= F_APPROXIMATELY_ZERO))
+                {
+                    binorm.set(1,0,0,1);
+                }
 
-            // guard against degenerate input data before we create NaNs below!
-            //
-            norm.normalize3fast();
-            normals[vert_index_mesh] = norm;
+                binorm.mul(delta_soften);
+                scaled_binormals[vert_index_mesh].add(binorm);
+                LLVector4a tangent;
+                tangent.setCross3(scaled_binormals[vert_index_mesh], norm);
+                LLVector4a& normalized_binormal = binormals[vert_index_mesh];
 
-            // calculate new binormals
-            LLVector4a binorm = mMorphData->mBinormals[vert_index_morph];
+                normalized_binormal.setCross3(norm, tangent);
+                normalized_binormal.normalize3fast();
 
-            // guard against degenerate input data before we create NaNs below!
-            //
-            if (!binorm.isFinite3() || (binorm.dot3(binorm).getF32() <= F_APPROXIMATELY_ZERO))
-            {
-                binorm.set(1,0,0,1);
+                tex_coords[vert_index_mesh] += mMorphData->mTexCoords[vert_index_morph] * delta_weight;
             }
+        }
+        else
+        {
+            for(U32 vert_index_morph = 0; vert_index_morph < mMorphData->mNumIndices; vert_index_morph++)
+            {
+                S32 vert_index_mesh = mMorphData->mVertexIndices[vert_index_morph];
+
+                F32 maskWeight = 1.f;
+                if (maskWeightArray)
+                {
+                    maskWeight = maskWeightArray[vert_index_morph];
+                }
+
+
+                LLVector4a pos = mMorphData->mCoords[vert_index_morph];
+                pos.mul(delta_weight*maskWeight);
+                coords[vert_index_mesh].add(pos);
+
+                if (is_clothing_morph)
+                {
+                    LLVector4a clothing_offset = mMorphData->mCoords[vert_index_morph];
+                    clothing_offset.mul(delta_weight * maskWeight);
+                    LLVector4a* clothing_weight = &clothing_weights[vert_index_mesh];
+                    clothing_weight->add(clothing_offset);
+                    clothing_weight->getF32ptr()[VW] = maskWeight;
+                }
 
-            binorm.mul(delta_weight*maskWeight*NORMAL_SOFTEN_FACTOR);
-            scaled_binormals[vert_index_mesh].add(binorm);
-            LLVector4a tangent;
-            tangent.setCross3(scaled_binormals[vert_index_mesh], norm);
-            LLVector4a& normalized_binormal = binormals[vert_index_mesh];
+                // calculate new normals based on half angles
+                LLVector4a norm = mMorphData->mNormals[vert_index_morph];
+                norm.mul(delta_weight*maskWeight*NORMAL_SOFTEN_FACTOR);
+                scaled_normals[vert_index_mesh].add(norm);
+                norm = scaled_normals[vert_index_mesh];
 
-            normalized_binormal.setCross3(norm, tangent);
-            normalized_binormal.normalize3fast();
+                // guard against degenerate input data before we create NaNs below!
+                //
+                norm.normalize3fast();
+                normals[vert_index_mesh] = norm;
 
-            tex_coords[vert_index_mesh] += mMorphData->mTexCoords[vert_index_morph] * delta_weight * maskWeight;
+                // calculate new binormals
+                LLVector4a binorm = mMorphData->mBinormals[vert_index_morph];
+
+                // guard against degenerate input data before we create NaNs below!
+                //
+                if (!binorm.isFinite3() || (binorm.dot3(binorm).getF32() <= F_APPROXIMATELY_ZERO))
+                {
+                    binorm.set(1,0,0,1);
+                }
+
+                binorm.mul(delta_weight*maskWeight*NORMAL_SOFTEN_FACTOR);
+                scaled_binormals[vert_index_mesh].add(binorm);
+                LLVector4a tangent;
+                tangent.setCross3(scaled_binormals[vert_index_mesh], norm);
+                LLVector4a& normalized_binormal = binormals[vert_index_mesh];
+
+                normalized_binormal.setCross3(norm, tangent);
+                normalized_binormal.normalize3fast();
+
+                tex_coords[vert_index_mesh] += mMorphData->mTexCoords[vert_index_morph] * delta_weight * maskWeight;
+            }
         }
 
         // now apply volume changes
@@ -779,7 +779,7 @@ void LLAudioDecodeMgr::processQueue()
     mImpl->processQueue();
 }
 
-bool LLAudioDecodeMgr::addDecodeRequest(const LLUUID &uuid)
+bool LLAudioDecodeMgr::addDecodeRequest(const LLUUID &uuid, bool high_priority)
 {
     if (gAudiop && gAudiop->hasDecodedFile(uuid))
     {
@@ -792,7 +792,18 @@ bool LLAudioDecodeMgr::addDecodeRequest(const LLUUID &uuid)
     {
         // Just put it on the decode queue it if it's not already in the queue
         LL_DEBUGS("AudioEngine") << "addDecodeRequest for " << uuid << " has local asset file already" << LL_ENDL;
-        if (std::find(mImpl->mDecodeQueue.begin(), mImpl->mDecodeQueue.end(), uuid) == mImpl->mDecodeQueue.end())
+        std::deque<LLUUID>::iterator iter =
+            std::find(mImpl->mDecodeQueue.begin(), mImpl->mDecodeQueue.end(), uuid);
+        if (high_priority)
+        {
+            // a source is waiting on this sound; decode it ahead of preloads
+            if (iter != mImpl->mDecodeQueue.end())
+            {
+                mImpl->mDecodeQueue.erase(iter);
+            }
+            mImpl->mDecodeQueue.emplace_front(uuid);
+        }
+        else if (iter == mImpl->mDecodeQueue.end())
         {
             mImpl->mDecodeQueue.emplace_back(uuid);
         }
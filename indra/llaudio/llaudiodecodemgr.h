@@ -43,7 +43,9 @@ class LLAudioDecodeMgr : public LLSingleton<LLAudioDecodeMgr>
     ~LLAudioDecodeMgr();
 public:
     void processQueue();
-    bool addDecodeRequest(const LLUUID &uuid);
+    // high_priority jumps the queue; use it for sounds a source is actively
+    // waiting on (gestures, triggered effects) as opposed to preloads
+    bool addDecodeRequest(const LLUUID &uuid, bool high_priority = false);
     void addAudioRequest(const LLUUID &uuid);
 
 protected:
@@ -503,7 +503,8 @@ bool LLAudioEngine::updateBufferForData(LLAudioData *adp, const LLUUID &audio_uu
         {
             if (audio_uuid.notNull())
             {
-                LLAudioDecodeMgr::getInstance()->addDecodeRequest(audio_uuid);
+                // a source wants to play this now; jump ahead of queued preloads
+                LLAudioDecodeMgr::getInstance()->addDecodeRequest(audio_uuid, true);
             }
         }
         else
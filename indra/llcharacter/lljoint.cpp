@@ -35,6 +35,7 @@
 #include <boost/algorithm/string.hpp>
 
 S32 LLJoint::sNumUpdates = 0;
+U32 LLJoint::sHierarchyVersion = 1;
 S32 LLJoint::sNumTouches = 0;
 
 template <class T>
@@ -110,6 +111,7 @@ void LLJoint::init()
     mUpdateXform = true;
     mSupport = SUPPORT_BASE;
     mEnd = LLVector3(0.0f, 0.0f, 0.0f);
+    mFlatVersion = 0;
 }
 
 LLJoint::LLJoint() :
@@ -272,6 +274,7 @@ void LLJoint::addChild(LLJoint* joint)
     joint->mXform.setParent(&mXform);
     joint->mParent = this;
     joint->touch();
+    sHierarchyVersion++;
 }
 
 
@@ -288,6 +291,7 @@ void LLJoint::removeChild(LLJoint* joint)
         joint->mXform.setParent(NULL);
         joint->mParent = NULL;
         joint->touch();
+        sHierarchyVersion++;
     }
 }
 
@@ -308,6 +312,7 @@ void LLJoint::removeAllChildren()
         }
     }
     mChildren.clear();
+    sHierarchyVersion++;
 }
 
 
@@ -965,14 +970,53 @@ void LLJoint::updateWorldMatrixChildren()
 {
     if (!this->mUpdateXform) return;
 
-    if (mDirtyFlags & MATRIX_DIRTY)
+    if (mFlatVersion != sHierarchyVersion)
     {
-        updateWorldMatrix();
+        buildFlatSubtree();
+    }
+
+    // one linear pass over the flattened subtree; depth-first order
+    // guarantees a parent's matrix is updated before its children's
+    const S32 count = (S32)mFlatSubtree.size();
+    S32 i = 0;
+    while (i < count)
+    {
+        const FlatEntry& entry = mFlatSubtree[i];
+        LLJoint* joint = entry.mJoint;
+        if (!joint->mUpdateXform)
+        {
+            // skip this joint and everything beneath it
+            i = entry.mSubtreeEnd;
+            continue;
+        }
+        if (joint->mDirtyFlags & MATRIX_DIRTY)
+        {
+            joint->updateWorldMatrix();
+        }
+        i++;
     }
+}
+
+//-----------------------------------------------------------------------------
+// buildFlatSubtree()
+//-----------------------------------------------------------------------------
+void LLJoint::buildFlatSubtree()
+{
+    mFlatSubtree.clear();
+    appendFlatSubtree(mFlatSubtree);
+    mFlatVersion = sHierarchyVersion;
+}
+
+void LLJoint::appendFlatSubtree(std::vector<FlatEntry>& list)
+{
+    const size_t my_index = list.size();
+    list.push_back(FlatEntry());
+    list[my_index].mJoint = this;
     for (LLJoint* joint : mChildren)
     {
-        joint->updateWorldMatrixChildren();
+        joint->appendFlatSubtree(list);
     }
+    list[my_index].mSubtreeEnd = (S32)list.size();
 }
 
 //-----------------------------------------------------------------------------
@@ -148,6 +148,20 @@ public:
     typedef std::vector<LLJoint*> joints_t;
     joints_t mChildren;
 
+    // Flattened depth-first copy of this joint's subtree (self first),
+    // rebuilt lazily whenever the skeleton shape changes.  Lets the
+    // per-frame world matrix propagation run as one linear pass instead
+    // of recursing the pointer-linked tree.
+    struct FlatEntry
+    {
+        LLJoint*    mJoint;
+        S32         mSubtreeEnd;    // index one past this entry's subtree
+    };
+    std::vector<FlatEntry> mFlatSubtree;
+    U32             mFlatVersion;
+    // bumped by addChild()/removeChild() to invalidate flat subtrees
+    static U32      sHierarchyVersion;
+
     // debug statics
     static S32      sNumTouches;
     static S32      sNumUpdates;
@@ -268,6 +282,10 @@ public:
     void updateWorldMatrixChildren();
     void updateWorldMatrixParent();
 
+    // rebuild mFlatSubtree from the current hierarchy
+    void buildFlatSubtree();
+    void appendFlatSubtree(std::vector<FlatEntry>& list);
+
     void updateWorldPRSParent();
 
     void updateWorldMatrix();
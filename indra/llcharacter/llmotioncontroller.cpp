@@ -188,6 +188,14 @@ void LLMotionController::deleteAllMotions()
 //-----------------------------------------------------------------------------
 void LLMotionController::purgeExcessMotions()
 {
+    if (mLoadedMotions.size() <= MAX_MOTION_INSTANCES)
+    {
+        // common case:  under the cap, nothing to purge.  This runs every
+        // frame for every character, so get out before building any
+        // bookkeeping containers below.
+        return;
+    }
+
     if (mLoadedMotions.size() > MAX_MOTION_INSTANCES)
     {
         // clean up deprecated motions
@@ -34,6 +34,7 @@
 #include "llmotion.h"
 #include "llmath.h"
 #include "llstl.h"
+#include "llvector4a.h"
 
 //-----------------------------------------------------------------------------
 // Static
@@ -171,6 +172,32 @@ S32 LLPose::getNumJointStates() const
     return (S32)mJointMap.size();
 }
 
+//-----------------------------------------------------------------------------
+// nlerp_vec()
+//-----------------------------------------------------------------------------
+// Normalized lerp of two unit quaternions on LLVector4a lanes; this is the
+// hot kernel of the per-joint blend loop.  Matches nlerp()'s behavior,
+// including the slerp fallback when the pair sits on opposite sides of the
+// quaternion double cover.
+static inline LLQuaternion nlerp_vec(F32 t, const LLQuaternion& a, const LLQuaternion& b)
+{
+    LLVector4a va, vb;
+    va.loadua(a.mQ);
+    vb.loadua(b.mQ);
+
+    if (va.dot4(vb).getF32() < 0.f)
+    {
+        return slerp(t, a, b);
+    }
+
+    LLVector4a blended;
+    blended.setLerp(va, vb, t);
+    blended.normalize4();
+
+    const F32* q = blended.getF32ptr();
+    return LLQuaternion(q[VX], q[VY], q[VZ], q[VW]);
+}
+
 //-----------------------------------------------------------------------------
 // LLJointStateBlender
 //-----------------------------------------------------------------------------
@@ -304,7 +331,7 @@ void LLJointStateBlender::blendJointStates(bool apply_now)
                 F32 new_weight_sum = llmin(1.f, current_weight + sum_weights[ROT_WEIGHT]);
 
                 // add in rotation for this jointstate modulated by weight
-                added_rot = nlerp((new_weight_sum - sum_weights[ROT_WEIGHT]), added_rot, jsp->getRotation()) * added_rot;
+                added_rot = nlerp_vec((new_weight_sum - sum_weights[ROT_WEIGHT]), added_rot, jsp->getRotation()) * added_rot;
             }
         }
         else
@@ -357,7 +384,7 @@ void LLJointStateBlender::blendJointStates(bool apply_now)
                     F32 new_weight_sum = llmin(1.f, current_weight + sum_weights[ROT_WEIGHT]);
 
                     // blend rotations from both
-                    blended_rot = nlerp(sum_weights[ROT_WEIGHT] / new_weight_sum, jsp->getRotation(), blended_rot);
+                    blended_rot = nlerp_vec(sum_weights[ROT_WEIGHT] / new_weight_sum, jsp->getRotation(), blended_rot);
                     sum_weights[ROT_WEIGHT] = new_weight_sum;
                 }
                 else
@@ -419,7 +446,7 @@ void LLJointStateBlender::interpolate(F32 u)
     // SL-315
     target_joint->setPosition(lerp(target_joint->getPosition(), mJointCache.getPosition(), u));
     target_joint->setScale(lerp(target_joint->getScale(), mJointCache.getScale(), u));
-    target_joint->setRotation(nlerp(u, target_joint->getRotation(), mJointCache.getRotation()));
+    target_joint->setRotation(nlerp_vec(u, target_joint->getRotation(), mJointCache.getRotation()));
 }
 
 //-----------------------------------------------------------------------------
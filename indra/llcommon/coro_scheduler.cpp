@@ -22,11 +22,19 @@
 #include "llcallbacklist.h"
 #include "lldate.h"
 #include "llerror.h"
+#include "lltrace.h"
 
 namespace llcoro
 {
 
 const F64 scheduler::DEFAULT_TIMESLICE{ LL::Timers::DEFAULT_TIMESLICE };
+const F64 scheduler::DEFAULT_BUDGET{ LL::Timers::DEFAULT_TIMESLICE / 2 };
+
+// aggregate cost of secondary coroutines, visible in the stats machinery
+static LLTrace::CountStatHandle<F64> sCoroRunTime(
+    "coroutine_run_time", "seconds consumed by secondary coroutines");
+static LLTrace::CountStatHandle<> sCoroResumes(
+    "coroutine_resumes", "number of secondary coroutine resumptions");
 
 const std::string qname("General");
 
@@ -66,14 +74,32 @@ boost::fibers::context* scheduler::pick_next() noexcept
     {
         mMainRunning = false;
         mMainLast = now;
+        // main fiber just ran: open a fresh budget window
+        mCoroTimeSinceMain = 0;
+        mMaxSliceSinceMain = 0;
     }
+    else if (mPickedSecondary)
+    {
+        // The fiber picked by the previous pick_next() call just suspended:
+        // the time since then is what that resumption cost us.
+        F64 slice = now - mLastPickTime;
+        mCoroTimeSinceMain += slice;
+        if (slice > mMaxSliceSinceMain)
+        {
+            mMaxSliceSinceMain = slice;
+        }
+        LLTrace::add(sCoroRunTime, slice);
+        LLTrace::add(sCoroResumes, 1);
+    }
+    mPickedSecondary = false;
 
     boost::fibers::context* next;
 
-    // When the main fiber is ready, and it's been more than mTimeslice since
-    // the main fiber last ran, it's time to intervene.
+    // When the main fiber is ready, and either it's been more than
+    // mTimeslice since the main fiber last ran or secondary fibers have
+    // burned through their consumed-time budget, it's time to intervene.
     F64 elapsed(now - mMainLast);
-    if (mMainCtx && elapsed > mTimeslice)
+    if (mMainCtx && (elapsed > mTimeslice || mCoroTimeSinceMain > mBudget))
     {
         // We claim that the main fiber is not only stored in mMainCtx, but is
         // also queued (somewhere) in our ready list.
@@ -115,7 +141,8 @@ boost::fibers::context* scheduler::pick_next() noexcept
             // Unfortunately round_robin::rqueue_ is private, not protected,
             // so we have no access.
             queue->post(
-                [switches=mSwitches, start=mStart, elapsed, now]
+                [switches=mSwitches, start=mStart, elapsed, now,
+                 coro_time=mCoroTimeSinceMain, max_slice=mMaxSliceSinceMain]
                 ()
                 {
                     U32 runtime(U32(now) - U32(start));
@@ -128,7 +155,11 @@ boost::fibers::context* scheduler::pick_next() noexcept
                         << stringize(minutes, ":", std::setw(2), std::setfill('0'), seconds)
                         << " (" << switches << " switches), coroutines took "
                         << stringize(std::setprecision(4), elapsed)
-                        << " sec, main coroutine jumped queue"
+                        << " sec ("
+                        << stringize(std::setprecision(4), coro_time)
+                        << " sec measured, max slice "
+                        << stringize(std::setprecision(4), max_slice)
+                        << "), main coroutine jumped queue"
                         << LL_ENDL;
                 });
         }
@@ -153,6 +184,13 @@ boost::fibers::context* scheduler::pick_next() noexcept
         // instead, it's "running"
         mMainRunning = true;
     }
+    else if (next)
+    {
+        // a secondary fiber is about to run; the next pick_next() call will
+        // bill it for the time from now until then
+        mPickedSecondary = true;
+    }
+    mLastPickTime = now;
     return next;
 }
 
@@ -40,6 +40,13 @@ public:
     // main fiber last ran, jump the main fiber to the head of the queue.
     static const F64 DEFAULT_TIMESLICE;
 
+    // If secondary fibers have collectively consumed at least this much
+    // measured run time since the main fiber last ran, jump the main fiber
+    // to the head of the queue even before DEFAULT_TIMESLICE has elapsed.
+    // Unlike DEFAULT_TIMESLICE, which is wall time, this only counts time
+    // actually spent running secondary fibers.
+    static const F64 DEFAULT_BUDGET;
+
     scheduler();
     void awakened( boost::fibers::context*) noexcept override;
     boost::fibers::context* pick_next() noexcept override;
@@ -58,6 +65,17 @@ private:
     // If it's been at least this long since the last time the main fiber got
     // control, jump it to the head of the queue.
     F64 mTimeslice{ DEFAULT_TIMESLICE };
+    // Consumed-time budget for secondary fibers between main fiber runs.
+    F64 mBudget{ DEFAULT_BUDGET };
+    // Measured run time of secondary fibers since the main fiber last ran.
+    F64 mCoroTimeSinceMain{ 0 };
+    // Longest single resumption in that interval, for the jump-queue log.
+    F64 mMaxSliceSinceMain{ 0 };
+    // Timestamp as of the last pick_next() return, and whether that call
+    // picked a secondary fiber: lets the next pick_next() call attribute the
+    // intervening time to the fiber that just suspended.
+    F64 mLastPickTime{ 0 };
+    bool mPickedSecondary{ false };
     // Timestamp as of the last time we suspended the main fiber.
     F64 mMainLast{ 0 };
     // Timestamp of start time
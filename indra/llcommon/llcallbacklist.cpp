@@ -31,7 +31,9 @@
 #include "llsdutil.h"
 #include "tempset.h"
 #include <boost/container_hash/hash.hpp>
+#include <algorithm>
 #include <iomanip>
+#include <tuple>
 #include <vector>
 
 //
@@ -107,6 +109,7 @@ void LLCallbackList::deleteAllFunctions()
 
 void LLCallbackList::callFunctions()
 {
+    LL_PROFILE_ZONE_SCOPED;
     mCallbackList();
 }
 
@@ -116,6 +119,7 @@ LLCallbackList::handle_t LLCallbackList::doOnIdleOneTime( const callable_t& func
     return mCallbackList.connect_extended(
         [func](const handle_t& handle)
         {
+            LL_PROFILE_ZONE_NAMED("doOnIdleOneTime");
             handle.disconnect();
             func();
         });
@@ -126,6 +130,9 @@ LLCallbackList::handle_t LLCallbackList::doOnIdleRepeating( const bool_func_t& f
     return mCallbackList.connect_extended(
         [func](const handle_t& handle)
         {
+            // Every one of these runs every single frame: an unaccounted tax
+            // on the idle loop. At least make each slot show up in profiles.
+            LL_PROFILE_ZONE_NAMED("doOnIdleRepeating");
             if (func())
             {
                 handle.disconnect();
@@ -161,8 +168,15 @@ Timers::handle_t Timers::scheduleEvery(bool_func_t callable, F32 seconds)
     return scheduleAtEvery(callable, now() + seconds, seconds);
 }
 
+Timers::handle_t Timers::scheduleEvery(const std::string& name, bool_func_t callable,
+                                       F32 seconds, Priority priority)
+{
+    return scheduleAtEvery(callable, now() + seconds, seconds, name, priority);
+}
+
 Timers::handle_t Timers::scheduleAtEvery(bool_func_t callable,
-                                             LLDate::timestamp time, F32 interval)
+                                             LLDate::timestamp time, F32 interval,
+                                             const std::string& name, Priority priority)
 {
     // Pick token FIRST to store a self-reference in mQueue's managed node as
     // well as in mMeta. Pre-increment to distinguish 0 from any live
@@ -171,7 +185,8 @@ Timers::handle_t Timers::scheduleAtEvery(bool_func_t callable,
     // For the moment, store a default-constructed mQueue handle --
     // we'll fill in later.
     auto [iter, inserted] = mMeta.emplace(token,
-                                          Metadata{ queue_t::handle_type(), time, interval });
+                                          Metadata{ queue_t::handle_type(), time, interval,
+                                                    name, priority });
     // It's important that our token is unique.
     llassert(inserted);
 
@@ -293,6 +308,32 @@ void Timers::setTimeslice(F32 timeslice)
     }
 }
 
+void Timers::logStats() const
+{
+    // (name, calls, total seconds, max seconds), most expensive first
+    std::vector<std::tuple<std::string, U32, F64, F64>> stats;
+    stats.reserve(mMeta.size());
+    for (const auto& [token, meta] : mMeta)
+    {
+        if (meta.mCalls)
+        {
+            stats.emplace_back(meta.mName.empty() ? "(unnamed)" : meta.mName,
+                               meta.mCalls, meta.mTotalTime, meta.mMaxTime);
+        }
+    }
+    std::sort(stats.begin(), stats.end(),
+              [](const auto& lhs, const auto& rhs)
+              { return std::get<2>(lhs) > std::get<2>(rhs); });
+    LL_INFOS("Timers") << stats.size() << " scheduled tasks have run:" << LL_ENDL;
+    for (const auto& [name, calls, total, maxtime] : stats)
+    {
+        LL_INFOS("Timers") << "  " << name << ": " << calls << " calls, "
+                           << stringize(std::setprecision(4), total * 1000) << "ms total, "
+                           << stringize(std::setprecision(4), maxtime * 1000) << "ms max"
+                           << LL_ENDL;
+    }
+}
+
 bool Timers::tick()
 {
     // Fetch current time only on entry, even though running some mQueue task
@@ -301,11 +342,19 @@ bool Timers::tick()
     // starve it if we have a sequence of tasks that take nontrivial time.
     auto now{ LLDate::now().secondsSinceEpoch() };
     auto cutoff{ now + mTimeslice };
+    // Once a tick() has spent half its timeslice, stop even starting ready
+    // LOW-priority tasks: whatever remains of the slice is reserved for
+    // HIGH-priority tasks that are also due.
+    auto low_cutoff{ now + mTimeslice / 2 };
 
     // Capture tasks we've processed but that want to be rescheduled.
     // Defer rescheduling them immediately to avoid getting stuck looping over
     // a recurring task with a nonpositive interval.
-    std::vector<std::pair<MetaMap::iterator, func_at>> deferred;
+    // (static: tick() runs only on the main thread -- see NOTE on data
+    // members -- and recurring tasks fire all session long, so don't pay a
+    // heap allocation every time one comes due)
+    static std::vector<std::pair<MetaMap::iterator, func_at>> deferred;
+    deferred.resize(0);
 
     while (! mQueue.empty())
     {
@@ -316,7 +365,8 @@ bool Timers::tick()
             // done with this tick()
             break;
         }
-        if (LLDate::now().secondsSinceEpoch() > cutoff)
+        auto before{ LLDate::now().secondsSinceEpoch() };
+        if (before > cutoff)
         {
             // we still have ready tasks, but we've already eaten too much
             // time this tick() -- defer until next tick()
@@ -326,11 +376,31 @@ bool Timers::tick()
         // Found a ready task. Look up its corresponding mMeta entry.
         auto meta{ mMeta.find(top.mToken) };
         llassert(meta != mMeta.end());
+
+        if (meta->second.mPriority == Priority::LOW && before > low_cutoff)
+        {
+            // This task is ready, but it's LOW deadline class and we've
+            // already spent the LOW share of the timeslice: shed it to a
+            // future tick() without running it at all. Push its fire time
+            // out by at least one timeslice -- not merely to 'now' -- so a
+            // short-interval task can't sit at top() getting re-shed by
+            // this same test forever.
+            meta->second.mTime = now + std::max(F64(meta->second.mInterval), F64(mTimeslice));
+            deferred.emplace_back(meta,
+                                  func_at(std::move(const_cast<func_at&>(top).mFunc),
+                                          top.mToken, meta->second.mTime));
+            mQueue.pop();
+            continue;
+        }
+
         bool done;
         {
             // Mark our mMeta entry so we don't cancel this timer while its
             // callback is running, but unmark it even in case of exception.
             TempSet running(meta->second.mRunning, true);
+            // Surface the task in profiler captures under its given name.
+            LL_PROFILE_ZONE_NAMED("Timers task");
+            LL_PROFILE_ZONE_TEXT(meta->second.mName.c_str(), meta->second.mName.size());
             // run the callback and capture its desire to end repetition
             try
             {
@@ -345,6 +415,12 @@ bool Timers::tick()
             }
         } // clear mRunning
 
+        // charge this run to the task's accounting
+        F64 elapsed{ LLDate::now().secondsSinceEpoch() - before };
+        meta->second.mCalls++;
+        meta->second.mTotalTime += elapsed;
+        meta->second.mMaxTime = std::max(meta->second.mMaxTime, elapsed);
+
         // If mFunc() returned true (all done, stop calling me) or
         // meta->mCancel (somebody tried to cancel this timer during the
         // callback call), then we're done: clean up both entries.
@@ -358,10 +434,13 @@ bool Timers::tick()
             // mFunc returned false, and nobody asked to cancel:
             // continue calling this task at a future time.
             meta->second.mTime += meta->second.mInterval;
-            // capture this task to reschedule once we break loop
-            deferred.push_back({meta, top});
-            // update func_at's mTime to match meta's
-            deferred.back().second.mTime = meta->second.mTime;
+            // Capture this task to reschedule once we break loop. Move the
+            // callable out of the heap node rather than copying it: heap
+            // order depends only on mTime, and the pop() below discards the
+            // node anyway.
+            deferred.emplace_back(meta,
+                                  func_at(std::move(const_cast<func_at&>(top).mFunc),
+                                          top.mToken, meta->second.mTime));
         }
         // Remove the mQueue entry regardless, or we risk stalling the
         // queue right here if we have a nonpositive interval.
@@ -369,9 +448,9 @@ bool Timers::tick()
     }
 
     // Now reschedule any tasks that need to be rescheduled.
-    for (const auto& [meta, task] : deferred)
+    for (auto& [meta, task] : deferred)
     {
-        auto handle{ mQueue.push(task) };
+        auto handle{ mQueue.push(std::move(task)) };
         // track this new mQueue handle_type
         meta->second.mHandle = handle;
     }
@@ -165,6 +165,17 @@ public:
         bool operator!() const { return ! bool(*this); }
     };
 
+    // Deadline class for a scheduled task. HIGH tasks run whenever they come
+    // ready, subject only to the overall timeslice. LOW tasks are the first
+    // to be shed under load: once half the timeslice is spent in a given
+    // tick(), ready LOW tasks are pushed to a future tick() without running
+    // at all, leaving the rest of the slice for HIGH tasks.
+    enum class Priority
+    {
+        HIGH,
+        LOW
+    };
+
     // Call a given callable once at specified timestamp.
     handle_t scheduleAt(nullary_func_t callable, LLDate::timestamp time);
 
@@ -174,6 +185,13 @@ public:
     // Call a given callable every specified number of seconds, until it returns true.
     handle_t scheduleEvery(bool_func_t callable, F32 seconds);
 
+    // Like the above, but tag the task with a name -- surfaced in profiler
+    // captures and logStats() -- and a deadline class. Prefer this overload
+    // for new repeating tasks over doOnIdleRepeating(): a task with a real
+    // period gets spread across frames instead of taxing every single one.
+    handle_t scheduleEvery(const std::string& name, bool_func_t callable, F32 seconds,
+                           Priority priority = Priority::HIGH);
+
     // test whether specified handle is still live
     bool isRunning(handle_t timer) const;
     // check remaining time
@@ -189,6 +207,10 @@ public:
     F32  getTimeslice() const { return mTimeslice; }
     void setTimeslice(F32 timeslice);
 
+    // Log per-task accounting (call count, total and max run time) for every
+    // live task that has run at least once, most expensive first.
+    void logStats() const;
+
     // Store a handle_t returned by scheduleAt(), scheduleAfter() or
     // scheduleEvery() in a temp_handle_t to cancel() automatically on
     // destruction of the temp_handle_t.
@@ -244,7 +266,8 @@ public:
     };
 
 private:
-    handle_t scheduleAtEvery(bool_func_t callable, LLDate::timestamp time, F32 interval);
+    handle_t scheduleAtEvery(bool_func_t callable, LLDate::timestamp time, F32 interval,
+                             const std::string& name = {}, Priority priority = Priority::HIGH);
     LLDate::timestamp now() const { return LLDate::now().secondsSinceEpoch(); }
     // wrap a nullary_func_t with a bool_func_t that will only execute once
     bool_func_t once(nullary_func_t callable)
@@ -274,6 +297,14 @@ private:
         LLDate::timestamp mTime;
         // interval at which this timer is supposed to fire repeatedly
         F32 mInterval{ 0 };
+        // task name, surfaced in profiler captures and logStats()
+        std::string mName;
+        // deadline class: LOW tasks are shed first when a tick() runs long
+        Priority mPriority{ Priority::HIGH };
+        // accounting, reported by logStats()
+        U32 mCalls{ 0 };
+        F64 mTotalTime{ 0 };
+        F64 mMaxTime{ 0 };
         // mFunc is currently running: don't delete this entry
         bool mRunning{ false };
         // cancel() was called while mFunc was running: deferred cancel
@@ -305,4 +336,13 @@ LL::Timers::handle_t doPeriodically(bool_func_t callable, F32 seconds)
     return LL::Timers::instance().scheduleEvery(callable, seconds);
 }
 
+// As above, but tag the task with a name and a deadline class;
+// see LL::Timers::scheduleEvery().
+inline
+LL::Timers::handle_t doPeriodically(const std::string& name, bool_func_t callable, F32 seconds,
+                                    LL::Timers::Priority priority = LL::Timers::Priority::HIGH)
+{
+    return LL::Timers::instance().scheduleEvery(name, callable, seconds, priority);
+}
+
 #endif
@@ -32,6 +32,9 @@
 #include "llsdutil.h"
 
 #include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <thread>
 #ifdef __GNUC__
 # include <cxxabi.h>
 #endif // __GNUC__
@@ -151,6 +154,7 @@ namespace {
 
         ~RecordToFile()
         {
+            stopWriter();
             mFile.close();
         }
 
@@ -171,7 +175,30 @@ namespace {
                                     const std::string& message) override
         {
             LL_PROFILE_ZONE_SCOPED_CATEGORY_LOGGING;
-            if (LLError::getAlwaysFlush())
+            if (LLError::getAsyncFileRecording())
+            {
+                // hand the preformatted record to the writer thread; drop
+                // (and count) on overflow rather than blocking this thread
+                std::unique_lock<std::mutex> lock(mQueueMutex);
+                if (!mWriter.joinable())
+                {
+                    mWriter = std::thread([this]{ writerLoop(); });
+                }
+                if (mQueue.size() >= MAX_QUEUED_MESSAGES)
+                {
+                    ++mDropped;
+                    return;
+                }
+                mQueue.push_back(message);
+                mQueueCond.notify_one();
+                if (level == LLError::LEVEL_ERROR)
+                {
+                    // we are about to crash: don't return until the writer
+                    // thread has pushed everything to disk
+                    mDrainCond.wait(lock, [this]{ return mQueue.empty(); });
+                }
+            }
+            else if (LLError::getAlwaysFlush())
             {
                 mFile << message << std::endl;
             }
@@ -182,8 +209,66 @@ namespace {
         }
 
     private:
+        // cap the backlog disk I/O can accumulate before we start dropping
+        static const size_t MAX_QUEUED_MESSAGES = 4096;
+
+        void writerLoop()
+        {
+            std::unique_lock<std::mutex> lock(mQueueMutex);
+            while (true)
+            {
+                mQueueCond.wait(lock, [this]{ return mShutdown || !mQueue.empty(); });
+                while (!mQueue.empty())
+                {
+                    std::string message = std::move(mQueue.front());
+                    mQueue.pop_front();
+                    lock.unlock();
+                    mFile << message << "\n";
+                    lock.lock();
+                }
+                U32 dropped = mDropped;
+                mDropped = 0;
+                lock.unlock();
+                if (dropped)
+                {
+                    mFile << "WARNING: dropped " << dropped
+                          << " log messages (async log queue overflow)" << "\n";
+                }
+                // only flush once the backlog is drained
+                mFile.flush();
+                lock.lock();
+                mDrainCond.notify_all();
+                if (mShutdown && mQueue.empty())
+                {
+                    return;
+                }
+            }
+        }
+
+        void stopWriter()
+        {
+            std::thread writer;
+            {
+                std::unique_lock<std::mutex> lock(mQueueMutex);
+                mShutdown = true;
+                writer.swap(mWriter);
+            }
+            mQueueCond.notify_one();
+            if (writer.joinable())
+            {
+                writer.join();
+            }
+        }
+
         const std::string mName;
         llofstream mFile;
+        std::mutex mQueueMutex;
+        std::condition_variable mQueueCond;
+        std::condition_variable mDrainCond;
+        std::deque<std::string> mQueue;
+        std::thread mWriter;
+        U32 mDropped{ 0 };
+        bool mShutdown{ false };
     };
 
 
@@ -496,6 +581,7 @@ namespace
         LLError::ELevel                     mDefaultLevel;
 
         bool                                mLogAlwaysFlush;
+        bool                                mLogAsyncFile;
 
         U32                                 mEnabledLogTypesMask;
 
@@ -523,6 +609,7 @@ namespace
         : LLRefCount(),
         mDefaultLevel(LLError::LEVEL_DEBUG),
         mLogAlwaysFlush(true),
+        mLogAsyncFile(false),
         mEnabledLogTypesMask(255),
         mFunctionLevelMap(),
         mClassLevelMap(),
@@ -831,6 +918,18 @@ namespace LLError
         return s->mLogAlwaysFlush;
     }
 
+    void setAsyncFileRecording(bool async)
+    {
+        SettingsConfigPtr s = Globals::getInstance()->getSettingsConfig();
+        s->mLogAsyncFile = async;
+    }
+
+    bool getAsyncFileRecording()
+    {
+        SettingsConfigPtr s = Globals::getInstance()->getSettingsConfig();
+        return s->mLogAsyncFile;
+    }
+
     void setEnabledLogTypesMask(U32 mask)
     {
         SettingsConfigPtr s = Globals::getInstance()->getSettingsConfig();
@@ -75,6 +75,10 @@ namespace LLError
     LL_COMMON_API ELevel getDefaultLevel();
     LL_COMMON_API void setAlwaysFlush(bool flush);
     LL_COMMON_API bool getAlwaysFlush();
+    // route file log writes through a background writer thread; records are
+    // dropped (and counted) rather than blocking when the writer falls behind
+    LL_COMMON_API void setAsyncFileRecording(bool async);
+    LL_COMMON_API bool getAsyncFileRecording();
     LL_COMMON_API void setEnabledLogTypesMask(U32 mask);
     LL_COMMON_API U32 getEnabledLogTypesMask();
     LL_COMMON_API void setFunctionLevel(const std::string& function_name, LLError::ELevel);
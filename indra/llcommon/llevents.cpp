@@ -59,6 +59,7 @@
 #include "lleventfilter.h"
 #include "llexception.h"
 #include "llsdutil.h"
+#include "lltrace.h"
 #include "stringize.h"
 #if LL_MSVC
 #pragma warning (disable : 4702)
@@ -75,7 +76,9 @@ LLEventPumps::LLEventPumps():
         { "LLEventMailDrop", [](const std::string& name, bool tweak, const std::string& /*type*/)
                              { return new LLEventMailDrop(name, tweak); } },
         { "LLEventLogProxy", [](const std::string& name, bool tweak, const std::string& /*type*/)
-                             { return new LLEventLogProxyFor<LLEventStream>(name, tweak); } }
+                             { return new LLEventLogProxyFor<LLEventStream>(name, tweak); } },
+        { "LLEventThreadQueue", [](const std::string& name, bool tweak, const std::string& /*type*/)
+                             { return new LLEventThreadQueue(name, tweak); } }
     },
     mTypes
     {
@@ -692,6 +695,63 @@ void LLEventMailDrop::discard()
     mEventHistory.clear();
 }
 
+/*****************************************************************************
+ *   LLEventThreadQueue
+ *****************************************************************************/
+// delivered/dropped totals across all LLEventThreadQueue instances
+static LLTrace::CountStatHandle<> sThreadQueueDelivered("eventthreadqueue_delivered",
+    "events delivered through LLEventThreadQueue pumps");
+static LLTrace::CountStatHandle<> sThreadQueueDropped("eventthreadqueue_dropped",
+    "events dropped by full LLEventThreadQueue pumps");
+
+LLEventThreadQueue::LLEventThreadQueue(const std::string& name, bool tweak, size_t capacity):
+    LLEventStream(name, tweak),
+    mQueue(capacity),
+    mDropped(0)
+{
+    // drain queued events once per frame
+    mMainLoopConn = LLEventPumps::instance().obtain("mainloop")
+        .listen(getName() + ".flush",
+                [this](const LLSD&){ flush(); return false; });
+}
+
+bool LLEventThreadQueue::post(const LLSD& event)
+{
+    if (! mEnabled)
+    {
+        return false;
+    }
+    if (! mQueue.tryPush(event))
+    {
+        mDropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void LLEventThreadQueue::flush()
+{
+    LLSD event;
+    S32 delivered = 0;
+    while (mQueue.tryPop(event))
+    {
+        LLEventStream::post(event);
+        ++delivered;
+    }
+    if (delivered)
+    {
+        LLTrace::add(sThreadQueueDelivered, delivered);
+    }
+    U32 dropped = mDropped.exchange(0, std::memory_order_relaxed);
+    if (dropped)
+    {
+        LLTrace::add(sThreadQueueDropped, dropped);
+        LL_WARNS_ONCE("LLEventThreadQueue") << "LLEventThreadQueue(" << getName()
+                                            << ") dropped " << dropped
+                                            << " events; queue capacity too small?" << LL_ENDL;
+    }
+}
+
 /*****************************************************************************
 *   LLListenerOrPumpName
 *****************************************************************************/
@@ -32,6 +32,7 @@
 #if ! defined(LL_LLEVENTS_H)
 #define LL_LLEVENTS_H
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <map>
@@ -47,6 +48,7 @@
 #include "llexception.h"
 #include "llsd.h"
 #include "llsingleton.h"
+#include "llthreadsafequeue.h"
 
 // hack for testing
 #ifndef testable
@@ -664,6 +666,40 @@ private:
     EventList mEventHistory;
 };
 
+/*****************************************************************************
+ *   LLEventThreadQueue
+ *****************************************************************************/
+/**
+ * LLEventThreadQueue is an LLEventStream variant whose post() method may
+ * safely be called from any thread. Rather than invoking listeners
+ * directly -- which would run them on the posting thread and serialize
+ * every poster on the signal machinery -- post() pushes the event onto a
+ * bounded thread-safe queue. Queued events are delivered to listeners in
+ * order, in a batch on the main thread: once per frame via the "mainloop"
+ * pump, or whenever flush() is called.
+ *
+ * post() returns false and drops the event if the queue is full, so pick
+ * a capacity suited to the pump's worst-case per-frame burst. Delivered
+ * and dropped totals are recorded with LLTrace.
+ */
+class LL_COMMON_API LLEventThreadQueue : public LLEventStream
+{
+public:
+    LLEventThreadQueue(const std::string& name, bool tweak = false, size_t capacity = 1024);
+    virtual ~LLEventThreadQueue() {}
+
+    /// Queue an event for delivery from the main loop; any thread.
+    virtual bool post(const LLSD& event) override;
+
+    /// Deliver all queued events to listeners; main thread only.
+    virtual void flush() override;
+
+private:
+    LLThreadSafeQueue<LLSD> mQueue;
+    std::atomic<U32> mDropped;
+    LLTempBoundListener mMainLoopConn;
+};
+
 /*****************************************************************************
 *   LLNamedListener
 *****************************************************************************/
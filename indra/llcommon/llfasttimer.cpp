@@ -63,6 +63,7 @@ namespace LLTrace
 bool        BlockTimer::sLog             = false;
 std::string BlockTimer::sLogName         = "";
 bool        BlockTimer::sMetricLog       = false;
+bool        BlockTimer::sFlightRecorder  = false;
 
 #if LL_LINUX
 U64         BlockTimer::sClockResolution = 1000000000; // Nanosecond resolution
@@ -433,6 +434,187 @@ void BlockTimer::writeLog(std::ostream& os)
     }
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// flight recorder
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    struct FlightEvent
+    {
+        U64                         mTimestamp;
+        const BlockTimerStatHandle* mBlock;
+        bool                        mBegin;
+    };
+
+    // roughly the last several seconds of a busy main thread; must be a
+    // power of two so the ring index can wrap with a mask
+    const size_t FLIGHT_RING_CAPACITY = 1 << 16;
+
+    class FlightEventRing;
+    LLMutex sFlightRingsMutex;
+    std::vector<FlightEventRing*> sFlightRings;
+    S32 sNextFlightThreadId = 0;
+
+    // Each recording thread owns one of these (see getFlightRing() below).
+    // The registry above only tracks live rings so writeFlightRecorder() can
+    // visit them; a ring unregisters itself when its thread exits.
+    class FlightEventRing
+    {
+    public:
+        FlightEventRing()
+        :   mEvents(FLIGHT_RING_CAPACITY),
+            mCount(0)
+        {
+            LLMutexLock lock(&sFlightRingsMutex);
+            mThreadId = sNextFlightThreadId++;
+            sFlightRings.push_back(this);
+        }
+
+        ~FlightEventRing()
+        {
+            LLMutexLock lock(&sFlightRingsMutex);
+            sFlightRings.erase(std::remove(sFlightRings.begin(), sFlightRings.end(), this),
+                               sFlightRings.end());
+        }
+
+        void record(const BlockTimerStatHandle* block, U64 timestamp, bool begin)
+        {
+            // uncontended except while a dump or clear is in progress
+            LLMutexLock lock(&mMutex);
+            FlightEvent& event = mEvents[mCount & (FLIGHT_RING_CAPACITY - 1)];
+            event.mTimestamp = timestamp;
+            event.mBlock = block;
+            event.mBegin = begin;
+            ++mCount;
+        }
+
+        void snapshot(std::vector<FlightEvent>& events) const
+        {
+            LLMutexLock lock(&mMutex);
+            size_t stored = llmin(mCount, FLIGHT_RING_CAPACITY);
+            size_t oldest = mCount - stored;
+            events.reserve(stored);
+            for (size_t i = oldest; i < mCount; ++i)
+            {
+                events.push_back(mEvents[i & (FLIGHT_RING_CAPACITY - 1)]);
+            }
+        }
+
+        void clear()
+        {
+            LLMutexLock lock(&mMutex);
+            mCount = 0;
+        }
+
+        S32 getThreadId() const { return mThreadId; }
+
+    private:
+        mutable LLMutex          mMutex;
+        std::vector<FlightEvent> mEvents;
+        size_t                   mCount;    // events ever recorded; ring holds the tail
+        S32                      mThreadId;
+    };
+
+    FlightEventRing& getFlightRing()
+    {
+        static thread_local FlightEventRing tRing;
+        return tRing;
+    }
+
+    // escape a timer name for embedding in a JSON string literal
+    std::string json_escape(const std::string& name)
+    {
+        std::string out;
+        out.reserve(name.size());
+        for (char c : name)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+            }
+            out += c;
+        }
+        return out;
+    }
+} // anonymous namespace
+
+//static
+void BlockTimer::setFlightRecorderEnabled(bool enabled)
+{
+    if (enabled && !sFlightRecorder)
+    {
+        // drop whatever a previous recording session left behind
+        LLMutexLock lock(&sFlightRingsMutex);
+        for (FlightEventRing* ring : sFlightRings)
+        {
+            ring->clear();
+        }
+    }
+    sFlightRecorder = enabled;
+}
+
+//static
+void BlockTimer::recordFlightEvent(BlockTimerStatHandle* block, U64 timestamp, bool begin)
+{
+    getFlightRing().record(block, timestamp, begin);
+}
+
+//static
+void BlockTimer::writeFlightRecorder(std::ostream& os)
+{
+    // one snapshot per live thread, each taken under its ring's lock, so
+    // recording can continue while we format the dump
+    std::vector<std::pair<S32, std::vector<FlightEvent>>> threads;
+    {
+        LLMutexLock lock(&sFlightRingsMutex);
+        for (const FlightEventRing* ring : sFlightRings)
+        {
+            threads.emplace_back(ring->getThreadId(), std::vector<FlightEvent>());
+            ring->snapshot(threads.back().second);
+        }
+    }
+
+    // use the oldest buffered event as time zero to keep timestamps small
+    U64 epoch = 0;
+    bool have_epoch = false;
+    for (const auto& thread : threads)
+    {
+        if (!thread.second.empty()
+            && (!have_epoch || thread.second.front().mTimestamp < epoch))
+        {
+            epoch = thread.second.front().mTimestamp;
+            have_epoch = true;
+        }
+    }
+
+    const F64 usec_per_count = 1000000.0 / (F64)countsPerSecond();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& thread : threads)
+    {
+        // a full ring has overwritten the "begin" halves of its oldest
+        // blocks; skip unmatched "end" events so the trace stays balanced
+        S32 depth = 0;
+        for (const FlightEvent& event : thread.second)
+        {
+            if (!event.mBegin && depth == 0) continue;
+            depth += event.mBegin ? 1 : -1;
+            if (!first)
+            {
+                os << ",";
+            }
+            first = false;
+            os << "\n{\"ph\":\"" << (event.mBegin ? 'B' : 'E')
+               << "\",\"pid\":1,\"tid\":" << thread.first
+               << ",\"ts\":" << (F64)(event.mTimestamp - epoch) * usec_per_count
+               << ",\"name\":\"" << json_escape(event.mBlock->getName()) << "\"}";
+        }
+    }
+    os << "\n]}\n";
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // TimeBlockAccumulator
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
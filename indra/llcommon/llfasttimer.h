@@ -184,6 +184,15 @@ public:
     static void writeLog(std::ostream& os);
     static void updateTimes();
 
+    // opt-in flight recorder: while enabled, every block begin/end event is
+    // appended to a per-thread ring buffer holding the last several seconds
+    // of activity, for on-demand export as chrome://tracing / Perfetto JSON
+    static void setFlightRecorderEnabled(bool enabled);
+    static bool getFlightRecorderEnabled() { return sFlightRecorder; }
+    // write buffered flight recorder events as a chrome://tracing JSON
+    // object; recording may continue while this runs
+    static void writeFlightRecorder(std::ostream& os);
+
     static U64 countsPerSecond();
 
     // updates cumulative times and hierarchy,
@@ -213,6 +222,9 @@ private:
     BlockTimer(const BlockTimer& other);
     BlockTimer& operator=(const BlockTimer& other);
 
+    // out-of-line so the disabled case costs the inline paths only a branch
+    static void recordFlightEvent(BlockTimerStatHandle* block, U64 timestamp, bool begin);
+
 private:
     U64                     mStartTime;
     BlockTimerStackRecord   mParentTimerData{};
@@ -221,7 +233,8 @@ public:
     // statics
     static std::string      sLogName;
     static bool             sMetricLog,
-                            sLog;
+                            sLog,
+                            sFlightRecorder;
     static U64              sClockResolution;
 
 };
@@ -306,6 +319,11 @@ LL_FORCE_INLINE BlockTimer::BlockTimer(BlockTimerStatHandle& timer)
     cur_timer_data->mChildTime = 0;
 
     mStartTime = getCPUClockCount64();
+
+    if (sFlightRecorder)
+    {
+        recordFlightEvent(&timer, mStartTime, true);
+    }
 #endif
 }
 
@@ -330,6 +348,11 @@ LL_FORCE_INLINE BlockTimer::~BlockTimer()
     // we are only tracking self time, so subtract our total time delta from parents
     mParentTimerData.mChildTime += total_time;
 
+    if (sFlightRecorder)
+    {
+        recordFlightEvent(cur_timer_data->mTimeBlock, mStartTime + total_time, false);
+    }
+
     //pop stack
     *cur_timer_data = mParentTimerData;
 #endif
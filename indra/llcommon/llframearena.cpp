@@ -0,0 +1,126 @@
+/**
+ * @file llframearena.cpp
+ * @brief Per-thread bump arena for frame-transient allocations.
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llframearena.h"
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+
+struct Chunk
+{
+    U8* mData;
+    size_t mSize;
+};
+
+// One arena per thread:  allocate() and reset() never touch another
+// thread's chunks, so no locking is needed.  Chunks are retained across
+// reset() and freed only at thread exit.
+struct ThreadArena
+{
+    std::vector<Chunk> mChunks;
+    size_t mCurrent{ 0 };       // chunk the cursor lives in
+    size_t mOffset{ 0 };        // bump cursor within that chunk
+    size_t mUsed{ 0 };          // bytes handed out since last reset
+
+    ~ThreadArena()
+    {
+        for (Chunk& chunk : mChunks)
+        {
+            free(chunk.mData);
+        }
+    }
+};
+
+ThreadArena& arena()
+{
+    static thread_local ThreadArena sArena;
+    return sArena;
+}
+
+} // anonymous namespace
+
+// static
+void* LLFrameArena::allocate(size_t size, size_t alignment)
+{
+    ThreadArena& a = arena();
+
+    for (;;)
+    {
+        while (a.mCurrent < a.mChunks.size())
+        {
+            // align the actual address, not the offset; chunk bases are
+            // only guaranteed malloc alignment
+            Chunk& chunk = a.mChunks[a.mCurrent];
+            uintptr_t cursor = (uintptr_t)(chunk.mData + a.mOffset);
+            uintptr_t aligned = (cursor + alignment - 1) & ~((uintptr_t)alignment - 1);
+            size_t new_offset = (size_t)(aligned - (uintptr_t)chunk.mData) + size;
+            if (new_offset <= chunk.mSize)
+            {
+                a.mOffset = new_offset;
+                a.mUsed += size;
+                return (void*)aligned;
+            }
+            // advance into the retained chain before growing it
+            ++a.mCurrent;
+            a.mOffset = 0;
+        }
+
+        // chain exhausted:  append a chunk big enough for this request
+        // and let the loop above carve from it
+        size_t chunk_size = CHUNK_SIZE;
+        if (size + alignment > chunk_size)
+        {
+            chunk_size = size + alignment;
+        }
+        U8* data = (U8*)malloc(chunk_size);
+        if (!data)
+        {
+            throw std::bad_alloc();
+        }
+        a.mChunks.push_back(Chunk{ data, chunk_size });
+    }
+}
+
+// static
+void LLFrameArena::reset()
+{
+    ThreadArena& a = arena();
+    a.mCurrent = 0;
+    a.mOffset = 0;
+    a.mUsed = 0;
+}
+
+// static
+size_t LLFrameArena::bytesUsed()
+{
+    return arena().mUsed;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file llframearena.h
+ * @brief Per-thread bump arena for frame-transient allocations.
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLFRAMEARENA_H
+#define LL_LLFRAMEARENA_H
+
+#include <cstddef>
+
+#include "llpreprocessor.h"
+
+/**
+ * Bump allocator for allocations that live no longer than the current
+ * frame:  cull scratch lists, traversal state, and similar transients
+ * that otherwise churn the global heap every frame.  Each thread gets
+ * its own arena, so allocate() is a pointer bump with no locking.
+ *
+ * Nothing is ever freed individually; the frame loop calls reset() once
+ * per frame, which rewinds every chunk for reuse (chunks are retained,
+ * so a warmed-up arena performs no heap calls at all).  Consequently
+ * memory obtained here -- directly or via LLFrameArenaAllocator --
+ * MUST NOT outlive the frame that allocated it.
+ */
+class LL_COMMON_API LLFrameArena
+{
+public:
+    static const size_t CHUNK_SIZE = 1024 * 1024;
+
+    // Returns size bytes aligned to alignment (a power of two).
+    // Throws std::bad_alloc when the underlying chunk allocation fails.
+    static void* allocate(size_t size, size_t alignment);
+
+    // Rewind this thread's arena, invalidating everything allocated
+    // from it since the previous reset().  Call once per frame, from a
+    // point where no arena-backed object is live.
+    static void reset();
+
+    // Bytes handed out by this thread's arena since the last reset().
+    static size_t bytesUsed();
+};
+
+/**
+ * STL-compatible allocator over LLFrameArena, for containers that are
+ * built and discarded within a single frame:
+ *
+ *   std::vector<LLDrawable*, LLFrameArenaAllocator<LLDrawable*>> scratch;
+ *
+ * deallocate() is a no-op; the storage is reclaimed wholesale by
+ * LLFrameArena::reset().  Do not use for containers that persist
+ * across frames.
+ */
+template <typename T>
+class LLFrameArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    LLFrameArenaAllocator() noexcept = default;
+    template <typename U>
+    LLFrameArenaAllocator(const LLFrameArenaAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        return static_cast<T*>(LLFrameArena::allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept
+    {
+        // reclaimed wholesale by LLFrameArena::reset()
+    }
+
+    template <typename U>
+    bool operator==(const LLFrameArenaAllocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const LLFrameArenaAllocator<U>&) const noexcept { return false; }
+};
+
+#endif // LL_LLFRAMEARENA_H
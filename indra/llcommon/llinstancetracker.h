@@ -33,6 +33,7 @@
 #include <vector>
 #include <typeinfo>
 #include <memory>
+#include <shared_mutex>
 #include <type_traits>
 
 #include "mutex.h"
@@ -52,8 +53,12 @@ namespace LLInstanceTrackerPrivate
 {
     struct StaticBase
     {
-        // We need to be able to lock static data while manipulating it.
-        LL_PROFILE_MUTEX_NAMED(std::mutex, mMutex, "InstanceTracker Data");
+        // We need to be able to lock static data while manipulating it. This
+        // is a reader/writer lock: lookups and snapshots take only a shared
+        // lock, so concurrent readers no longer serialize against each other
+        // -- only against instance construction, destruction and setKey().
+        // mutable so read paths can lock through a const StaticData*.
+        mutable LL_PROFILE_MUTEX_SHARED_NAMED(std::shared_mutex, mMutex, "InstanceTracker Data");
     };
 
     void logerrs(const char* cls, const std::string&, const std::string&, const std::string&);
@@ -84,6 +89,8 @@ class LLInstanceTracker
     // Unfortunately there's no umbrella class that owns all LLInstanceTracker
     // instances, so there's no good place to call LockStatic::cleanup().
     typedef llthread::LockStatic<StaticData> LockStatic;
+    // read-only access: shared lock permits concurrent lookups and snapshots
+    typedef llthread::SharedLockStatic<StaticData> SharedLockStatic;
 
 public:
     using ptr_t  = std::shared_ptr<T>;
@@ -104,7 +111,7 @@ public:
 
     static size_t instanceCount()
     {
-        LockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
+        SharedLockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
         return lock->mMap.size();
     }
 
@@ -172,8 +179,8 @@ public:
                             strong_iterator(mData.end(), strengthen));
         }
 
-        // lock static data during construction
-        LockStatic mLock;
+        // lock static data (shared) during construction
+        SharedLockStatic mLock;
         VectorType mData;
     };
     using snapshot = snapshot_of<T>;
@@ -224,7 +231,7 @@ public:
 
     static ptr_t getInstance(const KEY& k)
     {
-        LockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
+        SharedLockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
         const InstanceMap& map(lock->mMap);
         typename InstanceMap::const_iterator found = map.find(k);
         return (found == map.end()) ? NULL : found->second;
@@ -374,6 +381,8 @@ class LLInstanceTracker<T, void, KEY_COLLISION_BEHAVIOR>
     };
     // see LockStatic comment in the above specialization for non-void KEY
     typedef llthread::LockStatic<StaticData> LockStatic;
+    // read-only access: shared lock permits concurrent lookups and snapshots
+    typedef llthread::SharedLockStatic<StaticData> SharedLockStatic;
 
 public:
     using ptr_t  = std::shared_ptr<T>;
@@ -394,7 +403,7 @@ public:
 
     static size_t instanceCount()
     {
-        LockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
+        SharedLockStatic lock; LL_PROFILE_MUTEX_LOCK(lock->mMutex);
         return lock->mSet.size();
     }
 
@@ -450,8 +459,8 @@ public:
                             strong_iterator(mData.end(), strengthen));
         }
 
-        // lock static data during construction
-        LockStatic mLock;
+        // lock static data (shared) during construction
+        SharedLockStatic mLock;
         VectorType mData;
     };
     using snapshot = snapshot_of<T>;
@@ -48,6 +48,8 @@
 #include "llframetimer.h"
 #include "lltrace.h"
 #include "llerror.h"
+
+#include <atomic>
 //----------------------------------------------------------------------------
 
 //static
@@ -74,6 +76,35 @@ U32Kilobytes LLMemory::sAllocatedPageSizeInKB(0);
 static LLTrace::SampleStatHandle<F64Megabytes> sAllocatedMem("allocated_mem", "active memory in use by application");
 static LLTrace::SampleStatHandle<F64Megabytes> sVirtualMem("virtual_mem", "virtual memory assigned to application");
 
+// per-subsystem attribution counters, updated from any thread via
+// claimMem()/disclaimMem() and sampled into LLTrace once per
+// updateMemoryInfo() call
+static std::atomic<S64> sTaggedMemBytes[MEM_TAG_COUNT];
+
+static const char* MEM_TAG_NAMES[MEM_TAG_COUNT] =
+{
+    "texture",
+    "volume",
+    "llsd",
+    "ui",
+    "message"
+};
+
+static LLTrace::SampleStatHandle<F64Megabytes> sTextureTagMem("tagged_mem_texture", "live bytes claimed by decoded image buffers");
+static LLTrace::SampleStatHandle<F64Megabytes> sVolumeTagMem("tagged_mem_volume", "live bytes claimed by volume face data");
+static LLTrace::SampleStatHandle<F64Megabytes> sLLSDTagMem("tagged_mem_llsd", "live bytes claimed by LLSD value trees");
+static LLTrace::SampleStatHandle<F64Megabytes> sUITagMem("tagged_mem_ui", "live bytes claimed by UI buffers");
+static LLTrace::SampleStatHandle<F64Megabytes> sMessageTagMem("tagged_mem_message", "live bytes claimed by message buffers");
+
+static LLTrace::SampleStatHandle<F64Megabytes>* const sTaggedMemStats[MEM_TAG_COUNT] =
+{
+    &sTextureTagMem,
+    &sVolumeTagMem,
+    &sLLSDTagMem,
+    &sUITagMem,
+    &sMessageTagMem
+};
+
 void ll_assert_aligned_func(uintptr_t ptr,U32 alignment)
 {
 #if defined(LL_WINDOWS) && defined(LL_DEBUG_BUFFER_OVERRUN)
@@ -102,6 +133,11 @@ void LLMemory::updateMemoryInfo()
 {
     LL_PROFILE_ZONE_SCOPED;
 
+    for (S32 tag = 0; tag < MEM_TAG_COUNT; ++tag)
+    {
+        sample(*sTaggedMemStats[tag], F64Bytes((F64)sTaggedMemBytes[tag].load(std::memory_order_relaxed)));
+    }
+
     sMaxPhysicalMemInKB = gSysMemory.getPhysicalMemoryKB();
 
     U32Kilobytes avail_mem;
@@ -199,6 +235,39 @@ void LLMemory::logMemoryInfo(bool update)
     LL_INFOS() << llformat("Current allocated page size: %.2f MB", sAllocatedPageSizeInKB / 1024.0) << LL_ENDL;
     LL_INFOS() << llformat("Current available physical memory: %.2f MB", sAvailPhysicalMemInKB / 1024.0) << LL_ENDL;
     LL_INFOS() << llformat("Current max usable memory: %.2f MB", sMaxPhysicalMemInKB / 1024.0) << LL_ENDL;
+
+    for (S32 tag = 0; tag < MEM_TAG_COUNT; ++tag)
+    {
+        LL_INFOS() << llformat("Tagged memory '%s': %.2f MB", MEM_TAG_NAMES[tag],
+                               sTaggedMemBytes[tag].load(std::memory_order_relaxed) / (1024.0 * 1024.0)) << LL_ENDL;
+    }
+}
+
+//static
+void LLMemory::claimMem(EMemTag tag, size_t size)
+{
+    sTaggedMemBytes[tag].fetch_add((S64)size, std::memory_order_relaxed);
+}
+
+//static
+void LLMemory::disclaimMem(EMemTag tag, size_t size)
+{
+    S64 prev = sTaggedMemBytes[tag].fetch_sub((S64)size, std::memory_order_relaxed);
+    // a disclaim bigger than the outstanding claims means a caller freed
+    // bytes it never claimed; make that visible in debug builds
+    llassert(prev >= (S64)size);
+}
+
+//static
+U64 LLMemory::getTaggedMemBytes(EMemTag tag)
+{
+    return (U64)llmax(sTaggedMemBytes[tag].load(std::memory_order_relaxed), S64(0));
+}
+
+//static
+const char* LLMemory::getTagName(EMemTag tag)
+{
+    return MEM_TAG_NAMES[tag];
 }
 
 //static
@@ -381,6 +381,22 @@ inline void ll_memcpy_nonaliased_aligned_16(char* __restrict dst, const char* __
 #define __DEBUG_PRIVATE_MEM__  0
 #endif
 
+// Compile-time subsystem tags for allocation attribution. Subsystems that own
+// large buffers claim them against a tag so heap growth over a long session
+// can be assigned to textures, volumes, LLSD, UI or messaging instead of
+// "the global heap". Claims are atomic counter updates, cheap enough to make
+// at buffer granularity but not per small object.
+enum EMemTag
+{
+    MEM_TAG_TEXTURE,    // decoded image pixel buffers
+    MEM_TAG_VOLUME,     // volume face vertex and index data
+    MEM_TAG_LLSD,       // LLSD value trees
+    MEM_TAG_UI,         // UI widget and font buffers
+    MEM_TAG_MESSAGE,    // network message and packet buffers
+
+    MEM_TAG_COUNT
+};
+
 class LL_COMMON_API LLMemory
 {
 public:
@@ -395,6 +411,14 @@ public:
     static U32Kilobytes getAvailableMemKB() ;
     static U32Kilobytes getMaxMemKB() ;
     static U32Kilobytes getAllocatedMemKB() ;
+
+    // per-subsystem allocation accounting; a disclaim must be paired with an
+    // earlier claim of the same tag and size. Counters are sampled into
+    // LLTrace by updateMemoryInfo() and logged by logMemoryInfo().
+    static void claimMem(EMemTag tag, size_t size);
+    static void disclaimMem(EMemTag tag, size_t size);
+    static U64 getTaggedMemBytes(EMemTag tag);
+    static const char* getTagName(EMemTag tag);
 private:
     static U32Kilobytes sAvailPhysicalMemInKB ;
     static U32Kilobytes sMaxPhysicalMemInKB ;
@@ -0,0 +1,215 @@
+/**
+ * @file llobjectpool.h
+ * @brief Slab pool allocator for small, frequently churned objects.
+ *
+ * $LicenseInfo:firstyear=2025&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2025, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLOBJECTPOOL_H
+#define LL_LLOBJECTPOOL_H
+
+#include "llmemory.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// LLObjectPool<T> hands out fixed-size, 16-byte-aligned blocks carved from
+// cache-line-aligned slabs, with a thread-local free list in front of a
+// shared overflow pool.  Scene rebuild storms that allocate and free
+// thousands of small nodes per frame then recycle the same blocks instead of
+// visiting malloc, which also stops those nodes from fragmenting the heap
+// over long sessions.
+//
+// Blocks allocated on one thread may be freed on another: a thread whose
+// local free list grows past MAX_LOCAL_BLOCKS hands a chunk back to the
+// shared pool, so producer/consumer thread pairs don't grow without bound.
+// Slabs themselves are retained for the life of the process -- each pool
+// keeps its high-water mark.
+//
+// Use through LL_OBJECT_POOL_NEW(), a drop-in replacement for LL_ALIGN_NEW.
+// Allocations whose size doesn't match sizeof(T) -- subclasses with extra
+// members, array news -- fall through to the regular aligned heap.
+template <class T>
+class LLObjectPool
+{
+public:
+    // objects keep the same 16-byte alignment LL_ALIGN_NEW provided
+    static constexpr size_t BLOCK_BYTES = (sizeof(T) + 15) & ~size_t(15);
+    static constexpr U32 SLAB_BLOCKS = 64;
+    // length of the chains exchanged with the shared pool
+    static constexpr U32 CHUNK_BLOCKS = SLAB_BLOCKS;
+    // local free list length at which a thread spills a chunk to the shared pool
+    static constexpr U32 MAX_LOCAL_BLOCKS = 2 * CHUNK_BLOCKS;
+
+    static void* allocate(size_t size)
+    {
+        if (size != sizeof(T))
+        { // subclass or array allocation -- not pooled
+            return ll_aligned_malloc_16(size);
+        }
+        if (!sFreeList)
+        {
+            refill();
+        }
+        FreeBlock* block = sFreeList;
+        sFreeList = block->mNext;
+        --sLocalCount;
+        sLiveCount.fetch_add(1, std::memory_order_relaxed);
+        return block;
+    }
+
+    static void deallocate(void* ptr, size_t size)
+    {
+        if (size != sizeof(T))
+        {
+            ll_aligned_free_16(ptr);
+            return;
+        }
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->mNext = sFreeList;
+        sFreeList = block;
+        sLiveCount.fetch_sub(1, std::memory_order_relaxed);
+        if (++sLocalCount >= MAX_LOCAL_BLOCKS)
+        {
+            spill();
+        }
+    }
+
+    // pool occupancy, for stats reporting
+    static S32 getLiveCount() { return sLiveCount.load(std::memory_order_relaxed); }
+    static S32 getReservedCount() { return sSlabCount.load(std::memory_order_relaxed) * SLAB_BLOCKS; }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* mNext;
+    };
+
+    struct SharedPool
+    {
+        std::mutex mMutex;
+        // heads of free chains, CHUNK_BLOCKS blocks each
+        std::vector<FreeBlock*> mChunks;
+    };
+
+    // function-local static so the shared pool is constructed on first use,
+    // whichever thread gets there first
+    static SharedPool& sharedPool()
+    {
+        static SharedPool pool;
+        return pool;
+    }
+
+    static void refill()
+    {
+        {
+            // try a chunk another thread has handed back
+            SharedPool& shared = sharedPool();
+            std::lock_guard<std::mutex> lock(shared.mMutex);
+            if (!shared.mChunks.empty())
+            {
+                sFreeList = shared.mChunks.back();
+                shared.mChunks.pop_back();
+                sLocalCount = CHUNK_BLOCKS;
+                return;
+            }
+        }
+
+        // carve a fresh cache-line-aligned slab into the local free list
+        U8* slab = (U8*)ll_aligned_malloc<64>(SLAB_BLOCKS * BLOCK_BYTES);
+        FreeBlock* head = nullptr;
+        for (U32 i = SLAB_BLOCKS; i > 0; --i)
+        {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * BLOCK_BYTES);
+            block->mNext = head;
+            head = block;
+        }
+        sFreeList = head;
+        sLocalCount = SLAB_BLOCKS;
+        sSlabCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static void spill()
+    {
+        // detach the first CHUNK_BLOCKS blocks as a chain
+        FreeBlock* head = sFreeList;
+        FreeBlock* tail = head;
+        for (U32 i = 1; i < CHUNK_BLOCKS; ++i)
+        {
+            tail = tail->mNext;
+        }
+        sFreeList = tail->mNext;
+        tail->mNext = nullptr;
+        sLocalCount -= CHUNK_BLOCKS;
+
+        SharedPool& shared = sharedPool();
+        std::lock_guard<std::mutex> lock(shared.mMutex);
+        shared.mChunks.push_back(head);
+    }
+
+    static thread_local FreeBlock* sFreeList;
+    static thread_local U32 sLocalCount;
+    static std::atomic<S32> sLiveCount;
+    static std::atomic<S32> sSlabCount;
+};
+
+template <class T>
+thread_local typename LLObjectPool<T>::FreeBlock* LLObjectPool<T>::sFreeList = nullptr;
+
+template <class T>
+thread_local U32 LLObjectPool<T>::sLocalCount = 0;
+
+template <class T>
+std::atomic<S32> LLObjectPool<T>::sLiveCount{ 0 };
+
+template <class T>
+std::atomic<S32> LLObjectPool<T>::sSlabCount{ 0 };
+
+// Drop-in replacement for LL_ALIGN_NEW that allocates instances of CLASS
+// from LLObjectPool<CLASS>.  The sized operator delete routes subclass
+// instances (whose size differs) back to the regular aligned heap; deletion
+// through a base pointer gets the dynamic type's size as long as the
+// destructor is virtual.
+#define LL_OBJECT_POOL_NEW(CLASS)                       \
+public:                                                 \
+    void* operator new(size_t size)                     \
+    {                                                   \
+        return LLObjectPool<CLASS>::allocate(size);     \
+    }                                                   \
+                                                        \
+    void operator delete(void* ptr, size_t size)        \
+    {                                                   \
+        LLObjectPool<CLASS>::deallocate(ptr, size);     \
+    }                                                   \
+                                                        \
+    void* operator new[](size_t size)                   \
+    {                                                   \
+        return ll_aligned_malloc_16(size);              \
+    }                                                   \
+                                                        \
+    void operator delete[](void* ptr)                   \
+    {                                                   \
+        ll_aligned_free_16(ptr);                        \
+    }
+
+#endif // LL_LLOBJECTPOOL_H
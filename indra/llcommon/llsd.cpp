@@ -98,7 +98,9 @@ protected:
 
     virtual ~Impl();
 
-    bool shared() const                         { return (mUseCount > 1) && (mUseCount != STATIC_USAGE_COUNT); }
+    bool shared() const                         { return (mUseCount > 1) || (mUseCount == STATIC_USAGE_COUNT); }
+        ///< Interned singletons report as shared so every mutation path
+        //   copies on write instead of scribbling on the singleton.
 
     U32 mUseCount;
 
@@ -182,6 +184,17 @@ public:
     static const Impl& getImpl(const LLSD& llsd)    { return safe(llsd.impl); }
     static Impl& getImpl(LLSD& llsd)                { return safe(llsd.impl); }
 
+    void markInterned()
+    {
+        // Interned singletons bypass use counting (reset() and move()
+        // skip STATIC_USAGE_COUNT entirely, so they can be shared
+        // across threads without touching a refcount), are never
+        // destroyed, and should not show up as outstanding allocations.
+        mUseCount = STATIC_USAGE_COUNT;
+        --sAllocationCount;
+        --sOutstandingCount;
+    }
+
     static const LLSD& undef();
 
     static U32 sAllocationCount;
@@ -360,6 +373,48 @@ namespace
     }
 
 
+    /**
+     * Interned singletons for the hottest scalar values.  Booleans,
+     * small non-negative integers and the empty string dominate LLSD
+     * scalar churn (settings, messaging, UI events); handing out a
+     * static instance makes those assignments allocation-free.  The
+     * instances carry STATIC_USAGE_COUNT, so reset()/move() never touch
+     * their use counts and shared() reports them as shared, forcing
+     * every mutation path to copy on write.
+     */
+    const LLSD::Integer INTERNED_INTEGER_COUNT = 256;
+
+    ImplBoolean* internedBoolean(LLSD::Boolean v)
+    {
+        static ImplBoolean* sFalse = []{ ImplBoolean* impl = new ImplBoolean(false); impl->markInterned(); return impl; }();
+        static ImplBoolean* sTrue  = []{ ImplBoolean* impl = new ImplBoolean(true);  impl->markInterned(); return impl; }();
+        return v ? sTrue : sFalse;
+    }
+
+    // caller has already checked 0 <= v < INTERNED_INTEGER_COUNT
+    ImplInteger* internedInteger(LLSD::Integer v)
+    {
+        static std::vector<ImplInteger*> sInterned = []{
+            std::vector<ImplInteger*> table;
+            table.reserve(INTERNED_INTEGER_COUNT);
+            for (LLSD::Integer i = 0; i < INTERNED_INTEGER_COUNT; ++i)
+            {
+                ImplInteger* impl = new ImplInteger(i);
+                impl->markInterned();
+                table.push_back(impl);
+            }
+            return table;
+        }();
+        return sInterned[v];
+    }
+
+    ImplString* internedEmptyString()
+    {
+        static ImplString* sEmpty = []{ ImplString* impl = new ImplString(LLSD::String()); impl->markInterned(); return impl; }();
+        return sEmpty;
+    }
+
+
     class ImplUUID final
         : public ImplBase<LLSD::TypeUUID, LLSD::UUID, const LLSD::UUID&, LLSD::UUID&&>
     {
@@ -826,12 +881,19 @@ void LLSD::Impl::assignUndefined(Impl*& var)
 
 void LLSD::Impl::assign(Impl*& var, LLSD::Boolean v)
 {
-    reset(var, new ImplBoolean(v));
+    reset(var, internedBoolean(v));
 }
 
 void LLSD::Impl::assign(Impl*& var, LLSD::Integer v)
 {
-    reset(var, new ImplInteger(v));
+    if (0 <= v && v < INTERNED_INTEGER_COUNT)
+    {
+        reset(var, internedInteger(v));
+    }
+    else
+    {
+        reset(var, new ImplInteger(v));
+    }
 }
 
 void LLSD::Impl::assign(Impl*& var, LLSD::Real v)
@@ -841,12 +903,26 @@ void LLSD::Impl::assign(Impl*& var, LLSD::Real v)
 
 void LLSD::Impl::assign(Impl*& var, const char* v)
 {
-    reset(var, new ImplString(v));
+    if (v && *v)
+    {
+        reset(var, new ImplString(v));
+    }
+    else
+    {
+        reset(var, internedEmptyString());
+    }
 }
 
 void LLSD::Impl::assign(Impl*& var, const LLSD::String& v)
 {
-    reset(var, new ImplString(v));
+    if (v.empty())
+    {
+        reset(var, internedEmptyString());
+    }
+    else
+    {
+        reset(var, new ImplString(v));
+    }
 }
 
 void LLSD::Impl::assign(Impl*& var, const LLSD::UUID& v)
@@ -871,7 +947,14 @@ void LLSD::Impl::assign(Impl*& var, const LLSD::Binary& v)
 
 void LLSD::Impl::assign(Impl*& var, LLSD::String&& v)
 {
-    reset(var, new ImplString(std::move(v)));
+    if (v.empty())
+    {
+        reset(var, internedEmptyString());
+    }
+    else
+    {
+        reset(var, new ImplString(std::move(v)));
+    }
 }
 
 void LLSD::Impl::assign(Impl*& var, LLSD::UUID&& v)
@@ -1295,6 +1295,272 @@ bool LLSDBinaryParser::parseString(
     return true;
 }
 
+/**
+ * Buffer-based fast path for binary LLSD -- see
+ * LLSDSerialize::fromBinaryBuffer().  Mirrors the element handling in
+ * LLSDBinaryParser::doParse() but reads through a bare cursor instead
+ * of an istream and builds strings and binary values straight from the
+ * source bytes.
+ */
+namespace
+{
+
+// Distinct from LLSDParser::PARSE_FAILURE:  the buffer held a
+// notation-style escaped string, which only the istream parser decodes.
+const S32 PARSE_NOTATION_FALLBACK = -2;
+
+struct LLSDBinaryCursor
+{
+    const U8* mPos;
+    const U8* mEnd;
+
+    size_t remaining() const { return (size_t)(mEnd - mPos); }
+
+    bool getc(char& c)
+    {
+        if (mPos >= mEnd) return false;
+        c = (char)*mPos++;
+        return true;
+    }
+
+    bool peek(char& c) const
+    {
+        if (mPos >= mEnd) return false;
+        c = (char)*mPos;
+        return true;
+    }
+
+    bool read(void* dst, size_t n)
+    {
+        if (remaining() < n) return false;
+        memcpy(dst, mPos, n);
+        mPos += n;
+        return true;
+    }
+
+    // 's'/'k'/'l'-style string:  4 byte network-order size + raw bytes
+    bool readSizedString(std::string& value)
+    {
+        U32 size_nbo = 0;
+        if (!read(&size_nbo, sizeof(U32))) return false;
+        S32 size = (S32)ntohl(size_nbo);
+        if (size < 0 || remaining() < (size_t)size) return false;
+        value.assign((const char*)mPos, size);
+        mPos += size;
+        return true;
+    }
+};
+
+S32 parse_binary_buffer(LLSDBinaryCursor& cur, LLSD& data, S32 max_depth)
+{
+    char c;
+    if (!cur.getc(c))
+    {
+        return 0;
+    }
+    if (max_depth == 0)
+    {
+        return LLSDParser::PARSE_FAILURE;
+    }
+    S32 parse_count = 1;
+    switch(c)
+    {
+    case '{':
+    {
+        U32 count_nbo = 0;
+        if (!cur.read(&count_nbo, sizeof(U32))) return LLSDParser::PARSE_FAILURE;
+        S32 size = (S32)ntohl(count_nbo);
+        data = LLSD::emptyMap();
+        S32 count = 0;
+        char k = '\0';
+        if (!cur.getc(k)) return LLSDParser::PARSE_FAILURE;
+        while(k != '}' && count < size)
+        {
+            if (k != 'k')
+            {
+                // notation-style key; punt the whole parse to the istream parser
+                return PARSE_NOTATION_FALLBACK;
+            }
+            std::string name;
+            if (!cur.readSizedString(name)) return LLSDParser::PARSE_FAILURE;
+            LLSD child;
+            S32 child_count = parse_binary_buffer(cur, child, max_depth - 1);
+            if (child_count == PARSE_NOTATION_FALLBACK) return PARSE_NOTATION_FALLBACK;
+            if (child_count <= 0)
+            {
+                // There must be a value for every key.
+                return LLSDParser::PARSE_FAILURE;
+            }
+            parse_count += child_count;
+            data.insert(name, child);
+            ++count;
+            if (!cur.getc(k)) return LLSDParser::PARSE_FAILURE;
+        }
+        if((k != '}') || (count < size))
+        {
+            // Make sure it is correctly terminated and we parsed as many
+            // as were said to be there.
+            return LLSDParser::PARSE_FAILURE;
+        }
+        break;
+    }
+
+    case '[':
+    {
+        U32 count_nbo = 0;
+        if (!cur.read(&count_nbo, sizeof(U32))) return LLSDParser::PARSE_FAILURE;
+        S32 size = (S32)ntohl(count_nbo);
+        data = LLSD::emptyArray();
+        S32 count = 0;
+        char a = '\0';
+        if (!cur.peek(a)) return LLSDParser::PARSE_FAILURE;
+        while((a != ']') && (count < size))
+        {
+            LLSD child;
+            S32 child_count = parse_binary_buffer(cur, child, max_depth - 1);
+            if (child_count == PARSE_NOTATION_FALLBACK) return PARSE_NOTATION_FALLBACK;
+            if (LLSDParser::PARSE_FAILURE == child_count)
+            {
+                return LLSDParser::PARSE_FAILURE;
+            }
+            if (child_count)
+            {
+                parse_count += child_count;
+                data.append(child);
+            }
+            ++count;
+            if (!cur.peek(a)) return LLSDParser::PARSE_FAILURE;
+        }
+        if (!cur.getc(a) || (a != ']') || (count < size))
+        {
+            return LLSDParser::PARSE_FAILURE;
+        }
+        break;
+    }
+
+    case '!':
+        data.clear();
+        break;
+
+    case '0':
+        data = false;
+        break;
+
+    case '1':
+        data = true;
+        break;
+
+    case 'i':
+    {
+        U32 value_nbo = 0;
+        if (!cur.read(&value_nbo, sizeof(U32))) return LLSDParser::PARSE_FAILURE;
+        data = (S32)ntohl(value_nbo);
+        break;
+    }
+
+    case 'r':
+    {
+        F64 real_nbo = 0.0;
+        if (!cur.read(&real_nbo, sizeof(F64))) return LLSDParser::PARSE_FAILURE;
+        data = ll_ntohd(real_nbo);
+        break;
+    }
+
+    case 'u':
+    {
+        LLUUID id;
+        if (!cur.read(&id.mData, UUID_BYTES)) return LLSDParser::PARSE_FAILURE;
+        data = id;
+        break;
+    }
+
+    case '\'':
+    case '"':
+        return PARSE_NOTATION_FALLBACK;
+
+    case 's':
+    {
+        std::string value;
+        if (!cur.readSizedString(value)) return LLSDParser::PARSE_FAILURE;
+        data = value;
+        break;
+    }
+
+    case 'l':
+    {
+        std::string value;
+        if (!cur.readSizedString(value)) return LLSDParser::PARSE_FAILURE;
+        data = LLURI(value);
+        break;
+    }
+
+    case 'd':
+    {
+        F64 real = 0.0;
+        if (!cur.read(&real, sizeof(F64))) return LLSDParser::PARSE_FAILURE;
+        data = LLDate(real);
+        break;
+    }
+
+    case 'b':
+    {
+        U32 size_nbo = 0;
+        if (!cur.read(&size_nbo, sizeof(U32))) return LLSDParser::PARSE_FAILURE;
+        S32 size = (S32)ntohl(size_nbo);
+        if (size < 0 || cur.remaining() < (size_t)size) return LLSDParser::PARSE_FAILURE;
+        std::vector<U8> value(cur.mPos, cur.mPos + size);
+        cur.mPos += size;
+        data = value;
+        break;
+    }
+
+    default:
+        LL_INFOS() << "Unrecognized character while parsing: int(" << int(c)
+            << ")" << LL_ENDL;
+        return LLSDParser::PARSE_FAILURE;
+    }
+    return parse_count;
+}
+
+} // anonymous namespace
+
+// static
+S32 LLSDSerialize::fromBinaryBuffer(LLSD& sd, const U8* buffer, size_t size, S32 max_depth, llssize* bytes_read)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_LLSD;
+    sd.clear();
+    if (!buffer)
+    {
+        return LLSDParser::PARSE_FAILURE;
+    }
+    LLSDBinaryCursor cursor{ buffer, buffer + size };
+    S32 parse_count = parse_binary_buffer(cursor, sd, max_depth);
+    if (PARSE_NOTATION_FALLBACK == parse_count)
+    {
+        // notation-style escaped strings are legal in binary streams but
+        // never emitted by LLSDBinaryFormatter; let the istream parser
+        // handle them rather than duplicating the escape decoding here
+        sd.clear();
+        boost::iostreams::stream<boost::iostreams::array_source> istrm((const char*)buffer, size);
+        parse_count = fromBinary(sd, istrm, size, max_depth);
+        if (bytes_read)
+        {
+            std::streampos pos = istrm.tellg();
+            *bytes_read = (pos >= 0) ? (llssize)pos : (llssize)size;
+        }
+        return parse_count;
+    }
+    if (LLSDParser::PARSE_FAILURE == parse_count)
+    {
+        sd.clear();
+    }
+    else if (bytes_read)
+    {
+        *bytes_read = (llssize)(cursor.mPos - buffer);
+    }
+    return parse_count;
+}
+
 
 /**
  * LLSDFormatter
@@ -2333,9 +2599,7 @@ LLUZipHelper::EZipRresult LLUZipHelper::unzip_llsd(LLSD& data, const U8* in, S32
     {
         char* result_ptr = strip_deprecated_header((char*)result, cur_size);
 
-        boost::iostreams::stream<boost::iostreams::array_source> istrm(result_ptr, cur_size);
-
-        if (!LLSDSerialize::fromBinary(data, istrm, cur_size, UNZIP_LLSD_MAX_DEPTH))
+        if (!LLSDSerialize::fromBinaryBuffer(data, (const U8*)result_ptr, (size_t)cur_size, UNZIP_LLSD_MAX_DEPTH))
         {
             free(result);
             return ZR_PARSE_ERROR;
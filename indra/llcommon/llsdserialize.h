@@ -29,6 +29,7 @@
 #ifndef LL_LLSDSERIALIZE_H
 #define LL_LLSDSERIALIZE_H
 
+#include <functional>
 #include <iosfwd>
 #include "llpointer.h"
 #include "llrefcount.h"
@@ -308,6 +309,27 @@ public:
      */
     LLSDXMLParser(bool emit_errors=true);
 
+    /**
+     * @brief Callback used in streaming mode, invoked once for each
+     * completed element directly inside the root map or array.
+     *
+     * The key is the element's map key, or empty when the root
+     * container is an array. The element is discarded after the
+     * callback returns.
+     */
+    typedef std::function<void(const std::string& key, const LLSD& element)> element_callback_t;
+
+    /**
+     * @brief Enables streaming mode.
+     *
+     * Instead of accumulating the children of the root container into
+     * the result tree, each completed child is handed to the callback
+     * and then released, so peak memory is one element rather than the
+     * whole document. The LLSD produced by parse() is just the empty
+     * root container.
+     */
+    void setElementCallback(const element_callback_t& callback);
+
 protected:
     /**
      * @brief Call this method to parse a stream for LLSD.
@@ -825,6 +847,16 @@ public:
         return fromXMLEmbedded(sd, str, emit_errors);
 //      return fromXMLDocument(sd, str, emit_errors);
     }
+    // Streaming parser: each completed element directly inside the root
+    // map or array is handed to the callback and then released, so large
+    // documents never materialize as a whole tree.
+    static S32 fromXMLStreaming(std::istream& str, const LLSDXMLParser::element_callback_t& callback, bool emit_errors=true)
+    {
+        LLPointer<LLSDXMLParser> p = new LLSDXMLParser(emit_errors);
+        p->setElementCallback(callback);
+        LLSD root;
+        return p->parse(str, root, LLSDSerialize::SIZE_UNLIMITED);
+    }
 
     /*
      * Binary Methods
@@ -846,6 +878,30 @@ public:
         (void)p->parse(str, sd, max_bytes, max_depth);
         return sd;
     }
+
+    /**
+     * @brief Parse binary-format LLSD directly out of an in-memory buffer.
+     *
+     * Fast path for consumers that already hold the whole serialized
+     * value in memory (unzipped mesh blobs, cache payloads): decodes
+     * without the per-token istream reads of @see fromBinary and
+     * constructs strings and binary values in place from the source
+     * bytes.  Reads one top-level value and stops, like the stream
+     * parsers.  The rare notation-style escaped strings the binary
+     * format also admits are handed to the istream parser, so this is a
+     * drop-in replacement.
+     *
+     * @param sd[out] The newly parsed structured data.
+     * @param buffer The serialized bytes.
+     * @param size Number of valid bytes at buffer.
+     * @param max_depth Maximum parse depth, -1 for unlimited.
+     * @param bytes_read If non-NULL, receives the number of bytes
+     * consumed from buffer on success.
+     * @return Returns the number of LLSD objects parsed into sd, or
+     * LLSDParser::PARSE_FAILURE (-1) on parse failure.
+     */
+    static S32 fromBinaryBuffer(LLSD& sd, const U8* buffer, size_t size,
+                                S32 max_depth = -1, llssize* bytes_read = NULL);
 };
 
 class LL_COMMON_API LLUZipHelper : public LLRefCount
@@ -264,6 +264,8 @@ public:
 
     void reset();
 
+    void setElementCallback(const LLSDXMLParser::element_callback_t& callback);
+
 private:
     void startElementHandler(const XML_Char* name, const XML_Char** attributes);
     void endElementHandler(const XML_Char* name);
@@ -317,6 +319,10 @@ private:
 
     std::string mCurrentKey;        // Current XML <tag>
     std::string mCurrentContent;    // String data between <tag> and </tag>
+
+    LLSDXMLParser::element_callback_t mElementCallback; // streaming mode, see setElementCallback
+    LLSD mStreamValue;              // scratch value for the streaming element being built
+    std::string mStreamKey;         // root map key of the streaming element being built
 };
 
 
@@ -522,6 +528,9 @@ void LLSDXMLParser::Impl::reset()
 
     mCurrentKey.clear();
 
+    mStreamValue.clear();
+    mStreamKey.clear();
+
     XML_ParserReset(mParser, "utf-8");
     XML_SetUserData(mParser, this);
     XML_SetElementHandler(mParser, sStartElementHandler, sEndElementHandler);
@@ -529,6 +538,12 @@ void LLSDXMLParser::Impl::reset()
 }
 
 
+void LLSDXMLParser::Impl::setElementCallback(const LLSDXMLParser::element_callback_t& callback)
+{
+    mElementCallback = callback;
+}
+
+
 void LLSDXMLParser::Impl::startSkipping()
 {
     mSkipping = true;
@@ -640,6 +655,29 @@ void LLSDXMLParser::Impl::startElementHandler(const XML_Char* name, const XML_Ch
     {
         mStack.push_back(&mResult);
     }
+    else if (mElementCallback && mStack.size() == 1)
+    {
+        // Streaming mode: children of the root container are built in a
+        // scratch value and handed to the callback when they complete,
+        // instead of accumulating in the result tree.
+        if (mStack.back()->isMap())
+        {
+            if (mCurrentKey.empty()) { return startSkipping(); }
+            mStreamKey = mCurrentKey;
+            mCurrentKey.clear();
+        }
+        else if (mStack.back()->isArray())
+        {
+            mStreamKey.clear();
+        }
+        else
+        {
+            // improperly nested value in a non-structure
+            return startSkipping();
+        }
+        mStreamValue = LLSD();
+        mStack.push_back(&mStreamValue);
+    }
     else if (mStack.back()->isMap())
     {
         if (mCurrentKey.empty()) { return startSkipping(); }
@@ -808,6 +846,14 @@ void LLSDXMLParser::Impl::endElementHandler(const XML_Char* name)
             break;
     }
 
+    if (mElementCallback && &value == &mStreamValue)
+    {
+        // Streaming mode: hand the completed root-level element to the
+        // consumer and release it.
+        mElementCallback(mStreamKey, mStreamValue);
+        mStreamValue = LLSD();
+    }
+
     mCurrentContent.clear();
 }
 
@@ -927,6 +973,11 @@ void LLSDXMLParser::parsePart(const char *buf, llssize len)
     impl.parsePart(buf, len);
 }
 
+void LLSDXMLParser::setElementCallback(const element_callback_t& callback)
+{
+    impl.setElementCallback(callback);
+}
+
 // virtual
 S32 LLSDXMLParser::doParse(std::istream& input, LLSD& data, S32 max_depth) const
 {
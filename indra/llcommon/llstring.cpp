@@ -32,6 +32,7 @@
 #include "llsd.h"
 #include <vector>
 #include <sstream>
+#include <emmintrin.h>
 
 #if LL_WINDOWS
 #include "llwin32headers.h"
@@ -419,6 +420,32 @@ LLWString utf8str_to_wstring(const char* utf8str, size_t len)
     S32 i = 0;
     while (i < len)
     {
+        // Bulk ASCII fast path: chat text, UI labels and XUI are
+        // overwhelmingly 7-bit, so widen 16 bytes per iteration and only
+        // drop into the byte-by-byte decoder when a chunk has a high bit set.
+        while (i + 16 <= (S32)len)
+        {
+            __m128i chunk = _mm_loadu_si128((const __m128i*)(utf8str + i));
+            if (_mm_movemask_epi8(chunk))
+            {
+                break;
+            }
+            llwchar widened[16];
+            __m128i zero = _mm_setzero_si128();
+            __m128i lo16 = _mm_unpacklo_epi8(chunk, zero);
+            __m128i hi16 = _mm_unpackhi_epi8(chunk, zero);
+            _mm_storeu_si128((__m128i*)(widened + 0),  _mm_unpacklo_epi16(lo16, zero));
+            _mm_storeu_si128((__m128i*)(widened + 4),  _mm_unpackhi_epi16(lo16, zero));
+            _mm_storeu_si128((__m128i*)(widened + 8),  _mm_unpacklo_epi16(hi16, zero));
+            _mm_storeu_si128((__m128i*)(widened + 12), _mm_unpackhi_epi16(hi16, zero));
+            wout.insert(wout.end(), widened, widened + 16);
+            i += 16;
+        }
+        if (i >= (S32)len)
+        {
+            break;
+        }
+
         llwchar unichar;
         U8 cur_char = utf8str[i];
 
@@ -502,13 +529,42 @@ LLWString utf8str_to_wstring(const char* utf8str, size_t len)
 
 std::string wstring_to_utf8str(const llwchar* utf32str, size_t len)
 {
-    std::ostringstream out;
+    std::string out;
+    // Mostly-ASCII text encodes one byte per llwchar; multi-byte appends
+    // below grow the string past this as needed.
+    out.reserve(len);
 
-    for (size_t i = 0; i < len; ++i)
+    size_t i = 0;
+    while (i < len)
     {
-        out << wchar_to_utf8chars(utf32str[i]);
+        // Bulk ASCII fast path: pack 16 llwchars down to 16 output bytes per
+        // iteration as long as every one of them is 7-bit.
+        while (i + 16 <= len)
+        {
+            __m128i c0 = _mm_loadu_si128((const __m128i*)(utf32str + i));
+            __m128i c1 = _mm_loadu_si128((const __m128i*)(utf32str + i + 4));
+            __m128i c2 = _mm_loadu_si128((const __m128i*)(utf32str + i + 8));
+            __m128i c3 = _mm_loadu_si128((const __m128i*)(utf32str + i + 12));
+            __m128i merged = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+            __m128i non_ascii = _mm_and_si128(merged, _mm_set1_epi32(0xFFFFFF80));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(non_ascii, _mm_setzero_si128())) != 0xFFFF)
+            {
+                break;
+            }
+            char packed[16];
+            _mm_storeu_si128((__m128i*)packed,
+                             _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3)));
+            out.append(packed, 16);
+            i += 16;
+        }
+        if (i >= len)
+        {
+            break;
+        }
+        out += wchar_to_utf8chars(utf32str[i]);
+        ++i;
     }
-    return out.str();
+    return out;
 }
 
 std::string utf16str_to_utf8str(const U16* utf16str, size_t len)
@@ -138,8 +138,16 @@ template<typename T, typename VALUE_T>
 void record(EventStatHandle<T>& measurement, VALUE_T value)
 {
 #if LL_TRACE_ENABLED
+    // only accumulate when a recording is active on this thread; without one,
+    // getCurrentAccumulator() would fall back to the default buffer, which is
+    // never read by any recording, so the work would be thrown away
+    EventAccumulator* storage = LLThreadLocalSingletonPointer<EventAccumulator>::getInstance();
+    if (!storage)
+    {
+        return;
+    }
     T converted_value(value);
-    measurement.getCurrentAccumulator().record(storage_value(converted_value));
+    storage[measurement.getIndex()].record(storage_value(converted_value));
 #endif
 }
 
@@ -163,8 +171,14 @@ template<typename T, typename VALUE_T>
 void sample(SampleStatHandle<T>& measurement, VALUE_T value)
 {
 #if LL_TRACE_ENABLED
+    // see record() above: don't pay for samples no recording will ever see
+    SampleAccumulator* storage = LLThreadLocalSingletonPointer<SampleAccumulator>::getInstance();
+    if (!storage)
+    {
+        return;
+    }
     T converted_value(value);
-    measurement.getCurrentAccumulator().sample(storage_value(converted_value));
+    storage[measurement.getIndex()].sample(storage_value(converted_value));
 #endif
 }
 
@@ -188,8 +202,14 @@ template<typename T, typename VALUE_T>
 void add(CountStatHandle<T>& count, VALUE_T value)
 {
 #if LL_TRACE_ENABLED
+    // see record() above: don't pay for samples no recording will ever see
+    CountAccumulator* storage = LLThreadLocalSingletonPointer<CountAccumulator>::getInstance();
+    if (!storage)
+    {
+        return;
+    }
     T converted_value(value);
-    count.getCurrentAccumulator().add(storage_value(converted_value));
+    storage[count.getIndex()].add(storage_value(converted_value));
 #endif
 }
 
@@ -0,0 +1,198 @@
+/**
+ * @file lluuidflatmap.h
+ * @brief Flat open-addressing hash map keyed by LLUUID.
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLUUIDFLATMAP_H
+#define LL_LLUUIDFLATMAP_H
+
+#include <utility>
+#include <vector>
+
+#include "lluuid.h"
+
+/**
+ * Open-addressing hash map tuned for LLUUID keys.  Entries live in a
+ * single contiguous array -- no heap node per entry -- probed linearly
+ * from the bucket selected by the key's 64-bit digest, with
+ * backward-shift deletion so no tombstones accumulate.  Lookups touch
+ * one cache line in the common case, which is what the viewer's hot
+ * id-to-object tables (object list, texture lists) want; std::map's
+ * node walk shows up in profiles there.
+ *
+ * Not a drop-in std container:  the API is the small subset those
+ * tables use (find / operator[] / erase / clear / size) and iterators
+ * are deliberately not provided.  VALUE must be default-constructible
+ * and assignable; erased slots are reset to a default-constructed VALUE
+ * so held resources (e.g. LLPointer refs) release immediately.
+ */
+template <typename VALUE>
+class LLUUIDFlatMap
+{
+public:
+    LLUUIDFlatMap() = default;
+
+    // Return a pointer to the mapped value, or NULL if absent.  The
+    // pointer is invalidated by any insertion or erase.
+    VALUE* find(const LLUUID& key)
+    {
+        size_t slot = findSlot(key);
+        return (slot != NOT_FOUND) ? &mEntries[slot].mValue : NULL;
+    }
+
+    const VALUE* find(const LLUUID& key) const
+    {
+        size_t slot = findSlot(key);
+        return (slot != NOT_FOUND) ? &mEntries[slot].mValue : NULL;
+    }
+
+    // Return the mapped value, inserting a default-constructed one if
+    // the key is absent.
+    VALUE& operator[](const LLUUID& key)
+    {
+        size_t slot = findSlot(key);
+        if (slot == NOT_FOUND)
+        {
+            grow();
+            slot = placeSlot(key.getDigest64());
+            mEntries[slot].mKey = key;
+            ++mCount;
+        }
+        return mEntries[slot].mValue;
+    }
+
+    // Remove the entry for key.  Returns true if an entry was removed.
+    bool erase(const LLUUID& key)
+    {
+        size_t slot = findSlot(key);
+        if (slot == NOT_FOUND)
+        {
+            return false;
+        }
+        const size_t mask = mEntries.size() - 1;
+        // backward-shift the probe cluster following the freed slot:
+        // each displaced entry whose probe distance reaches back to the
+        // hole moves into it, leaving no tombstone behind
+        size_t next = (slot + 1) & mask;
+        while (mFull[next])
+        {
+            size_t home = (size_t)mEntries[next].mHash & mask;
+            if (((next - home) & mask) >= ((next - slot) & mask))
+            {
+                mEntries[slot] = std::move(mEntries[next]);
+                slot = next;
+            }
+            next = (next + 1) & mask;
+        }
+        mFull[slot] = 0;
+        mEntries[slot] = Entry();
+        --mCount;
+        return true;
+    }
+
+    void clear()
+    {
+        std::vector<Entry>().swap(mEntries);
+        std::vector<U8>().swap(mFull);
+        mCount = 0;
+    }
+
+    size_t size() const { return mCount; }
+    bool empty() const { return mCount == 0; }
+
+private:
+    struct Entry
+    {
+        U64 mHash{ 0 };     // cached digest; avoids rehashing on shift/grow
+        LLUUID mKey;
+        VALUE mValue{};
+    };
+
+    static const size_t NOT_FOUND = ~(size_t)0;
+    static const size_t MIN_CAPACITY = 64;      // power of two
+
+    size_t findSlot(const LLUUID& key) const
+    {
+        if (mEntries.empty())
+        {
+            return NOT_FOUND;
+        }
+        const size_t mask = mEntries.size() - 1;
+        const U64 hash = key.getDigest64();
+        size_t slot = (size_t)hash & mask;
+        while (mFull[slot])
+        {
+            if (mEntries[slot].mHash == hash && mEntries[slot].mKey == key)
+            {
+                return slot;
+            }
+            slot = (slot + 1) & mask;
+        }
+        return NOT_FOUND;
+    }
+
+    // first free slot in the probe sequence for hash; caller fills it in
+    size_t placeSlot(U64 hash)
+    {
+        const size_t mask = mEntries.size() - 1;
+        size_t slot = (size_t)hash & mask;
+        while (mFull[slot])
+        {
+            slot = (slot + 1) & mask;
+        }
+        mFull[slot] = 1;
+        mEntries[slot].mHash = hash;
+        return slot;
+    }
+
+    // make room for one more entry, rehashing at 3/4 load
+    void grow()
+    {
+        if (!mEntries.empty() && (mCount + 1) <= (mEntries.size() * 3) / 4)
+        {
+            return;
+        }
+        size_t new_capacity = mEntries.empty() ? MIN_CAPACITY : mEntries.size() * 2;
+        std::vector<Entry> old_entries;
+        std::vector<U8> old_full;
+        old_entries.swap(mEntries);
+        old_full.swap(mFull);
+        mEntries.resize(new_capacity);
+        mFull.assign(new_capacity, 0);
+        for (size_t i = 0; i < old_entries.size(); ++i)
+        {
+            if (old_full[i])
+            {
+                size_t slot = placeSlot(old_entries[i].mHash);
+                mEntries[slot] = std::move(old_entries[i]);
+            }
+        }
+    }
+
+    std::vector<Entry> mEntries;
+    std::vector<U8> mFull;      // separate occupancy bytes keep probing dense
+    size_t mCount{ 0 };
+};
+
+#endif // LL_LLUUIDFLATMAP_H
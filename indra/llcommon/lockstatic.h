@@ -15,11 +15,46 @@
 
 #include "mutex.h"                  // std::unique_lock
 #include "llexception.h"
+#include <shared_mutex>             // std::shared_lock
 #include <typeinfo>
 
 namespace llthread
 {
 
+// Owner of the canonical static instance of Static, shared by every
+// LockStatic<Static> and SharedLockStatic<Static> instantiation.
+template <typename Static>
+class StaticInstance
+{
+public:
+    static Static*& get()
+    {
+        // Our Static instance must be function-local static rather than
+        // class-static. Some of our consumers must function properly
+        // (therefore lock properly) even when the containing module's static
+        // variables have not yet been runtime-initialized. A mutex requires
+        // construction. A static class member might not yet have been
+        // constructed.
+        //
+        // We could store a dumb mutex_t* class member, notice when it's NULL
+        // and allocate a heap mutex -- but that's vulnerable to race
+        // conditions. And we can't defend the dumb pointer with another
+        // mutex.
+        //
+        // We could store a std::atomic<mutex_t*> -- but a default-constructed
+        // std::atomic<T> does not contain a valid T, even a default-constructed
+        // T! Which means std::atomic, too, requires runtime initialization.
+        //
+        // But a function-local static is guaranteed to be initialized exactly
+        // once: the first time control reaches that declaration. Importantly,
+        // since a plain dumb pointer has no destructor, the compiler lets our
+        // heap Static instance survive until someone calls
+        // LockStatic::cleanup().
+        static Static* sData{ new Static };
+        return sData;
+    }
+};
+
 class LockStaticBase
 {
 public:
@@ -96,28 +131,49 @@ private:
 
     Static*& getStatic()
     {
-        // Our Static instance must be function-local static rather than
-        // class-static. Some of our consumers must function properly
-        // (therefore lock properly) even when the containing module's static
-        // variables have not yet been runtime-initialized. A mutex requires
-        // construction. A static class member might not yet have been
-        // constructed.
-        //
-        // We could store a dumb mutex_t* class member, notice when it's NULL
-        // and allocate a heap mutex -- but that's vulnerable to race
-        // conditions. And we can't defend the dumb pointer with another
-        // mutex.
-        //
-        // We could store a std::atomic<mutex_t*> -- but a default-constructed
-        // std::atomic<T> does not contain a valid T, even a default-constructed
-        // T! Which means std::atomic, too, requires runtime initialization.
-        //
-        // But a function-local static is guaranteed to be initialized exactly
-        // once: the first time control reaches that declaration. Importantly,
-        // since a plain dumb pointer has no destructor, the compiler lets our
-        // heap Static instance survive until someone calls cleanup() (above).
-        static Static* sData{ new Static };
-        return sData;
+        // The canonical instance lives in StaticInstance so that
+        // SharedLockStatic<Static> (below) locks the very same instance.
+        return StaticInstance<Static>::get();
+    }
+};
+
+// Like LockStatic, but takes a shared (read) lock on Static::mMutex, which
+// must therefore be a shared mutex type. Multiple concurrent
+// SharedLockStatic instances can read the same Static data; LockStatic still
+// provides exclusive access for writers.
+template <typename Static>
+class SharedLockStatic: public LockStaticBase
+{
+    typedef std::shared_lock<decltype(Static::mMutex)> lock_t;
+public:
+    SharedLockStatic():
+        mData(StaticInstance<Static>::get()),
+        mLock(getLock(mData))
+    {}
+    // only const access: writers must use LockStatic
+    const Static* get() const { return mData; }
+    operator const Static*() const { return get(); }
+    const Static* operator->() const { return get(); }
+    // sometimes we must explicitly unlock...
+    void unlock()
+    {
+        // but once we do, access is no longer permitted
+        mData = nullptr;
+        mLock.unlock();
+    }
+protected:
+    Static* mData;
+    lock_t mLock;
+private:
+    static lock_t getLock(Static* data)
+    {
+        // as for LockStatic::getLock(): a null pointer means somebody already
+        // called LockStatic<Static>::cleanup()
+        if (! data)
+        {
+            throwDead(typeid(SharedLockStatic<Static>).name());
+        }
+        return lock_t(data->mMutex);
     }
 };
 
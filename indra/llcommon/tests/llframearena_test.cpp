@@ -0,0 +1,82 @@
+/**
+ * @file   llframearena_test.cpp
+ * @brief  Test for llframearena.
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Copyright (c) 2024, Linden Research, Inc.
+ * $/LicenseInfo$
+ */
+
+// Precompiled header
+#include "linden_common.h"
+// associated header
+#include "llframearena.h"
+// STL headers
+#include <vector>
+// std headers
+#include <cstdint>
+// external library headers
+// other Linden headers
+#include "../test/lltut.h"
+
+/*****************************************************************************
+*   TUT
+*****************************************************************************/
+namespace tut
+{
+    struct llframearena_data
+    {
+        ~llframearena_data()
+        {
+            // leave the thread arena rewound for the next test
+            LLFrameArena::reset();
+        }
+    };
+    typedef test_group<llframearena_data> llframearena_group;
+    typedef llframearena_group::object object;
+    llframearena_group llframearenagrp("llframearena");
+
+    template<> template<>
+    void object::test<1>()
+    {
+        set_test_name("alignment, accounting and reset");
+        LLFrameArena::reset();
+        ensure_equals("fresh arena empty", LLFrameArena::bytesUsed(), 0);
+
+        void* p = LLFrameArena::allocate(100, 16);
+        ensure("allocation succeeded", p != NULL);
+        ensure("allocation aligned", ((uintptr_t)p & 15) == 0);
+        ensure_equals("bytes accounted", LLFrameArena::bytesUsed(), 100);
+
+        // oversize requests get their own chunk
+        void* big = LLFrameArena::allocate(LLFrameArena::CHUNK_SIZE * 2, 64);
+        ensure("oversize allocation succeeded", big != NULL);
+        ensure("oversize allocation aligned", ((uintptr_t)big & 63) == 0);
+
+        LLFrameArena::reset();
+        ensure_equals("reset rewinds accounting", LLFrameArena::bytesUsed(), 0);
+    }
+
+    template<> template<>
+    void object::test<2>()
+    {
+        set_test_name("STL allocator over several simulated frames");
+        for (int frame = 0; frame < 3; ++frame)
+        {
+            std::vector<int, LLFrameArenaAllocator<int> > scratch;
+            for (int i = 0; i < 10000; ++i)
+            {
+                scratch.push_back(i);
+            }
+            for (int i = 0; i < 10000; ++i)
+            {
+                ensure_equals("scratch contents", scratch[i], i);
+            }
+            // end of frame:  containers die before the arena rewinds
+            scratch.clear();
+            scratch.shrink_to_fit();
+            LLFrameArena::reset();
+            ensure_equals("frame fully reclaimed", LLFrameArena::bytesUsed(), 0);
+        }
+    }
+}
@@ -856,6 +856,43 @@ namespace tut
     }
 
 
+    template<> template<>
+    void TestLLSDXMLParsingObject::test<6>()
+    {
+        // test streaming mode: root-level elements are handed to the
+        // callback in document order and do not accumulate in the
+        // result tree
+        std::stringstream input(
+            "<llsd><map>"
+                "<key>amy</key><integer>23</integer>"
+                "<key>bob</key><map><key>age</key><integer>7</integer></map>"
+                "<key>cam</key><string>froble</string>"
+            "</map></llsd>");
+
+        std::vector<std::string> keys;
+        LLSD values = LLSD::emptyMap();
+        LLPointer<LLSDXMLParser> parser = new LLSDXMLParser();
+        parser->setElementCallback(
+            [&keys, &values](const std::string& key, const LLSD& element)
+            {
+                keys.push_back(key);
+                values[key] = element;
+            });
+
+        LLSD root;
+        S32 count = parser->parse(input, root, LLSDSerialize::SIZE_UNLIMITED);
+
+        ensure_equals("streaming parse count", count, 5);
+        ensure_equals("streaming element count", keys.size(), (size_t)3);
+        ensure_equals("streaming key order 0", keys[0], "amy");
+        ensure_equals("streaming key order 1", keys[1], "bob");
+        ensure_equals("streaming key order 2", keys[2], "cam");
+        ensure_equals("streaming value amy", values["amy"].asInteger(), 23);
+        ensure_equals("streaming value bob", values["bob"]["age"].asInteger(), 7);
+        ensure_equals("streaming value cam", values["cam"].asString(), std::string("froble"));
+        ensure("streaming root left empty", root.isMap() && root.size() == 0);
+    }
+
     /*
     TODO:
         test XML parsing
@@ -1582,12 +1619,66 @@ namespace tut
             1);
     }
 
-/*
     template<> template<>
     void TestLLSDBinaryParsingObject::test<11>()
     {
+        // fromBinaryBuffer() is a drop-in for fromBinary() on in-memory
+        // payloads; make sure the fast path agrees with the stream parser.
+        LLSD value = LLSD::emptyMap();
+        value["amy"] = 23;
+        value["bea"] = LLSD::emptyArray();
+        value["bea"].append("arrow");
+        value["bea"].append(2.89012);
+        value["cat"] = LLUUID("550e8400-e29b-41d4-a716-446655440000");
+        value["dee"] = LLDate(12345.6789);
+        value["eli"] = LLURI("http://sl.com/");
+        std::vector<U8> blob;
+        blob.push_back(0);
+        blob.push_back(23);
+        value["fay"] = blob;
+
+        std::stringstream stream;
+        S32 count = LLSDSerialize::toBinary(value, stream);
+        std::string buffer = stream.str();
+
+        LLSD parsed;
+        llssize bytes_read = 0;
+        S32 parsed_count = LLSDSerialize::fromBinaryBuffer(
+            parsed,
+            (const U8*)buffer.data(),
+            buffer.size(),
+            -1,
+            &bytes_read);
+        ensure_equals("fromBinaryBuffer count", parsed_count, count);
+        ensure_equals("fromBinaryBuffer value", parsed, value);
+        ensure_equals(
+            "fromBinaryBuffer bytes read",
+            bytes_read,
+            (llssize)buffer.size());
+
+        // notation-style strings are legal in binary streams; the fast
+        // path hands them to the istream parser
+        std::string notation("'ali\\'s'");
+        parsed_count = LLSDSerialize::fromBinaryBuffer(
+            parsed,
+            (const U8*)notation.data(),
+            notation.size());
+        ensure_equals("fromBinaryBuffer notation count", parsed_count, 1);
+        ensure_equals(
+            "fromBinaryBuffer notation value",
+            parsed.asString(),
+            std::string("ali's"));
+
+        // truncated payloads fail cleanly
+        parsed_count = LLSDSerialize::fromBinaryBuffer(
+            parsed,
+            (const U8*)buffer.data(),
+            buffer.size() / 2);
+        ensure_equals(
+            "fromBinaryBuffer truncated",
+            parsed_count,
+            LLSDParser::PARSE_FAILURE);
     }
-*/
 
    /**
      * @class TestLLSDCrossCompatible
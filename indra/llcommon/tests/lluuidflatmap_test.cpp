@@ -0,0 +1,104 @@
+/**
+ * @file   lluuidflatmap_test.cpp
+ * @brief  Test for lluuidflatmap.
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Copyright (c) 2024, Linden Research, Inc.
+ * $/LicenseInfo$
+ */
+
+// Precompiled header
+#include "linden_common.h"
+// associated header
+#include "lluuidflatmap.h"
+// STL headers
+#include <map>
+#include <vector>
+// std headers
+// external library headers
+// other Linden headers
+#include "../test/lltut.h"
+
+/*****************************************************************************
+*   TUT
+*****************************************************************************/
+namespace tut
+{
+    struct lluuidflatmap_data
+    {
+    };
+    typedef test_group<lluuidflatmap_data> lluuidflatmap_group;
+    typedef lluuidflatmap_group::object object;
+    lluuidflatmap_group lluuidflatmapgrp("lluuidflatmap");
+
+    template<> template<>
+    void object::test<1>()
+    {
+        set_test_name("basic insert/find/erase");
+        LLUUIDFlatMap<int> map;
+        ensure("new map empty", map.empty());
+
+        LLUUID id;
+        id.generate();
+        ensure("absent key not found", ! map.find(id));
+
+        map[id] = 17;
+        ensure_equals("size after insert", map.size(), 1);
+        int* found = map.find(id);
+        ensure("present key found", found != NULL);
+        ensure_equals("found value", *found, 17);
+
+        map[id] = 18;
+        ensure_equals("size after reassign", map.size(), 1);
+        ensure_equals("reassigned value", *map.find(id), 18);
+
+        ensure("erase present", map.erase(id));
+        ensure("erase absent", ! map.erase(id));
+        ensure("erased key not found", ! map.find(id));
+        ensure("map empty again", map.empty());
+    }
+
+    template<> template<>
+    void object::test<2>()
+    {
+        set_test_name("growth and interleaved erase agree with std::map");
+        LLUUIDFlatMap<int> map;
+        std::map<LLUUID, int> reference;
+        std::vector<LLUUID> ids;
+
+        // enough entries to force several rehashes
+        for (int i = 0; i < 1000; ++i)
+        {
+            LLUUID id;
+            id.generate();
+            ids.push_back(id);
+            map[id] = i;
+            reference[id] = i;
+        }
+        // erase every third entry to exercise backward-shift deletion
+        for (size_t i = 0; i < ids.size(); i += 3)
+        {
+            map.erase(ids[i]);
+            reference.erase(ids[i]);
+        }
+        ensure_equals("size matches reference", map.size(), reference.size());
+        for (const LLUUID& id : ids)
+        {
+            std::map<LLUUID, int>::const_iterator refit = reference.find(id);
+            int* found = map.find(id);
+            if (refit == reference.end())
+            {
+                ensure("erased entry stays gone", ! found);
+            }
+            else
+            {
+                ensure("surviving entry found", found != NULL);
+                ensure_equals("surviving value", *found, refit->second);
+            }
+        }
+
+        map.clear();
+        ensure("cleared map empty", map.empty());
+        ensure("cleared map finds nothing", ! map.find(ids[1]));
+    }
+}
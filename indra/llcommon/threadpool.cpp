@@ -117,14 +117,21 @@ void LL::ThreadPoolBase::close()
     // detach each of our threads before destroying the mThreads vector.
     LL_DEBUGS("ThreadPool") << mName << " closing queue and joining threads" << LL_ENDL;
     mQueue->close();
+    bool joined = false;
     for (auto& pair: mThreads)
     {
         if (pair.second.joinable())
         {
             LL_DEBUGS("ThreadPool") << mName << " waiting on thread " << pair.first << LL_ENDL;
             pair.second.join();
+            joined = true;
         }
     }
+    if (joined)
+    {
+        // workers are done, so the per-job-type timing table is final
+        mQueue->logTypeStats();
+    }
     LL_DEBUGS("ThreadPool") << mName << " shutdown complete" << LL_ENDL;
 }
 
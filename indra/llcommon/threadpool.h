@@ -61,6 +61,14 @@ namespace LL
         std::string getName() const { return mName; }
         size_t getWidth() const { return mThreads.size(); }
 
+        /**
+         * obtain a reference to the queue through the WorkQueueBase
+         * interface, for callers that don't know (or care) which QUEUE
+         * class the pool was instantiated with. ThreadPoolUsing::getQueue()
+         * returns the concrete subclass.
+         */
+        WorkQueueBase& getQueueBase() { return *mQueue; }
+
         /**
          * Override run() if you need special processing. The default run()
          * implementation simply calls WorkQueue::runUntilClose().
@@ -22,6 +22,8 @@
 #include "llerror.h"
 #include "llexception.h"
 #include "stringize.h"
+#include <cstring>                  // std::strlen
+#include <thread>
 
 using Mutex = LLCoros::Mutex;
 using Lock  = LLCoros::LockType;
@@ -120,6 +122,72 @@ void LL::WorkQueueBase::callWork(const Work& work)
     }
 }
 
+bool LL::WorkQueueBase::post(const char* tag, const Work& work)
+{
+    TimePoint posted = TimePoint::clock::now();
+    // Wrap the caller's work in a lambda that times it and books the result
+    // under the tag. Capturing 'this' is safe: the wrapper only runs on a
+    // thread draining this queue, and consumers must not outlive the queue.
+    return post(
+        [this, tag, posted, work]
+        {
+            LL_PROFILE_ZONE_SCOPED_CATEGORY_THREAD;
+            LL_PROFILE_ZONE_TEXT(tag, std::strlen(tag));
+            TimePoint started = TimePoint::clock::now();
+            work();
+            TimePoint finished = TimePoint::clock::now();
+            recordTypeStats(tag,
+                            std::chrono::duration<F64>(started - posted).count(),
+                            std::chrono::duration<F64>(finished - started).count());
+        });
+}
+
+// static
+size_t LL::WorkQueueBase::TypeStats::bucket(F64 seconds)
+{
+    U64 microseconds = U64(seconds * 1e6);
+    size_t b = 0;
+    while (microseconds > 1 && b < NUM_BUCKETS - 1)
+    {
+        microseconds >>= 1;
+        ++b;
+    }
+    return b;
+}
+
+void LL::WorkQueueBase::recordTypeStats(const char* tag, F64 queue_time, F64 run_time)
+{
+    std::lock_guard<std::mutex> lk(mTypeStatsMutex);
+    TypeStats& stats = mTypeStats[tag];
+    ++stats.mCount;
+    stats.mQueueTimeTotal += queue_time;
+    stats.mQueueTimeMax = llmax(stats.mQueueTimeMax, queue_time);
+    stats.mRunTimeTotal += run_time;
+    stats.mRunTimeMax = llmax(stats.mRunTimeMax, run_time);
+    ++stats.mQueueTimeHist[TypeStats::bucket(queue_time)];
+    ++stats.mRunTimeHist[TypeStats::bucket(run_time)];
+}
+
+LL::WorkQueueBase::TypeStatsMap LL::WorkQueueBase::getTypeStats()
+{
+    std::lock_guard<std::mutex> lk(mTypeStatsMutex);
+    return mTypeStats;
+}
+
+void LL::WorkQueueBase::logTypeStats()
+{
+    for (const auto& pair : getTypeStats())
+    {
+        const TypeStats& stats = pair.second;
+        LL_INFOS("WorkQueue") << getKey() << " '" << pair.first << "': "
+                              << stats.mCount << " items, queue latency avg "
+                              << 1000.0 * stats.mQueueTimeTotal / stats.mCount << "ms max "
+                              << 1000.0 * stats.mQueueTimeMax << "ms, execution avg "
+                              << 1000.0 * stats.mRunTimeTotal / stats.mCount << "ms max "
+                              << 1000.0 * stats.mRunTimeMax << "ms" << LL_ENDL;
+    }
+}
+
 void LL::WorkQueueBase::error(const std::string& msg)
 {
     LL_ERRS("WorkQueue") << msg << LL_ENDL;
@@ -184,6 +252,138 @@ bool LL::WorkQueue::tryPop_(Work& work)
     return mQueue.tryPop(work);
 }
 
+/*****************************************************************************
+*   WorkStealQueue
+*****************************************************************************/
+LL::WorkStealQueue::WorkStealQueue(const std::string& name, size_t capacity, size_t shards):
+    super(name)
+{
+    shards = llmax(shards, size_t(1));
+    // divide the capacity between the shards, keeping each one usefully deep
+    size_t shard_capacity = llmax(capacity / shards, size_t(16));
+    mShards.reserve(shards);
+    for (size_t i = 0; i < shards; ++i)
+    {
+        mShards.emplace_back(new Queue(shard_capacity));
+    }
+}
+
+LL::WorkStealQueue::Queue& LL::WorkStealQueue::homeShard()
+{
+    // hash the thread id rather than handing out slots: it needs no
+    // per-queue thread-local state and spreads a pool's workers across the
+    // shards well enough
+    return *mShards[std::hash<std::thread::id>()(std::this_thread::get_id()) % mShards.size()];
+}
+
+void LL::WorkStealQueue::close()
+{
+    for (auto& shard : mShards)
+    {
+        shard->close();
+    }
+}
+
+size_t LL::WorkStealQueue::size()
+{
+    size_t total = 0;
+    for (auto& shard : mShards)
+    {
+        total += shard->size();
+    }
+    return total;
+}
+
+bool LL::WorkStealQueue::isClosed()
+{
+    // close() closes every shard, so any one of them can answer
+    return mShards[0]->isClosed();
+}
+
+bool LL::WorkStealQueue::done()
+{
+    for (auto& shard : mShards)
+    {
+        if (! shard->done())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LL::WorkStealQueue::post(const Work& callable)
+{
+    // round robin so a burst of posts lands on different mutexes
+    return mShards[mNextPostShard++ % mShards.size()]->pushIfOpen(callable);
+}
+
+bool LL::WorkStealQueue::tryPost(const Work& callable)
+{
+    // start at the round robin point but accept any shard with room
+    size_t start = mNextPostShard++;
+    for (size_t i = 0; i < mShards.size(); ++i)
+    {
+        if (mShards[(start + i) % mShards.size()]->tryPush(callable))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+LL::WorkQueueBase::Work LL::WorkStealQueue::pop_()
+{
+    Queue& home = homeShard();
+    for (;;)
+    {
+        Work work;
+        if (home.tryPop(work))
+        {
+            return work;
+        }
+        // home shard is dry: steal from the siblings
+        for (auto& shard : mShards)
+        {
+            if (shard.get() != &home && shard->tryPop(work))
+            {
+                return work;
+            }
+        }
+        // Nothing anywhere. Once the queue is closed and fully drained,
+        // raise Closed just as a plain WorkQueue pop() would.
+        if (isClosed() && done())
+        {
+            LLTHROW(Closed());
+        }
+        // Block briefly on the home shard. The timeout bounds how long work
+        // posted to a sibling shard can wait while every worker whose home
+        // it is happens to be busy; it's a compromise between steal latency
+        // and idle wakeups.
+        if (home.tryPopFor(std::chrono::milliseconds(10), work))
+        {
+            return work;
+        }
+    }
+}
+
+bool LL::WorkStealQueue::tryPop_(Work& work)
+{
+    Queue& home = homeShard();
+    if (home.tryPop(work))
+    {
+        return true;
+    }
+    for (auto& shard : mShards)
+    {
+        if (shard.get() != &home && shard->tryPop(work))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 /*****************************************************************************
 *   WorkSchedule
 *****************************************************************************/
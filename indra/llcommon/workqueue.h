@@ -18,10 +18,15 @@
 #include "llinstancetracker.h"
 #include "llinstancetrackersubclass.h"
 #include "threadsafeschedule.h"
+#include <atomic>
 #include <chrono>
 #include <exception>                // std::current_exception
 #include <functional>               // std::function
+#include <map>
+#include <memory>                   // std::unique_ptr
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace LL
 {
@@ -94,6 +99,47 @@ namespace LL
          */
         virtual bool tryPost(const Work&) = 0;
 
+        /**
+         * post work tagged with a job-type id, unless the queue is closed.
+         *
+         * The tag must have static storage duration -- pass a string
+         * literal. Tagged work is timed: queue latency (post to execution)
+         * and execution time are accumulated per tag for this queue, and the
+         * tag is attached to the profiler zone around the work item so a
+         * tracing capture can break a saturated pool down by job type.
+         * Untagged post() calls remain completely untouched.
+         */
+        bool post(const char* tag, const Work& work);
+
+        /*---------------------- per-job-type timing -----------------------*/
+
+        /**
+         * Timing accumulated by the tagged post() overload for one job type.
+         * Times are in seconds; histogram bucket n counts items that took
+         * [2^n, 2^(n+1)) microseconds, with the last bucket catching
+         * everything slower.
+         */
+        struct TypeStats
+        {
+            static const size_t NUM_BUCKETS = 20; // last bucket: >= ~0.5s
+            U32 mCount = 0;
+            F64 mQueueTimeTotal = 0;
+            F64 mQueueTimeMax = 0;
+            F64 mRunTimeTotal = 0;
+            F64 mRunTimeMax = 0;
+            U32 mQueueTimeHist[NUM_BUCKETS] = {};
+            U32 mRunTimeHist[NUM_BUCKETS] = {};
+
+            static size_t bucket(F64 seconds);
+        };
+        using TypeStatsMap = std::map<std::string, TypeStats>;
+
+        /// snapshot the per-job-type timing accumulated so far
+        TypeStatsMap getTypeStats();
+
+        /// log one summary line per job type, e.g. when a pool shuts down
+        void logTypeStats();
+
         /**
          * Post work to another WorkQueue, which may or may not still exist
          * and be open. Support any post() overload. Return true if we were
@@ -208,11 +254,18 @@ namespace LL
         static std::string makeName(const std::string& name);
         void callWork(const Work& work);
 
+        void recordTypeStats(const char* tag, F64 queue_time, F64 run_time);
+
         LLTempBoundListener mStopListener;
 
     private:
         virtual Work pop_() = 0;
         virtual bool tryPop_(Work&) = 0;
+
+        // guarded by mTypeStatsMutex: recordTypeStats() runs on consumer
+        // threads while getTypeStats() may be called from anywhere
+        std::mutex mTypeStatsMutex;
+        TypeStatsMap mTypeStats;
     };
 
 /*****************************************************************************
@@ -260,6 +313,9 @@ namespace LL
 
         /*---------------------- fire and forget API -----------------------*/
 
+        // keep the base class's tagged post() overload visible
+        using WorkQueueBase::post;
+
         /**
          * post work, unless the queue is closed before we can post
          */
@@ -278,6 +334,84 @@ namespace LL
         bool tryPop_(Work&) override;
     };
 
+/*****************************************************************************
+*   WorkStealQueue: sharded WorkQueue for many small work items
+*****************************************************************************/
+    /**
+     * WorkStealQueue has the same external semantics as WorkQueue (fire and
+     * forget, no timestamped task support) but distributes work across
+     * several internal sub-queues so that a burst of many short work items
+     * doesn't convoy every producer and worker thread on a single mutex.
+     * Each worker thread adopts a "home" sub-queue it pops from first; when
+     * that runs dry it steals from the siblings, so no item is stranded.
+     *
+     * Use ThreadPoolUsing<WorkStealQueue> for pools whose work items are
+     * numerous and cheap, like the image decode pool. For queues carrying a
+     * handful of expensive items plain WorkQueue is a better fit - the
+     * steal scan adds a little overhead per pop, and an idle worker polls
+     * its siblings at a short interval instead of parking indefinitely.
+     */
+    class WorkStealQueue: public LLInstanceTrackerSubclass<WorkStealQueue, WorkQueueBase>
+    {
+    private:
+        using super = LLInstanceTrackerSubclass<WorkStealQueue, WorkQueueBase>;
+
+    public:
+        /**
+         * You may omit the WorkStealQueue name, in which case a unique name
+         * is synthesized; for practical purposes that makes it anonymous.
+         * The capacity is divided evenly between the internal sub-queues.
+         */
+        WorkStealQueue(const std::string& name = std::string(),
+                       size_t capacity = 1024,
+                       size_t shards = 8);
+
+        /**
+         * Close every sub-queue. Workers drain what remains, then their
+         * pop_() calls raise Closed as with a plain WorkQueue.
+         */
+        void close() override;
+
+        /// sum of the sizes of the sub-queues - see the caveats on
+        /// WorkQueue::size()
+        size_t size() override;
+        /// producer end: are we prevented from pushing any additional items?
+        bool isClosed() override;
+        /// consumer end: are we done, is every sub-queue entirely drained?
+        bool done() override;
+
+        /*---------------------- fire and forget API -----------------------*/
+
+        // keep the base class's tagged post() overload visible
+        using WorkQueueBase::post;
+
+        /**
+         * post work to the next sub-queue round robin, unless the queue is
+         * closed before we can post
+         */
+        bool post(const Work&) override;
+
+        /**
+         * post work, unless every sub-queue is full
+         */
+        bool tryPost(const Work&) override;
+
+    private:
+        using Queue = LLThreadSafeQueue<Work>;
+
+        /// the sub-queue this thread pops from before stealing
+        Queue& homeShard();
+
+        // Each shard gets its own mutex and condition variable, which is the
+        // entire point; they can't live directly in the vector since
+        // LLThreadSafeQueue is not movable.
+        std::vector<std::unique_ptr<Queue>> mShards;
+        std::atomic<size_t> mNextPostShard{ 0 };
+
+        Work pop_() override;
+        bool tryPop_(Work&) override;
+    };
+
 /*****************************************************************************
 *   WorkSchedule: add support for timestamped tasks
 *****************************************************************************/
@@ -330,6 +464,9 @@ namespace LL
 
         /*---------------------- fire and forget API -----------------------*/
 
+        // keep the base class's tagged post() overload visible
+        using WorkQueueBase::post;
+
         /**
          * post work, unless the queue is closed before we can post
          */
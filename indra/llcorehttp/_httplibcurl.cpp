@@ -487,7 +487,24 @@ void HttpLibcurl::policyUpdated(unsigned int policy_class)
         policy.stallPolicy(policy_class, false);
         mDirtyPolicy[policy_class] = false;
 
-        if (options.mPipelining > 1)
+        if (options.mHttp2Multiplex)
+        {
+            // Multiplex concurrent requests as HTTP/2 streams over a
+            // small shared pool of connections.  Connection counts are
+            // held to the per-host limit; libcurl adds streams to
+            // existing connections in preference to opening new ones
+            // (see CURLOPT_PIPEWAIT on the easy handles).
+            check_curl_multi_setopt(multi_handle,
+                                     CURLMOPT_PIPELINING,
+                                     CURLPIPE_MULTIPLEX);
+            check_curl_multi_setopt(multi_handle,
+                                     CURLMOPT_MAX_HOST_CONNECTIONS,
+                                     long(options.mPerHostConnectionLimit));
+            check_curl_multi_setopt(multi_handle,
+                                     CURLMOPT_MAX_TOTAL_CONNECTIONS,
+                                     long(options.mConnectionLimit));
+        }
+        else if (options.mPipelining > 1)
         {
             // We'll try to do pipelining on this multihandle
             check_curl_multi_setopt(multi_handle,
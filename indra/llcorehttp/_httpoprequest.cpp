@@ -746,6 +746,16 @@ HttpStatus HttpOpRequest::prepareRequest(HttpService * service)
 /******************************/
         check_curl_easy_setopt(mCurlHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
     }
+    if (cpolicy.mHttp2Multiplex)
+    {
+        // Multiplexed class:  negotiate HTTP/2 where TLS offers it and
+        // prefer adding a stream to an existing connection over opening
+        // a new one.  Streams are independent, so unlike pipelining no
+        // transfer timeout padding is needed for queued-behind requests.
+        check_curl_easy_setopt(mCurlHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        check_curl_easy_setopt(mCurlHandle, CURLOPT_PIPEWAIT, 1L);
+    }
+
     // *DEBUG:  Enable following override for timeout handling and "[curl:bugs] #1420" tests
     //if (cpolicy.mPipelining)
     //{
@@ -785,6 +795,22 @@ size_t HttpOpRequest::writeCallback(void * data, size_t size, size_t nmemb, void
     if (! op->mReplyBody)
     {
         op->mReplyBody = new BufferArray();
+
+        // If the server announced a Content-Length, presize the reply body
+        // so the whole response lands in one contiguous block and consumers
+        // can use BufferArray::contiguousData() rather than flattening a
+        // block chain with a copy.  The cap guards against a hostile header
+        // claiming more than the server will ever deliver.
+        static const double max_reserve(256.0 * 1024.0 * 1024.0);
+        double content_length(0.0);
+        if (CURLE_OK == curl_easy_getinfo(op->mCurlHandle,
+                                          CURLINFO_CONTENT_LENGTH_DOWNLOAD,
+                                          &content_length)
+            && content_length > 0.0
+            && content_length <= max_reserve)
+        {
+            op->mReplyBody->reserve(size_t(content_length));
+        }
     }
     const size_t req_size(size * nmemb);
     const size_t write_size(op->mReplyBody->append(static_cast<char *>(data), req_size));
@@ -41,6 +41,13 @@ namespace
 
 static const char * const LOG_CORE("CoreHttp");
 
+// Bounds for the adaptive concurrency controller.  The configured
+// per-class connection limit acts as the ceiling; the floor keeps a
+// congested class from starving entirely.  Decreases are rate-limited
+// so one burst of failures doesn't collapse the class to the floor.
+static const int ADAPTIVE_LIMIT_MIN(2);
+static const LLCore::HttpTime ADAPTIVE_DECREASE_HOLD(U64L(2000000));    // mcs
+
 } // end anonymous namespace
 
 
@@ -60,7 +67,10 @@ public:
         : mThrottleEnd(0),
           mThrottleLeft(0L),
           mRequestCount(0L),
-          mStallStaging(false)
+          mStallStaging(false),
+          mAdaptiveLimit(0),
+          mAdaptiveSuccesses(0L),
+          mAdaptiveHoldEnd(0)
         {}
 
     HttpReadyQueue      mReadyQueue;
@@ -71,6 +81,13 @@ public:
     long                mThrottleLeft;
     long                mRequestCount;
     bool                mStallStaging;
+
+    // Closed-loop in-flight limit.  Starts at the configured limit,
+    // creeps up by one after a window of clean completions and halves
+    // on timeout/503 pushback.  0 until the first staging pass primes it.
+    int                 mAdaptiveLimit;
+    long                mAdaptiveSuccesses;
+    HttpTime            mAdaptiveHoldEnd;
 };
 
 
@@ -252,6 +269,27 @@ HttpService::ELoopSpeed HttpPolicy::processReadyQueue()
                          ? (state.mOptions.mPerHostConnectionLimit
                             * state.mOptions.mPipelining)
                          : state.mOptions.mConnectionLimit);
+
+        // Apply the adaptive controller's operating point, clamped to
+        // [floor, configured].  Options can be retuned at runtime so
+        // re-clamp on every pass.
+        if (state.mAdaptiveLimit <= 0)
+        {
+            state.mAdaptiveLimit = active_limit;
+        }
+        const int floor_limit(ADAPTIVE_LIMIT_MIN < active_limit
+                              ? ADAPTIVE_LIMIT_MIN
+                              : active_limit);
+        if (state.mAdaptiveLimit > active_limit)
+        {
+            state.mAdaptiveLimit = active_limit;
+        }
+        else if (state.mAdaptiveLimit < floor_limit)
+        {
+            state.mAdaptiveLimit = floor_limit;
+        }
+        active_limit = state.mAdaptiveLimit;
+
         int needed(active_limit - active);      // Expect negatives here
 
         if (needed > 0)
@@ -371,8 +409,68 @@ bool HttpPolicy::cancel(HttpHandle handle)
 }
 
 
+void HttpPolicy::updateAdaptiveLimit(const HttpOpRequest::ptr_t &op)
+{
+    static const HttpStatus error_503(503);
+    static const HttpStatus error_timeout(HttpStatus::EXT_CURL_EASY,
+                                          CURLE_OPERATION_TIMEDOUT);
+
+    ClassState & state(*mClasses[op->mReqPolicy]);
+    if (state.mAdaptiveLimit <= 0)
+    {
+        // not primed yet; nothing has been staged for this class
+        return;
+    }
+
+    if (op->mStatus == error_503 || op->mStatus == error_timeout)
+    {
+        // Service pushback or a drowned request:  halve the in-flight
+        // limit, at most once per hold window.
+        const HttpTime now(totalTime());
+        if (now >= state.mAdaptiveHoldEnd)
+        {
+            int new_limit(state.mAdaptiveLimit / 2);
+            if (new_limit < ADAPTIVE_LIMIT_MIN)
+            {
+                new_limit = ADAPTIVE_LIMIT_MIN;
+            }
+            if (new_limit != state.mAdaptiveLimit)
+            {
+                LL_DEBUGS(LOG_CORE) << "Adaptive concurrency for class "
+                                    << op->mReqPolicy
+                                    << " decreased to " << new_limit
+                                    << " on " << op->mStatus.toTerseString()
+                                    << LL_ENDL;
+                HTTPStats::instance().recordAdaptiveLimit(op->mReqPolicy, new_limit);
+            }
+            state.mAdaptiveLimit = new_limit;
+            state.mAdaptiveSuccesses = 0L;
+            state.mAdaptiveHoldEnd = now + ADAPTIVE_DECREASE_HOLD;
+        }
+    }
+    else if (op->mStatus)
+    {
+        // Clean completion.  After a full window's worth of them,
+        // admit one more request in flight; the configured limit is
+        // applied as the ceiling at staging time.
+        if (++state.mAdaptiveSuccesses >= state.mAdaptiveLimit)
+        {
+            state.mAdaptiveSuccesses = 0L;
+            ++state.mAdaptiveLimit;
+            LL_DEBUGS(LOG_CORE) << "Adaptive concurrency for class "
+                                << op->mReqPolicy
+                                << " increased to " << state.mAdaptiveLimit
+                                << LL_ENDL;
+            HTTPStats::instance().recordAdaptiveLimit(op->mReqPolicy, state.mAdaptiveLimit);
+        }
+    }
+}
+
+
 bool HttpPolicy::stageAfterCompletion(const HttpOpRequest::ptr_t &op)
 {
+    updateAdaptiveLimit(op);
+
     // Retry or finalize
     if (! op->mStatus)
     {
@@ -163,6 +163,14 @@ public:
     bool stallPolicy(HttpRequest::policy_t policy_class, bool stall);
 
 protected:
+    /// Feed one completed operation's outcome to the adaptive
+    /// concurrency controller for its policy class.  Clean completions
+    /// slowly widen the class's in-flight limit toward the configured
+    /// ceiling; timeouts and 503 pushback halve it (AIMD).
+    ///
+    /// Threading:  called by worker thread
+    void updateAdaptiveLimit(const opReqPtr_t &op);
+
     struct ClassState;
     typedef std::vector<ClassState *>   class_list_t;
 
@@ -37,7 +37,8 @@ HttpPolicyClass::HttpPolicyClass()
     : mConnectionLimit(HTTP_CONNECTION_LIMIT_DEFAULT),
       mPerHostConnectionLimit(HTTP_CONNECTION_LIMIT_DEFAULT),
       mPipelining(HTTP_PIPELINING_DEFAULT),
-      mThrottleRate(HTTP_THROTTLE_RATE_DEFAULT)
+      mThrottleRate(HTTP_THROTTLE_RATE_DEFAULT),
+      mHttp2Multiplex(HTTP_MULTIPLEX_DEFAULT)
 {}
 
 
@@ -53,6 +54,7 @@ HttpPolicyClass & HttpPolicyClass::operator=(const HttpPolicyClass & other)
         mPerHostConnectionLimit = other.mPerHostConnectionLimit;
         mPipelining = other.mPipelining;
         mThrottleRate = other.mThrottleRate;
+        mHttp2Multiplex = other.mHttp2Multiplex;
     }
     return *this;
 }
@@ -62,7 +64,8 @@ HttpPolicyClass::HttpPolicyClass(const HttpPolicyClass & other)
     : mConnectionLimit(other.mConnectionLimit),
       mPerHostConnectionLimit(other.mPerHostConnectionLimit),
       mPipelining(other.mPipelining),
-      mThrottleRate(other.mThrottleRate)
+      mThrottleRate(other.mThrottleRate),
+      mHttp2Multiplex(other.mHttp2Multiplex)
 {}
 
 
@@ -86,6 +89,10 @@ HttpStatus HttpPolicyClass::set(HttpRequest::EPolicyOption opt, long value)
         mThrottleRate = llclamp(value, 0L, 1000000L);
         break;
 
+    case HttpRequest::PO_HTTP2_MULTIPLEX:
+        mHttp2Multiplex = llclamp(value, 0L, 1L);
+        break;
+
     default:
         return HttpStatus(HttpStatus::LLCORE, HE_INVALID_ARG);
     }
@@ -114,6 +121,10 @@ HttpStatus HttpPolicyClass::get(HttpRequest::EPolicyOption opt, long * value) co
         *value = mThrottleRate;
         break;
 
+    case HttpRequest::PO_HTTP2_MULTIPLEX:
+        *value = mHttp2Multiplex;
+        break;
+
     default:
         return HttpStatus(HttpStatus::LLCORE, HE_INVALID_ARG);
     }
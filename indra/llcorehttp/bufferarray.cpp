@@ -184,6 +184,39 @@ void * BufferArray::appendBufferAlloc(size_t len)
 }
 
 
+void BufferArray::reserve(size_t len)
+{
+    if (! mBlocks.empty() || len <= BLOCK_ALLOC_SIZE)
+    {
+        // Only useful before content has arrived and for bodies
+        // larger than a single standard block.
+        return;
+    }
+
+    try
+    {
+        Block * block = Block::alloc(len);
+        mBlocks.reserve(5);
+        mBlocks.push_back(block);
+    }
+    catch (std::bad_alloc&)
+    {
+        // The reservation is only an optimization; fall back to
+        // chained standard blocks as the data arrives.
+    }
+}
+
+
+const char * BufferArray::contiguousData() const
+{
+    if (1 == mBlocks.size())
+    {
+        return mBlocks[0]->mData;
+    }
+    return NULL;
+}
+
+
 size_t BufferArray::read(size_t pos, void * dst, size_t len)
 {
     char * c_dst(static_cast<char *>(dst));
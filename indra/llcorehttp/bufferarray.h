@@ -103,6 +103,23 @@ public:
     ///                 of BufferArray of 'len' size.
     void * appendBufferAlloc(size_t len);
 
+    /// Pre-sizes the instance so that 'len' bytes of subsequent
+    /// append() data land in a single contiguous block rather than
+    /// a chain of standard blocks.  Only effective before any data
+    /// has been appended; appends beyond the reservation chain
+    /// additional blocks as usual.  Used by the HTTP write path
+    /// when the response announced a Content-Length.
+    void reserve(size_t len);
+
+    /// Zero-copy accessor.  Returns a pointer to the content when
+    /// it occupies a single contiguous block -- guaranteed when a
+    /// @see reserve() call presized the instance and the body didn't
+    /// overflow the reservation -- or NULL when the content is empty
+    /// or spans blocks, in which case callers fall back to read().
+    /// The pointer is valid until the instance is modified or
+    /// released; the length of the data is @see size().
+    const char * contiguousData() const;
+
     /// Current count of bytes in BufferArray instance.
     size_t size() const
         {
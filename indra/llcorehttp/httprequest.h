@@ -226,6 +226,19 @@ public:
         /// Per-class only
         PO_THROTTLE_RATE,
 
+        /// Long value that if non-zero multiplexes suitable requests
+        /// in this class as concurrent streams over a small shared
+        /// pool of HTTP/2 connections rather than spreading them over
+        /// parallel HTTP/1.1 connections.  Connection counts are held
+        /// to PO_PER_HOST_CONNECTION_LIMIT; libcurl prefers adding a
+        /// stream to an existing connection over opening a new one.
+        /// Servers that do not negotiate HTTP/2 fall back to ordinary
+        /// HTTP/1.1 transfers.  Takes precedence over
+        /// PO_PIPELINING_DEPTH when both are set.
+        ///
+        /// Per-class only
+        PO_HTTP2_MULTIPLEX,
+
         /// Controls the callback function used to control SSL CTX
         /// certificate verification.
         ///
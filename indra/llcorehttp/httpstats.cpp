@@ -101,6 +101,16 @@ void HTTPStats::dumpStats()
         out << (*it).first << " " << (*it).second << std::endl;
     }
 
+    if (!mAdaptiveLimits.empty())
+    {
+        out << std::endl;
+        out << "Adaptive concurrency limits:" << std::endl << "Class Limit" << std::endl;
+        for (std::map<S32, S32>::iterator it = mAdaptiveLimits.begin(); it != mAdaptiveLimits.end(); ++it)
+        {
+            out << (*it).first << " " << (*it).second << std::endl;
+        }
+    }
+
     LL_WARNS("HTTPCore") << out.str() << LL_ENDL;
 }
 
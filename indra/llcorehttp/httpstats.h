@@ -59,6 +59,13 @@ namespace LLCore
 
         void    recordResultCode(S32 code);
 
+        // current operating point of the adaptive concurrency
+        // controller for one policy class
+        void    recordAdaptiveLimit(S32 policy_class, S32 limit)
+        {
+            mAdaptiveLimits[policy_class] = limit;
+        }
+
         void    dumpStats();
     private:
         StatsAccumulator mDataDown;
@@ -67,6 +74,7 @@ namespace LLCore
         S32              mRequests;
 
         std::map<S32, S32> mResutCodes;
+        std::map<S32, S32> mAdaptiveLimits;
     };
 
 
@@ -34,6 +34,7 @@
 #include "llapp.h"
 #include "llassettype.h"
 #include "lldir.h"
+#include "llsdserialize.h"
 #include <boost/filesystem.hpp>
 #include <chrono>
 
@@ -49,16 +50,47 @@
   */
 static const std::string CACHE_FILENAME_PREFIX("sl_cache");
 
+/**
+ * The file the in-memory entry index is persisted to between sessions.
+ * It deliberately carries the cache filename prefix so clearCache()
+ * throws it away along with the entries it describes.
+ */
+static const std::string CACHE_INDEX_FILENAME("sl_cache.index");
+
 std::string LLDiskCache::sCacheDir;
 
+/**
+ * Index entries are keyed on the bare filename so the index remains
+ * valid if the user relocates the cache directory between sessions
+ */
+static std::string index_key(const std::string& file_path)
+{
+    return boost::filesystem::path(file_path).filename().string();
+}
+
 LLDiskCache::LLDiskCache(const std::string& cache_dir,
                          const uintmax_t max_size_bytes,
-                         const bool enable_cache_debug_info) :
+                         const bool enable_cache_debug_info,
+                         const bool enable_cache_index) :
     mMaxSizeBytes(max_size_bytes),
-    mEnableCacheDebugInfo(enable_cache_debug_info)
+    mEnableCacheDebugInfo(enable_cache_debug_info),
+    mEnableCacheIndex(enable_cache_index)
 {
     sCacheDir = cache_dir;
     LLFile::mkdir(cache_dir);
+
+    if (mEnableCacheIndex)
+    {
+        loadIndex();
+    }
+}
+
+LLDiskCache::~LLDiskCache()
+{
+    if (mEnableCacheIndex && mEntryIndexPrimed)
+    {
+        saveIndex();
+    }
 }
 
 // WARNING: purge() is called by LLPurgeDiskCacheThread. As such it must
@@ -102,36 +134,68 @@ void LLDiskCache::purge()
     typedef std::pair<std::time_t, std::pair<uintmax_t, std::string>> file_info_t;
     std::vector<file_info_t> file_info;
 
+    bool use_index = false;
+    {
+        std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+        use_index = mEnableCacheIndex && mEntryIndexPrimed;
+        if (use_index)
+        {
+            // build the LRU view from the in-memory index instead of
+            // stat'ing every file in the cache directory
+            const std::string dir_prefix = sCacheDir + gDirUtilp->getDirDelimiter();
+            for (const auto& entry : mEntryIndex)
+            {
+                file_info.push_back(file_info_t(entry.second.second, { entry.second.first, dir_prefix + entry.first }));
+            }
+        }
+    }
+
+    if (!use_index)
+    {
 #if LL_WINDOWS
-    std::wstring cache_path(utf8str_to_utf16str(sCacheDir));
+        std::wstring cache_path(utf8str_to_utf16str(sCacheDir));
 #else
-    std::string cache_path(sCacheDir);
+        std::string cache_path(sCacheDir);
 #endif
-    if (boost::filesystem::is_directory(cache_path, ec) && !ec.failed())
-    {
-        boost::filesystem::directory_iterator iter(cache_path, ec);
-        while (iter != boost::filesystem::directory_iterator() && !ec.failed())
+        if (boost::filesystem::is_directory(cache_path, ec) && !ec.failed())
         {
-            if (boost::filesystem::is_regular_file(*iter, ec) && !ec.failed())
+            boost::filesystem::directory_iterator iter(cache_path, ec);
+            while (iter != boost::filesystem::directory_iterator() && !ec.failed())
             {
-                if ((*iter).path().string().find(CACHE_FILENAME_PREFIX) != std::string::npos)
+                if (boost::filesystem::is_regular_file(*iter, ec) && !ec.failed())
                 {
-                    uintmax_t file_size = boost::filesystem::file_size(*iter, ec);
-                    if (ec.failed())
-                    {
-                        continue;
-                    }
-                    const std::string file_path = (*iter).path().string();
-                    const std::time_t file_time = boost::filesystem::last_write_time(*iter, ec);
-                    if (ec.failed())
+                    if ((*iter).path().string().find(CACHE_FILENAME_PREFIX) != std::string::npos &&
+                        (*iter).path().filename().string() != CACHE_INDEX_FILENAME)
                     {
-                        continue;
+                        uintmax_t file_size = boost::filesystem::file_size(*iter, ec);
+                        if (ec.failed())
+                        {
+                            continue;
+                        }
+                        const std::string file_path = (*iter).path().string();
+                        const std::time_t file_time = boost::filesystem::last_write_time(*iter, ec);
+                        if (ec.failed())
+                        {
+                            continue;
+                        }
+
+                        file_info.push_back(file_info_t(file_time, { file_size, file_path }));
                     }
-
-                    file_info.push_back(file_info_t(file_time, { file_size, file_path }));
                 }
+                iter.increment(ec);
             }
-            iter.increment(ec);
+        }
+
+        if (mEnableCacheIndex)
+        {
+            // prime the index from the scan we just did
+            std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+            mEntryIndex.clear();
+            for (const file_info_t& entry : file_info)
+            {
+                mEntryIndex[index_key(entry.second.second)] = entry_info_t(entry.second.first, entry.first);
+            }
+            mEntryIndexPrimed = true;
         }
     }
 
@@ -162,11 +226,22 @@ void LLDiskCache::purge()
             boost::filesystem::remove(entry.second.second, ec);
             if (ec.failed())
             {
+                // the file is likely in use by a reader - keep its index
+                // entry so it stays a purge candidate next time around
                 LL_WARNS() << "Failed to delete cache file " << entry.second.second << ": " << ec.message() << LL_ENDL;
             }
+            else
+            {
+                removeEntry(entry.second.second);
+            }
         }
     }
 
+    if (mEnableCacheIndex)
+    {
+        saveIndex();
+    }
+
     if (mEnableCacheDebugInfo)
     {
         auto end_time = std::chrono::high_resolution_clock::now();
@@ -201,6 +276,134 @@ const std::string LLDiskCache::metaDataToFilepath(const LLUUID& id, LLAssetType:
     return llformat("%s%s%s_%s_0.asset", sCacheDir.c_str(), gDirUtilp->getDirDelimiter().c_str(), CACHE_FILENAME_PREFIX.c_str(), id.asString().c_str());
 }
 
+bool LLDiskCache::getEntry(const std::string& file_path, uintmax_t& file_size, std::time_t& last_use)
+{
+    if (!mEnableCacheIndex)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+    if (!mEntryIndexPrimed)
+    {
+        return false;
+    }
+
+    auto iter = mEntryIndex.find(index_key(file_path));
+    if (iter == mEntryIndex.end())
+    {
+        return false;
+    }
+
+    file_size = iter->second.first;
+    last_use = iter->second.second;
+    return true;
+}
+
+void LLDiskCache::updateEntry(const std::string& file_path, uintmax_t file_size, std::time_t last_use)
+{
+    if (!mEnableCacheIndex)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+    mEntryIndex[index_key(file_path)] = entry_info_t(file_size, last_use);
+}
+
+void LLDiskCache::touchEntry(const std::string& file_path, std::time_t last_use)
+{
+    if (!mEnableCacheIndex)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+    auto iter = mEntryIndex.find(index_key(file_path));
+    if (iter != mEntryIndex.end())
+    {
+        iter->second.second = last_use;
+    }
+}
+
+void LLDiskCache::removeEntry(const std::string& file_path)
+{
+    if (!mEnableCacheIndex)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+    mEntryIndex.erase(index_key(file_path));
+}
+
+void LLDiskCache::loadIndex()
+{
+    const std::string index_path = sCacheDir + gDirUtilp->getDirDelimiter() + CACHE_INDEX_FILENAME;
+
+    llifstream file(index_path, std::ios::binary);
+    if (!file.is_open())
+    {
+        // no index from a previous session - the first purge scan will
+        // rebuild it from the directory
+        return;
+    }
+
+    LLSD index;
+    if (LLSDSerialize::fromNotation(index, file, LLSDSerialize::SIZE_UNLIMITED) < 0 || !index.isMap())
+    {
+        LL_WARNS() << "Discarding unreadable cache index " << index_path << LL_ENDL;
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+    mEntryIndex.clear();
+    for (LLSD::map_const_iterator iter = index.beginMap(); iter != index.endMap(); ++iter)
+    {
+        const LLSD& entry = iter->second;
+        mEntryIndex[iter->first] = entry_info_t((uintmax_t)entry["size"].asReal(),
+                                                (std::time_t)entry["time"].asReal());
+    }
+    mEntryIndexPrimed = true;
+
+    if (mEnableCacheDebugInfo)
+    {
+        LL_INFOS() << "Loaded cache index with " << mEntryIndex.size() << " entries" << LL_ENDL;
+    }
+}
+
+void LLDiskCache::saveIndex()
+{
+    LLSD index = LLSD::emptyMap();
+    {
+        std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+        if (!mEntryIndexPrimed)
+        {
+            return;
+        }
+        for (const auto& entry : mEntryIndex)
+        {
+            LLSD info;
+            // sizes and times are stored as reals since LLSD integers
+            // are too narrow for either
+            info["size"] = (LLSD::Real)entry.second.first;
+            info["time"] = (LLSD::Real)entry.second.second;
+            index[entry.first] = info;
+        }
+    }
+
+    const std::string index_path = sCacheDir + gDirUtilp->getDirDelimiter() + CACHE_INDEX_FILENAME;
+    llofstream file(index_path, std::ios::binary);
+    if (file.is_open())
+    {
+        LLSDSerialize::toNotation(index, file);
+    }
+    else
+    {
+        LL_WARNS() << "Failed to write cache index " << index_path << LL_ENDL;
+    }
+}
+
 const std::string LLDiskCache::getCacheInfo()
 {
     std::ostringstream cache_info;
@@ -249,6 +452,14 @@ void LLDiskCache::clearCache()
             iter.increment(ec);
         }
     }
+
+    if (mEnableCacheIndex)
+    {
+        // the directory (and the persisted index file) are gone; an empty
+        // primed index is an accurate description of that
+        std::lock_guard<std::mutex> lock(mEntryIndexMutex);
+        mEntryIndex.clear();
+    }
 }
 
 void LLDiskCache::removeOldVFSFiles()
@@ -64,6 +64,10 @@
 
 #include "llsingleton.h"
 
+#include <ctime>
+#include <map>
+#include <mutex>
+
 class LLDiskCache :
     public LLParamSingleton<LLDiskCache>
 {
@@ -92,9 +96,16 @@ class LLDiskCache :
                      * if there are bugs, we can ask uses to enable this
                      * setting and send us their logs
                      */
-                    const bool enable_cache_debug_info);
+                    const bool enable_cache_debug_info,
+                    /**
+                     * A flag that enables the in-memory index of cache
+                     * entries - see the comments on mEntryIndex for what
+                     * it buys us. Defined by the setting at
+                     * 'DiskCacheEnableIndex'
+                     */
+                    const bool enable_cache_index);
 
-        virtual ~LLDiskCache() = default;
+        virtual ~LLDiskCache();
 
     public:
         /**
@@ -133,7 +144,28 @@ class LLDiskCache :
 
         void removeOldVFSFiles();
 
+        /**
+         * In-memory index accessors, called by LLFileSystem as cache files
+         * are read, written, renamed and removed so the index tracks the
+         * directory without having to stat it. All of them are no-ops when
+         * the index is disabled and getEntry() additionally returns false
+         * until the index has been primed (loaded from the persisted file
+         * or rebuilt by the first purge scan) so callers always fall back
+         * to the real filesystem when we do not know the answer.
+         */
+        bool getEntry(const std::string& file_path, uintmax_t& file_size, std::time_t& last_use);
+        void updateEntry(const std::string& file_path, uintmax_t file_size, std::time_t last_use);
+        void touchEntry(const std::string& file_path, std::time_t last_use);
+        void removeEntry(const std::string& file_path);
+
     private:
+        /**
+         * Read/write the persisted copy of the index that carries it
+         * across sessions so the first purge of a session doesn't have
+         * to stat the whole cache directory
+         */
+        void loadIndex();
+        void saveIndex();
         /**
          * Utility function to gather the total size the files in a given
          * directory. Primarily used here to determine the directory size
@@ -162,6 +194,30 @@ class LLDiskCache :
          * various parts of the code
          */
         bool mEnableCacheDebugInfo;
+
+        /**
+         * When enabled, an in-memory index of cache entries (filename,
+         * size, time of last use) is maintained alongside the directory
+         * and persisted across sessions. purge() then sorts and trims from
+         * the index instead of stat'ing every file in the cache folder -
+         * a significant win on network storage roaming profiles - and
+         * LLFileSystem can answer exists/size queries without touching the
+         * disk. The directory remains the source of truth: a stale index
+         * entry just behaves like the file-removed-while-opening races
+         * described above purge() and the asset is re-requested.
+         */
+        bool mEnableCacheIndex;
+
+        /**
+         * Entries are keyed by bare filename (not full path) so the index
+         * survives the cache directory being relocated. Guarded by
+         * mEntryIndexMutex since purge() runs on LLPurgeDiskCacheThread
+         * while the accessors are called from asset/decode threads.
+         */
+        typedef std::pair<uintmax_t, std::time_t> entry_info_t;
+        std::map<std::string, entry_info_t> mEntryIndex;
+        std::mutex mEntryIndexMutex;
+        bool mEntryIndexPrimed = false;
 };
 
 class LLPurgeDiskCacheThread : public LLThread
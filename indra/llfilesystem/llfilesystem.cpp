@@ -36,6 +36,15 @@
 
 #include "boost/filesystem.hpp"
 
+#if LL_WINDOWS
+#include "llwin32headers.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 constexpr S32 LLFileSystem::READ        = 0x00000001;
 constexpr S32 LLFileSystem::WRITE       = 0x00000002;
 constexpr S32 LLFileSystem::READ_WRITE  = 0x00000003;  // LLFileSystem::READ & LLFileSystem::WRITE
@@ -43,6 +52,26 @@ constexpr S32 LLFileSystem::APPEND      = 0x00000006;  // 0x00000004 & LLFileSys
 
 static LLTrace::BlockTimerStatHandle FTM_VFILE_WAIT("VFile Wait");
 
+bool LLFileSystem::sUseMemoryMappedReads = false;
+
+/**
+ * Only files at least this large get the memory-mapped read treatment.
+ * For small assets the single open/read/close is cheaper than setting up
+ * and tearing down a mapping, and it's the large texture/mesh payloads
+ * the decode threads chew through repeatedly that we want zero-copy
+ */
+constexpr S32 MMAP_READ_THRESHOLD_BYTES = 128 * 1024;
+
+/**
+ * The disk cache singleton holds the in-memory entry index but is only
+ * initialized by the viewer - tools linking this code without a cache
+ * simply skip the index and hit the filesystem directly
+ */
+static LLDiskCache* disk_cache()
+{
+    return LLDiskCache::instanceExists() ? LLDiskCache::getInstance() : nullptr;
+}
+
 LLFileSystem::LLFileSystem(const LLUUID& file_id, const LLAssetType::EType file_type, S32 mode)
 {
     mFileType = file_type;
@@ -59,24 +88,134 @@ LLFileSystem::LLFileSystem(const LLUUID& file_id, const LLAssetType::EType file_
         // build the filename (TODO: we do this in a few places - perhaps we should factor into a single function)
         const std::string filename = LLDiskCache::metaDataToFilepath(mFileID, mFileType);
 
+        // the in-memory index (when enabled and primed) saves us a stat here;
+        // on an index miss we ask the filesystem as before
+        LLDiskCache* cache = disk_cache();
+        uintmax_t indexed_size = 0;
+        std::time_t indexed_time = 0;
+        bool exists = cache && cache->getEntry(filename, indexed_size, indexed_time);
+        if (!exists)
+        {
+            exists = gDirUtilp->fileExists(filename);
+        }
+
         // update the last access time for the file if it exists - this is required
         // even though we are reading and not writing because this is the
         // way the cache works - it relies on a valid "last accessed time" for
         // each file so it knows how to remove the oldest, unused files
-        bool exists = gDirUtilp->fileExists(filename);
         if (exists)
         {
             updateFileAccessTime(filename);
+            if (cache)
+            {
+                cache->touchEntry(filename, std::time(nullptr));
+            }
+
+            if (sUseMemoryMappedReads)
+            {
+                openReadMapping(filename);
+            }
         }
     }
 }
 
+LLFileSystem::~LLFileSystem()
+{
+    closeReadMapping();
+}
+
+bool LLFileSystem::openReadMapping(const std::string& filename)
+{
+#if LL_WINDOWS
+    HANDLE file = CreateFileW(ll_convert_string_to_wide(filename).c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) ||
+        file_size.QuadPart < MMAP_READ_THRESHOLD_BYTES ||
+        file_size.QuadPart > S32_MAX)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping)
+    {
+        mMapData = (const U8*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        // the view keeps both handles alive until it is unmapped
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+
+    if (!mMapData)
+    {
+        return false;
+    }
+    mMapSize = (S32)file_size.QuadPart;
+    return true;
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        file_stat.st_size < MMAP_READ_THRESHOLD_BYTES ||
+        file_stat.st_size > S32_MAX)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // the mapping keeps the file alive until it is unmapped
+    ::close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return false;
+    }
+    mMapData = (const U8*)data;
+    mMapSize = (S32)file_stat.st_size;
+    return true;
+#endif
+}
+
+void LLFileSystem::closeReadMapping()
+{
+    if (mMapData)
+    {
+#if LL_WINDOWS
+        UnmapViewOfFile(mMapData);
+#else
+        munmap((void*)mMapData, (size_t)mMapSize);
+#endif
+        mMapData = nullptr;
+        mMapSize = 0;
+    }
+}
+
 // static
 bool LLFileSystem::getExists(const LLUUID& file_id, const LLAssetType::EType file_type)
 {
     LL_PROFILE_ZONE_SCOPED;
     const std::string filename = LLDiskCache::metaDataToFilepath(file_id, file_type);
 
+    LLDiskCache* cache = disk_cache();
+    uintmax_t indexed_size = 0;
+    std::time_t indexed_time = 0;
+    if (cache && cache->getEntry(filename, indexed_size, indexed_time))
+    {
+        return indexed_size > 0;
+    }
+
     llifstream file(filename, std::ios::binary);
     if (file.is_open())
     {
@@ -92,6 +231,10 @@ bool LLFileSystem::removeFile(const LLUUID& file_id, const LLAssetType::EType fi
     const std::string filename = LLDiskCache::metaDataToFilepath(file_id, file_type);
 
     LLFile::remove(filename.c_str(), suppress_error);
+    if (LLDiskCache* cache = disk_cache())
+    {
+        cache->removeEntry(filename);
+    }
 
     return true;
 }
@@ -106,6 +249,19 @@ bool LLFileSystem::renameFile(const LLUUID& old_file_id, const LLAssetType::ETyp
     // Rename needs the new file to not exist.
     LLFileSystem::removeFile(new_file_id, new_file_type, ENOENT);
 
+    // carry the index entry over to the new name
+    if (LLDiskCache* cache = disk_cache())
+    {
+        uintmax_t indexed_size = 0;
+        std::time_t indexed_time = 0;
+        bool had_entry = cache->getEntry(old_filename, indexed_size, indexed_time);
+        cache->removeEntry(old_filename);
+        if (had_entry)
+        {
+            cache->updateEntry(new_filename, indexed_size, indexed_time);
+        }
+    }
+
     if (LLFile::rename(old_filename, new_filename) != 0)
     {
         // We would like to return false here indicating the operation
@@ -123,6 +279,14 @@ S32 LLFileSystem::getFileSize(const LLUUID& file_id, const LLAssetType::EType fi
 {
     const std::string filename = LLDiskCache::metaDataToFilepath(file_id, file_type);
 
+    LLDiskCache* cache = disk_cache();
+    uintmax_t indexed_size = 0;
+    std::time_t indexed_time = 0;
+    if (cache && cache->getEntry(filename, indexed_size, indexed_time))
+    {
+        return (S32)indexed_size;
+    }
+
     S32 file_size = 0;
     llifstream file(filename, std::ios::binary);
     if (file.is_open())
@@ -136,6 +300,18 @@ S32 LLFileSystem::getFileSize(const LLUUID& file_id, const LLAssetType::EType fi
 
 bool LLFileSystem::read(U8* buffer, S32 bytes)
 {
+    if (mMapData)
+    {
+        // copy straight out of the mapped view - no per-read open/seek/close
+        mBytesRead = llclamp(bytes, 0, mMapSize - mPosition);
+        if (mBytesRead > 0)
+        {
+            memcpy(buffer, mMapData + mPosition, mBytesRead);
+        }
+        mPosition += mBytesRead;
+        return mBytesRead > 0;
+    }
+
     bool success = false;
 
     const std::string filename = LLDiskCache::metaDataToFilepath(mFileID, mFileType);
@@ -232,6 +408,24 @@ bool LLFileSystem::write(const U8* buffer, S32 bytes)
         }
     }
 
+    if (success)
+    {
+        if (LLDiskCache* cache = disk_cache())
+        {
+            // keep the index in step with what we just wrote; for READ_WRITE
+            // the file may extend past our position so keep the larger size
+            uintmax_t new_size = (uintmax_t)mPosition;
+            uintmax_t indexed_size = 0;
+            std::time_t indexed_time = 0;
+            if (mMode == READ_WRITE &&
+                cache->getEntry(filename, indexed_size, indexed_time))
+            {
+                new_size = llmax(new_size, indexed_size);
+            }
+            cache->updateEntry(filename, new_size, std::time(nullptr));
+        }
+    }
+
     return success;
 }
 
@@ -272,6 +466,10 @@ S32 LLFileSystem::tell() const
 
 S32 LLFileSystem::getSize() const
 {
+    if (mMapData)
+    {
+        return mMapSize;
+    }
     return LLFileSystem::getFileSize(mFileID, mFileType);
 }
 
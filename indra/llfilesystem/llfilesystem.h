@@ -38,12 +38,22 @@ class LLFileSystem
 {
     public:
         LLFileSystem(const LLUUID& file_id, const LLAssetType::EType file_type, S32 mode = LLFileSystem::READ);
-        ~LLFileSystem() = default;
+        ~LLFileSystem();
 
         bool read(U8* buffer, S32 bytes);
         S32  getLastBytesRead() const;
         bool eof() const;
 
+        /**
+         * Read-only view of the whole file when it was memory mapped by the
+         * constructor (READ mode, mapped reads enabled and the file is above
+         * the size threshold), otherwise NULL. The pointer is only valid for
+         * the lifetime of this object - callers that can parse in place get
+         * their data zero-copy, everyone else goes through read() which
+         * copies out of the mapping instead of the filesystem
+         */
+        const U8* getMappedData() const { return mMapData; }
+
         bool write(const U8* buffer, S32 bytes);
         bool seek(S32 offset, S32 origin = -1);
         S32  tell() const;
@@ -72,12 +82,31 @@ class LLFileSystem
         static const S32 READ_WRITE;
         static const S32 APPEND;
 
+        /**
+         * When enabled, files above a size threshold are memory mapped for
+         * the lifetime of a READ mode LLFileSystem instead of being opened,
+         * seeked, read and closed again for every read() call. Set by the
+         * viewer from the 'DiskCacheMemoryMappedReads' setting before the
+         * cache is first used
+         */
+        static bool sUseMemoryMappedReads;
+
     protected:
         LLAssetType::EType mFileType;
         LLUUID  mFileID;
         S32     mPosition;
         S32     mMode;
         S32     mBytesRead;
+
+    private:
+        LLFileSystem(const LLFileSystem&) = delete;
+        LLFileSystem& operator=(const LLFileSystem&) = delete;
+
+        bool openReadMapping(const std::string& filename);
+        void closeReadMapping();
+
+        const U8* mMapData = nullptr;
+        S32       mMapSize = 0;
 };
 
 #endif  // LL_FILESYSTEM_H
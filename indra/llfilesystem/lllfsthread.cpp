@@ -29,10 +29,306 @@
 #include "llstl.h"
 #include "llapr.h"
 
+#if LL_LINUX
+#include <atomic>
+#include <cstring>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+// present in glibc's headers from 2.30 on; define for older sysroots
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+// absent from pre-5.4 kernel headers; harmless to probe for on older kernels
+#ifndef IORING_FEAT_SINGLE_MMAP
+#define IORING_FEAT_SINGLE_MMAP (1U << 0)
+#endif
+#endif // LL_LINUX
+
 //============================================================================
 
 /*static*/ LLLFSThread* LLLFSThread::sLocal = NULL;
 
+#if LL_LINUX
+
+// Completion record shared between a pending Request and the ring. The ring
+// holds a reference until the CQE arrives and the Request holds its own, so
+// a request aborted mid-flight cannot leave either side dangling. The record
+// also owns the staging buffer the kernel writes into: an aborted request's
+// caller may free its destination buffer while the read is still in flight,
+// so the data is only copied out when the request reaps its completion.
+struct LLLFSRingCompletion
+{
+    std::vector<U8> mData;
+    struct iovec mIOV;      // points into mData; must stay valid until the CQE
+    S32 mResult = 0;
+    bool mDone = false;
+};
+
+class LLLFSThread::IOURing
+{
+public:
+    // returns NULL when the kernel lacks io_uring (or it is disabled, as in
+    // some containers); callers then use the blocking path
+    static IOURing* create();
+    ~IOURing();
+
+    // queue a read of numbytes at offset; the returned record completes on a
+    // later poll(). Returns null when the submission queue is full.
+    std::shared_ptr<LLLFSRingCompletion> submitRead(int fd, S32 offset, S32 numbytes);
+
+    // push accumulated submissions to the kernel and reap any completions
+    void poll();
+
+private:
+    IOURing() = default;
+    bool init();
+    void flush();
+
+    static const unsigned QUEUE_DEPTH = 128;
+    // submit in batches; poll() flushes whatever is left over
+    static const unsigned SUBMIT_BATCH = 32;
+
+    int mRingFD = -1;
+    U8* mSQRing = nullptr;
+    size_t mSQRingSize = 0;
+    U8* mCQRing = nullptr;      // == mSQRing on kernels with IORING_FEAT_SINGLE_MMAP
+    size_t mCQRingSize = 0;
+    io_uring_sqe* mSQEs = nullptr;
+    size_t mSQEsSize = 0;
+
+    // ring pointers into the mapped regions
+    unsigned* mSQHead = nullptr;
+    unsigned* mSQTail = nullptr;
+    unsigned* mSQMask = nullptr;
+    unsigned* mSQArray = nullptr;
+    unsigned* mCQHead = nullptr;
+    unsigned* mCQTail = nullptr;
+    unsigned* mCQMask = nullptr;
+    io_uring_cqe* mCQEs = nullptr;
+
+    unsigned mSQEntries = 0;    // actual ring size; the kernel may round up
+    unsigned mPendingSubmits = 0;
+    U64 mNextToken = 1;
+
+    struct InFlight
+    {
+        std::shared_ptr<LLLFSRingCompletion> mCompletion;
+        int mFD;
+    };
+    std::map<U64, InFlight> mInFlight;
+};
+
+static int ll_io_uring_setup(unsigned entries, struct io_uring_params* params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ll_io_uring_enter(int ring_fd, unsigned to_submit, unsigned min_complete, unsigned flags)
+{
+    return (int)syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0);
+}
+
+//static
+LLLFSThread::IOURing* LLLFSThread::IOURing::create()
+{
+    IOURing* ring = new IOURing();
+    if (!ring->init())
+    {
+        delete ring;
+        return nullptr;
+    }
+    return ring;
+}
+
+bool LLLFSThread::IOURing::init()
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    mRingFD = ll_io_uring_setup(QUEUE_DEPTH, &params);
+    if (mRingFD < 0)
+    {
+        LL_INFOS() << "LLLFS: io_uring unavailable (errno " << errno
+                   << "), using blocking file reads" << LL_ENDL;
+        return false;
+    }
+
+    mSQRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    mCQRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mSQRingSize = mCQRingSize = llmax(mSQRingSize, mCQRingSize);
+    }
+
+    mSQRing = (U8*)mmap(nullptr, mSQRingSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, mRingFD, IORING_OFF_SQ_RING);
+    if (mSQRing == MAP_FAILED)
+    {
+        mSQRing = nullptr;
+        return false;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mCQRing = mSQRing;
+    }
+    else
+    {
+        mCQRing = (U8*)mmap(nullptr, mCQRingSize, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, mRingFD, IORING_OFF_CQ_RING);
+        if (mCQRing == MAP_FAILED)
+        {
+            mCQRing = nullptr;
+            return false;
+        }
+    }
+
+    mSQEsSize = params.sq_entries * sizeof(io_uring_sqe);
+    mSQEs = (io_uring_sqe*)mmap(nullptr, mSQEsSize, PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_POPULATE, mRingFD, IORING_OFF_SQES);
+    if (mSQEs == MAP_FAILED)
+    {
+        mSQEs = nullptr;
+        return false;
+    }
+
+    mSQHead = (unsigned*)(mSQRing + params.sq_off.head);
+    mSQTail = (unsigned*)(mSQRing + params.sq_off.tail);
+    mSQMask = (unsigned*)(mSQRing + params.sq_off.ring_mask);
+    mSQArray = (unsigned*)(mSQRing + params.sq_off.array);
+    mCQHead = (unsigned*)(mCQRing + params.cq_off.head);
+    mCQTail = (unsigned*)(mCQRing + params.cq_off.tail);
+    mCQMask = (unsigned*)(mCQRing + params.cq_off.ring_mask);
+    mCQEs = (io_uring_cqe*)(mCQRing + params.cq_off.cqes);
+    mSQEntries = params.sq_entries;
+
+    LL_INFOS() << "LLLFS: io_uring read backend enabled, queue depth "
+               << params.sq_entries << LL_ENDL;
+    return true;
+}
+
+LLLFSThread::IOURing::~IOURing()
+{
+    // requests aborted at shutdown can leave reads unreaped; wait for the
+    // kernel to finish with the staging buffers before they are freed
+    flush();
+    while (!mInFlight.empty())
+    {
+        if (ll_io_uring_enter(mRingFD, 0, 1, IORING_ENTER_GETEVENTS) < 0)
+        {
+            break;
+        }
+        poll();
+    }
+    for (auto& inflight : mInFlight)
+    {
+        close(inflight.second.mFD);
+    }
+    if (mSQEs)
+    {
+        munmap(mSQEs, mSQEsSize);
+    }
+    if (mCQRing && mCQRing != mSQRing)
+    {
+        munmap(mCQRing, mCQRingSize);
+    }
+    if (mSQRing)
+    {
+        munmap(mSQRing, mSQRingSize);
+    }
+    if (mRingFD >= 0)
+    {
+        close(mRingFD);
+    }
+}
+
+std::shared_ptr<LLLFSRingCompletion> LLLFSThread::IOURing::submitRead(int fd, S32 offset, S32 numbytes)
+{
+    unsigned tail = *mSQTail;   // we are the only writer
+    if (tail - __atomic_load_n(mSQHead, __ATOMIC_ACQUIRE) == mSQEntries)
+    {
+        // submission queue full; push what we have and tell the caller to
+        // take the blocking path
+        flush();
+        return nullptr;
+    }
+
+    std::shared_ptr<LLLFSRingCompletion> completion = std::make_shared<LLLFSRingCompletion>();
+    completion->mData.resize(numbytes);
+    completion->mIOV.iov_base = completion->mData.data();
+    completion->mIOV.iov_len = numbytes;
+
+    U64 token = mNextToken++;
+
+    unsigned index = tail & *mSQMask;
+    io_uring_sqe* sqe = &mSQEs[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->off = offset;
+    sqe->addr = (U64)(uintptr_t)&completion->mIOV;
+    sqe->len = 1;
+    sqe->user_data = token;
+    mSQArray[index] = index;
+    __atomic_store_n(mSQTail, tail + 1, __ATOMIC_RELEASE);
+
+    mInFlight[token] = { completion, fd };
+
+    if (++mPendingSubmits >= SUBMIT_BATCH)
+    {
+        flush();
+    }
+    return completion;
+}
+
+void LLLFSThread::IOURing::flush()
+{
+    if (mPendingSubmits)
+    {
+        // no IORING_ENTER_GETEVENTS: submit and return, completions are
+        // reaped from the CQ ring without another syscall
+        int submitted = ll_io_uring_enter(mRingFD, mPendingSubmits, 0, 0);
+        if (submitted < 0)
+        {
+            LL_WARNS() << "LLLFS: io_uring_enter failed, errno " << errno << LL_ENDL;
+        }
+        mPendingSubmits = 0;
+    }
+}
+
+void LLLFSThread::IOURing::poll()
+{
+    flush();
+
+    unsigned head = *mCQHead;   // we are the only reader
+    while (head != __atomic_load_n(mCQTail, __ATOMIC_ACQUIRE))
+    {
+        io_uring_cqe* cqe = &mCQEs[head & *mCQMask];
+        U64 token = cqe->user_data;
+        S32 result = cqe->res;
+        ++head;
+        __atomic_store_n(mCQHead, head, __ATOMIC_RELEASE);
+
+        auto it = mInFlight.find(token);
+        if (it != mInFlight.end())
+        {
+            close(it->second.mFD);
+            it->second.mCompletion->mResult = result;
+            it->second.mCompletion->mDone = true;
+            mInFlight.erase(it);
+        }
+    }
+}
+
+#endif // LL_LINUX
+
 //============================================================================
 // Run on MAIN thread
 //static
@@ -66,6 +362,9 @@ void LLLFSThread::cleanupClass()
 
 LLLFSThread::LLLFSThread(bool threaded) :
     LLQueuedThread("LFS", threaded)
+#if LL_LINUX
+    , mRing(NULL)
+#endif
 {
     if(!mLocalAPRFilePoolp)
     {
@@ -75,10 +374,23 @@ LLLFSThread::LLLFSThread(bool threaded) :
 
 LLLFSThread::~LLLFSThread()
 {
+#if LL_LINUX
+    delete mRing;
+    mRing = NULL;
+#endif
     // mLocalAPRFilePoolp cleanup in LLThread
     // ~LLQueuedThread() will be called here
 }
 
+#if LL_LINUX
+// virtual, called from own thread
+void LLLFSThread::startThread()
+{
+    // create the ring on the thread that will do all submissions and reaps
+    mRing = IOURing::create();
+}
+#endif
+
 //----------------------------------------------------------------------------
 
 LLLFSThread::handle_t LLLFSThread::read(const std::string& filename,    /* Flawfinder: ignore */
@@ -183,6 +495,51 @@ bool LLLFSThread::Request::processRequest()
     if (mOperation ==  FILE_READ)
     {
         llassert(mOffset >= 0);
+#if LL_LINUX
+        if (mThread->mRing)
+        {
+            if (mRingCompletion)
+            {
+                // submitted on an earlier pass; reap whatever the kernel has
+                // finished and see whether our read is among it
+                mThread->mRing->poll();
+                if (!mRingCompletion->mDone)
+                {
+                    return false; // still in flight, retry later
+                }
+                if (mRingCompletion->mResult < 0)
+                {
+                    LL_WARNS() << "LLLFS: io_uring read failed: " << mFileName
+                               << " errno " << -mRingCompletion->mResult << LL_ENDL;
+                    mBytesRead = 0; // fail
+                }
+                else
+                {
+                    mBytesRead = mRingCompletion->mResult;
+                    memcpy(mBuffer, mRingCompletion->mData.data(), mBytesRead);
+                }
+                mRingCompletion.reset();
+                return true;
+            }
+            if (mOffset >= 0 && mBytes > 0)
+            {
+                int fd = ::open(mFileName.c_str(), O_RDONLY);
+                if (fd < 0)
+                {
+                    LL_WARNS() << "LLLFS: Unable to read file: " << mFileName << LL_ENDL;
+                    mBytesRead = 0; // fail
+                    return true;
+                }
+                mRingCompletion = mThread->mRing->submitRead(fd, mOffset, mBytes);
+                if (mRingCompletion)
+                {
+                    return false; // pending; the completion is reaped above
+                }
+                // submission queue full; fall through to the blocking read
+                ::close(fd);
+            }
+        }
+#endif
         LLAPRFile infile ; // auto-closes
         infile.open(mFileName, LL_APR_RB, mThread->getLocalAPRFilePool());
         if (!infile.getFileHandle())
@@ -27,6 +27,7 @@
 #ifndef LL_LLLFSTHREAD_H
 #define LL_LLLFSTHREAD_H
 
+#include <memory>
 #include <queue>
 #include <string>
 #include <map>
@@ -110,6 +111,12 @@ public:
         S32 mBytesRead; // bytes read from file
 
         LLPointer<Responder> mResponder;
+
+#if LL_LINUX
+        // set once the read has been handed to the io_uring backend;
+        // the completion is reaped on a later processRequest() pass
+        std::shared_ptr<struct LLLFSRingCompletion> mRingCompletion;
+#endif
     };
 
     //------------------------------------------------------------------------
@@ -130,6 +137,18 @@ public:
     static S32 updateClass(U32 ms_elapsed);
     static void cleanupClass();     // Delete sLocal
 
+#if LL_LINUX
+    // io_uring read backend. Reads from many queued requests are submitted
+    // to the kernel in batches and completed out of order, so a cache storm
+    // keeps the drive busy instead of serializing behind blocking syscalls.
+    // NULL when the running kernel does not support io_uring; requests then
+    // take the blocking path unchanged.
+    class IOURing;
+protected:
+    /*virtual*/ void startThread();
+    IOURing* mRing;
+#endif
+
 public:
     static LLLFSThread* sLocal;     // Default local file thread
 };
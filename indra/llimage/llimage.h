@@ -93,7 +93,7 @@ typedef enum e_image_codec
 class LLImage
 {
 public:
-    static void initClass(bool use_new_byte_range = false, S32 minimal_reverse_byte_range_percent = 75);
+    static void initClass(bool use_new_byte_range = false, S32 minimal_reverse_byte_range_percent = 75, S32 decode_threads = 0);
     static void cleanupClass();
 
     static const std::string& getLastThreadError();
@@ -101,11 +101,13 @@ public:
 
     static bool useNewByteRange() { return sUseNewByteRange; }
     static S32  getReverseByteRangePercent() { return sMinimalReverseByteRangePercent; }
+    static S32  getDecodeThreads() { return sDecodeThreads; }
 
 protected:
     static thread_local std::string sLastThreadErrorMessage;
     static bool sUseNewByteRange;
     static S32  sMinimalReverseByteRangePercent;
+    static S32  sDecodeThreads;
 };
 
 //============================================================================
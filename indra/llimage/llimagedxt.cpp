@@ -418,6 +418,207 @@ bool LLImageDXT::encode(const LLImageRaw* raw_image, F32 time)
     return encodeDXT(raw_image, time, false);
 }
 
+//============================================================================
+// runtime BC1/BC3 block compression
+//============================================================================
+
+// pull a (possibly partial) 4x4 tile out of the source image as RGBA,
+// replicating edge texels so the padding doesn't drag the endpoints around
+static void dxt_extract_block(const U8* src, S32 width, S32 height, S32 components,
+                              S32 bx, S32 by, U8* block)
+{
+    for (S32 y = 0; y < 4; ++y)
+    {
+        S32 sy = llmin(by + y, height - 1);
+        for (S32 x = 0; x < 4; ++x)
+        {
+            S32 sx = llmin(bx + x, width - 1);
+            const U8* pixel = src + (sy * width + sx) * components;
+            U8* out = block + (y * 4 + x) * 4;
+            out[0] = pixel[0];
+            out[1] = pixel[1];
+            out[2] = pixel[2];
+            out[3] = (components == 4) ? pixel[3] : 255;
+        }
+    }
+}
+
+static inline U16 dxt_pack565(const S32* c)
+{
+    return (U16)(((c[0] >> 3) << 11) | ((c[1] >> 2) << 5) | (c[2] >> 3));
+}
+
+static inline void dxt_unpack565(U16 c, S32* out)
+{
+    out[0] = ((c >> 11) & 0x1f) * 255 / 31;
+    out[1] = ((c >> 5) & 0x3f) * 255 / 63;
+    out[2] = (c & 0x1f) * 255 / 31;
+}
+
+// 64 bits of BC1 color data: two 565 endpoints from an inset bounding box
+// and sixteen 2-bit palette indices
+static void dxt_encode_color_block(U8* dst, const U8* block)
+{
+    S32 minc[3] = { 255, 255, 255 };
+    S32 maxc[3] = { 0, 0, 0 };
+    for (S32 i = 0; i < 16; ++i)
+    {
+        for (S32 c = 0; c < 3; ++c)
+        {
+            S32 v = block[i * 4 + c];
+            minc[c] = llmin(minc[c], v);
+            maxc[c] = llmax(maxc[c], v);
+        }
+    }
+    // inset the box by a sixteenth of its extent to soften outliers
+    for (S32 c = 0; c < 3; ++c)
+    {
+        S32 inset = (maxc[c] - minc[c]) >> 4;
+        minc[c] += inset;
+        maxc[c] -= inset;
+    }
+
+    U16 c0 = dxt_pack565(maxc);
+    U16 c1 = dxt_pack565(minc);
+    if (c0 < c1)
+    {
+        std::swap(c0, c1);
+    }
+
+    // the palette as the hardware will reconstruct it
+    S32 palette[4][3];
+    dxt_unpack565(c0, palette[0]);
+    dxt_unpack565(c1, palette[1]);
+    for (S32 c = 0; c < 3; ++c)
+    {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+    }
+
+    // c0 == c1 decodes in three-color mode, but index 0 still reproduces
+    // the block's single color
+    S32 ncolors = (c0 == c1) ? 1 : 4;
+    U32 indices = 0;
+    for (S32 i = 0; i < 16; ++i)
+    {
+        S32 best = 0;
+        S32 best_err = S32_MAX;
+        for (S32 p = 0; p < ncolors; ++p)
+        {
+            S32 err = 0;
+            for (S32 c = 0; c < 3; ++c)
+            {
+                S32 d = block[i * 4 + c] - palette[p][c];
+                err += d * d;
+            }
+            if (err < best_err)
+            {
+                best_err = err;
+                best = p;
+            }
+        }
+        indices |= (U32)best << (i * 2);
+    }
+
+    dst[0] = (U8)(c0 & 0xff);
+    dst[1] = (U8)(c0 >> 8);
+    dst[2] = (U8)(c1 & 0xff);
+    dst[3] = (U8)(c1 >> 8);
+    dst[4] = (U8)(indices & 0xff);
+    dst[5] = (U8)((indices >> 8) & 0xff);
+    dst[6] = (U8)((indices >> 16) & 0xff);
+    dst[7] = (U8)((indices >> 24) & 0xff);
+}
+
+// 64 bits of BC3 alpha data: two 8-bit endpoints and sixteen 3-bit indices
+static void dxt_encode_alpha_block(U8* dst, const U8* block)
+{
+    S32 mina = 255;
+    S32 maxa = 0;
+    for (S32 i = 0; i < 16; ++i)
+    {
+        S32 a = block[i * 4 + 3];
+        mina = llmin(mina, a);
+        maxa = llmax(maxa, a);
+    }
+
+    // eight-point mode (a0 >= a1); the six interpolants sit between
+    S32 palette[8];
+    palette[0] = maxa;
+    palette[1] = mina;
+    for (S32 i = 1; i < 7; ++i)
+    {
+        palette[i + 1] = ((7 - i) * maxa + i * mina) / 7;
+    }
+
+    S32 ncolors = (maxa == mina) ? 1 : 8;
+    U64 indices = 0;
+    for (S32 i = 0; i < 16; ++i)
+    {
+        S32 a = block[i * 4 + 3];
+        S32 best = 0;
+        S32 best_err = S32_MAX;
+        for (S32 p = 0; p < ncolors; ++p)
+        {
+            S32 err = (a - palette[p]) * (a - palette[p]);
+            if (err < best_err)
+            {
+                best_err = err;
+                best = p;
+            }
+        }
+        indices |= (U64)best << (i * 3);
+    }
+
+    dst[0] = (U8)maxa;
+    dst[1] = (U8)mina;
+    for (S32 i = 0; i < 6; ++i)
+    {
+        dst[2 + i] = (U8)((indices >> (i * 8)) & 0xff);
+    }
+}
+
+//static
+S32 LLImageDXT::encodedBlockBytes(EFileFormat format, S32 width, S32 height)
+{
+    S32 blocks = ((width + 3) / 4) * ((height + 3) / 4);
+    S32 block_bytes = (format == FORMAT_DXT1 || format == FORMAT_DXR1) ? 8 : 16;
+    return blocks * block_bytes;
+}
+
+//static
+void LLImageDXT::encodeBC1(U8* dst, const U8* src, S32 width, S32 height, S32 components)
+{
+    llassert(components == 3 || components == 4);
+    U8 block[64];
+    for (S32 by = 0; by < height; by += 4)
+    {
+        for (S32 bx = 0; bx < width; bx += 4)
+        {
+            dxt_extract_block(src, width, height, components, bx, by, block);
+            dxt_encode_color_block(dst, block);
+            dst += 8;
+        }
+    }
+}
+
+//static
+void LLImageDXT::encodeBC3(U8* dst, const U8* src, S32 width, S32 height, S32 components)
+{
+    llassert(components == 3 || components == 4);
+    U8 block[64];
+    for (S32 by = 0; by < height; by += 4)
+    {
+        for (S32 bx = 0; bx < width; bx += 4)
+        {
+            dxt_extract_block(src, width, height, components, bx, by, block);
+            dxt_encode_alpha_block(dst, block);
+            dxt_encode_color_block(dst + 8, block);
+            dst += 16;
+        }
+    }
+}
+
 // virtual
 bool LLImageDXT::convertToDXR()
 {
@@ -129,6 +129,14 @@ public:
     static void calcDiscardWidthHeight(S32 discard_level, EFileFormat format, S32& width, S32& height);
     static S32 calcNumMips(S32 width, S32 height);
 
+    // Runtime BC block compression of raw interleaved pixel data (3 or 4
+    // components). dst must hold encodedBlockBytes() bytes; images that are
+    // not multiples of four in either dimension get their edge texels
+    // replicated into the padding blocks.
+    static S32 encodedBlockBytes(EFileFormat format, S32 width, S32 height);
+    static void encodeBC1(U8* dst, const U8* src, S32 width, S32 height, S32 components);
+    static void encodeBC3(U8* dst, const U8* src, S32 width, S32 height, S32 components);
+
 private:
     static void extractMip(const U8 *indata, U8* mipdata, int width, int height,
                            int mip_width, int mip_height, EFileFormat format);
@@ -35,6 +35,11 @@
 #include "v3math.h"
 #include "llsdserialize.h"
 #include "llstring.h"
+#include "workqueue.h"
+
+#include <atomic>
+#include <functional>
+#include <thread>
 
 //---------------------------------------------------------------------------
 // LLImageFilter
@@ -277,6 +282,50 @@ void LLImageFilter::executeFilter(LLPointer<LLImageRaw> raw_image)
 // Filter Primitives
 //============================================================================
 
+// Runs row_fn over destination rows [0, height) -- in parallel row bands on
+// the General work queue for large images, inline otherwise.  The per-pixel
+// primitives below only ever write their own row, so bands are independent;
+// 4K snapshot filter passes drop from a second-plus to the time of one band.
+static void filter_rows(S32 width, S32 height, const std::function<void(S32, S32)>& row_fn)
+{
+    constexpr S32 MT_FILTER_MIN_PIXELS = 1024 * 1024;
+    constexpr S32 MT_FILTER_BANDS = 4;
+    LL::WorkQueue::ptr_t queue;
+    if (width * height >= MT_FILTER_MIN_PIXELS && height >= MT_FILTER_BANDS)
+    {
+        queue = LL::WorkQueue::getInstance("General");
+    }
+
+    if (queue)
+    {
+        S32 band_height = height / MT_FILTER_BANDS;
+        std::atomic<S32> pending(MT_FILTER_BANDS - 1);
+        for (S32 band = 0; band < MT_FILTER_BANDS - 1; ++band)
+        {
+            S32 y_begin = band * band_height;
+            S32 y_end = y_begin + band_height;
+            auto job = [&row_fn, y_begin, y_end, &pending]()
+                {
+                    row_fn(y_begin, y_end);
+                    --pending;
+                };
+            if (!queue->post(job))
+            { // pool is shutting down -- run the band inline
+                job();
+            }
+        }
+        row_fn((MT_FILTER_BANDS - 1) * band_height, height);
+        while (pending > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    else
+    {
+        row_fn(0, height);
+    }
+}
+
 void LLImageFilter::blendStencil(F32 alpha, U8* pixel, U8 red, U8 green, U8 blue)
 {
     F32 inv_alpha = 1.0f - alpha;
@@ -317,15 +366,56 @@ void LLImageFilter::colorCorrect(const U8* lut_red, const U8* lut_green, const U
     S32 width  = mImage->getWidth();
     S32 height = mImage->getHeight();
 
-    U8* dst_data = mImage->getData();
-    for (S32 j = 0; j < height; j++)
+    U8* data = mImage->getData();
+
+    if (mStencilShape == STENCIL_SHAPE_UNIFORM)
     {
-        for (S32 i = 0; i < width; i++)
+        // The stencil alpha is the same for every pixel, so the LUT and the
+        // blend collapse into one flat table per channel and the inner loop
+        // is three lookups per pixel.
+        U8 folded_red[256];
+        U8 folded_green[256];
+        U8 folded_blue[256];
+        F32 alpha = getStencilAlpha(0,0);
+        for (S32 v = 0; v < 256; v++)
         {
-            // Blend LUT value
-            blendStencil(getStencilAlpha(i,j), dst_data, lut_red[dst_data[VRED]], lut_green[dst_data[VGREEN]], lut_blue[dst_data[VBLUE]]);
-            dst_data += components;
+            U8 pixel[3] = { (U8)v, (U8)v, (U8)v };
+            blendStencil(alpha, pixel, lut_red[v], lut_green[v], lut_blue[v]);
+            folded_red[v]   = pixel[VRED];
+            folded_green[v] = pixel[VGREEN];
+            folded_blue[v]  = pixel[VBLUE];
         }
+
+        filter_rows(width, height, [&](S32 y_begin, S32 y_end)
+            {
+                U8* dst_data = data + y_begin * width * components;
+                for (S32 j = y_begin; j < y_end; j++)
+                {
+                    for (S32 i = 0; i < width; i++)
+                    {
+                        dst_data[VRED]   = folded_red[dst_data[VRED]];
+                        dst_data[VGREEN] = folded_green[dst_data[VGREEN]];
+                        dst_data[VBLUE]  = folded_blue[dst_data[VBLUE]];
+                        dst_data += components;
+                    }
+                }
+            });
+    }
+    else
+    {
+        filter_rows(width, height, [&](S32 y_begin, S32 y_end)
+            {
+                U8* dst_data = data + y_begin * width * components;
+                for (S32 j = y_begin; j < y_end; j++)
+                {
+                    for (S32 i = 0; i < width; i++)
+                    {
+                        // Blend LUT value
+                        blendStencil(getStencilAlpha(i,j), dst_data, lut_red[dst_data[VRED]], lut_green[dst_data[VGREEN]], lut_blue[dst_data[VBLUE]]);
+                        dst_data += components;
+                    }
+                }
+            });
     }
 }
 
@@ -337,21 +427,25 @@ void LLImageFilter::colorTransform(const LLMatrix3 &transform)
     S32 width  = mImage->getWidth();
     S32 height = mImage->getHeight();
 
-    U8* dst_data = mImage->getData();
-    for (S32 j = 0; j < height; j++)
-    {
-        for (S32 i = 0; i < width; i++)
+    U8* data = mImage->getData();
+    filter_rows(width, height, [&](S32 y_begin, S32 y_end)
         {
-            // Compute transform
-            LLVector3 src((F32)(dst_data[VRED]),(F32)(dst_data[VGREEN]),(F32)(dst_data[VBLUE]));
-            LLVector3 dst = src * transform;
-            dst.clamp(0.0f,255.0f);
-
-            // Blend result
-            blendStencil(getStencilAlpha(i,j), dst_data, (U8)dst.mV[VRED], (U8)dst.mV[VGREEN], (U8)dst.mV[VBLUE]);
-            dst_data += components;
-        }
-    }
+            U8* dst_data = data + y_begin * width * components;
+            for (S32 j = y_begin; j < y_end; j++)
+            {
+                for (S32 i = 0; i < width; i++)
+                {
+                    // Compute transform
+                    LLVector3 src((F32)(dst_data[VRED]),(F32)(dst_data[VGREEN]),(F32)(dst_data[VBLUE]));
+                    LLVector3 dst = src * transform;
+                    dst.clamp(0.0f,255.0f);
+
+                    // Blend result
+                    blendStencil(getStencilAlpha(i,j), dst_data, (U8)dst.mV[VRED], (U8)dst.mV[VGREEN], (U8)dst.mV[VBLUE]);
+                    dst_data += components;
+                }
+            }
+        });
 }
 
 void LLImageFilter::convolve(const LLMatrix3 &kernel, bool normalize, bool abs_value)
@@ -516,34 +610,38 @@ void LLImageFilter::filterScreen(EScreenMode mode, const F32 wave_length, const
         gamma[i] = (U8)(255.0 * gamma_i);
     }
 
-    U8* dst_data = mImage->getData();
-    for (S32 j = 0; j < height; j++)
-    {
-        for (S32 i = 0; i < width; i++)
+    U8* data = mImage->getData();
+    filter_rows(width, height, [&](S32 y_begin, S32 y_end)
         {
-            // Compute screen value
-            F32 value = 0.0;
-            F32 di = 0.0;
-            F32 dj = 0.0;
-            switch (mode)
+            U8* dst_data = data + y_begin * width * components;
+            for (S32 j = y_begin; j < y_end; j++)
             {
-                case SCREEN_MODE_2DSINE:
-                    di =  cos*i + sin*j;
-                    dj = -sin*i + cos*j;
-                    value = (sinf(2*F_PI*di/wave_length_pixels)*sinf(2*F_PI*dj/wave_length_pixels)+1.0f)*255.0f/2.0f;
-                    break;
-                case SCREEN_MODE_LINE:
-                    dj = sin*i - cos*j;
-                    value = (sinf(2*F_PI*dj/wave_length_pixels)+1.0f)*255.0f/2.0f;
-                    break;
+                for (S32 i = 0; i < width; i++)
+                {
+                    // Compute screen value
+                    F32 value = 0.0;
+                    F32 di = 0.0;
+                    F32 dj = 0.0;
+                    switch (mode)
+                    {
+                        case SCREEN_MODE_2DSINE:
+                            di =  cos*i + sin*j;
+                            dj = -sin*i + cos*j;
+                            value = (sinf(2*F_PI*di/wave_length_pixels)*sinf(2*F_PI*dj/wave_length_pixels)+1.0f)*255.0f/2.0f;
+                            break;
+                        case SCREEN_MODE_LINE:
+                            dj = sin*i - cos*j;
+                            value = (sinf(2*F_PI*dj/wave_length_pixels)+1.0f)*255.0f/2.0f;
+                            break;
+                    }
+                    U8 dst_value = (dst_data[VRED] >= (U8)(value) ? gamma[dst_data[VRED] - (U8)(value)] : 0);
+
+                    // Blend result
+                    blendStencil(getStencilAlpha(i,j), dst_data, dst_value, dst_value, dst_value);
+                    dst_data += components;
+                }
             }
-            U8 dst_value = (dst_data[VRED] >= (U8)(value) ? gamma[dst_data[VRED] - (U8)(value)] : 0);
-
-            // Blend result
-            blendStencil(getStencilAlpha(i,j), dst_data, dst_value, dst_value, dst_value);
-            dst_data += components;
-        }
-    }
+        });
 }
 
 //============================================================================
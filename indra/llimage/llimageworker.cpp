@@ -38,7 +38,8 @@ public:
                  S32 discard,
                  bool needs_aux,
                  const LLPointer<LLImageDecodeThread::Responder>& responder,
-                 U32 request_id);
+                 U32 request_id,
+                 const std::shared_ptr<std::atomic<bool> >& cancel_flag);
     virtual ~ImageRequest();
 
     /*virtual*/ bool processRequest();
@@ -58,16 +59,27 @@ private:
     bool mDecodedRaw;
     bool mDecodedAux;
     LLPointer<LLImageDecodeThread::Responder> mResponder;
-    std::string mErrorString;};
+    std::string mErrorString;
+    // set from other threads when the result is no longer wanted
+    std::shared_ptr<std::atomic<bool> > mCancelFlag;};
 
 
 //----------------------------------------------------------------------------
 
 // MAIN THREAD
-LLImageDecodeThread::LLImageDecodeThread(bool /*threaded*/)
+LLImageDecodeThread::LLImageDecodeThread(bool /*threaded*/, bool use_work_steal)
     : mDecodeCount(0)
 {
-    mThreadPool.reset(new LL::ThreadPool("ImageDecode", 8));
+    if (use_work_steal)
+    {
+        // the sharded queue keeps a teleport burst of small decode requests
+        // from convoying every worker on a single mutex
+        mThreadPool.reset(new LL::ThreadPoolUsing<LL::WorkStealQueue>("ImageDecode", 8));
+    }
+    else
+    {
+        mThreadPool.reset(new LL::ThreadPool("ImageDecode", 8));
+    }
     mThreadPool->start();
 }
 
@@ -85,7 +97,7 @@ size_t LLImageDecodeThread::update(F32 max_time_ms)
 
 size_t LLImageDecodeThread::getPending()
 {
-    return mThreadPool->getQueue().size();
+    return mThreadPool->getQueueBase().size();
 }
 
 LLImageDecodeThread::handle_t LLImageDecodeThread::decodeImage(
@@ -100,23 +112,51 @@ LLImageDecodeThread::handle_t LLImageDecodeThread::decodeImage(
     if (decode_id == 0)
         decode_id = ++mDecodeCount;
 
+    cancel_flag_t cancel_flag = std::make_shared<std::atomic<bool> >(false);
+    {
+        std::lock_guard<std::mutex> lock(mCancelMutex);
+        mCancelFlags[decode_id] = cancel_flag;
+    }
+
     // Instantiate the ImageRequest right in the lambda, why not?
-    bool posted = mThreadPool->getQueue().post(
-        [req = ImageRequest(image, discard, needs_aux, responder, decode_id)]
+    bool posted = mThreadPool->getQueueBase().post(
+        [this, decode_id, req = ImageRequest(image, discard, needs_aux, responder, decode_id, cancel_flag)]
         () mutable
         {
             auto done = req.processRequest();
             req.finishRequest(done);
+            releaseCancelFlag(decode_id);
         });
     if (! posted)
     {
         LL_DEBUGS() << "Tried to start decoding on shutdown" << LL_ENDL;
+        releaseCancelFlag(decode_id);
         return 0;
     }
 
     return decode_id;
 }
 
+void LLImageDecodeThread::abortRequest(handle_t handle)
+{
+    if (handle == 0)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mCancelMutex);
+    auto it = mCancelFlags.find(handle);
+    if (it != mCancelFlags.end())
+    {
+        *(it->second) = true;
+    }
+}
+
+void LLImageDecodeThread::releaseCancelFlag(handle_t handle)
+{
+    std::lock_guard<std::mutex> lock(mCancelMutex);
+    mCancelFlags.erase(handle);
+}
+
 void LLImageDecodeThread::shutdown()
 {
     mThreadPool->close();
@@ -132,14 +172,16 @@ ImageRequest::ImageRequest(const LLPointer<LLImageFormatted>& image,
                            S32 discard,
                            bool needs_aux,
                            const LLPointer<LLImageDecodeThread::Responder>& responder,
-                           U32 request_id)
+                           U32 request_id,
+                           const std::shared_ptr<std::atomic<bool> >& cancel_flag)
     : mFormattedImage(image),
       mDiscardLevel(discard),
       mNeedsAux(needs_aux),
       mDecodedRaw(false),
       mDecodedAux(false),
       mResponder(responder),
-      mRequestId(request_id)
+      mRequestId(request_id),
+      mCancelFlag(cancel_flag)
 {
 }
 
@@ -161,6 +203,13 @@ bool ImageRequest::processRequest()
     if (mFormattedImage.isNull())
         return true;
 
+    if (mCancelFlag && *mCancelFlag)
+    {
+        // requester lost interest while we sat in the queue; report
+        // "done" with nothing decoded so the responder sees a failure
+        return true;
+    }
+
     const F32 decode_time_slice = 0.f; //disable time slicing
     bool done = true;
 
@@ -197,6 +246,12 @@ bool ImageRequest::processRequest()
         // Pick up errors from decoding
         mErrorString = LLImage::getLastThreadError();
     }
+    if (mCancelFlag && *mCancelFlag)
+    {
+        // re-check between stages; skip the aux decode for a stale request
+        return true;
+    }
+
     if (done && mNeedsAux && !mDecodedAux && mFormattedImage.notNull())
     {
         // Decode aux channel
@@ -31,6 +31,11 @@
 #include "llpointer.h"
 #include "threadpool_fwd.h"
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
 class LLImageDecodeThread
 {
 public:
@@ -43,7 +48,7 @@ public:
     };
 
 public:
-    LLImageDecodeThread(bool threaded = true);
+    LLImageDecodeThread(bool threaded = true, bool use_work_steal = false);
     virtual ~LLImageDecodeThread();
 
     // meant to resemble LLQueuedThread::handle_t
@@ -51,6 +56,10 @@ public:
     handle_t decodeImage(const LLPointer<LLImageFormatted>& image,
                          S32 discard, bool needs_aux,
                          const LLPointer<Responder>& responder);
+    // Flag a queued or running decode as no longer wanted; the job checks
+    // the flag between decode stages and bails out early. Safe to call from
+    // any thread and with a handle whose decode has already finished.
+    void abortRequest(handle_t handle);
     size_t getPending();
     size_t update(F32 max_time_ms);
     S32 getTotalDecodeCount() { return mDecodeCount; }
@@ -59,9 +68,17 @@ public:
 private:
     // As of SL-17483, LLImageDecodeThread is no longer itself an
     // LLQueuedThread - instead this is the API by which we submit work to the
-    // "ImageDecode" ThreadPool.
-    std::unique_ptr<LL::ThreadPool> mThreadPool;
+    // "ImageDecode" ThreadPool. Held through the base class since the pool
+    // is built on either WorkQueue or WorkStealQueue.
+    std::unique_ptr<LL::ThreadPoolBase> mThreadPool;
     LLAtomicU32 mDecodeCount;
+
+    // cancellation tokens for outstanding decodes, keyed by handle; entries
+    // are dropped again when the job drains from the pool
+    typedef std::shared_ptr<std::atomic<bool> > cancel_flag_t;
+    void releaseCancelFlag(handle_t handle);
+    std::mutex mCancelMutex;
+    std::map<handle_t, cancel_flag_t> mCancelFlags;
 };
 
 #endif
@@ -340,6 +340,16 @@ public:
         decoder = opj_create_decompress(OPJ_CODEC_J2K);
         opj_setup_decoder(decoder, &parameters);
 
+        // fan the tile and T1 work of large images out across openjpeg's
+        // internal worker threads; small payloads aren't worth the fan-out
+        // since the decode pool already runs many of those concurrently
+        constexpr U32 MT_DECODE_MIN_BYTES = 256 * 1024;
+        S32 decode_threads = LLImage::getDecodeThreads();
+        if (decode_threads > 1 && dataSize >= MT_DECODE_MIN_BYTES)
+        {
+            opj_codec_set_threads(decoder, decode_threads);
+        }
+
         opj_set_info_handler(decoder, opj_info, this);
         opj_set_warning_handler(decoder, opj_warn, this);
         opj_set_error_handler(decoder, opj_error, this);
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include "lltrace.h"
 #include "llfasttimer.h"
+#include "llsdutil.h"
 #include "v3colorutil.h"
 #include <boost/bind.hpp>
 
@@ -569,6 +570,47 @@ bool lerp_legacy_float(F32& a, bool& a_has_legacy, F32 b, bool b_has_legacy, F32
     return a_has_legacy;
 }
 
+// Density profile layers (the rayleigh/mie/absorption configs) are arrays of
+// maps holding nothing but reals from a fixed field table. Blend them in
+// place as flat floats; interpolateSDMap would rebuild every map and consult
+// the skip/slerp/default tables for every key on every environment frame.
+void lerp_density_profiles(LLSD& a, const LLSD& b, F32 mix)
+{
+    static const std::string* profile_fields[] =
+    {
+        &LLSettingsSky::SETTING_DENSITY_PROFILE_WIDTH,
+        &LLSettingsSky::SETTING_DENSITY_PROFILE_EXP_TERM,
+        &LLSettingsSky::SETTING_DENSITY_PROFILE_EXP_SCALE_FACTOR,
+        &LLSettingsSky::SETTING_DENSITY_PROFILE_LINEAR_TERM,
+        &LLSettingsSky::SETTING_DENSITY_PROFILE_CONSTANT_TERM,
+        &LLSettingsSky::SETTING_MIE_ANISOTROPY_FACTOR
+    };
+
+    size_t layers = llmin(a.size(), b.size());
+    for (size_t i = 0; i < layers; ++i)
+    {
+        LLSD& layer = a[i];
+        const LLSD& other_layer = b[i];
+        for (const std::string* field : profile_fields)
+        {
+            if (layer.has(*field))
+            {
+                layer[*field] = LLSD::Real(lerp((F32)layer[*field].asReal(), (F32)other_layer[*field].asReal(), mix));
+            }
+            else if (other_layer.has(*field))
+            {
+                layer[*field] = LLSD::Real(lerp(0.f, (F32)other_layer[*field].asReal(), mix));
+            }
+        }
+    }
+
+    // mismatched layer counts can't be blended; hard switch at the midpoint
+    if (mix > 0.5f && a.size() != b.size())
+    {
+        a = llsd_clone(b);
+    }
+}
+
 void LLSettingsSky::blend(LLSettingsBase::ptr_t &end, F64 blendf)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_ENVIRONMENT;
@@ -659,12 +701,9 @@ void LLSettingsSky::blend(LLSettingsBase::ptr_t &end, F64 blendf)
         mHasLegacyHaze |= lerp_legacy_color(mBlueHorizon, mLegacyBlueHorizon, other->mBlueHorizon, other->mLegacyBlueHorizon, LLColor3(0.4954f, 0.4954f, 0.6399f), (F32)blendf);
         mHasLegacyHaze |= lerp_legacy_color(mBlueDensity, mLegacyBlueDensity, other->mBlueDensity, other->mLegacyBlueDensity, LLColor3(0.2447f, 0.4487f, 0.7599f), (F32)blendf);
 
-        parammapping_t defaults = other->getParameterMap();
-        stringset_t skip = getSkipInterpolateKeys();
-        stringset_t slerps = getSlerpKeys();
-        mAbsorptionConfigs = interpolateSDMap(mAbsorptionConfigs, other->mAbsorptionConfigs, defaults, blendf, skip, slerps);
-        mMieConfigs = interpolateSDMap(mMieConfigs, other->mMieConfigs, defaults, blendf, skip, slerps);
-        mRayleighConfigs = interpolateSDMap(mRayleighConfigs, other->mRayleighConfigs, defaults, blendf, skip, slerps);
+        lerp_density_profiles(mAbsorptionConfigs, other->mAbsorptionConfigs, (F32)blendf);
+        lerp_density_profiles(mMieConfigs, other->mMieConfigs, (F32)blendf);
+        lerp_density_profiles(mRayleighConfigs, other->mRayleighConfigs, (F32)blendf);
 
         setDirtyFlag(true);
         setReplaced();
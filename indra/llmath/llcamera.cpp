@@ -296,6 +296,143 @@ S32 LLCamera::AABBInRegionFrustumNoFarClip(const LLVector4a& center, const LLVec
     return AABBInFrustumNoFarClip(center, radius, mRegionPlanes);
 }
 
+//core of the batch AABB tests below -- processes four boxes per pass by
+//transposing their centers and radii into SoA form, so each plane costs a
+//handful of SSE ops for all four boxes instead of a scalar loop per box.
+//'skip_plane' is the index of a plane to ignore (5 for the no-far-clip
+//variants, matching the scalar tests) or -1 for none.
+static U32 aabb_in_frustum_batch_impl(const LLPlane* planes, const U8* plane_mask, U32 max_planes, S32 skip_plane,
+                                      const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside)
+{
+    llassert(count <= 32);
+
+    U32 visible = 0;
+    U32 inside = 0;
+
+    for (U32 b = 0; b < count; b += 4)
+    {
+        const U32 n = llmin(count - b, (U32) 4);
+
+        //transpose four center/radius pairs into SoA form, replicating the
+        //last box into any unused lanes
+        LLQuad cx = centers[b];
+        LLQuad cy = centers[b + llmin((U32) 1, n - 1)];
+        LLQuad cz = centers[b + llmin((U32) 2, n - 1)];
+        LLQuad cw = centers[b + llmin((U32) 3, n - 1)];
+        _MM_TRANSPOSE4_PS(cx, cy, cz, cw);
+
+        LLQuad rx = radii[b];
+        LLQuad ry = radii[b + llmin((U32) 1, n - 1)];
+        LLQuad rz = radii[b + llmin((U32) 2, n - 1)];
+        LLQuad rw = radii[b + llmin((U32) 3, n - 1)];
+        _MM_TRANSPOSE4_PS(rx, ry, rz, rw);
+
+        const LLVector4a vcx(cx), vcy(cy), vcz(cz);
+        const LLVector4a vrx(rx), vry(ry), vrz(rz);
+
+        U32 out_bits = 0;       //lanes rejected by some plane
+        U32 straddle_bits = 0;  //lanes crossing some plane
+
+        for (U32 i = 0; i < max_planes; i++)
+        {
+            if ((S32) i == skip_plane || plane_mask[i] >= LLCamera::PLANE_MASK_NUM)
+            {
+                continue;
+            }
+
+            LLSimdScalar a, bq, c, d;
+            planes[i].getAt<0>(a);
+            planes[i].getAt<1>(bq);
+            planes[i].getAt<2>(c);
+            planes[i].getAt<3>(d);
+
+            LLVector4a pa, pb, pc, dist;
+            pa.splat(a);
+            pb.splat(bq);
+            pc.splat(c);
+            dist.splat(d);
+
+            //signed distance from each center to the plane, plus d
+            LLVector4a t;
+            t.setMul(pa, vcx);
+            dist.add(t);
+            t.setMul(pb, vcy);
+            dist.add(t);
+            t.setMul(pc, vcz);
+            dist.add(t);
+
+            //projected extent of each box onto the plane normal
+            LLVector4a reach;
+            pa.setAbs(pa);
+            pb.setAbs(pb);
+            pc.setAbs(pc);
+            reach.setMul(pa, vrx);
+            t.setMul(pb, vry);
+            reach.add(t);
+            t.setMul(pc, vrz);
+            reach.add(t);
+
+            LLVector4a min_d;
+            min_d.setSub(dist, reach);
+            LLVector4a max_d;
+            max_d.setAdd(dist, reach);
+
+            out_bits |= min_d.greaterThan(LLVector4a::getZero()).getGatheredBits() & 0xf;
+            straddle_bits |= max_d.greaterThan(LLVector4a::getZero()).getGatheredBits() & 0xf;
+
+            if (out_bits == 0xf)
+            { //every lane already rejected
+                break;
+            }
+        }
+
+        const U32 lane_mask = (1U << n) - 1;
+        visible |= (~out_bits & lane_mask) << b;
+        inside |= (~(out_bits | straddle_bits) & lane_mask) << b;
+    }
+
+    if (fully_inside)
+    {
+        *fully_inside = inside;
+    }
+
+    return visible;
+}
+
+U32 LLCamera::AABBInFrustumBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside, const LLPlane* planes)
+{
+    if(!planes)
+    {
+        //use agent space
+        planes = mAgentPlanes;
+    }
+
+    U32 max_planes = llmin(mPlaneCount, (U32) AGENT_PLANE_USER_CLIP_NUM);
+    return aabb_in_frustum_batch_impl(planes, mPlaneMask, max_planes, -1, centers, radii, count, fully_inside);
+}
+
+U32 LLCamera::AABBInRegionFrustumBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside)
+{
+    return AABBInFrustumBatch(centers, radii, count, fully_inside, mRegionPlanes);
+}
+
+U32 LLCamera::AABBInFrustumNoFarClipBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside, const LLPlane* planes)
+{
+    if(!planes)
+    {
+        //use agent space
+        planes = mAgentPlanes;
+    }
+
+    U32 max_planes = llmin(mPlaneCount, (U32) AGENT_PLANE_USER_CLIP_NUM);
+    return aabb_in_frustum_batch_impl(planes, mPlaneMask, max_planes, 5, centers, radii, count, fully_inside);
+}
+
+U32 LLCamera::AABBInRegionFrustumNoFarClipBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside)
+{
+    return AABBInFrustumNoFarClipBatch(centers, radii, count, fully_inside, mRegionPlanes);
+}
+
 int LLCamera::sphereInFrustumQuick(const LLVector3 &sphere_center, const F32 radius)
 {
     LLVector3 dist = sphere_center-mFrustCenter;
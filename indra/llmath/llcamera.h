@@ -202,6 +202,16 @@ public:
     S32 AABBInFrustumNoFarClip(const LLVector4a& center, const LLVector4a& radius, const LLPlane* planes = NULL);
     S32 AABBInRegionFrustumNoFarClip(const LLVector4a& center, const LLVector4a& radius);
 
+    // Batch variants of the AABB tests above -- test up to 32 boxes given as
+    // center/radius pairs against the frustum, four boxes per SSE pass.
+    // Returns a bitmask with bit i set if box i is at least partially inside;
+    // if 'fully_inside' is non-NULL, its bit i is set when box i is entirely
+    // inside every plane (the "2" result of the scalar tests).
+    U32 AABBInFrustumBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside = NULL, const LLPlane* planes = NULL);
+    U32 AABBInRegionFrustumBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside = NULL);
+    U32 AABBInFrustumNoFarClipBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside = NULL, const LLPlane* planes = NULL);
+    U32 AABBInRegionFrustumNoFarClipBatch(const LLVector4a* centers, const LLVector4a* radii, U32 count, U32* fully_inside = NULL);
+
     //does a quick 'n dirty sphere-sphere check
     S32 sphereInFrustumQuick(const LLVector3 &sphere_center, const F32 radius);
 
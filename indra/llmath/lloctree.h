@@ -27,6 +27,7 @@
 #ifndef LL_LLOCTREE_H
 #define LL_LLOCTREE_H
 
+#include "llobjectpool.h"
 #include "lltreenode.h"
 #include "v3math.h"
 #include "llvector4a.h"
@@ -86,7 +87,10 @@ public:
 template <class T, typename T_PTR>
 class alignas(16) LLOctreeNode : public LLTreeNode<T>
 {
-    LL_ALIGN_NEW
+    // one pool per instantiation; scene rebuilds churn these nodes heavily.
+    // LLOctreeRoot shares this pool when its size matches, and falls through
+    // to the aligned heap when it doesn't.
+    LL_OBJECT_POOL_NEW(LLOctreeNode)
 public:
 
     typedef LLOctreeTraveler<T, T_PTR>                          oct_traveler;
@@ -494,6 +498,64 @@ public:
         return true;
     }
 
+    //move data to wherever its (already updated) bounds now belong,
+    //walking up from this node only as far as the new bounds require
+    //instead of reinserting from the root -- for small displacements
+    //the destination is typically this node, a sibling, or the parent.
+    //returns false if data is not resident in this node, in which case
+    //the caller should fall back to a full remove/insert.
+    bool relocate(T* data)
+    {
+        S32 i = data->getBinIndex();
+
+        if (i < 0 || i >= (S32)getElementCount() || mData[i] != data)
+        {
+            return false;
+        }
+
+        //detach without pruning -- the vacated branch must stay alive
+        //while we climb through it (checkAlive is deferred until after
+        //the insertion, see below)
+        data->setBinIndex(-1);
+
+        const U32 new_element_count = getElementCount() - 1;
+        if (new_element_count > 0)
+        {
+            if (new_element_count != (U32)i)
+            {
+                mData[i] = mData[new_element_count]; //might unref data, do not access data after this point
+                mData[i]->setBinIndex(i);
+            }
+
+            mData[new_element_count] = NULL;
+            mData.pop_back();
+        }
+        else
+        {
+            mData.clear();
+        }
+
+        this->notifyRemoval(data);
+
+        //climb only as far as the new bounds require
+        oct_node* node = this;
+        while (node->getOctParent() && !node->isInside(data))
+        {
+            node = node->getOctParent();
+        }
+
+        //descend to the smallest fitting node and insert there (if data
+        //escaped the tree entirely we end up at the root, whose insert
+        //override handles expansion)
+        node->getNodeAt(data)->insert(data);
+
+        //now safe to prune the vacated branch ("this" may be deleted here,
+        //see checkAlive)
+        checkAlive();
+
+        return true;
+    }
+
     void removeByAddress(T* data)
     {
         const U32 element_count = getElementCount();
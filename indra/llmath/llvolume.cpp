@@ -94,6 +94,12 @@ constexpr F32 SKEW_MAX  =  0.95f;
 constexpr F32 SCULPT_MIN_AREA = 0.002f;
 constexpr S32 SCULPT_MIN_AREA_DETAIL = 1;
 
+// sculptSimplifyFaces() runs at details below this (the two lowest LODs,
+// see LLVolumeLODGroup::mDetailScales)
+constexpr F32 SCULPT_SIMPLIFY_MAX_DETAIL = 2.f;
+// allowed geometric deviation when simplifying, as a fraction of mesh extents
+constexpr F32 SCULPT_SIMPLIFY_ERROR = 0.05f;
+
 bool gDebugGL = false; // See settings.xml "RenderDebugGL"
 
 bool check_same_clock_dir( const LLVector3& pt1, const LLVector3& pt2, const LLVector3& pt3, const LLVector3& norm)
@@ -1952,6 +1958,7 @@ LLProfile::~LLProfile()
 
 
 S32 LLVolume::sNumMeshPoints = 0;
+bool LLVolume::sSculptLODSimplify = false;
 
 LLVolume::LLVolume(const LLVolumeParams &params, const F32 detail, const bool generate_single_face, const bool is_unique)
     : mParams(params)
@@ -2117,13 +2124,28 @@ bool LLVolume::generate()
                 offset.clear();
             }
 
-            LLVector4a tmp;
+            LLVector4a tmp0, tmp1, tmp2, tmp3;
 
-            // Run along the profile.
+            // Run along the profile, four points per iteration so the
+            // independent rotates can overlap instead of serializing on one
+            // accumulator.
+            while (end_profile - profile >= 4)
+            {
+                rot_mat.rotate(profile[0], tmp0);
+                rot_mat.rotate(profile[1], tmp1);
+                rot_mat.rotate(profile[2], tmp2);
+                rot_mat.rotate(profile[3], tmp3);
+                dst[0].setAdd(tmp0, offset);
+                dst[1].setAdd(tmp1, offset);
+                dst[2].setAdd(tmp2, offset);
+                dst[3].setAdd(tmp3, offset);
+                profile += 4;
+                dst += 4;
+            }
             while (profile < end_profile)
             {
-                rot_mat.rotate(*profile++, tmp);
-                dst->setAdd(tmp,offset);
+                rot_mat.rotate(*profile++, tmp0);
+                dst->setAdd(tmp0,offset);
                 ++dst;
             }
         }
@@ -3030,76 +3052,87 @@ void LLVolume::sculptGenerateMapVertices(U16 sculpt_width, U16 sculpt_height, S8
     S32 sizeS = mPathp->mPath.size();
     S32 sizeT = mProfilep->mProfile.size();
 
-    S32 line = 0;
-    for (S32 s = 0; s < sizeS; s++)
+    // The sample column for a given t is the same on every row, so compute
+    // it (reversal and side stitching included) once instead of per vertex.
+    static thread_local std::vector<U32> x_for_t;
+    x_for_t.resize(sizeT);
+    for (S32 t = 0; t < sizeT; t++)
     {
-        // Run along the profile.
-        for (S32 t = 0; t < sizeT; t++)
+        S32 reversed_t = t;
+
+        if (reverse_horizontal)
         {
-            S32 i = t + line;
-            LLVector4a& pt = mMesh[i];
+            reversed_t = sizeT - t - 1;
+        }
 
-            S32 reversed_t = t;
+        U32 x = (U32) ((F32)reversed_t/(sizeT-1) * (F32) sculpt_width);
 
-            if (reverse_horizontal)
+        if (x == sculpt_width)   // side stitching
+        {
+            // wrap?
+            if ((sculpt_stitching == LL_SCULPT_TYPE_SPHERE) ||
+                (sculpt_stitching == LL_SCULPT_TYPE_TORUS) ||
+                (sculpt_stitching == LL_SCULPT_TYPE_CYLINDER))
             {
-                reversed_t = sizeT - t - 1;
+                x = 0;
             }
 
-            U32 x = (U32) ((F32)reversed_t/(sizeT-1) * (F32) sculpt_width);
-            U32 y = (U32) ((F32)s/(sizeS-1) * (F32) sculpt_height);
+            else
+            {
+                x = sculpt_width - 1;
+            }
+        }
 
+        x_for_t[t] = x;
+    }
 
-            if (y == 0)  // top row stitching
+    const LLVector4a mirror_scale(-1.f,1,1,1);
+
+    S32 line = 0;
+    for (S32 s = 0; s < sizeS; s++)
+    {
+        U32 y = (U32) ((F32)s/(sizeS-1) * (F32) sculpt_height);
+
+        // top and bottom row stitching applies to the whole row
+        bool pinch = false;
+
+        if (y == 0)  // top row stitching
+        {
+            // pinch?
+            pinch = (sculpt_stitching == LL_SCULPT_TYPE_SPHERE);
+        }
+
+        if (y == sculpt_height)  // bottom row stitching
+        {
+            // wrap?
+            if (sculpt_stitching == LL_SCULPT_TYPE_TORUS)
             {
-                // pinch?
-                if (sculpt_stitching == LL_SCULPT_TYPE_SPHERE)
-                {
-                    x = sculpt_width / 2;
-                }
+                y = 0;
             }
-
-            if (y == sculpt_height)  // bottom row stitching
+            else
             {
-                // wrap?
-                if (sculpt_stitching == LL_SCULPT_TYPE_TORUS)
-                {
-                    y = 0;
-                }
-                else
-                {
-                    y = sculpt_height - 1;
-                }
-
-                // pinch?
-                if (sculpt_stitching == LL_SCULPT_TYPE_SPHERE)
-                {
-                    x = sculpt_width / 2;
-                }
+                y = sculpt_height - 1;
             }
 
-            if (x == sculpt_width)   // side stitching
-            {
-                // wrap?
-                if ((sculpt_stitching == LL_SCULPT_TYPE_SPHERE) ||
-                    (sculpt_stitching == LL_SCULPT_TYPE_TORUS) ||
-                    (sculpt_stitching == LL_SCULPT_TYPE_CYLINDER))
-                {
-                    x = 0;
-                }
+            // pinch?
+            pinch = pinch || (sculpt_stitching == LL_SCULPT_TYPE_SPHERE);
+        }
 
-                else
-                {
-                    x = sculpt_width - 1;
-                }
-            }
+        U32 x_pinch = sculpt_width / 2;
+        U32 row_index = y * sculpt_width * sculpt_components;
 
-            pt = sculpt_xy_to_vector(x, y, sculpt_width, sculpt_height, sculpt_components, sculpt_data);
+        // Run along the profile.
+        LLVector4a* row = mMesh.mArray + line;
+        for (S32 t = 0; t < sizeT; t++)
+        {
+            U32 x = pinch ? x_pinch : x_for_t[t];
+            LLVector4a& pt = row[t];
+
+            pt = sculpt_index_to_vector(row_index + x * sculpt_components, sculpt_data);
 
             if (sculpt_mirror)
             {
-                LLVector4a scale(-1.f,1,1,1);
-                pt.mul(scale);
+                pt.mul(mirror_scale);
             }
 
             llassert(pt.isFinite3());
@@ -3254,6 +3287,57 @@ void LLVolume::sculpt(U16 sculpt_width, U16 sculpt_height, S8 sculpt_components,
     mVolumeFaces.clear();
 
     createVolumeFaces();
+
+    if (sSculptLODSimplify && !data_is_empty && mDetail < SCULPT_SIMPLIFY_MAX_DETAIL)
+    {
+        sculptSimplifyFaces();
+    }
+}
+
+// Run the low-LOD faces of a sculpt through meshoptimizer to drop triangles
+// the grid-resolution reduction in sculpt_calc_mesh_resolution() leaves behind
+// (sculpt maps heavily oversample flat regions). Only the index list shrinks;
+// unreferenced vertices stay allocated, which keeps this a cheap in-place pass.
+void LLVolume::sculptSimplifyFaces()
+{
+    // halve triangle count at LOD1, quarter it at LOD0
+    F32 decimator = (mDetail <= (F32)SCULPT_MIN_AREA_DETAIL) ? 4.f : 2.f;
+
+    for (S32 i = 0; i < getNumVolumeFaces(); ++i)
+    {
+        LLVolumeFace& face = mVolumeFaces[i];
+
+        S32 target_indices = llmax(llfloor(face.mNumIndices / decimator) / 3 * 3, 3);
+        if (face.mNumIndices <= target_indices)
+        {
+            continue;
+        }
+
+        //pad like resizeIndices() so the QWORD copy below stays in bounds
+        U16* new_indices = (U16*)ll_aligned_malloc_16(((face.mNumIndices * sizeof(U16)) + 0xF) & ~0xF);
+        F32 result_error = 0.f;
+
+        S32 new_count = (S32)LLMeshOptimizer::simplify(
+            new_indices,
+            face.mIndices,
+            face.mNumIndices,
+            face.mPositions,
+            face.mNumVertices,
+            sizeof(LLVector4a),
+            target_indices,
+            SCULPT_SIMPLIFY_ERROR,
+            false, // sloppy
+            &result_error);
+
+        if (new_count >= 3 && new_count < face.mNumIndices)
+        {
+            LLVector4a::memcpyNonAliased16((F32*)face.mIndices, (F32*)new_indices,
+                                           ((new_count * sizeof(U16)) + 0xF) & ~0xF);
+            face.mNumIndices = new_count;
+        }
+
+        ll_aligned_free_16(new_indices);
+    }
 }
 
 
@@ -4367,6 +4451,108 @@ S32 LLVolume::lineSegmentIntersect(const LLVector4a& start, const LLVector4a& en
     return hit_face;
 }
 
+S32 LLVolume::lineSegmentBatchIntersect(LLVolumeOctreeRay* rays, S32 ray_count, S32 face)
+{
+    S32 start_face;
+    S32 end_face;
+
+    if (face == -1) // ALL_SIDES
+    {
+        start_face = 0;
+        end_face = getNumVolumeFaces() - 1;
+    }
+    else
+    {
+        start_face = face;
+        end_face = face;
+    }
+
+    end_face = llmin(end_face, getNumVolumeFaces()-1);
+
+    for (S32 i = start_face; i <= end_face; i++)
+    {
+        LLVolumeFace &face = mVolumeFaces[i];
+
+        if (isUnique())
+        { //don't bother with an octree for flexi volumes
+            LLVector4a box_center;
+            box_center.setAdd(face.mExtents[0], face.mExtents[1]);
+            box_center.mul(0.5f);
+
+            LLVector4a box_size;
+            box_size.setSub(face.mExtents[1], face.mExtents[0]);
+
+            //cull the batch against the face bounds once
+            std::vector<S32> active;
+            active.reserve(ray_count);
+            for (S32 r = 0; r < ray_count; ++r)
+            {
+                if (LLLineSegmentBoxIntersect(rays[r].mStart, rays[r].mEnd, box_center, box_size))
+                {
+                    active.push_back(r);
+                }
+            }
+
+            if (active.empty())
+            {
+                continue;
+            }
+
+            U32 tri_count = face.mNumIndices/3;
+
+            for (U32 j = 0; j < tri_count; ++j)
+            {
+                const LLVector4a& v0 = face.mPositions[face.mIndices[j*3+0]];
+                const LLVector4a& v1 = face.mPositions[face.mIndices[j*3+1]];
+                const LLVector4a& v2 = face.mPositions[face.mIndices[j*3+2]];
+
+                for (S32 r : active)
+                {
+                    LLVolumeOctreeRay& ray = rays[r];
+
+                    F32 a,b,t;
+
+                    if (LLTriangleRayIntersect(v0, v1, v2, ray.mStart, ray.mDir, a, b, t))
+                    {
+                        if ((t >= 0.f) &&          // if hit is after start
+                            (t <= 1.f) &&          // and before end
+                            (t < ray.mClosestT))   // and this hit is closer
+                        {
+                            ray.mClosestT = t;
+                            ray.mBaryA = a;
+                            ray.mBaryB = b;
+                            ray.mHitFace = i;
+                            ray.mHitTriangle = nullptr; // flexi path has no octree triangles
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            if (!face.getOctree())
+            {
+                face.createOctree();
+            }
+
+            //the root node's slab test culls rays that miss the face entirely
+            LLOctreeTriangleBatchIntersect intersect(rays, ray_count, i);
+            intersect.traverse(face.getOctree());
+        }
+    }
+
+    S32 hit_count = 0;
+    for (S32 r = 0; r < ray_count; ++r)
+    {
+        if (rays[r].mHitFace != -1)
+        {
+            ++hit_count;
+        }
+    }
+
+    return hit_count;
+}
+
 class LLVertexIndexPair
 {
 public:
@@ -42,6 +42,7 @@ class LLVolumeFace;
 class LLVolume;
 class LLVolumeTriangle;
 class LLVolumeOctree;
+class LLVolumeOctreeRay;
 
 #include "lluuid.h"
 #include "v4color.h"
@@ -1077,11 +1078,22 @@ public:
                              LLVector4a* tangent = nullptr           // return the surface tangent at the intersection point
         );
 
+    //intersect a whole batch of rays in one pass, amortizing octree traversal
+    //across the set.  Per-ray results (hit face, t, barycentrics) are left in
+    //the ray structs; returns the number of rays that hit anything.  Reads
+    //only const face data once octrees exist, so batches may run off-thread.
+    S32 lineSegmentBatchIntersect(LLVolumeOctreeRay* rays, S32 ray_count,
+                                  S32 face = -1);                    // which face to check, -1 = ALL_SIDES
+
     LLFaceID generateFaceMask();
 
     bool isFaceMaskValid(LLFaceID face_mask);
     static S32 sNumMeshPoints;
 
+    // When set, low-LOD sculpt faces are run through LLMeshOptimizer::simplify
+    // after generation to shed triangles the grid-resolution reduction can't.
+    static bool sSculptLODSimplify;
+
     friend std::ostream& operator<<(std::ostream &s, const LLVolume &volume);
     friend std::ostream& operator<<(std::ostream &s, const LLVolume *volumep);      // HACK to bypass Windoze confusion over
                                                                                 // conversion if *(LLVolume*) to LLVolume&
@@ -1108,6 +1120,7 @@ private:
     F32 sculptGetSurfaceArea();
     void sculptGenerateEmptyPlaceholder();
     void sculptGenerateSpherePlaceholder();
+    void sculptSimplifyFaces();
 
 protected:
     bool generate();
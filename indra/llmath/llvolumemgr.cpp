@@ -44,7 +44,8 @@ F32 LLVolumeLODGroup::mDetailScales[NUM_LODS] = {1.f, 1.5f, 2.5f, 4.f};
 //============================================================================
 
 LLVolumeMgr::LLVolumeMgr()
-:   mDataMutex(NULL)
+:   mCacheSize(0),
+    mDataMutex(NULL)
 {
     // the LLMutex magic interferes with easy unit testing,
     // so you now must manually call useMutex() to use it
@@ -78,6 +79,8 @@ bool LLVolumeMgr::cleanup()
         delete volgroupp;
     }
     mVolumeLODGroups.clear();
+    // cached groups live in mVolumeLODGroups too, so they're already deleted
+    mCachedGroups.clear();
     if (mDataMutex)
     {
         mDataMutex->unlock();
@@ -104,6 +107,12 @@ LLVolume* LLVolumeMgr::refVolume(const LLVolumeParams &volume_params, const S32
     else
     {
         volgroupp = iter->second;
+        if (volgroupp->isCached())
+        {
+            // a zero-ref group held in the retention cache is live again
+            mCachedGroups.remove(volgroupp);
+            volgroupp->setCached(false);
+        }
     }
     if (mDataMutex)
     {
@@ -161,8 +170,25 @@ void LLVolumeMgr::unrefVolume(LLVolume *volumep)
         volgroupp->derefLOD(volumep);
         if (volgroupp->getNumRefs() == 0)
         {
-            mVolumeLODGroups.erase(params);
-            delete volgroupp;
+            if (mCacheSize > 0)
+            {
+                // retain the generated LODs for a while in case this shape
+                // comes back into view
+                volgroupp->setCached(true);
+                mCachedGroups.push_front(volgroupp);
+                while (mCachedGroups.size() > mCacheSize)
+                {
+                    LLVolumeLODGroup* evicted = mCachedGroups.back();
+                    mCachedGroups.pop_back();
+                    mVolumeLODGroups.erase(evicted->getVolumeParams());
+                    delete evicted;
+                }
+            }
+            else
+            {
+                mVolumeLODGroups.erase(params);
+                delete volgroupp;
+            }
         }
     }
     if (mDataMutex)
@@ -210,6 +236,27 @@ void LLVolumeMgr::dump()
     LL_INFOS() << "Average usage of LODs " << avg << LL_ENDL;
 }
 
+void LLVolumeMgr::setCacheSize(U32 size)
+{
+    if (mDataMutex)
+    {
+        mDataMutex->lock();
+    }
+    mCacheSize = size;
+    // evict from the cold end if the new limit is smaller
+    while (mCachedGroups.size() > mCacheSize)
+    {
+        LLVolumeLODGroup* evicted = mCachedGroups.back();
+        mCachedGroups.pop_back();
+        mVolumeLODGroups.erase(evicted->getVolumeParams());
+        delete evicted;
+    }
+    if (mDataMutex)
+    {
+        mDataMutex->unlock();
+    }
+}
+
 void LLVolumeMgr::useMutex()
 {
     if (!mDataMutex)
@@ -247,7 +294,8 @@ std::ostream& operator<<(std::ostream& s, const LLVolumeMgr& volume_mgr)
 
 LLVolumeLODGroup::LLVolumeLODGroup(const LLVolumeParams &params)
     : mVolumeParams(params),
-      mRefs(0)
+      mRefs(0),
+      mCached(false)
 {
     for (S32 i = 0; i < NUM_LODS; i++)
     {
@@ -27,6 +27,7 @@
 #ifndef LL_LLVOLUMEMGR_H
 #define LL_LLVOLUMEMGR_H
 
+#include <list>
 #include <map>
 
 #include "llvolume.h"
@@ -59,6 +60,10 @@ public:
     bool derefLOD(LLVolume *volumep);
     S32 getNumRefs() const { return mRefs; }
 
+    // bookkeeping for LLVolumeMgr's zero-ref retention cache
+    bool isCached() const { return mCached; }
+    void setCached(bool cached) { mCached = cached; }
+
     const LLVolumeParams* getVolumeParams() const { return &mVolumeParams; };
 
     F32 dump();
@@ -73,6 +78,7 @@ protected:
     static F32 mDetailThresholds[NUM_LODS];
     static F32 mDetailScales[NUM_LODS];
     S32     mAccessCount[NUM_LODS];
+    bool    mCached;
 };
 
 class LLVolumeMgr
@@ -90,6 +96,11 @@ public:
     virtual LLVolume *refVolume(const LLVolumeParams &volume_params, const S32 detail);
     virtual void unrefVolume(LLVolume *volumep);
 
+    // Retain up to this many zero-reference LOD groups (most recently
+    // released first) so shapes that come back into view don't re-tessellate.
+    // 0 (the default) deletes groups as soon as they are unreferenced.
+    void setCacheSize(U32 size);
+
     void dump();
 
     // manually call this for mutex magic
@@ -106,6 +117,12 @@ protected:
     typedef std::map<const LLVolumeParams*, LLVolumeLODGroup*, LLVolumeParams::compare> volume_lod_group_map_t;
     volume_lod_group_map_t mVolumeLODGroups;
 
+    // zero-ref groups retained for reuse, most recently released first;
+    // entries also remain in mVolumeLODGroups so refVolume() can find them
+    typedef std::list<LLVolumeLODGroup*> cached_group_list_t;
+    cached_group_list_t mCachedGroups;
+    U32 mCacheSize;
+
     LLMutex* mDataMutex;
 };
 
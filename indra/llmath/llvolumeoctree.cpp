@@ -204,6 +204,86 @@ void LLOctreeTriangleRayIntersect::visit(const LLOctreeNode<LLVolumeTriangle, LL
     }
 }
 
+LLOctreeTriangleBatchIntersect::LLOctreeTriangleBatchIntersect(LLVolumeOctreeRay* rays, S32 ray_count, S32 face_index)
+    : mRays(rays),
+      mFaceIndex(face_index),
+      mBegin(0),
+      mEnd(ray_count)
+{
+    mActive.reserve(ray_count * 2);
+    for (S32 i = 0; i < ray_count; ++i)
+    {
+        mActive.push_back(i);
+    }
+}
+
+void LLOctreeTriangleBatchIntersect::traverse(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* node)
+{
+    LLVolumeOctreeListener* vl = (LLVolumeOctreeListener*) node->getListener(0);
+
+    size_t parent_begin = mBegin;
+    size_t parent_end = mEnd;
+    size_t child_begin = mActive.size();
+
+    //append the subset of the parent's active rays that touch this node
+    for (size_t i = parent_begin; i < parent_end; ++i)
+    {
+        const LLVolumeOctreeRay& ray = mRays[mActive[i]];
+        if (LLLineSegmentBoxIntersect(ray.mStart, ray.mEnd, vl->mBounds[0], vl->mBounds[1]))
+        {
+            mActive.push_back(mActive[i]);
+        }
+    }
+
+    if (mActive.size() > child_begin)
+    {
+        mBegin = child_begin;
+        mEnd = mActive.size();
+
+        node->accept(this);
+        for (U32 i = 0; i < node->getChildCount(); ++i)
+        {
+            traverse(node->getChild(i));
+        }
+
+        mBegin = parent_begin;
+        mEnd = parent_end;
+    }
+
+    mActive.resize(child_begin);
+}
+
+void LLOctreeTriangleBatchIntersect::visit(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* node)
+{
+    for (typename LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>::const_element_iter iter =
+            node->getDataBegin(); iter != node->getDataEnd(); ++iter)
+    { //triangle is the outer loop so its vertices stay hot across the batch
+        const LLVolumeTriangle* tri = *iter;
+
+        for (size_t i = mBegin; i < mEnd; ++i)
+        {
+            LLVolumeOctreeRay& ray = mRays[mActive[i]];
+
+            F32 a, b, t;
+
+            if (LLTriangleRayIntersect(*tri->mV[0], *tri->mV[1], *tri->mV[2],
+                    ray.mStart, ray.mDir, a, b, t))
+            {
+                if ((t >= 0.f) &&          // if hit is after start
+                    (t <= 1.f) &&          // and before end
+                    (t < ray.mClosestT))   // and this hit is closer
+                {
+                    ray.mClosestT = t;
+                    ray.mBaryA = a;
+                    ray.mBaryB = b;
+                    ray.mHitFace = mFaceIndex;
+                    ray.mHitTriangle = tri;
+                }
+            }
+        }
+    }
+}
+
 const LLVector4a& LLVolumeTriangle::getPositionGroup() const
 {
     return mPositionGroup;
@@ -128,6 +128,75 @@ public:
     virtual void visit(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* node);
 };
 
+// One ray in a batched octree query.  Inputs are in volume space like
+// LLVolume::lineSegmentIntersect(); results are left in place after the
+// traversal.  Callers wanting interpolated attributes can fetch them from
+// mHitTriangle's indices with the stored barycentric coordinates.
+class alignas(16) LLVolumeOctreeRay
+{
+    LL_ALIGN_NEW
+public:
+    LLVolumeOctreeRay() = default;
+    LLVolumeOctreeRay(const LLVector4a& start, const LLVector4a& end)
+    {
+        set(start, end);
+    }
+
+    void set(const LLVector4a& start, const LLVector4a& end)
+    {
+        mStart = start;
+        mEnd = end;
+        mDir.setSub(end, start);
+        mClosestT = 2.f; // must be larger than 1
+        mBaryA = 0.f;
+        mBaryB = 0.f;
+        mHitFace = -1;
+        mHitTriangle = nullptr;
+    }
+
+    // intersection point of the nearest hit (only valid when mHitFace != -1)
+    void getIntersection(LLVector4a& pos) const
+    {
+        pos = mDir;
+        pos.mul(mClosestT);
+        pos.add(mStart);
+    }
+
+    LL_ALIGN_16(LLVector4a mStart);
+    LL_ALIGN_16(LLVector4a mEnd);
+    LL_ALIGN_16(LLVector4a mDir); // end - start
+
+    //results
+    F32 mClosestT;  // fraction along [start, end] of the nearest hit
+    F32 mBaryA;     // barycentric coordinates of the hit on mHitTriangle
+    F32 mBaryB;
+    S32 mHitFace;   // index of the face containing the nearest hit, -1 = miss
+    const LLVolumeTriangle* mHitTriangle = nullptr;
+};
+
+// Intersects a whole set of rays in one octree traversal.  Each node's slab
+// test runs only against rays that passed every enclosing node, so the
+// traversal cost is amortized across the batch instead of being paid per ray.
+class LLOctreeTriangleBatchIntersect : public LLOctreeTraveler<LLVolumeTriangle, LLVolumeTriangle*>
+{
+public:
+    LLOctreeTriangleBatchIntersect(LLVolumeOctreeRay* rays, S32 ray_count, S32 face_index);
+
+    void traverse(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* node);
+
+    virtual void visit(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* node);
+
+private:
+    LLVolumeOctreeRay* mRays;
+    S32 mFaceIndex;
+
+    // indices of rays that passed the slab test of every enclosing node;
+    // [mBegin, mEnd) is the active window for the node being traversed
+    std::vector<S32> mActive;
+    size_t mBegin;
+    size_t mEnd;
+};
+
 class LLVolumeOctreeValidate : public LLOctreeTraveler<LLVolumeTriangle, LLVolumeTriangle*>
 {
     virtual void visit(const LLOctreeNode<LLVolumeTriangle, LLVolumeTriangle*>* branch);
@@ -409,6 +409,10 @@ void LLAssetStorage::_cleanupRequests(bool all, S32 error)
 
                 timed_out.push_front(tmp);
                 iter = requests->erase(curiter);
+                if (RT_DOWNLOAD == rt)
+                {
+                    untrackPendingDownload(tmp->getUUID());
+                }
             }
         }
     }
@@ -441,6 +445,25 @@ bool LLAssetStorage::hasLocalAsset(const LLUUID &uuid, const LLAssetType::EType
     return LLFileSystem::getExists(uuid, type);
 }
 
+void LLAssetStorage::trackPendingDownload(const LLUUID& uuid)
+{
+    ++mPendingDownloadCounts[uuid];
+}
+
+void LLAssetStorage::untrackPendingDownload(const LLUUID& uuid)
+{
+    pending_dl_count_t::iterator it = mPendingDownloadCounts.find(uuid);
+    if (it != mPendingDownloadCounts.end() && --it->second <= 0)
+    {
+        mPendingDownloadCounts.erase(it);
+    }
+}
+
+bool LLAssetStorage::hasPendingDownload(const LLUUID& uuid) const
+{
+    return mPendingDownloadCounts.find(uuid) != mPendingDownloadCounts.end();
+}
+
 bool LLAssetStorage::findInCacheAndInvokeCallback(const LLUUID& uuid, LLAssetType::EType type,
                                                       LLGetAssetCallback callback, void *user_data)
 {
@@ -552,24 +575,28 @@ void LLAssetStorage::getAssetData(const LLUUID uuid,
 
         bool duplicate = false;
         LL_PROFILE_ZONE_NAMED("gad - check pending downloads");
-        // check to see if there's a pending download of this uuid already
-        for (request_list_t::iterator iter = mPendingDownloads.begin();
-             iter != mPendingDownloads.end(); ++iter )
+        // check to see if there's a pending download of this uuid already;
+        // the index lets the common nothing-in-flight case skip the walk
+        if (hasPendingDownload(uuid))
         {
-            LLAssetRequest  *tmp = *iter;
-            if ((type == tmp->getType()) && (uuid == tmp->getUUID()))
+            for (request_list_t::iterator iter = mPendingDownloads.begin();
+                 iter != mPendingDownloads.end(); ++iter )
             {
-                if (callback == tmp->mDownCallback && user_data == tmp->mUserData)
+                LLAssetRequest  *tmp = *iter;
+                if ((type == tmp->getType()) && (uuid == tmp->getUUID()))
                 {
-                    // this is a duplicate from the same subsystem - throw it away
-                    LL_WARNS("AssetStorage") << "Discarding duplicate request for asset " << uuid
-                                             << "." << LLAssetType::lookup(type) << LL_ENDL;
-                    return;
+                    if (callback == tmp->mDownCallback && user_data == tmp->mUserData)
+                    {
+                        // this is a duplicate from the same subsystem - throw it away
+                        LL_WARNS("AssetStorage") << "Discarding duplicate request for asset " << uuid
+                                                 << "." << LLAssetType::lookup(type) << LL_ENDL;
+                        return;
+                    }
+
+                    // this is a duplicate request
+                    // queue the request, but don't actually ask for it again
+                    duplicate = true;
                 }
-
-                // this is a duplicate request
-                // queue the request, but don't actually ask for it again
-                duplicate = true;
             }
         }
         if (duplicate)
@@ -600,6 +627,7 @@ void LLAssetStorage::removeAndCallbackPendingDownloads(const LLUUID& file_id, LL
         {
             requests.push_front(tmp);
             iter = gAssetStorage->mPendingDownloads.erase(curiter);
+            gAssetStorage->untrackPendingDownload(file_id);
         }
     }
     for (request_list_t::iterator iter = requests.begin();
@@ -1280,6 +1308,10 @@ bool LLAssetStorage::deletePendingRequestImpl(LLAssetStorage::request_list_t* re
     {
         // Remove the request from this list.
         requests->remove(req);
+        if (requests == &mPendingDownloads)
+        {
+            untrackPendingDownload(asset_id);
+        }
         S32 error = LL_ERR_TCP_TIMEOUT;
         // Run callbacks.
         if (req->mUpCallback)
@@ -1354,22 +1386,25 @@ void LLAssetStorage::getAssetData(const LLUUID uuid,
                                   bool is_priority)
 {
     // check for duplicates here, since we're about to fool the normal duplicate checker
-    for (request_list_t::iterator iter = mPendingDownloads.begin();
-         iter != mPendingDownloads.end();  )
+    if (hasPendingDownload(uuid))
     {
-        LLAssetRequest* tmp = *iter++;
+        for (request_list_t::iterator iter = mPendingDownloads.begin();
+             iter != mPendingDownloads.end();  )
+        {
+            LLAssetRequest* tmp = *iter++;
 
-        auto cbptr = tmp->mDownCallback.target<void(*)(const LLUUID &, LLAssetType::EType, void *, S32, LLExtStat)>();
+            auto cbptr = tmp->mDownCallback.target<void(*)(const LLUUID &, LLAssetType::EType, void *, S32, LLExtStat)>();
 
-        if (type == tmp->getType() &&
-            uuid == tmp->getUUID() &&
-            (cbptr && (*cbptr == legacyGetDataCallback)) &&
-            callback == ((LLLegacyAssetRequest *)tmp->mUserData)->mDownCallback &&
-            user_data == ((LLLegacyAssetRequest *)tmp->mUserData)->mUserData)
-        {
-            // this is a duplicate from the same subsystem - throw it away
-            LL_DEBUGS("AssetStorage") << "Discarding duplicate request for UUID " << uuid << LL_ENDL;
-            return;
+            if (type == tmp->getType() &&
+                uuid == tmp->getUUID() &&
+                (cbptr && (*cbptr == legacyGetDataCallback)) &&
+                callback == ((LLLegacyAssetRequest *)tmp->mUserData)->mDownCallback &&
+                user_data == ((LLLegacyAssetRequest *)tmp->mUserData)->mUserData)
+            {
+                // this is a duplicate from the same subsystem - throw it away
+                LL_DEBUGS("AssetStorage") << "Discarding duplicate request for UUID " << uuid << LL_ENDL;
+                return;
+            }
         }
     }
 
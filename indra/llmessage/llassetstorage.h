@@ -29,6 +29,7 @@
 #define LL_LLASSETSTORAGE_H
 #include <string>
 #include <functional>
+#include <unordered_map>
 
 #include "lluuid.h"
 #include "lltimer.h"
@@ -221,6 +222,12 @@ protected:
     request_list_t mPendingUploads;
     request_list_t mPendingLocalUploads;
 
+    // Per-id count of entries in mPendingDownloads so getAssetData can skip
+    // the duplicate list walk when nothing is in flight for an id, which is
+    // the overwhelmingly common case.
+    typedef std::unordered_map<LLUUID, S32> pending_dl_count_t;
+    pending_dl_count_t mPendingDownloadCounts;
+
     // Map of toxic assets - these caused problems when recently rezzed, so avoid them
     toxic_asset_map_t   mToxicAssetMap;     // Objects in this list are known to cause problems and are not loaded
 
@@ -292,6 +299,11 @@ protected:
                                   LLAssetType::EType asset_type,
                                   const LLUUID& asset_id);
 
+    // Keep mPendingDownloadCounts in step with mPendingDownloads.
+    void trackPendingDownload(const LLUUID& uuid);
+    void untrackPendingDownload(const LLUUID& uuid);
+    bool hasPendingDownload(const LLUUID& uuid) const;
+
 public:
     static const LLAssetRequest* findRequest(const request_list_t* requests,
                                         LLAssetType::EType asset_type,
@@ -357,54 +357,63 @@ void LLAvatarNameCache::requestNamesViaCapability()
     static const U32 NAME_URL_MAX = 4096;
     static const U32 NAME_URL_SEND_THRESHOLD = 3500;
 
-    std::string url;
-    url.reserve(NAME_URL_MAX);
+    // One URL holds roughly 90 ids.  A deep backlog (cold start in a busy
+    // region) would otherwise drain at a single request per timer expiry,
+    // so issue several batches per call -- but cap how many coroutines a
+    // single call puts in flight.
+    static const U32 MAX_BATCHES_PER_REQUEST = 8;
 
-    std::vector<LLUUID> agent_ids;
-    agent_ids.reserve(128);
-
-    U32 ids = 0;
-    ask_queue_t::const_iterator it;
-    while(!mAskQueue.empty())
+    for (U32 batch = 0; batch < MAX_BATCHES_PER_REQUEST && !mAskQueue.empty(); ++batch)
     {
-        it = mAskQueue.begin();
-        LLUUID agent_id = *it;
-        mAskQueue.erase(it);
+        std::string url;
+        url.reserve(NAME_URL_MAX);
 
-        if (url.empty())
-        {
-            // ...starting new request
-            url += mNameLookupURL;
-            url += "?ids=";
-            ids = 1;
-        }
-        else
+        std::vector<LLUUID> agent_ids;
+        agent_ids.reserve(128);
+
+        U32 ids = 0;
+        ask_queue_t::const_iterator it;
+        while(!mAskQueue.empty())
         {
-            // ...continuing existing request
-            url += "&ids=";
-            ids++;
-        }
-        url += agent_id.asString();
-        agent_ids.push_back(agent_id);
+            it = mAskQueue.begin();
+            LLUUID agent_id = *it;
+            mAskQueue.erase(it);
 
-        // mark request as pending
-        mPendingQueue[agent_id] = now;
+            if (url.empty())
+            {
+                // ...starting new request
+                url += mNameLookupURL;
+                url += "?ids=";
+                ids = 1;
+            }
+            else
+            {
+                // ...continuing existing request
+                url += "&ids=";
+                ids++;
+            }
+            url += agent_id.asString();
+            agent_ids.push_back(agent_id);
 
-        if (url.size() > NAME_URL_SEND_THRESHOLD)
-        {
-            break;
+            // mark request as pending
+            mPendingQueue[agent_id] = now;
+
+            if (url.size() > NAME_URL_SEND_THRESHOLD)
+            {
+                break;
+            }
         }
-    }
 
-    if (!url.empty())
-    {
-        LL_DEBUGS("AvNameCache") << "requested " << ids << " ids" << LL_ENDL;
+        if (!url.empty())
+        {
+            LL_DEBUGS("AvNameCache") << "requested " << ids << " ids" << LL_ENDL;
 
-        std::string coroname =
-            LLCoros::instance().launch("LLAvatarNameCache::requestAvatarNameCache_",
-            boost::bind(&LLAvatarNameCache::requestAvatarNameCache_, url, agent_ids));
-        LL_DEBUGS("AvNameCache") << coroname << " with  url '" << url << "', agent_ids.size()=" << agent_ids.size() << LL_ENDL;
+            std::string coroname =
+                LLCoros::instance().launch("LLAvatarNameCache::requestAvatarNameCache_",
+                boost::bind(&LLAvatarNameCache::requestAvatarNameCache_, url, agent_ids));
+            LL_DEBUGS("AvNameCache") << coroname << " with  url '" << url << "', agent_ids.size()=" << agent_ids.size() << LL_ENDL;
 
+        }
     }
 }
 
@@ -466,9 +475,11 @@ void LLAvatarNameCache::requestNamesViaLegacy()
 bool LLAvatarNameCache::importFile(std::istream& istr)
 {
     LLSD data;
-    if (LLSDParser::PARSE_FAILURE == LLSDSerialize::fromXMLDocument(data, istr))
+    // The cache is written as binary LLSD these days; deserialize() sniffs
+    // the header, so XML caches from older viewers still load.
+    if (!LLSDSerialize::deserialize(data, istr, LLSDSerialize::SIZE_UNLIMITED))
     {
-        LL_WARNS("AvNameCache") << "avatar name cache data xml parse failed" << LL_ENDL;
+        LL_WARNS("AvNameCache") << "avatar name cache data parse failed" << LL_ENDL;
         return false;
     }
 
@@ -513,7 +524,9 @@ void LLAvatarNameCache::exportFile(std::ostream& ostr)
     LL_INFOS("AvNameCache") << "LLAvatarNameCache returning " << agents.size() << LL_ENDL;
     LLSD data;
     data["agents"] = agents;
-    LLSDSerialize::toPrettyXML(data, ostr);
+    // Binary LLSD parses far faster than XML, and cold-start name resolution
+    // is gated on this file being loaded.
+    LLSDSerialize::serialize(data, ostr, LLSDSerialize::LLSD_BINARY);
 }
 
 void LLAvatarNameCache::setNameLookupURL(const std::string& name_lookup_url)
@@ -660,6 +673,46 @@ bool LLAvatarNameCache::getName(const LLUUID& agent_id, LLAvatarName *av_name)
     return false;
 }
 
+//static, wrapper
+const LLAvatarName* LLAvatarNameCache::getCached(const LLUUID& agent_id)
+{
+    return LLAvatarNameCache::getInstance()->findCachedName(agent_id);
+}
+// returns a pointer to the cached name if one exists (even if expired),
+// queueing a fetch or refresh exactly as getName() does; unlike getName()
+// it never copies the name, which matters for per-frame callers
+const LLAvatarName* LLAvatarNameCache::findCachedName(const LLUUID& agent_id)
+{
+    if (mRunning)
+    {
+        // ...only do immediate lookups when cache is running
+        cache_t::const_iterator it = mCache.find(agent_id);
+        if (it != mCache.end())
+        {
+            const LLAvatarName& av_name = it->second;
+
+            // re-request name if entry is expired
+            if (av_name.mExpires < LLFrameTimer::getTotalSeconds()
+                && !isRequestPending(agent_id))
+            {
+                LL_DEBUGS("AvNameCache") << "LLAvatarNameCache refresh agent " << agent_id
+                                         << LL_ENDL;
+                mAskQueue.insert(agent_id);
+            }
+
+            return &av_name;
+        }
+    }
+
+    if (!isRequestPending(agent_id))
+    {
+        LL_DEBUGS("AvNameCache") << "LLAvatarNameCache queue request for agent " << agent_id << LL_ENDL;
+        mAskQueue.insert(agent_id);
+    }
+
+    return nullptr;
+}
+
 void LLAvatarNameCache::fireSignal(const LLUUID& agent_id,
                                    const callback_slot_t& slot,
                                    const LLAvatarName& av_name)
@@ -67,6 +67,14 @@ public:
     static bool get(const LLUUID& agent_id, LLAvatarName *av_name);
     bool getName(const LLUUID& agent_id, LLAvatarName *av_name);
 
+    // Fast path for high-frequency callers (chat, name tags): returns a
+    // pointer into the cache if the name is known, nullptr otherwise.
+    // Queues a fetch or refresh just like get(), but never copies the name
+    // and never touches the callback machinery.  The pointer is only valid
+    // until the next cache update, so use it immediately.
+    static const LLAvatarName* getCached(const LLUUID& agent_id);
+    const LLAvatarName* findCachedName(const LLUUID& agent_id);
+
     // Callback types for get() below
     typedef boost::signals2::signal<
         void (const LLUUID& agent_id, const LLAvatarName& av_name)>
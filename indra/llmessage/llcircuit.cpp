@@ -87,6 +87,8 @@ LLCircuitData::LLCircuitData(const LLHost &host, TPACKETID in_id,
     mPingDelayAveraged(INITIAL_PING_VALUE_MSEC),
     mUnackedPacketCount(0),
     mUnackedPacketBytes(0),
+    mResendWheelSlot(0),
+    mResendWheelTime(0.0),
     mLastPacketInTime(0.0),
     mLocalEndPointID(),
     mPacketsOut(0),
@@ -119,6 +121,7 @@ LLCircuitData::LLCircuitData(const LLHost &host, TPACKETID in_id,
     mLastPingReceivedTime = mt_sec;
     mNextPingSendTime = mLastPingSendTime + 0.95*mHeartbeatInterval + F32Seconds(ll_frand(0.1f*mHeartbeatInterval.value()));
     mPeriodTime = mt_sec;
+    mResendWheelTime = mt_sec + LL_RESEND_WHEEL_SLOT_TIME;
 
     mLocalEndPointID.generate();
 }
@@ -269,11 +272,23 @@ void LLCircuitData::ackReliablePacket(TPACKETID packet_num)
 
 
 
+// Drop a reliable packet's ID into the wheel bucket covering its expiration
+// time.  Always files at least one slot ahead, so nothing lands in the bucket
+// currently being processed; a deadline can fire up to one slot late, which
+// is well inside the noise for timeouts that start at a second.
+void LLCircuitData::scheduleResend(TPACKETID packet_id, F64Seconds expiration)
+{
+    F64Seconds dt = expiration - mResendWheelTime;
+    S32 slots_ahead = 1 + llmax(S32(0), S32(dt.value() / LL_RESEND_WHEEL_SLOT_TIME.value()));
+    slots_ahead = llmin(slots_ahead, LL_RESEND_WHEEL_SLOTS - 1);
+    mResendWheel[(mResendWheelSlot + slots_ahead) % LL_RESEND_WHEEL_SLOTS].push_back(packet_id);
+}
+
+
 S32 LLCircuitData::resendUnackedPackets(const F64Seconds now)
 {
     LLReliablePacket *packetp;
 
-
     //
     // Theoretically we should search through the list for the packet with the oldest
     // packet ID, as otherwise when we WRAP we will resend reliable packets out of order.
@@ -281,54 +296,120 @@ S32 LLCircuitData::resendUnackedPackets(const F64Seconds now)
     // I'm not going to worry about this for now - djs
     //
 
+    // Turn the retransmission wheel up to the present, processing only the
+    // buckets that have come due.  Pending packets whose deadline is still in
+    // the future never get touched, so per-frame cost scales with packets
+    // actually due for a resend rather than with the whole unacked list.
+    // scratch vector is static: the message system is strictly main thread,
+    // and this runs for every circuit every frame.
+    static std::vector<TPACKETID> due;
     reliable_iter iter;
     bool have_resend_overflow = false;
-    for (iter = mUnackedPackets.begin(); iter != mUnackedPackets.end();)
+    bool stalled = false;
+    while (!stalled && now >= mResendWheelTime)
     {
-        packetp = iter->second;
-
-        // Only check overflow if we haven't had one yet.
-        if (!have_resend_overflow)
+        due.resize(0);
+        mResendWheel[mResendWheelSlot].swap(due);
+        for (size_t i = 0; i < due.size(); ++i)
         {
-            have_resend_overflow = mThrottles.checkOverflow(TC_RESEND, 0);
-        }
+            TPACKETID packet_id = due[i];
+            iter = mUnackedPackets.find(packet_id);
+            if (iter == mUnackedPackets.end())
+            {
+                // Not awaiting a resend; maybe it's awaiting its final abort.
+                iter = mFinalRetryPackets.find(packet_id);
+                if (iter == mFinalRetryPackets.end())
+                {
+                    // Acked since this entry was filed; stale, skip it.
+                    continue;
+                }
+                packetp = iter->second;
+                if (now < packetp->mExpirationTime)
+                {
+                    // Rescheduled since filing; file again under the new deadline.
+                    scheduleResend(packet_id, packetp->mExpirationTime);
+                    continue;
+                }
 
-        if (have_resend_overflow)
-        {
-            // We've exceeded our bandwidth for resends.
-            // Time to stop trying to send them.
+                // fail (too many retries)
+                //LL_INFOS() << "Packet " << packetp->mPacketID << " removed from the pending list: exceeded retry limit" << LL_ENDL;
+                //if (packetp->mMessageName)
+                //{
+                //  LL_INFOS() << "Packet name " << packetp->mMessageName << LL_ENDL;
+                //}
+                gMessageSystem->mFailedResendPackets++;
 
-            // If we have too many unacked packets, we need to start dropping expired ones.
-            if (mUnackedPacketBytes > 512000)
-            {
-                if (now > packetp->mExpirationTime)
+                if(gMessageSystem->mVerboseLog)
                 {
-                    // This circuit has overflowed.  Do not retry.  Do not pass go.
-                    packetp->mRetries = 0;
-                    // Remove it from this list and add it to the final list.
-                    mUnackedPackets.erase(iter++);
-                    mFinalRetryPackets[packetp->mPacketID] = packetp;
+                    std::ostringstream str;
+                    str << "MSG: -> " << packetp->mHost << "\tABORTING RELIABLE:\t"
+                        << packetp->mPacketID;
+                    LL_INFOS() << str.str() << LL_ENDL;
                 }
-                else
+
+                if (packetp->mCallback)
                 {
-                    ++iter;
+                    packetp->mCallback(packetp->mCallbackData,LL_ERR_TCP_TIMEOUT);
                 }
-                // Move on to the next unacked packet.
+
+                // Update stats
+                mUnackedPacketCount--;
+                mUnackedPacketBytes -= packetp->mBufferLength;
+
+                mFinalRetryPackets.erase(iter);
+                delete packetp;
                 continue;
             }
 
-            if (mUnackedPacketBytes > 256000 && !(getPacketsOut() % 1024))
+            packetp = iter->second;
+            if (now < packetp->mExpirationTime)
             {
-                // Warn if we've got a lot of resends waiting.
-                LL_WARNS() << mHost << " has " << mUnackedPacketBytes
-                        << " bytes of reliable messages waiting" << LL_ENDL;
+                // An earlier resend pushed the deadline out after this entry
+                // was filed; file again under the new deadline.
+                scheduleResend(packet_id, packetp->mExpirationTime);
+                continue;
+            }
+
+            // Only check overflow if we haven't had one yet.
+            if (!have_resend_overflow)
+            {
+                have_resend_overflow = mThrottles.checkOverflow(TC_RESEND, 0);
+            }
+
+            if (have_resend_overflow)
+            {
+                // We've exceeded our bandwidth for resends.
+                // Time to stop trying to send them.
+
+                // If we have too many unacked packets, we need to start dropping expired ones.
+                if (mUnackedPacketBytes > 512000)
+                {
+                    // This circuit has overflowed.  Do not retry.  Do not pass go.
+                    packetp->mRetries = 0;
+                    // Remove it from this list and add it to the final list,
+                    // where the next due slot aborts it.
+                    mUnackedPackets.erase(iter);
+                    mFinalRetryPackets[packet_id] = packetp;
+                    scheduleResend(packet_id, packetp->mExpirationTime);
+                    // Move on to the next due packet.
+                    continue;
+                }
+
+                if (mUnackedPacketBytes > 256000 && !(getPacketsOut() % 1024))
+                {
+                    // Warn if we've got a lot of resends waiting.
+                    LL_WARNS() << mHost << " has " << mUnackedPacketBytes
+                            << " bytes of reliable messages waiting" << LL_ENDL;
+                }
+                // Stop resending.  There are less than 512000 unacked packets.
+                // Put the unprocessed remainder back in this bucket and hold
+                // the wheel here; next frame picks up where we stopped.
+                mResendWheel[mResendWheelSlot].insert(mResendWheel[mResendWheelSlot].end(),
+                                                      due.begin() + i, due.end());
+                stalled = true;
+                break;
             }
-            // Stop resending.  There are less than 512000 unacked packets.
-            break;
-        }
 
-        if (now > packetp->mExpirationTime)
-        {
             packetp->mRetries--;
 
             // retry
@@ -366,59 +447,17 @@ S32 LLCircuitData::resendUnackedPackets(const F64Seconds now)
             if (!packetp->mRetries)
             {
                 // Last resend, remove it from this list and add it to the final list.
-                mUnackedPackets.erase(iter++);
-                mFinalRetryPackets[packetp->mPacketID] = packetp;
+                mUnackedPackets.erase(iter);
+                mFinalRetryPackets[packet_id] = packetp;
             }
-            else
-            {
-                // Don't remove it yet, it still gets to try to resend at least once.
-                ++iter;
-            }
-        }
-        else
-        {
-            // Don't need to do anything with this packet, keep iterating.
-            ++iter;
+            // File under the new deadline, whichever list it's on now.
+            scheduleResend(packet_id, packetp->mExpirationTime);
         }
-    }
 
-
-    for (iter = mFinalRetryPackets.begin(); iter != mFinalRetryPackets.end();)
-    {
-        packetp = iter->second;
-        if (now > packetp->mExpirationTime)
-        {
-            // fail (too many retries)
-            //LL_INFOS() << "Packet " << packetp->mPacketID << " removed from the pending list: exceeded retry limit" << LL_ENDL;
-            //if (packetp->mMessageName)
-            //{
-            //  LL_INFOS() << "Packet name " << packetp->mMessageName << LL_ENDL;
-            //}
-            gMessageSystem->mFailedResendPackets++;
-
-            if(gMessageSystem->mVerboseLog)
-            {
-                std::ostringstream str;
-                str << "MSG: -> " << packetp->mHost << "\tABORTING RELIABLE:\t"
-                    << packetp->mPacketID;
-                LL_INFOS() << str.str() << LL_ENDL;
-            }
-
-            if (packetp->mCallback)
-            {
-                packetp->mCallback(packetp->mCallbackData,LL_ERR_TCP_TIMEOUT);
-            }
-
-            // Update stats
-            mUnackedPacketCount--;
-            mUnackedPacketBytes -= packetp->mBufferLength;
-
-            mFinalRetryPackets.erase(iter++);
-            delete packetp;
-        }
-        else
+        if (!stalled)
         {
-            ++iter;
+            mResendWheelSlot = (mResendWheelSlot + 1) % LL_RESEND_WHEEL_SLOTS;
+            mResendWheelTime += LL_RESEND_WHEEL_SLOT_TIME;
         }
     }
 
@@ -579,6 +618,7 @@ void LLCircuitData::addReliablePacket(S32 mSocket, U8 *buf_ptr, S32 buf_len, LLR
     {
         mFinalRetryPackets[packet_info->mPacketID] = packet_info;
     }
+    scheduleResend(packet_info->mPacketID, packet_info->mExpirationTime);
 }
 
 
@@ -1095,6 +1135,11 @@ void LLCircuit::sendAcks(F32 collect_time)
     {
         circuit_data_map::iterator cur_it = it++;
         cd = (*cur_it).second;
+        // Collapse duplicate IDs before flushing: under loss the same
+        // reliable packet can be re-received (and collected for ack) several
+        // times within the collect window, and one ack covers all of them.
+        std::sort(cd->mAcks.begin(), cd->mAcks.end());
+        cd->mAcks.erase(std::unique(cd->mAcks.begin(), cd->mAcks.end()), cd->mAcks.end());
         S32 count = (S32)cd->mAcks.size();
         F32 age = cd->getAgeInSeconds() - cd->mAckCreationTime;
         if (age > collect_time || count == 0)
@@ -62,6 +62,11 @@ const S32 LL_MAX_RESENT_PACKETS_PER_FRAME = 100;
 const S32 LL_MAX_ACKED_PACKETS_PER_FRAME = 200;
 const F32 LL_COLLECT_ACK_TIME_MAX = 2.f;
 
+// Retransmission timer wheel geometry.  Slots x slot time gives the horizon;
+// deadlines beyond it park in the last slot and recirculate until due.
+const S32 LL_RESEND_WHEEL_SLOTS = 128;
+const F32Seconds LL_RESEND_WHEEL_SLOT_TIME(0.1f);
+
 //
 // Prototypes and Predefines
 //
@@ -176,6 +181,7 @@ protected:
     bool            updateWatchDogTimers(LLMessageSystem *msgsys);  // Return false if the circuit is dead and should be cleaned up
 
     void            addReliablePacket(S32 mSocket, U8 *buf_ptr, S32 buf_len, LLReliablePacketParams *params);
+    void            scheduleResend(TPACKETID packet_id, F64Seconds expiration);
     bool            isDuplicateResend(TPACKETID packetnum);
     // Call this method when a reliable message comes in - this will
     // correctly place the packet in the correct list to be acked
@@ -246,6 +252,16 @@ protected:
     reliable_map                            mUnackedPackets;
     reliable_map                            mFinalRetryPackets;
 
+    // Retransmission timer wheel.  Outstanding reliable packets are bucketed
+    // by expiration time, so resendUnackedPackets() only examines the buckets
+    // that have come due instead of walking the whole unacked map each frame.
+    // Entries are just packet IDs, revalidated against the packet's actual
+    // expiration when their bucket fires -- stale entries (packets acked or
+    // rescheduled since filing) are skipped.
+    std::vector<TPACKETID>                  mResendWheel[LL_RESEND_WHEEL_SLOTS];
+    S32                                     mResendWheelSlot;
+    F64Seconds                              mResendWheelTime;   // time at which mResendWheelSlot's bucket ends
+
     S32                                     mUnackedPacketCount;
     S32                                     mUnackedPacketBytes;
 
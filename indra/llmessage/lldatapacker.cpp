@@ -348,6 +348,68 @@ bool LLDataPackerBinaryBuffer::unpackBinaryDataFixed(U8 *value, S32 size, const
 }
 
 
+bool LLDataPackerBinaryBuffer::unpackBinaryDataView(U8 *&value, S32 &size, const char *name)
+{
+    if (!verifyLength(4, name))
+    {
+        LL_WARNS() << "LLDataPackerBinaryBuffer::unpackBinaryDataView would unpack invalid data, aborting!" << LL_ENDL;
+        return false;
+    }
+
+    htolememcpy(&size, mCurBufferp, MVT_S32, 4);
+
+    if (size < 0)
+    {
+        LL_WARNS() << "LLDataPackerBinaryBuffer::unpackBinaryDataView unpacked invalid size, aborting!" << LL_ENDL;
+        return false;
+    }
+
+    mCurBufferp += 4;
+
+    if (!verifyLength(size, name))
+    {
+        LL_WARNS() << "LLDataPackerBinaryBuffer::unpackBinaryDataView would unpack invalid data, aborting!" << LL_ENDL;
+        return false;
+    }
+
+    // Variable-length payloads are raw bytes (no endian conversion), so the
+    // caller can read them in place.
+    value = mCurBufferp;
+    mCurBufferp += size;
+
+    return true;
+}
+
+
+bool LLDataPackerBinaryBuffer::unpackBinaryDataFixedView(U8 *&value, S32 size, const char *name)
+{
+    if (!verifyLength(size, name))
+    {
+        return false;
+    }
+    value = mCurBufferp;
+    mCurBufferp += size;
+    return true;
+}
+
+
+bool LLDataPackerBinaryBuffer::unpackStringView(const char *&value, const char *name)
+{
+    S32 length = (S32)strlen((char *)mCurBufferp) + 1; /*Flawfinder: ignore*/
+
+    if (!verifyLength(length, name))
+    {
+        return false;
+    }
+
+    // Strings are stored null-terminated in the buffer (see strlen() above),
+    // so the view is a usable C string.
+    value = (const char *)mCurBufferp;
+    mCurBufferp += length;
+    return true;
+}
+
+
 bool LLDataPackerBinaryBuffer::packU8(const U8 value, const char *name)
 {
     if (!verifyLength(sizeof(U8), name))
@@ -177,6 +177,14 @@ public:
     /*virtual*/ bool        packUUID(const LLUUID &value, const char *name);
     /*virtual*/ bool        unpackUUID(LLUUID &value, const char *name);
 
+    // Zero-copy variants: return a view into the source buffer instead of
+    // copying.  A view is only valid as long as the underlying buffer is,
+    // i.e. for the processing scope of the current packet -- consumers that
+    // store the data past that scope must use the copying API above.
+                bool        unpackBinaryDataView(U8 *&value, S32 &size, const char *name);
+                bool        unpackBinaryDataFixedView(U8 *&value, S32 size, const char *name);
+                bool        unpackStringView(const char *&value, const char *name);
+
                 S32         getCurrentSize() const  { return (S32)(mCurBufferp - mBufferp); }
                 S32         getBufferSize() const   { return mBufferSize; }
                 const U8*   getBuffer() const   { return mBufferp; }
@@ -45,8 +45,16 @@ void LLMsgVarData::addData(const void *data, S32 size, EMsgVariableType type, S3
     }
     if(size)
     {
-        delete[] mData; // Delete it if it already exists
-        mData = new U8[size];
+        deleteData(); // Delete it if it already exists
+        if (size <= INLINE_SIZE)
+        {
+            // fixed-width fields land here; no heap round-trip per field
+            mData = mInlineData;
+        }
+        else
+        {
+            mData = new U8[size];
+        }
         htolememcpy(mData, data, mType, size);
     }
 }
@@ -171,6 +179,41 @@ std::ostream& operator<<(std::ostream& s, LLMessageTemplate &msg)
     return s;
 }
 
+const std::vector<LLMessageTemplate::BlockStep>& LLMessageTemplate::getBlockSteps() const
+{
+    if (mBlockSteps.empty() && !mMemberBlocks.empty())
+    {
+        for (message_block_map_t::const_iterator iter = mMemberBlocks.begin();
+             iter != mMemberBlocks.end(); iter++)
+        {
+            const LLMessageBlock* mbci = *iter;
+
+            BlockStep block;
+            block.mName = mbci->mName;
+            block.mType = mbci->mType;
+            block.mNumber = mbci->mNumber;
+            block.mFirstVariable = (S32)mVariableSteps.size();
+            block.mNumVariables = (S32)mbci->mMemberVariables.size();
+
+            for (LLMessageBlock::message_variable_map_t::const_iterator viter =
+                     mbci->mMemberVariables.begin();
+                 viter != mbci->mMemberVariables.end(); viter++)
+            {
+                const LLMessageVariable& mvci = **viter;
+
+                VariableStep var;
+                var.mName = mvci.getName();
+                var.mType = mvci.getType();
+                var.mSize = mvci.getSize();
+                mVariableSteps.push_back(var);
+            }
+
+            mBlockSteps.push_back(block);
+        }
+    }
+    return mBlockSteps;
+}
+
 void LLMessageTemplate::banUdp()
 {
     static const char* deprecation[] = {
@@ -34,6 +34,11 @@
 class LLMsgVarData
 {
 public:
+    // values up to this size are stored inline rather than heap-allocated;
+    // covers every fixed-width wire type (the largest is LLVector3d at 24
+    // bytes) so building a message allocates only for large variable data
+    static const S32 INLINE_SIZE = 32;
+
     LLMsgVarData() : mName(NULL), mSize(-1), mDataSize(-1), mData(NULL), mType(MVT_U8)
     {
     }
@@ -43,6 +48,19 @@ public:
         mName = (char *)name;
     }
 
+    LLMsgVarData(const LLMsgVarData& other)
+    {
+        copyFrom(other);
+    }
+
+    LLMsgVarData& operator=(const LLMsgVarData& other)
+    {
+        // like the copy constructor this copies the heap pointer shallowly;
+        // ownership stays with whichever copy gets deleteData() called on it
+        copyFrom(other);
+        return *this;
+    }
+
     ~LLMsgVarData()
     {
         // copy constructor just copies the mData pointer, so only delete mData explicitly
@@ -50,7 +68,10 @@ public:
 
     void deleteData()
     {
-        delete[] mData;
+        if (mData != mInlineData)
+        {
+            delete[] mData;
+        }
         mData = NULL;
     }
 
@@ -64,12 +85,32 @@ public:
     EMsgVariableType getType() const    { return mType; }
 
 protected:
+    void copyFrom(const LLMsgVarData& other)
+    {
+        mName = other.mName;
+        mSize = other.mSize;
+        mDataSize = other.mDataSize;
+        mType = other.mType;
+        if (other.mData == other.mInlineData)
+        {
+            // inline storage has to be re-pointed at our own copy or the
+            // pointer would dangle when the container relocates elements
+            memcpy(mInlineData, other.mInlineData, INLINE_SIZE);
+            mData = mInlineData;
+        }
+        else
+        {
+            mData = other.mData;
+        }
+    }
+
     char                *mName;
     S32                 mSize;
     S32                 mDataSize;
 
     U8                  *mData;
     EMsgVariableType    mType;
+    U8                  mInlineData[INLINE_SIZE];
 };
 
 class LLMsgBlkData
@@ -391,6 +432,30 @@ public:
         return iter != mMemberBlocks.end()? *iter : NULL;
     }
 
+    // The block/variable tree flattened into two contiguous arrays with
+    // types and sizes precomputed, so the per-packet decode loop in
+    // LLTemplateMessageReader::decodeData walks straight-line data
+    // instead of chasing pointers through nested LLIndexedVectors.
+    // Built on first use; templates are immutable once the template
+    // file has been parsed.
+    struct VariableStep
+    {
+        char*            mName;     // shared string from LLMessageStringTable
+        EMsgVariableType mType;
+        S32              mSize;     // fixed size, or length-field size for MVT_VARIABLE
+    };
+    struct BlockStep
+    {
+        char*         mName;        // shared string from LLMessageStringTable
+        EMsgBlockType mType;
+        S32           mNumber;      // repeat count for MBT_MULTIPLE
+        S32           mFirstVariable;   // index into getVariableSteps()
+        S32           mNumVariables;
+    };
+
+    const std::vector<BlockStep>& getBlockSteps() const;
+    const std::vector<VariableStep>& getVariableSteps() const { return mVariableSteps; }
+
 public:
     typedef LLIndexedVector<LLMessageBlock*, char*, 8> message_block_map_t;
     message_block_map_t                     mMemberBlocks;
@@ -416,6 +481,10 @@ private:
     // message handler function (this is set by each application)
     void                                    (*mHandlerFunc)(LLMessageSystem *msgsystem, void **user_data);
     void                                    **mUserData;
+
+    // flattened decode plan, built lazily by getBlockSteps()
+    mutable std::vector<BlockStep>          mBlockSteps;
+    mutable std::vector<VariableStep>       mVariableSteps;
 };
 
 #endif // LL_LLMESSAGETEMPLATE_H
@@ -43,6 +43,166 @@
 #include "message.h"
 #include "u64.h"
 
+bool LLPacketRing::sUseBatchReceive = false;
+bool LLPacketRing::sUseBatchSend = false;
+
+#if LL_LINUX
+///////////////////////////////////////////////////////////
+// Drains up to BATCH_SIZE datagrams from the socket with a single
+// recvmmsg() syscall and hands them back one at a time, preserving
+// receivePacket()'s one-packet-per-call contract. Under heavy
+// object-update load this replaces up to 64 recvfrom() calls per
+// frame with one kernel transition.
+class LLPacketRing::BatchReceiver
+{
+public:
+    static const U32 BATCH_SIZE = 64;
+
+    BatchReceiver();
+
+    // Returns the size of the next buffered datagram copied into datap
+    // with its source address in sender, or 0 when the socket is dry.
+    // Refills the ring with one recvmmsg() call whenever it runs empty.
+    S32 receive(S32 socket, char* datap, LLHost& sender);
+
+private:
+    char mBuffers[BATCH_SIZE][NET_BUFFER_SIZE];
+    struct mmsghdr mHeaders[BATCH_SIZE];
+    struct iovec mIovecs[BATCH_SIZE];
+    struct sockaddr_in mAddrs[BATCH_SIZE];
+    U32 mCount;     // datagrams buffered by the last recvmmsg()
+    U32 mNext;      // next buffered datagram to hand back
+};
+
+LLPacketRing::BatchReceiver::BatchReceiver() :
+    mCount(0),
+    mNext(0)
+{
+    memset(mHeaders, 0, sizeof(mHeaders));
+    for (U32 i = 0; i < BATCH_SIZE; i++)
+    {
+        mIovecs[i].iov_base = mBuffers[i];
+        mIovecs[i].iov_len = NET_BUFFER_SIZE;
+        mHeaders[i].msg_hdr.msg_iov = &mIovecs[i];
+        mHeaders[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+S32 LLPacketRing::BatchReceiver::receive(S32 socket, char* datap, LLHost& sender)
+{
+    if (mNext >= mCount)
+    {
+        // reset the name fields on every refill - the kernel overwrites
+        // msg_namelen with the actual address length it wrote
+        for (U32 i = 0; i < BATCH_SIZE; i++)
+        {
+            mHeaders[i].msg_hdr.msg_name = &mAddrs[i];
+            mHeaders[i].msg_hdr.msg_namelen = sizeof(mAddrs[i]);
+        }
+        int count = recvmmsg(socket, mHeaders, BATCH_SIZE, MSG_DONTWAIT, NULL);
+        if (count <= 0)
+        {
+            return 0;
+        }
+        mCount = (U32)count;
+        mNext = 0;
+    }
+
+    S32 packet_size = (S32)mHeaders[mNext].msg_len;
+    memcpy(datap, mBuffers[mNext], packet_size);    /*Flawfinder: ignore*/
+    // same byte-order convention as ::get_sender()
+    sender = LLHost(mAddrs[mNext].sin_addr.s_addr, ntohs(mAddrs[mNext].sin_port));
+    mNext++;
+    return packet_size;
+}
+///////////////////////////////////////////////////////////
+// Accumulates outbound datagrams and hands them to the kernel with a
+// single sendmmsg() syscall, either when the batch fills or at the
+// per-frame flush from the message system. Agent updates, acks and
+// reliable resends then share kernel transitions instead of paying
+// one sendto() each.
+class LLPacketRing::BatchSender
+{
+public:
+    static const U32 BATCH_SIZE = 64;
+
+    BatchSender();
+
+    // Queues one datagram, flushing first if the batch is full.
+    void send(S32 socket, const char* datap, S32 data_size, LLHost host);
+
+    // Hands all queued datagrams to the kernel.
+    void flush(S32 socket);
+
+private:
+    char mBuffers[BATCH_SIZE][NET_BUFFER_SIZE];
+    struct mmsghdr mHeaders[BATCH_SIZE];
+    struct iovec mIovecs[BATCH_SIZE];
+    struct sockaddr_in mAddrs[BATCH_SIZE];
+    U32 mCount;     // datagrams queued for the next flush
+};
+
+LLPacketRing::BatchSender::BatchSender() :
+    mCount(0)
+{
+    memset(mHeaders, 0, sizeof(mHeaders));
+    memset(mAddrs, 0, sizeof(mAddrs));
+    for (U32 i = 0; i < BATCH_SIZE; i++)
+    {
+        mIovecs[i].iov_base = mBuffers[i];
+        mHeaders[i].msg_hdr.msg_iov = &mIovecs[i];
+        mHeaders[i].msg_hdr.msg_iovlen = 1;
+        mHeaders[i].msg_hdr.msg_name = &mAddrs[i];
+        mHeaders[i].msg_hdr.msg_namelen = sizeof(mAddrs[i]);
+        mAddrs[i].sin_family = AF_INET;
+    }
+}
+
+void LLPacketRing::BatchSender::send(S32 socket, const char* datap, S32 data_size, LLHost host)
+{
+    if (mCount >= BATCH_SIZE)
+    {
+        flush(socket);
+    }
+
+    memcpy(mBuffers[mCount], datap, data_size);     /*Flawfinder: ignore*/
+    mIovecs[mCount].iov_len = data_size;
+    // same byte-order convention as ::send_packet()
+    mAddrs[mCount].sin_addr.s_addr = host.getAddress();
+    mAddrs[mCount].sin_port = htons(host.getPort());
+    mCount++;
+}
+
+void LLPacketRing::BatchSender::flush(S32 socket)
+{
+    U32 done = 0;
+    S32 attempts = 0;
+    while (done < mCount && attempts < 3)
+    {
+        int sent = sendmmsg(socket, mHeaders + done, mCount - done, 0);
+        if (sent > 0)
+        {
+            done += (U32)sent;
+        }
+        else if (errno == EAGAIN || errno == ECONNREFUSED)
+        {
+            // transient; retry the remainder like ::send_packet() does
+            attempts++;
+        }
+        else
+        {
+            LL_INFOS() << "sendmmsg() failed: " << errno << ", " << strerror(errno) << LL_ENDL;
+            break;
+        }
+    }
+    if (done < mCount)
+    {
+        LL_INFOS() << "sendmmsg() dropped " << (mCount - done) << " outbound packets" << LL_ENDL;
+    }
+    mCount = 0;
+}
+#endif // LL_LINUX
+
 ///////////////////////////////////////////////////////////
 LLPacketRing::LLPacketRing () :
     mUseInThrottle(false),
@@ -244,6 +404,19 @@ S32 LLPacketRing::receivePacket (S32 socket, char *datap)
                 packet_size = 0;
             }
         }
+#if LL_LINUX
+        else if (sUseBatchReceive)
+        {
+            // drain up to BatchReceiver::BATCH_SIZE datagrams per syscall;
+            // the SOCKS path above keeps the single-packet read because
+            // each of its datagrams carries a proxy header to unwrap
+            if (!mBatchReceiver)
+            {
+                mBatchReceiver.reset(new BatchReceiver);
+            }
+            packet_size = mBatchReceiver->receive(socket, datap, mLastSender);
+        }
+#endif
         else
         {
             packet_size = receive_packet(socket, datap);
@@ -344,11 +517,34 @@ bool LLPacketRing::sendPacket(int h_socket, char * send_buffer, S32 buf_size, LL
     return status;
 }
 
+void LLPacketRing::flushBatchSend(S32 socket)
+{
+#if LL_LINUX
+    if (mBatchSender)
+    {
+        mBatchSender->flush(socket);
+    }
+#endif
+}
+
 bool LLPacketRing::sendPacketImpl(int h_socket, const char * send_buffer, S32 buf_size, LLHost host)
 {
 
     if (!LLProxy::isSOCKSProxyEnabled())
     {
+#if LL_LINUX
+        if (sUseBatchSend)
+        {
+            // queue the datagram for the next sendmmsg() flush; delivery
+            // errors surface in the flush, so report the queueing as sent
+            if (!mBatchSender)
+            {
+                mBatchSender.reset(new BatchSender);
+            }
+            mBatchSender->send(h_socket, send_buffer, buf_size, host);
+            return true;
+        }
+#endif
         return send_packet(h_socket, send_buffer, buf_size, host.getAddress(), host.getPort());
     }
 
@@ -28,6 +28,7 @@
 #ifndef LL_LLPACKETRING_H
 #define LL_LLPACKETRING_H
 
+#include <memory>
 #include <queue>
 
 #include "llhost.h"
@@ -55,11 +56,28 @@ public:
 
     bool sendPacket(int h_socket, char * send_buffer, S32 buf_size, LLHost host);
 
+    // Hands any datagrams accumulated by batched sending to the kernel.
+    // Called once per frame after acks go out; no-op unless sUseBatchSend
+    // is on (the batch also flushes itself whenever it fills).
+    void flushBatchSend(S32 socket);
+
     inline LLHost getLastSender();
     inline LLHost getLastReceivingInterface();
 
     S32 getAndResetActualInBits()               { S32 bits = mActualBitsIn; mActualBitsIn = 0; return bits;}
     S32 getAndResetActualOutBits()              { S32 bits = mActualBitsOut; mActualBitsOut = 0; return bits;}
+
+    // Drain multiple datagrams per syscall with recvmmsg() where the
+    // platform supports it (Linux only; no-op elsewhere). Set from the
+    // setting at "UDPBatchedReceive" before the message system starts
+    // pulling packets.
+    static bool sUseBatchReceive;
+
+    // Accumulate outbound datagrams and hand them to the kernel with
+    // sendmmsg() where the platform supports it (Linux only; no-op
+    // elsewhere). Set from the setting at "UDPBatchedSend" before the
+    // message system starts sending.
+    static bool sUseBatchSend;
 protected:
     bool mUseInThrottle;
     bool mUseOutThrottle;
@@ -83,6 +101,18 @@ protected:
     LLHost mLastSender;
     LLHost mLastReceivingIF;
 
+#if LL_LINUX
+    // preallocated ring of buffers filled by recvmmsg(); created lazily
+    // the first time receivePacket() runs with sUseBatchReceive on
+    class BatchReceiver;
+    std::unique_ptr<BatchReceiver> mBatchReceiver;
+
+    // preallocated batch of buffers drained by sendmmsg(); created lazily
+    // the first time sendPacketImpl() runs with sUseBatchSend on
+    class BatchSender;
+    std::unique_ptr<BatchSender> mBatchSender;
+#endif
+
 private:
     bool sendPacketImpl(int h_socket, const char * send_buffer, S32 buf_size, LLHost host);
 };
@@ -45,6 +45,9 @@ LLTemplateMessageReader::LLTemplateMessageReader(message_template_number_map_t&
     mCurrentRMessageData(NULL),
     mMessageNumbers(number_template_map)
 {
+    memset(mHighFreqCache, 0, sizeof(mHighFreqCache));
+    memset(mMediumFreqCache, 0, sizeof(mMediumFreqCache));
+    memset(mLowFreqCache, 0, sizeof(mLowFreqCache));
 }
 
 //virtual
@@ -492,7 +495,7 @@ bool LLTemplateMessageReader::decodeTemplate(
         return(false);
     }
 
-    LLMessageTemplate* temp = get_ptr_in_map(mMessageNumbers,num);
+    LLMessageTemplate* temp = lookupTemplate(num);
     if (temp)
     {
         *msg_template = temp;
@@ -509,6 +512,40 @@ bool LLTemplateMessageReader::decodeTemplate(
     return(true);
 }
 
+LLMessageTemplate* LLTemplateMessageReader::lookupTemplate(U32 num)
+{
+    // templates register while the template file parses, and are never
+    // removed, so a cached slot stays valid for the life of the reader
+    LLMessageTemplate** slot = NULL;
+    if (num < 256)
+    {
+        // high frequency
+        slot = &mHighFreqCache[num];
+    }
+    else if ((num & 0xFFFFFF00) == (255 << 8))
+    {
+        // medium frequency
+        slot = &mMediumFreqCache[num & 0xFF];
+    }
+    else if (((num & 0xFFFF0000) == 0xFFFF0000) && ((num & 0xFFFF) < LOW_FREQ_CACHE_SIZE))
+    {
+        // low frequency
+        slot = &mLowFreqCache[num & 0xFFFF];
+    }
+
+    if (slot && *slot)
+    {
+        return *slot;
+    }
+
+    LLMessageTemplate* temp = get_ptr_in_map(mMessageNumbers, num);
+    if (slot && temp)
+    {
+        *slot = temp;
+    }
+    return temp;
+}
+
 void LLTemplateMessageReader::logRanOffEndOfPacket( const LLHost& host, const S32 where, const S32 wanted )
 {
     // we've run off the end of the packet!
@@ -548,29 +585,32 @@ bool LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
     // create base working data set
     mCurrentRMessageData = new LLMsgData(mCurrentRMessageTemplate->mName);
 
-    // loop through the template building the data structure as we go
-    LLMessageTemplate::message_block_map_t::const_iterator iter;
-    for(iter = mCurrentRMessageTemplate->mMemberBlocks.begin();
-        iter != mCurrentRMessageTemplate->mMemberBlocks.end();
-        ++iter)
+    // loop through the flattened decode plan building the data
+    // structure as we go - high-frequency messages decode thousands of
+    // times per second in crowded regions, so the per-packet walk stays
+    // on contiguous precomputed steps
+    const std::vector<LLMessageTemplate::BlockStep>& block_steps =
+        mCurrentRMessageTemplate->getBlockSteps();
+    const std::vector<LLMessageTemplate::VariableStep>& variable_steps =
+        mCurrentRMessageTemplate->getVariableSteps();
+    for (const LLMessageTemplate::BlockStep& mbci : block_steps)
     {
-        LLMessageBlock* mbci = *iter;
         U8  repeat_number;
         S32 i;
 
         // how many of this block?
 
-        if (mbci->mType == MBT_SINGLE)
+        if (mbci.mType == MBT_SINGLE)
         {
             // just one
             repeat_number = 1;
         }
-        else if (mbci->mType == MBT_MULTIPLE)
+        else if (mbci.mType == MBT_MULTIPLE)
         {
             // a known number
-            repeat_number = mbci->mNumber;
+            repeat_number = mbci.mNumber;
         }
-        else if (mbci->mType == MBT_VARIABLE)
+        else if (mbci.mType == MBT_VARIABLE)
         {
             // need to read the number from the message
             // repeat number is a single byte
@@ -604,33 +644,32 @@ bool LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
             {
                 // build new name to prevent collisions
                 // TODO: This should really change to a vector
-                cur_data_block = new LLMsgBlkData(mbci->mName, repeat_number);
-                cur_data_block->mName = mbci->mName + i;
+                cur_data_block = new LLMsgBlkData(mbci.mName, repeat_number);
+                cur_data_block->mName = mbci.mName + i;
             }
             else
             {
-                cur_data_block = new LLMsgBlkData(mbci->mName, repeat_number);
+                cur_data_block = new LLMsgBlkData(mbci.mName, repeat_number);
             }
 
             // add the block to the message
             mCurrentRMessageData->addBlock(cur_data_block);
 
             // now read the variables
-            for (LLMessageBlock::message_variable_map_t::const_iterator iter =
-                     mbci->mMemberVariables.begin();
-                 iter != mbci->mMemberVariables.end(); iter++)
+            for (S32 v = 0; v < mbci.mNumVariables; v++)
             {
-                const LLMessageVariable& mvci = **iter;
+                const LLMessageTemplate::VariableStep& mvci =
+                    variable_steps[mbci.mFirstVariable + v];
 
                 // ok, build out the variables
                 // add variable block
-                cur_data_block->addVariable(mvci.getName(), mvci.getType());
+                cur_data_block->addVariable(mvci.mName, mvci.mType);
 
                 // what type of variable?
-                if (mvci.getType() == MVT_VARIABLE)
+                if (mvci.mType == MVT_VARIABLE)
                 {
                     // variable, get the number of bytes to read from the template
-                    S32 data_size = mvci.getSize();
+                    S32 data_size = mvci.mSize;
                     U8 tsizeb = 0;
                     U16 tsizeh = 0;
                     U32 tsize = 0;
@@ -664,31 +703,31 @@ bool LLTemplateMessageReader::decodeData(const U8* buffer, const LLHost& sender
                     }
                     decode_pos += data_size;
 
-                    cur_data_block->addData(mvci.getName(), &buffer[decode_pos], tsize, mvci.getType());
+                    cur_data_block->addData(mvci.mName, &buffer[decode_pos], tsize, mvci.mType);
                     decode_pos += tsize;
                 }
                 else
                 {
                     // fixed!
                     // so, copy data pointer and set data size to fixed size
-                    if ((decode_pos + mvci.getSize()) > mReceiveSize)
+                    if ((decode_pos + mvci.mSize) > mReceiveSize)
                     {
-                        logRanOffEndOfPacket(sender, decode_pos, mvci.getSize());
+                        logRanOffEndOfPacket(sender, decode_pos, mvci.mSize);
 
                         // default to 0s.
-                        U32 size = mvci.getSize();
+                        U32 size = mvci.mSize;
                         std::vector<U8> data(size, 0);
-                        cur_data_block->addData(mvci.getName(), &(data[0]),
-                                                size, mvci.getType());
+                        cur_data_block->addData(mvci.mName, &(data[0]),
+                                                size, mvci.mType);
                     }
                     else
                     {
-                        cur_data_block->addData(mvci.getName(),
+                        cur_data_block->addData(mvci.mName,
                                                 &buffer[decode_pos],
-                                                mvci.getSize(),
-                                                mvci.getType());
+                                                mvci.mSize,
+                                                mvci.mType);
                     }
-                    decode_pos += mvci.getSize();
+                    decode_pos += mvci.mSize;
                 }
             }
         }
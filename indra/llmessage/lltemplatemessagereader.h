@@ -114,6 +114,10 @@ private:
     bool decodeTemplate(const U8* buffer, S32 buffer_size,  // inputs
                         LLMessageTemplate** msg_template ); // outputs
 
+    // O(1) template lookup by message number, falling back to (and
+    // priming itself from) mMessageNumbers
+    LLMessageTemplate* lookupTemplate(U32 num);
+
     void logRanOffEndOfPacket( const LLHost& host, const S32 where, const S32 wanted );
 
     bool decodeData(const U8* buffer, const LLHost& sender );
@@ -122,6 +126,16 @@ private:
     LLMessageTemplate* mCurrentRMessageTemplate;
     LLMsgData* mCurrentRMessageData;
     message_template_number_map_t& mMessageNumbers;
+
+    // Direct-index dispatch tables, primed lazily from mMessageNumbers.
+    // Message numbers are small dense integers within each frequency
+    // band, so a flat array replaces the per-packet std::map lookup.
+    // Low-frequency numbers above the cache size (none in the current
+    // template file) stay on the map.
+    static const S32 LOW_FREQ_CACHE_SIZE = 1024;
+    LLMessageTemplate* mHighFreqCache[256];
+    LLMessageTemplate* mMediumFreqCache[256];
+    LLMessageTemplate* mLowFreqCache[LOW_FREQ_CACHE_SIZE];
 };
 
 #endif // LL_LLTEMPLATEMESSAGEREADER_H
@@ -35,6 +35,10 @@
 //number of bytes sent in each message
 const U32 LL_XFER_CHUNK_SIZE = 1000;
 
+//max outstanding unconfirmed packets on a send; the receiver takes any
+//in-order stream, so the window rides on the existing confirm messages
+const S32 LL_XFER_WINDOW_MAX = 16;
+
 const U32 LLXfer::XFER_FILE = 1;
 const U32 LLXfer::XFER_VFILE = 2;
 const U32 LLXfer::XFER_MEM = 3;
@@ -60,6 +64,8 @@ void LLXfer::init (S32 chunk_size)
     mID = 0;
 
     mPacketNum = -1; // there's a preincrement before sending the zeroth packet
+    mAckedPacketNum = -1;
+    mWindowSize = 1;
     mXferSize = 0;
 
     mStatus = e_LL_XFER_UNINITIALIZED;
@@ -292,9 +298,47 @@ void LLXfer::sendNextPacket()
 
 ///////////////////////////////////////////////////////////
 
+void LLXfer::sendWindow()
+{
+    // keep packets moving while the send window has room; sendPacket
+    // takes mStatus out of IN_PROGRESS once the EOF packet goes out
+    while (mStatus == e_LL_XFER_IN_PROGRESS
+           && (mPacketNum - mAckedPacketNum) < mWindowSize)
+    {
+        sendNextPacket();
+    }
+}
+
+///////////////////////////////////////////////////////////
+
+void LLXfer::confirmPacket(S32 packet_num)
+{
+    if (packet_num > mAckedPacketNum)
+    {
+        // confirms arrive in order, so treat them as cumulative; a lost
+        // confirm is covered by the one that follows it
+        mAckedPacketNum = packet_num;
+        mRetries = 0;
+        ACKTimer.reset();
+        if (mWindowSize < LL_XFER_WINDOW_MAX)
+        {
+            // clean delivery; open the window another packet
+            mWindowSize++;
+        }
+    }
+    mWaitingForACK = (mAckedPacketNum < mPacketNum);
+}
+
+///////////////////////////////////////////////////////////
+
 void LLXfer::resendLastPacket()
 {
     mRetries++;
+    // go back to the first unconfirmed packet and collapse the window;
+    // anything sent after the lost packet was ignored by the in-order
+    // receiver and will be resent as the window reopens
+    mWindowSize = 1;
+    mPacketNum = llmax(mAckedPacketNum + 1, 0);
     sendPacket(mPacketNum);
 }
 
@@ -56,6 +56,12 @@ class LLXfer
  public:
     U64 mID;
     S32 mPacketNum;
+    // Sliding send window: packets in (mAckedPacketNum, mPacketNum] are on
+    // the wire awaiting confirmation. The window starts at a single packet,
+    // grows on clean confirms and collapses back on a timeout, so the first
+    // exchange behaves exactly like the old lock-step transfer.
+    S32 mAckedPacketNum;
+    S32 mWindowSize;
 
     LLHost mRemoteHost;
     S32 mXferSize;
@@ -94,7 +100,10 @@ class LLXfer
     virtual S32 reopenFileHandle();
     virtual void sendPacket(S32 packet_num);
     virtual void sendNextPacket();
+    virtual void sendWindow();
     virtual void resendLastPacket();
+    void confirmPacket(S32 packet_num);
+    bool allPacketsConfirmed() const        { return mAckedPacketNum >= mPacketNum; }
     virtual S32 processEOF();
     virtual S32 startDownload();
     virtual S32 receiveData (char *datap, S32 data_size);
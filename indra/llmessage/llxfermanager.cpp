@@ -1005,13 +1005,15 @@ void LLXferManager::processConfirmation (LLMessageSystem *mesgsys, void ** /*use
     if (xferp)
     {
 //      cout << "confirmed packet #" << packetNum << " ping: "<< xferp->ACKTimer.getElapsedTimeF32() <<  endl;
-        xferp->mWaitingForACK = false;
+        xferp->confirmPacket(packetNum);
         if (xferp->mStatus == e_LL_XFER_IN_PROGRESS)
         {
-            xferp->sendNextPacket();
+            xferp->sendWindow();
         }
-        else
+        else if (xferp->mStatus != e_LL_XFER_COMPLETE || xferp->allPacketsConfirmed())
         {
+            // done (or aborted); a completed send is only removed once every
+            // outstanding packet in the window has been confirmed
             removeXfer(xferp, mSendList);
         }
     }
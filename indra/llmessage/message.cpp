@@ -819,6 +819,10 @@ void LLMessageSystem::processAcks(LockMessageChecker&, F32 collect_time)
         mResendDumpTime = mt_sec;
         mCircuitInfo.dumpResends();
     }
+
+    // acks were the last sends of the frame; push out anything the
+    // batched send path has accumulated
+    mPacketRing.flushBatchSend(mSocket);
 }
 
 void LLMessageSystem::copyMessageReceivedToSend()
@@ -2762,7 +2766,6 @@ S32 LLMessageSystem::zeroCodeAdjustCurrentSendTotal()
     S32 count = mSendSize;
 
     S32 net_gain = 0;
-    U8 num_zeroes = 0;
 
     U8 *inptr = (U8 *)mSendBuffer;
 
@@ -2779,33 +2782,29 @@ S32 LLMessageSystem::zeroCodeAdjustCurrentSendTotal()
 // sequential zero bytes are encoded as 0 [U8 count]
 // with 0 0 [count] representing wrap (>256 zeroes)
 
-    while (count--)
+    while (count > 0)
     {
-        if (!(*inptr))   // in a zero count
+        // hop over the non-zero span in one go; it encodes byte for byte
+        U8 *zerop = (U8 *)memchr(inptr, 0, count);
+        if (!zerop)
         {
-            if (num_zeroes)
-            {
-                if (++num_zeroes > 254)
-                {
-                    num_zeroes = 0;
-                }
-                net_gain--;   // subseqent zeroes save one
-            }
-            else
-            {
-                net_gain++;  // starting a zero count adds one
-                num_zeroes = 1;
-            }
-            inptr++;
+            break;
         }
-        else
+        count -= (S32)(zerop - inptr);
+        inptr = zerop;
+
+        // measure the zero run and price it in closed form: each
+        // 255-zero stretch costs a fresh 0 [count] pair (one byte
+        // gained), every other zero in the stretch saves one
+        S32 run = 0;
+        while (run < count && !inptr[run])
         {
-            if (num_zeroes)
-            {
-                num_zeroes = 0;
-            }
-            inptr++;
+            run++;
         }
+        S32 starts = (run + 254) / 255;
+        net_gain += 2 * starts - run;
+        count -= run;
+        inptr += run;
     }
     if (net_gain < 0)
     {
@@ -2859,8 +2858,32 @@ S32 LLMessageSystem::zeroCodeExpand(U8** data, S32* data_size)
 // sequential zero bytes are encoded as 0 [U8 count]
 // with 0 0 [count] representing wrap (>256 zeroes)
 
-    while (count--)
+    while (count > 0)
     {
+        if (*inptr)
+        {
+            // bulk-copy the literal span up to the next zero marker (or
+            // the end of the packet); memchr and memcpy both walk the
+            // buffer a vector register at a time
+            U8 *zerop = (U8 *)memchr(inptr, 0, count);
+            S32 span = zerop ? (S32)(zerop - inptr) : count;
+            if (outptr + span > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE]))
+            {
+                LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 1" << LL_ENDL;
+                callExceptionFunc(MX_WROTE_PAST_BUFFER_SIZE);
+                outptr = mEncodedRecvBuffer;
+                break;
+            }
+            memcpy(outptr, inptr, span);    /*Flawfinder: ignore*/
+            outptr += span;
+            inptr += span;
+            count -= span;
+            continue;
+        }
+
+        // zero marker: the leading zero stands for itself, each extra
+        // zero wraps another 255, and the trailing count byte closes
+        // out the run
         if (outptr > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE-1]))
         {
             LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 1" << LL_ENDL;
@@ -2868,41 +2891,42 @@ S32 LLMessageSystem::zeroCodeExpand(U8** data, S32* data_size)
             outptr = mEncodedRecvBuffer;
             break;
         }
-        if (!((*outptr++ = *inptr++)))
-        {
-            while (((count--)) && (!(*inptr)))
-            {
-                *outptr++ = *inptr++;
-                if (outptr > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE-256]))
-                {
-                    LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 2" << LL_ENDL;
-                    callExceptionFunc(MX_WROTE_PAST_BUFFER_SIZE);
-                    outptr = mEncodedRecvBuffer;
-                    count = -1;
-                    break;
-                }
-                memset(outptr,0,255);
-                outptr += 255;
-            }
+        *outptr++ = *inptr++;
+        count--;
 
-            if (count < 0)
+        bool aborted = false;
+        while (count > 0 && !(*inptr))
+        {
+            count--;
+            *outptr++ = *inptr++;
+            if (outptr > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE-256]))
             {
+                LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 2" << LL_ENDL;
+                callExceptionFunc(MX_WROTE_PAST_BUFFER_SIZE);
+                outptr = mEncodedRecvBuffer;
+                aborted = true;
                 break;
             }
+            memset(outptr,0,255);
+            outptr += 255;
+        }
 
-            else
-            {
-                if (outptr > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE-(*inptr)]))
-                {
-                    LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 3" << LL_ENDL;
-                    callExceptionFunc(MX_WROTE_PAST_BUFFER_SIZE);
-                    outptr = mEncodedRecvBuffer;
-                }
-                memset(outptr,0,(*inptr) - 1);
-                outptr += ((*inptr) - 1);
-                inptr++;
-            }
+        if (aborted || count <= 0)
+        {
+            // overran the buffer or the packet ended mid-run
+            break;
+        }
+
+        count--;
+        if (outptr > (&mEncodedRecvBuffer[MAX_BUFFER_SIZE-(*inptr)]))
+        {
+            LL_WARNS("Messaging") << "attempt to write past reasonable encoded buffer size 3" << LL_ENDL;
+            callExceptionFunc(MX_WROTE_PAST_BUFFER_SIZE);
+            outptr = mEncodedRecvBuffer;
         }
+        memset(outptr,0,(*inptr) - 1);
+        outptr += ((*inptr) - 1);
+        inptr++;
     }
 
     *data = mEncodedRecvBuffer;
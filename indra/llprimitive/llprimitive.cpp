@@ -1441,19 +1441,17 @@ S32 LLPrimitive::parseTEMessage(LLMessageSystem* mesgsys, char const* block_name
 S32 LLPrimitive::applyParsedTEMessage(LLTEContents& tec)
 {
     S32 retval = 0;
+    tec.changed_face_mask = 0;
 
     LLColor4 color;
     for (U32 i = 0; i < tec.face_count; i++)
     {
         LLUUID& req_id = ((LLUUID*)tec.image_data)[i];
-        retval |= setTETexture(i, req_id);
-        retval |= setTEScale(i, tec.scale_s[i], tec.scale_t[i]);
-        retval |= setTEOffset(i, (F32)tec.offset_s[i] / (F32)0x7FFF, (F32) tec.offset_t[i] / (F32) 0x7FFF);
-        retval |= setTERotation(i, ((F32)tec.image_rot[i] / TEXTURE_ROTATION_PACK_FACTOR) * F_TWO_PI);
-        retval |= setTEBumpShinyFullbright(i, tec.bump[i]);
-        retval |= setTEMediaTexGen(i, tec.media_flags[i]);
-        retval |= setTEGlow(i, (F32)tec.glow[i] / (F32)0xFF);
-        retval |= setTEMaterialID(i, tec.material_ids[i]);
+
+        F32 offset_s = (F32)tec.offset_s[i] / (F32)0x7FFF;
+        F32 offset_t = (F32)tec.offset_t[i] / (F32)0x7FFF;
+        F32 rotation = ((F32)tec.image_rot[i] / TEXTURE_ROTATION_PACK_FACTOR) * F_TWO_PI;
+        F32 glow = (F32)tec.glow[i] / (F32)0xFF;
 
         // Note:  This is an optimization to send common colors (1.f, 1.f, 1.f, 1.f)
         // as all zeros.  However, the subtraction and addition must be done in unsigned
@@ -1463,7 +1461,45 @@ S32 LLPrimitive::applyParsedTEMessage(LLTEContents& tec)
         color.mV[VBLUE]     = F32(255 - tec.colors[i].mV[VBLUE])  / 255.f;
         color.mV[VALPHA]    = F32(255 - tec.colors[i].mV[VALPHA]) / 255.f;
 
-        retval |= setTEColor(i, color);
+        // Object updates deliver the full texture entry block even when a
+        // single face changed, so most faces in an update match what we
+        // already have.  Skip the setTE* fan-out (texture manager lookups,
+        // virtual dispatch into the viewer object hierarchy) for those faces.
+        const LLTextureEntry* te = getTE(i);
+        if (te
+            && req_id.notNull() // null ids force mTEImages maintenance in setTETextureCore()
+            && te->getID() == req_id
+            && te->getColor() == color
+            && te->mScaleS == tec.scale_s[i]
+            && te->mScaleT == tec.scale_t[i]
+            && te->mOffsetS == offset_s
+            && te->mOffsetT == offset_t
+            && te->mRotation == rotation
+            && te->getBumpShinyFullbright() == tec.bump[i]
+            && te->getMediaTexGen() == tec.media_flags[i]
+            && te->getGlow() == glow
+            && te->getMaterialID() == tec.material_ids[i]
+            && !te->hasPendingMaterialUpdate()) // setTEMaterialID() has work to do even for a matching id
+        {
+            continue;
+        }
+
+        S32 face_retval = 0;
+        face_retval |= setTETexture(i, req_id);
+        face_retval |= setTEScale(i, tec.scale_s[i], tec.scale_t[i]);
+        face_retval |= setTEOffset(i, offset_s, offset_t);
+        face_retval |= setTERotation(i, rotation);
+        face_retval |= setTEBumpShinyFullbright(i, tec.bump[i]);
+        face_retval |= setTEMediaTexGen(i, tec.media_flags[i]);
+        face_retval |= setTEGlow(i, glow);
+        face_retval |= setTEMaterialID(i, tec.material_ids[i]);
+        face_retval |= setTEColor(i, color);
+
+        if (face_retval)
+        {
+            tec.changed_face_mask |= U64(1) << i;
+        }
+        retval |= face_retval;
     }
 
     return retval;
@@ -1478,120 +1514,82 @@ S32 LLPrimitive::unpackTEMessage(LLMessageSystem* mesgsys, char const* block_nam
     return applyParsedTEMessage(tec);
 }
 
-S32 LLPrimitive::unpackTEMessage(LLDataPacker &dp)
+S32 LLPrimitive::parseTEMessage(LLDataPacker &dp, LLTEContents& tec)
 {
-    // use a negative block_num to indicate a single-block read (a non-variable block)
-    S32 retval = 0;
-    constexpr U32 MAX_TES = 45;
-
-    // Avoid construction of 32 UUIDs per call
-    static LLMaterialID material_ids[MAX_TES];
-
-    constexpr U32 MAX_TE_BUFFER = 4096;
-    U8 packed_buffer[MAX_TE_BUFFER];
-    memset((void*)packed_buffer, 0, MAX_TE_BUFFER);
-
-    LLUUID      image_data[MAX_TES];
-    LLColor4U   colors[MAX_TES];
-    F32         scale_s[MAX_TES];
-    F32         scale_t[MAX_TES];
-    S16         offset_s[MAX_TES];
-    S16         offset_t[MAX_TES];
-    S16         image_rot[MAX_TES];
-    U8          bump[MAX_TES];
-    U8          media_flags[MAX_TES];
-    U8          glow[MAX_TES];
-    material_id_type material_data[MAX_TES];
-
-    memset((void*)scale_s, 0, sizeof(scale_s));
-    memset((void*)scale_t, 0, sizeof(scale_t));
-    memset((void*)offset_s, 0, sizeof(offset_s));
-    memset((void*)offset_t, 0, sizeof(offset_t));
-    memset((void*)image_rot, 0, sizeof(image_rot));
-    memset((void*)bump, 0, sizeof(bump));
-    memset((void*)media_flags, 0, sizeof(media_flags));
-    memset((void*)glow, 0, sizeof(glow));
+    // temp buffer for material ID processing
+    // data will end up in tec.material_ids[]
+    material_id_type material_data[LLTEContents::MAX_TES];
 
     S32 size;
-    U32 face_count = 0;
 
-    if (!dp.unpackBinaryData(packed_buffer, size, "TextureEntry"))
+    if (!dp.unpackBinaryData(tec.packed_buffer, size, "TextureEntry"))
     {
-        retval = TEM_INVALID;
+        tec.face_count = 0;
         LL_WARNS() << "Bad texture entry block!  Abort!" << LL_ENDL;
-        return retval;
+        return TEM_INVALID;
     }
 
     if (size == 0)
     {
-        return retval;
+        tec.face_count = 0;
+        return 0;
     }
-    else if (size >= MAX_TE_BUFFER)
+    else if (size >= (S32)LLTEContents::MAX_TE_BUFFER)
     {
         LL_WARNS("TEXTUREENTRY") << "Excessive buffer size detected in Texture Entry! Truncating." << LL_ENDL;
-        size = MAX_TE_BUFFER - 1;
+        size = LLTEContents::MAX_TE_BUFFER - 1;
     }
 
     // The last field is not zero terminated.
     // Rather than special case the upack functions.  Just make it 0x00 terminated.
-    packed_buffer[size] = 0x00;
+    tec.packed_buffer[size] = 0x00;
     ++size;
-    face_count = llmin((U32) getNumTEs(), MAX_TES);
-    U32 i;
+    tec.size = size;
 
-    U8 *cur_ptr = packed_buffer;
+    tec.face_count = llmin((U32)getNumTEs(), (U32)LLTEContents::MAX_TES);
+
+    U8 *cur_ptr = tec.packed_buffer;
     LL_DEBUGS("TEXTUREENTRY") << "Texture Entry with buffer sized: " << size << LL_ENDL;
-    U8 *buffer_end = packed_buffer + size;
-
-    if (!(  unpack_TEField<LLUUID>(image_data, face_count, cur_ptr, buffer_end, MVT_LLUUID) &&
-            unpack_TEField<LLColor4U>(colors, face_count, cur_ptr, buffer_end, MVT_U8) &&
-            unpack_TEField<F32>(scale_s, face_count, cur_ptr, buffer_end, MVT_F32) &&
-            unpack_TEField<F32>(scale_t, face_count, cur_ptr, buffer_end, MVT_F32) &&
-            unpack_TEField<S16>(offset_s, face_count, cur_ptr, buffer_end, MVT_S16) &&
-            unpack_TEField<S16>(offset_t, face_count, cur_ptr, buffer_end, MVT_S16) &&
-            unpack_TEField<S16>(image_rot, face_count, cur_ptr, buffer_end, MVT_S16) &&
-            unpack_TEField<U8>(bump, face_count, cur_ptr, buffer_end, MVT_U8) &&
-            unpack_TEField<U8>(media_flags, face_count, cur_ptr, buffer_end, MVT_U8) &&
-            unpack_TEField<U8>(glow, face_count, cur_ptr, buffer_end, MVT_U8)))
+    U8 *buffer_end = tec.packed_buffer + size;
+
+    if (!(  unpack_TEField<LLUUID>(tec.image_data, tec.face_count, cur_ptr, buffer_end, MVT_LLUUID) &&
+            unpack_TEField<LLColor4U>(tec.colors, tec.face_count, cur_ptr, buffer_end, MVT_U8) &&
+            unpack_TEField<F32>(tec.scale_s, tec.face_count, cur_ptr, buffer_end, MVT_F32) &&
+            unpack_TEField<F32>(tec.scale_t, tec.face_count, cur_ptr, buffer_end, MVT_F32) &&
+            unpack_TEField<S16>(tec.offset_s, tec.face_count, cur_ptr, buffer_end, MVT_S16) &&
+            unpack_TEField<S16>(tec.offset_t, tec.face_count, cur_ptr, buffer_end, MVT_S16) &&
+            unpack_TEField<S16>(tec.image_rot, tec.face_count, cur_ptr, buffer_end, MVT_S16) &&
+            unpack_TEField<U8>(tec.bump, tec.face_count, cur_ptr, buffer_end, MVT_U8) &&
+            unpack_TEField<U8>(tec.media_flags, tec.face_count, cur_ptr, buffer_end, MVT_U8) &&
+            unpack_TEField<U8>(tec.glow, tec.face_count, cur_ptr, buffer_end, MVT_U8)))
     {
         LL_WARNS("TEXTUREENTRY") << "Failure parsing Texture Entry Message due to malformed TE Field! Dropping changes on the floor. " << LL_ENDL;
         return 0;
     }
 
-    if (cur_ptr >= buffer_end || !unpack_TEField<material_id_type>(material_data, face_count, cur_ptr, buffer_end, MVT_LLUUID))
+    if (cur_ptr >= buffer_end || !unpack_TEField<material_id_type>(material_data, tec.face_count, cur_ptr, buffer_end, MVT_LLUUID))
     {
         memset((void*)material_data, 0, sizeof(material_data));
     }
 
-    for (i = 0; i < face_count; i++)
+    for (U32 i = 0; i < tec.face_count; i++)
     {
-        material_ids[i].set(&(material_data[i]));
+        tec.material_ids[i].set(&(material_data[i]));
     }
 
-    LLColor4 color;
-    for (i = 0; i < face_count; i++)
-    {
-        retval |= setTETexture(i, ((LLUUID*)image_data)[i]);
-        retval |= setTEScale(i, scale_s[i], scale_t[i]);
-        retval |= setTEOffset(i, (F32)offset_s[i] / (F32)0x7FFF, (F32) offset_t[i] / (F32) 0x7FFF);
-        retval |= setTERotation(i, ((F32)image_rot[i] / TEXTURE_ROTATION_PACK_FACTOR) * F_TWO_PI);
-        retval |= setTEBumpShinyFullbright(i, bump[i]);
-        retval |= setTEMediaTexGen(i, media_flags[i]);
-        retval |= setTEGlow(i, (F32)glow[i] / (F32)0xFF);
-        retval |= setTEMaterialID(i, material_ids[i]);
-
-        // Note:  This is an optimization to send common colors (1.f, 1.f, 1.f, 1.f)
-        // as all zeros.  However, the subtraction and addition must be done in unsigned
-        // byte space, not in float space, otherwise off-by-one errors occur. JC
-        color.mV[VRED]      = F32(255 - colors[i].mV[VRED])   / 255.f;
-        color.mV[VGREEN]    = F32(255 - colors[i].mV[VGREEN]) / 255.f;
-        color.mV[VBLUE]     = F32(255 - colors[i].mV[VBLUE])  / 255.f;
-        color.mV[VALPHA]    = F32(255 - colors[i].mV[VALPHA]) / 255.f;
+    return 1;
+}
 
-        retval |= setTEColor(i, color);
+S32 LLPrimitive::unpackTEMessage(LLDataPacker &dp)
+{
+    LLTEContents tec;
+    S32 retval = parseTEMessage(dp, tec);
+    if (retval != 1)
+    {
+        // nothing parsed, or TEM_INVALID for a bad block
+        return retval;
     }
-
-    return retval;
+    return applyParsedTEMessage(tec);
 }
 
 U8  LLPrimitive::getExpectedNumTEs() const
@@ -420,6 +420,10 @@ struct LLTEContents
 
     U32 size;
     U32 face_count;
+
+    // bitmask of faces whose texture entry actually changed, filled in by
+    // LLPrimitive::applyParsedTEMessage() (bit i set == face i changed)
+    U64 changed_face_mask;
 };
 
 class LLPrimitive : public LLXform
@@ -501,6 +505,7 @@ public:
     S32 unpackTEMessage(LLMessageSystem* mesgsys, char const* block_name, const S32 block_num); // Variable num of blocks
     S32 unpackTEMessage(LLDataPacker &dp);
     S32 parseTEMessage(LLMessageSystem* mesgsys, char const* block_name, const S32 block_num, LLTEContents& tec);
+    S32 parseTEMessage(LLDataPacker& dp, LLTEContents& tec);
     S32 applyParsedTEMessage(LLTEContents& tec);
 
 #ifdef CHECK_FOR_FINITE
@@ -117,7 +117,8 @@ LLFontGlyphInfo::LLFontGlyphInfo(U32 index, EFontGlyphType glyph_type)
     mYBitmapOffset(0),  // Offset to the origin in the bitmap
     mXBearing(0),       // Distance from baseline to left in pixels
     mYBearing(0),       // Distance from baseline to top in pixels
-    mBitmapEntry(std::make_pair(EFontGlyphType::Unspecified, -1)) // Which bitmap in the bitmap cache contains this glyph
+    mBitmapEntry(std::make_pair(EFontGlyphType::Unspecified, -1)), // Which bitmap in the bitmap cache contains this glyph
+    mLastUseGeneration(LLFontFreetype::sUseGeneration)
 {
 }
 
@@ -132,10 +133,14 @@ LLFontGlyphInfo::LLFontGlyphInfo(const LLFontGlyphInfo& fgi)
     , mYBitmapOffset(fgi.mYBitmapOffset)
     , mXBearing(fgi.mXBearing)
     , mYBearing(fgi.mYBearing)
+    , mLastUseGeneration(fgi.mLastUseGeneration)
 {
     mBitmapEntry = fgi.mBitmapEntry;
 }
 
+//static
+U32 LLFontFreetype::sUseGeneration = 0;
+
 LLFontFreetype::LLFontFreetype()
 :   mFontBitmapCachep(new LLFontBitmapCache),
     mAscender(0.f),
@@ -656,9 +661,14 @@ LLFontGlyphInfo* LLFontFreetype::addGlyphFromFont(const LLFontFreetype *fontp, l
         llassert(false);
     }
 
+    // Only upload the rect the new glyph landed in, not the whole bitmap --
+    // re-sending a full 512x512 page per added glyph is what made the first
+    // render of each new string (and the ASCII precache at font creation)
+    // hitch.  setSubImage() sources the sub-rect out of the page via
+    // GL_UNPACK_ROW_LENGTH, so the raw bitmap can be passed as-is.
     LLImageGL *image_gl = mFontBitmapCachep->getImageGL(bitmap_glyph_type, bitmap_num);
     LLImageRaw *image_raw = mFontBitmapCachep->getImageRaw(bitmap_glyph_type, bitmap_num);
-    image_gl->setSubImage(image_raw, 0, 0, image_gl->getWidth(), image_gl->getHeight());
+    image_gl->setSubImage(image_raw, pos_x, pos_y, width, height);
 
     return gi;
 }
@@ -672,6 +682,7 @@ LLFontGlyphInfo* LLFontFreetype::getGlyphInfo(llwchar wch, EFontGlyphType glyph_
         : range_it.first;
     if (iter != range_it.second)
     {
+        iter->second->mLastUseGeneration = sUseGeneration;
         return iter->second;
     }
     else
@@ -768,6 +779,64 @@ void LLFontFreetype::resetBitmapCache()
     }
 }
 
+bool LLFontFreetype::compact()
+{
+    if (mIsFallback || !mFTFace)
+    {
+        // fallback glyphs render into their user's cache, nothing to free here
+        return false;
+    }
+
+    const U32 num_bitmaps = mFontBitmapCachep->getNumBitmaps(EFontGlyphType::Grayscale)
+                          + mFontBitmapCachep->getNumBitmaps(EFontGlyphType::Color);
+    if (num_bitmaps < 2)
+    {
+        // one page per type is as small as the cache gets
+        return false;
+    }
+
+    // Partition the glyphs by the generation they were last requested in;
+    // anything untouched for more than one full registry pass (the character
+    // set of an old skin or locale) is dead weight in the pages.
+    std::vector<std::pair<llwchar, EFontGlyphType>> live;
+    live.reserve(mCharGlyphInfoMap.size());
+    size_t stale_count = 0;
+    for (char_glyph_info_map_t::const_iterator it = mCharGlyphInfoMap.begin(); it != mCharGlyphInfoMap.end(); ++it)
+    {
+        if (sUseGeneration - it->second->mLastUseGeneration > 1)
+        {
+            stale_count++;
+        }
+        else
+        {
+            live.push_back(std::make_pair(it->first, it->second->mGlyphType));
+        }
+    }
+
+    // only worth the re-render when a meaningful share of the pages is dead
+    if (stale_count * 4 < mCharGlyphInfoMap.size())
+    {
+        return false;
+    }
+
+    // Re-pack: free every page, then re-render the live glyphs into fresh
+    // ones through the normal addGlyph path, which rebuilds the char-to-
+    // glyph map entries every renderer resolves through.
+    resetBitmapCache();
+    for (const auto& entry : live)
+    {
+        addGlyph(entry.first, entry.second);
+    }
+
+    LL_DEBUGS("FontCompaction") << mName << " " << mPointSize << "pt: dropped "
+        << stale_count << " stale glyphs, re-packed " << live.size()
+        << " live ones, " << num_bitmaps << " -> "
+        << mFontBitmapCachep->getNumBitmaps(EFontGlyphType::Grayscale)
+            + mFontBitmapCachep->getNumBitmaps(EFontGlyphType::Color)
+        << " pages" << LL_ENDL;
+    return true;
+}
+
 void LLFontFreetype::destroyGL()
 {
     mFontBitmapCachep->destroyGL();
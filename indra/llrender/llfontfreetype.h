@@ -74,6 +74,7 @@ struct LLFontGlyphInfo
     S32 mXBearing;  // Distance from baseline to left in pixels
     S32 mYBearing;  // Distance from baseline to top in pixels
     std::pair<EFontGlyphType, S32> mBitmapEntry; // Which bitmap in the bitmap cache contains this glyph
+    U32 mLastUseGeneration; // Last LLFontFreetype::sUseGeneration this glyph was requested in
 };
 
 extern LLFontManager *gFontManagerp;
@@ -139,6 +140,16 @@ public:
 
     void reset(F32 vert_dpi, F32 horz_dpi);
 
+    // Re-pack the glyphs used in recent generations into fresh bitmap pages
+    // and free the old ones; returns true if pages were rebuilt. Run at idle
+    // so long sessions don't keep pages alive for glyphs that a departed
+    // skin or locale needed once.
+    bool compact();
+
+    // Bumped by the font registry after each full compaction pass; glyphs
+    // stamp it on use so compact() can tell live glyphs from stale ones.
+    static U32 sUseGeneration;
+
     void destroyGL();
 
     const std::string& getName() const;
@@ -568,6 +568,15 @@ void LLFontGL::generateASCIIglyphs()
     }
 }
 
+void LLFontGL::generateGlyphsInRange(llwchar first_char, llwchar last_char)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_UI;
+    for (llwchar wch = first_char; wch <= last_char; wch++)
+    {
+        mFontFreetype->getGlyphInfo(wch, EFontGlyphType::Grayscale);
+    }
+}
+
 // Returns the max number of complete characters from text (up to max_chars) that can be drawn in max_pixels
 S32 LLFontGL::maxDrawableChars(const llwchar* wchars, F32 max_pixels, S32 max_chars, EWordWrapStyle end_on_word_boundary) const
 {
@@ -902,6 +911,56 @@ void LLFontGL::loadCommonFonts()
     getFont(LLFontDescriptor("Monospace", "Medium", 0));
 }
 
+// static
+void LLFontGL::prewarmCommonGlyphs(const std::string& language)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_UI;
+
+    // ASCII is already generated per font on creation; add the bounded
+    // alphabet ranges of the active UI language so localized UI and chat
+    // don't rasterize their glyphs one stall at a time on first display.
+    // Ideographic scripts are left to demand loading -- their common set
+    // is far too large to precache.
+    std::vector<std::pair<llwchar, llwchar>> ranges;
+    ranges.emplace_back(0x00C0, 0x00FF); // Latin-1 letters, shared by the western locales
+    if (language == "ja")
+    {
+        ranges.emplace_back(0x3041, 0x30FE); // hiragana + katakana
+        ranges.emplace_back(0xFF01, 0xFF5E); // fullwidth forms
+    }
+    else if (language == "ko")
+    {
+        ranges.emplace_back(0x3131, 0x318E); // hangul compatibility jamo
+        ranges.emplace_back(0xFF01, 0xFF5E);
+    }
+    else if (language == "zh")
+    {
+        ranges.emplace_back(0x3001, 0x3011); // ideographic punctuation
+        ranges.emplace_back(0xFF01, 0xFF5E);
+    }
+    else if (language == "ru")
+    {
+        ranges.emplace_back(0x0400, 0x045F); // cyrillic
+    }
+    else if (language == "pl" || language == "tr")
+    {
+        ranges.emplace_back(0x0100, 0x017F); // latin extended-A
+    }
+
+    LLFontGL* fonts[] = { getFontSansSerifSmall(), getFontSansSerif(), getFontSansSerifBold() };
+    for (LLFontGL* fontp : fonts)
+    {
+        if (!fontp)
+        {
+            continue;
+        }
+        for (const auto& range : ranges)
+        {
+            fontp->generateGlyphsInRange(range.first, range.second);
+        }
+    }
+}
+
 // static
 void LLFontGL::destroyDefaultFonts()
 {
@@ -919,6 +978,15 @@ void LLFontGL::destroyAllGL()
     }
 }
 
+// static
+void LLFontGL::compactCaches()
+{
+    if (sFontRegistry)
+    {
+        sFontRegistry->compactOne();
+    }
+}
+
 // static
 U8 LLFontGL::getStyleFromString(const std::string &style)
 {
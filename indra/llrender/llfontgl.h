@@ -164,6 +164,7 @@ public:
     const LLFontDescriptor& getFontDesc() const;
 
     void generateASCIIglyphs();
+    void generateGlyphsInRange(llwchar first_char, llwchar last_char);
 
 
     static void initClass(F32 screen_dpi, F32 x_scale, F32 y_scale, const std::string& app_dir, bool create_gl_textures = true);
@@ -176,8 +177,14 @@ public:
     // Slow, requires multiple seconds to load fonts.
     static bool loadDefaultFonts();
     static void loadCommonFonts();
+    // Pre-rasterize the bounded glyph ranges of the active UI language into
+    // the common UI fonts, so localized text doesn't stall on FreeType the
+    // first time each string displays.
+    static void prewarmCommonGlyphs(const std::string& language);
     static void destroyDefaultFonts();
     static void destroyAllGL();
+    // Re-pack one font's glyph pages per call; see LLFontRegistry::compactOne().
+    static void compactCaches();
 
     // Takes a string with potentially several flags, i.e. "NORMAL|BOLD|ITALIC"
     static U8 getStyleFromString(const std::string &style);
@@ -30,6 +30,7 @@
 #include "llfontfreetype.h"
 #include "llfontgl.h"
 #include "llfontregistry.h"
+#include "llfontvertexbuffer.h"
 #include <boost/tokenizer.hpp>
 #include "llcontrol.h"
 #include "lldir.h"
@@ -194,7 +195,8 @@ void LLFontDescriptor::addFontCollectionFile(const std::string& file_name, const
 }
 
 LLFontRegistry::LLFontRegistry(bool create_gl_textures)
-:   mCreateGLTextures(create_gl_textures)
+:   mCreateGLTextures(create_gl_textures),
+    mCompactIndex(0)
 {
     // This is potentially a slow directory traversal, so we want to
     // cache the result.
@@ -575,6 +577,34 @@ void LLFontRegistry::reset()
     }
 }
 
+bool LLFontRegistry::compactOne()
+{
+    if (mFontMap.empty())
+    {
+        return false;
+    }
+
+    // one font per call so a single idle tick never pays for a full registry
+    // sweep; once every font has been visited, advance the use generation
+    // that glyph staleness is measured against
+    if (mCompactIndex >= mFontMap.size())
+    {
+        mCompactIndex = 0;
+        ++LLFontFreetype::sUseGeneration;
+    }
+
+    font_reg_map_t::iterator it = mFontMap.begin();
+    std::advance(it, mCompactIndex++);
+    LLFontGL* font = it->second;
+    if (font && font->mFontFreetype.notNull() && font->mFontFreetype->compact())
+    {
+        // cached glyph vertex buffers hold the old atlas coordinates
+        ++LLFontVertexBuffer::sBufferGeneration;
+        return true;
+    }
+    return false;
+}
+
 void LLFontRegistry::clear()
 {
     for (font_reg_map_t::iterator it = mFontMap.begin();
@@ -107,6 +107,11 @@ public:
     // Clear cached glyphs for all fonts.
     void reset();
 
+    // Re-pack one font's glyph bitmap pages per call (round-robin), dropping
+    // glyphs that haven't been used for a full pass over the registry.
+    // Returns true if a font was compacted.
+    bool compactOne();
+
     // Destroy all fonts.
     void clear();
 
@@ -137,6 +142,7 @@ private:
 
     string_vec_t mUltimateFallbackList;
     bool mCreateGLTextures;
+    size_t mCompactIndex;
 };
 
 #endif // LL_LLFONTREGISTRY_H
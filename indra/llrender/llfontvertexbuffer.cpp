@@ -31,6 +31,9 @@
 #include "llvertexbuffer.h"
 
 
+//static
+U32 LLFontVertexBuffer::sBufferGeneration = 0;
+
 LLFontVertexBuffer::LLFontVertexBuffer()
 {
 }
@@ -137,13 +140,20 @@ S32 LLFontVertexBuffer::render(
              || mLastShadow != shadow // ex: buttons change shadow state
              || mLastScaleX != LLFontGL::sScaleX
              || mLastScaleY != LLFontGL::sScaleY
-             || mLastOrigin != LLFontGL::sCurOrigin)
+             || mLastBufferGeneration != sBufferGeneration) // glyph pages were re-packed
     {
         genBuffers(fontp, text, begin_offset, x, y, color, halign, valign,
             style, shadow, max_chars, max_pixels, right_x, use_ellipses, use_color);
     }
     else
     {
+        if (mLastOrigin != LLFontGL::sCurOrigin
+            || mLastDepth != LLFontGL::sCurDepth)
+        {
+            // text that merely moved doesn't need new glyphs
+            translateBuffers();
+        }
+
         renderBuffers();
 
         if (right_x)
@@ -190,6 +200,8 @@ void LLFontVertexBuffer::genBuffers(
     mLastScaleX = LLFontGL::sScaleX;
     mLastScaleY = LLFontGL::sScaleY;
     mLastOrigin = LLFontGL::sCurOrigin;
+    mLastDepth = LLFontGL::sCurDepth;
+    mLastBufferGeneration = sBufferGeneration;
 
     if (right_x)
     {
@@ -197,6 +209,34 @@ void LLFontVertexBuffer::genBuffers(
     }
 }
 
+void LLFontVertexBuffer::translateBuffers()
+{
+    // The render origin enters the baked glyph vertices as a whole-pixel
+    // offset, so a change of origin or depth alone is a translation of the
+    // cached buffers, not a reason to regenerate them.  This is what keeps
+    // in-world text (name tags, hover text) from rebuilding its glyphs every
+    // frame the object or camera moves.
+    F32 dx = floorf(LLFontGL::sCurOrigin.mX * LLFontGL::sScaleX) - floorf(mLastOrigin.mX * LLFontGL::sScaleX);
+    F32 dy = floorf(LLFontGL::sCurOrigin.mY * LLFontGL::sScaleY) - floorf(mLastOrigin.mY * LLFontGL::sScaleY);
+    F32 dz = LLFontGL::sCurDepth - mLastDepth;
+
+    if (dx != 0.f || dy != 0.f || dz != 0.f)
+    {
+        glm::mat4 shift = glm::translate(glm::identity<glm::mat4>(), glm::vec3(dx, dy, 0.f));
+        for (LLVertexBufferData& buffer : mBufferList)
+        {
+            // shift the matrix the vertices go through first by the origin
+            // delta in glyph space; the depth translation lives in the
+            // outermost matrix, adjust it directly
+            buffer.mModelView = buffer.mModelView * shift;
+            buffer.mProjection[3][2] += dz;
+        }
+    }
+
+    mLastOrigin = LLFontGL::sCurOrigin;
+    mLastDepth = LLFontGL::sCurDepth;
+}
+
 void LLFontVertexBuffer::renderBuffers()
 {
     gGL.flush(); // deliberately empty pending verts
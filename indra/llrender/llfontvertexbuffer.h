@@ -40,6 +40,10 @@ public:
 
     void reset();
 
+    // Bumped when a font re-packs its glyph pages, so cached buffers built
+    // against the old atlas coordinates regenerate on next use.
+    static U32 sBufferGeneration;
+
     S32 render(const LLFontGL* fontp,
         const LLWString& text,
         S32 begin_offset,
@@ -93,6 +97,7 @@ private:
          bool use_ellipses,
          bool use_color);
 
+    void translateBuffers();
     void renderBuffers();
 
     std::list<LLVertexBufferData> mBufferList;
@@ -109,6 +114,8 @@ private:
     U8 mLastStyle = LLFontGL::NORMAL;
     LLFontGL::ShadowType mLastShadow = LLFontGL::NO_SHADOW;
     F32 mLastRightX = 0.f;
+    F32 mLastDepth = 0.f;
+    U32 mLastBufferGeneration = 0;
 
     // LLFontGL's statics
     F32 mLastScaleX = 1.f;
@@ -976,8 +976,12 @@ PFNGLTEXTUREBARRIERPROC                                  glTextureBarrier = null
 PFNGLSPECIALIZESHADERPROC                glSpecializeShader = nullptr;
 PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC    glMultiDrawArraysIndirectCount = nullptr;
 PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC  glMultiDrawElementsIndirectCount = nullptr;
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC     glMaxShaderCompilerThreadsKHR = nullptr;
 PFNGLPOLYGONOFFSETCLAMPPROC              glPolygonOffsetClamp = nullptr;
 
+// GL_ARB_sparse_texture
+PFNGLTEXPAGECOMMITMENTARBPROC            glTexPageCommitmentARB = nullptr;
+
 #endif
 
 LLGLManager gGLManager;
@@ -1428,6 +1432,7 @@ void LLGLManager::initExtensions()
     mHasCubeMapArray = mGLVersion >= 3.99f;
     mHasTransformFeedback = mGLVersion >= 3.99f;
     mHasDebugOutput = mGLVersion >= 4.29f;
+    mHasSparseTextures = mGLVersion >= 4.29f && ExtensionExists("GL_ARB_sparse_texture", gGLHExts.mSysExts);
 
     // Misc
     glGetIntegerv(GL_MAX_ELEMENTS_VERTICES, (GLint*) &mGLMaxVertexRange);
@@ -1457,6 +1462,10 @@ void LLGLManager::initExtensions()
     // WGL_ARB_create_context
     wglCreateContextAttribsARB = (PFNWGLCREATECONTEXTATTRIBSARBPROC)GLH_EXT_GET_PROC_ADDRESS("wglCreateContextAttribsARB");
 
+    // GL_ARB_sparse_texture
+    glTexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC)GLH_EXT_GET_PROC_ADDRESS("glTexPageCommitmentARB");
+    mHasSparseTextures = mHasSparseTextures && glTexPageCommitmentARB != nullptr;
+
     // Load entire OpenGL API through GetProcAddress, leaving sections beyond mGLVersion unloaded
 
     // GL_VERSION_1_2
@@ -2272,6 +2281,15 @@ void LLGLManager::initExtensions()
     glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)GLH_EXT_GET_PROC_ADDRESS("glMultiDrawElementsIndirectCount");
     glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)GLH_EXT_GET_PROC_ADDRESS("glPolygonOffsetClamp");
 
+    // GL_KHR_parallel_shader_compile
+    glMaxShaderCompilerThreadsKHR = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)GLH_EXT_GET_PROC_ADDRESS("glMaxShaderCompilerThreadsKHR");
+    mHasParallelShaderCompile = glMaxShaderCompilerThreadsKHR != nullptr &&
+        ExtensionExists("GL_KHR_parallel_shader_compile", gGLHExts.mSysExts);
+    if (mHasParallelShaderCompile)
+    { // let the driver spin up as many compiler threads as it likes
+        glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+    }
+
 #endif
 }
 
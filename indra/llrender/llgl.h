@@ -96,8 +96,10 @@ public:
     bool mHasAnisotropic = false;
 
     // Vendor-specific extensions
+    bool mHasParallelShaderCompile = false;
     bool mHasAMDAssociations = false;
     bool mHasNVXGpuMemoryInfo = false;
+    bool mHasSparseTextures = false;
 
     bool mIsAMD;
     bool mIsNVIDIA;
@@ -828,6 +828,12 @@ extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC    glMultiDrawArraysIndirectCount;
 extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC  glMultiDrawElementsIndirectCount;
 extern PFNGLPOLYGONOFFSETCLAMPPROC              glPolygonOffsetClamp;
 
+// GL_KHR_parallel_shader_compile
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC     glMaxShaderCompilerThreadsKHR;
+
+// GL_ARB_sparse_texture
+extern PFNGLTEXPAGECOMMITMENTARBPROC            glTexPageCommitmentARB;
+
 
 #elif LL_DARWIN
 //----------------------------------------------------------------------------
@@ -1095,6 +1101,13 @@ extern void glGetBufferPointervARB (GLenum, GLenum, GLvoid* *);
 #define GL_RENDERBUFFER_FREE_MEMORY_ATI            0x87FD
 #endif
 
+//GL_ARB_sparse_texture constants
+#ifndef GL_TEXTURE_SPARSE_ARB
+#define GL_TEXTURE_SPARSE_ARB                      0x91A6
+#define GL_VIRTUAL_PAGE_SIZE_INDEX_ARB             0x91A7
+#define GL_NUM_SPARSE_LEVELS_ARB                   0x91AA
+#endif
+
 #if defined(TRACY_ENABLE) && LL_PROFILER_ENABLE_TRACY_OPENGL
     #include <tracy/TracyOpenGL.hpp>
 #endif
@@ -57,6 +57,7 @@ S32 LLGLSLShader::sIndexedTextureChannels = 0;
 U32 LLGLSLShader::sMaxGLTFMaterials = 0;
 U32 LLGLSLShader::sMaxGLTFNodes = 0;
 bool LLGLSLShader::sProfileEnabled = false;
+bool LLGLSLShader::sDeferLinkFinalize = false;
 std::set<LLGLSLShader*> LLGLSLShader::sInstances;
 LLGLSLShader::defines_map_t LLGLSLShader::sGlobalDefines;
 U64 LLGLSLShader::sTotalTimeElapsed = 0;
@@ -360,6 +361,7 @@ void LLGLSLShader::unloadInternal()
     mAttribute.clear();
     mTexture.clear();
     mUniform.clear();
+    mLinkPending = false;
 
     if (mProgramObject)
     {
@@ -470,6 +472,89 @@ bool LLGLSLShader::createShader()
         unloadInternal();
         return false;
     }
+
+    if (success && !mUsingBinaryProgram && sDeferLinkFinalize)
+    {
+        // issue the link now, but defer status checks and uniform mapping to
+        // the first bind (or explicit finalizeShader call).  With
+        // KHR_parallel_shader_compile the driver links on its own threads, so
+        // issuing every program up front lets compilation overlap instead of
+        // blocking on each program in turn.
+        for (U32 i = 0; i < LLShaderMgr::instance()->mReservedAttribs.size(); i++)
+        {
+            const char* name = LLShaderMgr::instance()->mReservedAttribs[i].c_str();
+            glBindAttribLocation(mProgramObject, i, (const GLchar*)name);
+        }
+        glLinkProgram(mProgramObject);
+        mLinkPending = true;
+        return true;
+    }
+
+    return finalizeShader();
+}
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// static
+void LLGLSLShader::finalizePendingLinks(F32 max_seconds)
+{
+    if (!sDeferLinkFinalize)
+    {
+        return;
+    }
+
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_SHADER;
+
+    // snapshot first -- a failed finalize can fall back through paths that
+    // touch sInstances
+    static std::vector<LLGLSLShader*> pending;
+    pending.resize(0);
+    for (LLGLSLShader* shader : sInstances)
+    {
+        if (shader->mLinkPending && shader->mProgramObject)
+        {
+            pending.push_back(shader);
+        }
+    }
+
+    LLTimer timer;
+
+    for (LLGLSLShader* shader : pending)
+    {
+        if (gGLManager.mHasParallelShaderCompile)
+        {
+            GLint done = GL_FALSE;
+            glGetProgramiv(shader->mProgramObject, GL_COMPLETION_STATUS_KHR, &done);
+            if (!done)
+            { // still linking on a driver thread -- finalizing now would block
+                continue;
+            }
+        }
+
+        while (shader->mLinkPending)
+        { // loop like bind() -- a failed link can retry at a lower shader
+          // level and re-defer
+            shader->finalizeShader();
+        }
+
+        if (timer.getElapsedTimeF32() > max_seconds)
+        {
+            break;
+        }
+    }
+}
+
+// second half of createShader -- harvest link results and map attributes and
+// uniforms.  Runs inline for the serial path, or lazily from the first bind
+// when link finalization was deferred.
+bool LLGLSLShader::finalizeShader()
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_SHADER;
+
+    bool success = true;
+
     // Map attributes and uniforms
     if (success)
     {
@@ -651,14 +736,17 @@ bool LLGLSLShader::mapAttributes()
     bool res = true;
     if (!mUsingBinaryProgram)
     {
-        //before linking, make sure reserved attributes always have consistent locations
-        for (U32 i = 0; i < LLShaderMgr::instance()->mReservedAttribs.size(); i++)
+        if (!mLinkPending)
         {
-            const char* name = LLShaderMgr::instance()->mReservedAttribs[i].c_str();
-            glBindAttribLocation(mProgramObject, i, (const GLchar*)name);
+            //before linking, make sure reserved attributes always have consistent locations
+            for (U32 i = 0; i < LLShaderMgr::instance()->mReservedAttribs.size(); i++)
+            {
+                const char* name = LLShaderMgr::instance()->mReservedAttribs[i].c_str();
+                glBindAttribLocation(mProgramObject, i, (const GLchar*)name);
+            }
         }
 
-        //link the program
+        //link the program (or harvest the result of a link issued earlier)
         res = link();
     }
 
@@ -1027,7 +1115,16 @@ bool LLGLSLShader::link(bool suppress_errors)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_SHADER;
 
-    bool success = LLShaderMgr::instance()->linkProgramObject(mProgramObject, suppress_errors);
+    bool success;
+    if (mLinkPending)
+    { // glLinkProgram was issued at createShader time -- just check status
+        mLinkPending = false;
+        success = LLShaderMgr::instance()->checkProgramLinkStatus(mProgramObject, suppress_errors);
+    }
+    else
+    {
+        success = LLShaderMgr::instance()->linkProgramObject(mProgramObject, suppress_errors);
+    }
 
     if (!success && !suppress_errors)
     {
@@ -1048,6 +1145,13 @@ void LLGLSLShader::bind()
 
     llassert(mProgramObject != 0);
 
+    while (mLinkPending)
+    { // first use of a program whose link was issued but never finalized.
+      // Loop because a failed link can retry at a lower shader level and
+      // re-defer.
+        finalizeShader();
+    }
+
     gGL.flush();
 
     if (sCurBoundShader != mProgramObject)  // Don't re-bind current shader
@@ -2021,6 +2125,10 @@ LLUUID LLGLSLShader::hash()
     {
         hash_obj.update(shdr_pair.first);
         hash_obj.update(&shdr_pair.second, sizeof(GLenum));
+        // key on the source itself so edited shader files invalidate any
+        // cached program binary built from the old text
+        U64 src_hash = LLShaderMgr::instance()->getShaderSourceHash(shdr_pair.first, mShaderLevel);
+        hash_obj.update(&src_hash, sizeof(src_hash));
     }
     for (const auto& define_pair : mDefines)
     {
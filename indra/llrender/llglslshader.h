@@ -159,6 +159,17 @@ public:
     static std::set<LLGLSLShader*> sInstances;
     static bool sProfileEnabled;
 
+    // issue all program links up front and finalize them as they're first
+    // used -- only effective when the driver compiles in parallel
+    // (GL_KHR_parallel_shader_compile)
+    static bool sDeferLinkFinalize;
+
+    // background warm-up for deferred links: finalize programs whose driver
+    // link has completed (GL_COMPLETION_STATUS_KHR) so first use doesn't
+    // hitch mid-scene.  Call once per frame at idle; spends at most
+    // max_seconds and never blocks on an unfinished link.
+    static void finalizePendingLinks(F32 max_seconds);
+
     LLGLSLShader();
     ~LLGLSLShader();
 
@@ -190,6 +201,10 @@ public:
     bool readProfileQuery(bool for_runtime = false, bool force_read = false);
 
     bool createShader();
+    // harvest link results and map attributes/uniforms -- split out of
+    // createShader so linking can be finalized lazily when
+    // sDeferLinkFinalize is set (see KHR_parallel_shader_compile)
+    bool finalizeShader();
     bool attachFragmentObject(std::string object);
     bool attachVertexObject(std::string object);
     void attachObject(GLuint object);
@@ -316,6 +331,7 @@ public:
     static defines_map_t sGlobalDefines;
     LLUUID mShaderHash;
     bool mUsingBinaryProgram = false;
+    bool mLinkPending = false;
 
     //statistics for profiling shader performance
     bool mProfilePending = false;
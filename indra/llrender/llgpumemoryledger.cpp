@@ -0,0 +1,123 @@
+/**
+ * @file llgpumemoryledger.cpp
+ * @brief Central accounting of GPU memory claimed by render allocations
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "linden_common.h"
+
+#include "llgpumemoryledger.h"
+
+#include "lltimer.h"
+
+std::atomic<U64> LLGPUMemoryLedger::sCategoryBytes[LLGPUMemoryLedger::CAT_COUNT];
+U64 LLGPUMemoryLedger::sBudgetBytes = 0;
+LLGPUMemoryLedger::eviction_callback_t LLGPUMemoryLedger::sEvictionCallback = nullptr;
+
+// static
+void LLGPUMemoryLedger::claim(ECategory category, U64 bytes)
+{
+    llassert(category < CAT_COUNT);
+    sCategoryBytes[category] += bytes;
+}
+
+// static
+void LLGPUMemoryLedger::release(ECategory category, U64 bytes)
+{
+    llassert(category < CAT_COUNT);
+    llassert(sCategoryBytes[category] >= bytes); // ledger MUST NOT go below zero
+    sCategoryBytes[category] -= bytes;
+}
+
+// static
+U64 LLGPUMemoryLedger::getBytes(ECategory category)
+{
+    llassert(category < CAT_COUNT);
+    return sCategoryBytes[category];
+}
+
+// static
+U64 LLGPUMemoryLedger::getTotalBytes()
+{
+    U64 total = 0;
+    for (U32 i = 0; i < CAT_COUNT; ++i)
+    {
+        total += sCategoryBytes[i];
+    }
+    return total;
+}
+
+// static
+const char* LLGPUMemoryLedger::getCategoryName(ECategory category)
+{
+    switch (category)
+    {
+        case CAT_TEXTURE:       return "texture";
+        case CAT_VERTEX_BUFFER: return "vertex buffer";
+        case CAT_RENDER_TARGET: return "render target";
+        default:                return "unknown";
+    }
+}
+
+// static
+void LLGPUMemoryLedger::setBudget(U64 budget_bytes, eviction_callback_t callback)
+{
+    sBudgetBytes = budget_bytes;
+    sEvictionCallback = callback;
+}
+
+// static
+void LLGPUMemoryLedger::checkBudget()
+{
+    if (sBudgetBytes == 0 || sEvictionCallback == nullptr)
+    {
+        return;
+    }
+
+    U64 total = getTotalBytes();
+    if (total <= sBudgetBytes)
+    {
+        return;
+    }
+
+    // eviction takes a few frames to show up in the totals; don't spam the
+    // callback every frame in the meantime
+    constexpr F32 MIN_CALLBACK_INTERVAL = 1.f; // seconds
+    static LLTimer throttle;
+    if (throttle.getElapsedTimeF32() < MIN_CALLBACK_INTERVAL)
+    {
+        return;
+    }
+    throttle.reset();
+
+    // hand the deepest category to the callback
+    ECategory biggest = CAT_TEXTURE;
+    for (U32 i = 1; i < CAT_COUNT; ++i)
+    {
+        if (sCategoryBytes[i] > sCategoryBytes[biggest])
+        {
+            biggest = (ECategory)i;
+        }
+    }
+    sEvictionCallback(biggest, total, sBudgetBytes);
+}
@@ -0,0 +1,74 @@
+/**
+ * @file llgpumemoryledger.h
+ * @brief Central accounting of GPU memory claimed by render allocations
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLGPUMEMORYLEDGER_H
+#define LL_LLGPUMEMORYLEDGER_H
+
+#include "stdtypes.h"
+
+#include <atomic>
+
+// Per-category ledger of GPU memory claimed by the render subsystems.
+// LLImageGL, LLVertexBuffer and LLRenderTarget register every allocation
+// and free here so the totals can be trended via LLTrace and compared
+// against an optional budget, instead of being re-derived from scattered
+// per-class counters. Thread safe; texture uploads can run off the main
+// thread.
+class LLGPUMemoryLedger
+{
+public:
+    enum ECategory : U32
+    {
+        CAT_TEXTURE = 0,        // LLImageGL texture images
+        CAT_VERTEX_BUFFER,      // LLVertexBuffer VBO/IBO storage
+        CAT_RENDER_TARGET,      // LLRenderTarget color/depth attachments
+        CAT_COUNT
+    };
+
+    static void claim(ECategory category, U64 bytes);
+    static void release(ECategory category, U64 bytes);
+
+    static U64 getBytes(ECategory category);
+    static U64 getTotalBytes();
+    static const char* getCategoryName(ECategory category);
+
+    // Optional budget: when the ledger total exceeds budget_bytes,
+    // checkBudget() hands the largest category to the callback so the
+    // caller can evict before the driver starts paging. A budget of 0
+    // disables the check.
+    typedef void (*eviction_callback_t)(ECategory category, U64 used_bytes, U64 budget_bytes);
+    static void setBudget(U64 budget_bytes, eviction_callback_t callback);
+
+    // called once per main loop iteration
+    static void checkBudget();
+
+private:
+    static std::atomic<U64> sCategoryBytes[CAT_COUNT];
+    static U64 sBudgetBytes;
+    static eviction_callback_t sEvictionCallback;
+};
+
+#endif // LL_LLGPUMEMORYLEDGER_H
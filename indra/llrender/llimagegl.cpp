@@ -34,10 +34,12 @@
 #include "llerror.h"
 #include "llfasttimer.h"
 #include "llimage.h"
+#include "llimagedxt.h"
 
 #include "llmath.h"
 #include "llgl.h"
 #include "llglslshader.h"
+#include "llgpumemoryledger.h"
 #include "llrender.h"
 #include "llwindow.h"
 #include "llframetimer.h"
@@ -86,11 +88,14 @@ void LLImageGLMemory::alloc_tex_image(U32 width, U32 height, U32 intformat, U32
     sTextureBytes += size;
 
     sTexMemMutex.unlock();
+
+    LLGPUMemoryLedger::claim(LLGPUMemoryLedger::CAT_TEXTURE, size);
 }
 
 // track texture free on given texName
 void LLImageGLMemory::free_tex_image(U32 texName)
 {
+    U64 freed = 0;
     sTexMemMutex.lock();
     auto iter = sTextureAllocs.find(texName);
     if (iter != sTextureAllocs.end()) // sometimes a texName will be "freed" before allocated (e.g. first call to setManualImage for a given texName)
@@ -98,11 +103,17 @@ void LLImageGLMemory::free_tex_image(U32 texName)
         llassert(iter->second <= sTextureBytes); // sTextureBytes MUST NOT go below zero
 
         sTextureBytes -= iter->second;
+        freed = iter->second;
 
         sTextureAllocs.erase(iter);
     }
 
     sTexMemMutex.unlock();
+
+    if (freed)
+    {
+        LLGPUMemoryLedger::release(LLGPUMemoryLedger::CAT_TEXTURE, freed);
+    }
 }
 
 // track texture free on given texNames
@@ -141,11 +152,13 @@ bool LLImageGL::sGlobalUseAnisotropic   = false;
 F32 LLImageGL::sLastFrameTime           = 0.f;
 LLImageGL* LLImageGL::sDefaultGLTexture = NULL ;
 bool LLImageGL::sCompressTextures = false;
+bool LLImageGL::sCompressTexturesCPU = true;
 std::unordered_set<LLImageGL*> LLImageGL::sImageList;
 
 
 bool LLImageGLThread::sEnabledTextures = false;
 bool LLImageGLThread::sEnabledMedia = false;
+bool LLImageGLThread::sEnabledBuffers = false;
 
 //****************************************************************************************************
 //The below for texture auditing use only
@@ -161,6 +174,163 @@ bool LLImageGL::sSkipAnalyzeAlpha;
 U32  LLImageGL::sScratchPBO = 0;
 U32  LLImageGL::sScratchPBOSize = 0;
 
+bool LLImageGL::sUsePBOUploadRing = false;
+bool LLImageGL::sUseSparseTextures = false;
+
+namespace
+{
+    // Ring of persistent-mapped pixel unpack buffers used to stream texel data
+    // to the driver.  Sourcing glTexImage2D from a PBO returns as soon as the
+    // command is queued instead of blocking while the driver copies out of
+    // client memory, which is where most of the texture-arrival hitch goes.
+    // Slot reuse is gated on a fence so we never scribble over an upload that
+    // is still in flight; when the whole ring is busy the caller falls back to
+    // the direct path rather than stalling.
+    constexpr U32 UPLOAD_PBO_COUNT = 4;
+    constexpr U32 UPLOAD_PBO_SIZE = 16 * 1024 * 1024; // covers 2048x2048 RGBA
+
+    // guards ring slot bookkeeping; uploads may come from the main thread or
+    // the media texture update thread (shared GL context, shared sync objects)
+    LLMutex gUploadPBOMutex;
+
+    struct UploadPBO
+    {
+        bool mBusy = false;
+        U32 mPBO = 0;
+        U8* mMapped = nullptr;
+        GLsync mFence = 0;
+    };
+
+    UploadPBO gUploadPBOs[UPLOAD_PBO_COUNT];
+    U32 gUploadPBOIndex = 0;
+    bool gUploadPBOsInitialized = false;
+
+    void cleanup_upload_pbos()
+    {
+        for (U32 i = 0; i < UPLOAD_PBO_COUNT; ++i)
+        {
+            UploadPBO& pbo = gUploadPBOs[i];
+            if (pbo.mFence)
+            {
+                glDeleteSync(pbo.mFence);
+                pbo.mFence = 0;
+            }
+            if (pbo.mPBO)
+            {
+                if (pbo.mMapped)
+                {
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.mPBO);
+                    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                    pbo.mMapped = nullptr;
+                }
+                glDeleteBuffers(1, &pbo.mPBO);
+                pbo.mPBO = 0;
+            }
+        }
+        gUploadPBOsInitialized = false;
+    }
+
+    bool init_upload_pbos()
+    {
+        if (gUploadPBOsInitialized)
+        {
+            return gUploadPBOs[0].mMapped != nullptr;
+        }
+
+        gUploadPBOsInitialized = true;
+
+        if (gGLManager.mGLVersion < 4.39f)
+        { // persistent mapping requires GL 4.4
+            return false;
+        }
+
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        for (U32 i = 0; i < UPLOAD_PBO_COUNT; ++i)
+        {
+            UploadPBO& pbo = gUploadPBOs[i];
+            glGenBuffers(1, &pbo.mPBO);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo.mPBO);
+            glBufferStorage(GL_PIXEL_UNPACK_BUFFER, UPLOAD_PBO_SIZE, nullptr, flags);
+            pbo.mMapped = (U8*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, UPLOAD_PBO_SIZE, flags);
+            if (!pbo.mMapped)
+            {
+                LL_WARNS() << "Failed to map upload PBO, disabling PBO upload ring" << LL_ENDL;
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                cleanup_upload_pbos();
+                gUploadPBOsInitialized = true;
+                return false;
+            }
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return true;
+    }
+
+    // next ring slot whose previous upload has drained, or NULL if the whole
+    // ring is still in flight; the slot is held until release_upload_pbo()
+    UploadPBO* acquire_upload_pbo()
+    {
+        LLMutexLock lock(&gUploadPBOMutex);
+
+        if (!init_upload_pbos())
+        {
+            return nullptr;
+        }
+
+        for (U32 attempt = 0; attempt < UPLOAD_PBO_COUNT; ++attempt)
+        {
+            UploadPBO& pbo = gUploadPBOs[gUploadPBOIndex];
+            gUploadPBOIndex = (gUploadPBOIndex + 1) % UPLOAD_PBO_COUNT;
+            if (pbo.mBusy)
+            {
+                continue;
+            }
+            if (pbo.mFence)
+            {
+                GLenum status = glClientWaitSync(pbo.mFence, 0, 0);
+                if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                {
+                    continue;
+                }
+                glDeleteSync(pbo.mFence);
+                pbo.mFence = 0;
+            }
+            pbo.mBusy = true;
+            return &pbo;
+        }
+        return nullptr;
+    }
+
+    // call on the uploading thread right after the GL transfer is issued
+    void release_upload_pbo(UploadPBO* pbo)
+    {
+        LLMutexLock lock(&gUploadPBOMutex);
+        pbo->mFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pbo->mBusy = false;
+    }
+
+    S32 upload_bytes_per_pixel(U32 pixformat, U32 pixtype)
+    {
+        if (pixtype != GL_UNSIGNED_BYTE)
+        {
+            return 0;
+        }
+        switch (pixformat)
+        {
+        case GL_RED:
+        case GL_ALPHA:
+        case GL_LUMINANCE:          return 1;
+        case GL_RG:
+        case GL_LUMINANCE_ALPHA:    return 2;
+        case GL_RGB:
+        case GL_BGR:                return 3;
+        case GL_RGBA:
+        case GL_BGRA:               return 4;
+        default:                    return 0;
+        }
+    }
+}
+
 
 //------------------------
 //****************************************************************************************************
@@ -244,7 +414,7 @@ bool is_little_endian()
 }
 
 //static
-void LLImageGL::initClass(LLWindow* window, S32 num_catagories, bool skip_analyze_alpha /* = false */, bool thread_texture_loads /* = false */, bool thread_media_updates /* = false */)
+void LLImageGL::initClass(LLWindow* window, S32 num_catagories, bool skip_analyze_alpha /* = false */, bool thread_texture_loads /* = false */, bool thread_media_updates /* = false */, bool thread_buffer_streaming /* = false */)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
     sSkipAnalyzeAlpha = skip_analyze_alpha;
@@ -254,11 +424,12 @@ void LLImageGL::initClass(LLWindow* window, S32 num_catagories, bool skip_analyz
         glGenBuffers(1, &sScratchPBO);
     }
 
-    if (thread_texture_loads || thread_media_updates)
+    if (thread_texture_loads || thread_media_updates || thread_buffer_streaming)
     {
         LLImageGLThread::createInstance(window);
         LLImageGLThread::sEnabledTextures = thread_texture_loads;
         LLImageGLThread::sEnabledMedia = thread_media_updates;
+        LLImageGLThread::sEnabledBuffers = thread_buffer_streaming;
     }
 }
 
@@ -273,6 +444,7 @@ void LLImageGL::cleanupClass()
         sScratchPBO = 0;
         sScratchPBOSize = 0;
     }
+    cleanup_upload_pbos();
 }
 
 
@@ -799,7 +971,10 @@ bool LLImageGL::setImage(const U8* data_in, bool data_hasmips /* = false */, S32
         }
         else if (!is_compressed)
         {
-            if (mAutoGenMips)
+            // Push only the base level and let the GPU build the mip chain;
+            // the CPU downsample loop below survives for the rare formats
+            // glGenerateMipmap can't filter.
+            if (mAutoGenMips || canGPUGenerateMips())
             {
                 stop_glerror();
                 {
@@ -1154,6 +1329,44 @@ bool LLImageGL::setSubImage(const U8* datap, S32 data_width, S32 data_height, S3
         }
 
 
+        S32 bpp = upload_bytes_per_pixel(mFormatPrimary, mFormatType);
+        S64 bytes = (S64)width * height * bpp;
+        if (sUsePBOUploadRing && !isCompressed() && !mFormatSwapBytes &&
+            bpp > 0 && bytes <= UPLOAD_PBO_SIZE)
+        {
+            UploadPBO* pbo = acquire_upload_pbo();
+            if (pbo)
+            { // pack the dirty rect into a persistent-mapped PBO so the driver
+              // sources the copy asynchronously instead of draining client
+              // memory before each glTexSubImage2D returns (media updates in
+              // particular hit this path once per dirty rect per frame)
+                LL_PROFILE_ZONE_NAMED("glTexSubImage2D pbo");
+                const U8* src = datap + (y_pos * data_width + x_pos) * bpp;
+                U8* dst = pbo->mMapped;
+                const size_t src_stride = (size_t)data_width * bpp;
+                const size_t dst_stride = (size_t)width * bpp;
+                for (S32 row = 0; row < height; ++row)
+                {
+                    memcpy((void*)dst, (const void*)src, dst_stride);
+                    src += src_stride;
+                    dst += dst_stride;
+                }
+
+                bool res = gGL.getTexUnit(0)->bindManual(mBindTarget, tex_name);
+                if (!res) LL_ERRS() << "LLImageGL::setSubImage(): bindTexture failed" << LL_ENDL;
+
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo->mPBO);
+                glTexSubImage2D(mTarget, 0, x_pos, y_pos, width, height, mFormatPrimary, mFormatType, nullptr);
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+                release_upload_pbo(pbo);
+
+                gGL.getTexUnit(0)->disable();
+                stop_glerror();
+                mGLTextureCreated = true;
+                return true;
+            }
+        }
+
         glPixelStorei(GL_UNPACK_ROW_LENGTH, data_width);
         stop_glerror();
 
@@ -1407,6 +1620,70 @@ void LLImageGL::setManualImage(U32 target, S32 miplevel, S32 intformat, S32 widt
     }
 
     const bool compress = LLImageGL::sCompressTextures && allow_compression;
+    if (compress && sCompressTexturesCPU && pixels != nullptr && pixtype == GL_UNSIGNED_BYTE)
+    {
+        // encode the BC blocks ourselves - usually on the GL worker thread -
+        // instead of handing the driver an uncompressed image with a
+        // GL_COMPRESSED_* internal format; driver-side encoders run
+        // synchronously inside the upload call and quality varies by vendor
+        GLenum compressed_format = 0;
+        bool has_alpha = false;
+        switch (intformat)
+        {
+        case GL_RGB:
+        case GL_RGB8:
+            compressed_format = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+            break;
+        case GL_SRGB:
+        case GL_SRGB8:
+            compressed_format = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+            break;
+        case GL_RGBA:
+        case GL_RGBA8:
+            compressed_format = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+            has_alpha = true;
+            break;
+        case GL_SRGB_ALPHA:
+        case GL_SRGB8_ALPHA8:
+            compressed_format = GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+            has_alpha = true;
+            break;
+        default:
+            // unhandled layout; fall through to the driver-side path below
+            break;
+        }
+        S32 components = (pixformat == GL_RGB) ? 3 : (pixformat == GL_RGBA) ? 4 : 0;
+        if (compressed_format && components)
+        {
+            LLImageDXT::EFileFormat block_format = has_alpha ? LLImageDXT::FORMAT_DXT5 : LLImageDXT::FORMAT_DXT1;
+            S32 bytes = LLImageDXT::encodedBlockBytes(block_format, width, height);
+            std::unique_ptr<U8[]> blocks(new(std::nothrow) U8[bytes]);
+            if (blocks)
+            {
+                {
+                    LL_PROFILE_ZONE_NAMED("setManualImage - BC encode");
+                    LL_PROFILE_ZONE_NUM(width);
+                    LL_PROFILE_ZONE_NUM(height);
+                    if (has_alpha)
+                    {
+                        LLImageDXT::encodeBC3(blocks.get(), (const U8*)pixels, width, height, components);
+                    }
+                    else
+                    {
+                        LLImageDXT::encodeBC1(blocks.get(), (const U8*)pixels, width, height, components);
+                    }
+                }
+                free_cur_tex_image();
+                {
+                    LL_PROFILE_ZONE_NAMED("glCompressedTexImage2D");
+                    glCompressedTexImage2D(target, miplevel, compressed_format, width, height, 0, bytes, blocks.get());
+                }
+                alloc_tex_image(width, height, compressed_format, 1);
+                stop_glerror();
+                return;
+            }
+        }
+    }
     if (compress)
     {
         switch (intformat)
@@ -1460,8 +1737,29 @@ void LLImageGL::setManualImage(U32 target, S32 miplevel, S32 intformat, S32 widt
         LL_PROFILE_ZONE_NUM(height);
 
         free_cur_tex_image();
+
+        UploadPBO* pbo = nullptr;
+        S32 bpp = upload_bytes_per_pixel(pixformat, pixtype);
+        S64 bytes = (S64)width * height * bpp;
+        if (sUsePBOUploadRing && pixels && !compress && bpp > 0 &&
+            bytes <= UPLOAD_PBO_SIZE && on_main_thread())
+        {
+            pbo = acquire_upload_pbo();
+        }
+
         const bool use_sub_image = should_stagger_image_set(compress);
-        if (!use_sub_image)
+        if (pbo)
+        { // stream the texel data through a persistent-mapped PBO so the
+          // driver sources the copy asynchronously instead of draining client
+          // memory before glTexImage2D returns
+            LL_PROFILE_ZONE_NAMED("glTexImage2D pbo");
+            memcpy((void*)pbo->mMapped, (const void*)pixels, (size_t)bytes);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo->mPBO);
+            glTexImage2D(target, miplevel, intformat, width, height, 0, pixformat, pixtype, nullptr);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            release_upload_pbo(pbo);
+        }
+        else if (!use_sub_image)
         {
             LL_PROFILE_ZONE_NAMED("glTexImage2D alloc + copy");
             glTexImage2D(target, miplevel, intformat, width, height, 0, pixformat, pixtype, pixels);
@@ -1647,6 +1945,16 @@ bool LLImageGL::createGLTexture(S32 discard_level, const U8* data_in, bool data_
     }
     discard_level = llclamp(discard_level, 0, (S32)mMaxDiscardLevel);
 
+    if (sUseSparseTextures && main_thread && !defer_copy &&
+        usename == 0 && data_in && !data_hasmips)
+    {
+        if (createSparseTexture(discard_level, data_in, tex_name))
+        {
+            return true;
+        }
+        //not eligible for sparse storage, fall through to the standard path
+    }
+
     if (main_thread // <--- always force creation of new_texname when not on main thread ...
         && !defer_copy // <--- ... or defer copy is set
         && mTexName != 0 && discard_level == mCurrentDiscardLevel)
@@ -1720,6 +2028,7 @@ bool LLImageGL::createGLTexture(S32 discard_level, const U8* data_in, bool data_
                 LLImageGL::deleteTextures(1, &old_texname);
             }
             mTexName = new_texname;
+            mSparse = false;
         }
     }
 
@@ -1733,6 +2042,136 @@ bool LLImageGL::createGLTexture(S32 discard_level, const U8* data_in, bool data_
     return true;
 }
 
+bool LLImageGL::createSparseTexture(S32 discard_level, const U8* data_in, LLGLuint* tex_name)
+{
+#if LL_DARWIN
+    return false; // ARB_sparse_texture is not available on macOS
+#else
+    if (!gGLManager.mHasSparseTextures ||
+        mTarget != GL_TEXTURE_2D ||
+        !mUseMipMaps ||
+        mFormatSwapBytes ||
+        mFormatType != GL_UNSIGNED_BYTE ||
+        isCompressed() ||
+        !check_power_of_two(mWidth) ||
+        !check_power_of_two(mHeight))
+    {
+        return false;
+    }
+
+    switch (mFormatInternal)
+    { // immutable storage requires a sized internal format
+    case GL_R8:
+    case GL_RG8:
+    case GL_RGB8:
+    case GL_RGBA8:
+    case GL_SRGB8:
+    case GL_SRGB8_ALPHA8:
+        break;
+    default:
+        return false;
+    }
+
+    // full mip chain for the discard 0 dimensions
+    S32 levels = 1;
+    while ((mWidth >> levels) > 0 || (mHeight >> levels) > 0)
+    {
+        ++levels;
+    }
+
+    if (discard_level >= levels)
+    {
+        return false;
+    }
+
+    if (mTexName != 0 && (!mSparse || mSparseLevels != levels))
+    { // existing allocation is not reusable
+        destroyGLTexture();
+    }
+
+    if (mTexName == 0)
+    {
+        LLImageGL::generateTextures(1, &mTexName);
+        gGL.getTexUnit(0)->bind(this, false, false, mTexName);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SPARSE_ARB, GL_TRUE);
+        glTexParameteri(GL_TEXTURE_2D, GL_VIRTUAL_PAGE_SIZE_INDEX_ARB, 0);
+        glTexStorage2D(GL_TEXTURE_2D, levels, mFormatInternal, mWidth, mHeight);
+        if (glGetError() != GL_NO_ERROR)
+        { // driver refused the sparse allocation; fall back to the standard path
+            destroyGLTexture();
+            gGL.getTexUnit(0)->unbind(mBindTarget);
+            return false;
+        }
+        mSparse = true;
+        mSparseLevels = (S8)levels;
+        mSparseCommitLevel = (S8)levels; // nothing committed yet
+    }
+    else
+    {
+        gGL.getTexUnit(0)->bind(this, false, false, mTexName);
+    }
+
+    // levels past GL_NUM_SPARSE_LEVELS_ARB (the packed mip tail) are always
+    // resident and must not be committed explicitly
+    GLint sparse_levels = 0;
+    glGetTexParameteriv(GL_TEXTURE_2D, GL_NUM_SPARSE_LEVELS_ARB, &sparse_levels);
+    sparse_levels = llmin((GLint)levels, sparse_levels);
+
+    S32 new_commit = llmin(discard_level, (S32)sparse_levels);
+    for (S32 i = new_commit; i < mSparseCommitLevel; ++i)
+    { // commit pages for newly resident levels
+        glTexPageCommitmentARB(GL_TEXTURE_2D, i, 0, 0, 0,
+                               llmax(mWidth >> i, 1), llmax(mHeight >> i, 1), 1, GL_TRUE);
+    }
+    for (S32 i = mSparseCommitLevel; i < new_commit; ++i)
+    { // release pages above the new discard level
+        glTexPageCommitmentARB(GL_TEXTURE_2D, i, 0, 0, 0,
+                               llmax(mWidth >> i, 1), llmax(mHeight >> i, 1), 1, GL_FALSE);
+    }
+    if (mSparseCommitLevel != new_commit)
+    {
+        free_cur_tex_image();
+        alloc_tex_image(llmax(mWidth >> new_commit, 1), llmax(mHeight >> new_commit, 1), mFormatInternal, 1);
+    }
+    mSparseCommitLevel = (S8)new_commit;
+
+    // upload the new base mip and regenerate the tail from it
+    S32 w = llmax(mWidth >> discard_level, 1);
+    S32 h = llmax(mHeight >> discard_level, 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, discard_level);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+    glTexSubImage2D(GL_TEXTURE_2D, discard_level, 0, 0, w, h, mFormatPrimary, mFormatType, data_in);
+    if (discard_level < levels - 1)
+    {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
+    stop_glerror();
+
+    analyzeAlpha(data_in, w, h);
+    updatePickMask(w, h, data_in);
+
+    mCurrentDiscardLevel = (S8)discard_level;
+    mHasMipMaps = true;
+    mMipLevels = levels - discard_level;
+
+    gGL.getTexUnit(0)->setHasMipMaps(mHasMipMaps);
+    gGL.getTexUnit(0)->setTextureAddressMode(mAddressMode);
+    gGL.getTexUnit(0)->setTextureFilteringOption(mFilterOption);
+    gGL.getTexUnit(0)->unbind(mBindTarget);
+
+    if (tex_name != nullptr)
+    {
+        *tex_name = mTexName;
+    }
+
+    mGLTextureCreated = true;
+    mTextureMemory = (S64Bytes)getMipBytes(mCurrentDiscardLevel);
+    mLastBindTime = sLastFrameTime;
+
+    return true;
+#endif
+}
+
 void LLImageGL::syncToMainThread(LLGLuint new_tex_name)
 {
     LL_PROFILE_ZONE_SCOPED;
@@ -1797,6 +2236,7 @@ void LLImageGL::syncTexName(LLGLuint texname)
             LLImageGL::deleteTextures(1, &mTexName);
         }
         mTexName = texname;
+        mSparse = false; //background created textures never have sparse storage
     }
 }
 
@@ -1912,6 +2352,150 @@ bool LLImageGL::readBackRaw(S32 discard_level, LLImageRaw* imageraw, bool compre
     return true ;
 }
 
+bool LLImageGL::readBackCompressed(std::vector<U8>& data, std::vector<S32>& level_sizes, S32& intformat, S32& width, S32& height)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
+
+    if (mTexName == 0 || mTarget != GL_TEXTURE_2D)
+    {
+        return false;
+    }
+
+    gGL.getTexUnit(0)->bindManual(LLTexUnit::TT_TEXTURE, mTexName);
+
+    GLint compressed = 0;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_COMPRESSED, &compressed);
+
+    GLint fmt = 0;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_INTERNAL_FORMAT, &fmt);
+
+    switch (fmt)
+    { // only formats the rest of LLImageGL knows how to account for
+    case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT3_EXT:
+    case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+    case GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT:
+        break;
+    default:
+        compressed = 0;
+        break;
+    }
+
+    if (!compressed)
+    {
+        gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+        return false;
+    }
+
+    GLint w = 0, h = 0;
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &w);
+    glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &h);
+
+    data.clear();
+    level_sizes.clear();
+
+    for (S32 level = 0; ; ++level)
+    {
+        GLint level_width = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_WIDTH, &level_width);
+        if (level_width <= 0)
+        { // end of the defined mip chain
+            break;
+        }
+
+        GLint size = 0;
+        glGetTexLevelParameteriv(GL_TEXTURE_2D, level, GL_TEXTURE_COMPRESSED_IMAGE_SIZE, &size);
+        if (size <= 0)
+        {
+            break;
+        }
+
+        size_t offset = data.size();
+        data.resize(offset + size);
+        glGetCompressedTexImage(GL_TEXTURE_2D, level, data.data() + offset);
+        level_sizes.push_back((S32)size);
+
+        if (!mHasMipMaps)
+        {
+            break;
+        }
+    }
+
+    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    stop_glerror();
+
+    intformat = (S32)fmt;
+    width = (S32)w;
+    height = (S32)h;
+    return !level_sizes.empty();
+}
+
+bool LLImageGL::createCompressedGLTexture(S32 discard_level, S32 full_width, S32 full_height, S32 ncomponents,
+                                          S32 intformat, const std::vector<S32>& level_sizes, const U8* data)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
+    checkActiveThread();
+
+    if (level_sizes.empty() || data == nullptr || mTarget != GL_TEXTURE_2D)
+    {
+        return false;
+    }
+
+    if (!setSize(full_width, full_height, ncomponents, discard_level))
+    {
+        return false;
+    }
+
+    destroyGLTexture();
+    LLImageGL::generateTextures(1, &mTexName);
+    gGL.getTexUnit(0)->bind(this, false, false, mTexName);
+
+    S32 levels = (S32)level_sizes.size();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+
+    S32 w = getWidth(discard_level);
+    S32 h = getHeight(discard_level);
+    const U8* src = data;
+    for (S32 level = 0; level < levels; ++level)
+    {
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, intformat, w, h, 0, level_sizes[level], src);
+        src += level_sizes[level];
+        w = llmax(w >> 1, 1);
+        h = llmax(h >> 1, 1);
+    }
+
+    if (glGetError() != GL_NO_ERROR)
+    { // driver rejected the cached blob (e.g. written by a different GPU)
+        destroyGLTexture();
+        gGL.getTexUnit(0)->unbind(mBindTarget);
+        return false;
+    }
+
+    alloc_tex_image(getWidth(discard_level), getHeight(discard_level), intformat, 1);
+
+    mFormatInternal = intformat;
+    mFormatPrimary = (ncomponents == 3) ? GL_RGB : GL_RGBA;
+    mFormatType = GL_UNSIGNED_BYTE;
+    mHasMipMaps = levels > 1;
+    mMipLevels = levels;
+    mAutoGenMips = false;
+    mCurrentDiscardLevel = (S8)discard_level;
+
+    gGL.getTexUnit(0)->setHasMipMaps(mHasMipMaps);
+    gGL.getTexUnit(0)->setTextureAddressMode(mAddressMode);
+    gGL.getTexUnit(0)->setTextureFilteringOption(mFilterOption);
+    gGL.getTexUnit(0)->unbind(mBindTarget);
+
+    mGLTextureCreated = true;
+    mTextureMemory = (S64Bytes)getMipBytes(mCurrentDiscardLevel);
+    mLastBindTime = sLastFrameTime;
+
+    return true;
+}
+
 void LLImageGL::destroyGLTexture()
 {
     checkActiveThread();
@@ -1927,6 +2511,9 @@ void LLImageGL::destroyGLTexture()
         mCurrentDiscardLevel = -1 ; //invalidate mCurrentDiscardLevel.
         mTexName = 0;
         mGLTextureCreated = false ;
+        mSparse = false;
+        mSparseLevels = 0;
+        mSparseCommitLevel = 0;
     }
 }
 
@@ -2318,6 +2905,24 @@ bool LLImageGL::isCompressed()
     return is_compressed;
 }
 
+bool LLImageGL::canGPUGenerateMips() const
+{
+    // glGenerateMipmap requires a filterable base format; depth, stencil
+    // and integer textures fall back to the CPU downsample.
+    switch (mFormatPrimary)
+    {
+    case GL_DEPTH_COMPONENT:
+    case GL_DEPTH_STENCIL:
+    case GL_RED_INTEGER:
+    case GL_RG_INTEGER:
+    case GL_RGB_INTEGER:
+    case GL_RGBA_INTEGER:
+        return false;
+    default:
+        return true;
+    }
+}
+
 //----------------------------------------------------------------------------
 void LLImageGL::updatePickMask(S32 width, S32 height, const U8* data_in)
 {
@@ -2456,6 +3061,44 @@ bool LLImageGL::scaleDown(S32 desired_discard)
     S32 desired_width = getWidth(desired_discard);
     S32 desired_height = getHeight(desired_discard);
 
+#if !LL_DARWIN
+    if (mSparse)
+    { // sparse textures scale down by releasing page commitments -- the
+      // surviving levels already hold their texel data
+        if (desired_discard >= mSparseLevels)
+        {
+            return false;
+        }
+
+        gGL.getTexUnit(0)->bind(this, false, true);
+
+        GLint sparse_levels = 0;
+        glGetTexParameteriv(GL_TEXTURE_2D, GL_NUM_SPARSE_LEVELS_ARB, &sparse_levels);
+        sparse_levels = llmin((GLint)mSparseLevels, sparse_levels);
+
+        S32 new_commit = llmin(desired_discard, (S32)sparse_levels);
+        for (S32 i = mSparseCommitLevel; i < new_commit; ++i)
+        {
+            glTexPageCommitmentARB(GL_TEXTURE_2D, i, 0, 0, 0,
+                                   llmax(mWidth >> i, 1), llmax(mHeight >> i, 1), 1, GL_FALSE);
+        }
+        if (mSparseCommitLevel != new_commit)
+        {
+            free_cur_tex_image();
+            alloc_tex_image(llmax(mWidth >> new_commit, 1), llmax(mHeight >> new_commit, 1), mFormatInternal, 1);
+        }
+        mSparseCommitLevel = (S8)new_commit;
+
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, desired_discard);
+        gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+
+        mCurrentDiscardLevel = (S8)desired_discard;
+        mMipLevels = mSparseLevels - desired_discard;
+        mTextureMemory = (S64Bytes)getMipBytes(mCurrentDiscardLevel);
+        return true;
+    }
+#endif
+
     if (gGLManager.mDownScaleMethod == 0)
     { // use an FBO to downscale the texture
         // allocate new texture
@@ -40,6 +40,7 @@
 #include "threadpool.h"
 #include "workqueue.h"
 #include <unordered_set>
+#include <vector>
 
 #define LL_IMAGEGL_THREAD_CHECK 0 //set to 1 to enable thread debugging for ImageGL
 
@@ -142,6 +143,17 @@ public:
 
     // Read back a raw image for this discard level, if it exists
     bool readBackRaw(S32 discard_level, LLImageRaw* imageraw, bool compressed_ok) const;
+
+    // Read back the driver-compressed mip chain of the current texture
+    // (levels concatenated into data, one size per level).  Fails if there is
+    // no GL image, the texture was not compressed, or the compressed format
+    // is not a known S3TC format.  Must be called with a current GL context.
+    bool readBackCompressed(std::vector<U8>& data, std::vector<S32>& level_sizes, S32& intformat, S32& width, S32& height);
+
+    // Create this texture from a previously read back compressed mip chain,
+    // bypassing decode and driver-side compression entirely.
+    bool createCompressedGLTexture(S32 discard_level, S32 full_width, S32 full_height, S32 ncomponents,
+                                   S32 intformat, const std::vector<S32>& level_sizes, const U8* data);
     void destroyGLTexture();
     void forceToInvalidateGLTexture();
 
@@ -231,6 +243,16 @@ private:
     void freePickMask();
     bool isCompressed();
 
+    // true when glGenerateMipmap can build this texture's mip chain, i.e.
+    // the format is filterable; depth, stencil and integer formats keep
+    // the CPU downsample path
+    bool canGPUGenerateMips() const;
+
+    // allocate/update this texture as ARB_sparse_texture storage, committing
+    // only the mip tail from discard_level down; returns false when the
+    // texture is not eligible and the caller should take the standard path
+    bool createSparseTexture(S32 discard_level, const U8* data_in, LLGLuint* tex_name);
+
     LLPointer<LLImageRaw> mSaveData; // used for destroyGL/restoreGL
     LL::WorkQueue::weak_t mMainQueue;
     U8* mPickMask;  //downsampled bitmap approximation of alpha channel.  NULL if no alpha channel
@@ -251,6 +273,13 @@ private:
     U16      mHeight;
     S8       mCurrentDiscardLevel;
 
+    // ARB_sparse_texture state -- when mSparse is set, mTexName is immutable
+    // sparse storage for the full discard 0 mip chain and discard changes
+    // adjust page commitments instead of reallocating
+    bool mSparse = false;
+    S8   mSparseLevels = 0;         // total mip levels in the sparse allocation
+    S8   mSparseCommitLevel = 0;    // first explicitly committed mip level
+
     bool mAllowCompression;
 
 protected:
@@ -289,6 +318,9 @@ public:
     static LLImageGL* sDefaultGLTexture ;
     static bool sAutomatedTest;
     static bool sCompressTextures;          //use GL texture compression
+    static bool sCompressTexturesCPU;       //encode BC blocks in the viewer instead of the driver
+    static bool sUsePBOUploadRing;          //stream texel uploads through persistent-mapped PBOs (requires GL 4.4)
+    static bool sUseSparseTextures;         //allocate eligible textures as ARB_sparse_texture and commit/decommit mip tails
 #if DEBUG_MISS
     bool mMissed; // Missed on last bind?
     bool getMissed() const { return mMissed; };
@@ -297,7 +329,7 @@ public:
 #endif
 
 public:
-    static void initClass(LLWindow* window, S32 num_catagories, bool skip_analyze_alpha = false, bool thread_texture_loads = false, bool thread_media_updates = false);
+    static void initClass(LLWindow* window, S32 num_catagories, bool skip_analyze_alpha = false, bool thread_texture_loads = false, bool thread_media_updates = false, bool thread_buffer_streaming = false);
     static void cleanupClass() ;
 
 private:
@@ -345,6 +377,8 @@ public:
     static bool sEnabledTextures;
     // follows gSavedSettings "RenderGLMultiThreadedMedia"
     static bool sEnabledMedia;
+    // follows gSavedSettings "RenderGLMultiThreadedBuffers"
+    static bool sEnabledBuffers;
 
     LLImageGLThread(LLWindow* window);
 
@@ -214,8 +214,6 @@ bool LLTexUnit::bind(LLTexture* texture, bool for_rendering, bool forceBind)
     stop_glerror();
     if (mIndex >= 0)
     {
-        gGL.flush();
-
         LLImageGL* gl_tex = NULL ;
 
         if (texture != NULL && (gl_tex = texture->getGLTexture()))
@@ -225,6 +223,11 @@ bool LLTexUnit::bind(LLTexture* texture, bool for_rendering, bool forceBind)
                 //in audit, replace the selected texture by the default one.
                 if ((mCurrTexture != gl_tex->getTexName()) || forceBind)
                 {
+                    // only flush when the binding actually changes, like the
+                    // LLImageGL overload below -- re-binding the current
+                    // texture must not break the pending vertex batch, or
+                    // every UI image draw flushes a handful of triangles
+                    gGL.flush();
                     activate();
                     enable(gl_tex->getTarget());
                     mCurrTexture = gl_tex->getTexName();
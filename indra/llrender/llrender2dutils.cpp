@@ -51,6 +51,15 @@ const LLColor4 UI_VERTEX_COLOR(1.f, 1.f, 1.f, 1.f);
 // Functions
 //
 
+// Solid-color draws sample the 1x1 white texture.  Bind it through the
+// cached path rather than unbind(), which always flushes: consecutive solid
+// rects, lines and frames then accumulate into a single draw instead of
+// flushing a few triangles per widget.
+static void gl_bind_white_for_solid()
+{
+    gGL.getTexUnit(0)->bindManual(LLTexUnit::TT_TEXTURE, LLTexUnit::sWhiteTexture);
+}
+
 bool ui_point_in_rect(S32 x, S32 y, S32 left, S32 top, S32 right, S32 bottom)
 {
     if (x < left || right < x) return false;
@@ -78,7 +87,7 @@ void gl_state_for_2d(S32 width, S32 height)
 
 void gl_draw_x(const LLRect& rect, const LLColor4& color)
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     gGL.color4fv( color.mV );
 
@@ -117,7 +126,7 @@ void gl_rect_2d_offset_local( S32 left, S32 top, S32 right, S32 bottom, S32 pixe
 
 void gl_rect_2d(S32 left, S32 top, S32 right, S32 bottom, bool filled )
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     // Counterclockwise quad will face the viewer
     if( filled )
@@ -165,7 +174,7 @@ void gl_rect_2d( const LLRect& rect, const LLColor4& color, bool filled )
 void gl_drop_shadow(S32 left, S32 top, S32 right, S32 bottom, const LLColor4 &start_color, S32 lines)
 {
     stop_glerror();
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     // HACK: Overlap with the rectangle by a single pixel.
     right--;
@@ -246,7 +255,7 @@ void gl_drop_shadow(S32 left, S32 top, S32 right, S32 bottom, const LLColor4 &st
 
 void gl_line_2d(S32 x1, S32 y1, S32 x2, S32 y2 )
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     gGL.begin(LLRender::LINES);
         gGL.vertex2i(x1, y1);
@@ -256,7 +265,7 @@ void gl_line_2d(S32 x1, S32 y1, S32 x2, S32 y2 )
 
 void gl_line_2d(S32 x1, S32 y1, S32 x2, S32 y2, const LLColor4 &color )
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     gGL.color4fv( color.mV );
 
@@ -268,7 +277,7 @@ void gl_line_2d(S32 x1, S32 y1, S32 x2, S32 y2, const LLColor4 &color )
 
 void gl_triangle_2d(S32 x1, S32 y1, S32 x2, S32 y2, S32 x3, S32 y3, const LLColor4& color, bool filled)
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     gGL.color4fv(color.mV);
 
@@ -288,7 +297,7 @@ void gl_triangle_2d(S32 x1, S32 y1, S32 x2, S32 y2, S32 x3, S32 y3, const LLColo
 
 void gl_corners_2d(S32 left, S32 top, S32 right, S32 bottom, S32 length, F32 max_frac)
 {
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     length = llmin((S32)(max_frac*(right - left)), length);
     length = llmin((S32)(max_frac*(top - bottom)), length);
@@ -893,7 +902,7 @@ void gl_circle_2d(F32 center_x, F32 center_y, F32 radius, S32 steps, bool filled
 {
     gGL.pushUIMatrix();
     {
-        gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+        gl_bind_white_for_solid();
         gGL.translateUI(center_x, center_y, 0.f);
 
         // Inexact, but reasonably fast.
@@ -1003,7 +1012,7 @@ void gl_washer_2d(F32 outer_radius, F32 inner_radius, S32 steps, const LLColor4&
     F32 x2 = inner_radius;
     F32 y2 = 0.f;
 
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
 
     gGL.begin( LLRender::TRIANGLE_STRIP  );
     {
@@ -1040,7 +1049,7 @@ void gl_washer_segment_2d(F32 outer_radius, F32 inner_radius, F32 start_radians,
     F32 x2 = inner_radius * cos( start_radians );
     F32 y2 = inner_radius * sin( start_radians );
 
-    gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
+    gl_bind_white_for_solid();
     gGL.begin( LLRender::TRIANGLE_STRIP  );
     {
         steps += 1; // An extra step to close the circle.
@@ -27,12 +27,28 @@
 #include "linden_common.h"
 
 #include "llrendertarget.h"
+#include "llgpumemoryledger.h"
 #include "llrender.h"
 #include "llgl.h"
 
 LLRenderTarget* LLRenderTarget::sBoundTarget = NULL;
 U32 LLRenderTarget::sBytesAllocated = 0;
 
+// adjust both the legacy counter and the GPU memory ledger; delta can be
+// negative when a target shrinks in place
+static void adjust_target_bytes(S32 delta)
+{
+    LLRenderTarget::sBytesAllocated += delta;
+    if (delta >= 0)
+    {
+        LLGPUMemoryLedger::claim(LLGPUMemoryLedger::CAT_RENDER_TARGET, (U64)delta);
+    }
+    else
+    {
+        LLGPUMemoryLedger::release(LLGPUMemoryLedger::CAT_RENDER_TARGET, (U64)(-delta));
+    }
+}
+
 void check_framebuffer_status()
 {
     if (gDebugGL)
@@ -88,7 +104,7 @@ void LLRenderTarget::resize(U32 resx, U32 resy)
     { //resize color attachments
         gGL.getTexUnit(0)->bindManual(mUsage, mTex[i]);
         LLImageGL::setManualImage(LLTexUnit::getInternalType(mUsage), 0, mInternalFormat[i], mResX, mResY, GL_RGBA, GL_UNSIGNED_BYTE, NULL, false);
-        sBytesAllocated += pix_diff*4;
+        adjust_target_bytes(pix_diff*4);
     }
 
     if (mDepth)
@@ -97,7 +113,7 @@ void LLRenderTarget::resize(U32 resx, U32 resy)
         U32 internal_type = LLTexUnit::getInternalType(mUsage);
         LLImageGL::setManualImage(internal_type, 0, GL_DEPTH_COMPONENT24, mResX, mResY, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL, false);
 
-        sBytesAllocated += pix_diff*4;
+        adjust_target_bytes(pix_diff*4);
     }
 }
 
@@ -239,7 +255,7 @@ bool LLRenderTarget::addColorAttachment(U32 color_fmt)
         }
     }
 
-    sBytesAllocated += mResX*mResY*4;
+    adjust_target_bytes(mResX*mResY*4);
 
     stop_glerror();
 
@@ -303,7 +319,7 @@ bool LLRenderTarget::allocateDepth()
     LLImageGL::setManualImage(internal_type, 0, GL_DEPTH_COMPONENT24, mResX, mResY, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL, false);
     gGL.getTexUnit(0)->setTextureFilteringOption(LLTexUnit::TFO_POINT);
 
-    sBytesAllocated += mResX*mResY*4;
+    adjust_target_bytes(mResX*mResY*4);
 
     if (glGetError() != GL_NO_ERROR)
     {
@@ -358,7 +374,7 @@ void LLRenderTarget::release()
 
         mDepth = 0;
 
-        sBytesAllocated -= mResX*mResY*4;
+        adjust_target_bytes(-(S32)(mResX*mResY*4));
     }
     else if (mFBO)
     {
@@ -381,7 +397,7 @@ void LLRenderTarget::release()
         size_t z;
         for (z = mTex.size() - 1; z >= 1; z--)
         {
-            sBytesAllocated -= mResX*mResY*4;
+            adjust_target_bytes(-(S32)(mResX*mResY*4));
             glFramebufferTexture2D(GL_FRAMEBUFFER, static_cast<GLenum>(GL_COLOR_ATTACHMENT0+z), LLTexUnit::getInternalType(mUsage), 0, 0);
             LLImageGL::deleteTextures(1, &mTex[z]);
         }
@@ -402,7 +418,7 @@ void LLRenderTarget::release()
 
     if (mTex.size() > 0)
     {
-        sBytesAllocated -= mResX*mResY*4;
+        adjust_target_bytes(-(S32)(mResX*mResY*4));
         LLImageGL::deleteTextures(1, &mTex[0]);
     }
 
@@ -922,12 +922,17 @@ GLuint LLShaderMgr::loadShaderFile(const std::string& filename, S32 & shader_lev
 
 bool LLShaderMgr::linkProgramObject(GLuint obj, bool suppress_errors)
 {
-    //check for errors
     {
         LL_PROFILE_ZONE_NAMED_CATEGORY_SHADER("glLinkProgram");
         glLinkProgram(obj);
     }
 
+    return checkProgramLinkStatus(obj, suppress_errors);
+}
+
+bool LLShaderMgr::checkProgramLinkStatus(GLuint obj, bool suppress_errors)
+{
+    //check for errors
     GLint success = GL_TRUE;
 
     {
@@ -1017,6 +1022,48 @@ void LLShaderMgr::initShaderCache(bool enabled, const LLUUID& old_cache_version,
     }
 }
 
+U64 LLShaderMgr::getShaderSourceHash(const std::string& filename, S32 shader_level)
+{
+    // resolve with the same class-directory fallback loadShaderFile uses
+    std::string open_file_name;
+    for (S32 gpu_class = shader_level; gpu_class > 0; gpu_class--)
+    {
+        std::stringstream fname;
+        fname << getShaderDirPrefix();
+        fname << gpu_class << "/" << filename;
+
+        if (gDirUtilp->fileExists(fname.str()))
+        {
+            open_file_name = fname.str();
+            break;
+        }
+    }
+
+    if (open_file_name.empty())
+    { // loadShaderFile will fail on this file too -- nothing to key on
+        return 0;
+    }
+
+    auto iter = mShaderSourceHashes.find(open_file_name);
+    if (iter != mShaderSourceHashes.end())
+    {
+        return iter->second;
+    }
+
+    U64 digest = 0;
+    llifstream file(open_file_name, std::ios::binary);
+    if (file.is_open())
+    {
+        std::stringstream contents;
+        contents << file.rdbuf();
+        const std::string& source = contents.str();
+        digest = HBXXH64::digest(source.c_str(), source.size());
+    }
+
+    mShaderSourceHashes[open_file_name] = digest;
+    return digest;
+}
+
 void LLShaderMgr::clearShaderCache()
 {
     std::string shader_cache = gDirUtilp->getExpandedFilename(LL_PATH_CACHE, "shader_cache");
@@ -1378,6 +1425,7 @@ void LLShaderMgr::initAttribsAndUniforms()
 
     mReservedUniforms.push_back("matrixPalette");
     mReservedUniforms.push_back("translationPalette");
+    mReservedUniforms.push_back("dualQuatPalette");
 
     mReservedUniforms.push_back("screenTex");
     mReservedUniforms.push_back("screenDepth");
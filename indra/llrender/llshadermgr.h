@@ -229,6 +229,7 @@ public:
 
         AVATAR_MATRIX,                      //  "matrixPalette"
         AVATAR_TRANSLATION,                 //  "translationPalette"
+        AVATAR_DQ_PALETTE,                  //  "dualQuatPalette"
 
         WATER_SCREENTEX,                    //  "screenTex"
         WATER_SCREENDEPTH,                  //  "screenDepth"
@@ -350,6 +351,7 @@ public:
     void dumpObjectLog(GLuint ret, bool warns = true, const std::string& filename = "");
     void dumpShaderSource(U32 shader_code_count, GLchar** shader_code_text);
     bool    linkProgramObject(GLuint obj, bool suppress_errors = false);
+    bool    checkProgramLinkStatus(GLuint obj, bool suppress_errors = false);
     bool    validateProgramObject(GLuint obj);
     GLuint loadShaderFile(const std::string& filename, S32 & shader_level, GLenum type, std::map<std::string, std::string>* defines = NULL, S32 texture_index_channels = -1);
 
@@ -366,6 +368,11 @@ public:
     bool loadCachedProgramBinary(LLGLSLShader* shader);
     bool saveCachedProgramBinary(LLGLSLShader* shader);
 
+    // hash of the on-disk source of the given shader file, resolved with the
+    // same class-directory fallback loadShaderFile uses.  Feeds the program
+    // binary cache key so edited shader source invalidates stale binaries.
+    U64 getShaderSourceHash(const std::string& filename, S32 shader_level);
+
 public:
     // Map of shader names to compiled
     std::map<std::string, GLuint> mVertexShaderObjects;
@@ -387,6 +394,10 @@ public:
     bool mShaderCacheEnabled = false;
     std::string mShaderCacheDir;
 
+    // memoized source hashes -- shader files are shared by many programs and
+    // don't change while the viewer is running
+    std::map<std::string, U64> mShaderSourceHashes;
+
 protected:
 
     // our parameter manager singleton instance
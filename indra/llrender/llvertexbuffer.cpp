@@ -31,12 +31,15 @@
 #include "llvertexbuffer.h"
 // #include "llrender.h"
 #include "llglheaders.h"
+#include "llgpumemoryledger.h"
 #include "llrender.h"
 #include "llvector4a.h"
 #include "llshadermgr.h"
 #include "llglslshader.h"
 #include "llmemory.h"
+#include "llimagegl.h"
 #include <glm/gtc/type_ptr.hpp>
+#include <mutex>
 
 //Next Highest Power Of Two
 //helper function, returns first number > v that is a power of 2, or v if v is already a power of 2
@@ -318,6 +321,126 @@ static void delete_buffers(S32 count, GLuint* buffers)
 
 #define ANALYZE_VBO_POOL 0
 
+// Background buffer streaming.  Generalizes the LLImageGLThread side
+// context beyond texture uploads: when a VBO pool miss shows demand for
+// a buffer size, a replacement of that size is allocated (and, for the
+// persistent pool, mapped) on the worker context and handed back with a
+// fence, so sustained rebuild storms stop paying for glBufferData on
+// the main thread and mostly just swap pre-staged handles.
+class LLStreamedBufferQueue
+{
+public:
+    struct Entry
+    {
+        U8* mData;
+        GLuint mGLName;
+        GLsync mSync;
+        GLenum mType;
+        U32 mSize;
+        bool mPersistent;
+    };
+
+    static bool enabled()
+    {
+        return LLImageGLThread::sEnabledBuffers && LLImageGLThread::instanceExists();
+    }
+
+    // called on the main thread after a pool miss; at most two
+    // replacement allocations are kept in flight per size
+    void request(GLenum type, U32 size, bool persistent)
+    {
+        if (!enabled())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            U32& pending = mPending[key(type, size)];
+            if (pending >= 2)
+            {
+                return;
+            }
+            ++pending;
+        }
+
+        bool posted = LLImageGLThread::getInstance()->post([this, type, size, persistent]()
+            {
+                Entry entry{ nullptr, 0, 0, type, size, persistent };
+                entry.mGLName = gen_buffer();
+                glBindBuffer(type, entry.mGLName);
+                if (persistent)
+                {
+                    constexpr GLbitfield storage_flags =
+                        GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                    glBufferStorage(type, size, nullptr, storage_flags);
+                    entry.mData = (U8*) glMapBufferRange(type, 0, size, storage_flags);
+                }
+                else
+                {
+                    glBufferData(type, size, nullptr, GL_DYNAMIC_DRAW);
+                    entry.mData = (U8*) ll_aligned_malloc_16(size);
+                }
+                glBindBuffer(type, 0);
+                entry.mSync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                // make the fence and the allocation visible to the main context
+                glFlush();
+
+                std::lock_guard<std::mutex> lock(mMutex);
+                mReady.push_back(entry);
+                --mPending[key(type, size)];
+            });
+
+        if (!posted)
+        { // queue is shutting down
+            std::lock_guard<std::mutex> lock(mMutex);
+            --mPending[key(type, size)];
+        }
+    }
+
+    // main thread: collect finished worker allocations; the server-side
+    // wait orders this context behind the worker's allocation commands
+    void drain(std::vector<Entry>& out)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (Entry& entry : mReady)
+        {
+            glWaitSync(entry.mSync, 0, GL_TIMEOUT_IGNORED);
+            glDeleteSync(entry.mSync);
+            entry.mSync = 0;
+            out.push_back(entry);
+        }
+        mReady.resize(0);
+    }
+
+    // main thread, shutdown: release anything still staged
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (Entry& entry : mReady)
+        {
+            glDeleteSync(entry.mSync);
+            // deleting a mapped buffer implicitly unmaps it
+            delete_buffers(1, &entry.mGLName);
+            if (!entry.mPersistent)
+            {
+                ll_aligned_free_16(entry.mData);
+            }
+        }
+        mReady.clear();
+        mPending.clear();
+    }
+
+private:
+    static U64 key(GLenum type, U32 size) { return ((U64) type << 32) | size; }
+
+    std::mutex mMutex;
+    std::vector<Entry> mReady;
+    std::unordered_map<U64, U32> mPending;
+};
+
+static LLStreamedBufferQueue sStreamedBufferQueue;
+
 // VBO Pool interface
 class LLVBOPool
 {
@@ -439,15 +562,27 @@ public:
         adjustSize(size);
         mAllocated += size;
 
+        // fold in any buffers the worker context has finished staging
+        std::vector<LLStreamedBufferQueue::Entry> streamed;
+        sStreamedBufferQueue.drain(streamed);
+        for (const LLStreamedBufferQueue::Entry& entry : streamed)
+        {
+            auto& dst = entry.mType == GL_ELEMENT_ARRAY_BUFFER ? mIBOPool : mVBOPool;
+            dst[entry.mSize].push_front({ entry.mData, entry.mGLName, std::chrono::steady_clock::now() });
+            mReserved += entry.mSize;
+        }
+
         auto& pool = type == GL_ELEMENT_ARRAY_BUFFER ? mIBOPool : mVBOPool;
 
         Pool::iterator iter = pool.find(size);
         if (iter == pool.end())
-        { // cache miss, allocate a new buffer
+        { // cache miss, allocate a new buffer and ask the worker to
+          // stage replacements so repeat misses of this size are hits
             LL_PROFILE_ZONE_NAMED_CATEGORY_VERTEX("vbo pool miss");
             LL_PROFILE_GPU_ZONE("vbo alloc");
 
             mMisses++;
+            sStreamedBufferQueue.request(type, size, false);
             name = gen_buffer();
             glBindBuffer(type, name);
             glBufferData(type, size, nullptr, GL_DYNAMIC_DRAW);
@@ -599,11 +734,251 @@ public:
 
         mIBOPool.clear();
         mVBOPool.clear();
+
+        sStreamedBufferQueue.clear();
+    }
+};
+
+// VBO Pool for GL 4.4+ drivers when persistent mapping is enabled.
+// Buffers are allocated immutable with GL_ARB_buffer_storage and stay
+// persistently/coherently mapped for their entire lifetime, so writes land
+// directly in the GL store and flush_vbo never touches glBufferSubData.
+// Freed buffers carry a fence and are only recycled once the GPU has drained
+// any draws that referenced them, giving the effect of multi-buffered
+// streaming regions without per-frame map/unmap churn.
+class LLPersistentVBOPool final : public LLVBOPool
+{
+public:
+    typedef std::chrono::steady_clock::time_point Time;
+    struct Entry
+    {
+        U8* mData;
+        GLuint mGLName;
+        GLsync mSync;
+        Time mAge;
+    };
+
+    ~LLPersistentVBOPool() override
+    {
+        clear();
+    }
+
+    typedef std::unordered_map<U32, std::list<Entry>> Pool;
+
+    Pool mVBOPool;
+    Pool mIBOPool;
+
+    U32 mTouchCount = 0;
+    U64 mDistributed = 0;
+    U64 mAllocated = 0;
+    U64 mReserved = 0;
+
+    U64 getVramBytesUsed() override
+    {
+        return mAllocated + mReserved;
+    }
+
+    // increase the size to some common value to increase hit rate
+    // (same heuristic as LLDefaultVBOPool)
+    void adjustSize(U32& size)
+    {
+        U32 block_size = llmax(nhpo2(size) / 8, (U32) 16);
+        size += block_size - (size % block_size);
+    }
+
+    static bool fenceDone(Entry& entry)
+    {
+        if (!entry.mSync)
+        {
+            return true;
+        }
+        GLenum status = glClientWaitSync(entry.mSync, 0, 0);
+        if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+        {
+            glDeleteSync(entry.mSync);
+            entry.mSync = 0;
+            return true;
+        }
+        return false;
+    }
+
+    void allocate(GLenum type, U32 size, GLuint& name, U8*& data) override
+    {
+        LL_PROFILE_ZONE_SCOPED_CATEGORY_VERTEX;
+        llassert(type == GL_ARRAY_BUFFER || type == GL_ELEMENT_ARRAY_BUFFER);
+        llassert(name == 0);
+        llassert(data == nullptr);
+        llassert(size >= 2);
+
+        mDistributed += size;
+        adjustSize(size);
+        mAllocated += size;
+
+        // fold in any buffers the worker context has finished staging;
+        // the drain already waited out their allocation fences
+        std::vector<LLStreamedBufferQueue::Entry> streamed;
+        sStreamedBufferQueue.drain(streamed);
+        for (const LLStreamedBufferQueue::Entry& entry : streamed)
+        {
+            auto& dst = entry.mType == GL_ELEMENT_ARRAY_BUFFER ? mIBOPool : mVBOPool;
+            dst[entry.mSize].push_front({ entry.mData, entry.mGLName, 0, std::chrono::steady_clock::now() });
+            mReserved += entry.mSize;
+        }
+
+        auto& pool = type == GL_ELEMENT_ARRAY_BUFFER ? mIBOPool : mVBOPool;
+
+        Pool::iterator iter = pool.find(size);
+        if (iter != pool.end())
+        { // oldest entries are at the back and most likely to have drained
+            std::list<Entry>& entries = iter->second;
+            if (fenceDone(entries.back()))
+            {
+                Entry& entry = entries.back();
+                name = entry.mGLName;
+                data = entry.mData;
+                entries.pop_back();
+                if (entries.empty())
+                {
+                    pool.erase(iter);
+                }
+                llassert(mReserved >= size);
+                mReserved -= size;
+                clean();
+                return;
+            }
+        }
+
+        { // no drained buffer of this size -- allocate a new one, mapped
+          // for the duration of its lifetime, and ask the worker to stage
+          // replacements so repeat misses of this size are hits
+            LL_PROFILE_ZONE_NAMED_CATEGORY_VERTEX("vbo persistent alloc");
+            LL_PROFILE_GPU_ZONE("vbo alloc");
+
+            sStreamedBufferQueue.request(type, size, true);
+
+            constexpr GLbitfield storage_flags =
+                GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+            name = gen_buffer();
+            glBindBuffer(type, name);
+            glBufferStorage(type, size, nullptr, storage_flags);
+            data = (U8*) glMapBufferRange(type, 0, size, storage_flags);
+
+            if (type == GL_ELEMENT_ARRAY_BUFFER)
+            {
+                LLVertexBuffer::sGLRenderIndices = name;
+            }
+            else
+            {
+                LLVertexBuffer::sGLRenderBuffer = name;
+            }
+        }
+
+        clean();
+    }
+
+    void free(GLenum type, U32 size, GLuint name, U8* data) override
+    {
+        LL_PROFILE_ZONE_SCOPED_CATEGORY_VERTEX;
+        llassert(type == GL_ARRAY_BUFFER || type == GL_ELEMENT_ARRAY_BUFFER);
+        llassert(size >= 2);
+        llassert(name != 0);
+        llassert(data != nullptr);
+
+        llassert(mDistributed >= size);
+        mDistributed -= size;
+        adjustSize(size);
+        llassert(mAllocated >= size);
+        mAllocated -= size;
+        mReserved += size;
+
+        auto& pool = type == GL_ELEMENT_ARRAY_BUFFER ? mIBOPool : mVBOPool;
+
+        // fence so the buffer is only handed out again after in-flight draws
+        // against it have completed
+        GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        pool[size].push_front({ data, name, sync, std::chrono::steady_clock::now() });
+
+        clean();
+    }
+
+    // clean periodically (clean gets called for every alloc/free)
+    void clean()
+    {
+        mTouchCount++;
+        if (mTouchCount < 1024)
+        {
+            return;
+        }
+        mTouchCount = 0;
+
+        LL_PROFILE_ZONE_SCOPED_CATEGORY_VERTEX;
+
+        Pool* pools[] = { &mVBOPool, &mIBOPool };
+
+        using namespace std::chrono_literals;
+
+        Time cutoff = std::chrono::steady_clock::now() - 5s;
+
+        for (auto* pool : pools)
+        {
+            for (Pool::iterator iter = pool->begin(); iter != pool->end(); )
+            {
+                auto& entries = iter->second;
+
+                while (!entries.empty() && entries.back().mAge < cutoff && fenceDone(entries.back()))
+                {
+                    LL_PROFILE_ZONE_NAMED_CATEGORY_VERTEX("vbo cache timeout");
+                    auto& entry = entries.back();
+                    // deleting a mapped buffer implicitly unmaps it
+                    delete_buffers(1, &entry.mGLName);
+                    llassert(mReserved >= iter->first);
+                    mReserved -= iter->first;
+                    entries.pop_back();
+                }
+
+                if (entries.empty())
+                {
+                    iter = pool->erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+        }
+    }
+
+    void clear()
+    {
+        Pool* pools[] = { &mVBOPool, &mIBOPool };
+        for (auto* pool : pools)
+        {
+            for (auto& entries : *pool)
+            {
+                for (auto& entry : entries.second)
+                {
+                    if (entry.mSync)
+                    {
+                        glDeleteSync(entry.mSync);
+                    }
+                    delete_buffers(1, &entry.mGLName);
+                }
+            }
+            pool->clear();
+        }
+        mReserved = 0;
+
+        sStreamedBufferQueue.clear();
     }
 };
 
 static LLVBOPool* sVBOPool = nullptr;
 
+// true when sVBOPool hands out persistently mapped storage and flush_vbo
+// should skip glBufferSubData
+static bool sPersistentPoolActive = false;
+
 void LLVertexBufferData::draw()
 {
     if (!mVB)
@@ -657,6 +1032,8 @@ U32 LLVertexBuffer::sGLRenderBuffer = 0;
 U32 LLVertexBuffer::sGLRenderIndices = 0;
 U32 LLVertexBuffer::sLastMask = 0;
 U32 LLVertexBuffer::sVertexCount = 0;
+bool LLVertexBuffer::sEnableMultiDrawIndirect = false;
+bool LLVertexBuffer::sUsePersistentMapping = false;
 
 
 //NOTE: each component must be AT LEAST 4 bytes in size to avoid a performance penalty on AMD hardware
@@ -897,6 +1274,57 @@ void LLVertexBuffer::drawRangeFast(U32 mode, U32 start, U32 end, U32 count, U32
         (GLvoid*)(indices_offset * (size_t)mIndicesStride));
 }
 
+void LLVertexBuffer::drawRangeInstanced(U32 mode, U32 start, U32 end, U32 count, U32 indices_offset, U32 instance_count) const
+{
+    llassert(validateRange(start, end, count, indices_offset));
+    llassert(mGLBuffer == sGLRenderBuffer);
+    llassert(mGLIndices == sGLRenderIndices);
+    gGL.syncMatrices();
+    STOP_GLERROR;
+    glDrawElementsInstanced(sGLMode[mode], count, mIndicesType,
+        (GLvoid*) (indices_offset * (size_t) mIndicesStride), instance_count);
+    STOP_GLERROR;
+}
+
+void LLVertexBuffer::drawRangeIndirect(U32 mode, const U32* counts, const U32* offsets, U32 draw_count) const
+{
+    llassert(sEnableMultiDrawIndirect);
+    llassert(mGLBuffer == sGLRenderBuffer);
+    llassert(mGLIndices == sGLRenderIndices);
+
+    struct DrawElementsIndirectCommand
+    {
+        GLuint mCount;
+        GLuint mInstanceCount;
+        GLuint mFirstIndex;
+        GLuint mBaseVertex;
+        GLuint mBaseInstance;
+    };
+
+    // stream the command list through a shared, orphaned indirect buffer
+    static U32 indirect_buffer = 0;
+    static std::vector<DrawElementsIndirectCommand> commands;
+
+    if (!indirect_buffer)
+    {
+        glGenBuffers(1, &indirect_buffer);
+    }
+
+    commands.resize(draw_count);
+    for (U32 i = 0; i < draw_count; ++i)
+    {
+        commands[i] = { counts[i], 1, offsets[i], 0, 0 };
+    }
+
+    gGL.syncMatrices();
+    STOP_GLERROR;
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect_buffer);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, draw_count * sizeof(DrawElementsIndirectCommand), commands.data(), GL_STREAM_DRAW);
+    glMultiDrawElementsIndirect(sGLMode[mode], mIndicesType, nullptr, draw_count, 0);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    STOP_GLERROR;
+}
+
 
 void LLVertexBuffer::draw(U32 mode, U32 count, U32 indices_offset) const
 {
@@ -925,6 +1353,12 @@ void LLVertexBuffer::initClass(LLWindow* window)
         LL_INFOS() << "VBO Pooling Disabled" << LL_ENDL;
         sVBOPool = new LLAppleVBOPool();
     }
+    else if (sUsePersistentMapping && gGLManager.mGLVersion >= 4.39f)
+    {
+        LL_INFOS() << "Persistent mapped VBO Pooling Enabled" << LL_ENDL;
+        sVBOPool = new LLPersistentVBOPool();
+        sPersistentPoolActive = true;
+    }
     else
     {
         LL_INFOS() << "VBO Pooling Enabled" << LL_ENDL;
@@ -1083,6 +1517,7 @@ void LLVertexBuffer::genBuffer(U32 size)
 
         mSize = size;
         sVBOPool->allocate(GL_ARRAY_BUFFER, mSize, mGLBuffer, mMappedData);
+        LLGPUMemoryLedger::claim(LLGPUMemoryLedger::CAT_VERTEX_BUFFER, mSize);
     }
 }
 
@@ -1098,6 +1533,7 @@ void LLVertexBuffer::genIndices(U32 size)
         llassert(mMappedIndexData == nullptr);
         mIndicesSize = size;
         sVBOPool->allocate(GL_ELEMENT_ARRAY_BUFFER, mIndicesSize, mGLIndices, mMappedIndexData);
+        LLGPUMemoryLedger::claim(LLGPUMemoryLedger::CAT_VERTEX_BUFFER, mIndicesSize);
     }
 }
 
@@ -1156,6 +1592,7 @@ void LLVertexBuffer::destroyGLBuffer()
         if (sVBOPool)
         {
             sVBOPool->free(GL_ARRAY_BUFFER, mSize, mGLBuffer, mMappedData);
+            LLGPUMemoryLedger::release(LLGPUMemoryLedger::CAT_VERTEX_BUFFER, mSize);
         }
 
         mSize = 0;
@@ -1173,6 +1610,7 @@ void LLVertexBuffer::destroyGLIndices()
         if (sVBOPool)
         {
             sVBOPool->free(GL_ELEMENT_ARRAY_BUFFER, mIndicesSize, mGLIndices, mMappedIndexData);
+            LLGPUMemoryLedger::release(LLGPUMemoryLedger::CAT_VERTEX_BUFFER, mIndicesSize);
         }
 
         mIndicesSize = 0;
@@ -1345,6 +1783,17 @@ void LLVertexBuffer::flush_vbo(GLenum target, U32 start, U32 end, void* data, U8
         // copy into mapped buffer
         memcpy(dst+start, data, end-start+1);
     }
+    else if (sPersistentPoolActive)
+    {
+        // dst is coherent persistently mapped GL memory -- writes through the
+        // mapped pointer are all that's needed.  unmapBuffer passes a source
+        // pointer inside dst itself, in which case the data is already there.
+        if (data != dst + start)
+        {
+            LL_PROFILE_ZONE_NAMED_CATEGORY_VERTEX("vb persistent memcpy");
+            memcpy(dst + start, data, end - start + 1);
+        }
+    }
     else
     {
         llassert(target == GL_ARRAY_BUFFER ? sGLRenderBuffer == mGLBuffer : sGLRenderIndices == mGLIndices);
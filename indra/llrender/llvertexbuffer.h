@@ -275,6 +275,17 @@ public:
     // since the last call to syncMatrices, this is much faster than drawRange
     void drawRangeFast(U32 mode, U32 start, U32 end, U32 count, U32 indices_offset) const;
 
+    // submit several index ranges from this buffer in a single
+    // glMultiDrawElementsIndirect call.  Caller guarantees every range is
+    // drawn with identical GL state and that sEnableMultiDrawIndirect is set.
+    // counts/offsets are index counts and index offsets, as per drawRange.
+    void drawRangeIndirect(U32 mode, const U32* counts, const U32* offsets, U32 draw_count) const;
+
+    // draw the given range instance_count times via glDrawElementsInstanced.
+    // The bound shader is responsible for fetching per-instance transforms
+    // by gl_InstanceID.
+    void drawRangeInstanced(U32 mode, U32 start, U32 end, U32 count, U32 indices_offset, U32 instance_count) const;
+
     //for debugging, validate data in given range is valid
     bool validateRange(U32 start, U32 end, U32 count, U32 offset) const;
 
@@ -337,6 +348,14 @@ public:
     static U32 sGLRenderIndices;
     static U32 sLastMask;
     static U32 sVertexCount;
+
+    // true when the driver supports GL 4.3 multi-draw-indirect and the user
+    // has opted in (RenderMultiDrawIndirect) -- set during pipeline init
+    static bool sEnableMultiDrawIndirect;
+
+    // request persistently mapped buffer storage (GL 4.4) for the VBO pool --
+    // must be set before initClass (RenderPersistentMappedVBO)
+    static bool sUsePersistentMapping;
 };
 
 #ifdef LL_PROFILER_ENABLE_RENDER_DOC
@@ -1157,37 +1157,47 @@ S32 LLFolderViewFolder::arrange( S32* width, S32* height )
 
     LL_RECORD_BLOCK_TIME(FTM_ARRANGE);
 
-    // evaluate mHasVisibleChildren
-    mHasVisibleChildren = false;
-    if (mAreChildrenInited && getViewModelItem()->descendantsPassedFilter())
-    {
-        // We have to verify that there's at least one child that's not filtered out
-        bool found = false;
-        // Try the items first
-        for (items_t::iterator iit = mItems.begin(); iit != mItems.end(); ++iit)
-        {
-            LLFolderViewItem* itemp = (*iit);
-            found = itemp->isPotentiallyVisible();
-            if (found)
-                break;
-        }
-        if (!found)
-        {
-            // If no item found, try the folders
-            for (folders_t::iterator fit = mFolders.begin(); fit != mFolders.end(); ++fit)
+    // A clean folder's cached visibility and extents are still valid: every
+    // mutation that could change them (adds, removes, filter updates, sort)
+    // goes through requestArrange() or arrangeAll().  Skipping the child
+    // rescans here keeps visits to clean folders O(1), so a single-item
+    // change costs its ancestor chain rather than every visible item.
+    const bool needs_arrange = needsArrange();
+
+    if (needs_arrange)
+    {
+        // evaluate mHasVisibleChildren
+        mHasVisibleChildren = false;
+        if (mAreChildrenInited && getViewModelItem()->descendantsPassedFilter())
+        {
+            // We have to verify that there's at least one child that's not filtered out
+            bool found = false;
+            // Try the items first
+            for (items_t::iterator iit = mItems.begin(); iit != mItems.end(); ++iit)
             {
-                LLFolderViewFolder* folderp = (*fit);
-                found = folderp->isPotentiallyVisible();
+                LLFolderViewItem* itemp = (*iit);
+                found = itemp->isPotentiallyVisible();
                 if (found)
                     break;
             }
-        }
+            if (!found)
+            {
+                // If no item found, try the folders
+                for (folders_t::iterator fit = mFolders.begin(); fit != mFolders.end(); ++fit)
+                {
+                    LLFolderViewFolder* folderp = (*fit);
+                    found = folderp->isPotentiallyVisible();
+                    if (found)
+                        break;
+                }
+            }
 
-        mHasVisibleChildren = found;
-    }
-    if (!mIsFolderComplete && mAreChildrenInited)
-    {
-        mIsFolderComplete = getFolderViewModel()->isFolderComplete(this);
+            mHasVisibleChildren = found;
+        }
+        if (!mIsFolderComplete && mAreChildrenInited)
+        {
+            mIsFolderComplete = getFolderViewModel()->isFolderComplete(this);
+        }
     }
 
 
@@ -1203,7 +1213,7 @@ S32 LLFolderViewFolder::arrange( S32* width, S32* height )
     F32 target_height = (F32)*height;
 
     // are my children visible?
-    if (needsArrange())
+    if (needs_arrange)
     {
         // set last arrange generation first, in case children are animating
         // and need to be arranged again
@@ -26,6 +26,7 @@
 
 #include "linden_common.h"
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -68,7 +69,8 @@ inline bool LLKeywordToken::isTail(const llwchar* s) const
 }
 
 LLKeywords::LLKeywords()
-:   mLoaded(false)
+:   mLoaded(false),
+    mLexedLength(0)
 {
 }
 
@@ -480,24 +482,66 @@ LLTrace::BlockTimerStatHandle FTM_SYNTAX_COLORING("Syntax Coloring");
 // Walk through a string, applying the rules specified by the keyword token list and
 // create a list of color segments.
 void LLKeywords::findSegments(std::vector<LLTextSegmentPtr>* seg_list, const LLWString& wtext, LLTextEditor& editor, LLStyleConstSP style)
+{
+    lexSegments(seg_list, wtext, editor, style, 0, -1, 0);
+}
+
+bool LLKeywords::findSegmentsIncremental(std::vector<LLTextSegmentPtr>* seg_list, const LLWString& wtext, LLTextEditor& editor, LLStyleConstSP style,
+                                         S32 edit_start, S32 edit_end, S32* restart_pos, S32* splice_pos)
+{
+    if (mRestartPositions.empty() || wtext.empty())
+    {
+        return false;
+    }
+
+    // last default-state line start at or before the edit; everything
+    // up to it lexes identically to the previous pass
+    std::vector<S32>::const_iterator it =
+        std::upper_bound(mRestartPositions.begin(), mRestartPositions.end(), edit_start);
+    if (it == mRestartPositions.begin())
+    {
+        return false;
+    }
+    const S32 restart = *(--it);
+
+    *restart_pos = restart;
+    *splice_pos = lexSegments(seg_list, wtext, editor, style, restart, edit_end,
+                              static_cast<S32>(wtext.size()) - mLexedLength);
+    return true;
+}
+
+S32 LLKeywords::lexSegments(std::vector<LLTextSegmentPtr>* seg_list, const LLWString& wtext, LLTextEditor& editor, LLStyleConstSP style,
+                            S32 start_pos, S32 stop_after, S32 old_delta)
 {
     LL_RECORD_BLOCK_TIME(FTM_SYNTAX_COLORING);
     seg_list->clear();
 
     if( wtext.empty() )
     {
-        return;
+        mRestartPositions.clear();
+        mLexedLength = 0;
+        return -1;
     }
 
     S32 text_len = static_cast<S32>(wtext.size()) + 1;
 
-    seg_list->push_back( new LLNormalTextSegment( style, 0, text_len, editor ) );
+    // restart points recorded for the next incremental pass; line
+    // starts before the window come from the previous pass unchanged
+    std::vector<S32> restarts;
+    for (std::vector<S32>::const_iterator rit = mRestartPositions.begin();
+         rit != mRestartPositions.end() && *rit < start_pos; ++rit)
+    {
+        restarts.push_back(*rit);
+    }
+    restarts.push_back(start_pos);
+
+    seg_list->push_back( new LLNormalTextSegment( style, start_pos, text_len, editor ) );
 
     const llwchar* base = wtext.c_str();
-    const llwchar* cur = base;
+    const llwchar* cur = base + start_pos;
     while( *cur )
     {
-        if( *cur == '\n' || cur == base )
+        if( *cur == '\n' || cur == base + start_pos )
         {
             if( *cur == '\n' )
             {
@@ -505,6 +549,40 @@ void LLKeywords::findSegments(std::vector<LLTextSegmentPtr>* seg_list, const LLW
                 text_segment->setToken( 0 );
                 insertSegment( *seg_list, text_segment, text_len, style, editor);
                 cur++;
+
+                // the lexer is in default state at this line start
+                const S32 line_start = (S32)(cur - base);
+                restarts.push_back(line_start);
+                if (stop_after >= 0 && line_start >= stop_after
+                    && std::binary_search(mRestartPositions.begin(), mRestartPositions.end(),
+                                          line_start - old_delta))
+                {
+                    // past the edit and back in the state the previous
+                    // pass had here; everything downstream re-lexes
+                    // identically, so stop and let the caller splice.
+                    // drop the trailing filler segment first.
+                    LLTextSegmentPtr last = seg_list->back();
+                    if (last->getStart() >= line_start)
+                    {
+                        seg_list->pop_back();
+                    }
+                    else
+                    {
+                        last->setEnd(line_start);
+                    }
+                    for (std::vector<S32>::const_iterator rit = mRestartPositions.begin();
+                         rit != mRestartPositions.end(); ++rit)
+                    {
+                        if (*rit > line_start - old_delta)
+                        {
+                            restarts.push_back(*rit + old_delta);
+                        }
+                    }
+                    mRestartPositions.swap(restarts);
+                    mLexedLength = static_cast<S32>(wtext.size());
+                    return line_start;
+                }
+
                 if( !*cur || *cur == '\n' )
                 {
                     continue;
@@ -695,6 +773,10 @@ void LLKeywords::findSegments(std::vector<LLTextSegmentPtr>* seg_list, const LLW
             }
         }
     }
+
+    mRestartPositions.swap(restarts);
+    mLexedLength = static_cast<S32>(wtext.size());
+    return -1;
 }
 
 void LLKeywords::insertSegments(const LLWString& wtext, std::vector<LLTextSegmentPtr>& seg_list, LLKeywordToken* cur_token, S32 text_len, S32 seg_start, S32 seg_end, LLStyleConstSP style, LLTextEditor& editor )
@@ -118,6 +118,24 @@ public:
                              const LLWString& text,
                              class LLTextEditor& editor,
                              LLStyleConstSP style);
+
+    // Incremental variant for a single edit whose changed region is
+    // [edit_start, edit_end] in the new text.  Re-lexes from the last
+    // default-state line start at or before the edit and stops at the
+    // first line past the edit where the lexer state provably matches
+    // the previous pass.  On success *restart_pos and *splice_pos bound
+    // the re-lexed window ([restart, splice), splice of -1 meaning end
+    // of text) and seg_list holds segments for that window only; the
+    // caller keeps its segments outside the window.  Returns false when
+    // there's no usable previous pass and a full findSegments() pass is
+    // needed instead.
+    bool        findSegmentsIncremental(std::vector<LLTextSegmentPtr>* seg_list,
+                             const LLWString& text,
+                             class LLTextEditor& editor,
+                             LLStyleConstSP style,
+                             S32 edit_start, S32 edit_end,
+                             S32* restart_pos, S32* splice_pos);
+
     void        initialize(LLSD SyntaxXML);
     void        processTokens();
 
@@ -187,6 +205,21 @@ protected:
 
     void insertSegment(std::vector<LLTextSegmentPtr>& seg_list, LLTextSegmentPtr new_segment, S32 text_len, LLStyleConstSP style, LLTextEditor& editor );
 
+    // Shared lexer behind findSegments()/findSegmentsIncremental().
+    // Lexes [start_pos, end of text), recording default-state line
+    // starts as restart points for the next incremental pass.  When
+    // stop_after is non-negative, stops at the first default-state line
+    // start >= stop_after that was also a restart point last pass
+    // (old position = new position - old_delta) and returns it; returns
+    // -1 when lexed to the end of the text.
+    S32         lexSegments(std::vector<LLTextSegmentPtr>* seg_list,
+                            const LLWString& wtext,
+                            LLTextEditor& editor,
+                            LLStyleConstSP style,
+                            S32 start_pos,
+                            S32 stop_after,
+                            S32 old_delta);
+
     bool        mLoaded;
     LLSD        mSyntax;
     word_token_map_t mWordTokenMap;
@@ -200,6 +233,12 @@ protected:
     std::string getAttribute(std::string_view key);
 
     std::string getArguments(LLSD& arguments);
+
+    // bookkeeping from the last lexing pass for incremental re-lexing:
+    // sorted offsets of line starts reached in default lexer state, and
+    // the text length they were recorded against
+    std::vector<S32> mRestartPositions;
+    S32              mLexedLength;
 };
 
 #endif  // LL_LLKEYWORDS_H
@@ -384,6 +384,7 @@ void LLMenuItemGL::buildDrawLabel( void )
     std::string st = mDrawAccelLabel.getString();
     appendAcceleratorString( st );
     mDrawAccelLabel = st;
+    mFontBufferAccelLabel.reset();
 }
 
 void LLMenuItemGL::onCommit( void )
@@ -513,26 +514,26 @@ void LLMenuItemGL::draw( void )
     // Draw the text on top.
     if (mBriefItem)
     {
-        mFont->render( mLabel, 0, BRIEF_PAD_PIXELS / 2, 0, color,
+        mFontBufferLabel.render( mFont, mLabel.getWString(), 0, (F32)(BRIEF_PAD_PIXELS / 2), 0.f, color,
                        LLFontGL::LEFT, LLFontGL::BOTTOM, LLFontGL::NORMAL);
     }
     else
     {
         if( !mDrawBoolLabel.empty() )
         {
-            mFont->render( mDrawBoolLabel.getWString(), 0, (F32)LEFT_PAD_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
+            mFontBufferBoolLabel.render( mFont, mDrawBoolLabel.getWString(), 0, (F32)LEFT_PAD_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
                            LLFontGL::LEFT, LLFontGL::BOTTOM, LLFontGL::NORMAL, LLFontGL::NO_SHADOW, S32_MAX, S32_MAX, NULL, false );
         }
-        mFont->render( mLabel.getWString(), 0, (F32)LEFT_PLAIN_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
+        mFontBufferLabel.render( mFont, mLabel.getWString(), 0, (F32)LEFT_PLAIN_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
                        LLFontGL::LEFT, LLFontGL::BOTTOM, LLFontGL::NORMAL, LLFontGL::NO_SHADOW, S32_MAX, S32_MAX, NULL, false );
         if( !mDrawAccelLabel.empty() )
         {
-            mFont->render( mDrawAccelLabel.getWString(), 0, (F32)getRect().mRight - (F32)RIGHT_PLAIN_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
+            mFontBufferAccelLabel.render( mFont, mDrawAccelLabel.getWString(), 0, (F32)getRect().mRight - (F32)RIGHT_PLAIN_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
                            LLFontGL::RIGHT, LLFontGL::BOTTOM, LLFontGL::NORMAL, LLFontGL::NO_SHADOW, S32_MAX, S32_MAX, NULL, false );
         }
         if( !mDrawBranchLabel.empty() )
         {
-            mFont->render( mDrawBranchLabel.getWString(), 0, (F32)getRect().mRight - (F32)RIGHT_PAD_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
+            mFontBufferBranchLabel.render( mFont, mDrawBranchLabel.getWString(), 0, (F32)getRect().mRight - (F32)RIGHT_PAD_PIXELS, ((F32)MENU_ITEM_PADDING / 2.f), color,
                            LLFontGL::RIGHT, LLFontGL::BOTTOM, LLFontGL::NORMAL, LLFontGL::NO_SHADOW, S32_MAX, S32_MAX, NULL, false );
         }
     }
@@ -555,6 +556,7 @@ void LLMenuItemGL::draw( void )
 bool LLMenuItemGL::setLabelArg( const std::string& key, const LLStringExplicit& text )
 {
     mLabel.setArg(key, text);
+    mFontBufferLabel.reset();
     return true;
 }
 
@@ -926,6 +928,7 @@ void LLMenuItemCheckGL::setValue(const LLSD& value)
     {
         mDrawBoolLabel.clear();
     }
+    mFontBufferBoolLabel.reset();
 }
 
 //virtual
@@ -959,6 +962,7 @@ void LLMenuItemCheckGL::buildDrawLabel( void )
     {
         mDrawBoolLabel.clear();
     }
+    mFontBufferBoolLabel.reset();
     LLMenuItemCallGL::buildDrawLabel();
 }
 
@@ -1073,7 +1077,9 @@ void LLMenuItemBranchGL::buildDrawLabel( void )
     std::string st = mDrawAccelLabel;
     appendAcceleratorString( st );
     mDrawAccelLabel = st;
+    mFontBufferAccelLabel.reset();
     mDrawBranchLabel = LLMenuGL::BRANCH_SUFFIX;
+    mFontBufferBranchLabel.reset();
 }
 
 void LLMenuItemBranchGL::onCommit( void )
@@ -1400,6 +1406,7 @@ void LLMenuItemBranchDownGL::buildDrawLabel( void )
     std::string st = mDrawAccelLabel;
     appendAcceleratorString( st );
     mDrawAccelLabel = st;
+    mFontBufferAccelLabel.reset();
 }
 
 void LLMenuItemBranchDownGL::openMenu( void )
@@ -1636,7 +1643,7 @@ void LLMenuItemBranchDownGL::draw( void )
     {
         color = mDisabledColor.get();
     }
-    getFont()->render( mLabel.getWString(), 0, (F32)getRect().getWidth() / 2.f, (F32)LABEL_BOTTOM_PAD_PIXELS, color,
+    mFontBufferLabel.render( getFont(), mLabel.getWString(), 0, (F32)getRect().getWidth() / 2.f, (F32)LABEL_BOTTOM_PAD_PIXELS, color,
                    LLFontGL::HCENTER, LLFontGL::BOTTOM, LLFontGL::NORMAL);
 
 
@@ -4155,8 +4162,10 @@ void LLContextMenuBranch::buildDrawLabel( void )
     std::string st = mDrawAccelLabel;
     appendAcceleratorString( st );
     mDrawAccelLabel = st;
+    mFontBufferAccelLabel.reset();
 
     mDrawBranchLabel = LLMenuGL::BRANCH_SUFFIX;
+    mFontBufferBranchLabel.reset();
 }
 
 void    LLContextMenuBranch::showSubMenu()
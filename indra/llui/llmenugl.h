@@ -35,6 +35,7 @@
 
 #include "llkeyboard.h"
 #include "llfloater.h"
+#include "llfontvertexbuffer.h"
 #include "lluistring.h"
 #include "llview.h"
 #include <boost/function.hpp>
@@ -122,7 +123,7 @@ public:
     bool getAllowKeyRepeat() const { return mAllowKeyRepeat; }
 
     // change the label
-    void setLabel( const LLStringExplicit& label ) { mLabel = label; }
+    void setLabel( const LLStringExplicit& label ) { mLabel = label; mFontBufferLabel.reset(); }
     std::string getLabel( void ) const { return mLabel.getString(); }
     virtual bool setLabelArg( const std::string& key, const LLStringExplicit& text );
 
@@ -202,6 +203,13 @@ protected:
     LLUIString mDrawAccelLabel;
     LLUIString mDrawBranchLabel;
 
+    // Cached glyph runs for the labels above. The buffers only compare
+    // position, color and style, so reset them whenever a label changes.
+    LLFontVertexBuffer mFontBufferLabel;
+    LLFontVertexBuffer mFontBufferBoolLabel;
+    LLFontVertexBuffer mFontBufferAccelLabel;
+    LLFontVertexBuffer mFontBufferBranchLabel;
+
     LLUIColor mEnabledColor;
     LLUIColor mDisabledColor;
     LLUIColor mHighlightBackground;
@@ -84,30 +84,29 @@ struct SortScrollListItem
 
             S32 order = sort_ascending ? 1 : -1; // ascending or descending sort for this column?
 
-            const LLScrollListCell *cell1 = i1->getColumn(col_idx);
-            const LLScrollListCell *cell2 = i2->getColumn(col_idx);
-            if (cell1 && cell2)
+            if (mSortSignal && i1->getColumn(col_idx) && i2->getColumn(col_idx))
             {
-                if(mSortSignal)
+                sort_result = order * (*mSortSignal)(col_idx,i1, i2);
+            }
+            else
+            {
+                // the getColumnValue accessors also work for virtualized
+                // rows whose cell widgets haven't been built yet
+                std::string alt1 = i1->getColumnAltValue(col_idx).asString();
+                std::string alt2 = i2->getColumnAltValue(col_idx).asString();
+                if (mAltSort && !alt1.empty() && !alt2.empty())
                 {
-                    sort_result = order * (*mSortSignal)(col_idx,i1, i2);
+                    sort_result = order * LLStringUtil::compareDict(alt1, alt2);
                 }
                 else
                 {
-                    if (mAltSort && !cell1->getAltValue().asString().empty() && !cell2->getAltValue().asString().empty())
-                    {
-                        sort_result = order * LLStringUtil::compareDict(cell1->getAltValue().asString(), cell2->getAltValue().asString());
-                    }
-                    else
-                    {
-                        sort_result = order * LLStringUtil::compareDict(cell1->getValue().asString(), cell2->getValue().asString());
-                    }
-                }
-                if (sort_result != 0)
-                {
-                    break; // we have a sort order!
+                    sort_result = order * LLStringUtil::compareDict(i1->getColumnValue(col_idx).asString(), i2->getColumnValue(col_idx).asString());
                 }
             }
+            if (sort_result != 0)
+            {
+                break; // we have a sort order!
+            }
         }
 
         return sort_result < 0;
@@ -151,6 +150,7 @@ LLScrollListCtrl::Params::Params()
     mouse_wheel_opaque("mouse_wheel_opaque", false),
     commit_on_keyboard_movement("commit_on_keyboard_movement", true),
     commit_on_selection_change("commit_on_selection_change", false),
+    lazy_cell_creation("lazy_cell_creation", false),
     heading_height("heading_height"),
     page_lines("page_lines", 0),
     background_visible("background_visible"),
@@ -187,6 +187,7 @@ LLScrollListCtrl::LLScrollListCtrl(const LLScrollListCtrl::Params& p)
     mNeedsScroll(false),
     mCanSelect(true),
     mCanSort(p.can_sort),
+    mLazyCellCreation(p.lazy_cell_creation),
     mColumnsDirty(false),
     mMaxItemCount(INT_MAX),
     mBorderThickness( 2 ),
@@ -612,7 +613,10 @@ bool LLScrollListCtrl::addItem( LLScrollListItem* item, EAddPosition pos, bool r
             if (i >= (S32)mColumnsIndexed.size())
                 break;
 
-            cell->setWidth(mColumnsIndexed[i]->getWidth());
+            if (cell)
+            {
+                cell->setWidth(mColumnsIndexed[i]->getWidth());
+            }
         }
 
         updateLineHeightInsert(item);
@@ -703,7 +707,10 @@ void LLScrollListCtrl::updateLineHeight()
         S32 i = 0;
         for (const LLScrollListCell* cell = itemp->getColumn(i); i < num_cols; cell = itemp->getColumn(++i))
         {
-            mLineHeight = llmax( mLineHeight, cell->getHeight() + mRowPadding );
+            if (cell)
+            {
+                mLineHeight = llmax( mLineHeight, cell->getHeight() + mRowPadding );
+            }
         }
     }
 }
@@ -715,8 +722,51 @@ void LLScrollListCtrl::updateLineHeightInsert(LLScrollListItem* itemp)
     S32 i = 0;
     for (const LLScrollListCell* cell = itemp->getColumn(i); i < num_cols; cell = itemp->getColumn(++i))
     {
-        mLineHeight = llmax( mLineHeight, cell->getHeight() + mRowPadding );
+        if (cell)
+        {
+            mLineHeight = llmax( mLineHeight, cell->getHeight() + mRowPadding );
+        }
+    }
+}
+
+// Build the cell widgets for a row added in lazy mode; a no-op for rows
+// that already have their cells.
+void LLScrollListCtrl::materializeItem(LLScrollListItem* item)
+{
+    if (!item || !item->hasLazyCells())
+    {
+        return;
     }
+
+    S32 num_cols = item->getNumColumns();
+    for (S32 index = 0; index < num_cols; index++)
+    {
+        LLScrollListColumn* columnp = (index < (S32)mColumnsIndexed.size()) ? mColumnsIndexed[index] : NULL;
+        const LLScrollListCell::Params* lazy_p = item->getLazyCell(index);
+
+        LLScrollListCell::Params cell_p = lazy_p ? *lazy_p : LLScrollListCell::Params();
+        if (!cell_p.width.isProvided() && columnp)
+        {
+            cell_p.width = columnp->getWidth();
+        }
+
+        // columns without cell params get the same dummy spacers as eagerly built rows
+        LLScrollListCell* cell = lazy_p ? LLScrollListCell::create(cell_p) : new LLScrollListSpacer(cell_p);
+        if (cell)
+        {
+            item->setColumn(index, cell);
+            if (columnp
+                && columnp->mHeader
+                && cell->isText()
+                && !cell->getValue().asString().empty())
+            {
+                columnp->mHeader->setHasResizableElement(true);
+            }
+        }
+    }
+
+    item->clearLazyCells();
+    updateLineHeightInsert(item);
 }
 
 void LLScrollListCtrl::updateColumns(bool force_update)
@@ -794,7 +844,10 @@ void LLScrollListCtrl::updateColumns(bool force_update)
                 if (i >= (S32)mColumnsIndexed.size())
                     break;
 
-                cell->setWidth(mColumnsIndexed[i]->getWidth());
+                if (cell)
+                {
+                    cell->setWidth(mColumnsIndexed[i]->getWidth());
+                }
             }
         }
     }
@@ -1268,7 +1321,7 @@ LLScrollListItem* LLScrollListCtrl::getItemByLabel(const std::string& label, boo
 
     for (LLScrollListItem* item : mItemList)
     {
-        std::string item_text = item->getColumn(column)->getValue().asString(); // Only select enabled items with matching names
+        std::string item_text = item->getColumnValue(column).asString(); // Only select enabled items with matching names
         if (!case_sensitive)
         {
             LLStringUtil::toLower(item_text);
@@ -1313,8 +1366,8 @@ bool LLScrollListCtrl::selectItemByPrefix(const LLWString& target, bool case_sen
         {
             LLScrollListItem* item = *iter;
             // Only select enabled items with matching names
-            LLScrollListCell* cellp = item->getColumn(column == -1 ? getSearchColumn() : column);
-            bool select = cellp ? item->getEnabled() && ('\0' == cellp->getValue().asString()[0]) : false;
+            std::string item_text = item->getColumnValue(column == -1 ? getSearchColumn() : column).asString();
+            bool select = item->getEnabled() && ('\0' == item_text[0]);
             if (select)
             {
                 selectItem(item, -1);
@@ -1336,12 +1389,8 @@ bool LLScrollListCtrl::selectItemByPrefix(const LLWString& target, bool case_sen
             LLScrollListItem* item = *iter;
 
             // Only select enabled items with matching names
-            LLScrollListCell* cellp = item->getColumn(column == -1 ? getSearchColumn() : column);
-            if (!cellp)
-            {
-                continue;
-            }
-            LLWString item_label = utf8str_to_wstring(cellp->getValue().asString());
+            S32 search_column = column == -1 ? getSearchColumn() : column;
+            LLWString item_label = utf8str_to_wstring(item->getColumnValue(search_column).asString());
             if (!case_sensitive)
             {
                 LLWStringUtil::toLower(item_label);
@@ -1354,10 +1403,13 @@ bool LLScrollListCtrl::selectItemByPrefix(const LLWString& target, bool case_sen
 
             if (select)
             {
+                selectItem(item, -1); // builds cells for virtualized rows
                 // find offset of matching text (might have leading whitespace)
                 auto offset = item_label.find(target_trimmed);
-                cellp->highlightText(static_cast<S32>(offset), static_cast<S32>(target_trimmed.size()));
-                selectItem(item, -1);
+                if (LLScrollListCell* cellp = item->getColumn(search_column))
+                {
+                    cellp->highlightText(static_cast<S32>(offset), static_cast<S32>(target_trimmed.size()));
+                }
                 found = true;
                 break;
             }
@@ -1406,12 +1458,7 @@ U32 LLScrollListCtrl::searchItems(const LLWString& substring, bool case_sensitiv
             {
                 continue;
             }
-            LLScrollListCell* cellp = item->getColumn(getSearchColumn());
-            if (!cellp)
-            {
-                continue;
-            }
-            LLWString item_label = utf8str_to_wstring(cellp->getValue().asString());
+            LLWString item_label = utf8str_to_wstring(item->getColumnValue(getSearchColumn()).asString());
             if (!case_sensitive)
             {
                 LLWStringUtil::toLower(item_label);
@@ -1423,9 +1470,12 @@ U32 LLScrollListCtrl::searchItems(const LLWString& substring, bool case_sensitiv
 
             if (found_iter != std::string::npos)
             {
+                selectItem(item, -1, false); // builds cells for virtualized rows
                 // find offset of matching text
-                cellp->highlightText(static_cast<S32>(found_iter), static_cast<S32>(substring_trimmed.size()));
-                selectItem(item, -1, false);
+                if (LLScrollListCell* cellp = item->getColumn(getSearchColumn()))
+                {
+                    cellp->highlightText(static_cast<S32>(found_iter), static_cast<S32>(substring_trimmed.size()));
+                }
 
                 found++;
 
@@ -1619,6 +1669,9 @@ void LLScrollListCtrl::drawItems()
         {
             LLScrollListItem* item = mItemList[line];
 
+            // build cell widgets for virtualized rows as they come into view
+            materializeItem(item);
+
             item_rect.setOriginAndSize(
                 x,
                 cur_y,
@@ -2563,16 +2616,18 @@ bool LLScrollListCtrl::handleUnicodeCharHere(llwchar uni_char)
         {
             LLScrollListItem* item = *iter;
 
-            LLScrollListCell* cellp = item->getColumn(getSearchColumn());
-            if (cellp)
+            // Only select enabled items with matching first characters
+            LLWString item_label = utf8str_to_wstring(item->getColumnValue(getSearchColumn()).asString());
+            if (!item_label.empty())
             {
-                // Only select enabled items with matching first characters
-                LLWString item_label = utf8str_to_wstring(cellp->getValue().asString());
                 if (item->getEnabled() && LLStringOps::toLower(item_label[0]) == uni_char)
                 {
                     selectItem(item, -1);
                     mNeedsScroll = true;
-                    cellp->highlightText(0, 1);
+                    if (LLScrollListCell* cellp = item->getColumn(getSearchColumn()))
+                    {
+                        cellp->highlightText(0, 1);
+                    }
                     mSearchTimer.reset();
 
                     if (mCommitOnKeyboardMovement
@@ -2626,6 +2681,10 @@ void LLScrollListCtrl::selectItem(LLScrollListItem* itemp, S32 cell, bool select
 {
     if (itemp && !itemp->getSelected())
     {
+        // callers routinely inspect cells of selected items, so a
+        // virtualized row gets its widgets on selection
+        materializeItem(itemp);
+
         if (mLastSelected)
         {
             LLScrollListCell* cellp = mLastSelected->getColumn(getSearchColumn());
@@ -3155,6 +3214,68 @@ LLScrollListItem* LLScrollListCtrl::addRow(LLScrollListItem *new_item, const LLS
     if (!item_p.validateBlock() || !new_item) return NULL;
     new_item->setNumColumns(static_cast<S32>(mColumns.size()));
 
+    if (mLazyCellCreation)
+    {
+        // Virtualized row: resolve columns (creating any new ones) but only
+        // store the cell params; the widgets are built when the row is first
+        // displayed.
+        S32 lazy_col_index = 0;
+        for(LLInitParam::ParamIterator<LLScrollListCell::Params>::const_iterator itor = item_p.columns.begin();
+            itor != item_p.columns.end();
+            ++itor)
+        {
+            LLScrollListCell::Params cell_p = *itor;
+            std::string column = cell_p.column;
+
+            // empty columns strings index by ordinal
+            if (column.empty())
+            {
+                column = llformat("%d", lazy_col_index);
+            }
+
+            LLScrollListColumn* columnp = getColumn(column);
+
+            // create new column on demand
+            if (!columnp)
+            {
+                LLScrollListColumn::Params new_column;
+                new_column.name = column;
+                new_column.header.label = column;
+
+                if (cell_p.width.isProvided())
+                {
+                    new_column.width.pixel_width = cell_p.width;
+                }
+                addColumn(new_column);
+                columnp = mColumns[column];
+                new_item->setNumColumns(static_cast<S32>(mColumns.size()));
+            }
+
+            new_item->setLazyCell(columnp->mIndex, cell_p);
+            lazy_col_index++;
+        }
+
+        if (item_p.columns.empty())
+        {
+            if (mColumns.empty())
+            {
+                LLScrollListColumn::Params new_column;
+                new_column.name = "0";
+
+                addColumn(new_column);
+                new_item->setNumColumns(static_cast<S32>(mColumns.size()));
+            }
+            new_item->setLazyCell(0, LLScrollListCell::Params().value(item_p.value));
+        }
+
+        // seed the row height from the default cell font so list extents and
+        // scrollbar range are right before any cell widget exists
+        mLineHeight = llmax(mLineHeight, LLFontGL::getFontEmojiSmall()->getLineHeight() + mRowPadding);
+
+        addItem(new_item, pos);
+        return new_item;
+    }
+
     // Add any columns we don't already have
     S32 col_index = 0;
 
@@ -3403,20 +3524,16 @@ bool LLScrollListCtrl::highlightMatchingItems(const std::string& filter_str)
     std::vector<LLScrollListItem*>::iterator iter = data.begin();
     while (iter != data.end())
     {
-        LLScrollListCell* cell = (*iter)->getColumn(0);
-        if (cell)
+        std::string value = (*iter)->getColumnValue(0).asString();
+        LLStringUtil::toLower(value);
+        if (value.find(filter_str_lc) == std::string::npos)
         {
-            std::string value = cell->getValue().asString();
-            LLStringUtil::toLower(value);
-            if (value.find(filter_str_lc) == std::string::npos)
-            {
-                (*iter)->setHighlighted(false);
-            }
-            else
-            {
-                (*iter)->setHighlighted(true);
-                res = true;
-            }
+            (*iter)->setHighlighted(false);
+        }
+        else
+        {
+            (*iter)->setHighlighted(true);
+            res = true;
         }
         iter++;
     }
@@ -110,7 +110,8 @@ public:
         Optional<bool>  multi_select,
                         commit_on_keyboard_movement,
                         commit_on_selection_change,
-                        mouse_wheel_opaque;
+                        mouse_wheel_opaque,
+                        lazy_cell_creation; // virtualized rows: build cell widgets on first display
 
         Optional<ESelectionType, SelectionTypeNames> selection_type;
 
@@ -316,6 +317,8 @@ public:
     void setCommitOnKeyboardMovement(bool b)    { mCommitOnKeyboardMovement = b; }
     void setCommitOnSelectionChange(bool b)     { mCommitOnSelectionChange = b; }
     void setAllowKeyboardMovement(bool b)       { mAllowKeyboardMovement = b; }
+    void setLazyCellCreation(bool b)            { mLazyCellCreation = b; }
+    bool getLazyCellCreation() const            { return mLazyCellCreation; }
 
     void            setMaxSelectable(U32 max_selected) { mMaxSelectable = max_selected; }
     S32             getMaxSelectable() { return mMaxSelectable; }
@@ -460,6 +463,7 @@ private:
     void            drawItems();
 
     void            updateLineHeightInsert(LLScrollListItem* item);
+    void            materializeItem(LLScrollListItem* item);
     void            reportInvalidInput();
     bool            isRepeatedChars(const LLWString& string) const;
     void            selectItem(LLScrollListItem* itemp, S32 cell, bool single_select = true);
@@ -493,6 +497,7 @@ private:
     bool            mMouseWheelOpaque;
     bool            mCanSelect;
     bool            mCanSort;       // Whether user is allowed to sort
+    bool            mLazyCellCreation; // Rows store cell params only; widgets are built when first displayed
     bool            mDisplayColumnHeaders;
     bool            mColumnsDirty;
     bool            mColumnWidthsDirty;
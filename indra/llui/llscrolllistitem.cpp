@@ -54,6 +54,7 @@ LLScrollListItem::~LLScrollListItem()
 {
     std::for_each(mColumns.begin(), mColumns.end(), DeletePointer());
     mColumns.clear();
+    clearLazyCells();
 }
 
 void LLScrollListItem::setSelected(bool b)
@@ -127,6 +128,93 @@ LLScrollListCell* LLScrollListItem::getColumn(const S32 i) const
     return NULL;
 }
 
+void LLScrollListItem::setLazyCell(S32 column, const LLScrollListCell::Params& p)
+{
+    if (column < 0)
+    {
+        return;
+    }
+    if (column >= (S32)mLazyCells.size())
+    {
+        mLazyCells.resize(llmax(column + 1, getNumColumns()), (LLScrollListCell::Params*)NULL);
+    }
+    delete mLazyCells[column];
+    mLazyCells[column] = new LLScrollListCell::Params(p);
+}
+
+const LLScrollListCell::Params* LLScrollListItem::getLazyCell(S32 column) const
+{
+    if (0 <= column && column < (S32)mLazyCells.size())
+    {
+        return mLazyCells[column];
+    }
+    return NULL;
+}
+
+void LLScrollListItem::clearLazyCells()
+{
+    std::for_each(mLazyCells.begin(), mLazyCells.end(), DeletePointer());
+    mLazyCells.clear();
+}
+
+LLSD LLScrollListItem::getColumnValue(S32 column) const
+{
+    if (const LLScrollListCell* cell = getColumn(column))
+    {
+        return cell->getValue();
+    }
+    if (const LLScrollListCell::Params* lazy_p = getLazyCell(column))
+    {
+        return lazy_p->value();
+    }
+    return LLSD();
+}
+
+LLSD LLScrollListItem::getColumnAltValue(S32 column) const
+{
+    if (const LLScrollListCell* cell = getColumn(column))
+    {
+        return cell->getAltValue();
+    }
+    if (const LLScrollListCell::Params* lazy_p = getLazyCell(column))
+    {
+        return lazy_p->alt_value();
+    }
+    return LLSD();
+}
+
+void LLScrollListItem::setColumnValue(S32 column, const LLSD& value)
+{
+    if (LLScrollListCell* cell = getColumn(column))
+    {
+        cell->setValue(value);
+    }
+    else if (hasLazyCells() && 0 <= column && column < getNumColumns())
+    {
+        if (column >= (S32)mLazyCells.size())
+        {
+            mLazyCells.resize(column + 1, (LLScrollListCell::Params*)NULL);
+        }
+        if (!mLazyCells[column])
+        {
+            mLazyCells[column] = new LLScrollListCell::Params();
+        }
+        mLazyCells[column]->value = value;
+    }
+}
+
+void LLScrollListItem::setColumnAltValue(S32 column, const LLSD& value)
+{
+    if (LLScrollListCell* cell = getColumn(column))
+    {
+        cell->setAltValue(value);
+    }
+    else if (0 <= column && column < (S32)mLazyCells.size() && mLazyCells[column])
+    {
+        mLazyCells[column]->alt_value = value;
+    }
+}
+
 std::string LLScrollListItem::getContentsCSV() const
 {
     std::string ret;
@@ -134,7 +222,7 @@ std::string LLScrollListItem::getContentsCSV() const
     S32 count = getNumColumns();
     for (S32 i=0; i<count; ++i)
     {
-        ret += getColumn(i)->getValue().asString();
+        ret += getColumnValue(i).asString();
         if (i < count-1)
         {
             ret += ", ";
@@ -167,6 +255,9 @@ void LLScrollListItem::draw(const LLRect& rect, const LLColor4& fg_color, const
 
     for (LLScrollListCell* cell = getColumn(0); cur_col < num_cols; cell = getColumn(++cur_col))
     {
+        // NULL cells belong to rows whose widgets haven't been built yet
+        if (!cell) continue;
+
         // Two ways a cell could be hidden
         if (cell->getWidth() < 0
             || !cell->getVisible()) continue;
@@ -114,6 +114,21 @@ public:
 
     LLScrollListCell *getColumn(const S32 i) const;
 
+    // Virtualized rows: a scroll list in lazy mode stores only the cell
+    // parameters here and builds the cell widgets when the row first
+    // becomes visible. A NULL entry stands for a spacer cell.
+    void    setLazyCell(S32 column, const LLScrollListCell::Params& p);
+    const LLScrollListCell::Params* getLazyCell(S32 column) const;
+    bool    hasLazyCells() const            { return !mLazyCells.empty(); }
+    void    clearLazyCells();
+
+    // Column accessors that work whether or not the cell widgets have
+    // been built, so sorting and data updates don't force cell creation.
+    LLSD    getColumnValue(S32 column) const;
+    LLSD    getColumnAltValue(S32 column) const;
+    void    setColumnValue(S32 column, const LLSD& value);
+    void    setColumnAltValue(S32 column, const LLSD& value);
+
     std::string getContentsCSV() const;
 
     virtual void draw(const LLRect& rect,
@@ -136,6 +151,7 @@ private:
     LLSD    mItemValue;
     LLSD    mItemAltValue;
     std::vector<LLScrollListCell *> mColumns;
+    std::vector<LLScrollListCell::Params *> mLazyCells;
     LLRect  mRectangle;
 };
 
@@ -162,6 +162,7 @@ LLTextBase::Params::Params()
     clip_partial("clip_partial", true),
     line_spacing("line_spacing"),
     max_text_length("max_length", 255),
+    trim_from_top("trim_from_top", false),
     font_shadow("font_shadow"),
     text_valign("text_valign"),
     wrap("wrap"),
@@ -186,6 +187,7 @@ LLTextBase::LLTextBase(const LLTextBase::Params &p)
     mIsFriendSignal(NULL),
     mIsObjectBlockedSignal(NULL),
     mMaxTextByteLength( p.max_text_length ),
+    mTrimFromTop( p.trim_from_top ),
     mFont(p.font),
     mFontShadow(p.font_shadow),
     mPopupMenuHandle(),
@@ -206,6 +208,9 @@ LLTextBase::LLTextBase(const LLTextBase::Params &p)
     mTextSelectedColor(p.text_selected_color),
     mSelectedBGColor(p.bg_selected_color),
     mReflowIndex(S32_MAX),
+    mCachedUTF8ByteLength(0),
+    mCachedUTF8Generation(-1),
+    mLineRectUnionCount(0),
     mCursorPos( 0 ),
     mScrollNeeded(false),
     mDesiredXPixel(-1),
@@ -314,28 +319,57 @@ bool LLTextBase::truncate()
     // First rough check - if we're less than 1/4th the size, we're OK
     if (getLength() >= S32(mMaxTextByteLength / 4))
     {
-        // Have to check actual byte size
-        S32 utf8_byte_size = 0;
-        LLSD value = getViewModel()->getValue();
-        if (value.type() == LLSD::TypeString)
-        {
-            // save a copy for strings.
-            utf8_byte_size = static_cast<S32>(value.size());
-        }
-        else
-        {
-            // non string LLSDs need explicit conversion to string
-            utf8_byte_size = static_cast<S32>(value.asString().size());
-        }
+        // Have to check actual byte size; the cached length avoids
+        // round-tripping the whole document through UTF-8 on every insert
+        S32 utf8_byte_size = getTextUTF8ByteLength();
 
         if ( utf8_byte_size > mMaxTextByteLength )
         {
-            // Truncate safely in UTF-8
-            std::string temp_utf8_text = value.asString();
-            temp_utf8_text = utf8str_truncate( temp_utf8_text, mMaxTextByteLength );
-            LLWString text = utf8str_to_wstring( temp_utf8_text );
-            // remove extra bit of current string, to preserve formatting, etc.
-            removeStringNoUndo(static_cast<S32>(text.size()), static_cast<S32>(getWText().size() - text.size()));
+            const LLWString& text = getWText();
+            if (mTrimFromTop)
+            {
+                // page out the oldest quarter of the budget in one go, so a
+                // capped transcript doesn't re-truncate on every append
+                S32 target_bytes = S32(mMaxTextByteLength / 4) * 3;
+                S32 excess_bytes = utf8_byte_size - target_bytes;
+                S32 bytes = 0;
+                S32 cut_chars = 0;
+                while (cut_chars < (S32)text.size() && bytes < excess_bytes)
+                {
+                    bytes += wchar_utf8_length(text[cut_chars]);
+                    ++cut_chars;
+                }
+                // advance to a line boundary so we don't leave a partial line
+                while (cut_chars < (S32)text.size() && text[cut_chars - 1] != '\n')
+                {
+                    ++cut_chars;
+                }
+                removeStringNoUndo(0, cut_chars);
+                // keep cursor, scroll anchor and selection on the same text
+                mCursorPos = llmax(0, mCursorPos - cut_chars);
+                mScrollIndex = llmax(0, mScrollIndex - cut_chars);
+                mSelectionStart = llmax(0, mSelectionStart - cut_chars);
+                mSelectionEnd = llmax(0, mSelectionEnd - cut_chars);
+            }
+            else
+            {
+                // walk to the last character that fits in the byte budget,
+                // always cutting on a character boundary
+                S32 bytes = 0;
+                S32 keep_chars = 0;
+                while (keep_chars < (S32)text.size())
+                {
+                    S32 char_bytes = wchar_utf8_length(text[keep_chars]);
+                    if (bytes + char_bytes > mMaxTextByteLength)
+                    {
+                        break;
+                    }
+                    bytes += char_bytes;
+                    ++keep_chars;
+                }
+                // remove extra bit of current string, to preserve formatting, etc.
+                removeStringNoUndo(keep_chars, static_cast<S32>(text.size()) - keep_chars);
+            }
             did_truncate = true;
         }
     }
@@ -343,6 +377,17 @@ bool LLTextBase::truncate()
     return did_truncate;
 }
 
+S32 LLTextBase::getTextUTF8ByteLength()
+{
+    LLTextViewModel* model = getViewModel();
+    if (mCachedUTF8Generation != model->getDisplayGeneration())
+    {
+        mCachedUTF8ByteLength = wstring_utf8_length(model->getDisplay());
+        mCachedUTF8Generation = model->getDisplayGeneration();
+    }
+    return mCachedUTF8ByteLength;
+}
+
 const LLStyle::Params& LLTextBase::getStyleParams()
 {
     //FIXME: convert mDefaultStyle to a flyweight http://www.boost.org/doc/libs/1_40_0/libs/flyweight/doc/index.html
@@ -940,7 +985,13 @@ S32 LLTextBase::insertStringNoUndo(S32 pos, const LLWString &wstr, LLTextBase::s
         }
     }
 
+    bool utf8_cache_current = (mCachedUTF8Generation == getViewModel()->getDisplayGeneration());
     getViewModel()->getEditableDisplay().insert(pos, wstr);
+    if (utf8_cache_current)
+    {
+        mCachedUTF8ByteLength += wstring_utf8_length(wstr);
+        mCachedUTF8Generation = getViewModel()->getDisplayGeneration();
+    }
 
     if ( truncate() )
     {
@@ -1001,7 +1052,21 @@ S32 LLTextBase::removeStringNoUndo(S32 pos, S32 length)
         ++seg_iter;
     }
 
+    bool utf8_cache_current = (mCachedUTF8Generation == getViewModel()->getDisplayGeneration());
+    if (utf8_cache_current)
+    {
+        const LLWString& text = getWText();
+        S32 last = llmin(pos + length, (S32)text.size());
+        for (S32 i = pos; i < last; ++i)
+        {
+            mCachedUTF8ByteLength -= wchar_utf8_length(text[i]);
+        }
+    }
     getViewModel()->getEditableDisplay().erase(pos, length);
+    if (utf8_cache_current)
+    {
+        mCachedUTF8Generation = getViewModel()->getDisplayGeneration();
+    }
 
     // recreate default segment in case we erased everything
     createDefaultSegment();
@@ -1020,7 +1085,16 @@ S32 LLTextBase::overwriteCharNoUndo(S32 pos, llwchar wc)
     {
         return 0;
     }
+    bool utf8_cache_current = (mCachedUTF8Generation == getViewModel()->getDisplayGeneration());
+    if (utf8_cache_current)
+    {
+        mCachedUTF8ByteLength += wchar_utf8_length(wc) - wchar_utf8_length(getWText()[pos]);
+    }
     getViewModel()->getEditableDisplay()[pos] = wc;
+    if (utf8_cache_current)
+    {
+        mCachedUTF8Generation = getViewModel()->getDisplayGeneration();
+    }
 
     onValueChange(pos, pos + 1);
     needsReflow(pos);
@@ -1700,6 +1774,8 @@ void LLTextBase::reflow()
                 cur_top = iter->mRect.mTop;
                 getSegmentAndOffset(iter->mDocIndexStart, &seg_iter, &seg_offset);
                 mLineInfoList.erase(iter, mLineInfoList.end());
+                // cached line rect union only covers surviving lines now
+                mLineRectUnionCount = llmin(mLineRectUnionCount, (S32)mLineInfoList.size());
             }
         }
 
@@ -2393,6 +2469,7 @@ void LLTextBase::copyContents(const LLTextBase* source)
     }
 
     mLineInfoList.clear();
+    mLineRectUnionCount = 0;
     for (const line_info& li : mLineInfoList)
     {
         mLineInfoList.push_back(line_info(li));
@@ -3048,13 +3125,21 @@ void LLTextBase::updateRects()
     }
     else
     {
-        mTextBoundingRect = mLineInfoList.begin()->mRect;
-        for (line_list_t::const_iterator line_iter = ++mLineInfoList.begin();
-            line_iter != mLineInfoList.end();
-            ++line_iter)
+        // extend the cached union of earlier line rects with any lines added
+        // since the last reflow, so appends don't rescan the whole document
+        S32 line_count = (S32)mLineInfoList.size();
+        if (mLineRectUnionCount < 1 || mLineRectUnionCount > line_count)
         {
-            mTextBoundingRect.unionWith(line_iter->mRect);
+            mLineRectUnion = mLineInfoList.begin()->mRect;
+            mLineRectUnionCount = 1;
         }
+        mTextBoundingRect = mLineRectUnion;
+        for (S32 line_index = mLineRectUnionCount; line_index < line_count; ++line_index)
+        {
+            mTextBoundingRect.unionWith(mLineInfoList[line_index].mRect);
+        }
+        mLineRectUnion = mTextBoundingRect;
+        mLineRectUnionCount = line_count;
 
         mTextBoundingRect.mTop += mVPad;
 
@@ -3076,11 +3161,15 @@ void LLTextBase::updateRects()
             break;
         }
         // move line segments to fit new document rect
-        for (line_list_t::iterator it = mLineInfoList.begin(); it != mLineInfoList.end(); ++it)
+        if (delta_pos != 0)
         {
-            it->mRect.translate(0, delta_pos);
+            for (line_list_t::iterator it = mLineInfoList.begin(); it != mLineInfoList.end(); ++it)
+            {
+                it->mRect.translate(0, delta_pos);
+            }
+            mTextBoundingRect.translate(0, delta_pos);
+            mLineRectUnion.translate(0, delta_pos);
         }
-        mTextBoundingRect.translate(0, delta_pos);
     }
 
     // update document container dimensions according to text contents
@@ -3158,6 +3247,7 @@ void LLTextBase::updateRects()
                 it->mRect.translate(0, delta_pos);
             }
             mTextBoundingRect.translate(0, delta_pos);
+            mLineRectUnion.translate(0, delta_pos);
         }
     }
 
@@ -371,6 +371,10 @@ public:
 
         Optional<S32>           max_text_length;
 
+        // when over max_text_length, page out the oldest lines instead of
+        // rejecting the newest (for append-only views like chat transcripts)
+        Optional<bool>          trim_from_top;
+
         Optional<LLFontGL::ShadowType>  font_shadow;
 
         Optional<LLFontGL::VAlign> text_valign;
@@ -439,6 +443,7 @@ public:
     bool                    getUseColor() const { return mUseColor; }
     void                    setUseColor(bool value) { mUseColor = value; }
     bool                    truncate(); // returns true of truncation occurred
+    S32                     getTextUTF8ByteLength(); // byte length of document text, cached against the display generation
 
     bool                    isContentTrusted() const { return mTrustedContent; }
     void                    setContentTrusted(bool trusted_content) { mTrustedContent = trusted_content; }
@@ -452,6 +457,7 @@ public:
     /*virtual*/ const std::string& getText() const override;
     void                    setMaxTextLength(S32 length) { mMaxTextByteLength = length; }
     S32                     getMaxTextLength() { return mMaxTextByteLength; }
+    void                    setTrimFromTop(bool trim) { mTrimFromTop = trim; }
 
     // wide-char versions
     void                    setWText(const LLWString& text);
@@ -760,6 +766,7 @@ protected:
     bool                        mPlainText;         // didn't use Image or Icon segments
     bool                        mAutoIndent;
     S32                         mMaxTextByteLength; // Maximum length mText is allowed to be in bytes
+    bool                        mTrimFromTop;       // Over-length text drops oldest lines rather than newest
     bool                        mSkipTripleClick;
     bool                        mAlwaysShowIcons;
 
@@ -774,6 +781,10 @@ protected:
     S32                         mReflowIndex;       // index at which to start reflow.  S32_MAX indicates no reflow needed.
     bool                        mScrollNeeded;      // need to change scroll region because of change to cursor position
     S32                         mScrollIndex;       // index of first character to keep visible in scroll region
+    S32                         mCachedUTF8ByteLength;  // byte length of the document text, maintained incrementally by insert/remove
+    S32                         mCachedUTF8Generation;  // display generation mCachedUTF8ByteLength corresponds to (-1 = stale)
+    LLRect                      mLineRectUnion;     // cached union of the first mLineRectUnionCount line rects
+    S32                         mLineRectUnionCount;
 
     // Fired when a URL link is clicked
     commit_signal_t*            mURLClickSignal;
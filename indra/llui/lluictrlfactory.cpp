@@ -37,12 +37,14 @@
 // other library includes
 #include "llcontrol.h"
 #include "lldir.h"
+#include "llfile.h"
 #include "v4color.h"
 #include "v3dmath.h"
 #include "llquaternion.h"
 
 // this library includes
 #include "llpanel.h"
+#include "llui.h"
 
 //-----------------------------------------------------------------------------
 
@@ -153,6 +155,119 @@ void LLUICtrlFactory::createChildren(LLView* viewp, LLXMLNodePtr node, const wid
 
 }
 
+//-----------------------------------------------------------------------------
+// binary compiled-XUI cache
+//-----------------------------------------------------------------------------
+namespace
+{
+    const U32 XUI_BINARY_MAGIC = 0x42495558; // "XUIB"
+    const U32 XUI_BINARY_VERSION = 1;
+
+    bool xui_binary_cache_enabled()
+    {
+        // consulted on every floater/panel build; bind once
+        static bool enabled = []()
+        {
+            LLControlGroup* config = LLUI::getInstance()->mSettingGroups["config"];
+            return config && config->controlExists("XUIBinaryCache") && config->getBOOL("XUIBinaryCache");
+        }();
+        return enabled;
+    }
+
+    std::string xui_binary_cache_path(const std::string& xui_filename)
+    {
+        // flatten the relative XUI name into a single cache file name
+        std::string flat = xui_filename;
+        for (std::string::iterator it = flat.begin(); it != flat.end(); ++it)
+        {
+            if (*it == '/' || *it == '\\' || *it == ':')
+            {
+                *it = '_';
+            }
+        }
+        return gDirUtilp->getExpandedFilename(LL_PATH_CACHE, "xui_" + flat + ".bin");
+    }
+
+    U64 xui_source_mtime(const std::string& path)
+    {
+        llstat st;
+        if (LLFile::stat(path, &st) == 0)
+        {
+            return (U64)st.st_mtime;
+        }
+        return 0;
+    }
+
+    // The cached file records the layered source paths and their mtimes;
+    // any difference (edited file, changed skin or language layering)
+    // invalidates the cache and falls back to the XML parse.
+    bool read_cached_xui(const std::string& cache_path, const std::vector<std::string>& paths, LLXMLNodePtr& root)
+    {
+        llifstream in(cache_path, std::ios::in | std::ios::binary);
+        if (!in.is_open())
+        {
+            return false;
+        }
+
+        U32 header[3] = { 0, 0, 0 }; // magic, version, path count
+        in.read((char*)header, sizeof(header));
+        if (in.fail()
+            || header[0] != XUI_BINARY_MAGIC
+            || header[1] != XUI_BINARY_VERSION
+            || header[2] != (U32)paths.size())
+        {
+            return false;
+        }
+
+        for (const std::string& path : paths)
+        {
+            U32 path_size = 0;
+            in.read((char*)&path_size, sizeof(U32));
+            if (in.fail() || path_size != (U32)path.size())
+            {
+                return false;
+            }
+            std::string cached_path(path_size, '\0');
+            in.read(&cached_path[0], path_size);
+            U64 cached_mtime = 0;
+            in.read((char*)&cached_mtime, sizeof(U64));
+            if (in.fail() || cached_path != path || cached_mtime != xui_source_mtime(path))
+            {
+                return false;
+            }
+        }
+
+        return LLXMLNode::readBinaryStream(in, root) && root.notNull();
+    }
+
+    void write_cached_xui(const std::string& cache_path, const std::vector<std::string>& paths, LLXMLNodePtr& root)
+    {
+        llofstream out(cache_path, std::ios::out | std::ios::binary);
+        if (!out.is_open())
+        {
+            return;
+        }
+
+        U32 header[3] = { XUI_BINARY_MAGIC, XUI_BINARY_VERSION, (U32)paths.size() };
+        out.write((const char*)header, sizeof(header));
+        for (const std::string& path : paths)
+        {
+            U32 path_size = (U32)path.size();
+            out.write((const char*)&path_size, sizeof(U32));
+            out.write(path.data(), path_size);
+            U64 mtime = xui_source_mtime(path);
+            out.write((const char*)&mtime, sizeof(U64));
+        }
+
+        if (!root->writeBinaryStream(out))
+        {
+            // don't leave a truncated cache file behind
+            out.close();
+            LLFile::remove(cache_path);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // getLayeredXMLNode()
 //-----------------------------------------------------------------------------
@@ -169,6 +284,21 @@ bool LLUICtrlFactory::getLayeredXMLNode(const std::string &xui_filename, LLXMLNo
         paths.push_back(xui_filename);
     }
 
+    if (xui_binary_cache_enabled())
+    {
+        std::string cache_path = xui_binary_cache_path(xui_filename);
+        if (read_cached_xui(cache_path, paths, root))
+        {
+            return true;
+        }
+        if (LLXMLNode::getLayeredXMLNode(root, paths))
+        {
+            write_cached_xui(cache_path, paths, root);
+            return true;
+        }
+        return false;
+    }
+
     return LLXMLNode::getLayeredXMLNode(root, paths);
 }
 
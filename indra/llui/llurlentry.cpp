@@ -62,6 +62,23 @@ std::string LLUrlEntryBase::getUrl(const std::string &string) const
     return escapeUrl(string);
 }
 
+bool LLUrlEntryBase::hasAnchor(const std::string& text_lowercase) const
+{
+    if (mAnchors.empty())
+    {
+        // entry declares no anchor; always worth trying the regex
+        return true;
+    }
+    for (const std::string& anchor : mAnchors)
+    {
+        if (text_lowercase.find(anchor) != std::string::npos)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 //virtual
 std::string LLUrlEntryBase::getIcon(const std::string &url)
 {
@@ -289,6 +306,7 @@ LLUrlEntryHTTP::LLUrlEntryHTTP()
 {
     mPattern = boost::regex("https?://([^\\s/?\\.#]+\\.?)+\\.\\w+(:\\d+)?(/\\S*)?",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "http" };
     mMenuName = "menu_url_http.xml";
     mTooltip = LLTrans::getString("TooltipHttpUrl");
 }
@@ -325,6 +343,7 @@ LLUrlEntryHTTPLabel::LLUrlEntryHTTPLabel()
 {
     mPattern = boost::regex("\\[https?://\\S+[ \t]+[^\\]]+\\]",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "[http" };
     mMenuName = "menu_url_http.xml";
     mTooltip = LLTrans::getString("TooltipHttpUrl");
 }
@@ -350,6 +369,7 @@ LLUrlEntryInvalidSLURL::LLUrlEntryInvalidSLURL()
 {
     mPattern = boost::regex("(https?://(maps.secondlife.com|slurl.com)/secondlife/|secondlife://(/app/(worldmap|teleport)/)?)[^ /]+(/-?[0-9]+){1,3}(/?(\\?title|\\?img|\\?msg)=\\S*)?/?",
                                     boost::regex::perl|boost::regex::icase);
+    mAnchors = { "http", "secondlife:" };
     mMenuName = "menu_url_http.xml";
     mTooltip = LLTrans::getString("TooltipHttpUrl");
 }
@@ -437,6 +457,7 @@ LLUrlEntrySLURL::LLUrlEntrySLURL()
     // see http://slurl.com/about.php for details on the SLURL format
     mPattern = boost::regex("https?://(maps.secondlife.com|slurl.com)/secondlife/[^ /]+(/\\d+){0,3}(/?(\\?title|\\?img|\\?msg)=\\S*)?/?",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "http" };
     mIcon = "Hand";
     mMenuName = "menu_url_slurl.xml";
     mTooltip = LLTrans::getString("TooltipSLURL");
@@ -519,6 +540,7 @@ LLUrlEntrySecondlifeURL::LLUrlEntrySecondlifeURL()
                             "(https?://([-\\w\\.]*\\.)?secondlife\\.io(:\\d{1,5})?))"
                             "\\/\\S*",
         boost::regex::perl|boost::regex::icase);
+    mAnchors = { "http" };
 
     mIcon = "Hand";
     mMenuName = "menu_url_http.xml";
@@ -559,6 +581,7 @@ LLUrlEntrySimpleSecondlifeURL::LLUrlEntrySimpleSecondlifeURL()
                             "|"
                             "https?://([-\\w\\.]*\\.)?secondlifegrid\\.net(?!\\S)",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "http" };
 
     mIcon = "Hand";
     mMenuName = "menu_url_http.xml";
@@ -573,6 +596,7 @@ LLUrlEntryAgent::LLUrlEntryAgent()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/agent/[\\da-f-]+/\\w+",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/agent/" };
     mMenuName = "menu_url_agent.xml";
     mIcon = "Generic_Person";
 }
@@ -828,6 +852,7 @@ LLUrlEntryAgentCompleteName::LLUrlEntryAgentCompleteName()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/agent/[\\da-f-]+/completename",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/agent/" };
 }
 
 std::string LLUrlEntryAgentCompleteName::getName(const LLAvatarName& avatar_name)
@@ -844,6 +869,7 @@ LLUrlEntryAgentLegacyName::LLUrlEntryAgentLegacyName()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/agent/[\\da-f-]+/legacyname",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/agent/" };
 }
 
 std::string LLUrlEntryAgentLegacyName::getName(const LLAvatarName& avatar_name)
@@ -860,6 +886,7 @@ LLUrlEntryAgentDisplayName::LLUrlEntryAgentDisplayName()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/agent/[\\da-f-]+/displayname",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/agent/" };
 }
 
 std::string LLUrlEntryAgentDisplayName::getName(const LLAvatarName& avatar_name)
@@ -876,6 +903,7 @@ LLUrlEntryAgentUserName::LLUrlEntryAgentUserName()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/agent/[\\da-f-]+/username",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/agent/" };
 }
 
 std::string LLUrlEntryAgentUserName::getName(const LLAvatarName& avatar_name)
@@ -893,6 +921,7 @@ LLUrlEntryGroup::LLUrlEntryGroup()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/group/[\\da-f-]+/\\w+",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/group/" };
     mMenuName = "menu_url_group.xml";
     mIcon = "Generic_Group";
     mTooltip = LLTrans::getString("TooltipGroupUrl");
@@ -970,6 +999,7 @@ LLUrlEntryInventory::LLUrlEntryInventory()
     //x-grid-location-info://lincoln.lindenlab.com/app/inventory/0e346d8b-4433-4d66-a6b0-fd37083abc4c/select?name=name with spaces&param2=value
     mPattern = boost::regex(APP_HEADER_REGEX "/inventory/[\\da-f-]+/\\w+\\S*",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/inventory/" };
     mMenuName = "menu_url_inventory.xml";
 }
 
@@ -987,6 +1017,7 @@ LLUrlEntryObjectIM::LLUrlEntryObjectIM()
 {
     mPattern = boost::regex("secondlife:///app/objectim/[\\da-f-]+\?\\S*\\w",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/objectim/" };
     mMenuName = "menu_url_objectim.xml";
 }
 
@@ -1017,6 +1048,7 @@ LLUrlEntryChat::LLUrlEntryChat()
 {
     mPattern = boost::regex("secondlife:///app/chat/\\d+/\\S+",
         boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/chat/" };
     mMenuName = "menu_url_slapp.xml";
     mTooltip = LLTrans::getString("TooltipSLAPP");
 }
@@ -1042,6 +1074,7 @@ LLUrlEntryParcel::LLUrlEntryParcel()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/parcel/[\\da-f-]+/about",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/parcel/" };
     mMenuName = "menu_url_parcel.xml";
     mTooltip = LLTrans::getString("TooltipParcelUrl");
 
@@ -1133,6 +1166,7 @@ LLUrlEntryPlace::LLUrlEntryPlace()
 {
     mPattern = boost::regex("((x-grid-location-info://[-\\w\\.]+/region/)|(secondlife://))\\S+/?(\\d+/\\d+/\\d+|\\d+/\\d+)/?",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "x-grid-location-info://", "secondlife://" };
     mMenuName = "menu_url_slurl.xml";
     mTooltip = LLTrans::getString("TooltipSLURL");
 }
@@ -1181,6 +1215,7 @@ LLUrlEntryRegion::LLUrlEntryRegion()
 {
     mPattern = boost::regex("secondlife:///app/region/[A-Za-z0-9()_%]+(/\\d+)?(/\\d+)?(/\\d+)?/?",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/region/" };
     mMenuName = "menu_url_slurl.xml";
     mTooltip = LLTrans::getString("TooltipSLURL");
 }
@@ -1245,6 +1280,7 @@ LLUrlEntryTeleport::LLUrlEntryTeleport()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/teleport/\\S+(/\\d+)?(/\\d+)?(/\\d+)?/?\\S*",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/teleport/" };
     mMenuName = "menu_url_teleport.xml";
     mTooltip = LLTrans::getString("TooltipTeleportUrl");
 }
@@ -1315,6 +1351,7 @@ LLUrlEntrySL::LLUrlEntrySL()
 {
     mPattern = boost::regex("secondlife://(\\w+)?(:\\d+)?/\\S+",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "secondlife://" };
     mMenuName = "menu_url_slapp.xml";
     mTooltip = LLTrans::getString("TooltipSLAPP");
 }
@@ -1332,6 +1369,7 @@ LLUrlEntrySLLabel::LLUrlEntrySLLabel()
 {
     mPattern = boost::regex("\\[secondlife://\\S+[ \t]+[^\\]]+\\]",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "[secondlife://" };
     mMenuName = "menu_url_slapp.xml";
     mTooltip = LLTrans::getString("TooltipSLAPP");
 }
@@ -1381,6 +1419,7 @@ LLUrlEntryWorldMap::LLUrlEntryWorldMap()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/worldmap/\\S+/?(\\d+)?/?(\\d+)?/?(\\d+)?/?\\S*",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/worldmap/" };
     mMenuName = "menu_url_map.xml";
     mTooltip = LLTrans::getString("TooltipMapUrl");
 }
@@ -1422,6 +1461,7 @@ LLUrlEntryNoLink::LLUrlEntryNoLink()
 {
     mPattern = boost::regex("<nolink>.*?</nolink>",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "<nolink>" };
 }
 
 std::string LLUrlEntryNoLink::getUrl(const std::string &url) const
@@ -1449,6 +1489,7 @@ LLUrlEntryIcon::LLUrlEntryIcon()
 {
     mPattern = boost::regex("<icon\\s*>\\s*([^<]*)?\\s*</icon\\s*>",
                             boost::regex::perl|boost::regex::icase);
+    mAnchors = { "<icon" };
 }
 
 std::string LLUrlEntryIcon::getUrl(const std::string &url) const
@@ -1481,6 +1522,7 @@ LLUrlEntryEmail::LLUrlEntryEmail()
 {
     mPattern = boost::regex("(mailto:)?[\\w\\.\\-]+@[\\w\\.\\-]+\\.[a-z]{2,63}",
                             boost::regex::perl | boost::regex::icase);
+    mAnchors = { "@" };
     mMenuName = "menu_url_email.xml";
     mTooltip = LLTrans::getString("TooltipEmail");
 }
@@ -1511,6 +1553,7 @@ LLUrlEntryExperienceProfile::LLUrlEntryExperienceProfile()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/experience/[\\da-f-]+/profile",
         boost::regex::perl|boost::regex::icase);
+    mAnchors = { "/app/experience/" };
     mIcon = "Generic_Experience";
     mMenuName = "menu_url_experience.xml";
 }
@@ -1568,6 +1611,7 @@ LLUrlEntryIPv6::LLUrlEntryIPv6()
     mHostPath = "https?://\\[([a-f0-9:]+:+)+[a-f0-9]+]";
     mPattern = boost::regex(mHostPath + "(:\\d{1,5})?(/\\S*)?",
         boost::regex::perl | boost::regex::icase);
+    mAnchors = { "http" };
     mMenuName = "menu_url_http.xml";
     mTooltip = LLTrans::getString("TooltipHttpUrl");
 }
@@ -1610,6 +1654,7 @@ LLUrlEntryKeybinding::LLUrlEntryKeybinding()
 {
     mPattern = boost::regex(APP_HEADER_REGEX "/keybinding/\\w+(\\?mode=\\w+)?$",
                             boost::regex::perl | boost::regex::icase);
+    mAnchors = { "/app/keybinding/" };
     mMenuName = "menu_url_experience.xml";
 
     initLocalization();
@@ -39,6 +39,7 @@
 #include <boost/regex.hpp>
 #include <string>
 #include <map>
+#include <vector>
 
 class LLAvatarName;
 
@@ -70,7 +71,14 @@ public:
     virtual ~LLUrlEntryBase();
 
     /// Return the regex pattern that matches this Url
-    boost::regex getPattern() const { return mPattern; }
+    const boost::regex& getPattern() const { return mPattern; }
+
+    /// Return true if the text contains one of this entry's anchor
+    /// literals (or the entry declares none).  Anchors are substrings
+    /// guaranteed present in every match, letting LLUrlRegistry skip
+    /// the regex for entries that cannot possibly match.  The text
+    /// must be lowercased since most patterns are case-insensitive.
+    bool hasAnchor(const std::string& text_lowercase) const;
 
     /// Return the url from a string that matched the regex
     virtual std::string getUrl(const std::string &string) const;
@@ -126,6 +134,8 @@ protected:
     } LLUrlEntryObserver;
 
     boost::regex                                    mPattern;
+    // lowercase literals for hasAnchor(); empty means "always try the regex"
+    std::vector<std::string>                        mAnchors;
     std::string                                     mIcon;
     std::string                                     mMenuName;
     std::string                                     mTooltip;
@@ -105,7 +105,7 @@ void LLUrlRegistry::registerUrl(LLUrlEntryBase *url, bool force_front)
     }
 }
 
-static bool matchRegex(const char *text, boost::regex regex, U32 &start, U32 &end)
+static bool matchRegex(const char *text, const boost::regex &regex, U32 &start, U32 &end)
 {
     boost::cmatch result;
     bool found;
@@ -163,6 +163,11 @@ bool LLUrlRegistry::findUrl(const std::string &text, LLUrlMatch &match, const LL
         return false;
     }
 
+    // most entry patterns are case-insensitive, so the anchor prefilter
+    // below compares against one lowercased copy of the text
+    std::string text_lowercase(text);
+    LLStringUtil::toLower(text_lowercase);
+
     // find the first matching regex from all url entries in the registry
     U32 match_start = 0, match_end = 0;
     LLUrlEntryBase *match_entry = NULL;
@@ -178,6 +183,13 @@ bool LLUrlRegistry::findUrl(const std::string &text, LLUrlMatch &match, const LL
 
         LLUrlEntryBase *url_entry = *it;
 
+        // skip the regex entirely when the entry's anchor literal isn't
+        // in the text; this keeps findUrl() cost flat as handlers are added
+        if (! url_entry->hasAnchor(text_lowercase))
+        {
+            continue;
+        }
+
         U32 start = 0, end = 0;
         if (matchRegex(text.c_str(), url_entry->getPattern(), start, end))
         {
@@ -204,6 +216,13 @@ bool LLUrlRegistry::findUrl(const std::string &text, LLUrlMatch &match, const LL
                 match_start = start;
                 match_end = end;
                 match_entry = url_entry;
+
+                // entries are ordered by priority and ties go to the
+                // earliest entry, so nothing can beat a match at offset 0
+                if (match_start == 0)
+                {
+                    break;
+                }
             }
         }
     }
@@ -987,22 +987,126 @@ U32 LLControlGroup::saveToFile(const std::string& filename, bool nondefault_only
     return num_saved;
 }
 
+//-----------------------------------------------------------------------------
+// precompiled binary settings store
+//-----------------------------------------------------------------------------
+namespace
+{
+    const U32 SETTINGS_BINARY_MAGIC = 0x42544553;   // "SETB"
+    const U32 SETTINGS_BINARY_VERSION = 1;
+
+    // A compiled settings file lives beside its XML source with a ".bin"
+    // suffix.  The header pins the source's mtime and size, so editing
+    // the XML (or a viewer writing user settings) invalidates the image
+    // and the next load falls back to the XML parse, which rewrites it.
+    struct SettingsBinaryHeader
+    {
+        U32 mMagic;
+        U32 mVersion;
+        U64 mSourceMTime;
+        U64 mSourceSize;
+    };
+
+    bool read_compiled_settings(const std::string& filename, LLSD& settings)
+    {
+        llstat st;
+        if (LLFile::stat(filename, &st) != 0)
+        {
+            return false;
+        }
+
+        llifstream infile(filename + ".bin", std::ios::in | std::ios::binary);
+        if (!infile.is_open())
+        {
+            return false;
+        }
+
+        SettingsBinaryHeader header;
+        infile.read((char*)&header, sizeof(header));
+        if (infile.fail()
+            || header.mMagic != SETTINGS_BINARY_MAGIC
+            || header.mVersion != SETTINGS_BINARY_VERSION
+            || header.mSourceMTime != (U64)st.st_mtime
+            || header.mSourceSize != (U64)st.st_size)
+        {
+            return false;
+        }
+
+        // bulk-read the LLSD image and decode it in memory
+        infile.seekg(0, std::ios::end);
+        std::streamoff image_size = (std::streamoff)infile.tellg() - (std::streamoff)sizeof(header);
+        infile.seekg(sizeof(header), std::ios::beg);
+        if (image_size <= 0)
+        {
+            return false;
+        }
+        std::vector<U8> buffer((size_t)image_size);
+        infile.read((char*)buffer.data(), image_size);
+        if (infile.fail()
+            || LLSDParser::PARSE_FAILURE == LLSDSerialize::fromBinaryBuffer(settings, buffer.data(), buffer.size())
+            || !settings.isMap())
+        {
+            return false;
+        }
+        return true;
+    }
+
+    void write_compiled_settings(const std::string& filename, const LLSD& settings)
+    {
+        llstat st;
+        if (LLFile::stat(filename, &st) != 0)
+        {
+            return;
+        }
+
+        // app_settings may be read-only on installed builds; failing to
+        // write the image just means the next start parses the XML again
+        llofstream outfile(filename + ".bin", std::ios::out | std::ios::binary);
+        if (!outfile.is_open())
+        {
+            return;
+        }
+
+        SettingsBinaryHeader header;
+        header.mMagic = SETTINGS_BINARY_MAGIC;
+        header.mVersion = SETTINGS_BINARY_VERSION;
+        header.mSourceMTime = (U64)st.st_mtime;
+        header.mSourceSize = (U64)st.st_size;
+        outfile.write((const char*)&header, sizeof(header));
+
+        LLSDSerialize::toBinary(settings, outfile);
+        if (outfile.fail())
+        {
+            // don't leave a truncated image behind
+            outfile.close();
+            LLFile::remove(filename + ".bin");
+        }
+    }
+}
+
 U32 LLControlGroup::loadFromFile(const std::string& filename, bool set_default_values, bool save_values)
 {
     LLSD settings;
-    llifstream infile;
-    infile.open(filename.c_str());
-    if(!infile.is_open())
+    if (!read_compiled_settings(filename, settings))
     {
-        LL_WARNS("Settings") << "Cannot find file " << filename << " to load." << LL_ENDL;
-        return 0;
-    }
+        llifstream infile;
+        infile.open(filename.c_str());
+        if(!infile.is_open())
+        {
+            LL_WARNS("Settings") << "Cannot find file " << filename << " to load." << LL_ENDL;
+            return 0;
+        }
 
-    if (LLSDParser::PARSE_FAILURE == LLSDSerialize::fromXML(settings, infile))
-    {
-        infile.close();
-        LL_WARNS("Settings") << "Unable to parse LLSD control file " << filename << ". Trying Legacy Method." << LL_ENDL;
-        return loadFromFileLegacy(filename, true, TYPE_STRING);
+        if (LLSDParser::PARSE_FAILURE == LLSDSerialize::fromXML(settings, infile))
+        {
+            infile.close();
+            LL_WARNS("Settings") << "Unable to parse LLSD control file " << filename << ". Trying Legacy Method." << LL_ENDL;
+            return loadFromFileLegacy(filename, true, TYPE_STRING);
+        }
+
+        // compile what we just parsed so the next start can skip the
+        // XML entirely
+        write_compiled_settings(filename, settings);
     }
 
     U32 validitems = 0;
@@ -875,6 +875,135 @@ bool LLXMLNode::getLayeredXMLNode(LLXMLNodePtr& root,
     return true;
 }
 
+namespace
+{
+    // sanity caps for the binary node format; anything larger is corruption
+    const U32 XML_BINARY_MAX_STRING = 1 << 24;
+    const U32 XML_BINARY_MAX_COUNT = 1 << 16;
+
+    void write_binary_string(std::ostream& out, const std::string& str)
+    {
+        U32 size = (U32)str.size();
+        out.write((const char*)&size, sizeof(U32));
+        out.write(str.data(), size);
+    }
+
+    bool read_binary_string(std::istream& in, std::string& str)
+    {
+        U32 size = 0;
+        in.read((char*)&size, sizeof(U32));
+        if (in.fail() || size > XML_BINARY_MAX_STRING)
+        {
+            return false;
+        }
+        str.resize(size);
+        if (size)
+        {
+            in.read(&str[0], size);
+        }
+        return !in.fail();
+    }
+}
+
+bool LLXMLNode::writeBinaryStream(std::ostream& output_stream) const
+{
+    write_binary_string(output_stream, mName ? std::string(mName->mString) : std::string());
+    write_binary_string(output_stream, mValue);
+    write_binary_string(output_stream, mID);
+
+    U8 flags[3] = { (U8)(mIsAttribute ? 1 : 0), (U8)mType, (U8)mEncoding };
+    output_stream.write((const char*)flags, sizeof(flags));
+
+    U32 decorations[4] = { mVersionMajor, mVersionMinor, mLength, mPrecision };
+    output_stream.write((const char*)decorations, sizeof(decorations));
+
+    U32 attr_count = (U32)mAttributes.size();
+    output_stream.write((const char*)&attr_count, sizeof(U32));
+    for (const LLXMLAttribList::value_type& attr_pair : mAttributes)
+    {
+        attr_pair.second->writeBinaryStream(output_stream);
+    }
+
+    // walk the sibling list rather than the child map to keep document order
+    U32 child_count = 0;
+    for (LLXMLNodePtr child = getFirstChild(); child.notNull(); child = child->getNextSibling())
+    {
+        ++child_count;
+    }
+    output_stream.write((const char*)&child_count, sizeof(U32));
+    for (LLXMLNodePtr child = getFirstChild(); child.notNull(); child = child->getNextSibling())
+    {
+        child->writeBinaryStream(output_stream);
+    }
+
+    return output_stream.good();
+}
+
+// static
+bool LLXMLNode::readBinaryStream(std::istream& input_stream, LLXMLNodePtr& node)
+{
+    std::string name, value, id;
+    if (!read_binary_string(input_stream, name)
+        || !read_binary_string(input_stream, value)
+        || !read_binary_string(input_stream, id))
+    {
+        return false;
+    }
+
+    U8 flags[3];
+    input_stream.read((char*)flags, sizeof(flags));
+    U32 decorations[4];
+    input_stream.read((char*)decorations, sizeof(decorations));
+    if (input_stream.fail())
+    {
+        return false;
+    }
+
+    node = new LLXMLNode(name.c_str(), flags[0] != 0);
+    node->mValue = value;
+    node->mID = id;
+    node->mType = (ValueType)flags[1];
+    node->mEncoding = (Encoding)flags[2];
+    node->mVersionMajor = decorations[0];
+    node->mVersionMinor = decorations[1];
+    node->mLength = decorations[2];
+    node->mPrecision = decorations[3];
+
+    U32 attr_count = 0;
+    input_stream.read((char*)&attr_count, sizeof(U32));
+    if (input_stream.fail() || attr_count > XML_BINARY_MAX_COUNT)
+    {
+        return false;
+    }
+    for (U32 i = 0; i < attr_count; ++i)
+    {
+        LLXMLNodePtr attr;
+        if (!readBinaryStream(input_stream, attr))
+        {
+            return false;
+        }
+        node->addChild(attr);
+    }
+
+    U32 child_count = 0;
+    input_stream.read((char*)&child_count, sizeof(U32));
+    if (input_stream.fail() || child_count > XML_BINARY_MAX_COUNT)
+    {
+        return false;
+    }
+    for (U32 i = 0; i < child_count; ++i)
+    {
+        LLXMLNodePtr child;
+        if (!readBinaryStream(input_stream, child))
+        {
+            return false;
+        }
+        node->addChild(child);
+    }
+
+    return true;
+}
+
 // static
 void LLXMLNode::writeHeaderToFile(LLFILE *out_file)
 {
@@ -151,6 +151,12 @@ public:
     static bool getLayeredXMLNode(LLXMLNodePtr& root, const std::vector<std::string>& paths);
 
 
+    // Compact binary form of a parsed node tree.  Round-trips everything
+    // the XML parser produces (names, values, attributes, type
+    // decorations) except line numbers; used to cache compiled XUI.
+    bool writeBinaryStream(std::ostream& output_stream) const;
+    static bool readBinaryStream(std::istream& input_stream, LLXMLNodePtr& node);
+
     // Write standard XML file header:
     // <?xml version="1.0" encoding="utf-8" standalone="yes" ?>
     static void writeHeaderToFile(LLFILE *out_file);
@@ -24,6 +24,71 @@
 
 in vec4 weight4;
 
+#ifdef DUAL_QUATERNION_SKINNING
+
+// two vec4s per joint: rotation quaternion followed by dual (translation) part
+uniform vec4 dualQuatPalette[MAX_JOINTS_PER_MESH_OBJECT*2];
+
+mat4 getObjectSkinnedTransform()
+{
+    vec4 w = fract(weight4);
+    vec4 index = floor(weight4);
+
+    index = min(index, vec4(MAX_JOINTS_PER_MESH_OBJECT-1));
+    index = max(index, vec4( 0.0));
+
+    w *= 1.0/(w.x+w.y+w.z+w.w);
+
+    int i1 = int(index.x)*2;
+    int i2 = int(index.y)*2;
+    int i3 = int(index.z)*2;
+    int i4 = int(index.w)*2;
+
+    vec4 r1 = dualQuatPalette[i1];
+
+    // blend on the same hemisphere as the dominant influence to avoid
+    // sign flips between antipodal quaternions
+    float s2 = sign(dot(r1, dualQuatPalette[i2]))*w.y;
+    float s3 = sign(dot(r1, dualQuatPalette[i3]))*w.z;
+    float s4 = sign(dot(r1, dualQuatPalette[i4]))*w.w;
+
+    vec4 r = r1*w.x + dualQuatPalette[i2]*s2 + dualQuatPalette[i3]*s3 + dualQuatPalette[i4]*s4;
+    vec4 d = dualQuatPalette[i1+1]*w.x + dualQuatPalette[i2+1]*s2 + dualQuatPalette[i3+1]*s3 + dualQuatPalette[i4+1]*s4;
+
+    float len = length(r);
+    r /= len;
+    d /= len;
+
+    // unit dual quaternion to rigid transform
+    mat3 rot = mat3(
+        1.0-2.0*(r.y*r.y+r.z*r.z), 2.0*(r.x*r.y+r.w*r.z),     2.0*(r.x*r.z-r.w*r.y),
+        2.0*(r.x*r.y-r.w*r.z),     1.0-2.0*(r.x*r.x+r.z*r.z), 2.0*(r.y*r.z+r.w*r.x),
+        2.0*(r.x*r.z+r.w*r.y),     2.0*(r.y*r.z-r.w*r.x),     1.0-2.0*(r.x*r.x+r.y*r.y));
+
+    vec3 trans = 2.0*vec3(
+        -d.w*r.x + d.x*r.w - d.y*r.z + d.z*r.y,
+        -d.w*r.y + d.x*r.z + d.y*r.w - d.z*r.x,
+        -d.w*r.z - d.x*r.y + d.y*r.x + d.z*r.w);
+
+    mat4 ret;
+
+    ret[0] = vec4(rot[0], 0);
+    ret[1] = vec4(rot[1], 0);
+    ret[2] = vec4(rot[2], 0);
+    ret[3] = vec4(trans, 1.0);
+
+    return ret;
+
+#ifdef IS_AMD_CARD
+   // If it's AMD make sure the GLSL compiler sees the arrays referenced once by static index. Otherwise it seems to optimise the storage awawy which leads to unfun crashes and artifacts.
+   vec4 dummy1 = dualQuatPalette[0];
+   vec4 dummy2 = dualQuatPalette[MAX_JOINTS_PER_MESH_OBJECT*2-1];
+#endif
+
+}
+
+#else
+
 uniform mat3x4 matrixPalette[MAX_JOINTS_PER_MESH_OBJECT];
 
 mat4 getObjectSkinnedTransform()
@@ -70,3 +135,5 @@ mat4 getObjectSkinnedTransform()
 
 }
 
+#endif
+
@@ -0,0 +1,61 @@
+/**
+ * @file hizMaxF.glsl
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+/*[EXTRA_CODE_HERE]*/
+
+out vec4 frag_color;
+
+uniform sampler2D depthMap;
+
+// resolution of the coarse buffer being rendered
+uniform vec2 screen_res;
+
+in vec2 vary_fragcoord;
+
+// Each coarse texel takes the FARTHEST (maximum) depth over the full-res
+// footprint it covers, so CPU-side bounding box tests against the result are
+// conservative -- a box can only be reported occluded if every covered
+// footprint is entirely nearer than the box.
+void main()
+{
+    ivec2 depth_res = textureSize(depthMap, 0);
+    ivec2 hiz_res   = ivec2(screen_res);
+    ivec2 scale     = max(depth_res / hiz_res, ivec2(1));
+    ivec2 base      = ivec2(gl_FragCoord.xy) * scale;
+
+    float d = 0.0;
+
+    // +1 on each axis picks up rows/columns lost to integer division
+    for (int y = 0; y <= scale.y; ++y)
+    {
+        for (int x = 0; x <= scale.x; ++x)
+        {
+            ivec2 tc = min(base + ivec2(x, y), depth_res - 1);
+            d = max(d, texelFetch(depthMap, tc, 0).r);
+        }
+    }
+
+    frag_color = vec4(d, 0.0, 0.0, 1.0);
+}
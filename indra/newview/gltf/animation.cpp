@@ -95,6 +95,16 @@ void Animation::apply(Asset& asset, float time)
     // convert time to animation loop time
     time = fmod(time, mMaxTime - mMinTime) + mMinTime;
 
+    {
+        LL_PROFILE_ZONE_NAMED_CATEGORY_GLTF("gltfanim - sample");
+
+        // search each timeline once -- channels sharing a sampler reuse the cached bracket
+        for (auto& sampler : mSamplers)
+        {
+            sampler.sample(asset, time);
+        }
+    }
+
     // apply each channel
     {
         LL_PROFILE_ZONE_NAMED_CATEGORY_GLTF("gltfanim - rotation");
@@ -203,6 +213,14 @@ const Animation::Channel& Animation::Channel::operator=(const Value& src)
     return *this;
 }
 
+void Animation::Sampler::sample(Asset& asset, F32 time)
+{
+    if (mFrameTimes.size() > 1)
+    {
+        getFrameInfo(asset, time, mCachedFrameIndex, mCachedT);
+    }
+}
+
 void Animation::Sampler::getFrameInfo(Asset& asset, F32 time, U32& frameIndex, F32& t)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_GLTF;
@@ -224,24 +242,36 @@ void Animation::Sampler::getFrameInfo(Asset& asset, F32 time, U32& frameIndex, F
     }
 
     if (time < mLastFrameTime)
-    {
+    { // time moved backwards (loop wrap or seek), restart the cursor
         mLastFrameIndex = 0;
     }
 
     mLastFrameTime = time;
 
-    U32 idx = mLastFrameIndex;
+    const F32* times = mFrameTimes.data();
+    U32 count = (U32)mFrameTimes.size();
+    U32 i = mLastFrameIndex;
 
-    for (U32 i = idx; i < (U32)mFrameTimes.size() - 1; i++)
+    // skip four keyframes at a time while all of them precede the sample time
+    LLQuad tv = _mm_set1_ps(time);
+    while (i + 4 < count && _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(times + i), tv)) == 0)
     {
-        if (time >= mFrameTimes[i] && time < mFrameTimes[i + 1])
-        {
-            frameIndex = i;
-            t = (time - mFrameTimes[i]) / (mFrameTimes[i + 1] - mFrameTimes[i]);
-            mLastFrameIndex = frameIndex;
-            return;
-        }
+        i += 4;
+    }
+
+    // scalar search within the remaining bracket
+    while (i < count - 2 && times[i + 1] <= time)
+    {
+        ++i;
     }
+
+    i = llmin(i, count - 2);
+
+    frameIndex = i;
+    mLastFrameIndex = i;
+
+    F32 span = times[i + 1] - times[i];
+    t = span > 0.f ? llclamp((time - times[i]) / span, 0.f, 1.f) : 1.f;
 }
 
 bool Animation::RotationChannel::prep(Asset& asset, Animation::Sampler& sampler)
@@ -255,9 +285,6 @@ bool Animation::RotationChannel::prep(Asset& asset, Animation::Sampler& sampler)
 
 void Animation::RotationChannel::apply(Asset& asset, Sampler& sampler, F32 time)
 {
-    U32 frameIndex;
-    F32 t;
-
     Node& node = asset.mNodes[mTarget.mNode];
 
     if (sampler.mFrameTimes.size() < 2)
@@ -266,7 +293,8 @@ void Animation::RotationChannel::apply(Asset& asset, Sampler& sampler, F32 time)
     }
     else
     {
-        sampler.getFrameInfo(asset, time, frameIndex, t);
+        U32 frameIndex = sampler.mCachedFrameIndex;
+        F32 t = sampler.mCachedT;
 
         // interpolate
         quat qf = glm::slerp(mRotations[frameIndex], mRotations[frameIndex + 1], t);
@@ -288,9 +316,6 @@ bool Animation::TranslationChannel::prep(Asset& asset, Animation::Sampler& sampl
 
 void Animation::TranslationChannel::apply(Asset& asset, Sampler& sampler, F32 time)
 {
-    U32 frameIndex;
-    F32 t;
-
     Node& node = asset.mNodes[mTarget.mNode];
 
     if (sampler.mFrameTimes.size() < 2)
@@ -299,7 +324,8 @@ void Animation::TranslationChannel::apply(Asset& asset, Sampler& sampler, F32 ti
     }
     else
     {
-        sampler.getFrameInfo(asset, time, frameIndex, t);
+        U32 frameIndex = sampler.mCachedFrameIndex;
+        F32 t = sampler.mCachedT;
 
         // interpolate
         const vec3& v0 = mTranslations[frameIndex];
@@ -322,9 +348,6 @@ bool Animation::ScaleChannel::prep(Asset& asset, Animation::Sampler& sampler)
 
 void Animation::ScaleChannel::apply(Asset& asset, Sampler& sampler, F32 time)
 {
-    U32 frameIndex;
-    F32 t;
-
     Node& node = asset.mNodes[mTarget.mNode];
 
     if (sampler.mFrameTimes.size() < 2)
@@ -333,7 +356,8 @@ void Animation::ScaleChannel::apply(Asset& asset, Sampler& sampler, F32 time)
     }
     else
     {
-        sampler.getFrameInfo(asset, time, frameIndex, t);
+        U32 frameIndex = sampler.mCachedFrameIndex;
+        F32 t = sampler.mCachedT;
 
         // interpolate
         const vec3& v0 = mScales[frameIndex];
@@ -52,11 +52,20 @@ namespace LL
                 F32 mLastFrameTime = 0.f;
                 U32 mLastFrameIndex = 0;
 
+                // frame bracket cached by sample() -- every channel driven by
+                // this sampler reads these instead of re-searching the timeline
+                U32 mCachedFrameIndex = 0;
+                F32 mCachedT = 0.f;
+
                 bool prep(Asset& asset);
 
                 void serialize(boost::json::object& dst) const;
                 const Sampler& operator=(const Value& value);
 
+                // cache the frame bracket for the specified time in
+                // mCachedFrameIndex/mCachedT, advancing the playback cursor
+                void sample(Asset& asset, F32 time);
+
                 // get the frame index and time for the specified time
                 // asset -- the asset to reference for Accessors
                 // time -- the animation time to get the frame info for
@@ -105,6 +105,13 @@ void Node::updateTransforms(Asset& asset, const mat4& parentMatrix)
 
     mAssetMatrixInv = glm::inverse(mAssetMatrix);
 
+    if (mMesh != INVALID_INDEX)
+    { // keep asset space bounds current for culling and picking
+        LLMatrix4a am;
+        am.loadu(glm::value_ptr(mAssetMatrix));
+        matMulBoundBox(am, asset.mMeshes[mMesh].mExtents, mAssetExtents);
+    }
+
     S32 my_index = (S32)(this - &asset.mNodes[0]);
 
     for (auto& childIndex : mChildren)
@@ -253,6 +260,20 @@ S32 Asset::lineSegmentIntersect(const LLVector4a& start, const LLVector4a& end,
     {
         if (node.mMesh != INVALID_INDEX)
         {
+            { // coarse reject against the node's asset space bounds before
+              // descending into per-primitive octrees
+                LLVector4a center, size;
+                center.setAdd(node.mAssetExtents[0], node.mAssetExtents[1]);
+                center.mul(0.5f);
+                size.setSub(node.mAssetExtents[1], node.mAssetExtents[0]);
+                size.mul(0.5f);
+
+                if (!LLLineSegmentBoxIntersect(start, asset_end, center, size))
+                {
+                    continue;
+                }
+            }
+
             bool newHit = false;
 
             LLMatrix4a ami;
@@ -483,7 +504,7 @@ void Asset::update()
     }
 }
 
-bool Asset::prep()
+bool Asset::decode()
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_GLTF;
     // check required extensions and fail if not supported
@@ -511,14 +532,6 @@ bool Asset::prep()
         }
     }
 
-    for (auto& image : mImages)
-    {
-        if (!image.prep(*this))
-        {
-            return false;
-        }
-    }
-
     for (auto& mesh : mMeshes)
     {
         if (!mesh.prep(*this))
@@ -543,6 +556,26 @@ bool Asset::prep()
         }
     }
 
+    mDecoded = true;
+    return true;
+}
+
+bool Asset::prep()
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_GLTF;
+    if (!mDecoded && !decode())
+    {
+        return false;
+    }
+
+    for (auto& image : mImages)
+    {
+        if (!image.prep(*this))
+        {
+            return false;
+        }
+    }
+
     // prepare vertex buffers
 
     // material count is number of materials + 1 for default material
@@ -688,7 +721,7 @@ bool Asset::load(std::string_view filename)
         {
             Value val = parse(str);
             *this = val;
-            return prep();
+            return decode();
         }
         else if (ext == "glb")
         {
@@ -807,7 +840,7 @@ bool Asset::loadBinary(const std::string& data)
         }
     }
 
-    return prep();
+    return decode();
 }
 
 const Asset& Asset::operator=(const Value& src)
@@ -1353,6 +1386,23 @@ bool Mesh::prep(Asset& asset)
         }
     }
 
+    // union of primitive bounds, used for node level culling and picking
+    if (!mPrimitives.empty())
+    {
+        mExtents[0] = mPrimitives[0].mExtents[0];
+        mExtents[1] = mPrimitives[0].mExtents[1];
+        for (auto& primitive : mPrimitives)
+        {
+            mExtents[0].setMin(mExtents[0], primitive.mExtents[0]);
+            mExtents[1].setMax(mExtents[1], primitive.mExtents[1]);
+        }
+    }
+    else
+    {
+        mExtents[0].splat(0.f);
+        mExtents[1].splat(0.f);
+    }
+
     return true;
 }
 
@@ -171,6 +171,9 @@ namespace LL
             std::vector<double> mWeights;
             std::string mName;
 
+            // local space bounding box (min, max) over all primitives, set by prep()
+            LLVector4a mExtents[2];
+
             const Mesh& operator=(const Value& src);
             void serialize(boost::json::object& dst) const;
 
@@ -184,6 +187,12 @@ namespace LL
             mat4 mAssetMatrix; //transform from local to asset space
             mat4 mAssetMatrixInv; //transform from asset to local space
 
+            // asset space bounding box (min, max) of this node's mesh, updated by updateTransforms()
+            LLVector4a mAssetExtents[2];
+
+            // if true, this node's mesh was outside the camera frustum on the last update
+            bool mCulled = false;
+
             vec3  mTranslation = vec3(0,0,0);
             quat mRotation = glm::identity<quat>();
             vec3 mScale = vec3(1.f,1.f,1.f);
@@ -375,6 +384,9 @@ namespace LL
 
             U32 mPendingBuffers = 0;
 
+            // true if decode() has successfully run on this asset
+            bool mDecoded = false;
+
             // local file this asset was loaded from (if any)
             std::string mFilename;
 
@@ -392,7 +404,13 @@ namespace LL
             // UBO for storing material data
             U32 mMaterialsUBO = 0;
 
+            // decode buffers, meshes, animations, and skins into their runtime representations
+            // does not touch GL, safe to call from a worker thread
+            bool decode();
+
             // prepare for first time use
+            // calls decode() if it hasn't run yet, then creates GL resources
+            // must be called from the main thread
             bool prep();
 
             // Called periodically (typically once per frame)
@@ -427,12 +445,14 @@ namespace LL
             // load from given file
             // accepts .gltf and .glb files
             // Any existing data will be lost
-            // returns result of prep() on success
+            // returns result of decode() on success -- call prep() from the
+            // main thread before rendering
             bool load(std::string_view filename);
 
             // load .glb contents from memory
             // data - binary contents of .glb file
-            // returns result of prep() on success
+            // returns result of decode() on success -- call prep() from the
+            // main thread before rendering
             bool loadBinary(const std::string& data);
 
             const Asset& operator=(const Value& src);
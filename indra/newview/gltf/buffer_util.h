@@ -321,6 +321,174 @@ namespace LL
             }
         }
 
+        //=========================================================================================================
+        // bulk copy fast paths for the common accessor layouts
+        // accessors are usually tightly packed, in which case layout compatible types can be copied
+        // with a single memcpy and the rest with vector conversions
+        // fall through to the generic per-element loops for interleaved sources
+        //=========================================================================================================
+
+        // U32 index arrays
+        template<>
+        inline void copyScalar<U32, U32>(U32* src, LLStrider<U32> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(U32) && dst.getSkip() == sizeof(U32))
+            {
+                memcpy(dst.get(), src, count * sizeof(U32));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyScalar(src, *dst);
+                dst++;
+                src = (U32*)((U8*)src + stride);
+            }
+        }
+
+        // texture coordinates
+        template<>
+        inline void copyVec2<F32, LLVector2>(F32* src, LLStrider<LLVector2> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(F32) * 2 && dst.getSkip() == sizeof(LLVector2))
+            {
+                memcpy(dst.get(), src, count * sizeof(LLVector2));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec2(src, *dst);
+                dst++;
+                src = (F32*)((U8*)src + stride);
+            }
+        }
+
+        // positions and normals
+        template<>
+        inline void copyVec3<F32, LLVector4a>(F32* src, LLStrider<LLVector4a> dst, S32 stride, S32 count)
+        {
+            if (count > 0 && stride == sizeof(F32) * 3 && dst.getSkip() == sizeof(LLVector4a))
+            {
+                LLVector4a* dstp = dst.get();
+                const LLQuad w_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+                for (S32 i = 0; i < count - 1; ++i)
+                { // each load reads one float past its vec3, which is safe for all but the last element
+                    dstp[i] = LLVector4a(_mm_and_ps(_mm_loadu_ps(src + i * 3), w_mask));
+                }
+                dstp[count - 1].load3(src + (count - 1) * 3);
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec3(src, *dst);
+                dst++;
+                src = (F32*)((U8*)src + stride);
+            }
+        }
+
+        // tangents and float weights
+        template<>
+        inline void copyVec4<F32, LLVector4a>(F32* src, LLStrider<LLVector4a> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(F32) * 4 && dst.getSkip() == sizeof(LLVector4a))
+            {
+                memcpy(dst.get(), src, count * sizeof(LLVector4a));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec4(src, *dst);
+                dst++;
+                src = (F32*)((U8*)src + stride);
+            }
+        }
+
+        // byte colors
+        template<>
+        inline void copyVec4<U8, LLColor4U>(U8* src, LLStrider<LLColor4U> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(U8) * 4 && dst.getSkip() == sizeof(LLColor4U))
+            {
+                memcpy(dst.get(), src, count * sizeof(LLColor4U));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec4(src, *dst);
+                dst++;
+                src = (U8*)((U8*)src + stride);
+            }
+        }
+
+        // normalized float colors, converted four components at a time
+        template<>
+        inline void copyVec4<F32, LLColor4U>(F32* src, LLStrider<LLColor4U> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(F32) * 4)
+            {
+                const LLQuad scale = _mm_set1_ps(255.f);
+                for (S32 i = 0; i < count; ++i)
+                {
+                    __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_loadu_ps(src), scale));
+                    c = _mm_packs_epi32(c, c);
+                    c = _mm_packus_epi16(c, c);
+                    *(U32*)(dst->mV) = (U32)_mm_cvtsi128_si32(c);
+                    dst++;
+                    src += 4;
+                }
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec4(src, *dst);
+                dst++;
+                src = (F32*)((U8*)src + stride);
+            }
+        }
+
+        // U16 joint indices
+        template<>
+        inline void copyVec4<U16, U64>(U16* src, LLStrider<U64> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(U16) * 4 && dst.getSkip() == sizeof(U64))
+            {
+                memcpy(dst.get(), src, count * sizeof(U64));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyVec4(src, *dst);
+                dst++;
+                src = (U16*)((U8*)src + stride);
+            }
+        }
+
+        // inverse bind matrices
+        template<>
+        inline void copyMat4<F32, mat4>(F32* src, LLStrider<mat4> dst, S32 stride, S32 count)
+        {
+            if (stride == sizeof(F32) * 16 && dst.getSkip() == sizeof(mat4))
+            {
+                memcpy(dst.get(), src, count * sizeof(mat4));
+                return;
+            }
+
+            for (S32 i = 0; i < count; ++i)
+            {
+                copyMat4(src, *dst);
+                dst++;
+                src = (F32*)((U8*)src + stride);
+            }
+        }
+
+        //=========================================================================================================
+
         template<class S, class T>
         inline void copy(Asset& asset, Accessor& accessor, const S* src, LLStrider<T>& dst, S32 byteStride)
         {
@@ -723,6 +723,22 @@ void Primitive::createOctree()
     //calculate AABB for each node
     LLVolumeOctreeRebound rebound;
     rebound.traverse(mOctree);
+
+    // compute local bounds from the position array
+    // (also covers non-triangle modes that insert nothing into the octree)
+    if (!mPositions.empty())
+    {
+        mExtents[0] = mExtents[1] = mPositions[0];
+        for (U32 i = 1; i < mPositions.size(); ++i)
+        {
+            update_min_max(mExtents[0], mExtents[1], mPositions[i]);
+        }
+    }
+    else
+    {
+        mExtents[0].splat(0.f);
+        mExtents[1].splat(0.f);
+    }
 }
 
 const LLVolumeTriangle* Primitive::lineSegmentIntersect(const LLVector4a& start, const LLVector4a& end,
@@ -69,6 +69,9 @@ namespace LL
             LLPointer<LLVolumeOctree> mOctree;
             std::vector<LLVolumeTriangle> mOctreeTriangles;
 
+            // local space bounding box (min, max), set by createOctree()
+            LLVector4a mExtents[2];
+
             S32 mMaterial = -1;
             Mode mMode = Mode::TRIANGLES; // default to triangles
             LLRender::eGeomModes mGLMode = LLRender::TRIANGLES; // for use with LLRender
@@ -34,6 +34,7 @@
 #include "llselectmgr.h"
 #include "llagent.h"
 #include "llnotificationsutil.h"
+#include "llviewercamera.h"
 #include "llvoavatarself.h"
 #include "llvolumeoctree.h"
 #include "gltf/asset.h"
@@ -46,6 +47,7 @@
 #include "llagentbenefits.h"
 #include "llfilesystem.h"
 #include "llviewercontrol.h"
+#include "workqueue.h"
 #include "boost/json.hpp"
 
 #define GLTF_SIM_SUPPORT 1
@@ -308,31 +310,46 @@ void GLTFSceneManager::save(const std::string& filename)
 
 void GLTFSceneManager::load(const std::string& filename)
 {
+    LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+    LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+
     std::shared_ptr<Asset> asset = std::make_shared<Asset>();
 
-    if (asset->load(filename))
-    {
-        gDebugProgram.bind(); // bind a shader to satisfy LLVertexBuffer assertions
-        asset->updateTransforms();
+    main_queue->postTo(
+        general_queue,
+        [asset, filename]() // Work done on general queue
+        {
+            // parse and decode happen on a worker thread, only GL resource
+            // creation in prep() needs the main thread
+            return asset->load(filename);
+        },
+        [asset](bool loaded) // Callback to main thread
+        {
+            if (loaded && asset->prep())
+            {
+                gDebugProgram.bind(); // bind a shader to satisfy LLVertexBuffer assertions
+                asset->updateTransforms();
 
-        // hang the asset off the currently selected object, or off of the avatar if no object is selected
-        LLViewerObject* obj = LLSelectMgr::instance().getSelection()->getFirstRootObject();
+                // hang the asset off the currently selected object, or off of the avatar if no object is selected
+                LLViewerObject* obj = LLSelectMgr::instance().getSelection()->getFirstRootObject();
 
-        if (obj)
-        { // assign to self avatar
-            obj->mGLTFAsset = asset;
-            obj->markForUpdate();
-            if (std::find(mObjects.begin(), mObjects.end(), obj) == mObjects.end())
+                if (obj)
+                { // assign to self avatar
+                    obj->mGLTFAsset = asset;
+                    obj->markForUpdate();
+                    GLTFSceneManager& mgr = GLTFSceneManager::instance();
+                    if (std::find(mgr.mObjects.begin(), mgr.mObjects.end(), obj) == mgr.mObjects.end())
+                    {
+                        mgr.mObjects.push_back(obj);
+                    }
+                    LLFloaterReg::showInstance("gltf_asset_editor");
+                }
+            }
+            else
             {
-                mObjects.push_back(obj);
+                LLNotificationsUtil::add("GLTFLoadFailed");
             }
-            LLFloaterReg::showInstance("gltf_asset_editor");
-        }
-    }
-    else
-    {
-        LLNotificationsUtil::add("GLTFLoadFailed");
-    }
+        });
 }
 
 GLTFSceneManager::~GLTFSceneManager()
@@ -388,19 +405,34 @@ void GLTFSceneManager::onGLTFBinLoadComplete(const LLUUID& id, LLAssetType::ETyp
 
                         if (obj->mGLTFAsset->mPendingBuffers == 0)
                         {
-                            if (obj->mGLTFAsset->prep())
-                            {
-                                GLTFSceneManager& mgr = GLTFSceneManager::instance();
-                                if (std::find(mgr.mObjects.begin(), mgr.mObjects.end(), obj) == mgr.mObjects.end())
+                            LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+                            LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+
+                            std::shared_ptr<Asset> asset = obj->mGLTFAsset;
+
+                            main_queue->postTo(
+                                general_queue,
+                                [asset]() // Work done on general queue
                                 {
-                                    GLTFSceneManager::instance().mObjects.push_back(obj);
-                                }
-                            }
-                            else
-                            {
-                                LL_WARNS("GLTF") << "Failed to prepare GLTF asset: " << id << LL_ENDL;
-                                obj->mGLTFAsset = nullptr;
-                            }
+                                    // decode buffers and meshes on a worker thread
+                                    return asset->decode();
+                                },
+                                [id, obj, asset](bool decoded) // Callback to main thread
+                                {
+                                    if (decoded && obj->mGLTFAsset == asset && asset->prep())
+                                    {
+                                        GLTFSceneManager& mgr = GLTFSceneManager::instance();
+                                        if (std::find(mgr.mObjects.begin(), mgr.mObjects.end(), obj) == mgr.mObjects.end())
+                                        {
+                                            GLTFSceneManager::instance().mObjects.push_back(obj);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        LL_WARNS("GLTF") << "Failed to prepare GLTF asset: " << id << LL_ENDL;
+                                        obj->mGLTFAsset = nullptr;
+                                    }
+                                });
                         }
                     }
                 }
@@ -423,34 +455,58 @@ void GLTFSceneManager::onGLTFLoadComplete(const LLUUID& id, LLAssetType::EType a
     {
         if (obj)
         {
-            LLFileSystem file(id, asset_type, LLFileSystem::READ);
-            std::string data;
-            S32 file_size = file.getSize();
-            data.resize(file_size);
-            file.read((U8*)data.data(), file_size);
+            LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+            LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
 
-            boost::json::value json = boost::json::parse(data);
-
-            std::shared_ptr<Asset> asset = std::make_shared<Asset>(json);
-            obj->mGLTFAsset = asset;
-
-            for (auto& buffer : asset->mBuffers)
-            {
-                // for now just assume the buffer is already in the asset cache
-                LLUUID buffer_id;
-                if (LLUUID::parseUUID(buffer.mUri, &buffer_id))
+            main_queue->postTo(
+                general_queue,
+                [id, asset_type]() // Work done on general queue
                 {
-                    asset->mPendingBuffers++;
+                    LLFileSystem file(id, asset_type, LLFileSystem::READ);
+                    std::string data;
+                    S32 file_size = file.getSize();
+                    data.resize(file_size);
+                    file.read((U8*)data.data(), file_size);
+
+                    boost::system::error_code ec;
+                    boost::json::value json = boost::json::parse(data, ec);
+                    if (ec)
+                    {
+                        LL_WARNS("GLTF") << "Failed to parse GLTF asset: " << ec.message() << LL_ENDL;
+                        return std::shared_ptr<Asset>();
+                    }
 
-                    gAssetStorage->getAssetData(buffer_id, LLAssetType::AT_GLTF_BIN, onGLTFBinLoadComplete, obj);
-                }
-                else
+                    return std::make_shared<Asset>(json);
+                },
+                [id, obj](std::shared_ptr<Asset> asset) // Callback to main thread
                 {
-                    LL_WARNS("GLTF") << "Buffer URI is not a valid UUID: " << buffer.mUri << LL_ENDL;
-                    obj->unref();
-                    return;
-                }
-            }
+                    if (!asset)
+                    {
+                        LL_WARNS("GLTF") << "Failed to load GLTF asset: " << id << LL_ENDL;
+                        obj->unref();
+                        return;
+                    }
+
+                    obj->mGLTFAsset = asset;
+
+                    for (auto& buffer : asset->mBuffers)
+                    {
+                        // for now just assume the buffer is already in the asset cache
+                        LLUUID buffer_id;
+                        if (LLUUID::parseUUID(buffer.mUri, &buffer_id))
+                        {
+                            asset->mPendingBuffers++;
+
+                            gAssetStorage->getAssetData(buffer_id, LLAssetType::AT_GLTF_BIN, onGLTFBinLoadComplete, obj);
+                        }
+                        else
+                        {
+                            LL_WARNS("GLTF") << "Buffer URI is not a valid UUID: " << buffer.mUri << LL_ENDL;
+                            obj->unref();
+                            return;
+                        }
+                    }
+                });
         }
     }
     else
@@ -474,6 +530,7 @@ void GLTFSceneManager::update()
         }
 
         mObjects[i]->mGLTFAsset->update();
+        updateCulling(mObjects[i]);
     }
 
     // process pending uploads
@@ -558,6 +615,37 @@ void GLTFSceneManager::update()
     }
 }
 
+void GLTFSceneManager::updateCulling(LLViewerObject* obj)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_GLTF;
+    Asset& asset = *obj->mGLTFAsset;
+    LLMatrix4a mat = obj->getGLTFAssetToAgentTransform();
+    LLViewerCamera& camera = *LLViewerCamera::getInstance();
+
+    for (auto& node : asset.mNodes)
+    {
+        if (node.mMesh != INVALID_INDEX)
+        {
+            if (node.mSkin != INVALID_INDEX)
+            { // rigged meshes don't stay inside their node's bounds, never cull them
+                node.mCulled = false;
+                continue;
+            }
+
+            LLVector4a extents[2];
+            matMulBoundBox(mat, node.mAssetExtents, extents);
+
+            LLVector4a center, size;
+            center.setAdd(extents[0], extents[1]);
+            center.mul(0.5f);
+            size.setSub(extents[1], extents[0]);
+            size.mul(0.5f);
+
+            node.mCulled = camera.AABBInFrustum(center, size) == 0;
+        }
+    }
+}
+
 void GLTFSceneManager::render(bool opaque, bool rigged, bool unlit)
 {
     U8 variant = 0;
@@ -701,6 +789,12 @@ void GLTFSceneManager::render(Asset& asset, U8 variant)
             {
                 LL_PROFILE_ZONE_NAMED_CATEGORY_GLTF("GLTF draw call");
                 Node& node = asset.mNodes[pdata.mNodeIndex];
+
+                if (node.mCulled && !LLPipeline::sShadowRender)
+                { // node is outside the camera frustum (shadow passes render everything)
+                    continue;
+                }
+
                 Mesh& mesh = asset.mMeshes[node.mMesh];
                 Primitive& primitive = mesh.mPrimitives[pdata.mPrimitiveIndex];
 
@@ -49,6 +49,10 @@ namespace LL
         void uploadSelection(); // decompose selected asset and upload to simulator
 
         void update();
+
+        // update per-node frustum culling state for the given object's asset
+        void updateCulling(LLViewerObject* obj);
+
         void render(bool opaque, bool rigged = false, bool unlit = false);
 
         // render the given variant of all assets
@@ -33,6 +33,7 @@
 #include "llagentpilot.h"
 #include "llagent.h"
 #include "llappviewer.h"
+#include "lldir.h"
 #include "llviewercontrol.h"
 #include "llviewercamera.h"
 #include "llsdserialize.h"
@@ -50,7 +51,9 @@ LLAgentPilot::LLAgentPilot() :
     mCurrentAction(0),
     mOverrideCamera(false),
     mLoop(true),
-    mReplaySession(false)
+    mReplaySession(false),
+    mLastFrameTimestamp(-1.f),
+    mBenchmarkRun(0)
 {
 }
 
@@ -255,6 +258,8 @@ void LLAgentPilot::startPlayback()
         mPlaying = true;
         mCurrentAction = 0;
         mTimer.reset();
+        mFrameTimes.clear();
+        mLastFrameTimestamp = -1.f;
 
         if (mActions.size())
         {
@@ -275,6 +280,7 @@ void LLAgentPilot::stopPlayback()
 {
     if (mPlaying)
     {
+        writeBenchmark();
         mPlaying = false;
         mCurrentAction = 0;
         mTimer.reset();
@@ -287,6 +293,53 @@ void LLAgentPilot::stopPlayback()
     }
 }
 
+void LLAgentPilot::writeBenchmark()
+{
+    static LLCachedControl<F32> frame_budget(gSavedSettings, "AgentPilotFrameBudget", 0.f);
+    F32 budget_ms = frame_budget;
+    if (budget_ms <= 0.f || mFrameTimes.empty())
+    {
+        return;
+    }
+
+    mBenchmarkRun++;
+
+    std::string filename = gDirUtilp->getExpandedFilename(LL_PATH_LOGS,
+        llformat("agent_pilot_run_%d.csv", mBenchmarkRun));
+    llofstream file(filename.c_str());
+    if (!file.is_open())
+    {
+        LL_WARNS() << "Unable to write benchmark CSV to " << filename << LL_ENDL;
+        return;
+    }
+
+    file << "frame,ms" << std::endl;
+    F32 total = 0.f;
+    std::vector<F32> sorted = mFrameTimes;
+    for (S32 i = 0; i < (S32)mFrameTimes.size(); ++i)
+    {
+        F32 ms = mFrameTimes[i] * 1000.f;
+        file << i << "," << ms << std::endl;
+        total += ms;
+    }
+    file.close();
+
+    std::sort(sorted.begin(), sorted.end());
+    F32 mean_ms = total / mFrameTimes.size();
+    F32 p95_ms = sorted[(sorted.size() * 95) / 100] * 1000.f;
+    F32 max_ms = sorted.back() * 1000.f;
+
+    // pass when 95% of frames fit the budget; worst-case frames are spikes
+    // the budget isn't meant to police
+    bool pass = p95_ms <= budget_ms;
+    LL_INFOS() << "Agent pilot run " << mBenchmarkRun << ": "
+        << mFrameTimes.size() << " frames, mean " << mean_ms
+        << " ms, p95 " << p95_ms << " ms, max " << max_ms
+        << " ms, budget " << budget_ms << " ms -- "
+        << (pass ? "PASS" : "FAIL")
+        << " (" << filename << ")" << LL_ENDL;
+}
+
 void LLAgentPilot::moveCamera()
 {
     if (!getOverrideCamera())
@@ -332,6 +385,18 @@ void LLAgentPilot::updateTarget()
 {
     if (mPlaying)
     {
+        static LLCachedControl<F32> frame_budget(gSavedSettings, "AgentPilotFrameBudget", 0.f);
+        if ((F32)frame_budget > 0.f && mStarted)
+        { // updateTarget runs once per frame, so successive timer samples
+          // are frame times
+            F32 now = mTimer.getElapsedTimeF32();
+            if (mLastFrameTimestamp >= 0.f)
+            {
+                mFrameTimes.push_back(now - mLastFrameTimestamp);
+            }
+            mLastFrameTimestamp = now;
+        }
+
         if (mCurrentAction < mActions.size())
         {
             if (0 == mCurrentAction)
@@ -115,6 +115,13 @@ private:
     std::vector<Action> mActions;
     LLTimer                 mTimer;
 
+    // per-frame benchmark capture during playback, enabled by a nonzero
+    // AgentPilotFrameBudget; dumped as CSV with a pass/fail summary when
+    // each run completes
+    void writeBenchmark();
+    std::vector<F32> mFrameTimes;
+    F32     mLastFrameTimestamp;
+    S32     mBenchmarkRun;
 };
 
 extern LLAgentPilot gAgentPilot;
@@ -131,7 +131,8 @@ LLAppCoreHttp::LLAppCoreHttp()
       mStopHandle(LLCORE_HTTP_HANDLE_INVALID),
       mStopRequested(0.0),
       mStopped(false),
-      mPipelined(true)
+      mPipelined(true),
+      mMultiplexed(false)
 {}
 
 
@@ -281,6 +282,15 @@ void LLAppCoreHttp::init()
         LL_INFOS("Init") << "HTTP Pipelining " << (mPipelined ? "enabled" : "disabled") << "!" << LL_ENDL;
     }
 
+    // Global HTTP/2 multiplexing setting
+    static const std::string http_multiplexing("HttpMultiplexing");
+    if (gSavedSettings.controlExists(http_multiplexing))
+    {
+        // Default to false (in ctor) if absent.
+        mMultiplexed = gSavedSettings.getBOOL(http_multiplexing);
+        LL_INFOS("Init") << "HTTP/2 Multiplexing " << (mMultiplexed ? "enabled" : "disabled") << "!" << LL_ENDL;
+    }
+
     // Register signals for settings and state changes
     for (int i(0); i < LL_ARRAY_SIZE(init_data); ++i)
     {
@@ -449,6 +459,33 @@ void LLAppCoreHttp::refreshSettings(bool initial)
                     mHttpClasses[app_policy].mPipelined = to_pipeline;
                 }
             }
+
+            // HTTP/2 multiplexing election.  Same candidate classes as
+            // pipelining - the CDN-facing texture and mesh fetches.
+            // When enabled, it takes precedence over pipelining in
+            // llcorehttp.
+            const bool to_multiplex(mMultiplexed && init_data[i].mPipelined);
+            if (to_multiplex)
+            {
+                LLCore::HttpHandle handle;
+                handle = mRequest->setPolicyOption(LLCore::HttpRequest::PO_HTTP2_MULTIPLEX,
+                                                   mHttpClasses[app_policy].mPolicy,
+                                                   1L,
+                                                   LLCore::HttpHandler::ptr_t());
+                if (LLCORE_HTTP_HANDLE_INVALID == handle)
+                {
+                    status = mRequest->getStatus();
+                    LL_WARNS("Init") << "Unable to set " << init_data[i].mUsage
+                                     << " multiplexing.  Reason:  " << status.toString()
+                                     << LL_ENDL;
+                }
+                else
+                {
+                    LL_DEBUGS("Init") << "Enabled " << init_data[i].mUsage
+                                      << " HTTP/2 multiplexing."
+                                      << LL_ENDL;
+                }
+            }
         }
 
         // Get target connection concurrency value
@@ -255,6 +255,7 @@ private:
     bool                        mStopped;
     HttpClass                   mHttpClasses[AP_COUNT];
     bool                        mPipelined;             // Global setting
+    bool                        mMultiplexed;           // Global setting
     boost::signals2::connection mPipelinedSignal;       // Signal for 'HttpPipelining' setting
     boost::signals2::connection mSSLNoVerifySignal;     // Signal for 'NoVerifySSLCert' setting
 
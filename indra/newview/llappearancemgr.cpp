@@ -862,7 +862,11 @@ void LLWearableHoldingPattern::checkMissingWearables()
     }
     if (!pollMissingWearables())
     {
-        doOnIdleRepeating(boost::bind(&LLWearableHoldingPattern::pollMissingWearables,this));
+        // polling against an asset-fetch timeout measured in tens of seconds:
+        // a 1/4s cadence is plenty, no need to re-check every single frame
+        doPeriodically("pollMissingWearables",
+                       boost::bind(&LLWearableHoldingPattern::pollMissingWearables,this),
+                       0.25f, LL::Timers::Priority::LOW);
     }
 }
 
@@ -2685,7 +2689,10 @@ void LLAppearanceMgr::updateAppearanceFromCOF(bool enforce_item_restrictions,
     holder->resetTime(gSavedSettings.getF32("MaxWearableWaitTime"));
     if (!holder->pollFetchCompletion())
     {
-        doOnIdleRepeating(boost::bind(&LLWearableHoldingPattern::pollFetchCompletion,holder));
+        // same cadence rationale as the pollMissingWearables() registration
+        doPeriodically("pollFetchCompletion",
+                       boost::bind(&LLWearableHoldingPattern::pollFetchCompletion,holder),
+                       0.25f, LL::Timers::Priority::LOW);
     }
     post_update_func();
 
@@ -88,6 +88,7 @@
 #include "llurldispatcher.h"
 #include "llurlhistory.h"
 #include "llrender.h"
+#include "llfontgl.h"
 #include "llteleporthistory.h"
 #include "lltoast.h"
 #include "llsdutil_math.h"
@@ -103,6 +104,7 @@
 #include "llprogressview.h"
 #include "llvocache.h"
 #include "lldiskcache.h"
+#include "llfilesystem.h"
 #include "llvopartgroup.h"
 #include "llweb.h"
 #include "llspellcheck.h"
@@ -538,6 +540,7 @@ static void settings_to_globals()
     LLRender::sNsightDebugSupport = gSavedSettings.getBOOL("RenderNsightDebugSupport");
     LLImageGL::sGlobalUseAnisotropic    = gSavedSettings.getBOOL("RenderAnisotropic");
     LLImageGL::sCompressTextures        = gSavedSettings.getBOOL("RenderCompressTextures");
+    LLImageGL::sCompressTexturesCPU     = gSavedSettings.getBOOL("RenderCompressTexturesCPU");
     LLVOVolume::sLODFactor              = llclamp(gSavedSettings.getF32("RenderVolumeLODFactor"), 0.01f, MAX_LOD_FACTOR);
     LLVOVolume::sDistanceFactor         = 1.f-LLVOVolume::sLODFactor * 0.1f;
     LLVolumeImplFlexible::sUpdateFactor = gSavedSettings.getF32("RenderFlexTimeFactor");
@@ -777,6 +780,13 @@ bool LLAppViewer::init()
         LLError::setFatalFunction([rc](const std::string&){ _exit(rc); });
     }
 
+    if (gSavedSettings.getBOOL("AsyncLogFile"))
+    {
+        // hand file log writes to a background writer thread instead of
+        // blocking logging threads on disk I/O
+        LLError::setAsyncFileRecording(true);
+    }
+
     // Initialize the non-LLCurl libcurl library.  Should be called
     // before consumers (LLTextureFetch).
     mAppCoreHttp.init();
@@ -1378,6 +1388,69 @@ void LLAppViewer::initMaxHeapSize()
 // externally visible timers
 LLTrace::BlockTimerStatHandle FTM_FRAME("Frame");
 
+// Frame pacing for capped-FPS rendering (MaxFPS setting, 0 disables).
+// ms_sleep granularity overshoots by several milliseconds on some platforms,
+// which reads as judder when users cap the frame rate for thermals, so sleep
+// most of the interval and spin out the sub-millisecond remainder against an
+// absolute schedule; that also keeps frame starts evenly spaced, which the
+// animation samplers see as stable deltas.
+static void pace_frame()
+{
+    static LLCachedControl<F32> max_fps(gSavedSettings, "MaxFPS", 0.f);
+    static F64 next_frame_time = 0.0;
+
+    F32 fps = llclamp((F32)max_fps, 0.f, 240.f);
+    if (fps < 1.f)
+    {
+        next_frame_time = 0.0;
+        return;
+    }
+
+    // when vsync already paces us at or below the cap, don't fight it
+    static LLCachedControl<bool> vsync(gSavedSettings, "RenderVSyncEnable", true);
+    if (vsync && gViewerWindow)
+    {
+        S32 refresh = gViewerWindow->getWindow()->getRefreshRate();
+        if (refresh > 0 && (F32)refresh <= fps)
+        {
+            next_frame_time = 0.0;
+            return;
+        }
+    }
+
+    LL_PROFILE_ZONE_NAMED_CATEGORY_APP("Frame pacing");
+    LLPerfStats::RecordSceneTime T(LLPerfStats::StatType_t::RENDER_SLEEP);
+
+    const F64 interval = 1.0 / (F64)fps;
+    F64 now = LLTimer::getTotalSeconds();
+    if (next_frame_time <= now)
+    {
+        // just started limiting, or the frame overran its slot -- restart
+        // the schedule rather than rushing frames to catch up
+        next_frame_time = now + interval;
+        return;
+    }
+
+    // sleep to within a couple scheduler quanta of the target, then spin
+    // the remainder on the high-resolution clock
+    const F64 SPIN_THRESHOLD = 0.002;
+    while ((next_frame_time - now) > SPIN_THRESHOLD)
+    {
+        U32 ms = (U32)((next_frame_time - now - SPIN_THRESHOLD) * 1000.0);
+        if (ms == 0)
+        {
+            break;
+        }
+        ms_sleep(ms);
+        now = LLTimer::getTotalSeconds();
+    }
+    while (now < next_frame_time)
+    {
+        now = LLTimer::getTotalSeconds();
+    }
+    next_frame_time += interval;
+}
+
 bool LLAppViewer::frame()
 {
     bool ret = false;
@@ -1691,6 +1764,10 @@ bool LLAppViewer::doFrame()
                 LLLFSThread::sLocal->pause();
             }
 
+            // hold the frame start to the MaxFPS schedule, last so the
+            // background threads above get their update first
+            pace_frame();
+
             {
                 LL_PROFILE_ZONE_NAMED_CATEGORY_APP("df resumeMainloopTimeout");
                 resumeMainloopTimeout();
@@ -1816,6 +1893,17 @@ bool LLAppViewer::cleanup()
 
     LL_INFOS() << "Viewer disconnected" << LL_ENDL;
 
+    // disconnectViewer() above already saved the inventory cache, name cache
+    // and agent settings, so an opted-in fast shutdown only needs to flush
+    // the remaining critical files before getting out of here.
+    if (gSavedSettings.getBOOL("FastShutdown")
+        && !isError()
+        && !mPurgeCacheOnExit
+        && !mPurgeUserDataOnExit)
+    {
+        fastCleanup(); // does not return
+    }
+
     if (gKeyboard)
     {
         gKeyboard->resetKeys();
@@ -2244,6 +2332,103 @@ bool LLAppViewer::cleanup()
     return true;
 }
 
+void LLAppViewer::fastCleanup()
+{
+    LL_INFOS() << "Fast shutdown: flushing critical state" << LL_ENDL;
+
+    // bound the whole flush so a wedged disk or worker thread can't turn
+    // the fast path into the very hang it exists to avoid
+    LLTimer deadline_timer;
+    const F64 FAST_SHUTDOWN_DEADLINE = 10.0; // seconds
+
+    // suck rectangle information out of the still-live window
+    cleanupSavedSettings();
+
+    // Store the time of our current logoff
+    gSavedPerAccountSettings.setU32("LastLogoff", (U32)time_corrected());
+
+    if (LLEnvironment::instanceExists())
+    {
+        LLEnvironment::getInstance()->saveToSettings();
+    }
+
+    // floaters that only store their rects on delete keep last session's
+    // values here; ones that store on move/resize are already current
+    gSavedSettings.saveToFile(gSavedSettings.getString("ClientSettingsFile"), true);
+
+    LLUIColorTable::instance().saveUserSettings();
+
+    if (gSavedSettings.getString("PerAccountSettingsFile").empty())
+    {
+        LL_INFOS() << "Not saving per-account settings; don't know the account name yet." << LL_ENDL;
+    }
+    else if (!mSavePerAccountSettings)
+    {
+        LL_INFOS() << "Not saving per-account settings; last login was not successful." << LL_ENDL;
+    }
+    else
+    {
+        gSavedPerAccountSettings.saveToFile(gSavedSettings.getString("PerAccountSettingsFile"), true);
+
+        if (LLViewerParcelAskPlay::instanceExists())
+        {
+            LLViewerParcelAskPlay::getInstance()->saveSettings();
+        }
+    }
+
+    std::string warnings_settings_filename = gDirUtilp->getExpandedFilename(LL_PATH_USER_SETTINGS, getSettingsFilename("Default", "Warnings"));
+    gWarningSettings.saveToFile(warnings_settings_filename, true);
+
+    LLURLHistory::saveFile("url_history.xml");
+
+    if (gAgent.isInitialized() && LLMuteList::instanceExists())
+    {
+        LLMuteList::getInstance()->cache(gAgent.getID());
+    }
+
+    if (LLConversationLog::instanceExists())
+    {
+        LLConversationLog::instance().cache();
+    }
+
+    LLLocationHistory::getInstance()->save();
+
+    LLAvatarIconIDCache::getInstance()->save();
+
+    writeDebugInfo();
+
+    // drain pending cache writes with whatever time is left on the deadline
+    while (1)
+    {
+        S32 pending = 0;
+        pending += static_cast<S32>(LLAppViewer::getTextureCache()->update(1)); // unpauses the worker thread
+        pending += LLLFSThread::updateClass(0);
+        if (!pending)
+        {
+            break;
+        }
+        if (deadline_timer.getElapsedTimeF64() >= FAST_SHUTDOWN_DEADLINE)
+        {
+            LL_WARNS() << "Fast shutdown deadline hit with " << pending << " pending IO tasks" << LL_ENDL;
+            break;
+        }
+        ms_sleep(10);
+    }
+
+    // flush network buffers by shutting down messaging system
+    end_messaging_system();
+
+    removeMarkerFiles();
+    removeDumpDir();
+
+    LL_INFOS() << "Goodbye! (fast shutdown took "
+               << deadline_timer.getElapsedTimeF64() << " seconds)" << LL_ENDL;
+
+    // _exit() rather than exit() because the skipped teardown leaves static
+    // destructors with dangling dependencies -- same rationale as fastQuit()
+    _exit(0);
+}
+
 void LLAppViewer::initGeneralThread()
 {
     if (mGeneralThreadPool)
@@ -2259,7 +2444,7 @@ bool LLAppViewer::initThreads()
 {
     static const bool enable_threads = true;
 
-    LLImage::initClass(gSavedSettings.getBOOL("TextureNewByteRange"),gSavedSettings.getS32("TextureReverseByteRange"));
+    LLImage::initClass(gSavedSettings.getBOOL("TextureNewByteRange"),gSavedSettings.getS32("TextureReverseByteRange"),gSavedSettings.getS32("TextureJ2CDecodeThreads"));
 
     LLLFSThread::initClass(enable_threads && true); // TODO: fix crashes associated with this shutdo
 
@@ -2283,7 +2468,8 @@ bool LLAppViewer::initThreads()
     gSavedSettings.setLLSD("ThreadPoolSizes", threadCounts);
 
     // Image decoding
-    LLAppViewer::sImageDecodeThread = new LLImageDecodeThread(enable_threads && true);
+    LLAppViewer::sImageDecodeThread = new LLImageDecodeThread(enable_threads && true,
+                                                              gSavedSettings.getBOOL("ImageDecodeWorkStealing"));
     LLAppViewer::sTextureCache = new LLTextureCache(enable_threads && true);
     LLAppViewer::sTextureFetch = new LLTextureFetch(LLAppViewer::getTextureCache(),
                                                     enable_threads && true,
@@ -2982,6 +3168,8 @@ bool LLAppViewer::initConfiguration()
     //LLVolumeMgr::initClass();
     LLVolumeMgr* volume_manager = new LLVolumeMgr();
     volume_manager->useMutex(); // LLApp and LLMutex magic must be manually enabled
+    volume_manager->setCacheSize(gSavedSettings.getU32("VolumeLODGroupCacheSize"));
+    LLVolume::sSculptLODSimplify = gSavedSettings.getBOOL("RenderSculptLODSimplify");
     LLPrimitive::setVolumeManager(volume_manager);
 
     // Note: this is where we used to initialize gFeatureManagerp.
@@ -4282,6 +4470,8 @@ bool LLAppViewer::initCache()
     // total cache size - the 'CacheSize' pref - for all caches.
     const uintmax_t disk_cache_size = uintmax_t(cache_total_size * disk_cache_percent / 100);
     const bool enable_cache_debug_info = gSavedSettings.getBOOL("EnableDiskCacheDebugInfo");
+    const bool enable_cache_index = gSavedSettings.getBOOL("DiskCacheEnableIndex");
+    LLFileSystem::sUseMemoryMappedReads = gSavedSettings.getBOOL("DiskCacheMemoryMappedReads");
 
     bool texture_cache_mismatch = false;
     bool remove_vfs_files = false;
@@ -4335,7 +4525,7 @@ bool LLAppViewer::initCache()
     }
 
     const std::string cache_dir = gDirUtilp->getExpandedFilename(LL_PATH_CACHE, cache_dir_name);
-    LLDiskCache::initParamSingleton(cache_dir, disk_cache_size, enable_cache_debug_info);
+    LLDiskCache::initParamSingleton(cache_dir, disk_cache_size, enable_cache_debug_info, enable_cache_index);
 
     if (!read_only)
     {
@@ -4796,6 +4986,17 @@ void LLAppViewer::idle()
             viewer_stats_timer.reset();
         }
 
+        // Re-pack font glyph pages at idle, one font per tick, so week-long
+        // sessions don't accumulate pages full of glyphs that an old skin or
+        // locale needed once
+        static LLCachedControl<F32> font_compact_interval(gSavedSettings, "FontCacheCompactionInterval", 60.f);
+        static LLFrameTimer font_compact_timer;
+        if (font_compact_interval > 0.f && font_compact_timer.getElapsedTimeF32() >= font_compact_interval)
+        {
+            font_compact_timer.reset();
+            LLFontGL::compactCaches();
+        }
+
         // Print the object debugging stats
         static LLFrameTimer object_debug_timer;
         if (object_debug_timer.getElapsedTimeF32() > 5.f)
@@ -4971,9 +5172,15 @@ void LLAppViewer::idle()
 
     LLWorld::getInstance()->updateVisibilities();
     {
-        const F32 max_region_update_time = .001f; // 1ms
+        // 1ms unless the frame-budget governor is active, in which case the
+        // slice grows or shrinks with the region update backlog
+        const F32 max_region_update_time =
+            LLPerfStats::FrameBudget::getTimeSlice(LLPerfStats::FrameBudget::Subsystem::REGIONS, .001f);
         LL_RECORD_BLOCK_TIME(FTM_REGION_UPDATE);
+        LLTimer region_update_timer;
         LLWorld::getInstance()->updateRegions(max_region_update_time);
+        LLPerfStats::FrameBudget::reportSpent(LLPerfStats::FrameBudget::Subsystem::REGIONS,
+                                              (F32)region_update_timer.getElapsedTimeF64());
     }
 
     /////////////////////////
@@ -281,6 +281,7 @@ private:
 
     void sendLogoutRequest();
     void disconnectViewer();
+    void fastCleanup(); // Flush critical state under a deadline, then exit without full teardown. Never returns.
 
     // *FIX: the app viewer class should be some sort of singleton, no?
     // Perhaps its child class is the singleton and this should be an abstract base.
@@ -1109,6 +1109,14 @@ LLChatHistory::LLChatHistory(const LLChatHistory::Params& p)
     mEditor->setIsFriendCallback(LLAvatarActions::isFriend);
     mEditor->setIsObjectBlockedCallback(boost::bind(&LLMuteList::isMuted, LLMuteList::getInstance(), _1, _2, 0));
 
+    static LLCachedControl<U32> chat_history_max_bytes(gSavedSettings, "ChatHistoryMaxBytes", 0U);
+    if (chat_history_max_bytes > 0)
+    {
+        // cap-and-page: drop the oldest transcript lines once the cap is hit
+        // instead of letting hours-long sessions grow without bound
+        mEditor->setMaxTextLength((S32)chat_history_max_bytes);
+        mEditor->setTrimFromTop(true);
+    }
 }
 
 LLSD LLChatHistory::getValue() const
@@ -1207,6 +1215,7 @@ void LLChatHistory::onClickMoreText()
 
 void LLChatHistory::clear()
 {
+    mPendingMessages.clear();
     mLastFromName.clear();
     mEditor->clear();
     mLastFromID = LLUUID::null;
@@ -1215,6 +1224,14 @@ void LLChatHistory::clear()
 static LLTrace::BlockTimerStatHandle FTM_APPEND_MESSAGE("Append Chat Message");
 
 void LLChatHistory::appendMessage(const LLChat& chat, const LLSD &args, const LLStyle::Params& input_append_params)
+{
+    // spool the message; draw() drains the queue a time-budgeted slice per
+    // frame so a flood from a busy group spreads across frames and each
+    // frame's slice shares a single reflow
+    mPendingMessages.push_back({ chat, args, input_append_params });
+}
+
+void LLChatHistory::appendMessageImmediate(const LLChat& chat, const LLSD &args, const LLStyle::Params& input_append_params)
 {
     LL_RECORD_BLOCK_TIME(FTM_APPEND_MESSAGE);
     bool use_plain_text_chat_history = args["use_plain_text_chat_history"].asBoolean();
@@ -1312,7 +1329,8 @@ void LLChatHistory::appendMessage(const LLChat& chat, const LLSD &args, const LL
         name_params.readonly_color(txt_color);
     }
 
-    bool prependNewLineState = mEditor->getText().size() != 0;
+    // getLength() avoids converting the whole document to UTF-8 per append
+    bool prependNewLineState = mEditor->getLength() != 0;
 
     // compact mode: show a timestamp and name
     if (use_plain_text_chat_history)
@@ -1550,6 +1568,21 @@ void LLChatHistory::appendMessage(const LLChat& chat, const LLSD &args, const LL
 
 void LLChatHistory::draw()
 {
+    if (!mPendingMessages.empty())
+    {
+        // don't spend more than this appending per frame; the remainder
+        // of a burst keeps its order and lands on the following frames
+        const F32 MAX_APPEND_TIME = 0.005f;
+        LLTimer append_timer;
+        do
+        {
+            PendingMessage& message = mPendingMessages.front();
+            appendMessageImmediate(message.mChat, message.mArgs, message.mStyleParams);
+            mPendingMessages.pop_front();
+        }
+        while (!mPendingMessages.empty() && append_timer.getElapsedTimeF32() < MAX_APPEND_TIME);
+    }
+
     if (mEditor->scrolledToEnd())
     {
         mUnreadChatSources.clear();
@@ -31,6 +31,8 @@
 #include "lltextbox.h"
 #include "llviewerchat.h"
 
+#include <deque>
+
 //Chat log widget allowing addition of a message as a widget
 class LLChatHistory : public LLUICtrl
 {
@@ -102,6 +104,12 @@ class LLChatHistory : public LLUICtrl
          * @return pointer to LLView header object.
          */
         LLView* getHeader(const LLChat& chat,const LLStyle::Params& style_params, const LLSD& args, bool is_script = false);
+
+        /**
+         * Appends a queued message to the editor immediately.
+         * Called from draw() while draining mPendingMessages.
+         */
+        void appendMessageImmediate(const LLChat& chat, const LLSD& args, const LLStyle::Params& input_append_params);
     public:
         ~LLChatHistory();
         LLSD getValue() const;
@@ -149,5 +157,16 @@ class LLChatHistory : public LLUICtrl
         LLTextEditor*   mEditor;
         typedef std::set<std::string> unread_chat_source_t;
         unread_chat_source_t mUnreadChatSources;
+
+        // One queued chat line.  appendMessage() spools here and draw()
+        // drains a time-budgeted slice per frame, so a group chat burst
+        // shares one reflow per frame instead of stalling the UI.
+        struct PendingMessage
+        {
+            LLChat          mChat;
+            LLSD            mArgs;
+            LLStyle::Params mStyleParams;
+        };
+        std::deque<PendingMessage> mPendingMessages;
 };
 #endif /* LLCHATHISTORY_H_ */
@@ -424,9 +424,96 @@ void LLRenderPass::renderRiggedGroup(LLSpatialGroup* group, U32 type, bool textu
     }
 }
 
+// true when two draw infos can share one glMultiDrawElementsIndirect
+// submission -- identical buffer, matrix, and single-texture state
+static bool can_batch_indirect(const LLDrawInfo& a, const LLDrawInfo& b)
+{
+    return a.mVertexBuffer == b.mVertexBuffer &&
+           a.mModelMatrix == b.mModelMatrix &&
+           a.mTexture == b.mTexture &&
+           !a.mTextureMatrix && !b.mTextureMatrix &&
+           a.mTextureList.size() <= 1 && b.mTextureList.size() <= 1;
+}
+
+void LLRenderPass::pushBatchesIndirect(U32 type, bool texture, bool batch_textures)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_DRAWPOOL;
+
+    std::vector<U32> counts;
+    std::vector<U32> offsets;
+
+    auto* begin = gPipeline.beginRenderMap(type);
+    auto* end = gPipeline.endRenderMap(type);
+    for (LLCullResult::drawinfo_iterator i = begin; i != end; )
+    {
+        LLDrawInfo* pparams = *i;
+        LLCullResult::increment_iterator(i, end);
+
+        if (!pparams->mCount)
+        {
+            continue;
+        }
+
+        // gather the run of draws sharing this draw's state
+        counts.clear();
+        offsets.clear();
+        counts.push_back(pparams->mCount);
+        offsets.push_back(pparams->mOffset);
+
+        while (i != end && can_batch_indirect(*pparams, **i))
+        {
+            LLDrawInfo* next = *i;
+            LLCullResult::increment_iterator(i, end);
+            if (next->mCount)
+            {
+                counts.push_back(next->mCount);
+                offsets.push_back(next->mOffset);
+            }
+        }
+
+        if (counts.size() == 1)
+        { // no run -- take the ordinary path, which handles texture
+          // matrices and texture lists
+            if (texture)
+            {
+                pushBatch(*pparams, texture, batch_textures);
+            }
+            else
+            {
+                pushUntexturedBatch(*pparams);
+            }
+            continue;
+        }
+
+        applyModelMatrix(*pparams);
+
+        if (texture)
+        {
+            if (pparams->mTexture.notNull())
+            {
+                gGL.getTexUnit(0)->bindFast(pparams->mTexture);
+            }
+            else
+            {
+                gGL.getTexUnit(0)->unbindFast(LLTexUnit::TT_TEXTURE);
+            }
+        }
+
+        pparams->mVertexBuffer->setBuffer();
+        pparams->mVertexBuffer->drawRangeIndirect(LLRender::TRIANGLES, counts.data(), offsets.data(), (U32)counts.size());
+    }
+}
+
 void LLRenderPass::pushBatches(U32 type, bool texture, bool batch_textures)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_DRAWPOOL;
+
+    if (LLVertexBuffer::sEnableMultiDrawIndirect)
+    {
+        pushBatchesIndirect(type, texture, batch_textures);
+        return;
+    }
+
     if (texture)
     {
         auto* begin = gPipeline.beginRenderMap(type);
@@ -448,6 +535,13 @@ void LLRenderPass::pushBatches(U32 type, bool texture, bool batch_textures)
 void LLRenderPass::pushUntexturedBatches(U32 type)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_DRAWPOOL;
+
+    if (LLVertexBuffer::sEnableMultiDrawIndirect)
+    {
+        pushBatchesIndirect(type, false, false);
+        return;
+    }
+
     auto* begin = gPipeline.beginRenderMap(type);
     auto* end = gPipeline.endRenderMap(type);
     for (LLCullResult::drawinfo_iterator i = begin; i != end; )
@@ -638,6 +732,28 @@ void LLRenderPass::pushUntexturedBatch(LLDrawInfo& params)
     params.mVertexBuffer->drawRange(LLRender::TRIANGLES, params.mStart, params.mEnd, params.mCount, params.mOffset);
 }
 
+// upload whichever joint palette representation the bound shader was built
+// with -- dual quaternions when RenderAvatarDualQuaternionSkinning is on and
+// the cache entry carries them, the classic 3x4 matrix palette otherwise
+static void upload_skin_palette(const LLVOAvatar::MatrixPaletteCache& mpc, U32 count)
+{
+    static LLCachedControl<bool> dq_skinning(gSavedSettings, "RenderAvatarDualQuaternionSkinning", false);
+
+    if (dq_skinning && mpc.mGLDq.size() >= count * 8)
+    {
+        LLGLSLShader::sCurBoundShaderPtr->uniform4fv(LLViewerShaderMgr::AVATAR_DQ_PALETTE,
+            count * 2,
+            (GLfloat*)&(mpc.mGLDq[0]));
+    }
+    else
+    {
+        LLGLSLShader::sCurBoundShaderPtr->uniformMatrix3x4fv(LLViewerShaderMgr::AVATAR_MATRIX,
+            count,
+            false,
+            (GLfloat*)&(mpc.mGLMp[0]));
+    }
+}
+
 // static
 bool LLRenderPass::uploadMatrixPalette(LLDrawInfo& params)
 {
@@ -663,10 +779,7 @@ bool LLRenderPass::uploadMatrixPalette(LLVOAvatar* avatar, LLMeshSkinInfo* skinI
         return false;
     }
 
-    LLGLSLShader::sCurBoundShaderPtr->uniformMatrix3x4fv(LLViewerShaderMgr::AVATAR_MATRIX,
-        count,
-        false,
-        (GLfloat*)&(mpc.mGLMp[0]));
+    upload_skin_palette(mpc, count);
 
     return true;
 }
@@ -699,10 +812,7 @@ bool LLRenderPass::uploadMatrixPalette(LLVOAvatar* avatar, LLMeshSkinInfo* skinI
 
     if (!skipLastSkin)
     {
-        LLGLSLShader::sCurBoundShaderPtr->uniformMatrix3x4fv(LLViewerShaderMgr::AVATAR_MATRIX,
-            count,
-            false,
-            (GLfloat*)&(mpc.mGLMp[0]));
+        upload_skin_palette(mpc, count);
     }
 
     return !skipLastSkin;
@@ -737,10 +847,7 @@ bool LLRenderPass::uploadMatrixPalette(LLVOAvatar* avatar, LLMeshSkinInfo* skinI
 
     if (!skipLastSkin)
     {
-        LLGLSLShader::sCurBoundShaderPtr->uniformMatrix3x4fv(LLViewerShaderMgr::AVATAR_MATRIX,
-            count,
-            false,
-            (GLfloat*)&(mpc.mGLMp[0]));
+        upload_skin_palette(mpc, count);
     }
 
     return !skipLastSkin;
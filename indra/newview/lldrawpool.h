@@ -355,6 +355,11 @@ public:
     void pushBatches(U32 type, bool texture = true, bool batch_textures = false);
     void pushUntexturedBatches(U32 type);
 
+    // multi-draw-indirect variants of the above -- runs of draw infos that
+    // share a vertex buffer and texture state are submitted in a single
+    // glMultiDrawElementsIndirect call (see LLVertexBuffer::sEnableMultiDrawIndirect)
+    void pushBatchesIndirect(U32 type, bool texture, bool batch_textures);
+
     void pushRiggedBatches(U32 type, bool texture = true, bool batch_textures = false);
     void pushUntexturedRiggedBatches(U32 type);
 
@@ -55,6 +55,7 @@ bool LLDrawPoolWater::sNeedsDistortionUpdate = true;
 F32 LLDrawPoolWater::sWaterFogEnd = 0.f;
 
 extern bool gCubeSnapshot;
+extern F32SecondsImplicit gFrameTimeSeconds;
 
 LLDrawPoolWater::LLDrawPoolWater() : LLFacePool(POOL_WATER)
 {
@@ -96,6 +97,11 @@ void LLDrawPoolWater::prerender()
 
 S32 LLDrawPoolWater::getNumPostDeferredPasses()
 {
+    if (mDrawFace.empty())
+    { // no visible water this frame, don't pay for the screen copy
+        return 0;
+    }
+
     if (LLViewerCamera::getInstance()->getOrigin().mV[2] < 1024.f)
     {
         return 1;
@@ -109,8 +115,20 @@ void LLDrawPoolWater::beginPostDeferredPass(S32 pass)
     LL_PROFILE_GPU_ZONE("water beginPostDeferredPass")
     gGL.setColorMask(true, true);
 
-    if (LLPipeline::sRenderTransparentWater)
+    // The refraction copy only matters where water pixels actually land on
+    // screen.  When water is a sliver at the horizon, refresh the copy at a
+    // reduced rate instead of every frame -- a slightly stale refraction
+    // image is indistinguishable there.
+    static LLCachedControl<F32> min_coverage(gSavedSettings, "RenderWaterRefractionMinCoverage", 0.02f);
+    const F32 DISTORTION_REFRESH_PERIOD = 0.25f; // seconds between copies for sliver water
+
+    bool throttle_copy = !LLViewerCamera::getInstance()->cameraUnderWater() &&
+                         mWaterScreenCoverage < min_coverage &&
+                         (gFrameTimeSeconds - mLastDistortionUpdate) < DISTORTION_REFRESH_PERIOD;
+
+    if (LLPipeline::sRenderTransparentWater && !throttle_copy)
     {
+        mLastDistortionUpdate = gFrameTimeSeconds;
         // copy framebuffer contents so far to a texture to be used for
         // reflections and refractions
         LLGLDepthTest depth(GL_TRUE, GL_TRUE, GL_ALWAYS);
@@ -307,6 +325,8 @@ void LLDrawPoolWater::renderPostDeferred(S32 pass)
 
         LLGLDisable cullface(GL_CULL_FACE);
 
+        F32 pixel_area = 0.f;
+
         LLVOWater* water = nullptr;
         for (LLFace* const& face : mDrawFace)
         {
@@ -323,10 +343,18 @@ void LLDrawPoolWater::renderPostDeferred(S32 pass)
                 {
                     sNeedsReflectionUpdate = true;
                     sNeedsDistortionUpdate = true;
+                    pixel_area += face->getPixelArea();
                 }
             }
         }
 
+        if (!edge)
+        { // estimate of screen fraction covered by near water, read next
+          // frame to decide whether the refraction copy can be throttled
+            F32 screen_pixels = llmax((F32)(gGLViewport[2] * gGLViewport[3]), 1.f);
+            mWaterScreenCoverage = pixel_area / screen_pixels;
+        }
+
         shader->disableTexture(LLShaderMgr::ENVIRONMENT_MAP, LLTexUnit::TT_CUBE_MAP);
         shader->disableTexture(LLShaderMgr::WATER_SCREENTEX);
         shader->disableTexture(LLShaderMgr::BUMP_MAP);
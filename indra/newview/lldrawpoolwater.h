@@ -43,6 +43,12 @@ protected:
 
     LLPointer<LLViewerTexture> mOpaqueWaterImagep;
 
+    // fraction of the screen covered by non-edge water last frame and the
+    // time of the last screen copy, used to throttle the refraction copy
+    // when water is a sliver at the horizon
+    F32 mWaterScreenCoverage = 1.f;
+    F32 mLastDistortionUpdate = 0.f;
+
 public:
     static bool sSkipScreenCopy;
     static bool sNeedsReflectionUpdate;
@@ -27,6 +27,7 @@
 #ifndef LL_LLFACE_H
 #define LL_LLFACE_H
 
+#include "llobjectpool.h"
 #include "llstrider.h"
 #include "llrender.h"
 #include "v2math.h"
@@ -56,7 +57,7 @@ const U8 FACE_DO_NOT_BATCH_TEXTURES = 255;
 
 class alignas(16) LLFace
 {
-    LL_ALIGN_NEW
+    LL_OBJECT_POOL_NEW(LLFace)
 public:
     LLFace(const LLFace& rhs)
     {
@@ -359,7 +359,12 @@ void LLVolumeImplFlexible::doIdleUpdate()
                 // or at least clamping value a bit more from both sides.
                 U32 update_period = (U32) (llmax((S32) (LLViewerCamera::getInstance()->getScreenPixelArea()*0.01f/(pixel_area*(sUpdateFactor+1.f))),0)+1);
                 // MAINT-1890 Clamp the update period to ensure that the update_period is no greater than 32 frames
-                update_period = llclamp(update_period, 1U, 32U);
+                // for nearby flexis.  Distant ones may simulate as slowly as
+                // ~1 Hz -- the period cap ramps from 32 virtual frames at 64m
+                // to 64 beyond 128m, where individual update steps are no
+                // longer discernible.
+                U32 max_period = (U32)llclamp((S32)(drawablep->mDistanceWRTCamera * 0.5f), 32, 64);
+                update_period = llclamp(update_period, 1U, max_period);
 
                 // We control how fast flexies update, buy splitting updates among frames
                 U64 virtual_frame_num = (U64)(LLTimer::getElapsedSeconds() / SEC_PER_FLEXI_FRAME);
@@ -503,6 +508,14 @@ void LLVolumeImplFlexible::doFlexibleUpdate()
     F32 wind_factor = (mAttributes->getWindSensitivity()*0.1f) * section_length * secondsThisFrame;
     F32 max_angle = atan(section_length*2.f);
 
+    // Wind varies on a much coarser grid (16m cells) than the span of a
+    // single flexi, so sample it once at the anchor rather than per section
+    LLVector3 wind_force;
+    if (mAttributes->getWindSensitivity() > 0.001f)
+    {
+        wind_force = gAgent.getRegion()->mWind.getVelocity(BasePosition) * wind_factor;
+    }
+
     F32 force_factor = section_length * secondsThisFrame;
 
     // Update simulated sections
@@ -527,7 +540,7 @@ void LLVolumeImplFlexible::doFlexibleUpdate()
         //------------------------------------------------------------------------------------------
         if (mAttributes->getWindSensitivity() > 0.001f)
         {
-            mSection[i].mPosition += gAgent.getRegion()->mWind.getVelocity( mSection[i].mPosition ) * wind_factor;
+            mSection[i].mPosition += wind_force;
         }
 
         //------------------------------------------------------------------------------------------
@@ -48,7 +48,9 @@
 #include "llviewerregion.h"
 #include "llviewerwindow.h"
 #include "pipeline.h"
+#include "workqueue.h"
 
+#include <atomic>
 #include <iterator>
 
 LLFloater360Capture::LLFloater360Capture(const LLSD& key)
@@ -350,50 +352,6 @@ bool LLFloater360Capture::writeDataURL(const std::string filename, const std::st
     return false;
 }
 
-// Encode the image from each of the 6 snapshots and save it out to
-// the JavaScript array of data URLs
-void LLFloater360Capture::encodeAndSave(LLPointer<LLImageRaw> raw_image, const std::string filename, const std::string prefix)
-{
-    // the default quality for the JPEG encoding is set quite high
-    // but this still seems to be a reasonable compromise for
-    // quality/size and is still much smaller than equivalent PNGs
-    int jpeg_encode_quality = gSavedSettings.getU32("360CaptureJPEGEncodeQuality");
-    LLPointer<LLImageJPEG> jpeg_image = new LLImageJPEG(jpeg_encode_quality);
-
-    LLImageDataSharedLock lock(raw_image);
-
-    // Actually encode the JPEG image. This is where a lot of time
-    // is spent now that the snapshot capture process has been
-    // optimized.  The encode_time parameter doesn't appear to be
-    // used anymore.
-    const int encode_time = 0;
-    bool resultjpeg = jpeg_image->encode(raw_image, encode_time);
-
-    if (resultjpeg)
-    {
-        // save individual cube map images as real JPEG files
-        // for debugging or curiosity) based on debug settings
-        if (gSavedSettings.getBOOL("360CaptureDebugSaveImage"))
-        {
-            const std::string jpeg_filename = STRINGIZE(
-                                                  gDirUtilp->getLindenUserDir() <<
-                                                  gDirUtilp->getDirDelimiter() <<
-                                                  "eqrimg" <<
-                                                  gDirUtilp->getDirDelimiter() <<
-                                                  prefix <<
-                                                  "." <<
-                                                  jpeg_image->getExtension()
-                                              );
-
-            LL_INFOS("360Capture") << "Saving debug JPEG image as " << jpeg_filename << LL_ENDL;
-            jpeg_image->save(jpeg_filename);
-        }
-
-        // actually write the JPEG image to disk as a data URL
-        writeDataURL(filename, prefix, jpeg_image->getData(), jpeg_image->getDataSize());
-    }
-}
-
 // Defer back to the main loop for a single rendered frame to give
 // the renderer a chance to update the UI if it is needed
 void LLFloater360Capture::suspendForAFrame()
@@ -534,8 +492,18 @@ void LLFloater360Capture::capture360Images()
     // because of interest list issues.
     int num_render_passes = gSavedSettings.getU32("360CaptureNumRenderPasses");
 
+    // The JPEG encodes are the bulk of the capture time and each face is
+    // independent, so they are handed to the General work queue and overlap
+    // with rendering the remaining faces.  The data URL file needs its six
+    // entries in order, so the writes happen on this coroutine once every
+    // encode has finished.
+    int jpeg_encode_quality = gSavedSettings.getU32("360CaptureJPEGEncodeQuality");
+    LLPointer<LLImageJPEG> jpeg_images[6];
+    std::atomic<int> encodes_pending(0);
+    LL::WorkQueue::ptr_t encode_queue = LL::WorkQueue::getInstance("General");
+
     // time the encode process for later optimization
-    auto encode_time_total = 0.0;
+    auto t_encode_start = std::chrono::high_resolution_clock::now();
 
     // for each of the 6 directions we shoot...
     for (int i = 0; i < 6; i++)
@@ -573,12 +541,34 @@ void LLFloater360Capture::capture360Images()
         gViewerWindow->simpleSnapshot(mRawImages[i],
                                       mSourceImageSize, mSourceImageSize, num_render_passes);
 
-        // encode each image and write to disk while saving how long it took to do so
-        auto t_start = std::chrono::high_resolution_clock::now();
-        encodeAndSave(mRawImages[i], cubemap_js_full_path, prefixes[i]);
-        auto t_end = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(t_end - t_start);
-        encode_time_total += duration.count();
+        // queue the encode of this face while we carry on capturing the rest
+        LLPointer<LLImageRaw> raw_image = mRawImages[i];
+        LLPointer<LLImageJPEG>* encoded = &jpeg_images[i];
+        auto encode_job = [raw_image, encoded, jpeg_encode_quality, &encodes_pending]()
+            {
+                // the default quality for the JPEG encoding is set quite high
+                // but this still seems to be a reasonable compromise for
+                // quality/size and is still much smaller than equivalent PNGs
+                LLPointer<LLImageJPEG> jpeg_image = new LLImageJPEG(jpeg_encode_quality);
+
+                LLImageDataSharedLock lock(raw_image);
+
+                // Actually encode the JPEG image. This is where a lot of time
+                // is spent now that the snapshot capture process has been
+                // optimized.  The encode_time parameter doesn't appear to be
+                // used anymore.
+                const int encode_time = 0;
+                if (jpeg_image->encode(raw_image, encode_time))
+                {
+                    *encoded = jpeg_image;
+                }
+                --encodes_pending;
+            };
+        ++encodes_pending;
+        if (!encode_queue || !encode_queue->post(encode_job))
+        { // no pool (or it is shutting down) -- encode here
+            encode_job();
+        }
 
         LLViewerStats::instance().getRecording().resume();
         LLAppViewer::instance()->resumeMainloopTimeout();
@@ -587,11 +577,48 @@ void LLFloater360Capture::capture360Images()
         LLAppViewer::instance()->pingMainloopTimeout("LLFloater360Capture::capture360Images");
     }
 
+    // let the worker threads finish any outstanding encodes without
+    // holding up the frame loop
+    while (encodes_pending > 0)
+    {
+        llcoro::suspend();
+    }
+
     // display time to encode all 6 images.  It tends to be a fairly linear
     // time for each so we don't need to worry about displaying the time
     // for each - this gives us plenty to use for optimizing
+    auto t_encode_end = std::chrono::high_resolution_clock::now();
     LL_INFOS("360Capture") << "Time to encode and save 6 images was " <<
-                           encode_time_total << " seconds" << LL_ENDL;
+                           std::chrono::duration_cast<std::chrono::duration<double>>(t_encode_end - t_encode_start).count() <<
+                           " seconds" << LL_ENDL;
+
+    // write the six data URLs in capture order now that they all exist
+    for (int i = 0; i < 6; i++)
+    {
+        if (jpeg_images[i])
+        {
+            // save individual cube map images as real JPEG files
+            // for debugging or curiosity) based on debug settings
+            if (gSavedSettings.getBOOL("360CaptureDebugSaveImage"))
+            {
+                const std::string jpeg_filename = STRINGIZE(
+                                                      gDirUtilp->getLindenUserDir() <<
+                                                      gDirUtilp->getDirDelimiter() <<
+                                                      "eqrimg" <<
+                                                      gDirUtilp->getDirDelimiter() <<
+                                                      prefixes[i] <<
+                                                      "." <<
+                                                      jpeg_images[i]->getExtension()
+                                                  );
+
+                LL_INFOS("360Capture") << "Saving debug JPEG image as " << jpeg_filename << LL_ENDL;
+                jpeg_images[i]->save(jpeg_filename);
+            }
+
+            // actually write the JPEG image to disk as a data URL
+            writeDataURL(cubemap_js_full_path, prefixes[i], jpeg_images[i]->getData(), jpeg_images[i]->getDataSize());
+        }
+    }
 
     // Write the JavaScript file footer (the bottom of the file after the
     // declarations of the actual data URLs array). The footer comprises of
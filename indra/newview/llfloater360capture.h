@@ -57,7 +57,6 @@ class LLFloater360Capture:
         void writeDataURLHeader(const std::string filename);
         void writeDataURLFooter(const std::string filename);
         bool writeDataURL(const std::string filename, const std::string prefix, U8* data, unsigned int data_len);
-        void encodeAndSave(LLPointer<LLImageRaw> raw_image, const std::string filename, const std::string prefix);
 
         std::vector<LLAnimPauseRequest> mAvatarPauseHandles;
         void freezeWorld(bool enable);
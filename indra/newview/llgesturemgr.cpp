@@ -531,6 +531,87 @@ void LLGestureMgr::replaceGesture(const LLUUID& item_id, const LLUUID& new_asset
     LLGestureMgr::instance().replaceGesture(base_item_id, gesture, new_asset_id);
 }
 
+void LLGestureMgr::prefetchGestureAssets(LLMultiGesture* gesture)
+{
+    if (!gesture || !gAssetStorage) return;
+
+    // Background priority: activating a folder full of gestures
+    // shouldn't compete with whatever the user is doing right now.
+    const bool high_priority = false;
+
+    for (std::vector<LLGestureStep*>::iterator steps_it = gesture->mSteps.begin();
+         steps_it != gesture->mSteps.end();
+         ++steps_it)
+    {
+        LLGestureStep* step = *steps_it;
+        switch(step->getType())
+        {
+        case STEP_ANIMATION:
+            {
+                LLGestureStepAnimation* anim_step = (LLGestureStepAnimation*)step;
+                const LLUUID& anim_id = anim_step->mAnimAssetID;
+
+                // Don't request the animation if this step stops it or if it is already in the cache
+                if (!(anim_id.isNull()
+                      || anim_step->mFlags & ANIM_FLAG_STOP
+                      || gAssetStorage->hasLocalAsset(anim_id, LLAssetType::AT_ANIMATION)))
+                {
+                    mLoadingAssets.insert(anim_id);
+
+                    LLUUID* id = new LLUUID(gAgentID);
+                    gAssetStorage->getAssetData(anim_id,
+                                    LLAssetType::AT_ANIMATION,
+                                    onAssetLoadComplete,
+                                    (void *)id,
+                                    high_priority);
+                }
+                break;
+            }
+        case STEP_SOUND:
+            {
+                LLGestureStepSound* sound_step = (LLGestureStepSound*)step;
+                const LLUUID& sound_id = sound_step->mSoundAssetID;
+                if (sound_id.isNull())
+                {
+                    break;
+                }
+                if (gAssetStorage->hasLocalAsset(sound_id, LLAssetType::AT_SOUND))
+                {
+                    if (gAudiop)
+                    {
+                        // already downloaded; queue the decode now so the
+                        // trigger finds a ready buffer in the audio engine
+                        gAudiop->preloadSound(sound_id);
+                    }
+                }
+                else
+                {
+                    mLoadingAssets.insert(sound_id);
+
+                    // assetCallback hands the sound to the audio engine,
+                    // which queues its decode on arrival
+                    gAssetStorage->getAssetData(sound_id,
+                                    LLAssetType::AT_SOUND,
+                                    onAssetLoadComplete,
+                                    NULL,
+                                    high_priority);
+                }
+                break;
+            }
+        case STEP_CHAT:
+        case STEP_WAIT:
+        case STEP_EOF:
+            {
+                break;
+            }
+        default:
+            {
+                LL_WARNS() << "Unknown gesture step type: " << step->getType() << LL_ENDL;
+            }
+        }
+    }
+}
+
 void LLGestureMgr::playGesture(LLMultiGesture* gesture, bool fromKeyPress)
 {
     if (!gesture) return;
@@ -1197,6 +1278,10 @@ void LLGestureMgr::onLoadComplete(const LLUUID& asset_uuid,
 
             self.mActive[item_id] = gesture;
 
+            // Warm up the animations and sounds the steps will trigger
+            // so the first play doesn't misfire waiting on downloads.
+            self.prefetchGestureAssets(gesture);
+
             // Everything has been successful.  Add to the active list.
             gInventory.addChangedMask(LLInventoryObserver::LABEL, item_id);
 
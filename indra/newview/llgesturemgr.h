@@ -170,6 +170,11 @@ protected:
                                     LLAssetType::EType type,
                                     void* user_data, S32 status, LLExtStat ext_status);
 
+    // Walks a freshly activated gesture's steps and fetches the
+    // animations and sounds they trigger at background priority, so
+    // the first play doesn't stall on asset downloads.
+    void prefetchGestureAssets(LLMultiGesture* gesture);
+
     // Checks whether all animation and sound assets
     // needed to play a gesture are loaded.
     static bool hasLoadingAssets(LLMultiGesture* gesture);
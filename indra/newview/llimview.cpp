@@ -48,6 +48,7 @@
 #include "llagentui.h"
 #include "llappviewer.h"
 #include "llavatariconctrl.h"
+#include "llcallbacklist.h"
 #include "llcallingcard.h"
 #include "llchat.h"
 #include "llfloaterimsession.h"
@@ -712,9 +713,46 @@ LLIMModel::LLIMModel()
 {
     addNewMsgCallback(boost::bind(&LLFloaterIMSession::newIMCallback, _1));
     addNewMsgCallback(boost::bind(&on_new_message, _1));
+    gIdleCallbacks.addFunction(onIdle, this);
     LLCallDialogManager::instance();
 }
 
+// static
+void LLIMModel::onIdle(void* user_data)
+{
+    LLIMModel* self = (LLIMModel*)user_data;
+    self->flushNewMsgNotifications();
+}
+
+void LLIMModel::flushNewMsgNotifications()
+{
+    if (mPendingNewMsgNotifications.empty())
+        return;
+
+    // swap the queue out first so a listener that adds a message re-queues
+    // for next frame instead of mutating the map we are iterating
+    std::map<LLUUID, LLSD> pending;
+    pending.swap(mPendingNewMsgNotifications);
+
+    for (auto& entry : pending)
+    {
+        LLIMSession* session = findIMSession(entry.first);
+        if (!session)
+        {
+            // session was torn down between queue and flush
+            continue;
+        }
+
+        // the counts may have moved since the message that queued this
+        // notification arrived; deliver the current ones
+        LLSD& arg = entry.second;
+        arg["num_unread"] = session->mNumUnread;
+        arg["participant_unread"] = session->mParticipantUnreadMessageCount;
+
+        mNewMsgSignal(arg);
+    }
+}
+
 LLIMModel::LLIMSession::LLIMSession(const LLUUID& session_id,
                                     const std::string& name,
                                     const EInstantMessage& type,
@@ -1733,7 +1771,10 @@ void LLIMModel::processAddingMessage(const LLUUID& session_id, const std::string
         ( session->isP2PSessionType() || session->isAdHocSessionType() ) )
         LLRecentPeople::instance().add(from_id);
 
-    // notify listeners
+    // queue a notification for this session; the queue is drained once per
+    // frame so listeners see one coalesced update per session no matter how
+    // many messages landed. The floater re-reads the session's message list
+    // when notified, so no text is lost by keeping only the latest payload.
     LLSD arg;
     arg["session_id"] = session_id;
     arg["num_unread"] = session->mNumUnread;
@@ -1745,7 +1786,7 @@ void LLIMModel::processAddingMessage(const LLUUID& session_id, const std::string
     arg["session_type"] = session->mSessionType;
     arg["is_region_msg"] = is_region_msg;
 
-    mNewMsgSignal(arg);
+    mPendingNewMsgNotifications[session_id] = arg;
 }
 
 LLIMModel::LLIMSession* LLIMModel::addMessageSilently(const LLUUID& session_id, const std::string& from, const LLUUID& from_id,
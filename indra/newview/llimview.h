@@ -177,6 +177,14 @@ public:
     session_signal_t mNewMsgSignal;
     session_signal_t mNoUnreadMsgsSignal;
 
+    // New-message notifications queued per session and drained once per
+    // frame, so a message storm in a busy group costs one observer fan-out
+    // per session instead of one per message. Each entry holds the latest
+    // message's payload; the unread counts are re-read at flush time.
+    std::map<LLUUID, LLSD> mPendingNewMsgNotifications;
+    void flushNewMsgNotifications();
+    static void onIdle(void* user_data);
+
     /**
      * Find an IM Session corresponding to session_id
      * Returns NULL if the session does not exist
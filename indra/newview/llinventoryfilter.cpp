@@ -83,6 +83,9 @@ LLInventoryFilter::LLInventoryFilter(const Params& p)
     mFirstRequiredGeneration(0),
     mFirstSuccessGeneration(0),
     mSearchType(SEARCHTYPE_NAME),
+    mNameIndexGeneration(0),
+    mNameIndexQueried(false),
+    mNameIndexActive(false),
     mSingleFolderMode(false)
 {
     // copy mFilterOps into mDefaultFilterOps
@@ -150,6 +153,11 @@ bool LLInventoryFilter::check(const LLFolderViewModelItem* item)
     }
     else
     {
+        if (!is_folder && mSearchType == SEARCHTYPE_NAME
+            && !checkAgainstNameIndex(listener->getUUID(), desc))
+        {
+            return false;
+        }
         passed = checkAgainstFilterSubString(desc);
     }
 
@@ -304,6 +312,38 @@ bool LLInventoryFilter::checkAgainstFilterSubString(const std::string& desc) con
     return pos != std::string::npos;
 }
 
+// Consult the inventory-wide trigram name index. Returns true when the
+// item may still match and the full substring check must run; false only
+// when the index proves the searchable name cannot contain the filter
+// string. Must stay conservative: a wrong false here hides a real match.
+bool LLInventoryFilter::checkAgainstNameIndex(const LLUUID& object_id, const std::string& desc)
+{
+    if (mFilterSubString.empty())
+        return true;
+
+    if (!mNameIndexQueried || mNameIndexGeneration != gInventory.getNameIndexGeneration())
+    {
+        mNameIndexActive = gInventory.queryNameIndex(mFilterSubString, mNameIndexCandidates);
+        mNameIndexGeneration = gInventory.getNameIndexGeneration();
+        mNameIndexQueried = true;
+    }
+    if (!mNameIndexActive)
+        return true;
+
+    if (mNameIndexCandidates.find(object_id) != mNameIndexCandidates.end())
+        return true;
+
+    // The index only covers item names, but the searchable name can carry
+    // a label suffix such as "(worn)". Scan a bounded tail of the
+    // description so matches that touch the suffix are never lost; any
+    // suffix fits well inside this margin.
+    const size_t margin = 64 + mFilterSubString.size();
+    if (desc.size() <= margin)
+        return true;
+
+    return desc.find(mFilterSubString, desc.size() - margin) != std::string::npos;
+}
+
 bool LLInventoryFilter::checkAgainstFilterType(const LLFolderViewModelItemInventory* listener) const
 {
     if (!listener)
@@ -992,6 +1032,8 @@ void LLInventoryFilter::setFilterSubString(const std::string& string)
             && !filter_sub_string_new.substr(0, mFilterSubString.size()).compare(mFilterSubString);
 
         mFilterSubString = filter_sub_string_new;
+        mNameIndexQueried = false;
+        mNameIndexCandidates.clear();
         if (exact_token_changed)
         {
             setModified(FILTER_RESTART);
@@ -351,6 +351,7 @@ private:
     bool                checkAgainstCreator(const class LLFolderViewModelItemInventory* listener) const;
     bool                checkAgainstSearchVisibility(const class LLFolderViewModelItemInventory* listener) const;
     bool                checkAgainstClipboard(const LLUUID& object_id) const;
+    bool                checkAgainstNameIndex(const LLUUID& object_id, const std::string& desc);
 
     FilterOps               mFilterOps;
     FilterOps               mDefaultFilterOps;
@@ -380,6 +381,13 @@ private:
     std::vector<std::string> mFilterTokens;
     std::string              mExactToken;
 
+    // candidate set from LLInventoryModel's name index for the current
+    // substring, fetched once per filter string change
+    uuid_set_t              mNameIndexCandidates;
+    U32                     mNameIndexGeneration;
+    bool                    mNameIndexQueried;
+    bool                    mNameIndexActive;
+
     bool mSingleFolderMode;
 };
 
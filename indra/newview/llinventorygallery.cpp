@@ -363,6 +363,44 @@ void LLInventoryGallery::draw()
         {
             handleModifiedFilter();
         }
+        prefetchThumbnails();
+    }
+}
+
+// Kick thumbnail fetches for items within InventoryThumbnailPrefetchRows rows
+// of the visible area so scrolling a large gallery doesn't reveal gray
+// placeholders. Only matters when thumbnails load lazily on first draw; small
+// galleries load everything immediately anyway.
+void LLInventoryGallery::prefetchThumbnails()
+{
+    static LLCachedControl<U32> prefetch_rows(gSavedSettings, "InventoryThumbnailPrefetchRows", 0);
+    if (prefetch_rows == 0 || mLoadThumbnailsImmediately || !mScrollPanel)
+    {
+        return;
+    }
+
+    LLRect band = mScrollPanel->calcScreenRect();
+    S32 margin = (S32)prefetch_rows * (mRowPanelHeight + mVerticalGap);
+    band.mTop += margin;
+    band.mBottom -= margin;
+
+    // spread the fetch kicks over several frames
+    const S32 MAX_PREFETCH_PER_FRAME = 16;
+    S32 started = 0;
+    for (LLInventoryGalleryItem* item : mItems)
+    {
+        if (item->isHidden())
+        {
+            continue;
+        }
+        LLRect item_rect = item->calcScreenRect();
+        if (item_rect.mBottom <= band.mTop && item_rect.mTop >= band.mBottom)
+        {
+            if (item->prefetchThumbnail() && ++started >= MAX_PREFETCH_PER_FRAME)
+            {
+                break;
+            }
+        }
     }
 }
 
@@ -2867,6 +2905,11 @@ void LLInventoryGalleryItem::setLoadImmediately(bool val)
     mThumbnailCtrl->setInitImmediately(val);
 }
 
+bool LLInventoryGalleryItem::prefetchThumbnail()
+{
+    return mThumbnailCtrl && mThumbnailCtrl->prefetch();
+}
+
 void LLInventoryGalleryItem::draw()
 {
     if (isFadeItem())
@@ -226,6 +226,7 @@ private:
     void reArrangeRows(S32 row_diff = 0);
     bool updateRowsIfNeeded();
     void updateGalleryWidth();
+    void prefetchThumbnails();
 
     LLInventoryGalleryItem* buildGalleryItem(std::string name, LLUUID item_id, LLAssetType::EType type, LLUUID thumbnail_id, LLInventoryType::EType inventory_type, U32 flags, time_t creation_date, bool is_link, bool is_worn);
     LLInventoryGalleryItem* getItem(const LLUUID& id) const;
@@ -347,6 +348,9 @@ public:
     void setThumbnail(LLUUID id);
     void setGallery(LLInventoryGallery* gallery) { mGallery = gallery; }
     void setLoadImmediately(bool val);
+    // start the thumbnail fetch ahead of the first draw; returns true if
+    // this call kicked off the load
+    bool prefetchThumbnail();
     bool isFolder() { return mIsFolder; }
     bool isLink() { return mIsLink; }
     EInventorySortGroup getSortGroup() { return mSortGroup; }
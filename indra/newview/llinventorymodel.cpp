@@ -90,6 +90,11 @@ S32 LLInventoryModel::sPendingSystemFolders = 0;
 //bool decompress_file(const char* src_filename, const char* dst_filename);
 static const char PRODUCTION_CACHE_FORMAT_STRING[] = "%s.inv.llsd";
 static const char GRID_CACHE_FORMAT_STRING[] = "%s.%s.inv.llsd";
+
+// First line of a binary inventory cache file; self-delimiting binary
+// LLSD records follow. The legacy cache format starts with a notation
+// LLSD version record instead, so the two are distinguishable.
+static const std::string INV_CACHE_BINARY_HEADER("<? inv_cache/binary ?>");
 static const char * const LOG_INV("Inventory");
 
 struct InventoryIDPtrLess
@@ -440,6 +445,7 @@ LLInventoryModel::LLInventoryModel()
     mItemMap(),
     mParentChildCategoryTree(),
     mParentChildItemTree(),
+    mNameIndexGeneration(0),
     mLastItem(NULL),
     mIsNotifyObservers(false),
     mModifyMask(LLInventoryObserver::ALL),
@@ -2147,6 +2153,11 @@ void LLInventoryModel::notifyObservers()
     }
 
     mIsNotifyObservers = true;
+
+    // apply pending adds, removes and renames to the name index before
+    // observers (and through them the filters) see the new state
+    syncNameIndex();
+
     for (observer_list_t::iterator iter = mObservers.begin();
          iter != mObservers.end(); )
     {
@@ -2172,6 +2183,70 @@ void LLInventoryModel::notifyObservers()
     mIsNotifyObservers = false;
 }
 
+void LLInventoryModel::syncNameIndex()
+{
+    static LLCachedControl<bool> use_name_index(gSavedSettings, "InventoryNameIndex", false);
+    if (!use_name_index)
+    {
+        if (!mNameIndex.isEmpty())
+        {
+            mNameIndex.clear();
+        }
+        return;
+    }
+    if (mNameIndex.isEmpty())
+    {
+        // not built yet; the first query will build it from scratch
+        return;
+    }
+    for (const LLUUID& id : mChangedItemIDs)
+    {
+        // category ids are in this set too; getItem returns NULL for
+        // them and removeItem is a no-op on anything never indexed
+        LLViewerInventoryItem* item = getItem(id);
+        if (item)
+        {
+            mNameIndex.indexItem(id, item->getName());
+        }
+        else
+        {
+            mNameIndex.removeItem(id);
+        }
+    }
+    if (!mChangedItemIDs.empty())
+    {
+        ++mNameIndexGeneration;
+    }
+}
+
+void LLInventoryModel::rebuildNameIndex()
+{
+    LL_PROFILE_ZONE_SCOPED;
+    mNameIndex.clear();
+    for (item_map_t::value_type& entry : mItemMap)
+    {
+        if (entry.second)
+        {
+            mNameIndex.indexItem(entry.first, entry.second->getName());
+        }
+    }
+    ++mNameIndexGeneration;
+}
+
+bool LLInventoryModel::queryNameIndex(const std::string& query, uuid_set_t& candidates)
+{
+    static LLCachedControl<bool> use_name_index(gSavedSettings, "InventoryNameIndex", false);
+    if (!use_name_index)
+    {
+        return false;
+    }
+    if (mNameIndex.isEmpty() && !mItemMap.empty())
+    {
+        rebuildNameIndex();
+    }
+    return mNameIndex.query(query, candidates);
+}
+
 // store flag for change
 // and id of object change applies to
 void LLInventoryModel::addChangedMask(U32 mask, const LLUUID& referent)
@@ -3338,7 +3413,9 @@ bool LLInventoryModel::loadFromFile(const std::string& filename,
     }
     LL_INFOS(LOG_INV) << "loading inventory from: (" << filename << ")" << LL_ENDL;
 
-    llifstream file(filename.c_str());
+    // open in binary mode; the binary format depends on it and getline
+    // still works for the notation format (modulo a trailing '\r')
+    llifstream file(filename.c_str(), std::ios::in | std::ios::binary);
 
     if (!file.is_open())
     {
@@ -3348,84 +3425,131 @@ bool LLInventoryModel::loadFromFile(const std::string& filename,
 
     is_cache_obsolete = true; // Obsolete until proven current
 
-    //U64 lines_count = 0U;
     std::string line;
-    LLPointer<LLSDParser> parser = new LLSDNotationParser();
-    while (std::getline(file, line))
+    if (!std::getline(file, line))
+    {
+        LL_INFOS(LOG_INV) << "inventory cache is empty: " << filename << LL_ENDL;
+        return false;
+    }
+    if (!line.empty() && line.back() == '\r')
+    {
+        line.pop_back();
+    }
+
+    if (line == INV_CACHE_BINARY_HEADER)
     {
+        // binary cache: a stream of self-delimiting binary LLSD records,
+        // the first of which is the version stamp
+        LLPointer<LLSDParser> parser = new LLSDBinaryParser();
         LLSD s_item;
-        std::istringstream iss(line);
-        if (parser->parse(iss, s_item, line.length()) == LLSDParser::PARSE_FAILURE)
+        while (parser->parse(file, s_item, LLSDSerialize::SIZE_UNLIMITED) != LLSDParser::PARSE_FAILURE)
         {
-            LL_WARNS(LOG_INV)<< "Parsing inventory cache failed" << LL_ENDL;
-            break;
+            if (!readCacheRecord(s_item, categories, items, cats_to_update, is_cache_obsolete))
+            {
+                break;
+            }
+            s_item.clear();
         }
-
-        if (s_item.has("inv_cache_version"))
+    }
+    else
+    {
+        //U64 lines_count = 0U;
+        LLPointer<LLSDParser> parser = new LLSDNotationParser();
+        do
         {
-            S32 version = s_item["inv_cache_version"].asInteger();
-            if (version == sCurrentInvCacheVersion)
+            if (!line.empty() && line.back() == '\r')
             {
-                // Cache is up to date
-                is_cache_obsolete = false;
-                continue;
+                line.pop_back();
             }
-            else
+
+            LLSD s_item;
+            std::istringstream iss(line);
+            if (parser->parse(iss, s_item, line.length()) == LLSDParser::PARSE_FAILURE)
             {
-                LL_WARNS(LOG_INV)<< "Inventory cache is out of date" << LL_ENDL;
+                LL_WARNS(LOG_INV)<< "Parsing inventory cache failed" << LL_ENDL;
                 break;
             }
-        }
-        else if (s_item.has("cat_id"))
-        {
-            if (is_cache_obsolete)
-                break;
 
-            LLPointer<LLViewerInventoryCategory> inv_cat = new LLViewerInventoryCategory(LLUUID::null);
-            if(inv_cat->importLLSD(s_item))
+            if (!readCacheRecord(s_item, categories, items, cats_to_update, is_cache_obsolete))
             {
-                categories.push_back(inv_cat);
+                break;
             }
+
+//          TODO(brad) - figure out how to reenable this without breaking everything else
+//          static constexpr U64 BATCH_SIZE = 512U;
+//          if ((++lines_count % BATCH_SIZE) == 0)
+//          {
+//              // SL-19968 - make sure message system code gets a chance to run every so often
+//              pump_idle_startup_network();
+//          }
         }
-        else if (s_item.has("item_id"))
+        while (std::getline(file, line));
+    }
+
+    file.close();
+
+    return !is_cache_obsolete;
+}
+
+// static
+bool LLInventoryModel::readCacheRecord(const LLSD& s_item,
+                                       cat_array_t& categories,
+                                       item_array_t& items,
+                                       changed_items_t& cats_to_update,
+                                       bool& is_cache_obsolete)
+{
+    if (s_item.has("inv_cache_version"))
+    {
+        S32 version = s_item["inv_cache_version"].asInteger();
+        if (version == sCurrentInvCacheVersion)
         {
-            if (is_cache_obsolete)
-                break;
+            // Cache is up to date
+            is_cache_obsolete = false;
+        }
+        else
+        {
+            LL_WARNS(LOG_INV)<< "Inventory cache is out of date" << LL_ENDL;
+            return false;
+        }
+    }
+    else if (s_item.has("cat_id"))
+    {
+        if (is_cache_obsolete)
+            return false;
 
-            LLPointer<LLViewerInventoryItem> inv_item = new LLViewerInventoryItem;
-            if( inv_item->fromLLSD(s_item) )
+        LLPointer<LLViewerInventoryCategory> inv_cat = new LLViewerInventoryCategory(LLUUID::null);
+        if(inv_cat->importLLSD(s_item))
+        {
+            categories.push_back(inv_cat);
+        }
+    }
+    else if (s_item.has("item_id"))
+    {
+        if (is_cache_obsolete)
+            return false;
+
+        LLPointer<LLViewerInventoryItem> inv_item = new LLViewerInventoryItem;
+        if( inv_item->fromLLSD(s_item) )
+        {
+            if(inv_item->getUUID().isNull())
             {
-                if(inv_item->getUUID().isNull())
+                LL_DEBUGS(LOG_INV) << "Ignoring inventory with null item id: "
+                    << inv_item->getName() << LL_ENDL;
+            }
+            else
+            {
+                if (inv_item->getType() == LLAssetType::AT_UNKNOWN)
                 {
-                    LL_DEBUGS(LOG_INV) << "Ignoring inventory with null item id: "
-                        << inv_item->getName() << LL_ENDL;
+                    cats_to_update.insert(inv_item->getParentUUID());
                 }
                 else
                 {
-                    if (inv_item->getType() == LLAssetType::AT_UNKNOWN)
-                    {
-                        cats_to_update.insert(inv_item->getParentUUID());
-                    }
-                    else
-                    {
-                        items.push_back(inv_item);
-                    }
+                    items.push_back(inv_item);
                 }
             }
         }
-
-//      TODO(brad) - figure out how to reenable this without breaking everything else
-//      static constexpr U64 BATCH_SIZE = 512U;
-//      if ((++lines_count % BATCH_SIZE) == 0)
-//      {
-//          // SL-19968 - make sure message system code gets a chance to run every so often
-//          pump_idle_startup_network();
-//      }
     }
-
-    file.close();
-
-    return !is_cache_obsolete;
+    return true;
 }
 
 // static
@@ -3441,9 +3565,14 @@ bool LLInventoryModel::saveToFile(const std::string& filename,
 
     LL_INFOS(LOG_INV) << "saving inventory to: (" << filename << ")" << LL_ENDL;
 
+    // Binary records skip the notation formatting on write and, more
+    // importantly, the notation parsing on the next login's load.
+    static LLCachedControl<bool> binary_cache(gSavedSettings, "InventoryBinaryCache", false);
+
     try
     {
-        llofstream fileXML(filename.c_str());
+        llofstream fileXML(filename.c_str(),
+                           binary_cache ? (std::ios::out | std::ios::binary) : std::ios::out);
         if (!fileXML.is_open())
         {
             LL_WARNS(LOG_INV) << "Failed to open file. Unable to save inventory to: " << filename << LL_ENDL;
@@ -3459,14 +3588,29 @@ bool LLInventoryModel::saveToFile(const std::string& filename,
             return false;
         }
 
-        fileXML << LLSDOStreamer<LLSDNotationFormatter>(cache_ver) << std::endl;
+        if (binary_cache)
+        {
+            fileXML << INV_CACHE_BINARY_HEADER << "\n";
+            LLSDSerialize::toBinary(cache_ver, fileXML);
+        }
+        else
+        {
+            fileXML << LLSDOStreamer<LLSDNotationFormatter>(cache_ver) << std::endl;
+        }
 
         S32 cat_count = 0;
         for (auto& cat : categories)
         {
             if (cat->getVersion() != LLViewerInventoryCategory::VERSION_UNKNOWN)
             {
-                fileXML << LLSDOStreamer<LLSDNotationFormatter>(cat->exportLLSD()) << std::endl;
+                if (binary_cache)
+                {
+                    LLSDSerialize::toBinary(cat->exportLLSD(), fileXML);
+                }
+                else
+                {
+                    fileXML << LLSDOStreamer<LLSDNotationFormatter>(cat->exportLLSD()) << std::endl;
+                }
                 cat_count++;
             }
 
@@ -3480,7 +3624,14 @@ bool LLInventoryModel::saveToFile(const std::string& filename,
         auto it_count = items.size();
         for (auto& item : items)
         {
-            fileXML << LLSDOStreamer<LLSDNotationFormatter>(item->asLLSD()) << std::endl;
+            if (binary_cache)
+            {
+                LLSDSerialize::toBinary(item->asLLSD(), fileXML);
+            }
+            else
+            {
+                fileXML << LLSDOStreamer<LLSDNotationFormatter>(item->asLLSD()) << std::endl;
+            }
 
             if (fileXML.fail())
             {
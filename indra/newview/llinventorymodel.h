@@ -35,6 +35,7 @@
 #include "llassettype.h"
 #include "llfoldertype.h"
 #include "llframetimer.h"
+#include "llinventorynameindex.h"
 #include "lluuid.h"
 #include "llpermissionsflags.h"
 #include "llviewerinventory.h"
@@ -212,6 +213,24 @@ private:
     parent_cat_map_t mParentChildCategoryTree;
     parent_item_map_t mParentChildItemTree;
 
+    // Trigram index over item names, used by LLInventoryFilter to skip
+    // the per-item substring scan. Built lazily on first query and kept
+    // in step with changes inside notifyObservers(); only maintained
+    // while the "InventoryNameIndex" setting is on.
+    LLInventoryNameIndex mNameIndex;
+    U32 mNameIndexGeneration;
+    void syncNameIndex();
+    void rebuildNameIndex();
+public:
+    // Fill candidates with a superset of the items whose name contains
+    // the (upper-cased) query. Returns false when the index is disabled
+    // or the query is too short; callers then fall back to scanning.
+    bool queryNameIndex(const std::string& query, uuid_set_t& candidates);
+    // bumped whenever the index contents change, so cached query results
+    // can be invalidated
+    U32 getNameIndexGeneration() const { return mNameIndexGeneration; }
+private:
+
     // Track links to items and categories. We do not store item or
     // category pointers here, because broken links are also supported.
     typedef std::multimap<LLUUID, LLUUID> backlink_mmap_t;
@@ -665,6 +684,14 @@ protected:
                              item_array_t& items,
                              changed_items_t& cats_to_update,
                              bool& is_cache_obsolete);
+    // Shared between the notation and binary cache readers: apply one
+    // record (version stamp, category or item) to the output arrays.
+    // Returns false when reading should stop.
+    static bool readCacheRecord(const LLSD& s_item,
+                                cat_array_t& categories,
+                                item_array_t& items,
+                                changed_items_t& cats_to_update,
+                                bool& is_cache_obsolete);
     static bool saveToFile(const std::string& filename,
                            const cat_array_t& categories,
                            const item_array_t& items);
@@ -197,7 +197,10 @@ LLInventoryModelBackgroundFetch::LLInventoryModelBackgroundFetch():
     mRecursiveInventoryFetchStarted(false),
     mRecursiveLibraryFetchStarted(false),
     mRecursiveMarketplaceFetchStarted(false),
-    mMinTimeBetweenFetches(0.3f)
+    mMinTimeBetweenFetches(0.3f),
+    mFetchLatencyAvg(0.0),
+    mFetchLatencyBest(0.0),
+    mAdaptiveFetchWindow(8)
 {}
 
 LLInventoryModelBackgroundFetch::~LLInventoryModelBackgroundFetch()
@@ -571,6 +574,33 @@ void LLInventoryModelBackgroundFetch::incrFetchFolderCount(S32 fetching)
     }
 }
 
+void LLInventoryModelBackgroundFetch::trackFetchLatency(F64 latency)
+{
+    if (mFetchLatencyAvg <= 0.0)
+    {
+        mFetchLatencyAvg = latency;
+        mFetchLatencyBest = latency;
+    }
+    else
+    {
+        mFetchLatencyAvg = mFetchLatencyAvg * 0.8 + latency * 0.2;
+        mFetchLatencyBest = llmin(mFetchLatencyBest, mFetchLatencyAvg);
+    }
+
+    if (mFetchLatencyAvg > mFetchLatencyBest * 2.0)
+    {
+        // round trips are taking twice as long as they did at best; the
+        // server or connection is saturated, back off quickly
+        mAdaptiveFetchWindow = llmax(mAdaptiveFetchWindow / 2, (U32)2);
+    }
+    else if (mFetchLatencyAvg < mFetchLatencyBest * 1.5)
+    {
+        // healthy latency; probe for more parallelism a request at a
+        // time (clamped against the AIS pool size at point of use)
+        mAdaptiveFetchWindow = llmin(mAdaptiveFetchWindow + 1, (U32)64);
+    }
+}
+
 void ais_simple_item_callback(const LLUUID& inv_id)
 {
     LL_DEBUGS(LOG_INV , "AIS3") << "Response for " << inv_id << LL_ENDL;
@@ -749,7 +779,15 @@ void LLInventoryModelBackgroundFetch::bulkFetchViaAis()
     static LLCachedControl<U32> ais_pool(gSavedSettings, "PoolSizeAIS", 20);
     // Don't have too many requests at once, AIS throttles
     // Reserve one request for actions outside of fetch (like renames)
-    const U32 max_concurrent_fetches = llclamp(ais_pool - 1, 1, 50);
+    U32 max_concurrent_fetches = llclamp(ais_pool - 1, 1, 50);
+
+    // Optionally size the in-flight window from observed latency instead
+    // of using the full pool unconditionally
+    static LLCachedControl<bool> ais_adaptive(gSavedSettings, "AISAdaptiveConcurrency", false);
+    if (ais_adaptive)
+    {
+        max_concurrent_fetches = llclamp(mAdaptiveFetchWindow, (U32)2, max_concurrent_fetches);
+    }
 
     if ((U32)mFetchCount >= max_concurrent_fetches)
     {
@@ -857,10 +895,12 @@ void LLInventoryModelBackgroundFetch::bulkFetchViaAis(const FetchQueueInfo& fetc
         {
             incrFetchFolderCount(1);
             mExpectedFolderIds.emplace_back(cat_id);
+            F64 request_start = LLTimer::getTotalSeconds();
             // Lost and found
             // Should it actually be recursive?
-            AISAPI::FetchOrphans([](const LLUUID& response_id)
+            AISAPI::FetchOrphans([request_start](const LLUUID& response_id)
                                  {
+                                     LLInventoryModelBackgroundFetch::instance().trackFetchLatency(LLTimer::getTotalSeconds() - request_start);
                                      LLInventoryModelBackgroundFetch::instance().onAISFolderCalback(LLUUID::null,
                                          response_id,
                                          FT_DEFAULT);
@@ -921,8 +961,10 @@ void LLInventoryModelBackgroundFetch::bulkFetchViaAis(const FetchQueueInfo& fetc
 
                         EFetchType type = fetch_info.mFetchType;
                         LLUUID cat_id = cat->getUUID(); // need a copy for lambda
-                        AISAPI::completion_t cb = [cat_id, children, type](const LLUUID& response_id)
+                        F64 request_start = LLTimer::getTotalSeconds();
+                        AISAPI::completion_t cb = [cat_id, children, type, request_start](const LLUUID& response_id)
                         {
+                            LLInventoryModelBackgroundFetch::instance().trackFetchLatency(LLTimer::getTotalSeconds() - request_start);
                             LLInventoryModelBackgroundFetch::instance().onAISContentCalback(cat_id, children, response_id, type);
                         };
 
@@ -975,8 +1017,10 @@ void LLInventoryModelBackgroundFetch::bulkFetchViaAis(const FetchQueueInfo& fetc
 
                         EFetchType type = fetch_info.mFetchType;
                         LLUUID cat_cb_id = cat_id;
-                        AISAPI::completion_t cb = [cat_cb_id, type](const LLUUID& response_id)
+                        F64 request_start = LLTimer::getTotalSeconds();
+                        AISAPI::completion_t cb = [cat_cb_id, type, request_start](const LLUUID& response_id)
                         {
+                            LLInventoryModelBackgroundFetch::instance().trackFetchLatency(LLTimer::getTotalSeconds() - request_start);
                             LLInventoryModelBackgroundFetch::instance().onAISFolderCalback(cat_cb_id, response_id , type);
                         };
 
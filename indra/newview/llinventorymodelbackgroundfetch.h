@@ -74,6 +74,9 @@ public:
     void findLostItems();
     void incrFetchCount(S32 fetching);
     void incrFetchFolderCount(S32 fetching);
+    // Feed an observed AIS request round-trip time into the adaptive
+    // in-flight window (AISAdaptiveConcurrency).
+    void trackFetchLatency(F64 latency);
 
     bool isBulkFetchProcessingComplete() const;
     void setAllFoldersFetched();
@@ -135,6 +138,11 @@ private:
 
     LLFrameTimer mFetchTimer;
     F32 mMinTimeBetweenFetches;
+    // adaptive AIS concurrency: smoothed request latency, best smoothed
+    // latency seen this session, and the current in-flight window
+    F64 mFetchLatencyAvg;
+    F64 mFetchLatencyBest;
+    U32 mAdaptiveFetchWindow;
     fetch_queue_t mFetchFolderQueue;
     fetch_queue_t mFetchItemQueue;
     uuid_set_t mForceFetchSet;
@@ -0,0 +1,156 @@
+/**
+ * @file llinventorynameindex.cpp
+ * @brief Trigram index over inventory item names for fast filtering
+ *
+ * $LicenseInfo:firstyear=2025&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2025, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "llviewerprecompiledheaders.h"
+
+#include "llinventorynameindex.h"
+
+#include <algorithm>
+
+#include "llstring.h"
+
+void LLInventoryNameIndex::clear()
+{
+    mPostings.clear();
+    mItemNames.clear();
+}
+
+// static
+void LLInventoryNameIndex::extractTrigrams(const std::string& upper_name, trigram_vec_t& trigrams)
+{
+    trigrams.clear();
+    if (upper_name.size() < 3)
+    {
+        return;
+    }
+    trigrams.reserve(upper_name.size() - 2);
+    for (size_t i = 0; i + 3 <= upper_name.size(); ++i)
+    {
+        trigram_t trigram = ((trigram_t)(U8)upper_name[i] << 16)
+                          | ((trigram_t)(U8)upper_name[i + 1] << 8)
+                          |  (trigram_t)(U8)upper_name[i + 2];
+        trigrams.push_back(trigram);
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+}
+
+void LLInventoryNameIndex::indexItem(const LLUUID& id, const std::string& name)
+{
+    std::string upper_name = name;
+    LLStringUtil::toUpper(upper_name);
+
+    std::map<LLUUID, std::string>::iterator found = mItemNames.find(id);
+    if (found != mItemNames.end())
+    {
+        if (found->second == upper_name)
+        {
+            return;
+        }
+        removeItem(id);
+    }
+
+    trigram_vec_t trigrams;
+    extractTrigrams(upper_name, trigrams);
+    for (trigram_t trigram : trigrams)
+    {
+        mPostings[trigram].insert(id);
+    }
+    mItemNames[id] = upper_name;
+}
+
+void LLInventoryNameIndex::removeItem(const LLUUID& id)
+{
+    std::map<LLUUID, std::string>::iterator found = mItemNames.find(id);
+    if (found == mItemNames.end())
+    {
+        return;
+    }
+
+    trigram_vec_t trigrams;
+    extractTrigrams(found->second, trigrams);
+    for (trigram_t trigram : trigrams)
+    {
+        std::map<trigram_t, uuid_set_t>::iterator posting = mPostings.find(trigram);
+        if (posting != mPostings.end())
+        {
+            posting->second.erase(id);
+            if (posting->second.empty())
+            {
+                mPostings.erase(posting);
+            }
+        }
+    }
+    mItemNames.erase(found);
+}
+
+bool LLInventoryNameIndex::query(const std::string& query, uuid_set_t& candidates) const
+{
+    candidates.clear();
+
+    trigram_vec_t trigrams;
+    extractTrigrams(query, trigrams);
+    if (trigrams.empty())
+    {
+        // query shorter than one trigram; can't be answered from the index
+        return false;
+    }
+
+    // gather the posting sets; if any trigram is absent no name can match
+    std::vector<const uuid_set_t*> postings;
+    postings.reserve(trigrams.size());
+    for (trigram_t trigram : trigrams)
+    {
+        std::map<trigram_t, uuid_set_t>::const_iterator posting = mPostings.find(trigram);
+        if (posting == mPostings.end())
+        {
+            return true;
+        }
+        postings.push_back(&posting->second);
+    }
+
+    // intersect starting from the rarest trigram
+    std::sort(postings.begin(), postings.end(),
+              [](const uuid_set_t* a, const uuid_set_t* b) { return a->size() < b->size(); });
+
+    for (const LLUUID& id : *postings[0])
+    {
+        bool in_all = true;
+        for (size_t i = 1; i < postings.size(); ++i)
+        {
+            if (postings[i]->find(id) == postings[i]->end())
+            {
+                in_all = false;
+                break;
+            }
+        }
+        if (in_all)
+        {
+            candidates.insert(id);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file llinventorynameindex.h
+ * @brief Trigram index over inventory item names for fast filtering
+ *
+ * $LicenseInfo:firstyear=2025&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2025, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLINVENTORYNAMEINDEX_H
+#define LL_LLINVENTORYNAMEINDEX_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "lluuid.h"
+
+// Maps every trigram (three consecutive bytes) of each indexed item name
+// to the set of items whose name contains it.  A substring query of three
+// or more bytes can then be answered by intersecting the posting sets of
+// the query's trigrams, yielding a small superset of the items whose name
+// contains the query without touching the other ~100k names.  Callers
+// verify candidates with a real substring check; anything outside the
+// candidate set is guaranteed not to match.
+//
+// Names are upper-cased before indexing to match the searchable-name
+// convention used by LLInventoryFilter; queries are expected to be
+// upper-cased already (LLInventoryFilter::setFilterSubString does this).
+class LLInventoryNameIndex
+{
+public:
+    void clear();
+    bool isEmpty() const { return mItemNames.empty(); }
+
+    // Add an item, or re-index it if its name changed.
+    void indexItem(const LLUUID& id, const std::string& name);
+    void removeItem(const LLUUID& id);
+
+    // Fill candidates with every indexed item whose name contains all of
+    // the query's trigrams (a superset of true substring matches).
+    // Returns false when the query is too short (fewer than three bytes)
+    // to be answered; the caller should fall back to a linear scan.
+    bool query(const std::string& query, uuid_set_t& candidates) const;
+
+private:
+    typedef U32 trigram_t;
+    typedef std::vector<trigram_t> trigram_vec_t;
+
+    static void extractTrigrams(const std::string& upper_name, trigram_vec_t& trigrams);
+
+    std::map<trigram_t, uuid_set_t> mPostings;
+    // name each item is currently indexed under (upper-cased)
+    std::map<LLUUID, std::string> mItemNames;
+};
+
+#endif // LL_LLINVENTORYNAMEINDEX_H
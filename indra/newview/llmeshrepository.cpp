@@ -80,8 +80,6 @@
 #include "llvoavatarself.h"
 #include "llskinningutil.h"
 
-#include "boost/iostreams/device/array.hpp"
-#include "boost/iostreams/stream.hpp"
 #include "boost/lexical_cast.hpp"
 
 #ifndef LL_WINDOWS
@@ -642,9 +640,32 @@ class LLMeshLODHandler : public LLMeshHandlerBase
 {
 public:
     LOG_CLASS(LLMeshLODHandler);
+
+    // One entry per LOD served out of this handler's byte range.  A
+    // handler usually covers a single LOD but may cover several when
+    // the fetcher coalesces adjacent ranges of the same asset into
+    // one request (see LLMeshRepoThread::fetchMeshLOD).
+    struct LODRange
+    {
+        S32 mLOD;
+        U32 mOffset;            // absolute offset within the mesh asset
+        U32 mSize;
+    };
+    typedef std::vector<LODRange> lod_range_list_t;
+
     LLMeshLODHandler(const LLVolumeParams & mesh_params, S32 lod, U32 offset, U32 requested_bytes)
+        : LLMeshHandlerBase(offset, requested_bytes)
+    {
+            mMeshParams = mesh_params;
+            mLODs.push_back(LODRange{ lod, offset, requested_bytes });
+            LLMeshRepoThread::incActiveLODRequests();
+        }
+
+    // Coalesced fetch; every range must fall within
+    // [offset, offset + requested_bytes).
+    LLMeshLODHandler(const LLVolumeParams & mesh_params, const lod_range_list_t& lods, U32 offset, U32 requested_bytes)
         : LLMeshHandlerBase(offset, requested_bytes),
-          mLOD(lod)
+          mLODs(lods)
     {
             mMeshParams = mesh_params;
             LLMeshRepoThread::incActiveLODRequests();
@@ -655,12 +676,14 @@ protected:
     LLMeshLODHandler(const LLMeshLODHandler &);                 // Not defined
     void operator=(const LLMeshLODHandler &);                   // Not defined
 
+    void processLOD(const LODRange& range, U8* data, S32 data_size);
+
 public:
     virtual void processData(LLCore::BufferArray * body, S32 body_offset, U8 * data, S32 data_size);
     virtual void processFailure(LLCore::HttpStatus status);
 
 public:
-    S32 mLOD;
+    lod_range_list_t mLODs;
 };
 
 
@@ -1791,6 +1814,16 @@ bool LLMeshRepoThread::fetchMeshLOD(const LLVolumeParams& mesh_params, S32 lod,
         S32 version = header.mVersion;
         S32 offset = header_size + header.mLodOffset[lod];
         S32 size = header.mLodSize[lod];
+
+        // snapshot every LOD range while the header is locked, for the
+        // range coalescing below
+        S32 lod_offsets[LLVolumeLODGroup::NUM_LODS];
+        S32 lod_sizes[LLVolumeLODGroup::NUM_LODS];
+        for (S32 i = 0; i < LLVolumeLODGroup::NUM_LODS; ++i)
+        {
+            lod_offsets[i] = header.mLodOffset[i];
+            lod_sizes[i] = header.mLodSize[i];
+        }
         mHeaderMutex->unlock();
 
         if (version <= MAX_MESH_VERSION && offset >= 0 && size > 0)
@@ -1851,26 +1884,102 @@ bool LLMeshRepoThread::fetchMeshLOD(const LLVolumeParams& mesh_params, S32 lod,
             {
                 LL_DEBUGS(LOG_MESH) << "Mesh/Cache: Mesh body for ID " << mesh_id << " - was retrieved from the simulator." << LL_ENDL;
 
-                LLMeshHandlerBase::ptr_t handler(new LLMeshLODHandler(mesh_params, lod, offset, size));
-                LLCore::HttpHandle handle = getByteRange(http_url, offset, size, handler);
-                if (LLCORE_HTTP_HANDLE_INVALID == handle)
-                {
-                    LL_WARNS(LOG_MESH) << "HTTP GET request failed for LOD on mesh " << mID
-                                       << ".  Reason:  " << mHttpStatus.toString()
-                                       << " (" << mHttpStatus.toTerseString() << ")"
-                                       << LL_ENDL;
-                    retval = false;
-                }
-                else if (can_retry)
+                LLMeshLODHandler::lod_range_list_t lods;
+                lods.push_back(LLMeshLODHandler::LODRange{ lod, (U32)offset, (U32)size });
+
+                static LLCachedControl<bool> coalesce(gSavedSettings, "MeshCoalescedRangeRequests", false);
+                if (coalesce)
                 {
-                    handler->mHttpHandle = handle;
-                    mHttpRequestSet.insert(handler);
-                    // *NOTE:  Allowing a re-request, not marking as unavailable.  Is that correct?
+                    // When a header arrives, requests for every pending LOD
+                    // of that mesh are queued back-to-back, so siblings with
+                    // nearby byte ranges in the same asset are sitting at
+                    // the front of mLODReqQ right now.  Pull them into this
+                    // fetch rather than firing one small GET per LOD.
+                    LLMutexLock lock(mMutex);
+                    while (!mLODReqQ.empty()
+                           && mLODReqQ.front().mMeshParams.getSculptID() == mesh_id)
+                    {
+                        const LODRequest& sibling = mLODReqQ.front();
+                        S32 s_lod = sibling.mLOD;
+                        if (sibling.isDelayed()
+                            || s_lod < 0 || s_lod >= LLVolumeLODGroup::NUM_LODS)
+                        {
+                            // leave retry-delayed requests on the queue for
+                            // the normal path
+                            break;
+                        }
+                        S32 s_offset = header_size + lod_offsets[s_lod];
+                        S32 s_size = lod_sizes[s_lod];
+                        if (lod_offsets[s_lod] < 0 || s_size <= 0
+                            || file.getSize() >= s_offset + s_size)
+                        {
+                            // same for invalid ranges and cache hits
+                            break;
+                        }
+                        lods.push_back(LLMeshLODHandler::LODRange{ s_lod, (U32)s_offset, (U32)s_size });
+                        mLODReqQ.pop();
+                        LLMeshRepository::sLODProcessing--;
+                    }
                 }
-                else
+
+                // merge the ranges into contiguous spans, tolerating small
+                // gaps, and issue one request per span
+                std::sort(lods.begin(), lods.end(),
+                          [](const LLMeshLODHandler::LODRange& lhs, const LLMeshLODHandler::LODRange& rhs)
+                          { return lhs.mOffset < rhs.mOffset; });
+
+                constexpr U32 MESH_RANGE_MERGE_GAP = 4096;
+                size_t first = 0;
+                while (first < lods.size())
                 {
-                    LLMutexLock lock(mMutex);
-                    mUnavailableQ.push_back(LODRequest(mesh_params, lod));
+                    U32 span_offset = lods[first].mOffset;
+                    U32 span_end = span_offset + lods[first].mSize;
+                    size_t last = first + 1;
+                    while (last < lods.size()
+                           && lods[last].mOffset <= span_end + MESH_RANGE_MERGE_GAP)
+                    {
+                        span_end = llmax(span_end, lods[last].mOffset + lods[last].mSize);
+                        ++last;
+                    }
+
+                    LLMeshLODHandler::lod_range_list_t span_lods(lods.begin() + first, lods.begin() + last);
+                    bool has_requested_lod = false;
+                    for (const LLMeshLODHandler::LODRange& range : span_lods)
+                    {
+                        has_requested_lod |= (range.mLOD == lod);
+                    }
+
+                    LLMeshHandlerBase::ptr_t handler(new LLMeshLODHandler(mesh_params, span_lods, span_offset, span_end - span_offset));
+                    LLCore::HttpHandle handle = getByteRange(http_url, span_offset, span_end - span_offset, handler);
+                    if (LLCORE_HTTP_HANDLE_INVALID == handle)
+                    {
+                        LL_WARNS(LOG_MESH) << "HTTP GET request failed for LOD on mesh " << mID
+                                           << ".  Reason:  " << mHttpStatus.toString()
+                                           << " (" << mHttpStatus.toTerseString() << ")"
+                                           << LL_ENDL;
+                        if (has_requested_lod)
+                        {
+                            retval = false;
+                        }
+                        // coalesced siblings are re-queued by the handler
+                        // destructor
+                    }
+                    else if (can_retry || !has_requested_lod)
+                    {
+                        handler->mHttpHandle = handle;
+                        mHttpRequestSet.insert(handler);
+                        // *NOTE:  Allowing a re-request, not marking as unavailable.  Is that correct?
+                    }
+                    else
+                    {
+                        LLMutexLock lock(mMutex);
+                        for (const LLMeshLODHandler::LODRange& range : span_lods)
+                        {
+                            mUnavailableQ.push_back(LODRequest(mesh_params, range.mLOD));
+                        }
+                    }
+
+                    first = last;
                 }
             }
             else
@@ -1908,9 +2017,8 @@ EMeshProcessingResult LLMeshRepoThread::headerReceived(const LLVolumeParams& mes
 
         data_size = (S32)dsize;
 
-        boost::iostreams::stream<boost::iostreams::array_source> stream(result_ptr, data_size);
-
-        if (!LLSDSerialize::fromBinary(header_data, stream, data_size))
+        llssize bytes_read = 0;
+        if (!LLSDSerialize::fromBinaryBuffer(header_data, (const U8*)result_ptr, (size_t)data_size, -1, &bytes_read))
         {
             LL_WARNS(LOG_MESH) << "Mesh header parse error.  Not a valid mesh asset!  ID:  " << mesh_id
                                << LL_ENDL;
@@ -1933,7 +2041,7 @@ EMeshProcessingResult LLMeshRepoThread::headerReceived(const LLVolumeParams& mes
         // make sure there is at least one lod, function returns -1 and marks as 404 otherwise
         else if (LLMeshRepository::getActualMeshLOD(header, 0) >= 0)
         {
-            header_size += stream.tellg();
+            header_size += bytes_read;
         }
     }
     else
@@ -2024,6 +2132,104 @@ EMeshProcessingResult LLMeshRepoThread::lodReceived(const LLVolumeParams& mesh_p
     return MESH_UNKNOWN;
 }
 
+bool LLMeshRepoThread::lodReceivedAsync(const LLVolumeParams& mesh_params, S32 lod, const U8* data, S32 data_size, S32 cache_offset)
+{
+    if (data == NULL || data_size == 0)
+    {
+        return false;
+    }
+
+    LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+    if (!general_queue)
+    {
+        return false;
+    }
+
+    // own a copy of the payload; the caller's buffer belongs to the HTTP
+    // response and is released when onCompleted() returns
+    U8* buffer = new(std::nothrow) U8[data_size];
+    if (!buffer)
+    {
+        return false;
+    }
+    memcpy(buffer, data, data_size);
+
+    bool posted = mWorkQueue.postTo(
+        general_queue,
+        [mesh_params, lod, buffer, data_size]() // unzip/parse on the general pool
+        {
+            LL_PROFILE_ZONE_NAMED("meshlod async unpack");
+            LLVolume* volume = new LLVolume(mesh_params, LLVolumeLODGroup::getVolumeScaleFromDetail(lod));
+            // keep refcounting single-threaded:  this raw pointer is the only
+            // reference until the completion lambda takes over on the repo thread
+            volume->ref();
+            if (!volume->unpackVolumeFaces(buffer, data_size)
+                || volume->getNumFaces() <= 0)
+            {
+                volume->unref();
+                volume = NULL;
+            }
+            return volume;
+        },
+        [this, mesh_params, lod, buffer, data_size, cache_offset](LLVolume* volume) // handoff back on the repo thread
+        {
+            if (volume)
+            {
+                // if we have a valid SkinInfo, cache per-joint bounding boxes for this LOD;
+                // mSkinMap is only touched on the repo thread, so this stays here
+                LLMeshSkinInfo* skin_info = mSkinMap[mesh_params.getSculptID()];
+                if (skin_info && isAgentAvatarValid())
+                {
+                    for (S32 i = 0; i < volume->getNumFaces(); ++i)
+                    {
+                        LLVolumeFace& face = volume->getVolumeFace(i);
+                        LLSkinningUtil::updateRiggingInfo(skin_info, gAgentAvatarp, face);
+                    }
+                }
+
+                LoadedMesh mesh(volume, mesh_params, lod);
+                {
+                    LLMutexLock lock(mMutex);
+                    mLoadedQ.push_back(mesh);
+                    // LLPointer is not thread safe, drop every reference we
+                    // hold inside the mutex lock so the main thread can't
+                    // race the refcount while draining mLoadedQ
+                    mesh.mVolume = NULL;
+                    volume->unref();
+                    volume = NULL;
+                }
+
+                // good fetch from sim, write to cache
+                LLFileSystem file(mesh_params.getSculptID(), LLAssetType::AT_MESH, LLFileSystem::READ_WRITE);
+                if (file.getSize() >= cache_offset + data_size)
+                {
+                    file.seek(cache_offset);
+                    file.write(buffer, data_size);
+                    LLMeshRepository::sCacheBytesWritten += data_size;
+                    ++LLMeshRepository::sCacheWrites;
+                }
+            }
+            else
+            {
+                LL_WARNS(LOG_MESH) << "Error during mesh LOD processing.  ID:  " << mesh_params.getSculptID()
+                                   << ", Reason: " << MESH_UNKNOWN
+                                   << " LOD: " << lod
+                                   << " Data size: " << data_size
+                                   << " Not retrying."
+                                   << LL_ENDL;
+                LLMutexLock lock(mMutex);
+                mUnavailableQ.push_back(LODRequest(mesh_params, lod));
+            }
+            delete[] buffer;
+        });
+
+    if (!posted)
+    {
+        delete[] buffer;
+    }
+    return posted;
+}
+
 bool LLMeshRepoThread::skinInfoReceived(const LLUUID& mesh_id, U8* data, S32 data_size)
 {
     LLSD skin;
@@ -2052,6 +2258,20 @@ bool LLMeshRepoThread::skinInfoReceived(const LLUUID& mesh_id, U8* data, S32 dat
         LLPointer<LLMeshSkinInfo> info = nullptr;
         info = new LLMeshSkinInfo(mesh_id, skin);
 
+        // identical rigs are common across distinct mesh assets (re-uploads
+        // of popular bodies and heads); share one immutable instance per
+        // content hash so crowds wearing them pay for it once
+        skin_hash_map::iterator dup = mSkinHashMap.find(info->mHash);
+        if (dup != mSkinHashMap.end() &&
+            dup->second->mJointNames == info->mJointNames) // hash collision guard
+        {
+            info = dup->second;
+        }
+        else
+        {
+            mSkinHashMap[info->mHash] = info;
+        }
+
         if (isAgentAvatarValid())
         { // joint numbers are consistent inside LLVOAvatar and animations, but inconsistent inside meshes,
             // generate a map of mesh joint numbers to LLVOAvatar joint numbers
@@ -2064,7 +2284,7 @@ bool LLMeshRepoThread::skinInfoReceived(const LLUUID& mesh_id, U8* data, S32 dat
 
         {
             LLMutexLock lock(mMutex);
-            mSkinInfoQ.push_back(info);
+            mSkinInfoQ.push_back(std::make_pair(mesh_id, info));
         }
     }
 
@@ -2993,7 +3213,7 @@ void LLMeshRepoThread::notifyLoadedMeshes()
     {
         if (mMutex->trylock())
         {
-            std::deque<LLPointer<LLMeshSkinInfo>> skin_info_q;
+            std::deque<LLMeshRepoThread::skin_info_pair> skin_info_q;
             std::deque<UUIDBasedRequest> skin_info_unavail_q;
             std::list<LLModel::Decomposition*> decomp_q;
 
@@ -3017,7 +3237,7 @@ void LLMeshRepoThread::notifyLoadedMeshes()
             // Process the elements free of the lock
             while (! skin_info_q.empty())
             {
-                gMeshRepo.notifySkinInfoReceived(skin_info_q.front());
+                gMeshRepo.notifySkinInfoReceived(skin_info_q.front().first, skin_info_q.front().second);
                 skin_info_q.pop_front();
             }
             while (! skin_info_unavail_q.empty())
@@ -3146,6 +3366,7 @@ void LLMeshHandlerBase::onCompleted(LLCore::HttpHandle handle, LLCore::HttpRespo
         LLCore::BufferArray * body(response->getBody());
         S32 body_offset(0);
         U8 * data(NULL);
+        bool data_borrowed(false);  // points into 'body' rather than owned
         auto data_size(body ? body->size() : 0);
 
         if (data_size > 0)
@@ -3198,27 +3419,41 @@ void LLMeshHandlerBase::onCompleted(LLCore::HttpHandle handle, LLCore::HttpRespo
                 goto common_exit;
             }
 
-            // *TODO: Try to get rid of data copying and add interfaces
-            // that support BufferArray directly.  Introduce a two-phase
-            // handler, optional first that takes a body, fallback second
-            // that requires a temporary allocation and data copy.
             body_offset = mOffset - offset;
-            data = new(std::nothrow) U8[data_size - body_offset];
-            if (data)
+
+            // Borrow the response body in place when it occupies one
+            // contiguous block -- the usual case now that the HTTP write
+            // path presizes the reply from Content-Length.  Fall back to
+            // flattening a multi-block body with a copy.
+            const char * contig(body->contiguousData());
+            if (contig)
             {
-                body->read(body_offset, (char *) data, data_size - body_offset);
+                data = (U8 *) contig + body_offset;
+                data_borrowed = true;
                 LLMeshRepository::sBytesReceived += static_cast<U32>(data_size);
             }
             else
             {
-                LL_WARNS(LOG_MESH) << "Failed to allocate " << data_size - body_offset << " memory for mesh response" << LL_ENDL;
-                processFailure(LLCore::HttpStatus(LLCore::HttpStatus::LLCORE, LLCore::HE_BAD_ALLOC));
+                data = new(std::nothrow) U8[data_size - body_offset];
+                if (data)
+                {
+                    body->read(body_offset, (char *) data, data_size - body_offset);
+                    LLMeshRepository::sBytesReceived += static_cast<U32>(data_size);
+                }
+                else
+                {
+                    LL_WARNS(LOG_MESH) << "Failed to allocate " << data_size - body_offset << " memory for mesh response" << LL_ENDL;
+                    processFailure(LLCore::HttpStatus(LLCore::HttpStatus::LLCORE, LLCore::HE_BAD_ALLOC));
+                }
             }
         }
 
         processData(body, body_offset, data, static_cast<S32>(data_size) - body_offset);
 
-        delete [] data;
+        if (! data_borrowed)
+        {
+            delete [] data;
+        }
     }
 
     // Release handler
@@ -3373,7 +3608,10 @@ LLMeshLODHandler::~LLMeshLODHandler()
         if (! mProcessed)
         {
             LL_WARNS(LOG_MESH) << "Mesh LOD fetch canceled unexpectedly, retrying." << LL_ENDL;
-            gMeshRepo.mThread->lockAndLoadMeshLOD(mMeshParams, mLOD);
+            for (const LODRange& range : mLODs)
+            {
+                gMeshRepo.mThread->lockAndLoadMeshLOD(mMeshParams, range.mLOD);
+            }
         }
         LLMeshRepoThread::decActiveLODRequests();
     }
@@ -3387,7 +3625,51 @@ void LLMeshLODHandler::processFailure(LLCore::HttpStatus status)
                        << LL_ENDL;
 
     LLMutexLock lock(gMeshRepo.mThread->mMutex);
-    gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, mLOD));
+    for (const LODRange& range : mLODs)
+    {
+        gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, range.mLOD));
+    }
+}
+
+void LLMeshLODHandler::processLOD(const LODRange& range, U8* data, S32 data_size)
+{
+    static LLCachedControl<bool> parallel_deserialize(gSavedSettings, "MeshParallelDeserialize", false);
+    if (parallel_deserialize
+        && gMeshRepo.mThread->lodReceivedAsync(mMeshParams, range.mLOD, data, data_size, range.mOffset))
+    {
+        // volume face population runs on the general thread pool; the
+        // cache write and mLoadedQ handoff follow on the repo thread
+        return;
+    }
+
+    EMeshProcessingResult result = gMeshRepo.mThread->lodReceived(mMeshParams, range.mLOD, data, data_size);
+    if (result == MESH_OK)
+    {
+        // good fetch from sim, write to cache
+        LLFileSystem file(mMeshParams.getSculptID(), LLAssetType::AT_MESH, LLFileSystem::READ_WRITE);
+
+        S32 offset = range.mOffset;
+        S32 size = range.mSize;
+
+        if (file.getSize() >= offset+size)
+        {
+            file.seek(offset);
+            file.write(data, size);
+            LLMeshRepository::sCacheBytesWritten += size;
+            ++LLMeshRepository::sCacheWrites;
+        }
+    }
+    else
+    {
+        LL_WARNS(LOG_MESH) << "Error during mesh LOD processing.  ID:  " << mMeshParams.getSculptID()
+                           << ", Reason: " << result
+                           << " LOD: " << range.mLOD
+                           << " Data size: " << data_size
+                           << " Not retrying."
+                           << LL_ENDL;
+        LLMutexLock lock(gMeshRepo.mThread->mMutex);
+        gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, range.mLOD));
+    }
 }
 
 void LLMeshLODHandler::processData(LLCore::BufferArray * /* body */, S32 /* body_offset */,
@@ -3397,44 +3679,36 @@ void LLMeshLODHandler::processData(LLCore::BufferArray * /* body */, S32 /* body
     if ((!MESH_LOD_PROCESS_FAILED)
         && ((data != NULL) == (data_size > 0))) // if we have data but no size or have size but no data, something is wrong
     {
-        EMeshProcessingResult result = gMeshRepo.mThread->lodReceived(mMeshParams, mLOD, data, data_size);
-        if (result == MESH_OK)
+        for (const LODRange& range : mLODs)
         {
-            // good fetch from sim, write to cache
-            LLFileSystem file(mMeshParams.getSculptID(), LLAssetType::AT_MESH, LLFileSystem::READ_WRITE);
-
-            S32 offset = mOffset;
-            S32 size = mRequestedBytes;
-
-            if (file.getSize() >= offset+size)
+            // slice this LOD's bytes out of the (possibly coalesced) response
+            S32 rel_offset = (S32)(range.mOffset - mOffset);
+            if (rel_offset + (S32)range.mSize > data_size)
             {
-                file.seek(offset);
-                file.write(data, size);
-                LLMeshRepository::sCacheBytesWritten += size;
-                ++LLMeshRepository::sCacheWrites;
+                LL_WARNS(LOG_MESH) << "Mesh LOD response too short for requested range.  ID:  "
+                                   << mMeshParams.getSculptID()
+                                   << " LOD: " << range.mLOD
+                                   << " Data size: " << data_size
+                                   << " Not retrying."
+                                   << LL_ENDL;
+                LLMutexLock lock(gMeshRepo.mThread->mMutex);
+                gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, range.mLOD));
+                continue;
             }
-        }
-        else
-        {
-            LL_WARNS(LOG_MESH) << "Error during mesh LOD processing.  ID:  " << mMeshParams.getSculptID()
-                               << ", Reason: " << result
-                               << " LOD: " << mLOD
-                               << " Data size: " << data_size
-                               << " Not retrying."
-                               << LL_ENDL;
-            LLMutexLock lock(gMeshRepo.mThread->mMutex);
-            gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, mLOD));
+            processLOD(range, data + rel_offset, range.mSize);
         }
     }
     else
     {
         LL_WARNS(LOG_MESH) << "Error during mesh LOD processing.  ID:  " << mMeshParams.getSculptID()
                            << ", Unknown reason.  Not retrying."
-                           << " LOD: " << mLOD
                            << " Data size: " << data_size
                            << LL_ENDL;
         LLMutexLock lock(gMeshRepo.mThread->mMutex);
-        gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, mLOD));
+        for (const LODRange& range : mLODs)
+        {
+            gMeshRepo.mThread->mUnavailableQ.push_back(LLMeshRepoThread::LODRequest(mMeshParams, range.mLOD));
+        }
     }
 }
 
@@ -3962,6 +4236,19 @@ void LLMeshRepository::notifyLoadedMeshes()
                     mThread->mSkinMap.erase(id);
                 });
         }
+
+        // drop content-hash dedup entries nothing references anymore
+        mThread->mWorkQueue.post([=]()
+            {
+                for (auto iter = mThread->mSkinHashMap.begin(), ender = mThread->mSkinHashMap.end(); iter != ender;)
+                {
+                    auto copy_iter = iter++;
+                    if (copy_iter->second->getNumRefs() == 1)
+                    {
+                        mThread->mSkinHashMap.erase(copy_iter);
+                    }
+                }
+            });
         //LL_INFOS() << "Skin info cache elements:" << mSkinMap.size() << " Memory: " << U64Kilobytes(skinbytes) << LL_ENDL;
     }
 
@@ -4101,20 +4388,24 @@ void LLMeshRepository::notifyLoadedMeshes()
     mThread->mSignal->signal();
 }
 
-void LLMeshRepository::notifySkinInfoReceived(LLMeshSkinInfo* info)
+void LLMeshRepository::notifySkinInfoReceived(const LLUUID& mesh_id, LLMeshSkinInfo* info)
 {
-    mSkinMap[info->mMeshID] = info; // Cache into LLPointer
-    // Alternative: We can get skin size from header
-    sCacheBytesSkins += info->sizeBytes();
+    mSkinMap[mesh_id] = info; // Cache into LLPointer
+    if (info->mMeshID == mesh_id)
+    { // instances shared across mesh ids are only accounted once,
+      // against the mesh they were first parsed for
+        // Alternative: We can get skin size from header
+        sCacheBytesSkins += info->sizeBytes();
+    }
 
-    skin_load_map::iterator iter = mLoadingSkins.find(info->mMeshID);
+    skin_load_map::iterator iter = mLoadingSkins.find(mesh_id);
     if (iter != mLoadingSkins.end())
     {
         for (LLVOVolume* vobj : iter->second)
         {
             if (vobj)
             {
-                vobj->notifySkinInfoLoaded(info);
+                vobj->notifySkinInfoLoaded(mesh_id, info);
             }
         }
         mLoadingSkins.erase(iter);
@@ -341,8 +341,11 @@ public:
     //set of requested skin info
     std::deque<UUIDBasedRequest> mSkinRequests;
 
-    // list of completed skin info requests
-    std::deque<LLPointer<LLMeshSkinInfo>> mSkinInfoQ;
+    // list of completed skin info requests, paired with the mesh id each
+    // was requested for -- identical skins are shared across mesh ids, so
+    // the instance's mMeshID is not authoritative
+    typedef std::pair<LLUUID, LLPointer<LLMeshSkinInfo>> skin_info_pair;
+    std::deque<skin_info_pair> mSkinInfoQ;
 
     // list of skin info requests that have failed or are unavailaibe
     std::deque<UUIDBasedRequest> mSkinUnavailableQ;
@@ -377,6 +380,12 @@ public:
     typedef std::unordered_map<LLUUID, LLPointer<LLMeshSkinInfo>> skin_map;
     skin_map mSkinMap;
 
+    // skin info deduplicated by content hash -- re-uploads of popular
+    // rigged assets carry identical rigs under distinct mesh ids, and
+    // crowds wearing them should pay for one instance, not dozens
+    typedef std::unordered_map<U64, LLPointer<LLMeshSkinInfo>> skin_hash_map;
+    skin_hash_map mSkinHashMap;
+
     // workqueue for processing generic requests
     LL::WorkQueue mWorkQueue;
 
@@ -406,6 +415,13 @@ public:
     bool fetchMeshLOD(const LLVolumeParams& mesh_params, S32 lod, bool can_retry = true);
     EMeshProcessingResult headerReceived(const LLVolumeParams& mesh_params, U8* data, S32 data_size);
     EMeshProcessingResult lodReceived(const LLVolumeParams& mesh_params, S32 lod, U8* data, S32 data_size);
+    // Hand a fetched LOD payload to the general thread pool for
+    // deserialization.  Copies the payload; face population runs
+    // off-thread while the skin lookup, cache write and queue handoff
+    // are marshalled back to this thread via mWorkQueue.  Returns false
+    // when the pool is unavailable and the caller should fall back to
+    // the synchronous lodReceived() path.
+    bool lodReceivedAsync(const LLVolumeParams& mesh_params, S32 lod, const U8* data, S32 data_size, S32 cache_offset);
     bool skinInfoReceived(const LLUUID& mesh_id, U8* data, S32 data_size);
     bool decompositionReceived(const LLUUID& mesh_id, U8* data, S32 data_size);
     EMeshProcessingResult physicsShapeReceived(const LLUUID& mesh_id, U8* data, S32 data_size);
@@ -653,7 +669,7 @@ public:
     void notifyLoadedMeshes();
     void notifyMeshLoaded(const LLVolumeParams& mesh_params, LLVolume* volume);
     void notifyMeshUnavailable(const LLVolumeParams& mesh_params, S32 lod);
-    void notifySkinInfoReceived(LLMeshSkinInfo* info);
+    void notifySkinInfoReceived(const LLUUID& mesh_id, LLMeshSkinInfo* info);
     void notifySkinInfoUnavailable(const LLUUID& info);
     void notifyDecompositionReceived(LLModel::Decomposition* info);
 
@@ -60,6 +60,7 @@
 #include "llviewertexturelist.h"
 #include "llvoavatar.h"
 #include "pipeline.h"
+#include "workqueue.h"
 
 // ui controls (from floater)
 #include "llbutton.h"
@@ -183,6 +184,7 @@ LLModelPreview::LLModelPreview(S32 width, S32 height, LLFloater* fmp)
     mLoadState = LLModelLoader::STARTING;
     mGroup = 0;
     mLODFrozen = false;
+    mLodsGenerating = 0;
 
     for (U32 i = 0; i < LLModel::NUM_LODS; ++i)
     {
@@ -206,6 +208,8 @@ LLModelPreview::~LLModelPreview()
 {
     LLMutexLock lock(this);
 
+    cancelLodBuilds();
+
     if (mModelLoader)
     {
         mModelLoader->shutdown();
@@ -984,6 +988,7 @@ void LLModelPreview::loadModelCallback(S32 loaded_lod)
 
     if (loaded_lod == -1)
     { //populate all LoDs from model loader scene
+        cancelLodBuilds(); // in-flight lod builds target the old base models
         mBaseModel.clear();
         mBaseScene.clear();
 
@@ -1306,6 +1311,8 @@ void LLModelPreview::generateNormals()
             }
         }
 
+        cancelLodBuilds(); // in-flight lod builds snapshot the old normals
+
         for (LLModelLoader::model_list::iterator it = mBaseModel.begin(), itE = mBaseModel.end(); it != itE; ++it)
         {
             (*it)->generateNormals(angle_cutoff);
@@ -1350,6 +1357,8 @@ void LLModelPreview::restoreNormals()
     {
         llassert(mBaseModelFacesCopy.size() == mBaseModel.size());
 
+        cancelLodBuilds(); // in-flight lod builds snapshot the edited normals
+
         vv_LLVolumeFace_t::const_iterator itF = mBaseModelFacesCopy.begin();
         for (LLModelLoader::model_list::iterator it = mBaseModel.begin(), itE = mBaseModel.end(); it != itE; ++it, ++itF)
         {
@@ -1891,6 +1900,9 @@ void LLModelPreview::genMeshOptimizerLODs(S32 which_lod, S32 meshopt_mode, U32 d
         end = which_lod;
     }
 
+    LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+    LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+
     for (S32 lod = start; lod >= end; --lod)
     {
         if (which_lod == -1)
@@ -1907,224 +1919,310 @@ void LLModelPreview::genMeshOptimizerLODs(S32 which_lod, S32 meshopt_mode, U32 d
         mRequestedErrorThreshold[lod] = lod_error_threshold * 100;
         mRequestedLoDMode[lod] = lod_mode;
 
-        mModel[lod].clear();
-        mModel[lod].resize(mBaseModel.size());
-        mVertexBuffer[lod].clear();
-
-
+        // snapshot base models so the worker never reads data the main
+        // thread can mutate; simplification runs against the copies and
+        // the results are swapped in when the job completes
+        LLModelLoader::model_list base_models;
+        base_models.reserve(mBaseModel.size());
         for (U32 mdl_idx = 0; mdl_idx < mBaseModel.size(); ++mdl_idx)
         {
             LLModel* base = mBaseModel[mdl_idx];
 
             LLVolumeParams volume_params;
             volume_params.setType(LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE);
-            mModel[lod][mdl_idx] = new LLModel(volume_params, 0.f);
-
-            std::string name = base->mLabel + getLodSuffix(lod);
-
-            mModel[lod][mdl_idx]->mLabel = name;
-            mModel[lod][mdl_idx]->mSubmodelID = base->mSubmodelID;
-            mModel[lod][mdl_idx]->setNumVolumeFaces(base->getNumVolumeFaces());
-
-            LLModel* target_model = mModel[lod][mdl_idx];
+            LLPointer<LLModel> base_copy = new LLModel(volume_params, 0.f);
+            base_copy->mLabel = base->mLabel;
+            base_copy->mSubmodelID = base->mSubmodelID;
+            base_copy->copyVolumeFaces(base);
+            base_copy->mPosition = base->mPosition;
+            base_copy->mSkinWeights = base->mSkinWeights;
+            base_copy->mSkinInfo = base->mSkinInfo;
+            base_copy->mMaterialList = base->mMaterialList;
+            base_models.push_back(base_copy);
+        }
 
-            // carry over normalized transform into simplified model
-            for (S32 i = 0; i < base->getNumVolumeFaces(); ++i)
-            {
-                LLVolumeFace& src = base->getVolumeFace(i);
-                LLVolumeFace& dst = target_model->getVolumeFace(i);
-                dst.mNormalizedScale = src.mNormalizedScale;
-            }
+        // a newer request for this lod abandons whatever was in flight
+        if (mLodBuildCancel[lod])
+        {
+            *mLodBuildCancel[lod] = true;
+        }
+        mLodBuildCancel[lod] = std::make_shared<LLAtomicBool>(false);
+        std::shared_ptr<LLAtomicBool> cancel = mLodBuildCancel[lod];
 
-            S32 model_meshopt_mode = meshopt_mode;
+        ++mLodsGenerating;
 
-            // Ideally this should run not per model,
-            // but combine all submodels with origin model as well
-            if (model_meshopt_mode == MESH_OPTIMIZER_PRECISE)
+        main_queue->postTo(
+            general_queue,
+            [base_models, lod, meshopt_mode, indices_decimator, lod_error_threshold, lod_mode, decimation, cancel]() // Work done on general queue
             {
-                // Run meshoptimizer for each face
-                for (S32 face_idx = 0; face_idx < base->getNumVolumeFaces(); ++face_idx)
+                LLModelLoader::model_list new_models;
+                new_models.reserve(base_models.size());
+                for (U32 mdl_idx = 0; mdl_idx < base_models.size(); ++mdl_idx)
                 {
-                    F32 res = genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
-                    if (res < 0)
-                    {
-                        // Mesh optimizer failed and returned an invalid model
-                        const LLVolumeFace &face = base->getVolumeFace(face_idx);
-                        LLVolumeFace &new_face = target_model->getVolumeFace(face_idx);
-                        new_face = face;
+                    if (*cancel)
+                    { // request was superseded or the floater went away, stop early
+                        new_models.clear();
+                        break;
                     }
+                    new_models.push_back(genMeshOptimizerLODModel(base_models[mdl_idx], lod, meshopt_mode, indices_decimator, lod_error_threshold, lod_mode, decimation));
                 }
-            }
-
-            if (model_meshopt_mode == MESH_OPTIMIZER_SLOPPY)
+                return new_models;
+            },
+            [lod, cancel](LLModelLoader::model_list new_models) // Callback to main thread
             {
-                // Run meshoptimizer for each face
-                for (S32 face_idx = 0; face_idx < base->getNumVolumeFaces(); ++face_idx)
+                // not the best solution, but model preview belongs to floater
+                // so it is an easy way to check that preview still exists.
+                LLFloaterModelPreview* fmp = LLFloaterModelPreview::sInstance;
+                if (fmp && fmp->mModelPreview)
                 {
-                    if (genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY) < 0)
-                    {
-                        // Sloppy failed and returned an invalid model
-                        genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
-                    }
+                    fmp->mModelPreview->onLodBuildComplete(lod, new_models, *cancel);
                 }
+            });
+    }
+}
+
+//static
+LLPointer<LLModel> LLModelPreview::genMeshOptimizerLODModel(LLModel* base, S32 which_lod, S32 meshopt_mode, F32 indices_decimator, F32 lod_error_threshold, U32 lod_mode, U32 decimation)
+{
+    LLVolumeParams volume_params;
+    volume_params.setType(LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE);
+    LLPointer<LLModel> new_model = new LLModel(volume_params, 0.f);
+
+    std::string name = base->mLabel + getLodSuffix(which_lod);
+
+    new_model->mLabel = name;
+    new_model->mSubmodelID = base->mSubmodelID;
+    new_model->setNumVolumeFaces(base->getNumVolumeFaces());
+
+    LLModel* target_model = new_model;
+
+    // carry over normalized transform into simplified model
+    for (S32 i = 0; i < base->getNumVolumeFaces(); ++i)
+    {
+        LLVolumeFace& src = base->getVolumeFace(i);
+        LLVolumeFace& dst = target_model->getVolumeFace(i);
+        dst.mNormalizedScale = src.mNormalizedScale;
+    }
+
+    S32 model_meshopt_mode = meshopt_mode;
+
+    // Ideally this should run not per model,
+    // but combine all submodels with origin model as well
+    if (model_meshopt_mode == MESH_OPTIMIZER_PRECISE)
+    {
+        // Run meshoptimizer for each face
+        for (S32 face_idx = 0; face_idx < base->getNumVolumeFaces(); ++face_idx)
+        {
+            F32 res = genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
+            if (res < 0)
+            {
+                // Mesh optimizer failed and returned an invalid model
+                const LLVolumeFace &face = base->getVolumeFace(face_idx);
+                LLVolumeFace &new_face = target_model->getVolumeFace(face_idx);
+                new_face = face;
             }
+        }
+    }
 
-            if (model_meshopt_mode == MESH_OPTIMIZER_AUTO)
+    if (model_meshopt_mode == MESH_OPTIMIZER_SLOPPY)
+    {
+        // Run meshoptimizer for each face
+        for (S32 face_idx = 0; face_idx < base->getNumVolumeFaces(); ++face_idx)
+        {
+            if (genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY) < 0)
             {
-                // Remove progressively more data if we can't reach the target.
-                F32 allowed_ratio_drift = 1.8f;
-                F32 precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
+                // Sloppy failed and returned an invalid model
+                genMeshOptimizerPerFace(base, target_model, face_idx, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
+            }
+        }
+    }
 
-                if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
-                {
-                    precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_NORMALS);
-                }
+    if (model_meshopt_mode == MESH_OPTIMIZER_AUTO)
+    {
+        // Remove progressively more data if we can't reach the target.
+        F32 allowed_ratio_drift = 1.8f;
+        F32 precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
 
-                if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
-                {
-                    precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_UVS);
-                }
+        if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
+        {
+            precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_NORMALS);
+        }
 
-                if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
-                {
-                    // Try sloppy variant if normal one failed to simplify model enough.
-                    // Sloppy variant can fail entirely and has issues with precision,
-                    // so code needs to do multiple attempts with different decimators.
-                    // Todo: this is a bit of a mess, needs to be refined and improved
+        if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
+        {
+            precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_UVS);
+        }
 
-                    F32 last_working_decimator = 0.f;
-                    F32 last_working_ratio = F32_MAX;
+        if (precise_ratio < 0 || (precise_ratio * allowed_ratio_drift < indices_decimator))
+        {
+            // Try sloppy variant if normal one failed to simplify model enough.
+            // Sloppy variant can fail entirely and has issues with precision,
+            // so code needs to do multiple attempts with different decimators.
+            // Todo: this is a bit of a mess, needs to be refined and improved
 
-                    F32 sloppy_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
+            F32 last_working_decimator = 0.f;
+            F32 last_working_ratio = F32_MAX;
 
-                    if (sloppy_ratio > 0)
-                    {
-                        // Would be better to do a copy of target_model here, but if
-                        // we need to use sloppy decimation, model should be cheap
-                        // and fast to generate and it won't affect end result
-                        last_working_decimator = indices_decimator;
-                        last_working_ratio = sloppy_ratio;
-                    }
+            F32 sloppy_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
 
-                    // Sloppy has a tendecy to error into lower side, so a request for 100
-                    // triangles turns into ~70, so check for significant difference from target decimation
-                    F32 sloppy_ratio_drift = 1.4f;
-                    if (lod_mode == LIMIT_TRIANGLES
-                        && (sloppy_ratio > indices_decimator * sloppy_ratio_drift || sloppy_ratio < 0))
-                    {
-                        // Apply a correction to compensate.
+            if (sloppy_ratio > 0)
+            {
+                // Would be better to do a copy of target_model here, but if
+                // we need to use sloppy decimation, model should be cheap
+                // and fast to generate and it won't affect end result
+                last_working_decimator = indices_decimator;
+                last_working_ratio = sloppy_ratio;
+            }
 
-                        // (indices_decimator / res_ratio) by itself is likely to overshoot to a differend
-                        // side due to overal lack of precision, and we don't need an ideal result, which
-                        // likely does not exist, just a better one, so a partial correction is enough.
-                        F32 sloppy_decimator = indices_decimator * (indices_decimator / sloppy_ratio + 1) / 2;
-                        sloppy_ratio = genMeshOptimizerPerModel(base, target_model, sloppy_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
-                    }
+            // Sloppy has a tendecy to error into lower side, so a request for 100
+            // triangles turns into ~70, so check for significant difference from target decimation
+            F32 sloppy_ratio_drift = 1.4f;
+            if (lod_mode == LIMIT_TRIANGLES
+                && (sloppy_ratio > indices_decimator * sloppy_ratio_drift || sloppy_ratio < 0))
+            {
+                // Apply a correction to compensate.
 
-                    if (last_working_decimator > 0 && sloppy_ratio < last_working_ratio)
-                    {
-                        // Compensation didn't work, return back to previous decimator
-                        sloppy_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
-                    }
+                // (indices_decimator / res_ratio) by itself is likely to overshoot to a differend
+                // side due to overal lack of precision, and we don't need an ideal result, which
+                // likely does not exist, just a better one, so a partial correction is enough.
+                F32 sloppy_decimator = indices_decimator * (indices_decimator / sloppy_ratio + 1) / 2;
+                sloppy_ratio = genMeshOptimizerPerModel(base, target_model, sloppy_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
+            }
 
-                    if (sloppy_ratio < 0)
-                    {
-                        // Sloppy method didn't work, try with smaller decimation values
-                        {
-                            // Find a decimator that does work
-                            F32 sloppy_decimation_step = sqrt((F32)decimation); // example: 27->15->9->5->3
-                            F32 sloppy_decimator = indices_decimator / sloppy_decimation_step;
-                            U64Microseconds end_time = LLTimer::getTotalTime() + U64Seconds(5);
-
-                            while (sloppy_ratio < 0
-                                && sloppy_decimator > precise_ratio
-                                && sloppy_decimator > 1 // precise_ratio isn't supposed to be below 1, but check just in case
-                                && end_time > LLTimer::getTotalTime())
-                            {
-                                sloppy_ratio = genMeshOptimizerPerModel(base, target_model, sloppy_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
-                                sloppy_decimator = sloppy_decimator / sloppy_decimation_step;
-                            }
-                        }
-                    }
+            if (last_working_decimator > 0 && sloppy_ratio < last_working_ratio)
+            {
+                // Compensation didn't work, return back to previous decimator
+                sloppy_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
+            }
 
-                    if (sloppy_ratio < 0 || sloppy_ratio < precise_ratio)
+            if (sloppy_ratio < 0)
+            {
+                // Sloppy method didn't work, try with smaller decimation values
+                {
+                    // Find a decimator that does work
+                    F32 sloppy_decimation_step = sqrt((F32)decimation); // example: 27->15->9->5->3
+                    F32 sloppy_decimator = indices_decimator / sloppy_decimation_step;
+                    U64Microseconds end_time = LLTimer::getTotalTime() + U64Seconds(5);
+
+                    while (sloppy_ratio < 0
+                        && sloppy_decimator > precise_ratio
+                        && sloppy_decimator > 1 // precise_ratio isn't supposed to be below 1, but check just in case
+                        && end_time > LLTimer::getTotalTime())
                     {
-                        // Sloppy variant failed to generate triangles or is worse.
-                        // Can happen with models that are too simple as is.
+                        sloppy_ratio = genMeshOptimizerPerModel(base, target_model, sloppy_decimator, lod_error_threshold, MESH_OPTIMIZER_NO_TOPOLOGY);
+                        sloppy_decimator = sloppy_decimator / sloppy_decimation_step;
+                    }
+                }
+            }
 
-                        if (precise_ratio < 0)
-                        {
-                            // Precise method failed as well, just copy face over
-                            target_model->copyVolumeFaces(base);
-                            precise_ratio = 1.f;
-                        }
-                        else
-                        {
-                            // Fallback to normal method
-                            precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
-                        }
+            if (sloppy_ratio < 0 || sloppy_ratio < precise_ratio)
+            {
+                // Sloppy variant failed to generate triangles or is worse.
+                // Can happen with models that are too simple as is.
 
-                        LL_INFOS() << "Model " << target_model->getName()
-                            << " lod " << which_lod
-                            << " resulting ratio " << precise_ratio
-                            << " simplified using per model method." << LL_ENDL;
-                    }
-                    else
-                    {
-                        LL_INFOS() << "Model " << target_model->getName()
-                            << " lod " << which_lod
-                            << " resulting ratio " << sloppy_ratio
-                            << " sloppily simplified using per model method." << LL_ENDL;
-                    }
+                if (precise_ratio < 0)
+                {
+                    // Precise method failed as well, just copy face over
+                    target_model->copyVolumeFaces(base);
+                    precise_ratio = 1.f;
                 }
                 else
                 {
-                    LL_INFOS() << "Model " << target_model->getName()
-                        << " lod " << which_lod
-                        << " resulting ratio " << precise_ratio
-                        << " simplified using per model method." << LL_ENDL;
+                    // Fallback to normal method
+                    precise_ratio = genMeshOptimizerPerModel(base, target_model, indices_decimator, lod_error_threshold, MESH_OPTIMIZER_FULL);
                 }
-            }
-
-            //blind copy skin weights and just take closest skin weight to point on
-            //decimated mesh for now (auto-generating LODs with skin weights is still a bit
-            //of an open problem).
-            target_model->mPosition = base->mPosition;
-            target_model->mSkinWeights = base->mSkinWeights;
-            target_model->mSkinInfo = base->mSkinInfo;
-
-            //copy material list
-            target_model->mMaterialList = base->mMaterialList;
 
-            if (!validate_model(target_model))
+                LL_INFOS() << "Model " << target_model->getName()
+                    << " lod " << which_lod
+                    << " resulting ratio " << precise_ratio
+                    << " simplified using per model method." << LL_ENDL;
+            }
+            else
             {
-                LL_ERRS() << "Invalid model generated when creating LODs" << LL_ENDL;
+                LL_INFOS() << "Model " << target_model->getName()
+                    << " lod " << which_lod
+                    << " resulting ratio " << sloppy_ratio
+                    << " sloppily simplified using per model method." << LL_ENDL;
             }
         }
+        else
+        {
+            LL_INFOS() << "Model " << target_model->getName()
+                << " lod " << which_lod
+                << " resulting ratio " << precise_ratio
+                << " simplified using per model method." << LL_ENDL;
+        }
+    }
+
+    //blind copy skin weights and just take closest skin weight to point on
+    //decimated mesh for now (auto-generating LODs with skin weights is still a bit
+    //of an open problem).
+    target_model->mPosition = base->mPosition;
+    target_model->mSkinWeights = base->mSkinWeights;
+    target_model->mSkinInfo = base->mSkinInfo;
+
+    //copy material list
+    target_model->mMaterialList = base->mMaterialList;
+
+    if (!validate_model(target_model))
+    {
+        LL_ERRS() << "Invalid model generated when creating LODs" << LL_ENDL;
+    }
+
+    return new_model;
+}
+
+void LLModelPreview::onLodBuildComplete(S32 which_lod, LLModelLoader::model_list& new_models, bool stale)
+{
+    assert_main_thread();
+
+    mLodsGenerating = llmax(mLodsGenerating - 1, 0);
+
+    if (stale || new_models.size() != mBaseModel.size())
+    { // superseded by a newer request or the base models changed underneath
+        return;
+    }
 
-        //rebuild scene based on mBaseScene
-        mScene[lod].clear();
-        mScene[lod] = mBaseScene;
+    mModel[which_lod].clear();
+    mModel[which_lod] = new_models;
+    mVertexBuffer[which_lod].clear();
+
+    //rebuild scene based on mBaseScene
+    mScene[which_lod].clear();
+    mScene[which_lod] = mBaseScene;
 
-        for (U32 i = 0; i < mBaseModel.size(); ++i)
+    for (U32 i = 0; i < mBaseModel.size(); ++i)
+    {
+        LLModel* mdl = mBaseModel[i];
+        LLModel* target = mModel[which_lod][i];
+        if (target)
         {
-            LLModel* mdl = mBaseModel[i];
-            LLModel* target = mModel[lod][i];
-            if (target)
+            for (LLModelLoader::scene::iterator iter = mScene[which_lod].begin(); iter != mScene[which_lod].end(); ++iter)
             {
-                for (LLModelLoader::scene::iterator iter = mScene[lod].begin(); iter != mScene[lod].end(); ++iter)
+                for (U32 j = 0; j < iter->second.size(); ++j)
                 {
-                    for (U32 j = 0; j < iter->second.size(); ++j)
+                    if (iter->second[j].mModel == mdl)
                     {
-                        if (iter->second[j].mModel == mdl)
-                        {
-                            iter->second[j].mModel = target;
-                        }
+                        iter->second[j].mModel = target;
                     }
                 }
             }
         }
     }
+
+    refresh();
+    mDirty = true;
+}
+
+void LLModelPreview::cancelLodBuilds()
+{
+    for (U32 i = 0; i < LLModel::NUM_LODS; ++i)
+    {
+        if (mLodBuildCancel[i])
+        {
+            *mLodBuildCancel[i] = true;
+        }
+    }
 }
 
 void LLModelPreview::updateStatusMessages()
@@ -2985,7 +3083,7 @@ void LLModelPreview::update()
         }
     }
 
-    if (mDirty && mLodsQuery.empty())
+    if (mDirty && mLodsQuery.empty() && mLodsGenerating == 0)
     {
         mDirty = false;
         updateDimentionsAndOffsets();
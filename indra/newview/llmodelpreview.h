@@ -28,6 +28,7 @@
 #ifndef LL_LLMODELPREVIEW_H
 #define LL_LLMODELPREVIEW_H
 
+#include "llatomic.h"
 #include "lldynamictexture.h"
 #include "llfloatermodelpreview.h"
 #include "llmeshrepository.h"
@@ -161,7 +162,7 @@ public:
     void getJointAliases(JointMap& joint_map);
     void loadModel(std::string filename, S32 lod, bool force_disable_slm = false);
     void loadModelCallback(S32 lod);
-    bool lodsReady() { return !mGenLOD && mLodsQuery.empty(); }
+    bool lodsReady() { return !mGenLOD && mLodsQuery.empty() && mLodsGenerating == 0; }
     void queryLODs() { mGenLOD = true; };
     void genMeshOptimizerLODs(S32 which_lod, S32 meshopt_mode, U32 decimation = 3, bool enforce_tri_limit = false);
     void generateNormals();
@@ -253,10 +254,19 @@ private:
     // Merges faces into single mesh, simplifies using mesh optimizer,
     // then splits back into faces.
     // Returns reached simplification ratio. -1 in case of a failure.
-    F32 genMeshOptimizerPerModel(LLModel *base_model, LLModel *target_model, F32 indices_ratio, F32 error_threshold, eSimplificationMode simplification_mode);
+    static F32 genMeshOptimizerPerModel(LLModel *base_model, LLModel *target_model, F32 indices_ratio, F32 error_threshold, eSimplificationMode simplification_mode);
     // Simplifies specified face using mesh optimizer.
     // Returns reached simplification ratio. -1 in case of a failure.
-    F32 genMeshOptimizerPerFace(LLModel *base_model, LLModel *target_model, U32 face_idx, F32 indices_ratio, F32 error_threshold, eSimplificationMode simplification_mode);
+    static F32 genMeshOptimizerPerFace(LLModel *base_model, LLModel *target_model, U32 face_idx, F32 indices_ratio, F32 error_threshold, eSimplificationMode simplification_mode);
+
+    // Builds a simplified model for one lod from a base model snapshot.
+    // Pure function of its arguments so it can run on a worker thread.
+    static LLPointer<LLModel> genMeshOptimizerLODModel(LLModel* base, S32 which_lod, S32 meshopt_mode, F32 indices_decimator, F32 lod_error_threshold, U32 lod_mode, U32 decimation);
+    // Installs worker-built models for one lod; main thread only.
+    void onLodBuildComplete(S32 which_lod, LLModelLoader::model_list& new_models, bool stale);
+    // Abandons any lod builds still in flight (base models are about to
+    // change out from under them).
+    void cancelLodBuilds();
 
 protected:
     friend class LLModelLoader;
@@ -288,6 +298,12 @@ protected:
 
     std::map<std::string, bool> mViewOption;
 
+    // Count of lod builds posted to the thread pool and not yet delivered
+    S32 mLodsGenerating;
+    // Per-lod abort flags shared with in-flight worker jobs; a slot is
+    // replaced when a newer request for that lod supersedes the old one
+    std::shared_ptr<LLAtomicBool> mLodBuildCancel[LLModel::NUM_LODS];
+
     // Model generation parameters (must rebuild object if these change)
     bool mLODFrozen;
     U32 mRequestedLoDMode[LLModel::NUM_LODS];
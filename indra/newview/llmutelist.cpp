@@ -154,7 +154,8 @@ std::string LLMute::getDisplayType() const
 // LLMuteList()
 //-----------------------------------------------------------------------------
 LLMuteList::LLMuteList() :
-    mIsLoaded(false)
+    mIsLoaded(false),
+    mIndexDirty(false)
 {
     gGenericDispatcher.addHandler("emptymutelist", &sDispatchEmptyMuteList);
 
@@ -663,19 +664,40 @@ bool LLMuteList::saveToFile(const std::string& filename)
 }
 
 
+void LLMuteList::rebuildIndex() const
+{
+    mMuteIDIndex.clear();
+    mMuteIDIndex.reserve(mMutes.size());
+    for (const LLMute& mute : mMutes)
+    {
+        mMuteIDIndex[mute.mID] = mute.mFlags;
+    }
+    mIndexDirty = false;
+}
+
 bool LLMuteList::isMuted(const LLUUID& id, const std::string& name, U32 flags) const
 {
+    if (mMutes.empty() && mLegacyMutes.empty())
+    {
+        // nothing is muted; skip the object lookup entirely
+        return false;
+    }
+
+    if (mIndexDirty)
+    {
+        rebuildIndex();
+    }
+
     // for objects, check for muting on their parent prim
     LLViewerObject* mute_object = get_object_to_mute_from_id(id);
     LLUUID id_to_check  = (mute_object) ? mute_object->getID() : id;
 
     // don't need name or type for lookup
-    LLMute mute(id_to_check);
-    mute_set_t::const_iterator mute_it = mMutes.find(mute);
-    if (mute_it != mMutes.end())
+    mute_index_t::const_iterator mute_it = mMuteIDIndex.find(id_to_check);
+    if (mute_it != mMuteIDIndex.end())
     {
         // If any of the flags the caller passed are set, this item isn't considered muted for this caller.
-        if(flags & mute_it->mFlags)
+        if(flags & mute_it->second)
         {
             return false;
         }
@@ -872,6 +894,10 @@ void LLMuteList::setLoaded()
 
 void LLMuteList::notifyObservers()
 {
+    // every change to the ids or flags in mMutes funnels through here
+    // (name-only updates in onAccountNameChanged don't affect the index)
+    mIndexDirty = true;
+
     for (observer_set_t::iterator it = mObservers.begin();
         it != mObservers.end();
         )
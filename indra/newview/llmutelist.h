@@ -128,6 +128,8 @@ private:
     void updateAdd(const LLMute& mute);
     void updateRemove(const LLMute& mute);
 
+    void rebuildIndex() const;
+
     // TODO: NULL out mute_id in database
     static void processMuteListUpdate(LLMessageSystem* msg, void**);
     static void processUseCachedMuteList(LLMessageSystem* msg, void**);
@@ -158,6 +160,13 @@ private:
     };
     typedef std::set<LLMute, compare_by_id> mute_set_t;
     mute_set_t mMutes;
+
+    // Flat id -> flags index over mMutes so the isMuted hot path is a
+    // single hash probe instead of a tree search with UUID compares.
+    // Rebuilt lazily on the first check after the list changes.
+    typedef std::unordered_map<LLUUID, U32> mute_index_t;
+    mutable mute_index_t mMuteIDIndex;
+    mutable bool mIndexDirty;
     typedef std::map<LLUUID, std::string> pending_names_t;
     pending_names_t mPendingAgentNameUpdates;
 
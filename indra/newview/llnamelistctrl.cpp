@@ -425,12 +425,9 @@ LLScrollListItem* LLNameListCtrl::addNameItemRow(
         fullname.append(suffix);
     }
 
-    LLScrollListCell* cell = item->getColumn(mNameColumnIndex);
-    if (cell)
-    {
-        cell->setValue(prefix + fullname);
-        cell->setAltValue(name_item.alt_value());
-    }
+    // works for virtualized rows too, where the cell widget doesn't exist yet
+    item->setColumnValue(mNameColumnIndex, prefix + fullname);
+    item->setColumnAltValue(mNameColumnIndex, name_item.alt_value());
 
     dirtyColumns();
 
@@ -548,12 +545,8 @@ void LLNameListCtrl::onAvatarNameCache(const LLUUID& agent_id,
     LLNameListItem* list_item = item.get();
     if (list_item && list_item->getUUID() == agent_id)
     {
-        LLScrollListCell* cell = list_item->getColumn(mNameColumnIndex);
-        if (cell)
-        {
-            cell->setValue(name);
-            setNeedsSort();
-        }
+        list_item->setColumnValue(mNameColumnIndex, name);
+        setNeedsSort();
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -591,12 +584,8 @@ void LLNameListCtrl::onGroupNameCache(const LLUUID& group_id, const std::string
     LLNameListItem* list_item = item.get();
     if (list_item && list_item->getUUID() == group_id)
     {
-        LLScrollListCell* cell = list_item->getColumn(mNameColumnIndex);
-        if (cell)
-        {
-            cell->setValue(name);
-            setNeedsSort();
-        }
+        list_item->setColumnValue(mNameColumnIndex, name);
+        setNeedsSort();
     }
 
     dirtyColumns();
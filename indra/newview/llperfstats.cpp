@@ -29,6 +29,7 @@
 #include "llcontrol.h"
 #include "pipeline.h"
 #include "llagentcamera.h"
+#include "llappviewer.h"
 #include "llviewerwindow.h"
 #include "llvoavatar.h"
 #include "llwindow.h"
@@ -44,6 +45,8 @@ namespace LLPerfStats
     std::atomic<F32> sAverageAvatarTime = 0.f;
     std::atomic<F32> sMaxAvatarTime = 0.f;
 
+    std::atomic<F32> sGPUFrameTimeMS = 0.f;
+
     std::atomic<int64_t> tunedAvatars{0};
     std::atomic<U64> renderAvatarMaxART_ns{(U64)(ART_UNLIMITED_NANOS)}; // highest render time we'll allow without culling features
     bool belowTargetFPS{false};
@@ -292,6 +295,103 @@ namespace LLPerfStats
         sTotalAvatarTime = LLVOAvatar::getTotalGPURenderTime();
         sAverageAvatarTime = LLVOAvatar::getAverageGPURenderTime();
         sMaxAvatarTime = LLVOAvatar::getMaxGPURenderTime();
+
+        FrameBudget::updateBudgets();
+    }
+
+    namespace FrameBudget
+    {
+        // fraction of the target frame reserved for idle() maintenance work
+        static constexpr F32 POOL_FRACTION{0.2f};
+        static constexpr F32 MIN_POOL_MS{1.f};
+        static constexpr F32 MAX_POOL_MS{10.f};
+        static constexpr F32 MIN_SLICE_MS{0.25f};
+        // spending a little past the grant is just timer granularity; only
+        // count an overrun when a subsystem clearly blew through its slice
+        static constexpr F32 OVERRUN_TOLERANCE{1.25f};
+
+        struct SubsystemState
+        {
+            F32 mGrant{0.f};    // seconds handed out this frame
+            F32 mSpent{0.f};    // seconds reported back this frame
+            S32 mBacklog{0};    // pending work reported after last frame
+            U32 mOverruns{0};   // frames where spent cleared the tolerance
+        };
+        static std::array<SubsystemState, static_cast<size_t>(Subsystem::SUBSYSTEM_COUNT)> sSubsystems;
+        static bool sActive{false};
+
+        bool enabled()
+        {
+            return sActive;
+        }
+
+        void updateBudgets()
+        {
+            static LLCachedControl<F32> target_fps(gSavedSettings, "FrameBudgetTargetFPS", 0.f);
+            sActive = ((F32)target_fps > 0.f);
+            if (!sActive)
+            {
+                return;
+            }
+
+            // settle last frame's books before handing out new grants
+            for (auto& sub : sSubsystems)
+            {
+                if (sub.mSpent > sub.mGrant * OVERRUN_TOLERANCE)
+                {
+                    sub.mOverruns++;
+                }
+            }
+
+            const F32 target_ms = 1000.f / (F32)target_fps;
+            const F32 frame_ms = gFrameIntervalSeconds.value() * 1000.f;
+            // shrink the pool while frames run over the target, grow it back
+            // toward the full maintenance fraction when there is headroom
+            const F32 pool_ms = llclamp(target_ms * POOL_FRACTION + (target_ms - frame_ms) * 0.5f,
+                                        MIN_POOL_MS, MAX_POOL_MS);
+
+            // log-compressed backlog weighting so a few thousand queued
+            // textures cannot starve the other subsystems outright
+            F32 total_weight = 0.f;
+            for (auto& sub : sSubsystems)
+            {
+                total_weight += 1.f + logf(1.f + (F32)sub.mBacklog);
+            }
+            for (auto& sub : sSubsystems)
+            {
+                F32 weight = 1.f + logf(1.f + (F32)sub.mBacklog);
+                sub.mGrant = llmax(pool_ms * weight / total_weight, MIN_SLICE_MS) / 1000.f;
+                sub.mSpent = 0.f;
+            }
+
+            static LLFrameTimer report_timer;
+            if (report_timer.getElapsedTimeF32() > 10.f)
+            {
+                report_timer.reset();
+                for (size_t i = 0; i < sSubsystems.size(); i++)
+                {
+                    LL_DEBUGS("FrameBudget") << "subsystem " << i
+                        << " grant " << sSubsystems[i].mGrant * 1000.f << "ms"
+                        << " backlog " << sSubsystems[i].mBacklog
+                        << " overruns " << sSubsystems[i].mOverruns << LL_ENDL;
+                }
+            }
+        }
+
+        F32 getTimeSlice(Subsystem sub, F32 default_slice)
+        {
+            return sActive ? sSubsystems[static_cast<size_t>(sub)].mGrant : default_slice;
+        }
+
+        void reportSpent(Subsystem sub, F32 seconds)
+        {
+            sSubsystems[static_cast<size_t>(sub)].mSpent += seconds;
+        }
+
+        void reportBacklog(Subsystem sub, S32 depth)
+        {
+            sSubsystems[static_cast<size_t>(sub)].mBacklog = depth;
+        }
     }
 
     //static
@@ -401,6 +501,18 @@ namespace LLPerfStats
 
         F64 time_buf = target_frame_time_raw * 0.1;
 
+        // Attribute the deficit before picking a lever. The avatar times
+        // above are GPU-measured while the frame time is CPU-measured; when
+        // the harvested draw-pool GPU time alone exceeds the frame budget,
+        // no CPU-side saving can reach the target and the scene share must
+        // be judged by its GPU cost too, otherwise a GPU stall is charged to
+        // CPU "scene" time and we cut draw distance when shadows or
+        // materials are at fault. Inert (gpu_frame_ms stays 0) unless
+        // RenderGPUTimerQueries is enabled.
+        const F32 gpu_frame_ms = LLPerfStats::sGPUFrameTimeMS;
+        const U64 gpu_frame_raw = ms_to_raw(gpu_frame_ms);
+        const bool gpu_bound = (gpu_frame_ms > 0.f) && ((F64)gpu_frame_raw > target_frame_time_raw + time_buf);
+
         // 1) Is the target frame time lower than current?
         if ((target_frame_time_raw + time_buf) <= tot_frame_time_raw)
         {
@@ -420,7 +532,10 @@ namespace LLPerfStats
             // if so we've got work to do
 
             // how much of the frame was spent on non avatar related work?
-            U64 non_avatar_time_raw = tot_frame_time_raw > tot_avatar_time_raw ? tot_frame_time_raw - tot_avatar_time_raw : 0;
+            // judged on the bottleneck's own clock: GPU pool time when the
+            // GPU is over budget on its own, CPU frame time otherwise.
+            U64 attributed_time_raw = gpu_bound ? gpu_frame_raw : tot_frame_time_raw;
+            U64 non_avatar_time_raw = attributed_time_raw > tot_avatar_time_raw ? attributed_time_raw - tot_avatar_time_raw : 0;
 
             // If the target frame time < scene time (estimated as non_avatar time)
             U64 target_avatar_time_raw;
@@ -447,6 +562,10 @@ namespace LLPerfStats
                             auto new_dd = (LLPipeline::RenderFarClip - DD_STEP > tunables.userMinDrawDistance)?(LLPipeline::RenderFarClip - DD_STEP) : tunables.userMinDrawDistance;
                             if(new_dd != LLPipeline::RenderFarClip)
                             {
+                                LL_DEBUGS("AutoTune") << "bottleneck " << (gpu_bound ? "GPU" : "CPU")
+                                    << ": scene share " << raw_to_ms(non_avatar_time_raw) << "ms over "
+                                    << raw_to_ms(target_frame_time_raw) << "ms budget, RenderFarClip "
+                                    << LLPipeline::RenderFarClip << " -> " << new_dd << LL_ENDL;
                                 LLPerfStats::tunables.updateFarClip( new_dd );
                                 LLPerfStats::lastGlobalPrefChange = gFrameCount;
                                 return;
@@ -490,6 +609,10 @@ namespace LLPerfStats
                 // assign the new value
                 if (renderAvatarMaxART_ns != new_render_limit_ns)
                 {
+                    LL_DEBUGS("AutoTune") << "bottleneck " << (gpu_bound ? "GPU" : "CPU")
+                        << ": avatar share " << raw_to_ms(tot_avatar_time_raw) << "ms over "
+                        << raw_to_ms(target_avatar_time_raw) << "ms budget, max ART "
+                        << renderAvatarMaxART_ns << " -> " << (U64)new_render_limit_ns << "ns" << LL_ENDL;
                     renderAvatarMaxART_ns = (U64)new_render_limit_ns;
                     tunables.updateSettingsFromRenderCostLimit();
                 }
@@ -522,6 +645,8 @@ namespace LLPerfStats
                 {
                     // if we have more time to spare let's shift up little in the hope we'll restore an avatar.
                     U64 up_step = LLPerfStats::tunedAvatars > 2 ? LLPerfStats::ART_MIN_ADJUST_UP_NANOS : LLPerfStats::ART_MIN_ADJUST_UP_NANOS * 2;
+                    LL_DEBUGS("AutoTune") << "headroom: raising max ART by " << up_step
+                        << "ns (" << LLPerfStats::tunedAvatars << " avatars tuned out)" << LL_ENDL;
                     renderAvatarMaxART_ns += up_step;
                     tunables.updateSettingsFromRenderCostLimit();
                     return;
@@ -530,6 +655,9 @@ namespace LLPerfStats
                 {
                     if (LLPipeline::RenderFarClip < tunables.userTargetDrawDistance)
                     {
+                        LL_DEBUGS("AutoTune") << "headroom: restoring RenderFarClip "
+                            << LLPipeline::RenderFarClip << " -> "
+                            << std::min(LLPipeline::RenderFarClip + DD_STEP, tunables.userTargetDrawDistance) << LL_ENDL;
                         LLPerfStats::tunables.updateFarClip( std::min(LLPipeline::RenderFarClip + DD_STEP, tunables.userTargetDrawDistance) );
                         LLPerfStats::lastGlobalPrefChange = gFrameCount;
                         return;
@@ -46,6 +46,33 @@ namespace LLPerfStats
     // called once per main loop iteration
     void updateClass();
 
+    // Central frame-budget governor for the time-sliced maintenance work in
+    // idle(). Each frame it splits a millisecond pool (derived from
+    // FrameBudgetTargetFPS and the measured frame time) into per-subsystem
+    // allowances, weighted toward whichever subsystem reported the deepest
+    // backlog. While the setting is 0 the governor is inert and every call
+    // site keeps its legacy ad-hoc cap.
+    namespace FrameBudget
+    {
+        enum class Subsystem : U32
+        {
+            TEXTURES = 0,   // LLViewerTextureList::updateImages
+            REGIONS,        // LLWorld::updateRegions
+            SUBSYSTEM_COUNT
+        };
+
+        bool enabled();
+        // hand out this frame's allowances; called from updateClass()
+        void updateBudgets();
+        // this frame's allowance in seconds; returns default_slice verbatim
+        // while the governor is disabled
+        F32 getTimeSlice(Subsystem sub, F32 default_slice);
+        // time actually consumed this frame, in seconds, for overrun tracking
+        void reportSpent(Subsystem sub, F32 seconds);
+        // pending work left over after this frame's slice (queue depths etc.)
+        void reportBacklog(Subsystem sub, S32 depth);
+    }
+
 // Note if changing these, they should correspond with the log range of the correpsonding sliders
     static constexpr U64 ART_UNLIMITED_NANOS{50000000};
     static constexpr U64 ART_MINIMUM_NANOS{100000};
@@ -62,6 +89,11 @@ namespace LLPerfStats
 
     extern F64 cpu_hertz;
 
+    // whole-frame GPU time summed from the per-pool timestamp queries in the
+    // pipeline, in ms. Stays 0 while RenderGPUTimerQueries is disabled; only
+    // covers the deferred geometry passes, so treat it as a lower bound.
+    extern std::atomic<F32> sGPUFrameTimeMS;
+
     extern std::atomic<int64_t> tunedAvatars;
     extern std::atomic<U64> renderAvatarMaxART_ns;
     extern bool belowTargetFPS;
@@ -113,6 +113,12 @@ public:
     // fade in parameter for this probe
     F32 mFadeIn = 0.f;
 
+    // average irradiance sampled after the last completed update, and the
+    // relative change it represented; -1 until first measured.  Probes whose
+    // last update barely changed are refreshed less aggressively.
+    F32 mLastIrradianceAvg = -1.f;
+    F32 mIrradianceDelta = -1.f;
+
     // index into array packed by LLReflectionMapManager::getReflectionMaps
     // WARNING -- only valid immediately after call to getReflectionMaps
     S32 mProbeIndex = -1;
@@ -168,7 +168,21 @@ struct CompareProbeDistance
 
 static F32 update_score(LLReflectionMap* p)
 {
-    return gFrameTimeSeconds - p->mLastUpdateTime  - p->mDistance*0.1f;
+    F32 age = gFrameTimeSeconds - p->mLastUpdateTime;
+
+    // weight age by how much of the view the probe can influence
+    // (projected radius) so a large nearby probe outranks a small distant
+    // one of the same age
+    F32 influence = llclamp(p->mRadius / llmax(p->mDistance, 1.f), 0.25f, 4.f);
+
+    // boost probes whose last update actually changed their irradiance --
+    // the best available proxy for how much the scene around them is moving
+    if (p->mIrradianceDelta > 0.f)
+    {
+        influence *= 1.f + llmin(p->mIrradianceDelta, 1.f);
+    }
+
+    return age * influence - p->mDistance*0.1f;
 }
 
 // return true if a is higher priority for an update than b
@@ -278,8 +292,55 @@ void LLReflectionMapManager::update()
 
     static LLCachedControl<S32> sDetail(gSavedSettings, "RenderReflectionProbeDetail", -1);
     static LLCachedControl<S32> sLevel(gSavedSettings, "RenderReflectionProbeLevel", 3);
+    static LLCachedControl<F32> sUpdateBudget(gSavedSettings, "RenderReflectionProbeUpdateBudget", 1.5f);
 
     bool realtime = sDetail >= (S32)LLReflectionMapManager::DetailLevel::REALTIME;
+    bool time_sliced = sUpdateBudget > 0.f;
+
+    // harvest the GPU time of the last measured update step and accrue this
+    // frame's budget
+    if (mUpdateTimerPending)
+    {
+        GLuint available = 0;
+        glGetQueryObjectuiv(mUpdateTimerQuery[1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available)
+        {
+            GLuint64 t0 = 0;
+            GLuint64 t1 = 0;
+            glGetQueryObjectui64v(mUpdateTimerQuery[0], GL_QUERY_RESULT, &t0);
+            glGetQueryObjectui64v(mUpdateTimerQuery[1], GL_QUERY_RESULT, &t1);
+            F32 ms = (F32)((t1 - t0) / 1000000.0);
+            mUpdateCostMs = mUpdateCostMs * 0.75f + ms * 0.25f;
+            mUpdateTimerPending = false;
+        }
+    }
+    mUpdateCredit = llmin(mUpdateCredit + sUpdateBudget, sUpdateBudget * 4.f);
+
+    // a step is allowed when the accrued credit covers the expected GPU cost
+    // of one face render (or pacing is disabled)
+    bool step_allowed = !time_sliced || mUpdateCredit >= mUpdateCostMs;
+
+    // run one probe update step inside a timestamp query pair and charge the
+    // expected cost against the credit
+    auto timed_probe_update = [&]()
+    {
+        bool measure = time_sliced && !mUpdateTimerPending;
+        if (measure)
+        {
+            if (mUpdateTimerQuery[0] == 0)
+            {
+                glGenQueries(2, mUpdateTimerQuery);
+            }
+            glQueryCounter(mUpdateTimerQuery[0], GL_TIMESTAMP);
+        }
+        doProbeUpdate();
+        if (measure)
+        {
+            glQueryCounter(mUpdateTimerQuery[1], GL_TIMESTAMP);
+            mUpdateTimerPending = true;
+        }
+        mUpdateCredit -= mUpdateCostMs;
+    };
 
     LLReflectionMap* closestDynamic = nullptr;
 
@@ -288,8 +349,13 @@ void LLReflectionMapManager::update()
 
     if (mUpdatingProbe != nullptr)
     {
+        // over budget, hold the in-flight probe where it is rather than
+        // letting the scheduler start another one
         did_update = true;
-        doProbeUpdate();
+        if (step_allowed)
+        {
+            timed_probe_update();
+        }
     }
 
     // update distance to camera for all probes
@@ -388,7 +454,18 @@ void LLReflectionMapManager::update()
         }
         else
         {
+            // probes whose last update changed their irradiance by less than
+            // the threshold are "settled" -- re-render them on a slow cadence
+            // instead of competing with probes that are visibly changing
+            static LLCachedControl<F32> sDeltaThreshold(gSavedSettings, "RenderReflectionProbeDeltaThreshold", 0.02f);
+            constexpr F32 SETTLED_UPDATE_PERIOD = 20.f; // seconds
+            bool settled = probe->mComplete &&
+                probe->mIrradianceDelta >= 0.f &&
+                probe->mIrradianceDelta < sDeltaThreshold &&
+                (gFrameTimeSeconds - probe->mLastUpdateTime) < SETTLED_UPDATE_PERIOD;
+
             if (!did_update &&
+                !settled &&
                 i < mReflectionProbeCount &&
                 (oldestProbe == nullptr ||
                     check_priority(probe, oldestProbe)))
@@ -441,7 +518,7 @@ void LLReflectionMapManager::update()
     }
 
     // switch to updating the next oldest probe
-    if (!did_update && oldestProbe != nullptr)
+    if (!did_update && step_allowed && oldestProbe != nullptr)
     {
         LLReflectionMap* probe = oldestProbe;
         llassert(probe->mCubeIndex != -1);
@@ -450,7 +527,7 @@ void LLReflectionMapManager::update()
 
         sUpdateCount++;
         mUpdatingProbe = probe;
-        doProbeUpdate();
+        timed_probe_update();
     }
 
     if (oldestOccluded)
@@ -638,11 +715,24 @@ void LLReflectionMapManager::doProbeUpdate()
     LL_PROFILE_ZONE_SCOPED_CATEGORY_DISPLAY;
     llassert(mUpdatingProbe != nullptr);
 
-    updateProbeFace(mUpdatingProbe, mUpdatingFace);
+    static LLCachedControl<F32> sUpdateBudget(gSavedSettings, "RenderReflectionProbeUpdateBudget", 1.5f);
+    bool time_sliced = sUpdateBudget > 0.f;
+
+    if (mUpdatingFace < 6)
+    {
+        // when time sliced, the post-face-5 convolution becomes its own step
+        // on a later frame instead of piling onto the sixth face render
+        updateProbeFace(mUpdatingProbe, mUpdatingFace, time_sliced);
+    }
+    else
+    {
+        convolveProbe(mUpdatingProbe);
+    }
 
     bool debug_updates = gPipeline.hasRenderDebugMask(LLPipeline::RENDER_DEBUG_PROBE_UPDATES) && mUpdatingProbe->mViewerObject;
 
-    if (++mUpdatingFace == 6)
+    U32 pass_steps = time_sliced ? 7 : 6;
+    if (++mUpdatingFace >= pass_steps)
     {
         if (debug_updates)
         {
@@ -675,7 +765,7 @@ void LLReflectionMapManager::doProbeUpdate()
 // The next six passes render the scene with both radiance and irradiance into the same scratch space cube map and generate a simple mip chain.
 // At the end of these passes, a radiance map is generated for this probe and placed into the radiance cube map array at the index for this probe.
 // In effect this simulates single-bounce lighting.
-void LLReflectionMapManager::updateProbeFace(LLReflectionMap* probe, U32 face)
+void LLReflectionMapManager::updateProbeFace(LLReflectionMap* probe, U32 face, bool defer_convolve)
 {
     // hacky hot-swap of camera specific render targets
     gPipeline.mRT = &gPipeline.mAuxillaryRT;
@@ -815,7 +905,23 @@ void LLReflectionMapManager::updateProbeFace(LLReflectionMap* probe, U32 face)
         gReflectionMipProgram.unbind();
     }
 
-    if (face == 5)
+    if (face == 5 && !defer_convolve)
+    {
+        convolveProbe(probe);
+    }
+}
+
+void LLReflectionMapManager::convolveProbe(LLReflectionMap* probe)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_DISPLAY;
+
+    S32 sourceIdx = mReflectionProbeCount;
+
+    if (probe != mUpdatingProbe)
+    { // this is the "realtime" probe that's updating every frame, use the secondary scratch space channel
+        sourceIdx += 1;
+    }
+
     {
         mMipChain[0].bindTarget();
         static LLStaticHashedString sSourceIdx("sourceIdx");
@@ -910,6 +1016,28 @@ void LLReflectionMapManager::updateProbeFace(LLReflectionMap* probe, U32 face)
                     glCopyTexSubImage3D(GL_TEXTURE_CUBE_MAP_ARRAY, i - start_mip, 0, 0, probe->mCubeIndex * 6 + cf, 0, 0, res, res);
                     mTexture->bind(channel);
                 }
+
+                // sample the freshly generated irradiance (last rendered face,
+                // still in the bound target) to estimate how much this update
+                // actually changed the probe; feeds the update scheduler
+                {
+                    S32 res = mMipChain[i].getWidth();
+                    std::vector<F32> pixels(res * res * 3);
+                    glReadPixels(0, 0, res, res, GL_RGB, GL_FLOAT, pixels.data());
+
+                    F32 avg = 0.f;
+                    for (F32 v : pixels)
+                    {
+                        avg += v;
+                    }
+                    avg /= (F32)pixels.size();
+
+                    if (probe->mLastIrradianceAvg >= 0.f)
+                    {
+                        probe->mIrradianceDelta = fabsf(avg - probe->mLastIrradianceAvg) / llmax(probe->mLastIrradianceAvg, 0.01f);
+                    }
+                    probe->mLastIrradianceAvg = avg;
+                }
             }
         }
 
@@ -158,8 +158,14 @@ private:
     // perform an update on the currently updating Probe
     void doProbeUpdate();
 
-    // update the specified face of the specified probe
-    void updateProbeFace(LLReflectionMap* probe, U32 face);
+    // update the specified face of the specified probe.  When defer_convolve
+    // is set the mip convolution normally done after face 5 is left for a
+    // later doProbeUpdate() step instead of running in the same frame.
+    void updateProbeFace(LLReflectionMap* probe, U32 face, bool defer_convolve = false);
+
+    // generate the radiance or irradiance map for the given probe from the
+    // scratch cubemap filled by the previous six updateProbeFace calls
+    void convolveProbe(LLReflectionMap* probe);
 
     // list of active reflection maps
     std::vector<LLPointer<LLReflectionMap> > mProbes;
@@ -204,6 +210,14 @@ private:
     // amount to scale local lights during an irradiance map update (set during updateProbeFace and used by LLPipeline)
     F32 mLightScale = 1.f;
 
+    // GPU budget pacing for probe update steps (RenderReflectionProbeUpdateBudget).
+    // Timestamp query pair measuring one update step; results feed an EMA of
+    // per-step cost which is charged against a per-frame time credit.
+    U32 mUpdateTimerQuery[2] = { 0, 0 };
+    bool mUpdateTimerPending = false;
+    F32 mUpdateCostMs = 0.5f;
+    F32 mUpdateCredit = 0.f;
+
     // if true, reset all probe render state on the next update (for teleports and sky changes)
     bool mReset = false;
 
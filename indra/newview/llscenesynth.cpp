@@ -0,0 +1,209 @@
+/**
+ * @file llscenesynth.cpp
+ * @brief Synthetic scene generator for local stress testing
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "llviewerprecompiledheaders.h"
+
+#include "llscenesynth.h"
+
+#include "llagent.h"
+#include "llanimationstates.h"
+#include "llrand.h"
+#include "llviewercontrol.h"
+#include "llviewerobjectlist.h"
+#include "llviewerpartsim.h"
+#include "llviewerpartsource.h"
+#include "llviewerregion.h"
+#include "llvoavatar.h"
+#include "llvovolume.h"
+#include "pipeline.h"
+
+LLSceneSynth gSceneSynth;
+
+// random point in a disc of the given radius around the agent, lifted a
+// little so content doesn't spawn inside the ground
+static LLVector3 synth_position(F32 radius)
+{
+    F32 angle = ll_frand(F_TWO_PI);
+    F32 dist = radius * (F32)sqrt(ll_frand());
+    LLVector3 pos = gAgent.getPositionAgent();
+    pos.mV[VX] += dist * cosf(angle);
+    pos.mV[VY] += dist * sinf(angle);
+    pos.mV[VZ] += 0.5f + ll_frand(4.f);
+    return pos;
+}
+
+LLSceneSynth::LLSceneSynth()
+{
+}
+
+LLSceneSynth::~LLSceneSynth()
+{
+    // objects and part sources die with the region/pipeline at shutdown;
+    // don't touch them from a static destructor
+}
+
+void LLSceneSynth::spawn()
+{
+    if (!gAgent.getRegion())
+    {
+        LL_WARNS("SceneSynth") << "no region, can't spawn synthetic scene" << LL_ENDL;
+        return;
+    }
+
+    clear();
+
+    S32 volumes = gSavedSettings.getS32("SyntheticSceneVolumes");
+    S32 avatars = gSavedSettings.getS32("SyntheticSceneAvatars");
+    S32 particles = gSavedSettings.getS32("SyntheticSceneParticles");
+    F32 radius = llmax(1.f, gSavedSettings.getF32("SyntheticSceneRadius"));
+
+    spawnVolumes(volumes, radius);
+    spawnAvatars(avatars, radius);
+    spawnParticles(particles, radius);
+
+    LL_INFOS("SceneSynth") << "spawned synthetic scene: " << volumes << " volumes, "
+        << avatars << " avatars, " << particles << " particle sources in a "
+        << radius << "m radius" << LL_ENDL;
+}
+
+void LLSceneSynth::clear()
+{
+    if (!isActive())
+    {
+        return;
+    }
+
+    for (std::vector<LLPointer<LLViewerPartSource> >::iterator iter = mPartSources.begin();
+         iter != mPartSources.end(); ++iter)
+    {
+        (*iter)->setDead();
+    }
+    mPartSources.clear();
+
+    for (std::vector<LLPointer<LLViewerObject> >::iterator iter = mObjects.begin();
+         iter != mObjects.end(); ++iter)
+    {
+        (*iter)->markDead();
+    }
+
+    LL_INFOS("SceneSynth") << "cleared " << mObjects.size() << " synthetic objects" << LL_ENDL;
+    mObjects.clear();
+}
+
+void LLSceneSynth::spawnVolumes(S32 count, F32 radius)
+{
+    for (S32 i = 0; i < count; i++)
+    {
+        LLVOVolume* vobj = (LLVOVolume*)gObjectList.createObjectViewer(LL_PCODE_VOLUME, gAgent.getRegion());
+        if (!vobj)
+        {
+            break;
+        }
+
+        // cycle through box/cylinder/sphere/torus so the batcher sees a
+        // realistic mix of triangle counts and LOD behavior
+        LLVolumeParams volume_params;
+        switch (i % 4)
+        {
+            case 0:
+                volume_params.setType(LL_PCODE_PROFILE_SQUARE, LL_PCODE_PATH_LINE);
+                break;
+            case 1:
+                volume_params.setType(LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_LINE);
+                break;
+            case 2:
+                volume_params.setType(LL_PCODE_PROFILE_CIRCLE_HALF, LL_PCODE_PATH_CIRCLE);
+                break;
+            default:
+                volume_params.setType(LL_PCODE_PROFILE_CIRCLE, LL_PCODE_PATH_CIRCLE);
+                volume_params.setRatio(0.25f, 0.25f);
+                break;
+        }
+        volume_params.setBeginAndEndS(0.f, 1.f);
+        volume_params.setBeginAndEndT(0.f, 1.f);
+        vobj->setVolume(volume_params, 0);
+
+        F32 dim = 0.25f + ll_frand(3.75f);
+        vobj->setScale(LLVector3(dim, dim, dim * (0.5f + ll_frand(1.5f))));
+        vobj->setPositionAgent(synth_position(radius));
+
+        for (U8 te = 0; te < vobj->getNumTEs(); te++)
+        {
+            vobj->setTEColor(te, LLColor4(ll_frand(), ll_frand(), ll_frand(), 1.f));
+        }
+        // sprinkle in the material flags that select different render passes
+        if (i % 5 == 0)
+        {
+            vobj->setTEFullbright(0, 1);
+        }
+        if (i % 7 == 0)
+        {
+            vobj->setTEShiny(0, 1);
+        }
+        if (i % 11 == 0)
+        {
+            vobj->setTEGlow(0, 0.1f);
+        }
+
+        gPipeline.createObject(vobj);
+        mObjects.push_back(vobj);
+    }
+}
+
+void LLSceneSynth::spawnAvatars(S32 count, F32 radius)
+{
+    for (S32 i = 0; i < count; i++)
+    {
+        // UI avatars are purely viewer-side (no appearance messages
+        // expected) and render the skinned system meshes as-is, which is
+        // what we want to scale the skinning load
+        LLVOAvatar* avatar = (LLVOAvatar*)gObjectList.createObjectViewer(
+            LL_PCODE_LEGACY_AVATAR, gAgent.getRegion(), LLViewerObject::CO_FLAG_UI_AVATAR);
+        if (!avatar)
+        {
+            break;
+        }
+
+        avatar->setPositionAgent(synth_position(radius));
+        gPipeline.createObject(avatar);
+        avatar->updateOverallAppearance();
+        // keep joints moving so skinning isn't measured at rest
+        avatar->startMotion(i % 2 ? ANIM_AGENT_DANCE1 : ANIM_AGENT_STAND);
+
+        mObjects.push_back(avatar);
+    }
+}
+
+void LLSceneSynth::spawnParticles(S32 count, F32 radius)
+{
+    for (S32 i = 0; i < count; i++)
+    {
+        LLPointer<LLViewerPartSourceSpiral> pss = new LLViewerPartSourceSpiral(synth_position(radius));
+        pss->setColor(LLColor4(ll_frand(), ll_frand(), ll_frand(), 1.f));
+        LLViewerPartSim::getInstance()->addPartSource(pss);
+        mPartSources.push_back(pss);
+    }
+}
@@ -0,0 +1,70 @@
+/**
+ * @file llscenesynth.h
+ * @brief Synthetic scene generator for local stress testing
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLSCENESYNTH_H
+#define LL_LLSCENESYNTH_H
+
+#include "stdtypes.h"
+#include "llpointer.h"
+
+#include <vector>
+
+class LLViewerObject;
+class LLViewerPartSource;
+
+// Procedurally spawns viewer-local content around the agent at a scale set
+// by the SyntheticScene* debug settings: volumes with a mix of profiles,
+// scales and material flags, UI-avatar clones running looped animations, and
+// particle sources. Nothing is sent to the simulator; everything is torn
+// down again by clear(). Pair with the agent pilot's replay-session mode
+// (and SyntheticSceneAutoSpawn) for repeatable culling/batching/skinning
+// benchmarks without shipping real venue content to a test region.
+
+class LLSceneSynth
+{
+public:
+    LLSceneSynth();
+    ~LLSceneSynth();
+
+    // spawn content per the SyntheticScene* settings; clears any previous
+    // synthetic scene first
+    void spawn();
+    void clear();
+
+    bool isActive() const { return !mObjects.empty() || !mPartSources.empty(); }
+
+private:
+    void spawnVolumes(S32 count, F32 radius);
+    void spawnAvatars(S32 count, F32 radius);
+    void spawnParticles(S32 count, F32 radius);
+
+    std::vector<LLPointer<LLViewerObject> > mObjects;
+    std::vector<LLPointer<LLViewerPartSource> > mPartSources;
+};
+
+extern LLSceneSynth gSceneSynth;
+
+#endif // LL_LLSCENESYNTH_H
@@ -45,7 +45,10 @@ LLScriptEditor::Params::Params()
 LLScriptEditor::LLScriptEditor(const Params& p)
 :   LLTextEditor(p)
 ,   mShowLineNumbers(p.show_line_numbers),
-    mUseDefaultFontSize(p.default_font_size)
+    mUseDefaultFontSize(p.default_font_size),
+    mPendingEditStart(S32_MAX),
+    mPendingEditEnd(-1),
+    mPendingEditCount(0)
 {
     if (mShowLineNumbers)
     {
@@ -162,6 +165,20 @@ void LLScriptEditor::loadKeywords()
     {
         insert_it = mSegments.insert(insert_it, *list_it);
     }
+
+    mPendingEditStart = S32_MAX;
+    mPendingEditEnd = -1;
+    mPendingEditCount = 0;
+}
+
+void LLScriptEditor::onValueChange(S32 start, S32 end)
+{
+    mPendingEditStart = llmin(mPendingEditStart, start);
+    mPendingEditEnd = llmax(mPendingEditEnd, end);
+    // compound edits shift each other's coordinates; rather than track
+    // that, a second edit before the next syntax pass forces a full one
+    ++mPendingEditCount;
+    LLTextEditor::onValueChange(start, end);
 }
 
 void LLScriptEditor::updateSegments()
@@ -174,13 +191,50 @@ void LLScriptEditor::updateSegments()
 
         // HACK:  No non-ascii keywords for now
         segment_vec_t segment_list;
-        mKeywords.findSegments(&segment_list, getWText(), *this, style);
+        S32 restart = 0;
+        S32 splice = -1;
+        if (mPendingEditCount == 1
+            && mPendingEditStart <= mPendingEditEnd
+            && mKeywords.findSegmentsIncremental(&segment_list, getWText(), *this, style,
+                                                 mPendingEditStart, mPendingEditEnd,
+                                                 &restart, &splice))
+        {
+            // drop the old segments inside the re-lexed window and
+            // splice in the fresh ones; segments on either side carry
+            // over with offsets already adjusted by the edit itself
+            segment_set_t::iterator seg_iter = mSegments.begin();
+            while (seg_iter != mSegments.end())
+            {
+                const S32 seg_start = (*seg_iter)->getStart();
+                if (splice >= 0 && seg_start >= splice)
+                {
+                    break;
+                }
+                if (seg_start >= restart)
+                {
+                    seg_iter = mSegments.erase(seg_iter);
+                }
+                else
+                {
+                    ++seg_iter;
+                }
+            }
+        }
+        else
+        {
+            segment_list.clear();
+            mKeywords.findSegments(&segment_list, getWText(), *this, style);
+            clearSegments();
+        }
 
-        clearSegments();
         for (segment_vec_t::iterator list_it = segment_list.begin(); list_it != segment_list.end(); ++list_it)
         {
             insertSegment(*list_it);
         }
+
+        mPendingEditStart = S32_MAX;
+        mPendingEditEnd = -1;
+        mPendingEditCount = 0;
     }
 
     LLTextBase::updateSegments();
@@ -47,6 +47,10 @@ public:
     virtual void    draw();
     bool postBuild();
 
+    // LLTextBase override; accumulates the changed window driving the
+    // incremental re-lex in updateSegments()
+    /* virtual */ void  onValueChange(S32 start, S32 end);
+
     void    initKeywords();
     void    loadKeywords();
     /* virtual */ void  clearSegments();
@@ -71,6 +75,12 @@ private:
     LLKeywords  mKeywords;
     bool        mShowLineNumbers;
     bool mUseDefaultFontSize;
+
+    // changed window since the last syntax pass, in current-text
+    // coordinates; more than one edit per pass forces a full re-lex
+    S32         mPendingEditStart;
+    S32         mPendingEditEnd;
+    S32         mPendingEditCount;
 };
 
 #endif // LL_SCRIPTEDITOR_H
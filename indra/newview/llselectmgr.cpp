@@ -623,7 +623,6 @@ LLObjectSelectionHandle LLSelectMgr::selectObjectAndFamily(const std::vector<LLV
         if (!canSelectObject(object)) continue;
 
         object->addThisAndNonJointChildren(objects);
-        addAsFamily(objects);
 
         // Stop the object from moving (this anticipates changes on the
         // simulator in LLTask::userSelect)
@@ -633,6 +632,12 @@ LLObjectSelectionHandle LLSelectMgr::selectObjectAndFamily(const std::vector<LLV
         object->resetRot();
     }
 
+    // Add the accumulated families in one pass.  Calling addAsFamily() once
+    // per root re-iterated the entire accumulated list (and re-saved every
+    // selected object's transform) for each root, which made select-all on
+    // large builds quadratic in the number of prims.
+    addAsFamily(objects);
+
     updateSelectionCenter();
     saveSelectedObjectTransform(SELECT_ACTION_TYPE_PICK);
     updatePointAt();
@@ -1085,6 +1090,9 @@ void LLSelectMgr::addAsIndividual(LLViewerObject *objectp, S32 face, bool undoab
 
     }
 
+    // the node may have been in the selection already with different faces
+    mSelectedObjects->invalidateStatistics();
+
     saveSelectedObjectTransform(SELECT_ACTION_TYPE_PICK);
     updateSelectionCenter();
     dialog_refresh_all();
@@ -1533,6 +1541,7 @@ void LLSelectMgr::remove(LLViewerObject *objectp, S32 te, bool undoable)
         {
             nodep->selectTE(te, false);
             objectp->setTESelected(te, false);
+            mSelectedObjects->invalidateStatistics();
         }
         else
         {
@@ -7727,7 +7736,9 @@ bool LLObjectSelection::is_root_object::operator()(LLSelectNode *node)
 
 LLObjectSelection::LLObjectSelection() :
     LLRefCount(),
-    mSelectType(SELECT_TYPE_WORLD)
+    mSelectType(SELECT_TYPE_WORLD),
+    mCachedTECount(0),
+    mStatsDirty(true)
 {
 }
 
@@ -7746,6 +7757,7 @@ void LLObjectSelection::cleanupNodes()
         {
             mList.erase(curiter);
             delete node;
+            mStatsDirty = true;
         }
     }
 }
@@ -7764,6 +7776,7 @@ void LLObjectSelection::addNode(LLSelectNode *nodep)
     llassert_always(nodep->getObject() && !nodep->getObject()->isDead());
     mList.push_front(nodep);
     mSelectNodeMap[nodep->getObject()] = nodep;
+    mStatsDirty = true;
 }
 
 void LLObjectSelection::addNodeAtEnd(LLSelectNode *nodep)
@@ -7771,6 +7784,7 @@ void LLObjectSelection::addNodeAtEnd(LLSelectNode *nodep)
     llassert_always(nodep->getObject() && !nodep->getObject()->isDead());
     mList.push_back(nodep);
     mSelectNodeMap[nodep->getObject()] = nodep;
+    mStatsDirty = true;
 }
 
 void LLObjectSelection::moveNodeToFront(LLSelectNode *nodep)
@@ -7788,6 +7802,7 @@ void LLObjectSelection::removeNode(LLSelectNode *nodep)
     }
     nodep->setObject(NULL); // Will get erased in cleanupNodes()
     mList.remove(nodep);
+    mStatsDirty = true;
 }
 
 void LLObjectSelection::deleteAllNodes()
@@ -7796,6 +7811,7 @@ void LLObjectSelection::deleteAllNodes()
     mList.clear();
     mSelectNodeMap.clear();
     mPrimaryObject = NULL;
+    mStatsDirty = true;
 }
 
 LLSelectNode* LLObjectSelection::findNode(LLViewerObject* objectp)
@@ -8050,23 +8066,28 @@ S32 LLObjectSelection::getSelectedObjectRenderCost()
 //-----------------------------------------------------------------------------
 S32 LLObjectSelection::getTECount()
 {
-    S32 count = 0;
-    for (LLObjectSelection::iterator iter = begin(); iter != end(); iter++)
+    if (mStatsDirty)
     {
-        LLSelectNode* node = *iter;
-        LLViewerObject* object = node->getObject();
-        if (!object)
-            continue;
-        S32 num_tes = object->getNumTEs();
-        for (S32 te = 0; te < num_tes; te++)
+        S32 count = 0;
+        for (LLObjectSelection::iterator iter = begin(); iter != end(); iter++)
         {
-            if (node->isTESelected(te))
+            LLSelectNode* node = *iter;
+            LLViewerObject* object = node->getObject();
+            if (!object)
+                continue;
+            S32 num_tes = object->getNumTEs();
+            for (S32 te = 0; te < num_tes; te++)
             {
-                ++count;
+                if (node->isTESelected(te))
+                {
+                    ++count;
+                }
             }
         }
+        mCachedTECount = count;
+        mStatsDirty = false;
     }
-    return count;
+    return mCachedTECount;
 }
 
 //-----------------------------------------------------------------------------
@@ -357,6 +357,12 @@ public:
     S32 getTECount();
     S32 getRootObjectCount();
 
+    // The selected-face count is queried every frame by the build tools UI;
+    // it is cached and only recomputed after the selection is mutated.
+    // Call this when flipping TE selection flags on a node that is already
+    // in the selection -- add/remove/clear invalidate automatically.
+    void invalidateStatistics() { mStatsDirty = true; }
+
     bool isMultipleTESelected();
     bool contains(LLViewerObject* object);
     bool contains(LLViewerObject* object, S32 te);
@@ -414,6 +420,10 @@ private:
     LLPointer<LLViewerObject> mPrimaryObject;
     std::map<LLPointer<LLViewerObject>, LLSelectNode*> mSelectNodeMap;
     ESelectType mSelectType;
+
+    // see invalidateStatistics()
+    S32 mCachedTECount;
+    bool mStatsDirty;
 };
 
 typedef LLSafeHandle<LLObjectSelection> LLObjectSelectionHandle;
@@ -366,7 +366,7 @@ void LLSpatialPartition::rebuildGeom(LLSpatialGroup* group)
             group->mBuilt = 1.f;
             if (group->mVertexBuffer.isNull() ||
                 group->mVertexBuffer->getNumVerts() != vertex_count ||
-                group->mVertexBuffer->getNumVerts() != index_count)
+                group->mVertexBuffer->getNumIndices() != index_count)
             {
                 group->mVertexBuffer = new LLVertexBuffer(mVertexDataMask);
                 if (!group->mVertexBuffer->allocateBuffer(vertex_count, index_count))
@@ -1001,6 +1001,27 @@ void LLSpatialPartition::move(LLDrawable *drawablep, LLSpatialGroup *curp, bool
 
     //keep drawable from being garbage collected
     LLPointer<LLDrawable> ptr = drawablep;
+
+    static LLCachedControl<bool> incremental_reinsert(gSavedSettings, "OctreeIncrementalReinsert", false);
+    if (incremental_reinsert && curp && curp->getOctreeNode() && drawablep->getEntry())
+    {
+        //relocate within the octree -- walks up from the current node only
+        //as far as the new bounds require instead of removing and
+        //reinserting from the root
+        drawablep->updateSpatialExtents();
+        if (curp->getOctreeNode()->relocate(drawablep->getEntry()))
+        { //NOTE: curp may have been pruned by relocate, do not touch it
+            LLSpatialGroup* group = drawablep->getSpatialGroup();
+            if (group && was_visible && group->isOcclusionState(LLSpatialGroup::QUERY_PENDING))
+            {
+                group->setOcclusionState(LLSpatialGroup::DISCARD_QUERY, LLSpatialGroup::STATE_MODE_ALL_CAMERAS);
+            }
+
+            assert_octree_valid(mOctree);
+            return;
+        }
+    }
+
     if (curp && !remove(drawablep, curp))
     {
         OCT_ERRS << "Move couldn't find existing spatial group!" << LL_ENDL;
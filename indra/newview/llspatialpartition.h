@@ -30,6 +30,7 @@
 #define SG_MIN_DIST_RATIO 0.00001f
 
 #include "lldrawable.h"
+#include "llobjectpool.h"
 #include "lloctree.h"
 #include "llpointer.h"
 #include "llrefcount.h"
@@ -66,7 +67,7 @@ void pushVerts(LLFace* face);
 */
 class LLDrawInfo final : public LLRefCount
 {
-    LL_ALIGN_NEW;
+    LL_OBJECT_POOL_NEW(LLDrawInfo);
 protected:
     ~LLDrawInfo();
 
@@ -367,6 +368,13 @@ public:
     //used by LLVOAVatar to set render order in alpha draw pool to preserve legacy render order behavior
     LLVOAvatar* mAvatarp = nullptr;
     U32 mRenderOrder = 0;
+    // per-frame throttle for LOD-change rebuilds while the camera moves;
+    // see LLVOVolume::calcLOD()
+    U32 mLODChangeFrame = 0;
+    U32 mLODChangeCount = 0;
+    // frame this group entered the pipeline's priority build queue; used
+    // to age deferred rebuilds (see LLPipeline::rebuildPriorityGroups)
+    U32 mRebuildQueueFrame = 0;
     // Reflection Probe associated with this node (if any)
     LLPointer<LLReflectionMap> mReflectionProbe = nullptr;
 } LL_ALIGN_POSTFIX(16);
@@ -371,6 +371,20 @@ void LLSpeakerMgr::update(bool resort_ok)
     static const LLUIColor speaking_color = LLUIColorTable::instance().getColor("SpeakingColor");
     static const LLUIColor overdriven_color = LLUIColorTable::instance().getColor("OverdrivenColor");
 
+    // announce chat activity accumulated since the last pass
+    if (!mPendingChattedSpeakers.empty())
+    {
+        for (const LLUUID& speaker_id : mPendingChattedSpeakers)
+        {
+            LLPointer<LLSpeaker> speakerp = findSpeaker(speaker_id);
+            if (speakerp.notNull())
+            {
+                fireEvent(new LLSpeakerUpdateSpeakerEvent(speakerp), "update_speaker");
+            }
+        }
+        mPendingChattedSpeakers.clear();
+    }
+
     if(resort_ok) // only allow list changes when user is not interacting with it
     {
         updateSpeakerList();
@@ -649,7 +663,10 @@ void LLSpeakerMgr::speakerChatted(const LLUUID& speaker_id)
     {
         speakerp->mLastSpokeTime = mSpeechTimer.getElapsedTimeF32();
         speakerp->mHasSpoken = true;
-        fireEvent(new LLSpeakerUpdateSpeakerEvent(speakerp), "update_speaker");
+        // defer the "update_speaker" event to the next update() pass; a chat
+        // storm then refreshes each speaker's row once per frame instead of
+        // once per message
+        mPendingChattedSpeakers.insert(speaker_id);
     }
 }
 
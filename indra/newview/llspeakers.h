@@ -263,6 +263,9 @@ protected:
     LLTimer             mGetListTime;
 
     speaker_list_t      mSpeakersSorted;
+    // chat activity queued by speakerChatted() and announced in one batch
+    // from update()
+    uuid_set_t          mPendingChattedSpeakers;
     LLFrameTimer        mSpeechTimer;
     LLVoiceChannel*     mVoiceChannel;
 
@@ -129,6 +129,7 @@
 #include "llproxy.h"
 #include "llproductinforequest.h"
 #include "llqueryflags.h"
+#include "llscenesynth.h"
 #include "llsecapi.h"
 #include "llselectmgr.h"
 #include "llsky.h"
@@ -538,6 +539,13 @@ bool idle_startup()
             const LLUseCircuitCodeResponder* responder = NULL;
             bool failure_is_fatal = true;
 
+            // drain multiple datagrams per syscall on platforms that
+            // support it; must be set before the first receivePacket()
+            LLPacketRing::sUseBatchReceive = gSavedSettings.getBOOL("UDPBatchedReceive");
+
+            // likewise batch outbound datagrams into one syscall per flush
+            LLPacketRing::sUseBatchSend = gSavedSettings.getBOOL("UDPBatchedSend");
+
             if(!start_messaging_system(
                    message_template_path,
                    port,
@@ -2349,6 +2357,13 @@ bool idle_startup()
         // Have the agent start watching the friends list so we can update proxies
         gAgent.observeFriends();
 
+        // Spawn the synthetic stress-test scene before any automatic
+        // benchmark replay starts, so the pilot measures it.
+        if (gSavedSettings.getBOOL("SyntheticSceneAutoSpawn"))
+        {
+            gSceneSynth.spawn();
+        }
+
         // Start automatic replay if the flag is set.
         if (gSavedSettings.getBOOL("StatsAutoRun") || gAgentPilot.getReplaySession())
         {
@@ -2990,6 +3005,25 @@ std::string LLStartUp::startupStateToString(EStartupState state)
 #undef RTNENUM
 }
 
+// Dump how long each startup state took once login completes, and fold the
+// values into the phase stats that ride along with viewer stats, so slow
+// phases show up in the logs instead of needing a profiler run.
+static void log_startup_phase_timings()
+{
+    LLViewerStats::PhaseMap& phases = LLStartUp::getPhases();
+    LL_INFOS("AppInit") << "Startup phase timings (seconds):" << LL_ENDL;
+    for (LLViewerStats::phase_map_t::iterator it = phases.begin(); it != phases.end(); ++it)
+    {
+        F32 elapsed = 0.f;
+        bool completed = false;
+        if (phases.getPhaseValues(it->first, elapsed, completed) && completed)
+        {
+            LL_INFOS("AppInit") << "  " << it->first << ": " << elapsed << LL_ENDL;
+            LLViewerStats::PhaseMap::recordPhaseStat(it->first, elapsed);
+        }
+    }
+}
+
 // static
 void LLStartUp::setStartupState( EStartupState state )
 {
@@ -3001,6 +3035,11 @@ void LLStartUp::setStartupState( EStartupState state )
     gStartupState = state;
     getPhases().startPhase(getStartupStateString());
 
+    if (STATE_STARTED == state)
+    {
+        log_startup_phase_timings();
+    }
+
     postStartupState();
 }
 
@@ -35,6 +35,8 @@
 #include "patch_dct.h"
 #include "patch_code.h"
 #include "llbitpack.h"
+#include "llfilesystem.h"
+#include "llmd5.h"
 #include "llviewerobjectlist.h"
 #include "llregionhandle.h"
 #include "llagent.h"
@@ -705,6 +707,142 @@ void LLSurface::decompressDCTPatch(LLBitPack &bitpack, LLGroupHeader *gopp, bool
     }
 }
 
+void LLSurface::applyDecodedPatch(const S32 patch_i, const S32 patch_j,
+                                  const S32 patch_size, const F32 *heights)
+{
+    if ((patch_i >= mPatchesPerEdge) || (patch_j >= mPatchesPerEdge)
+        || (patch_size > (S32)mGridsPerPatchEdge))
+    {
+        LL_WARNS() << "Dropping decoded terrain patch with invalid coordinates"
+            << " i " << patch_i
+            << " j " << patch_j
+            << " patch_size " << patch_size
+            << LL_ENDL;
+        return;
+    }
+
+    LLSurfacePatch *patchp = &mPatchList[patch_j*mPatchesPerEdge + patch_i];
+
+    // Re-stride the dense worker-side buffer into the surface height grid.
+    F32 *dest = patchp->getDataZ();
+    for (S32 row = 0; row < patch_size; row++)
+    {
+        memcpy(dest + row*mGridsPerEdge, heights + row*patch_size, patch_size*sizeof(F32));
+    }
+
+    // Update edges for neighbors.  Need to guarantee that this gets done before we generate vertical stats.
+    patchp->updateNorthEdge();
+    patchp->updateEastEdge();
+    if (patchp->getNeighborPatch(WEST))
+    {
+        patchp->getNeighborPatch(WEST)->updateEastEdge();
+    }
+    if (patchp->getNeighborPatch(SOUTHWEST))
+    {
+        patchp->getNeighborPatch(SOUTHWEST)->updateEastEdge();
+        patchp->getNeighborPatch(SOUTHWEST)->updateNorthEdge();
+    }
+    if (patchp->getNeighborPatch(SOUTH))
+    {
+        patchp->getNeighborPatch(SOUTH)->updateNorthEdge();
+    }
+
+    // Dirty patch statistics, and flag that the patch has data.
+    patchp->dirtyZ();
+    patchp->setHasReceivedData();
+}
+
+namespace
+{
+    const U32 TERRAIN_CACHE_MAGIC = 0x54455243;     // 'TERC'
+    const U32 TERRAIN_CACHE_VERSION = 1;
+    const LLUUID TERRAIN_CACHE_NAMESPACE("cdbb1d66-01e9-4b04-9c57-4d66b0b50ff8");
+
+    struct TerrainCacheHeader
+    {
+        U32 mMagic;
+        U32 mVersion;
+        S32 mGridsPerEdge;
+        S32 mPatchesPerEdge;
+    };
+
+    // Regions don't have a UUID until well after their surface exists, so the
+    // cache is keyed on a digest of the (stable) region handle instead.
+    LLUUID terrain_cache_id(const U64 region_handle)
+    {
+        LLUUID id;
+        LLMD5 md5;
+        md5.update((unsigned char *)&region_handle, sizeof(region_handle));
+        md5.finalize();
+        md5.raw_digest((unsigned char *)id.mData);
+        return id.combine(TERRAIN_CACHE_NAMESPACE);
+    }
+}
+
+bool LLSurface::loadFromDiskCache(const U64 region_handle)
+{
+    const LLUUID id = terrain_cache_id(region_handle);
+    if (!LLFileSystem::getExists(id, LLAssetType::AT_NONE))
+    {
+        return false;
+    }
+
+    LLFileSystem file(id, LLAssetType::AT_NONE, LLFileSystem::READ);
+    TerrainCacheHeader header;
+    const S32 grid_count = mGridsPerEdge * mGridsPerEdge;
+    if (!file.read((U8 *)&header, sizeof(header))
+        || header.mMagic != TERRAIN_CACHE_MAGIC
+        || header.mVersion != TERRAIN_CACHE_VERSION
+        || header.mGridsPerEdge != mGridsPerEdge
+        || header.mPatchesPerEdge != mPatchesPerEdge
+        || !file.read((U8 *)mSurfaceZ, grid_count*sizeof(F32)))
+    {
+        // Stale or truncated entry; drop it and wait for LayerData.
+        LLFileSystem::removeFile(id, LLAssetType::AT_NONE);
+        return false;
+    }
+
+    // Dirty every patch so normals, stats and the surface texture rebuild
+    // from the cached heights on the next idle updates.
+    for (S32 j = 0; j < mPatchesPerEdge; j++)
+    {
+        for (S32 i = 0; i < mPatchesPerEdge; i++)
+        {
+            LLSurfacePatch *patchp = &mPatchList[j*mPatchesPerEdge + i];
+            patchp->dirtyZ();
+            patchp->setHasReceivedData();
+        }
+    }
+
+    LL_DEBUGS("Terrain") << "Loaded cached terrain for region handle "
+        << region_handle << LL_ENDL;
+    return true;
+}
+
+void LLSurface::saveToDiskCache(const U64 region_handle) const
+{
+    if (!mHasZData || !mSurfaceZ)
+    {
+        return;
+    }
+
+    const LLUUID id = terrain_cache_id(region_handle);
+    LLFileSystem file(id, LLAssetType::AT_NONE, LLFileSystem::WRITE);
+
+    TerrainCacheHeader header;
+    header.mMagic = TERRAIN_CACHE_MAGIC;
+    header.mVersion = TERRAIN_CACHE_VERSION;
+    header.mGridsPerEdge = mGridsPerEdge;
+    header.mPatchesPerEdge = mPatchesPerEdge;
+
+    const S32 grid_count = mGridsPerEdge * mGridsPerEdge;
+    if (!file.write((U8 *)&header, sizeof(header))
+        || !file.write((U8 *)mSurfaceZ, grid_count*sizeof(F32)))
+    {
+        LLFileSystem::removeFile(id, LLAssetType::AT_NONE);
+    }
+}
+
 
 // Retrurns true if "position" is within the bounds of surface.
 // "position" is region-local
@@ -85,6 +85,17 @@ public:
     void disconnectAllNeighbors();
 
     virtual void decompressDCTPatch(LLBitPack &bitpack, LLGroupHeader *gopp, bool b_large_patch);
+
+    // Commit one patch that was DCT-decoded on a worker thread.  "heights" is
+    // patch_size * patch_size floats in patch-local row-major layout.
+    void applyDecodedPatch(const S32 patch_i, const S32 patch_j,
+                           const S32 patch_size, const F32 *heights);
+
+    // Decoded-terrain disk cache, keyed by region handle, so a region we have
+    // visited before shows correct terrain before LayerData packets arrive.
+    bool loadFromDiskCache(const U64 region_handle);
+    void saveToDiskCache(const U64 region_handle) const;
+
     virtual void updatePatchVisibilities(LLAgent &agent);
 
     inline F32 getZ(const U32 k) const              { return mSurfaceZ[k]; }
@@ -41,6 +41,7 @@
 #include "llvlcomposition.h"
 #include "lldrawpool.h"
 #include "noise.h"
+#include "workqueue.h"
 
 extern bool gShiftFrame;
 extern U64MicrosecondsImplicit gFrameTime;
@@ -85,6 +86,10 @@ LLSurfacePatch::LLSurfacePatch()
 
 LLSurfacePatch::~LLSurfacePatch()
 {
+    if (mHeightsJobCancel)
+    { // an in-flight heights job must not touch this patch once it is gone
+        *mHeightsJobCancel = true;
+    }
     mVObjp = NULL;
 }
 
@@ -104,6 +109,11 @@ void LLSurfacePatch::dirty()
 
     mDirtyZStats = true;
     mHeightsGenerated = false;
+    if (mHeightsJobCancel)
+    { // any in-flight heights job snapshotted the old surface data
+        *mHeightsJobCancel = true;
+        mHeightsJobCancel.reset();
+    }
 
     if (!mDirty)
     {
@@ -857,16 +867,43 @@ bool LLSurfacePatch::updateTexture()
             LLVLComposition* comp = regionp->getComposition();
             if (!mHeightsGenerated)
             {
-                F32 patch_size = meters_per_grid*(grids_per_patch_edge+1);
-                if (comp->generateHeights((F32)origin_region[VX], (F32)origin_region[VY],
-                                          patch_size, patch_size))
+                if (!mHeightsJobCancel)
                 {
-                    mHeightsGenerated = true;
-                }
-                else
-                {
-                    return false;
+                    F32 patch_size = meters_per_grid*(grids_per_patch_edge+1);
+                    LLVLComposition::heights_job_ptr_t job =
+                        comp->snapshotHeights((F32)origin_region[VX], (F32)origin_region[VY],
+                                              patch_size, patch_size);
+                    if (job)
+                    {
+                        // run the noise composition on the thread pool; the
+                        // result lands back here on a later frame unless the
+                        // patch is dirtied or destroyed in the meantime
+                        mHeightsJobCancel = std::make_shared<LLAtomicBool>(false);
+                        std::shared_ptr<LLAtomicBool> cancel = mHeightsJobCancel;
+                        LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+                        LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+                        main_queue->postTo(
+                            general_queue,
+                            [job]() // Work done on general queue
+                            {
+                                LLVLComposition::composeHeights(job);
+                                return true;
+                            },
+                            [this, job, cancel](bool) // Callback to main thread
+                            {
+                                if (*cancel)
+                                { // the snapshot went stale; a fresh job will be posted if still needed
+                                    return;
+                                }
+                                mHeightsJobCancel.reset();
+                                mSurfacep->getRegion()->getComposition()->applyHeights(job);
+                                mHeightsGenerated = true;
+                                // mSTexUpdate is still set, so the next
+                                // updateTexture pass picks up from here
+                            });
+                    }
                 }
+                return false;
             }
 
             if (comp->generateComposition())
@@ -30,6 +30,7 @@
 #include "v3math.h"
 #include "v3dmath.h"
 #include "llpointer.h"
+#include "llatomic.h"
 
 class LLSurface;
 class LLVOSurfacePatch;
@@ -161,6 +162,10 @@ protected:
     bool mDirty;
     bool mDirtyZStats;
     bool mHeightsGenerated;
+    // Non-null while a composition heights job for this patch is on the
+    // thread pool; set true to drop the result (stale inputs or the patch
+    // is going away).
+    std::shared_ptr<LLAtomicBool> mHeightsJobCancel;
 
     U32 mDataOffset;
     F32 *mDataZ;
@@ -592,6 +592,7 @@ private:
     LLCore::BufferArray *   mHttpBufferArray;           // Refcounted pointer to response data
     S32                     mHttpPolicyClass;
     bool                    mHttpActive;                // Active request to http library
+    bool                    mHttpPriorityCanceled;      // Canceled active request on priority collapse
     U32                     mHttpReplySize,             // Actual received data size
                             mHttpReplyOffset;           // Actual received data offset
     bool                    mHttpHasResource;           // Counts against Fetcher's mHttpSemaphore
@@ -905,6 +906,7 @@ LLTextureFetchWorker::LLTextureFetchWorker(LLTextureFetch* fetcher,
       mHttpBufferArray(NULL),
       mHttpPolicyClass(mFetcher->mHttpPolicyClass),
       mHttpActive(false),
+      mHttpPriorityCanceled(false),
       mHttpReplySize(0U),
       mHttpReplyOffset(0U),
       mHttpHasResource(false),
@@ -1062,6 +1064,16 @@ bool LLTextureFetchWorker::doWork(S32 param)
             LL_DEBUGS(LOG_TXT) << mID << " abort: mImagePriority < F_ALMOST_ZERO" << LL_ENDL;
             return true; // abort
         }
+        else if (mState == WAIT_HTTP_REQ && mHttpActive && !mLoaded && !mHttpPriorityCanceled)
+        {
+            // The texture went invisible mid-transfer; cancel the request
+            // rather than let a large body finish downloading. onCompleted
+            // delivers the canceled status and the normal WAIT_HTTP_REQ
+            // failure path cleans up, keeping any partial data.
+            LL_DEBUGS(LOG_TXT) << mID << " canceling HTTP GET: mImagePriority < F_ALMOST_ZERO" << LL_ENDL;
+            mHttpPriorityCanceled = true;
+            mFetcher->getHttpRequest().requestCancel(mHttpHandle, LLCore::HttpHandler::ptr_t());
+        }
     }
     if (mState > CACHE_POST && !mCanUseCapability && mCanUseHTTP)
     {
@@ -1156,6 +1168,10 @@ bool LLTextureFetchWorker::doWork(S32 param)
 
             add(LLTextureFetch::sCacheAttempt, 1.0);
 
+            // Map tile ids hash deterministically from the tile url, so
+            // cached entries survive sessions and map open/close.
+            static LLCachedControl<bool> map_tile_cache(gSavedSettings, "WorldMapTileDiskCache", true);
+
             if (mUrl.compare(0, 7, "file://") == 0)
             {
                 // read file from local disk
@@ -1166,7 +1182,8 @@ bool LLTextureFetchWorker::doWork(S32 param)
                 mCacheReadHandle = mFetcher->mTextureCache->readFromCache(filename, mID, offset, size, responder);
 
             }
-            else if ((mUrl.empty() || mFTType==FTT_SERVER_BAKE) && mFetcher->canLoadFromCache())
+            static LLCachedControl<bool> map_tile_cache(gSavedSettings, "WorldMapTileDiskCache", true);
+            else if ((mUrl.empty() || mFTType==FTT_SERVER_BAKE || (mFTType==FTT_MAP_TILE && map_tile_cache)) && mFetcher->canLoadFromCache())
             {
                 ++mCacheReadCount;
                 CacheReadResponder* responder = new CacheReadResponder(mFetcher, mID, mFormattedImage);
@@ -1315,6 +1332,14 @@ bool LLTextureFetchWorker::doWork(S32 param)
         {
             mWriteToCacheState = CAN_WRITE;
         }
+        else if (mFTType == FTT_MAP_TILE)
+        {
+            static LLCachedControl<bool> map_tile_cache(gSavedSettings, "WorldMapTileDiskCache", true);
+            if (map_tile_cache)
+            {
+                mWriteToCacheState = CAN_WRITE;
+            }
+        }
 
         if (mCanUseCapability && mCanUseHTTP && !mUrl.empty())
         {
@@ -1486,6 +1511,7 @@ bool LLTextureFetchWorker::doWork(S32 param)
         }
 
         mHttpActive = true;
+        mHttpPriorityCanceled = false;
         mFetcher->addToHTTPQueue(mID);
         recordTextureStart(true);
         setState(WAIT_HTTP_REQ);
@@ -1510,7 +1536,7 @@ bool LLTextureFetchWorker::doWork(S32 param)
                         LL_WARNS(LOG_TXT) << "Texture missing from server (404): " << mUrl << LL_ENDL;
                     }
 
-                    if(mWriteToCacheState == NOT_WRITE) //map tiles or server bakes
+                    if(mWriteToCacheState == NOT_WRITE || mFTType == FTT_MAP_TILE) //map tiles or server bakes
                     {
                         setState(DONE);
                         releaseHttpSemaphore();
@@ -2029,7 +2055,9 @@ void LLTextureFetchWorker::endWork(S32 param, bool aborted)
     LL_PROFILE_ZONE_SCOPED;
     if (mDecodeHandle != 0)
     {
-        // LL::ThreadPool has no operation to cancel a particular work item
+        // flag the queued decode as stale so the pool can skip it; the
+        // result (if any) is discarded by the decode_id check anyway
+        LLAppViewer::getImageDecodeThread()->abortRequest(mDecodeHandle);
         mDecodeHandle = 0;
     }
     mFormattedImage = NULL;
@@ -0,0 +1,207 @@
+/**
+ * @file lltexturetranscodecache.cpp
+ * @brief Second-level cache of GPU-ready compressed texture blobs
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "llviewerprecompiledheaders.h"
+
+#include "lltexturetranscodecache.h"
+
+#include "llfilesystem.h"
+#include "llimagegl.h"
+#include "llviewercontrol.h"
+
+namespace
+{
+    constexpr U32 TRANSCODE_CACHE_MAGIC = 0x31435454; // 'TTC1'
+    constexpr U32 TRANSCODE_CACHE_VERSION = 1;
+    constexpr S32 TRANSCODE_CACHE_MAX_LEVELS = 16;
+
+    struct TranscodeHeader
+    {
+        U32 mMagic = 0;
+        U32 mVersion = 0;
+        S32 mDiscard = 0;
+        S32 mFullWidth = 0;
+        S32 mFullHeight = 0;
+        S32 mComponents = 0;
+        S32 mIntFormat = 0;
+        S32 mLevels = 0;
+    };
+
+    // namespace id combined with the texture id so blobs get their own slot
+    // in the disk cache without colliding with the fetched J2C asset
+    const LLUUID TRANSCODE_CACHE_NAMESPACE("8a6b8b29-3f37-4eb8-bc35-5dd1c2c51c6a");
+
+    LLUUID blob_id(const LLUUID& id)
+    {
+        return id.combine(TRANSCODE_CACHE_NAMESPACE);
+    }
+
+    bool read_header(LLFileSystem& file, TranscodeHeader& header)
+    {
+        return file.read((U8*)&header, sizeof(header)) &&
+               header.mMagic == TRANSCODE_CACHE_MAGIC &&
+               header.mVersion == TRANSCODE_CACHE_VERSION &&
+               header.mLevels > 0 &&
+               header.mLevels <= TRANSCODE_CACHE_MAX_LEVELS;
+    }
+}
+
+//static
+bool LLTextureTranscodeCache::enabled()
+{
+    static LLCachedControl<bool> transcode_cache(gSavedSettings, "RenderTextureTranscodeCache", false);
+    return transcode_cache;
+}
+
+//static
+S32 LLTextureTranscodeCache::getCachedDiscard(const LLUUID& id)
+{
+    LLUUID bid = blob_id(id);
+    if (!LLFileSystem::getExists(bid, LLAssetType::AT_TEXTURE))
+    {
+        return -1;
+    }
+
+    LLFileSystem file(bid, LLAssetType::AT_TEXTURE, LLFileSystem::READ);
+    TranscodeHeader header;
+    if (!read_header(file, header))
+    {
+        return -1;
+    }
+    return header.mDiscard;
+}
+
+//static
+bool LLTextureTranscodeCache::store(const LLUUID& id, LLImageGL* imagep)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
+
+    if (!enabled() || !imagep || imagep->getDiscardLevel() < 0)
+    {
+        return false;
+    }
+
+    S32 discard = imagep->getDiscardLevel();
+
+    LLUUID bid = blob_id(id);
+    if (LLFileSystem::getExists(bid, LLAssetType::AT_TEXTURE))
+    { // keep the existing blob unless the new one is higher resolution
+        LLFileSystem existing(bid, LLAssetType::AT_TEXTURE, LLFileSystem::READ);
+        TranscodeHeader header;
+        if (read_header(existing, header) && header.mDiscard <= discard)
+        {
+            return false;
+        }
+    }
+
+    std::vector<U8> data;
+    std::vector<S32> level_sizes;
+    S32 intformat = 0;
+    S32 width = 0;
+    S32 height = 0;
+    if (!imagep->readBackCompressed(data, level_sizes, intformat, width, height))
+    { // not a driver-compressed texture
+        return false;
+    }
+
+    if ((S32)level_sizes.size() > TRANSCODE_CACHE_MAX_LEVELS)
+    {
+        return false;
+    }
+
+    TranscodeHeader header;
+    header.mMagic = TRANSCODE_CACHE_MAGIC;
+    header.mVersion = TRANSCODE_CACHE_VERSION;
+    header.mDiscard = discard;
+    header.mFullWidth = width << discard;
+    header.mFullHeight = height << discard;
+    header.mComponents = imagep->getComponents();
+    header.mIntFormat = intformat;
+    header.mLevels = (S32)level_sizes.size();
+
+    LLFileSystem file(bid, LLAssetType::AT_TEXTURE, LLFileSystem::WRITE);
+    return file.write((U8*)&header, sizeof(header)) &&
+           file.write((U8*)level_sizes.data(), (S32)(level_sizes.size() * sizeof(S32))) &&
+           file.write(data.data(), (S32)data.size());
+}
+
+//static
+bool LLTextureTranscodeCache::fetch(const LLUUID& id, LLImageGL* imagep, S32& full_width, S32& full_height, S32& ncomponents)
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
+
+    if (!enabled() || !imagep)
+    {
+        return false;
+    }
+
+    LLUUID bid = blob_id(id);
+    if (!LLFileSystem::getExists(bid, LLAssetType::AT_TEXTURE))
+    {
+        return false;
+    }
+
+    LLFileSystem file(bid, LLAssetType::AT_TEXTURE, LLFileSystem::READ);
+    TranscodeHeader header;
+    if (!read_header(file, header))
+    {
+        return false;
+    }
+
+    std::vector<S32> level_sizes(header.mLevels);
+    if (!file.read((U8*)level_sizes.data(), (S32)(level_sizes.size() * sizeof(S32))))
+    {
+        return false;
+    }
+
+    S64 total = 0;
+    for (S32 size : level_sizes)
+    {
+        if (size <= 0)
+        {
+            return false;
+        }
+        total += size;
+    }
+
+    std::vector<U8> data(total);
+    if (!file.read(data.data(), (S32)total))
+    {
+        return false;
+    }
+
+    if (!imagep->createCompressedGLTexture(header.mDiscard, header.mFullWidth, header.mFullHeight,
+                                           header.mComponents, header.mIntFormat, level_sizes, data.data()))
+    { // stale blob the driver will not accept; drop it so it gets rebuilt
+        LLFileSystem::removeFile(bid, LLAssetType::AT_TEXTURE);
+        return false;
+    }
+
+    full_width = header.mFullWidth;
+    full_height = header.mFullHeight;
+    ncomponents = header.mComponents;
+    return true;
+}
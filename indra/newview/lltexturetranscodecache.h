@@ -0,0 +1,58 @@
+/**
+ * @file lltexturetranscodecache.h
+ * @brief Second-level cache of GPU-ready compressed texture blobs
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLTEXTURETRANSCODECACHE_H
+#define LL_LLTEXTURETRANSCODECACHE_H
+
+#include "lluuid.h"
+
+class LLImageGL;
+
+// Caches the driver-compressed (S3TC) mip chains of fetched textures in the
+// disk cache so that revisiting a region can skip both the JPEG2000 decode
+// and the driver-side compression.  Blobs live alongside the regular asset
+// files in LLDiskCache under a UUID derived from the texture id, so the
+// existing purge machinery ages them out like everything else.
+class LLTextureTranscodeCache
+{
+public:
+    static bool enabled();
+
+    // discard level of the cached blob for this texture, or -1 if none
+    static S32 getCachedDiscard(const LLUUID& id);
+
+    // read back the compressed mip chain of imagep's current texture and
+    // write it to the cache; skipped when an equal or better blob exists.
+    // Must be called with a current GL context.
+    static bool store(const LLUUID& id, LLImageGL* imagep);
+
+    // create imagep's GL texture from the cached blob; on success returns
+    // the blob's full dimensions and component count so the caller can fix
+    // up its own bookkeeping.  Must be called with a current GL context.
+    static bool fetch(const LLUUID& id, LLImageGL* imagep, S32& full_width, S32& full_height, S32& ncomponents);
+};
+
+#endif // LL_LLTEXTURETRANSCODECACHE_H
@@ -117,8 +117,8 @@ public:
             LLTextureBar* bar2p = (LLTextureBar*)i2;
             LLViewerFetchedTexture *i1p = bar1p->mImagep;
             LLViewerFetchedTexture *i2p = bar2p->mImagep;
-            F32 pri1 = i1p->getMaxVirtualSize();
-            F32 pri2 = i2p->getMaxVirtualSize();
+            F32 pri1 = i1p->getFetchDecodePriority();
+            F32 pri2 = i2p->getFetchDecodePriority();
             if (pri1 > pri2)
                 return true;
             else if (pri2 > pri1)
@@ -870,8 +870,9 @@ void LLTextureView::draw()
                 pri = ((F32)imagep->mFetchPriority)/256.f;
             }
             else
-            {
-                pri = imagep->getMaxVirtualSize();
+            { // matches the priority handed to the fetcher so the console
+              // ordering reflects the actual queue ordering
+                pri = imagep->getFetchDecodePriority();
             }
             pri = llclamp(pri, 0.0f, HIGH_PRIORITY-1.f);
 
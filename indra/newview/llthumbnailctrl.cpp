@@ -222,6 +222,16 @@ bool LLThumbnailCtrl::handleHover(S32 x, S32 y, MASK mask)
     return LLUICtrl::handleHover(x, y, mask);
 }
 
+bool LLThumbnailCtrl::prefetch()
+{
+    if (mInited)
+    {
+        return false;
+    }
+    initImage();
+    return true;
+}
+
 void LLThumbnailCtrl::initImage()
 {
     if (mInited)
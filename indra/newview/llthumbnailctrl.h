@@ -70,6 +70,10 @@ public:
     void setInitImmediately(bool val) { mInitImmediately = val; }
     void clearTexture();
 
+    // kick the image fetch before the control is first drawn; returns true
+    // if this call started the load
+    bool prefetch();
+
     virtual bool handleHover(S32 x, S32 y, MASK mask) override;
 
 protected:
@@ -739,7 +739,7 @@ void LLToolPie::selectionPropertiesReceived()
 bool LLToolPie::handleHover(S32 x, S32 y, MASK mask)
 {
     bool pick_rigged = false; //gSavedSettings.getBOOL("AnimatedObjectsAllowLeftClick");
-    mHoverPick = gViewerWindow->pickImmediate(x, y, false, pick_rigged);
+    mHoverPick = gViewerWindow->pickHover(x, y, false, pick_rigged);
     LLViewerObject *parent = NULL;
     LLViewerObject *object = mHoverPick.getObject();
     LLSelectMgr::getInstance()->setHoverObject(object, mHoverPick.mObjectFace);
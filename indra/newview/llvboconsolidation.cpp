@@ -0,0 +1,408 @@
+/**
+ * @file llvboconsolidation.cpp
+ * @brief Consolidation of quiescent spatial group geometry into shared vertex buffers
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#include "llviewerprecompiledheaders.h"
+
+#include <list>
+
+#include "llvboconsolidation.h"
+
+#include "llappviewer.h"
+#include "lldrawable.h"
+#include "llface.h"
+#include "llspatialpartition.h"
+#include "llvertexbuffer.h"
+#include "llviewercontrol.h"
+
+namespace
+{
+    // arenas use U16 indices just like per-group buffers, so a vertex base
+    // rewrite must keep every index below this
+    constexpr U32 ARENA_MAX_VERTS = 65535;
+    // scene geometry runs a handful of indices per vertex; when an arena runs
+    // out of index space before vertex space we just open another one
+    constexpr U32 ARENA_MAX_INDICES = ARENA_MAX_VERTS * 4;
+
+    // shared buffer that group geometry is bump-allocated into
+    struct Arena
+    {
+        LLPointer<LLVertexBuffer> mBuffer;
+        U32 mMask = 0;
+        U32 mNextVert = 0;
+        U32 mNextIndex = 0;
+        U32 mLiveVerts = 0; // vertices still referenced by live tenant groups
+    };
+
+    // arena space owed back when a tenant group rebuilds or dies
+    struct Lease
+    {
+        Arena* mArena = nullptr;
+        U32 mVertCount = 0;
+    };
+
+    struct GroupRecord
+    {
+        LLPointer<LLSpatialGroup> mGroup;
+        F32 mBuiltTime = 0.f; // mLastUpdateTime at migration; changes on rebuild
+        std::vector<Lease> mLeases;
+    };
+
+    struct PendingEntry
+    {
+        LLPointer<LLSpatialGroup> mGroup;
+        F32 mQueuedTime = 0.f;
+    };
+
+    std::list<Arena> sArenas;
+    std::vector<GroupRecord> sMigrated;
+    std::deque<PendingEntry> sPending;
+
+    F32 consolidation_delay()
+    {
+        static LLCachedControl<F32> delay(gSavedSettings, "RenderStaticVBOConsolidationDelay", 0.f);
+        return delay;
+    }
+
+    bool already_migrated(const LLSpatialGroup* group)
+    {
+        for (const GroupRecord& record : sMigrated)
+        {
+            if (record.mGroup == group)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // find an arena with matching vertex format and room for the extent,
+    // opening a new one if needed; returns nullptr on allocation failure
+    Arena* find_arena(U32 mask, U32 nverts, U32 nindices)
+    {
+        for (Arena& arena : sArenas)
+        {
+            if (arena.mMask == mask &&
+                arena.mNextVert + nverts <= ARENA_MAX_VERTS &&
+                arena.mNextIndex + nindices <= ARENA_MAX_INDICES)
+            {
+                return &arena;
+            }
+        }
+
+        LLPointer<LLVertexBuffer> buffer = new LLVertexBuffer(mask);
+        if (!buffer->allocateBuffer(ARENA_MAX_VERTS, ARENA_MAX_INDICES))
+        {
+            LL_WARNS_ONCE() << "Failed to allocate consolidation arena, mask 0x"
+                << std::hex << mask << std::dec << LL_ENDL;
+            return nullptr;
+        }
+
+        sArenas.emplace_back();
+        Arena& arena = sArenas.back();
+        arena.mBuffer = buffer;
+        arena.mMask = mask;
+        return &arena;
+    }
+
+    bool is_arena_buffer(const LLVertexBuffer* buffer)
+    {
+        for (const Arena& arena : sArenas)
+        {
+            if (arena.mBuffer == buffer)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // copy one per-group buffer into an arena and repoint every draw info and
+    // face at the shared storage; returns false if no arena had room
+    bool migrate_buffer(LLVertexBuffer* src,
+                        const std::vector<LLDrawInfo*>& draw_infos,
+                        const std::vector<LLFace*>& faces,
+                        std::vector<Lease>& leases)
+    {
+        U32 mask = src->getTypeMask();
+        U32 nverts = src->getNumVerts();
+        U32 nindices = src->getNumIndices();
+
+        const U8* src_data = src->getMappedData();
+        const U16* src_indices = (const U16*)src->getMappedIndices();
+
+        if (!src_data || !src_indices || nverts == 0 || nindices == 0)
+        {
+            return false;
+        }
+
+        Arena* arena = find_arena(mask, nverts, nindices);
+        if (!arena)
+        {
+            return false;
+        }
+
+        U32 vert_base = arena->mNextVert;
+        U32 index_base = arena->mNextIndex;
+
+        // per-group buffers store attributes as planar arrays; copy each one
+        // present in the mask (texture indices ride along in position.w)
+        U32 offsets[LLVertexBuffer::TYPE_MAX];
+        LLVertexBuffer::calcOffsets(mask, offsets, nverts);
+
+        for (U32 type = 0; type < LLVertexBuffer::TYPE_TEXTURE_INDEX; ++type)
+        {
+            if (mask & (1 << type))
+            {
+                U8* dst = arena->mBuffer->mapVertexBuffer((LLVertexBuffer::AttributeType)type, vert_base, nverts);
+                memcpy(dst, src_data + offsets[type], LLVertexBuffer::sTypeSize[type] * nverts);
+            }
+        }
+
+        // indices shift by the vertex base within the arena
+        U16* dst_indices = (U16*)arena->mBuffer->mapIndexBuffer(index_base, nindices);
+        for (U32 i = 0; i < nindices; ++i)
+        {
+            dst_indices[i] = src_indices[i] + (U16)vert_base;
+        }
+
+        for (LLDrawInfo* info : draw_infos)
+        {
+            info->mVertexBuffer = arena->mBuffer;
+            info->mStart += (U16)vert_base;
+            info->mEnd += (U16)vert_base;
+            info->mOffset += index_base;
+        }
+
+        for (LLFace* face : faces)
+        {
+            face->setIndicesIndex(face->getIndicesStart() + index_base);
+            face->setGeomIndex((U16)(face->getGeomIndex() + vert_base));
+            face->setVertexBuffer(arena->mBuffer);
+        }
+
+        arena->mNextVert += nverts;
+        arena->mNextIndex += nindices;
+        arena->mLiveVerts += nverts;
+        leases.push_back({ arena, nverts });
+
+        return true;
+    }
+
+    // migrate every unrigged buffer owned by the group; returns true if
+    // anything moved
+    bool migrate_group(LLSpatialGroup* group)
+    {
+        // gather the draw infos referencing each per-group buffer; rigged
+        // buffers stay put (avatars move and rebuild too often to be worth
+        // sharing)
+        std::map<LLVertexBuffer*, std::vector<LLDrawInfo*>> sources;
+        std::set<LLVertexBuffer*> rigged;
+
+        for (LLSpatialGroup::draw_map_t::iterator i = group->mDrawMap.begin(); i != group->mDrawMap.end(); ++i)
+        {
+            for (LLPointer<LLDrawInfo>& info : i->second)
+            {
+                if (info.isNull() || info->mVertexBuffer.isNull())
+                {
+                    continue;
+                }
+                if (info->mAvatar.notNull())
+                {
+                    rigged.insert(info->mVertexBuffer.get());
+                    continue;
+                }
+                sources[info->mVertexBuffer.get()].push_back(info.get());
+            }
+        }
+
+        // faces reference the same buffers for mesh updates and picking, so
+        // they must be rebased along with the draw infos
+        std::map<LLVertexBuffer*, std::vector<LLFace*>> faces;
+
+        for (LLSpatialGroup::element_iter drawable_iter = group->getDataBegin(); drawable_iter != group->getDataEnd(); ++drawable_iter)
+        {
+            LLDrawable* drawablep = (LLDrawable*)(*drawable_iter)->getDrawable();
+            if (!drawablep || drawablep->isDead())
+            {
+                continue;
+            }
+            for (S32 i = 0; i < drawablep->getNumFaces(); ++i)
+            {
+                LLFace* face = drawablep->getFace(i);
+                if (face && face->getVertexBuffer())
+                {
+                    faces[face->getVertexBuffer()].push_back(face);
+                }
+            }
+        }
+
+        std::vector<Lease> leases;
+
+        for (auto& source : sources)
+        {
+            LLVertexBuffer* buffer = source.first;
+            if (rigged.find(buffer) != rigged.end() || is_arena_buffer(buffer))
+            {
+                continue;
+            }
+            migrate_buffer(buffer, source.second, faces[buffer], leases);
+        }
+
+        if (leases.empty())
+        {
+            return false;
+        }
+
+        // drop the reuse map's references so the migrated buffers can be freed
+        group->mBufferMap.clear();
+
+        GroupRecord record;
+        record.mGroup = group;
+        record.mBuiltTime = group->mLastUpdateTime;
+        record.mLeases = std::move(leases);
+        sMigrated.push_back(std::move(record));
+
+        return true;
+    }
+
+    void release_record(GroupRecord& record)
+    {
+        for (const Lease& lease : record.mLeases)
+        {
+            llassert(lease.mArena->mLiveVerts >= lease.mVertCount);
+            lease.mArena->mLiveVerts -= lease.mVertCount;
+        }
+    }
+} // anonymous namespace
+
+// static
+bool LLVBOConsolidation::enabled()
+{
+    return consolidation_delay() > 0.f;
+}
+
+// static
+void LLVBOConsolidation::queueGroup(LLSpatialGroup* group)
+{
+    if (!enabled() || !group)
+    {
+        return;
+    }
+
+    LLSpatialPartition* part = group->getSpatialPartition();
+    if (!part || part->isBridge())
+    { // attachments move as a unit and churn with their wearer -- leave their
+      // buffers per-group (this also keeps arenas out of the attachment size
+      // accounting in LLFace::setVertexBuffer)
+        return;
+    }
+
+    sPending.push_back({ group, (F32)gFrameTimeSeconds });
+}
+
+// static
+void LLVBOConsolidation::update()
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_VOLUME;
+
+    if (!enabled())
+    {
+        sPending.clear();
+        return;
+    }
+
+    // reclaim space from tenants that have rebuilt (new per-group buffers
+    // supersede the arena copy) or died
+    for (size_t i = 0; i < sMigrated.size();)
+    {
+        GroupRecord& record = sMigrated[i];
+        if (record.mGroup->isDead() || record.mGroup->mLastUpdateTime != record.mBuiltTime)
+        {
+            release_record(record);
+            record = std::move(sMigrated.back());
+            sMigrated.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    // retire empty arenas; GL memory is freed once the last draw info or
+    // face reference drops
+    for (std::list<Arena>::iterator i = sArenas.begin(); i != sArenas.end();)
+    {
+        if (i->mLiveVerts == 0)
+        {
+            i = sArenas.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    // migrate at most one group per frame -- entries are queued in rebuild
+    // order, so once the head is too young the rest are too
+    const F32 now = (F32)gFrameTimeSeconds;
+    F32 delay = consolidation_delay();
+    bool migrated = false;
+
+    while (!sPending.empty() && !migrated)
+    {
+        if (now - sPending.front().mQueuedTime < delay)
+        {
+            break;
+        }
+
+        LLPointer<LLSpatialGroup> group = sPending.front().mGroup;
+        F32 queued_time = sPending.front().mQueuedTime;
+        sPending.pop_front();
+
+        if (group->isDead() ||
+            group->mLastUpdateTime > queued_time || // rebuilt since; a newer entry exists
+            group->hasState(LLSpatialGroup::GEOM_DIRTY | LLSpatialGroup::ALPHA_DIRTY | LLSpatialGroup::MESH_DIRTY) ||
+            already_migrated(group))
+        {
+            continue;
+        }
+
+        migrated = migrate_group(group);
+    }
+
+    if (migrated)
+    {
+        LLVertexBuffer::flushBuffers();
+    }
+}
+
+// static
+void LLVBOConsolidation::cleanup()
+{
+    sPending.clear();
+    sMigrated.clear();
+    sArenas.clear();
+}
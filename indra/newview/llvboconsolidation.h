@@ -0,0 +1,62 @@
+/**
+ * @file llvboconsolidation.h
+ * @brief Consolidation of quiescent spatial group geometry into shared vertex buffers
+ *
+ * $LicenseInfo:firstyear=2024&license=viewerlgpl$
+ * Second Life Viewer Source Code
+ * Copyright (C) 2024, Linden Research, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation;
+ * version 2.1 of the License only.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ * Linden Research, Inc., 945 Battery Street, San Francisco, CA  94111  USA
+ * $/LicenseInfo$
+ */
+
+#ifndef LL_LLVBOCONSOLIDATION_H
+#define LL_LLVBOCONSOLIDATION_H
+
+#include "stdtypes.h"
+
+class LLSpatialGroup;
+
+// Migrates geometry of spatial groups that haven't rebuilt in a while out of
+// their per-group vertex buffers into large shared "arena" buffers, so
+// consecutive draw calls over static scenery share one buffer bind (and can
+// be merged by the multi-draw-indirect batcher in lldrawpool.cpp).
+//
+// Arenas are bump-allocated and retired when their last tenant group rebuilds
+// or dies; a group that goes dirty again simply rebuilds into fresh per-group
+// buffers the way it always has.
+//
+// Enabled by setting RenderStaticVBOConsolidationDelay to the number of
+// seconds a group must sit unchanged before it is migrated (0 disables).
+class LLVBOConsolidation
+{
+public:
+    static bool enabled();
+
+    // called when a group finishes rebuildGeom -- makes it a candidate for
+    // consolidation once it has been quiet long enough
+    static void queueGroup(LLSpatialGroup* group);
+
+    // called once per frame from LLPipeline::updateGeom -- reclaims space
+    // from rebuilt/dead tenants and migrates at most one group
+    static void update();
+
+    // drop all arenas and bookkeeping (shutdown / GL teardown)
+    static void cleanup();
+};
+
+#endif // LL_LLVBOCONSOLIDATION_H
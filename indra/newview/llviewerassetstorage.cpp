@@ -391,6 +391,7 @@ void LLViewerAssetStorage::queueRequestHttp(
         req->mMetricsStartTime = LLViewerAssetStatsFF::get_timestamp();
     }
     mPendingDownloads.push_back(req);
+    trackPendingDownload(uuid);
 
     // This is the same as the current UDP logic - don't re-request a duplicate.
     if (!duplicate)
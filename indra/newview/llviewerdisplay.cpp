@@ -46,6 +46,7 @@
 #include "llfeaturemanager.h"
 #include "llfloatertools.h"
 #include "llfocusmgr.h"
+#include "llframearena.h"
 #include "llgl.h"
 #include "llglheaders.h"
 #include "llgltfmateriallist.h"
@@ -110,6 +111,9 @@ constexpr F32 RESTORE_GL_TIME = 5.f;  // Wait this long while reloading textures
 
 bool gForceRenderLandFence = false;
 bool gDisplaySwapBuffers = false;
+// true when swap() has queued a frame whose actual buffer swap is
+// deferred to the top of the next display()
+static bool sSwapPending = false;
 bool gDepthDirty = false;
 bool gResizeScreenTexture = false;
 bool gResizeShadowTexture = false;
@@ -409,6 +413,10 @@ void display(bool rebuild, F32 zoom_factor, int subfield, bool for_snapshot)
 
     LLPerfStats::RecordSceneTime T (LLPerfStats::StatType_t::RENDER_DISPLAY); // render time capture - This is the main stat for overall rendering.
 
+    // rewind the main thread's frame arena; everything the previous frame
+    // carved out of it (cull scratch and other transients) is dead now
+    LLFrameArena::reset();
+
     if (gWindowResized)
     { //skip render on frames where window has been resized
         LL_DEBUGS("Window") << "Resizing window" << LL_ENDL;
@@ -416,6 +424,8 @@ void display(bool rebuild, F32 zoom_factor, int subfield, bool for_snapshot)
         gGL.flush();
         glClear(GL_COLOR_BUFFER_BIT);
         gViewerWindow->getWindow()->swapBuffers();
+        // the clear above destroyed any frame awaiting its deferred swap
+        sSwapPending = false;
         LLPipeline::refreshCachedSettings();
         gPipeline.resizeScreenTexture();
         gResizeScreenTexture = false;
@@ -476,6 +486,12 @@ void display(bool rebuild, F32 zoom_factor, int subfield, bool for_snapshot)
         return;
     }
 
+    // Present the previous frame now rather than at the end of the
+    // frame that rendered it, so the vsync/GPU wait in swapBuffers()
+    // overlaps the simulation and network work done since then instead
+    // of stalling at the tail of every frame.
+    present_pending_swap();
+
     gViewerWindow->checkSettings();
 
     {
@@ -726,6 +742,10 @@ void display(bool rebuild, F32 zoom_factor, int subfield, bool for_snapshot)
 
         gPipeline.updateGL();
 
+        // warm up deferred shader links whose driver-side compile finished,
+        // so preset changes don't hitch on first use of a variant mid-scene
+        LLGLSLShader::finalizePendingLinks(0.001f);
+
         stop_glerror();
 
         LLAppViewer::instance()->pingMainloopTimeout("Display:Cull");
@@ -825,7 +845,13 @@ void display(bool rebuild, F32 zoom_factor, int subfield, bool for_snapshot)
                 LL_PROFILE_ZONE_NAMED_CATEGORY_DISPLAY("List");
                 F32 max_image_decode_time = 0.050f*gFrameIntervalSeconds.value(); // 50 ms/second decode time
                 max_image_decode_time = llclamp(max_image_decode_time, 0.002f, 0.005f ); // min 2ms/frame, max 5ms/frame)
+                // the frame-budget governor overrides the ad-hoc cap above when active
+                max_image_decode_time =
+                    LLPerfStats::FrameBudget::getTimeSlice(LLPerfStats::FrameBudget::Subsystem::TEXTURES, max_image_decode_time);
+                LLTimer image_update_timer;
                 gTextureList.updateImages(max_image_decode_time);
+                LLPerfStats::FrameBudget::reportSpent(LLPerfStats::FrameBudget::Subsystem::TEXTURES,
+                                                      (F32)image_update_timer.getElapsedTimeF64());
             }
 
             {
@@ -1524,16 +1550,29 @@ void render_ui(F32 zoom_factor, int subfield)
 
 void swap()
 {
-    LLPerfStats::RecordSceneTime T ( LLPerfStats::StatType_t::RENDER_SWAP ); // render time capture - Swap buffer time - can signify excessive data transfer to/from GPU
     LL_PROFILE_ZONE_NAMED_CATEGORY_DISPLAY("Swap");
-    LL_PROFILE_GPU_ZONE("swap");
     if (gDisplaySwapBuffers)
     {
-        gViewerWindow->getWindow()->swapBuffers();
+        // defer the actual buffer swap to the top of the next
+        // display(); presenting there lets the intervening idle and
+        // network work overlap any vsync wait
+        sSwapPending = true;
     }
     gDisplaySwapBuffers = true;
 }
 
+void present_pending_swap()
+{
+    if (sSwapPending)
+    {
+        LLPerfStats::RecordSceneTime T ( LLPerfStats::StatType_t::RENDER_SWAP ); // render time capture - Swap buffer time - can signify excessive data transfer to/from GPU
+        LL_PROFILE_ZONE_NAMED_CATEGORY_DISPLAY("Present");
+        LL_PROFILE_GPU_ZONE("swap");
+        gViewerWindow->getWindow()->swapBuffers();
+        sSwapPending = false;
+    }
+}
+
 void renderCoordinateAxes()
 {
     gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
@@ -34,6 +34,12 @@ void display_cleanup();
 
 void display(bool rebuild = true, F32 zoom_factor = 1.f, int subfield = 0, bool for_snapshot = false);
 
+// Present a frame whose buffer swap was deferred at the end of
+// display().  Called automatically at the top of the next display();
+// anything else that draws to the default framebuffer between frames
+// (e.g. the snapshot paths) must call it before touching the buffer.
+void present_pending_swap();
+
 extern bool gDisplaySwapBuffers;
 extern bool gDepthDirty;
 extern bool gTeleportDisplay;
@@ -839,6 +839,41 @@ void LLViewerMedia::updateMedia(void *dummy_arg)
 
             pimpl->setPriority(new_priority);
 
+            // Map the priority we just assigned onto a texture refresh
+            // interval.  Inworld screens that cover little of the view get a
+            // 1-5Hz refresh scaled by screen coverage; hidden ones pause on
+            // their last uploaded frame.  Focused and UI impls stay full-rate.
+            F32 update_interval = 0.0f;
+            if(!pimpl->getUsedInUI() && !pimpl->hasFocus())
+            {
+                switch(new_priority)
+                {
+                    case LLPluginClassMedia::PRIORITY_HIDDEN:
+                        // Out of view (or the viewer window is minimized) -- retain the last frame.
+                        update_interval = -1.0f;
+                        break;
+                    case LLPluginClassMedia::PRIORITY_SLIDESHOW:
+                        update_interval = 1.0f;
+                        break;
+                    case LLPluginClassMedia::PRIORITY_LOW:
+                    {
+                        // Scale with the fraction of the texture's native area on screen:
+                        // full coverage refreshes at 5Hz, distant glimpses decay to 1Hz.
+                        F64 approximate_interest = pimpl->getApproximateTextureInterest();
+                        F32 coverage = 0.0f;
+                        if(approximate_interest > 0.0f)
+                        {
+                            coverage = (F32)(pimpl->getInterest() / approximate_interest);
+                        }
+                        update_interval = llclamp(0.2f / llmax(coverage, 0.2f), 0.2f, 1.0f);
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+            pimpl->setTextureUpdateInterval(update_interval);
+
             if(pimpl->getUsedInUI())
             {
                 // Any impls used in the UI should not be in the proximity list.
@@ -1531,6 +1566,7 @@ LLViewerMediaImpl::LLViewerMediaImpl(     const LLUUID& texture_id,
     mTextureUsedWidth(0),
     mTextureUsedHeight(0),
     mSuspendUpdates(false),
+    mTexUpdateInterval(0.0f),
     mVisible(true),
     mLastSetCursor( UI_CURSOR_ARROW ),
     mMediaNavState( MEDIANAVSTATE_NONE ),
@@ -2882,6 +2918,22 @@ void LLViewerMediaImpl::update()
         return;
     }
 
+    // Interest-driven refresh governor: impls whose screens cover little of
+    // the view don't need full-rate texture uploads, and fully occluded ones
+    // keep their last uploaded frame until they come back into view.
+    // Skipped updates simply accumulate in the plugin's dirty rect.
+    if(mTexUpdateInterval < 0.0f)
+    {
+        return;
+    }
+    if(mTexUpdateInterval > 0.0f)
+    {
+        if(mTexUpdateTimer.getElapsedTimeF32() < mTexUpdateInterval)
+        {
+            return;
+        }
+        mTexUpdateTimer.reset();
+    }
 
     LLViewerMediaTexture* media_tex;
     U8* data;
@@ -381,6 +381,11 @@ public:
 
     void setLowPrioritySizeLimit(int size);
 
+    // Minimum interval between texture uploads for this impl, derived from
+    // screen coverage by LLViewerMedia::updateMedia().  Zero updates every
+    // frame; a negative interval pauses uploads, retaining the last frame.
+    void setTextureUpdateInterval(F32 interval) { mTexUpdateInterval = interval; };
+
     void setTextureID(LLUUID id = LLUUID::null);
 
     bool isTrustedBrowser() { return mTrustedBrowser; }
@@ -453,6 +458,8 @@ private:
     S32 mTextureUsedHeight;
     bool mSuspendUpdates;
     bool mTextureUpdatePending = false;
+    F32 mTexUpdateInterval;
+    LLTimer mTexUpdateTimer;
     bool mVisible;
     ECursorType mLastSetCursor;
     EMediaNavState mMediaNavState;
@@ -102,6 +102,7 @@
 #include "llrootview.h"
 #include "llsceneview.h"
 #include "llscenemonitor.h"
+#include "llscenesynth.h"
 #include "llselectmgr.h"
 #include "llsidepanelappearance.h"
 #include "llspellcheckmenuhandler.h"
@@ -660,6 +661,29 @@ class LLAdvancedCheckConsole : public view_listener_t
 };
 
 
+/////////////////////
+// FLIGHT RECORDER //
+/////////////////////
+
+
+class LLAdvancedToggleFlightRecorder : public view_listener_t
+{
+    bool handleEvent(const LLSD& userdata)
+    {
+        LLTrace::BlockTimer::setFlightRecorderEnabled(!LLTrace::BlockTimer::getFlightRecorderEnabled());
+        return true;
+    }
+};
+
+class LLAdvancedCheckFlightRecorder : public view_listener_t
+{
+    bool handleEvent(const LLSD& userdata)
+    {
+        return LLTrace::BlockTimer::getFlightRecorderEnabled();
+    }
+};
+
+
 //////////////////////////
 // DUMP INFO TO CONSOLE //
 //////////////////////////
@@ -2381,6 +2405,30 @@ class LLAdvancedCheckAgentPilotLoop : public view_listener_t
 };
 
 
+///////////////////////
+// SCENE SYNTHESIZER //
+///////////////////////
+
+
+class LLAdvancedSceneSynth : public view_listener_t
+{
+    bool handleEvent(const LLSD& userdata)
+    {
+        std::string command = userdata.asString();
+        if ("spawn" == command)
+        {
+            gSceneSynth.spawn();
+        }
+        else if ("clear" == command)
+        {
+            gSceneSynth.clear();
+        }
+
+        return true;
+    }
+};
+
+
 /////////////////////////
 // SHOW OBJECT UPDATES //
 /////////////////////////
@@ -8490,6 +8538,21 @@ void handle_dump_timers()
     LLTrace::BlockTimer::dumpCurTimes();
 }
 
+void handle_dump_flight_recorder()
+{
+    std::string filename = gDirUtilp->getExpandedFilename(LL_PATH_LOGS, "flight_recorder.json");
+    llofstream os(filename.c_str());
+    if (os.is_open())
+    {
+        LLTrace::BlockTimer::writeFlightRecorder(os);
+        LL_INFOS() << "Wrote flight recorder trace to " << filename << LL_ENDL;
+    }
+    else
+    {
+        LL_WARNS() << "Unable to open " << filename << " for writing" << LL_ENDL;
+    }
+}
+
 void handle_debug_avatar_textures()
 {
     LLViewerObject* objectp = LLSelectMgr::getInstance()->getSelection()->getPrimaryObject();
@@ -9785,6 +9848,9 @@ void initialize_menus()
     view_listener_t::addMenu(new LLAdvancedDumpSelectMgr(), "Advanced.DumpSelectMgr");
     view_listener_t::addMenu(new LLAdvancedDumpInventory(), "Advanced.DumpInventory");
     registrar.add("Advanced.DumpTimers", boost::bind(&handle_dump_timers), cb_info::UNTRUSTED_THROTTLE);
+    view_listener_t::addMenu(new LLAdvancedToggleFlightRecorder(), "Advanced.ToggleFlightRecorder");
+    view_listener_t::addMenu(new LLAdvancedCheckFlightRecorder(), "Advanced.CheckFlightRecorder");
+    registrar.add("Advanced.DumpFlightRecorder", boost::bind(&handle_dump_flight_recorder), cb_info::UNTRUSTED_THROTTLE);
     registrar.add("Advanced.DumpFocusHolder", boost::bind(&handle_dump_focus));
     view_listener_t::addMenu(new LLAdvancedPrintSelectedObjectInfo(), "Advanced.PrintSelectedObjectInfo");
     view_listener_t::addMenu(new LLAdvancedPrintAgentInfo(), "Advanced.PrintAgentInfo");
@@ -9860,6 +9926,7 @@ void initialize_menus()
     view_listener_t::addMenu(new LLAdvancedAgentPilot(), "Advanced.AgentPilot");
     view_listener_t::addMenu(new LLAdvancedToggleAgentPilotLoop(), "Advanced.ToggleAgentPilotLoop");
     view_listener_t::addMenu(new LLAdvancedCheckAgentPilotLoop(), "Advanced.CheckAgentPilotLoop");
+    view_listener_t::addMenu(new LLAdvancedSceneSynth(), "Advanced.SceneSynth");
     view_listener_t::addMenu(new LLAdvancedViewerEventRecorder(), "Advanced.EventRecorder");
 
     // Advanced > Debugging
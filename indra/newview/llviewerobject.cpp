@@ -1529,13 +1529,15 @@ U32 LLViewerObject::processUpdateMessage(LLMessageSystem *mesgsys,
 
                     U8 num_parameters;
                     dp.unpackU8(num_parameters, "num_params");
-                    U8 param_block[MAX_OBJECT_PARAMS_SIZE];
                     for (U8 param=0; param<num_parameters; ++param)
                     {
                         U16 param_type;
-                        S32 param_size;
+                        S32 param_size = 0;
+                        U8 *param_block = NULL;
                         dp.unpackU16(param_type, "param_type");
-                        dp.unpackBinaryData(param_block, param_size, "param_data");
+                        // unpack in place -- the view stays valid until the
+                        // buffer is freed below
+                        dp.unpackBinaryDataView(param_block, param_size, "param_data");
                         //LL_INFOS() << "Param type: " << param_type << ", Size: " << param_size << LL_ENDL;
                         LLDataPackerBinaryBuffer dp2(param_block, param_size);
                         unpackParameterEntry(param_type, &dp2);
@@ -1859,13 +1861,14 @@ U32 LLViewerObject::processUpdateMessage(LLMessageSystem *mesgsys,
                 // Unpack extra params
                 U8 num_parameters;
                 dp->unpackU8(num_parameters, "num_params");
-                U8 param_block[MAX_OBJECT_PARAMS_SIZE];
                 for (U8 param=0; param<num_parameters; ++param)
                 {
                     U16 param_type;
-                    S32 param_size;
+                    S32 param_size = 0;
+                    U8 *param_block = NULL;
                     dp->unpackU16(param_type, "param_type");
-                    dp->unpackBinaryData(param_block, param_size, "param_data");
+                    // unpack in place -- the view outlives this processing scope
+                    dp->unpackBinaryDataView(param_block, param_size, "param_data");
                     //LL_INFOS() << "Param type: " << param_type << ", Size: " << param_size << LL_ENDL;
                     LLDataPackerBinaryBuffer dp2(param_block, param_size);
                     unpackParameterEntry(param_type, &dp2);
@@ -2474,6 +2477,41 @@ void LLViewerObject::idleUpdate(LLAgent &agent, const F64 &frame_time)
 }
 
 
+// Returns true if the message circuit to the given region appears stalled
+// (dead, blocked, or silent past the phase-out window).  The simulator stops
+// sending updates for objects that move exactly as predicted, so on a busy
+// scene every such object asks this question every frame; memoize the answer
+// per region per frame instead of doing a circuit lookup per object.
+static bool circuit_stalled(LLViewerRegion* regionp, F64Seconds phase_out_time)
+{
+    static U32 last_frame = 0;
+    static LLViewerRegion* last_region = NULL;
+    static bool last_stalled = false;
+
+    U32 frame = LLFrameTimer::getFrameCount();
+    if (frame == last_frame && regionp == last_region)
+    {
+        return last_stalled;
+    }
+
+    bool stalled = false;
+    LLCircuitData* cdp = gMessageSystem->mCircuitInfo.findCircuit(regionp->getHost());
+    if (cdp)
+    {
+        // Find out how many seconds since last packet arrived on the circuit
+        F64Seconds time_since_last_packet = LLMessageSystem::getMessageTimeSeconds() - cdp->getLastPacketInTime();
+
+        stalled = !cdp->isAlive() ||        // Circuit is dead or blocked
+                  cdp->isBlocked() ||       // or doesn't seem to be getting any packets
+                  (time_since_last_packet > phase_out_time);
+    }
+
+    last_frame = frame;
+    last_region = regionp;
+    last_stalled = stalled;
+    return stalled;
+}
+
 // Move an object due to idle-time viewer side updates by interpolating motion
 void LLViewerObject::interpolateLinearMotion(const F64SecondsImplicit& frame_time, const F32SecondsImplicit& dt_seconds)
 {
@@ -2520,50 +2558,39 @@ void LLViewerObject::interpolateLinearMotion(const F64SecondsImplicit& frame_tim
         if (time_since_last_update > sPhaseOutUpdateInterpolationTime &&
             sPhaseOutUpdateInterpolationTime > (F64Seconds)0.0)
         {   // Haven't seen a viewer update in a while, check to see if the circuit is still active
-            if (mRegionp)
-            {   // The simulator will NOT send updates if the object continues normally on the path
-                // predicted by the velocity and the acceleration (often gravity) sent to the viewer
-                // So check to see if the circuit is blocked, which means the sim is likely in a long lag
-                LLCircuitData *cdp = gMessageSystem->mCircuitInfo.findCircuit( mRegionp->getHost() );
-                if (cdp)
-                {
-                    // Find out how many seconds since last packet arrived on the circuit
-                    F64Seconds time_since_last_packet = LLMessageSystem::getMessageTimeSeconds() - cdp->getLastPacketInTime();
-
-                    if (!cdp->isAlive() ||      // Circuit is dead or blocked
-                         cdp->isBlocked() ||    // or doesn't seem to be getting any packets
-                         (time_since_last_packet > sPhaseOutUpdateInterpolationTime))
-                    {
-                        // Start to reduce motion interpolation since we haven't seen a server update in a while
-                        F64Seconds time_since_last_interpolation = frame_time - mLastInterpUpdateSecs;
-                        F64 phase_out = 1.0;
-                        if (time_since_last_update > sMaxUpdateInterpolationTime)
-                        {   // Past the time limit, so stop the object
-                            phase_out = 0.0;
-                            //LL_INFOS() << "Motion phase out to zero" << LL_ENDL;
-
-                            // Kill angular motion as well.  Note - not adding this due to paranoia
-                            // about stopping rotation for llTargetOmega objects and not having it restart
-                            // setAngularVelocity(LLVector3::zero);
-                        }
-                        else if (mLastInterpUpdateSecs - mLastMessageUpdateSecs > sPhaseOutUpdateInterpolationTime)
-                        {   // Last update was already phased out a bit
-                            phase_out = (sMaxUpdateInterpolationTime - time_since_last_update) /
-                                        (sMaxUpdateInterpolationTime - time_since_last_interpolation);
-                            //LL_INFOS() << "Continuing motion phase out of " << (F32) phase_out << LL_ENDL;
-                        }
-                        else
-                        {   // Phase out from full value
-                            phase_out = (sMaxUpdateInterpolationTime - time_since_last_update) /
-                                        (sMaxUpdateInterpolationTime - sPhaseOutUpdateInterpolationTime);
-                            //LL_INFOS() << "Starting motion phase out of " << (F32) phase_out << LL_ENDL;
-                        }
-                        phase_out = llclamp(phase_out, 0.0, 1.0);
-
-                        new_pos = new_pos * ((F32) phase_out);
-                        new_v = new_v * ((F32) phase_out);
-                    }
+            // The simulator will NOT send updates if the object continues normally on the path
+            // predicted by the velocity and the acceleration (often gravity) sent to the viewer
+            // So check to see if the circuit is blocked, which means the sim is likely in a long lag
+            if (mRegionp && circuit_stalled(mRegionp, sPhaseOutUpdateInterpolationTime))
+            {
+                // Start to reduce motion interpolation since we haven't seen a server update in a while
+                F64Seconds time_since_last_interpolation = frame_time - mLastInterpUpdateSecs;
+                F64 phase_out = 1.0;
+                if (time_since_last_update > sMaxUpdateInterpolationTime)
+                {   // Past the time limit, so stop the object
+                    phase_out = 0.0;
+                    //LL_INFOS() << "Motion phase out to zero" << LL_ENDL;
+
+                    // Kill angular motion as well.  Note - not adding this due to paranoia
+                    // about stopping rotation for llTargetOmega objects and not having it restart
+                    // setAngularVelocity(LLVector3::zero);
+                }
+                else if (mLastInterpUpdateSecs - mLastMessageUpdateSecs > sPhaseOutUpdateInterpolationTime)
+                {   // Last update was already phased out a bit
+                    phase_out = (sMaxUpdateInterpolationTime - time_since_last_update) /
+                                (sMaxUpdateInterpolationTime - time_since_last_interpolation);
+                    //LL_INFOS() << "Continuing motion phase out of " << (F32) phase_out << LL_ENDL;
                 }
+                else
+                {   // Phase out from full value
+                    phase_out = (sMaxUpdateInterpolationTime - time_since_last_update) /
+                                (sMaxUpdateInterpolationTime - sPhaseOutUpdateInterpolationTime);
+                    //LL_INFOS() << "Starting motion phase out of " << (F32) phase_out << LL_ENDL;
+                }
+                phase_out = llclamp(phase_out, 0.0, 1.0);
+
+                new_pos = new_pos * ((F32) phase_out);
+                new_v = new_v * ((F32) phase_out);
             }
         }
 
@@ -2572,19 +2599,20 @@ void LLViewerObject::interpolateLinearMotion(const F64SecondsImplicit& frame_tim
 
 
         // Clamp interpolated position to minimum underground and maximum region height
+        LLWorld* world = LLWorld::getInstance();
         LLVector3d new_pos_global = mRegionp->getPosGlobalFromRegion(new_pos);
         F32 min_height;
         if (isAvatar())
         {   // Make a better guess about AVs not going underground
-            min_height = LLWorld::getInstance()->resolveLandHeightGlobal(new_pos_global);
+            min_height = world->resolveLandHeightGlobal(new_pos_global);
             min_height += (0.5f * getScale().mV[VZ]);
         }
         else
         {   // This will put the object underground, but we can't tell if it will stop
             // at ground level or not
-            min_height = LLWorld::getInstance()->getMinAllowedZ(this, new_pos_global);
+            min_height = world->getMinAllowedZ(this, new_pos_global);
             // Cap maximum height
-            new_pos.mV[VZ] = llmin(LLWorld::getInstance()->getRegionMaxHeight(), new_pos.mV[VZ]);
+            new_pos.mV[VZ] = llmin(world->getRegionMaxHeight(), new_pos.mV[VZ]);
         }
 
         new_pos.mV[VZ] = llmax(min_height, new_pos.mV[VZ]);
@@ -2597,7 +2625,7 @@ void LLViewerObject::interpolateLinearMotion(const F64SecondsImplicit& frame_tim
             new_pos_global = mRegionp->getPosGlobalFromRegion(new_pos);     // Re-fetch in case it got clipped above
 
             // Clip the positions to known regions
-            LLVector3d clip_pos_global = LLWorld::getInstance()->clipToVisibleRegions(old_pos_global, new_pos_global);
+            LLVector3d clip_pos_global = world->clipToVisibleRegions(old_pos_global, new_pos_global);
             if (clip_pos_global != new_pos_global)
             {
                 // Was clipped, so this means we hit a edge where there is no region to enter
@@ -836,12 +836,22 @@ void LLViewerObjectList::update(LLAgent &agent)
     LL_PROFILE_ZONE_SCOPED_CATEGORY_NETWORK;
 
     // Update globals
-    LLViewerObject::setVelocityInterpolate( gSavedSettings.getBOOL("VelocityInterpolate") );
-    LLViewerObject::setPingInterpolate( gSavedSettings.getBOOL("PingInterpolate") );
-
-    F32 interp_time = gSavedSettings.getF32("InterpolationTime");
-    F32 phase_out_time = gSavedSettings.getF32("InterpolationPhaseOut");
-    F32 region_interp_time = llclamp(gSavedSettings.getF32("RegionCrossingInterpolationTime"), 0.5f, 5.f);
+    // cached controls:  this runs every frame, so avoid six settings-map
+    // lookups by name
+    static LLCachedControl<bool> velocity_interpolate(gSavedSettings, "VelocityInterpolate");
+    static LLCachedControl<bool> ping_interpolate(gSavedSettings, "PingInterpolate");
+    static LLCachedControl<F32> interpolation_time(gSavedSettings, "InterpolationTime");
+    static LLCachedControl<F32> interpolation_phase_out(gSavedSettings, "InterpolationPhaseOut");
+    static LLCachedControl<F32> region_crossing_interpolation_time(gSavedSettings, "RegionCrossingInterpolationTime");
+    static LLCachedControl<bool> animate_textures(gSavedSettings, "AnimateTextures");
+    static LLCachedControl<bool> freeze_time(gSavedSettings, "FreezeTime");
+
+    LLViewerObject::setVelocityInterpolate(velocity_interpolate);
+    LLViewerObject::setPingInterpolate(ping_interpolate);
+
+    F32 interp_time = interpolation_time;
+    F32 phase_out_time = interpolation_phase_out;
+    F32 region_interp_time = llclamp((F32)region_crossing_interpolation_time, 0.5f, 5.f);
     if (interp_time < 0.0 ||
         phase_out_time < 0.0 ||
         phase_out_time > interp_time)
@@ -854,7 +864,7 @@ void LLViewerObjectList::update(LLAgent &agent)
     LLViewerObject::setMaxUpdateInterpolationTime( phase_out_time );
     LLViewerObject::setMaxRegionCrossingInterpolationTime(region_interp_time);
 
-    gAnimateTextures = gSavedSettings.getBOOL("AnimateTextures");
+    gAnimateTextures = animate_textures;
 
     // update global timer
     F32 last_time = gFrameTimeSeconds;
@@ -887,20 +897,19 @@ void LLViewerObjectList::update(LLAgent &agent)
     mNumAvatars = 0;
 
     {
+        // size once up front so the loop body is a straight indexed store
+        if (idle_list.size() < mActiveObjects.size())
+        {
+            idle_list.resize(mActiveObjects.size());
+        }
+
         for (std::vector<LLPointer<LLViewerObject> >::iterator active_iter = mActiveObjects.begin();
             active_iter != mActiveObjects.end(); active_iter++)
         {
             objectp = *active_iter;
             if (objectp)
             {
-                if (idle_count >= idle_list.size())
-                {
-                    idle_list.push_back( objectp );
-                }
-            else
-                {
-                    idle_list[idle_count] = objectp;
-                }
+                idle_list[idle_count] = objectp;
                 ++idle_count;
                 if (objectp->isAvatar())
                 {
@@ -917,7 +926,7 @@ void LLViewerObjectList::update(LLAgent &agent)
 
     std::vector<LLViewerObject*>::iterator idle_end = idle_list.begin()+idle_count;
 
-    if (gSavedSettings.getBOOL("FreezeTime"))
+    if (freeze_time)
     {
 
         for (std::vector<LLViewerObject*>::iterator iter = idle_list.begin();
@@ -1979,17 +1988,18 @@ void LLViewerObjectList::orphanize(LLViewerObject *childp, U32 parent_id, U32 ip
     // Unknown parent, add to orpaned child list
     U64 parent_info = getIndex(parent_id, ip, port);
 
-    if (std::find(mOrphanParents.begin(), mOrphanParents.end(), parent_info) == mOrphanParents.end())
+    // only the waiting children of this one parent need a duplicate check
+    std::pair<orphan_map_t::iterator, orphan_map_t::iterator> range = mOrphanChildren.equal_range(parent_info);
+    for (orphan_map_t::iterator iter = range.first; iter != range.second; ++iter)
     {
-        mOrphanParents.push_back(parent_info);
+        if (iter->second.mChildInfo == childp->mID)
+        {
+            return;
+        }
     }
 
-    LLViewerObjectList::OrphanInfo oi(parent_info, childp->mID);
-    if (std::find(mOrphanChildren.begin(), mOrphanChildren.end(), oi) == mOrphanChildren.end())
-    {
-        mOrphanChildren.push_back(oi);
-        mNumOrphans++;
-    }
+    mOrphanChildren.emplace(parent_info, OrphanInfo(parent_info, childp->mID));
+    mNumOrphans++;
 }
 
 
@@ -2011,30 +2021,28 @@ void LLViewerObjectList::findOrphans(LLViewerObject* objectp, U32 ip, U32 port)
     }
 
     // See if we are a parent of an orphan.
-    // Note:  This code is fairly inefficient but it should happen very rarely.
-    // It can be sped up if this is somehow a performance issue...
-    if (mOrphanParents.empty())
+    U64 parent_info = getIndex(objectp->mLocalID, ip, port);
+    std::pair<orphan_map_t::iterator, orphan_map_t::iterator> range = mOrphanChildren.equal_range(parent_info);
+    if (range.first == range.second)
     {
-        // no known orphan parents
+        // no orphans waiting on this parent
         return;
     }
-    if (std::find(mOrphanParents.begin(), mOrphanParents.end(), getIndex(objectp->mLocalID, ip, port)) == mOrphanParents.end())
+
+    // Claim the waiting children up front; reuniting touches a fair amount
+    // of machinery and must not walk a live iterator into the map.
+    std::vector<OrphanInfo> waiting;
+    for (orphan_map_t::iterator iter = range.first; iter != range.second; ++iter)
     {
-        // did not find objectp in OrphanParent list
-        return;
+        waiting.push_back(iter->second);
     }
+    mNumOrphans -= (S32)mOrphanChildren.erase(parent_info);
 
-    U64 parent_info = getIndex(objectp->mLocalID, ip, port);
     bool orphans_found = false;
-    // Iterate through the orphan list, and set parents of matching children.
-
-    for (std::vector<OrphanInfo>::iterator iter = mOrphanChildren.begin(); iter != mOrphanChildren.end(); )
+    F64 now = LLTimer::getTotalSeconds();
+    // Set parents of the matching children.
+    for (std::vector<OrphanInfo>::iterator iter = waiting.begin(); iter != waiting.end(); ++iter)
     {
-        if (iter->mParentInfo != parent_info)
-        {
-            ++iter;
-            continue;
-        }
         LLViewerObject *childp = findObject(iter->mChildInfo);
         if (childp)
         {
@@ -2042,12 +2050,12 @@ void LLViewerObjectList::findOrphans(LLViewerObject* objectp, U32 ip, U32 port)
             {
                 LL_WARNS() << objectp->mID << " has self as parent, skipping!"
                     << LL_ENDL;
-                ++iter;
                 continue;
             }
 
             LL_DEBUGS("ORPHANS") << "Reunited parent " << objectp->mID
-                << " with child " << childp->mID << LL_ENDL;
+                << " with child " << childp->mID
+                << " after " << (F32)(now - iter->mOrphanedAt) << "s orphaned" << LL_ENDL;
             LL_DEBUGS("ORPHANS") << "Glob: " << objectp->getPositionGlobal() << LL_ENDL;
             LL_DEBUGS("ORPHANS") << "Agent: " << objectp->getPositionAgent() << LL_ENDL;
 #ifdef ORPHAN_SPAM
@@ -2071,35 +2079,10 @@ void LLViewerObjectList::findOrphans(LLViewerObject* objectp, U32 ip, U32 port)
 
             objectp->addChild(childp);
             orphans_found = true;
-            ++iter;
         }
         else
         {
             LL_INFOS() << "Missing orphan child, removing from list" << LL_ENDL;
-
-            iter = mOrphanChildren.erase(iter);
-        }
-    }
-
-    // Remove orphan parent and children from lists now that they've been found
-    {
-        std::vector<U64>::iterator iter = std::find(mOrphanParents.begin(), mOrphanParents.end(), parent_info);
-        if (iter != mOrphanParents.end())
-        {
-            mOrphanParents.erase(iter);
-        }
-    }
-
-    for (std::vector<OrphanInfo>::iterator iter = mOrphanChildren.begin(); iter != mOrphanChildren.end(); )
-    {
-        if (iter->mParentInfo == parent_info)
-        {
-            iter = mOrphanChildren.erase(iter);
-            mNumOrphans--;
-        }
-        else
-        {
-            ++iter;
         }
     }
 
@@ -2118,12 +2101,12 @@ void LLViewerObjectList::findOrphans(LLViewerObject* objectp, U32 ip, U32 port)
 ////////////////////////////////////////////////////////////////////////////
 
 LLViewerObjectList::OrphanInfo::OrphanInfo()
-    : mParentInfo(0)
+    : mParentInfo(0), mOrphanedAt(0.0)
 {
 }
 
 LLViewerObjectList::OrphanInfo::OrphanInfo(const U64 parent_info, const LLUUID child_info)
-    : mParentInfo(parent_info), mChildInfo(child_info)
+    : mParentInfo(parent_info), mChildInfo(child_info), mOrphanedAt(LLTimer::getTotalSeconds())
 {
 }
 
@@ -2137,6 +2120,19 @@ bool LLViewerObjectList::OrphanInfo::operator!=(const OrphanInfo &rhs) const
     return !operator==(rhs);
 }
 
+S32 LLViewerObjectList::getOrphanParentCount() const
+{
+    // distinct parent keys; entries with equivalent keys iterate adjacently
+    S32 count = 0;
+    orphan_map_t::const_iterator iter = mOrphanChildren.begin();
+    while (iter != mOrphanChildren.end())
+    {
+        ++count;
+        iter = mOrphanChildren.equal_range(iter->first).second;
+    }
+    return count;
+}
+
 
 LLDebugBeacon::~LLDebugBeacon()
 {
@@ -29,10 +29,12 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 
 // common includes
 #include "llstring.h"
 #include "lltrace.h"
+#include "lluuidflatmap.h"
 
 // project includes
 #include "llviewerobject.h"
@@ -143,7 +145,7 @@ public:
 
     S32 findReferences(LLDrawable *drawablep) const; // Find references to drawable in all objects, and return value.
 
-    S32 getOrphanParentCount() const { return (S32) mOrphanParents.size(); }
+    S32 getOrphanParentCount() const;
     S32 getOrphanCount() const { return mNumOrphans; }
     S32 getAvatarCount() const { return mNumAvatars; }
     void orphanize(LLViewerObject *childp, U32 parent_id, U32 ip, U32 port);
@@ -160,6 +162,7 @@ public:
         bool operator!=(const OrphanInfo &rhs) const;
         U64 mParentInfo;
         LLUUID mChildInfo;
+        F64 mOrphanedAt;        // timestamp for orphan dwell-time reporting
     };
 
 
@@ -188,9 +191,13 @@ public:
     S32 mNumUnknownUpdates;
     S32 mNumDeadObjectUpdates;
     S32 mNumDeadObjects;
+    // Orphaned children keyed by parent LocalID/ip,port index so a newly
+    // arrived parent claims its waiting children in one hash lookup instead
+    // of a linear scan of every orphan in the session.
+    typedef std::unordered_multimap<U64, OrphanInfo> orphan_map_t;
+
 protected:
-    std::vector<U64>    mOrphanParents; // LocalID/ip,port of orphaned objects
-    std::vector<OrphanInfo> mOrphanChildren;    // UUID's of orphaned objects
+    orphan_map_t mOrphanChildren;   // orphaned objects, keyed by parent info
     S32 mNumOrphans;
     S32 mNumAvatars;
 
@@ -203,7 +210,9 @@ protected:
 
     uuid_set_t   mDeadObjects;
 
-    std::map<LLUUID, LLPointer<LLViewerObject> > mUUIDObjectMap;
+    // flat open-addressing table; findObject() is one of the hottest
+    // lookups in the viewer and a node-based map thrashes cache there
+    LLUUIDFlatMap<LLPointer<LLViewerObject> > mUUIDObjectMap;
 
     //set of objects that need to update their cost
     uuid_set_t   mStaleObjectCost;
@@ -262,10 +271,10 @@ inline LLViewerObject *LLViewerObjectList::findObject(const LLUUID &id)
     if (id.isNull())
         return NULL;
 
-    auto iter = mUUIDObjectMap.find(id);
-    if (iter != mUUIDObjectMap.end())
+    LLPointer<LLViewerObject>* objectpp = mUUIDObjectMap.find(id);
+    if (objectpp)
     {
-        return iter->second;
+        return *objectpp;
     }
 
     return NULL;
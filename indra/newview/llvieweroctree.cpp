@@ -861,6 +861,20 @@ public:
 };
 
 
+// quantize a camera position onto a coarse grid. Against a static scene, a
+// query answered "occluded" stays valid for as long as the camera remains
+// inside the cell it was issued from, so repeated queries from one cell only
+// re-confirm the same answer. Half a meter keeps the position error well
+// under the fudge factor already applied to query boxes.
+static U64 occlusion_cell_key(const LLVector3& origin)
+{
+    const F32 OCCLUSION_CELL_SIZE = 0.5f; // meters
+    U64 x = (U64)(S64)llfloor(origin.mV[VX] / OCCLUSION_CELL_SIZE) & 0x1FFFFF;
+    U64 y = (U64)(S64)llfloor(origin.mV[VY] / OCCLUSION_CELL_SIZE) & 0x1FFFFF;
+    U64 z = (U64)(S64)llfloor(origin.mV[VZ] / OCCLUSION_CELL_SIZE) & 0x1FFFFF;
+    return (x << 42) | (y << 21) | z;
+}
+
 LLOcclusionCullingGroup::LLOcclusionCullingGroup(OctreeNode* node, LLViewerOctreePartition* part) :
     LLViewerOctreeGroup(node),
     mSpatialPartition(part)
@@ -878,6 +892,8 @@ LLOcclusionCullingGroup::LLOcclusionCullingGroup(OctreeNode* node, LLViewerOctre
         mOcclusionIssued[i] = 0;
         mOcclusionState[i] = parent ? SG_STATE_INHERIT_MASK & parent->mOcclusionState[i] : 0;
         mVisible[i] = 0;
+        mOcclusionCell[i] = 0;
+        mOcclusionConfirmed[i] = 0;
     }
 }
 
@@ -1125,6 +1141,7 @@ void LLOcclusionCullingGroup::checkOcclusion()
             // mark non-occluded
             clearOcclusionState(LLOcclusionCullingGroup::OCCLUDED, LLOcclusionCullingGroup::STATE_MODE_DIFF);
             clearOcclusionState(QUERY_PENDING | DISCARD_QUERY);
+            mOcclusionConfirmed[LLViewerCamera::sCurCameraID] = 0;
         }
         else
         {
@@ -1152,10 +1169,13 @@ void LLOcclusionCullingGroup::checkOcclusion()
                 if (query_result > 0)
                 {
                     clearOcclusionState(LLOcclusionCullingGroup::OCCLUDED, LLOcclusionCullingGroup::STATE_MODE_DIFF);
+                    mOcclusionConfirmed[LLViewerCamera::sCurCameraID] = 0;
                 }
                 else
                 {
                     setOcclusionState(LLOcclusionCullingGroup::OCCLUDED, LLOcclusionCullingGroup::STATE_MODE_DIFF);
+                    // another occluded answer from the cell recorded at issue time
+                    ++mOcclusionConfirmed[LLViewerCamera::sCurCameraID];
                 }
                 clearOcclusionState(QUERY_PENDING);
             }
@@ -1199,6 +1219,38 @@ void LLOcclusionCullingGroup::doOcclusion(LLCamera* camera, const LLVector4a* sh
         }
         else
         {
+            static LLCachedControl<bool> cached_occlusion(gSavedSettings, "RenderCachedOcclusionCulling", false);
+            if (cached_occlusion)
+            {
+                // how many consecutive occluded answers from one camera cell
+                // it takes before the result is trusted without re-querying
+                const U32 OCCLUSION_CONFIRM_COUNT = 2;
+                // pending rebuilds and bounds changes invalidate the
+                // confirmation; GEOM_DIRTY and ALPHA_DIRTY live in the
+                // LLSpatialGroup extension of the base state bits
+                const U32 dirty_mask = DIRTY | OBJECT_DIRTY | INVALID_STATE | (INVALID_STATE << 1);
+                const S32 cam = LLViewerCamera::sCurCameraID;
+                U64 cell = occlusion_cell_key(camera->getOrigin());
+                if (cell != mOcclusionCell[cam])
+                {
+                    mOcclusionCell[cam] = cell;
+                    mOcclusionConfirmed[cam] = 0;
+                }
+                else if (isOcclusionState(OCCLUDED)
+                         && !hasState(dirty_mask)
+                         && mOcclusionConfirmed[cam] >= OCCLUSION_CONFIRM_COUNT)
+                {
+                    // static group repeatedly confirmed occluded from this
+                    // camera cell; keep the standing result instead of
+                    // issuing yet another query for the same answer
+                    return;
+                }
+                else if (hasState(dirty_mask))
+                {
+                    mOcclusionConfirmed[cam] = 0;
+                }
+            }
+
             if (!isOcclusionState(QUERY_PENDING) || isOcclusionState(DISCARD_QUERY))
             {
                 { //no query pending, or previous query to be discarded
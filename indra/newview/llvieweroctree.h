@@ -338,6 +338,15 @@ protected:
     U32                      mOcclusionQuery[LLViewerCamera::NUM_CAMERAS];
     U32                      mOcclusionCheckCount[LLViewerCamera::NUM_CAMERAS];
 
+    // cached-visibility support: the camera cell each camera's last occlusion
+    // query was issued from, and how many consecutive queries from that cell
+    // came back occluded. Once a static group is confirmed occluded from the
+    // current cell, doOcclusion() keeps the standing result instead of
+    // re-issuing a query every frame; leaving the cell or dirtying the group
+    // starts the confirmation over.
+    U64                      mOcclusionCell[LLViewerCamera::NUM_CAMERAS];
+    U32                      mOcclusionConfirmed[LLViewerCamera::NUM_CAMERAS];
+
 public:
     static std::set<U32> sPendingQueries;
 };//LL_ALIGN_POSTFIX(16);
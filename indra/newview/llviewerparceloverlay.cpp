@@ -66,7 +66,9 @@ LLViewerParcelOverlay::LLViewerParcelOverlay(LLViewerRegion* region, F32 region_
     mParcelGridsPerEdge( S32( region_width_meters / PARCEL_GRID_STEP_METERS ) ),
     mDirty( false ),
     mTimeSinceLastUpdate(),
-    mOverlayTextureIdx(-1)
+    mDirtyRowStart(-1),
+    mDirtyRowEnd(-1),
+    mMinimapLinesDirty(true)
 {
     if (!sColorSetInitialized)
     {
@@ -333,12 +335,8 @@ F32 LLViewerParcelOverlay::getOwnedRatio() const
 // Note: Assumes that the ownership array and
 void LLViewerParcelOverlay::updateOverlayTexture()
 {
-    if (mOverlayTextureIdx < 0)
-    {
-        if (!mDirty)
-            return;
-        mOverlayTextureIdx = 0;
-    }
+    if (!mDirty || mDirtyRowStart < 0)
+        return;
 
     const LLColor4U avail = sAvailColor.get();
     const LLColor4U owned = sOwnedColor.get();
@@ -347,14 +345,15 @@ void LLViewerParcelOverlay::updateOverlayTexture()
     const LLColor4U for_sale = sForSaleColor.get();
     const LLColor4U auction = sAuctionColor.get();
 
-    // Create the base texture.
+    // Recolor only the dirty rows.
     U8 *raw = mImageRaw->getData();
-    const S32 COUNT = mParcelGridsPerEdge * mParcelGridsPerEdge;
-    S32 max = mOverlayTextureIdx + mParcelGridsPerEdge;
-    if (max > COUNT) max = COUNT;
-    S32 pixel_index = mOverlayTextureIdx*OVERLAY_IMG_COMPONENTS;
+    const S32 start_row = mDirtyRowStart;
+    const S32 end_row = llmin(mDirtyRowEnd, mParcelGridsPerEdge - 1);
+    const S32 start = start_row * mParcelGridsPerEdge;
+    const S32 max = (end_row + 1) * mParcelGridsPerEdge;
+    S32 pixel_index = start*OVERLAY_IMG_COMPONENTS;
     S32 i;
-    for (i = mOverlayTextureIdx; i < max; i++)
+    for (i = start; i < max; i++)
     {
         U8 ownership = mOwnership[i];
 
@@ -415,20 +414,12 @@ void LLViewerParcelOverlay::updateOverlayTexture()
         pixel_index += OVERLAY_IMG_COMPONENTS;
     }
 
-    // Copy data into GL texture from raw data
-    if (i >= COUNT)
+    // Copy only the dirty rows into the GL texture
+    if (!mTexture->hasGLTexture())
     {
-        if (!mTexture->hasGLTexture())
-        {
-            mTexture->createGLTexture(0, mImageRaw);
-        }
-        mTexture->setSubImage(mImageRaw, 0, 0, mParcelGridsPerEdge, mParcelGridsPerEdge);
-        mOverlayTextureIdx = -1;
-    }
-    else
-    {
-        mOverlayTextureIdx = i;
+        mTexture->createGLTexture(0, mImageRaw);
     }
+    mTexture->setSubImage(mImageRaw, 0, start_row, mParcelGridsPerEdge, end_row - start_row + 1);
 }
 
 
@@ -440,8 +431,19 @@ void LLViewerParcelOverlay::uncompressLandOverlay(S32 chunk, U8 *packed_overlay)
 
     memcpy(mOwnership + chunk*chunk_size, packed_overlay, chunk_size);      /*Flawfinder: ignore*/
 
-    // Force property lines and overlay texture to update
-    setDirty();
+    // Chunks cover contiguous whole grid rows, so accumulate the row span
+    // and let idleUpdate fold all pending chunks into one texture update
+    // and one property-line rebuild instead of redoing the full grid per
+    // chunk
+    if (chunk_size % mParcelGridsPerEdge == 0)
+    {
+        S32 rows_per_chunk = chunk_size / mParcelGridsPerEdge;
+        dirtyRows(chunk * rows_per_chunk, (chunk + 1) * rows_per_chunk - 1);
+    }
+    else
+    {
+        setDirty();
+    }
 }
 
 void LLViewerParcelOverlay::updatePropertyLines()
@@ -458,13 +460,26 @@ void LLViewerParcelOverlay::updatePropertyLines()
     colors[PARCEL_FOR_SALE] = sForSaleColor.get();
     colors[PARCEL_AUCTION] = sAuctionColor.get();
 
-    mEdges.clear();
-
     const F32 GRID_STEP = PARCEL_GRID_STEP_METERS;
     const S32 GRIDS_PER_EDGE = mParcelGridsPerEdge;
 
-    for (S32 row = 0; row < GRIDS_PER_EDGE; row++)
+    mEdges.resize(GRIDS_PER_EDGE);
+
+    // Rebuild only the dirty rows. A row's north edges depend on the row
+    // above it, so extend the span one row south.
+    S32 start_row = 0;
+    S32 end_row = GRIDS_PER_EDGE - 1;
+    if (mDirtyRowStart >= 0)
+    {
+        start_row = llmax(mDirtyRowStart - 1, 0);
+        end_row = llmin(mDirtyRowEnd, GRIDS_PER_EDGE - 1);
+    }
+
+    for (S32 row = start_row; row <= end_row; row++)
     {
+        std::vector<Edge>& row_edges = mEdges[row];
+        row_edges.clear();
+
         for (S32 col = 0; col < GRIDS_PER_EDGE; col++)
         {
             U8 overlay = mOwnership[row*GRIDS_PER_EDGE+col];
@@ -492,40 +507,42 @@ void LLViewerParcelOverlay::updatePropertyLines()
             // West edge
             if (overlay & PARCEL_WEST_LINE)
             {
-                addPropertyLine(left, bottom, 0, 1, LINE_WIDTH, 0, color);
+                addPropertyLine(row_edges, left, bottom, 0, 1, LINE_WIDTH, 0, color);
             }
 
             // East edge
             if (col == GRIDS_PER_EDGE - 1 || mOwnership[row * GRIDS_PER_EDGE + col + 1] & PARCEL_WEST_LINE)
             {
-                addPropertyLine(right, bottom, 0, 1, -LINE_WIDTH, 0, color);
+                addPropertyLine(row_edges, right, bottom, 0, 1, -LINE_WIDTH, 0, color);
             }
 
             // South edge
             if (overlay & PARCEL_SOUTH_LINE)
             {
-                addPropertyLine(left, bottom, 1, 0, 0, LINE_WIDTH, color);
+                addPropertyLine(row_edges, left, bottom, 1, 0, 0, LINE_WIDTH, color);
             }
 
             // North edge
             if (row == GRIDS_PER_EDGE - 1 || mOwnership[(row + 1) * GRIDS_PER_EDGE + col] & PARCEL_SOUTH_LINE)
             {
-                addPropertyLine(left, top, 1, 0, 0, -LINE_WIDTH, color);
+                addPropertyLine(row_edges, left, top, 1, 0, 0, -LINE_WIDTH, color);
             }
         }
     }
 
     // Everything's clean now
     mDirty = false;
+    mDirtyRowStart = -1;
+    mDirtyRowEnd = -1;
 }
 
-void LLViewerParcelOverlay::addPropertyLine(F32 start_x, F32 start_y, F32 dx, F32 dy, F32 tick_dx, F32 tick_dy, const LLColor4U& color)
+void LLViewerParcelOverlay::addPropertyLine(std::vector<Edge>& edges, F32 start_x, F32 start_y, F32 dx, F32 dy, F32 tick_dx, F32 tick_dy, const LLColor4U& color)
 {
     LLSurface& land = mRegion->getLand();
     F32 water_z = land.getWaterHeight();
 
-    mEdges.resize(mEdges.size() + 1);
-    Edge& edge = mEdges.back();
+    edges.resize(edges.size() + 1);
+    Edge& edge = edges.back();
     edge.color = color;
 
     F32 outside_x = start_x;
@@ -625,7 +642,23 @@ void LLViewerParcelOverlay::addPropertyLine(F32 start_x, F32 start_y, F32 dx, F3
 
 void LLViewerParcelOverlay::setDirty()
 {
+    dirtyRows(0, mParcelGridsPerEdge - 1);
+}
+
+void LLViewerParcelOverlay::dirtyRows(S32 row_start, S32 row_end)
+{
+    if (mDirtyRowStart < 0)
+    {
+        mDirtyRowStart = row_start;
+        mDirtyRowEnd = row_end;
+    }
+    else
+    {
+        mDirtyRowStart = llmin(mDirtyRowStart, row_start);
+        mDirtyRowEnd = llmax(mDirtyRowEnd, row_end);
+    }
     mDirty = true;
+    mMinimapLinesDirty = true;
 }
 
 void LLViewerParcelOverlay::updateGL()
@@ -640,12 +673,6 @@ void LLViewerParcelOverlay::idleUpdate(bool force_update)
     {
         return;
     }
-    if (mOverlayTextureIdx >= 0 && (!(mDirty && force_update)))
-    {
-        // We are in the middle of updating the overlay texture
-        gPipeline.markGLRebuild(this);
-        return;
-    }
     // Only if we're dirty and it's been a while since the last update.
     if (mDirty)
     {
@@ -711,83 +738,103 @@ void LLViewerParcelOverlay::renderPropertyLines()
 
     const F32 PROPERTY_LINE_CLIP_DIST_SQUARED = 256.f * 256.f;
 
-    for (const Edge& edge : mEdges)
+    for (const std::vector<Edge>& row_edges : mEdges)
     {
-        LLVector3 center = edge.vertices[edge.vertices.size() >> 1];
-
-        if (dist_vec_squared2D(center, camera_region) > PROPERTY_LINE_CLIP_DIST_SQUARED)
-        {
-            continue;
-        }
-
-        // Destroy vertex, transform to plane-local.
-        center -= cull_plane_point;
-
-        // Negative dot product means it is in back of the plane
-        if (center * CAMERA_AT < 0.f)
+        for (const Edge& edge : row_edges)
         {
-            continue;
-        }
+            LLVector3 center = edge.vertices[edge.vertices.size() >> 1];
 
-        gGL.begin(LLRender::TRIANGLE_STRIP);
-
-        gGL.color4ubv(edge.color.mV);
-
-        for (const LLVector3& vertex : edge.vertices)
-        {
-            if (render_hidden || camera_z < water_z || vertex.mV[2] >= water_z)
+            if (dist_vec_squared2D(center, camera_region) > PROPERTY_LINE_CLIP_DIST_SQUARED)
             {
-                gGL.vertex3fv(vertex.mV);
-            }
-            else
-            {
-                LLVector3 visible = vertex;
-                visible.mV[2] = water_z;
-                gGL.vertex3fv(visible.mV);
+                continue;
             }
-        }
 
-        gGL.end();
+            // Destroy vertex, transform to plane-local.
+            center -= cull_plane_point;
 
-        if (render_hidden)
-        {
-            LLGLDepthTest depth(GL_TRUE, GL_FALSE, GL_GREATER);
+            // Negative dot product means it is in back of the plane
+            if (center * CAMERA_AT < 0.f)
+            {
+                continue;
+            }
 
             gGL.begin(LLRender::TRIANGLE_STRIP);
 
-            LLColor4U color = edge.color;
-            color.mV[3] /= 4;
-            gGL.color4ubv(color.mV);
+            gGL.color4ubv(edge.color.mV);
 
             for (const LLVector3& vertex : edge.vertices)
             {
-                gGL.vertex3fv(vertex.mV);
+                if (render_hidden || camera_z < water_z || vertex.mV[2] >= water_z)
+                {
+                    gGL.vertex3fv(vertex.mV);
+                }
+                else
+                {
+                    LLVector3 visible = vertex;
+                    visible.mV[2] = water_z;
+                    gGL.vertex3fv(visible.mV);
+                }
             }
 
             gGL.end();
+
+            if (render_hidden)
+            {
+                LLGLDepthTest depth(GL_TRUE, GL_FALSE, GL_GREATER);
+
+                gGL.begin(LLRender::TRIANGLE_STRIP);
+
+                LLColor4U color = edge.color;
+                color.mV[3] /= 4;
+                gGL.color4ubv(color.mV);
+
+                for (const LLVector3& vertex : edge.vertices)
+                {
+                    gGL.vertex3fv(vertex.mV);
+                }
+
+                gGL.end();
+            }
         }
     }
 
     gGL.popMatrix();
 }
 
-// Draw half of a single cell (no fill) in a grid drawn from left to right and from bottom to top
-void grid_2d_part_lines(const F32 left, const F32 top, const F32 right, const F32 bottom, bool has_left, bool has_bottom)
+// Walk the ownership grid and cache the minimap property lines as endpoint
+// pairs in region-relative meters.  Camera offset and zoom vary every frame
+// but are pure transforms, so they stay out of the cached data.
+void LLViewerParcelOverlay::updateMinimapLines()
 {
-    gGL.begin(LLRender::LINES);
+    mMinimapLines.clear();
+    mMinimapLinesDirty = false;
 
-    if (has_left)
-    {
-        gGL.vertex2f(left, bottom);
-        gGL.vertex2f(left, top);
-    }
-    if (has_bottom)
+    const S32 GRIDS_PER_EDGE = mParcelGridsPerEdge;
+
+    for (S32 i = 0; i <= GRIDS_PER_EDGE; i++)
     {
-        gGL.vertex2f(left, bottom);
-        gGL.vertex2f(right, bottom);
+        const F32 bottom = i * PARCEL_GRID_STEP_METERS;
+        const F32 top    = bottom + PARCEL_GRID_STEP_METERS;
+        for (S32 j = 0; j <= GRIDS_PER_EDGE; j++)
+        {
+            const F32  left               = j * PARCEL_GRID_STEP_METERS;
+            const F32  right              = left + PARCEL_GRID_STEP_METERS;
+            const bool is_region_boundary = i == GRIDS_PER_EDGE || j == GRIDS_PER_EDGE;
+            const U8   overlay            = is_region_boundary ? 0 : mOwnership[(i * GRIDS_PER_EDGE) + j];
+            // The property line vertices are three-dimensional, but here we only care about the x and y coordinates, as we are drawing on a
+            // 2D map
+            if (i != GRIDS_PER_EDGE && (j == GRIDS_PER_EDGE || (overlay & PARCEL_WEST_LINE)))
+            {
+                mMinimapLines.push_back(LLVector2(left, bottom));
+                mMinimapLines.push_back(LLVector2(left, top));
+            }
+            if (j != GRIDS_PER_EDGE && (i == GRIDS_PER_EDGE || (overlay & PARCEL_SOUTH_LINE)))
+            {
+                mMinimapLines.push_back(LLVector2(left, bottom));
+                mMinimapLines.push_back(LLVector2(right, bottom));
+            }
+        }
     }
-
-    gGL.end();
 }
 
 void LLViewerParcelOverlay::renderPropertyLinesOnMinimap(F32 scale_pixels_per_meter, const F32 *parcel_outline_color)
@@ -799,31 +846,40 @@ void LLViewerParcelOverlay::renderPropertyLinesOnMinimap(F32 scale_pixels_per_me
         return;
     }
 
-    LLVector3 origin_agent     = mRegion->getOriginAgent();
-    LLVector3 rel_region_pos   = origin_agent - gAgentCamera.getCameraPositionAgent();
-    F32       region_left      = rel_region_pos.mV[0] * scale_pixels_per_meter;
-    F32       region_bottom    = rel_region_pos.mV[1] * scale_pixels_per_meter;
-    F32       map_parcel_width = PARCEL_GRID_STEP_METERS * scale_pixels_per_meter;
-    const S32 GRIDS_PER_EDGE   = mParcelGridsPerEdge;
+    if (mMinimapLinesDirty)
+    {
+        updateMinimapLines();
+    }
+    if (mMinimapLines.empty())
+    {
+        return;
+    }
+
+    LLVector3 origin_agent   = mRegion->getOriginAgent();
+    LLVector3 rel_region_pos = origin_agent - gAgentCamera.getCameraPositionAgent();
 
     gGL.getTexUnit(0)->unbind(LLTexUnit::TT_TEXTURE);
     glLineWidth(1.0f);
     gGL.color4fv(parcel_outline_color);
-    for (S32 i = 0; i <= GRIDS_PER_EDGE; i++)
+    gGL.pushMatrix();
+    gGL.translatef(rel_region_pos.mV[0] * scale_pixels_per_meter,
+                   rel_region_pos.mV[1] * scale_pixels_per_meter, 0.f);
+    gGL.scalef(scale_pixels_per_meter, scale_pixels_per_meter, 1.f);
+
+    // keep each batch under the immediate-mode buffer limit
+    const size_t VERTS_PER_BATCH = 2048;
+    size_t count = 0;
+    gGL.begin(LLRender::LINES);
+    for (std::vector<LLVector2>::const_iterator it = mMinimapLines.begin();
+         it != mMinimapLines.end(); ++it)
     {
-        const F32 bottom = region_bottom + (i * map_parcel_width);
-        const F32 top    = bottom + map_parcel_width;
-        for (S32 j = 0; j <= GRIDS_PER_EDGE; j++)
+        gGL.vertex2fv(it->mV);
+        if (++count % VERTS_PER_BATCH == 0)
         {
-            const F32  left               = region_left + (j * map_parcel_width);
-            const F32  right              = left + map_parcel_width;
-            const bool is_region_boundary = i == GRIDS_PER_EDGE || j == GRIDS_PER_EDGE;
-            const U8   overlay            = is_region_boundary ? 0 : mOwnership[(i * GRIDS_PER_EDGE) + j];
-            // The property line vertices are three-dimensional, but here we only care about the x and y coordinates, as we are drawing on a
-            // 2D map
-            const bool has_left   = i != GRIDS_PER_EDGE && (j == GRIDS_PER_EDGE || (overlay & PARCEL_WEST_LINE));
-            const bool has_bottom = j != GRIDS_PER_EDGE && (i == GRIDS_PER_EDGE || (overlay & PARCEL_SOUTH_LINE));
-            grid_2d_part_lines(left, top, right, bottom, has_left, has_bottom);
+            gGL.end();
+            gGL.begin(LLRender::LINES);
         }
     }
+    gGL.end();
+    gGL.popMatrix();
 }
@@ -36,6 +36,7 @@
 #include "llviewertexture.h"
 #include "llgl.h"
 #include "lluicolor.h"
+#include "v2math.h"
 
 class LLViewerRegion;
 class LLVector3;
@@ -86,6 +87,12 @@ public:
     void    updateGL();
 
 private:
+    struct Edge
+    {
+        std::vector<LLVector3> vertices;
+        LLColor4U color;
+    };
+
     // This is in parcel rows and columns, not grid rows and columns
     // Stored in bottom three bits.
     U8      ownership(S32 row, S32 col) const
@@ -93,10 +100,15 @@ private:
 
     U8      parcelFlags(S32 row, S32 col, U8 flags) const;
 
-    void    addPropertyLine(F32 start_x, F32 start_y, F32 dx, F32 dy, F32 tick_dx, F32 tick_dy, const LLColor4U& color);
+    void    addPropertyLine(std::vector<Edge>& edges, F32 start_x, F32 start_y, F32 dx, F32 dy, F32 tick_dx, F32 tick_dy, const LLColor4U& color);
+
+    // Mark a span of grid rows as needing a texture update and a
+    // property-line rebuild.
+    void    dirtyRows(S32 row_start, S32 row_end);
 
     void    updateOverlayTexture();
     void    updatePropertyLines();
+    void    updateMinimapLines();
 
 private:
     // Back pointer to the region that owns this structure.
@@ -115,15 +127,21 @@ private:
     // Update propery lines and overlay texture
     bool            mDirty;
     LLFrameTimer    mTimeSinceLastUpdate;
-    S32             mOverlayTextureIdx;
-
-    struct Edge
-    {
-        std::vector<LLVector3> vertices;
-        LLColor4U color;
-    };
-
-    std::vector<Edge> mEdges;
+    // Inclusive span of grid rows touched since the last rebuild; overlay
+    // chunks cover whole grid rows, so a row span is the dirty rect.
+    // -1 when clean.
+    S32             mDirtyRowStart;
+    S32             mDirtyRowEnd;
+
+    // Property line edges bucketed by the grid row that produced them so
+    // a dirty span only rebuilds its own rows
+    std::vector<std::vector<Edge> > mEdges;
+
+    // Minimap property lines cached as endpoint pairs in region-relative
+    // meters; the camera offset and zoom are applied by the matrix at
+    // draw time, so this only rebuilds when ownership changes
+    std::vector<LLVector2> mMinimapLines;
+    bool            mMinimapLinesDirty;
 
     static bool sColorSetInitialized;
     static LLUIColor sAvailColor;
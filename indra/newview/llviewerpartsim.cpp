@@ -28,6 +28,8 @@
 
 #include "llviewerpartsim.h"
 
+#include "llalignedarray.h"
+#include "llvector4a.h"
 #include "llviewercontrol.h"
 
 #include "llagent.h"
@@ -273,26 +275,56 @@ bool LLViewerPartGroup::addPart(LLViewerPart* part, F32 desired_size)
 }
 
 
+// Structure-of-arrays scratch for the SIMD integration pass in
+// updateParticles().  Shared by all groups -- particle simulation only runs
+// on the main thread -- so capacity is allocated once and reused.
+static LLAlignedArray<F32, 64> sPartPosX;
+static LLAlignedArray<F32, 64> sPartPosY;
+static LLAlignedArray<F32, 64> sPartPosZ;
+static LLAlignedArray<F32, 64> sPartVelX;
+static LLAlignedArray<F32, 64> sPartVelY;
+static LLAlignedArray<F32, 64> sPartVelZ;
+static LLAlignedArray<F32, 64> sPartAccX;
+static LLAlignedArray<F32, 64> sPartAccY;
+static LLAlignedArray<F32, 64> sPartAccZ;
+static LLAlignedArray<F32, 64> sPartDt;
+static LLAlignedArray<F32, 64> sPartFrac;
+static std::vector<U8> sPartSkipIntegrate;
+
 void LLViewerPartGroup::updateParticles(const F32 lastdt)
 {
-    F32 dt;
-
-    LLVector3 gravity(0.f, 0.f, GRAVITY);
-
     LLViewerPartSim::checkParticleCount(static_cast<U32>(mParticles.size()));
 
     LLViewerCamera* camera = LLViewerCamera::getInstance();
     LLViewerRegion *regionp = getRegion();
     S32 end = (S32) mParticles.size();
-    for (S32 i = 0 ; i < (S32)mParticles.size();)
+
+    const S32 count = (S32)mParticles.size();
+    const S32 padded = (count + 3) & ~3;
+
+    sPartPosX.resize(padded);
+    sPartPosY.resize(padded);
+    sPartPosZ.resize(padded);
+    sPartVelX.resize(padded);
+    sPartVelY.resize(padded);
+    sPartVelZ.resize(padded);
+    sPartAccX.resize(padded);
+    sPartAccY.resize(padded);
+    sPartAccZ.resize(padded);
+    sPartDt.resize(padded);
+    sPartFrac.resize(padded);
+    sPartSkipIntegrate.resize(padded);
+
+    // Pass 1: per-particle conditional behaviors (drift, callbacks, wind,
+    // target seeking), then gather state into the structure-of-arrays
+    // scratch for integration
+    for (S32 i = 0; i < count; i++)
     {
-        LLVector3 a(0.f, 0.f, 0.f);
-        LLViewerPart* part = mParticles[i] ;
+        LLViewerPart* part = mParticles[i];
 
-        dt = lastdt + mSkippedTime - part->mSkipOffset;
+        F32 dt = lastdt + mSkippedTime - part->mSkipOffset;
         part->mSkipOffset = 0.f;
 
-        // Update current time
         const F32 cur_time = part->mLastUpdateTime + dt;
         const F32 frac = cur_time / part->mMaxAge;
 
@@ -333,20 +365,99 @@ void LLViewerPartGroup::updateParticles(const F32 lastdt)
             part->mVelocity += step*delta_pos;
         }
 
-
         if (part->mFlags & LLPartData::LL_PART_TARGET_LINEAR_MASK)
         {
+            // position is set directly from the source; skip the integration
+            // scatter for this particle
             LLVector3 delta_pos = part->mPartSourcep->mTargetPosAgent - part->mPartSourcep->mPosAgent;
             part->mPosAgent = part->mPartSourcep->mPosAgent;
             part->mPosAgent += frac*delta_pos;
             part->mVelocity = delta_pos;
+            sPartSkipIntegrate[i] = 1;
         }
         else
         {
-            // Do velocity interpolation
-            part->mPosAgent += dt*part->mVelocity;
-            part->mPosAgent += 0.5f*dt*dt*part->mAccel;
-            part->mVelocity += part->mAccel*dt;
+            sPartSkipIntegrate[i] = 0;
+        }
+
+        sPartPosX[i] = part->mPosAgent.mV[VX];
+        sPartPosY[i] = part->mPosAgent.mV[VY];
+        sPartPosZ[i] = part->mPosAgent.mV[VZ];
+        sPartVelX[i] = part->mVelocity.mV[VX];
+        sPartVelY[i] = part->mVelocity.mV[VY];
+        sPartVelZ[i] = part->mVelocity.mV[VZ];
+        sPartAccX[i] = part->mAccel.mV[VX];
+        sPartAccY[i] = part->mAccel.mV[VY];
+        sPartAccZ[i] = part->mAccel.mV[VZ];
+        sPartDt[i] = dt;
+        sPartFrac[i] = frac;
+    }
+
+    // zero the pad lanes so the integration below is a no-op on them
+    for (S32 i = count; i < padded; i++)
+    {
+        sPartPosX[i] = sPartPosY[i] = sPartPosZ[i] = 0.f;
+        sPartVelX[i] = sPartVelY[i] = sPartVelZ[i] = 0.f;
+        sPartAccX[i] = sPartAccY[i] = sPartAccZ[i] = 0.f;
+        sPartDt[i] = 0.f;
+        sPartFrac[i] = 0.f;
+    }
+
+    // Pass 2: velocity-Verlet integration, four particles at a stride:
+    //   pos += dt*vel + 0.5*dt*dt*accel
+    //   vel += dt*accel
+    for (S32 i = 0; i < padded; i += 4)
+    {
+        LLVector4a t;
+        t.load4a(&sPartDt[i]);
+        LLVector4a half_t2 = t;     // 0.5*dt*dt
+        half_t2.mul(t);
+        half_t2.mul(0.5f);
+
+        F32* pos[] = { &sPartPosX[i], &sPartPosY[i], &sPartPosZ[i] };
+        F32* vel[] = { &sPartVelX[i], &sPartVelY[i], &sPartVelZ[i] };
+        F32* acc[] = { &sPartAccX[i], &sPartAccY[i], &sPartAccZ[i] };
+
+        for (S32 c = 0; c < 3; c++)
+        {
+            LLVector4a p, v, a, tmp;
+            p.load4a(pos[c]);
+            v.load4a(vel[c]);
+            a.load4a(acc[c]);
+
+            tmp = v;
+            tmp.mul(t);
+            p.add(tmp);
+            tmp = a;
+            tmp.mul(half_t2);
+            p.add(tmp);
+            p.store4a(pos[c]);
+
+            tmp = a;
+            tmp.mul(t);
+            v.add(tmp);
+            v.store4a(vel[c]);
+        }
+    }
+
+    // Pass 3: scatter integrated state back, run the remaining per-particle
+    // effects, and compact out dead particles in the same sweep
+    for (S32 i = 0 ; i < (S32)mParticles.size();)
+    {
+        LLViewerPart* part = mParticles[i] ;
+
+        const F32 dt = sPartDt[i];
+        const F32 cur_time = part->mLastUpdateTime + dt;
+        const F32 frac = sPartFrac[i];
+
+        if (!sPartSkipIntegrate[i])
+        {
+            part->mPosAgent.mV[VX] = sPartPosX[i];
+            part->mPosAgent.mV[VY] = sPartPosY[i];
+            part->mPosAgent.mV[VZ] = sPartPosZ[i];
+            part->mVelocity.mV[VX] = sPartVelX[i];
+            part->mVelocity.mV[VY] = sPartVelY[i];
+            part->mVelocity.mV[VZ] = sPartVelZ[i];
         }
 
         // Do a bounce test
@@ -396,9 +507,25 @@ void LLViewerPartGroup::updateParticles(const F32 lastdt)
         part->mLastUpdateTime = cur_time;
 
 
+        // keep the scratch arrays index-aligned with mParticles when the
+        // swap-with-back compaction moves an unprocessed particle down
+        auto compact_scratch = [](S32 dst, S32 src)
+        {
+            sPartPosX[dst] = sPartPosX[src];
+            sPartPosY[dst] = sPartPosY[src];
+            sPartPosZ[dst] = sPartPosZ[src];
+            sPartVelX[dst] = sPartVelX[src];
+            sPartVelY[dst] = sPartVelY[src];
+            sPartVelZ[dst] = sPartVelZ[src];
+            sPartDt[dst] = sPartDt[src];
+            sPartFrac[dst] = sPartFrac[src];
+            sPartSkipIntegrate[dst] = sPartSkipIntegrate[src];
+        };
+
         // Kill dead particles (either flagged dead, or too old)
         if ((part->mLastUpdateTime > part->mMaxAge) || (LLViewerPart::LL_PART_DEAD_MASK == part->mFlags))
         {
+            compact_scratch(i, (S32)mParticles.size() - 1);
             mParticles[i] = mParticles.back() ;
             mParticles.pop_back() ;
             delete part ;
@@ -410,6 +537,7 @@ void LLViewerPartGroup::updateParticles(const F32 lastdt)
             {
                 // Transfer particles between groups
                 LLViewerPartSim::getInstance()->put(part) ;
+                compact_scratch(i, (S32)mParticles.size() - 1);
                 mParticles[i] = mParticles.back() ;
                 mParticles.pop_back() ;
             }
@@ -672,6 +672,13 @@ LLViewerRegion::LLViewerRegion(const U64 &handle,
                     mImpl->mOriginGlobal,
                     mWidth);
 
+    if (gSavedSettings.getBOOL("TerrainPatchDiskCache"))
+    {
+        // Seed the surface from the last visit; incoming LayerData packets
+        // overwrite it patch by patch as they arrive.
+        mImpl->mLandp->loadFromDiskCache(handle);
+    }
+
     mParcelOverlay = new LLViewerParcelOverlay(this, region_width_meters);
 
     setOriginGlobal(from_region_handle(handle));
@@ -742,6 +749,10 @@ LLViewerRegion::~LLViewerRegion()
 
     delete mImpl->mCompositionp;
     delete mParcelOverlay;
+    if (gSavedSettings.getBOOL("TerrainPatchDiskCache"))
+    {
+        mImpl->mLandp->saveToDiskCache(getHandle());
+    }
     delete mImpl->mLandp;
     delete mImpl->mEventPoll;
 #if 0
@@ -1504,6 +1515,16 @@ void LLViewerRegion::createVisibleObjects(F32 max_time)
     }
 
     S32 throttle = sNewObjectCreationThrottle;
+
+    // A static camera means the user is waiting on the scene (typically
+    // right after teleport), not interacting; allow a bigger slice of the
+    // wake-up backlog per frame before the interactive throttle returns.
+    static LLCachedControl<S32> static_camera_boost(gSavedSettings, "NewObjectCreationStaticCameraBoost", 1);
+    if(throttle > 0 && static_camera_boost > 1 && isViewerCameraStatic())
+    {
+        throttle *= (S32)static_camera_boost;
+    }
+
     bool has_new_obj = false;
     LLTimer update_timer;
     for(LLVOCacheEntry::vocache_entry_priority_list_t::iterator iter = mImpl->mWaitingList.begin();
@@ -193,6 +193,7 @@ LLGLSLShader            gDeferredEmissiveProgram;
 LLGLSLShader            gDeferredSkinnedEmissiveProgram;
 LLGLSLShader            gDeferredPostProgram;
 LLGLSLShader            gDeferredCoFProgram;
+LLGLSLShader            gDeferredHiZMaxProgram;
 LLGLSLShader            gDeferredDoFCombineProgram;
 LLGLSLShader            gDeferredPostTonemapProgram;
 LLGLSLShader            gNoPostTonemapProgram;
@@ -539,6 +540,14 @@ void LLViewerShaderMgr::setShaders()
         initShaderCache(shader_cache_enabled, old_cache_version, current_cache_version);
     }
 
+    {
+        // issue every program's link up front and finalize on first use so
+        // the driver's compiler threads can work in parallel instead of the
+        // main thread blocking on each program in turn
+        static LLCachedControl<bool> parallel_compile(gSavedSettings, "RenderParallelShaderCompile", true);
+        LLGLSLShader::sDeferLinkFinalize = parallel_compile && gGLManager.mHasParallelShaderCompile;
+    }
+
     static LLCachedControl<U32> max_texture_index(gSavedSettings, "RenderMaxTextureIndex", 16);
 
     // when using indexed texture rendering, leave some texture units available for shadow and reflection maps
@@ -771,6 +780,11 @@ std::string LLViewerShaderMgr::loadBasicShaders()
     attribs["MAX_JOINTS_PER_MESH_OBJECT"] =
         std::to_string(LLSkinningUtil::getMaxJointCount());
 
+    if (gSavedSettings.getBOOL("RenderAvatarDualQuaternionSkinning"))
+    { // blend rigged meshes with dual quaternions instead of a matrix palette
+        attribs["DUAL_QUATERNION_SKINNING"] = "1";
+    }
+
     bool ssr = gSavedSettings.getBOOL("RenderScreenSpaceReflections");
 
     bool mirrors = gSavedSettings.getBOOL("RenderMirrors");
@@ -1110,6 +1124,7 @@ bool LLViewerShaderMgr::loadShadersDeferred()
         gDeferredAvatarEyesProgram.unload();
         gDeferredPostProgram.unload();
         gDeferredCoFProgram.unload();
+        gDeferredHiZMaxProgram.unload();
         gDeferredDoFCombineProgram.unload();
         gExposureProgram.unload();
         gExposureProgramNoFade.unload();
@@ -2527,6 +2542,17 @@ bool LLViewerShaderMgr::loadShadersDeferred()
         llassert(success);
     }
 
+    if (success)
+    {
+        gDeferredHiZMaxProgram.mName = "Deferred Hi-Z Max Downsample Shader";
+        gDeferredHiZMaxProgram.mShaderFiles.clear();
+        gDeferredHiZMaxProgram.mShaderFiles.push_back(make_pair("deferred/postDeferredNoTCV.glsl", GL_VERTEX_SHADER));
+        gDeferredHiZMaxProgram.mShaderFiles.push_back(make_pair("deferred/hizMaxF.glsl", GL_FRAGMENT_SHADER));
+        gDeferredHiZMaxProgram.mShaderLevel = mShaderLevel[SHADER_DEFERRED];
+        success = gDeferredHiZMaxProgram.createShader();
+        llassert(success);
+    }
+
     if (success)
     {
         gDeferredDoFCombineProgram.mName = "Deferred DoFCombine Shader";
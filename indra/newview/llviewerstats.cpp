@@ -52,6 +52,7 @@
 #include "lldebugview.h"
 #include "llfasttimerview.h"
 #include "llviewerregion.h"
+#include "llvieweroctree.h"
 #include "llvoavatar.h"
 #include "llvoavatarself.h"
 #include "llworld.h"
@@ -193,6 +194,16 @@ LLTrace::SampleStatHandle<> FPS_SAMPLE("fpssample"),
                             WINDOW_WIDTH("windowwidth", "Window width"),
                             WINDOW_HEIGHT("windowheight", "Window height");
 
+LLTrace::SampleStatHandle<> POOL_FACES_LIVE("poolfaceslive", "Faces allocated from the LLFace pool"),
+                            POOL_FACES_RESERVED("poolfacesreserved", "Blocks reserved by the LLFace pool"),
+                            POOL_DRAW_INFO_LIVE("pooldrawinfolive", "Draw calls allocated from the LLDrawInfo pool"),
+                            POOL_DRAW_INFO_RESERVED("pooldrawinforeserved", "Blocks reserved by the LLDrawInfo pool"),
+                            POOL_OCTREE_NODES_LIVE("pooloctreenodeslive", "Scene octree nodes allocated from the node pool"),
+                            POOL_OCTREE_NODES_RESERVED("pooloctreenodesreserved", "Blocks reserved by the scene octree node pool");
+
+LLTrace::SampleStatHandle<> REBUILD_GROUP_QUEUE_DEPTH("rebuildgroupqueuedepth", "Spatial groups awaiting a geometry rebuild"),
+                            REBUILD_GROUP_QUEUE_AGE("rebuildgroupqueueage", "Frames the oldest queued group rebuild has waited");
+
 LLTrace::SampleStatHandle<LLUnit<F32, LLUnits::Percent> >
                             PACKETS_LOST_PERCENT("packetslostpercentstat");
 
@@ -201,6 +212,10 @@ static LLTrace::SampleStatHandle<bool>
 
 LLTrace::SampleStatHandle<F64Megabytes > FORMATTED_MEM("formattedmemstat");
 
+LLTrace::SampleStatHandle<F64Megabytes > GPU_TEXTURE_MEM("gputexturememstat", "GPU memory claimed by texture images"),
+                                         GPU_VERTEX_MEM("gpuvertexmemstat", "GPU memory claimed by vertex/index buffers"),
+                                         GPU_RENDER_TARGET_MEM("gpurendertargetmemstat", "GPU memory claimed by render targets");
+
 SimMeasurement<F64Milliseconds >    SIM_FRAME_TIME("simframemsec", "", LL_SIM_STAT_FRAMEMS),
                                                     SIM_NET_TIME("simnetmsec", "", LL_SIM_STAT_NETMS),
                                                     SIM_OTHER_TIME("simsimothermsec", "", LL_SIM_STAT_SIMOTHERMS),
@@ -345,9 +360,21 @@ void update_statistics()
 
     record(LLStatViewer::TRIANGLES_DRAWN_PER_FRAME, last_frame_recording.getSum(LLStatViewer::TRIANGLES_DRAWN));
 
-    sample(LLStatViewer::ENABLE_VBO,      (F64)gSavedSettings.getBOOL("RenderVBOEnable"));
-    sample(LLStatViewer::DRAW_DISTANCE,   (F64)gSavedSettings.getF32("RenderFarClip"));
-    sample(LLStatViewer::CHAT_BUBBLES,    gSavedSettings.getBOOL("UseChatBubbles"));
+    // these are per-frame samples of effectively static settings; use cached
+    // controls so the capture is a plain read instead of a name lookup
+    static LLCachedControl<bool> vbo_enable(gSavedSettings, "RenderVBOEnable", true);
+    static LLCachedControl<F32> draw_distance(gSavedSettings, "RenderFarClip", 64.f);
+    static LLCachedControl<bool> chat_bubbles(gSavedSettings, "UseChatBubbles", false);
+    sample(LLStatViewer::ENABLE_VBO,      (F64)vbo_enable());
+    sample(LLStatViewer::DRAW_DISTANCE,   (F64)draw_distance());
+    sample(LLStatViewer::CHAT_BUBBLES,    chat_bubbles());
+
+    sample(LLStatViewer::POOL_FACES_LIVE,            LLObjectPool<LLFace>::getLiveCount());
+    sample(LLStatViewer::POOL_FACES_RESERVED,        LLObjectPool<LLFace>::getReservedCount());
+    sample(LLStatViewer::POOL_DRAW_INFO_LIVE,        LLObjectPool<LLDrawInfo>::getLiveCount());
+    sample(LLStatViewer::POOL_DRAW_INFO_RESERVED,    LLObjectPool<LLDrawInfo>::getReservedCount());
+    sample(LLStatViewer::POOL_OCTREE_NODES_LIVE,     LLObjectPool<OctreeNode>::getLiveCount());
+    sample(LLStatViewer::POOL_OCTREE_NODES_RESERVED, LLObjectPool<OctreeNode>::getReservedCount());
 
     typedef LLTrace::StatType<LLTrace::TimeBlockAccumulator>::instance_tracker_t stat_type_t;
 
@@ -404,7 +431,15 @@ void update_statistics()
         }
     }
 
-    if (LLFloaterReg::instanceVisible("scene_load_stats"))
+    // check the timer before the floater registry lookup; the lookup itself
+    // is per-frame work and this block only fires once a second anyway
+    static LLFrameTimer perf_stats_gate;
+    bool check_perf_floater = perf_stats_gate.getElapsedTimeF32() >= 1.f;
+    if (check_perf_floater)
+    {
+        perf_stats_gate.reset();
+    }
+    if (check_perf_floater && LLFloaterReg::instanceVisible("scene_load_stats"))
     {
         static const F32 perf_stats_freq = 1;
         static LLFrameTimer perf_stats_timer;
@@ -778,7 +813,10 @@ void send_viewer_stats(bool include_preferences)
     body["MinimalSkin"] = false;
 
 
-    LL_INFOS("LogViewerStatsPacket") << "Sending viewer statistics: " << body << LL_ENDL;
+    // Stringizing the full stats body is expensive enough to show up in
+    // profiles, so only do it when the debug tag is enabled, matching the
+    // packet dump below.
+    LL_DEBUGS("LogViewerStatsPacket") << "Sending viewer statistics: " << body << LL_ENDL;
 
     // <ND> Do those lines even do anything sane in regard of debug logging?
     LL_DEBUGS("LogViewerStatsPacket");
@@ -185,10 +185,27 @@ extern LLTrace::SampleStatHandle<>      FPS_SAMPLE,
                                         WINDOW_WIDTH,
                                         WINDOW_HEIGHT;
 
+// object pool occupancy (see LLObjectPool)
+extern LLTrace::SampleStatHandle<>      POOL_FACES_LIVE,
+                                        POOL_FACES_RESERVED,
+                                        POOL_DRAW_INFO_LIVE,
+                                        POOL_DRAW_INFO_RESERVED,
+                                        POOL_OCTREE_NODES_LIVE,
+                                        POOL_OCTREE_NODES_RESERVED;
+
+// priority geometry rebuild queue (see LLPipeline::rebuildPriorityGroups)
+extern LLTrace::SampleStatHandle<>      REBUILD_GROUP_QUEUE_DEPTH,
+                                        REBUILD_GROUP_QUEUE_AGE;
+
 extern LLTrace::SampleStatHandle<LLUnit<F32, LLUnits::Percent> > PACKETS_LOST_PERCENT;
 
 extern LLTrace::SampleStatHandle<F64Megabytes > FORMATTED_MEM;
 
+// GPU memory ledger totals (see LLGPUMemoryLedger)
+extern LLTrace::SampleStatHandle<F64Megabytes > GPU_TEXTURE_MEM,
+                                                GPU_VERTEX_MEM,
+                                                GPU_RENDER_TARGET_MEM;
+
 extern SimMeasurement<F64Milliseconds > SIM_FRAME_TIME,
                                                             SIM_NET_TIME,
                                                             SIM_OTHER_TIME,
@@ -45,10 +45,12 @@
 #include "v4coloru.h"
 
 // viewer includes
+#include "llgpumemoryledger.h"
 #include "llimagegl.h"
 #include "lldrawpool.h"
 #include "lltexturefetch.h"
 #include "llviewertexturelist.h"
+#include "llviewerstats.h"
 #include "llviewercontrol.h"
 #include "pipeline.h"
 #include "llappviewer.h"
@@ -60,6 +62,7 @@
 #include "llvovolume.h"
 #include "llviewermedia.h"
 #include "lltexturecache.h"
+#include "lltexturetranscodecache.h"
 #include "llviewerwindow.h"
 #include "llwindow.h"
 ///////////////////////////////////////////////////////////////////////////////
@@ -480,6 +483,20 @@ void LLViewerTexture::initClass()
     LLImageGL::sDefaultGLTexture = LLViewerFetchedTexture::sDefaultImagep->getGLTexture();
 }
 
+// eviction hook for the GPU memory ledger: lean on the texture discard bias
+// when the configured budget is exceeded -- textures are the only category
+// the viewer can shrink incrementally at runtime, so other categories get a
+// smaller nudge
+static void gpu_ledger_over_budget(LLGPUMemoryLedger::ECategory category, U64 used_bytes, U64 budget_bytes)
+{
+    LL_DEBUGS("GPUMemoryLedger") << "over budget: " << used_bytes / (1024 * 1024) << "MB of "
+        << budget_bytes / (1024 * 1024) << "MB, largest category is "
+        << LLGPUMemoryLedger::getCategoryName(category) << LL_ENDL;
+
+    F32 step = (category == LLGPUMemoryLedger::CAT_TEXTURE) ? 0.2f : 0.1f;
+    LLViewerTexture::sDesiredDiscardBias = llmin(LLViewerTexture::sDesiredDiscardBias + step, 4.f);
+}
+
 //static
 void LLViewerTexture::updateClass()
 {
@@ -494,6 +511,19 @@ void LLViewerTexture::updateClass()
 
     LLViewerMediaTexture::updateClass();
 
+    // publish the GPU memory ledger totals and check the optional eviction
+    // budget (RenderGPUMemoryLedgerBudgetMB, 0 disables it)
+    {
+        using namespace LLStatViewer;
+        sample(GPU_TEXTURE_MEM, F64Bytes(LLGPUMemoryLedger::getBytes(LLGPUMemoryLedger::CAT_TEXTURE)));
+        sample(GPU_VERTEX_MEM, F64Bytes(LLGPUMemoryLedger::getBytes(LLGPUMemoryLedger::CAT_VERTEX_BUFFER)));
+        sample(GPU_RENDER_TARGET_MEM, F64Bytes(LLGPUMemoryLedger::getBytes(LLGPUMemoryLedger::CAT_RENDER_TARGET)));
+
+        static LLCachedControl<U32> ledger_budget_mb(gSavedSettings, "RenderGPUMemoryLedgerBudgetMB", 0);
+        LLGPUMemoryLedger::setBudget((U64)ledger_budget_mb * 1024 * 1024, gpu_ledger_over_budget);
+        LLGPUMemoryLedger::checkBudget();
+    }
+
     static LLCachedControl<U32> max_vram_budget(gSavedSettings, "RenderMaxVRAMBudget", 0);
 
     F64 texture_bytes_alloc = LLImageGL::getTextureBytesAllocated() / 1024.0 / 512.0;
@@ -663,6 +693,7 @@ LLViewerTexture::~LLViewerTexture()
 void LLViewerTexture::init(bool firstinit)
 {
     mMaxVirtualSize = 0.f;
+    mScreenCoverage = 0.f;
     mMaxVirtualSizeResetInterval = 1;
     mMaxVirtualSizeResetCounter = mMaxVirtualSizeResetInterval;
     mParcelMedia = NULL;
@@ -813,6 +844,21 @@ void LLViewerTexture::addTextureStats(F32 virtual_size, bool needs_gltexture) co
     }
 }
 
+void LLViewerTexture::setScreenCoverage(F32 pixels) const
+{
+    // hysteresis: jump up immediately so newly visible surfaces sharpen
+    // quickly, but ignore small dips and decay slowly so the fetch queue
+    // doesn't reshuffle every time the camera wiggles
+    if (pixels > mScreenCoverage)
+    {
+        mScreenCoverage = pixels;
+    }
+    else if (pixels < mScreenCoverage * 0.75f)
+    {
+        mScreenCoverage = lerp(mScreenCoverage, pixels, 0.1f);
+    }
+}
+
 void LLViewerTexture::resetTextureStats()
 {
     mMaxVirtualSize = 0.0f;
@@ -845,6 +891,10 @@ void LLViewerTexture::addFace(U32 ch, LLFace* facep)
     facep->setIndexInTex(ch, mNumFaces[ch]);
     mNumFaces[ch]++;
     mLastFaceListUpdateTimer.reset();
+
+    // the face list feeds the decode priority; get an update queued rather
+    // than waiting for the round-robin scan to come back around
+    gTextureList.dirtyImagePriority(LLViewerTextureManager::staticCastToFetchedTexture(this));
 }
 
 //virtual
@@ -867,6 +917,8 @@ void LLViewerTexture::removeFace(U32 ch, LLFace* facep)
         mNumFaces[ch] = 0;
     }
     mLastFaceListUpdateTimer.reset();
+
+    gTextureList.dirtyImagePriority(LLViewerTextureManager::staticCastToFetchedTexture(this));
 }
 
 S32 LLViewerTexture::getTotalNumFaces() const
@@ -1103,6 +1155,7 @@ void LLViewerFetchedTexture::init(bool firstinit)
 
     mHasFetcher = false;
     mIsFetching = false;
+    mCheckedTranscodeCache = false;
     mFetchState = 0;
     mFetchPriority = 0;
     mDownloadProgress = 0.f;
@@ -1519,6 +1572,13 @@ void LLViewerFetchedTexture::postCreateTexture()
         }
     }
 
+    if (LLTextureTranscodeCache::enabled() &&
+        mFTType == FTT_DEFAULT && mUrl.empty() && mIsFetched &&
+        !mForSculpt && !needsAux())
+    { // keep a GPU-ready copy of the compressed mip chain for next session
+        LLTextureTranscodeCache::store(mID, mGLTexturep);
+    }
+
     if (!needsToSaveRawImage())
     {
         mNeedsAux = false;
@@ -1528,6 +1588,24 @@ void LLViewerFetchedTexture::postCreateTexture()
     mNeedsCreateTexture = false;
 }
 
+void LLViewerFetchedTexture::saveToTranscodeCache()
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
+    if (LLTextureTranscodeCache::enabled() &&
+        mFTType == FTT_DEFAULT && mUrl.empty() && mIsFetched &&
+        !mForSculpt && !needsAux() &&
+        mGLTexturep.notNull() && mGLTexturep->getHasGLTexture())
+    {
+        // store() is a no-op when an equal or better blob already exists
+        LLTextureTranscodeCache::store(mID, mGLTexturep);
+
+        // let the next fetch pass consult the cache again so a camera swing
+        // restores the dropped mips from the blob instead of refetching and
+        // redecoding
+        mCheckedTranscodeCache = false;
+    }
+}
+
 void LLViewerFetchedTexture::scheduleCreateTexture()
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
@@ -1763,12 +1841,29 @@ bool LLViewerFetchedTexture::isActiveFetching()
 
 void LLViewerFetchedTexture::setBoostLevel(S32 level)
 {
+    bool changed = (level != mBoostLevel);
     LLViewerTexture::setBoostLevel(level);
 
     if (level >= LLViewerTexture::BOOST_HIGH)
     {
         mDesiredDiscardLevel = 0;
     }
+
+    if (changed)
+    { // boost changes reorder the fetch queue; queue a priority update
+        gTextureList.dirtyImagePriority(this);
+    }
+}
+
+F32 LLViewerFetchedTexture::getFetchDecodePriority() const
+{
+    static LLCachedControl<bool> coverage_priority(gSavedSettings, "TextureFetchCoveragePriority", false);
+    if (coverage_priority && mBoostLevel < LLGLTexture::BOOST_HIGH)
+    { // rank by projected on-screen coverage; keep a sliver of the virtual
+      // size so offscreen textures still trickle in behind visible ones
+        return llmax(mScreenCoverage, mMaxVirtualSize * 0.01f);
+    }
+    return mMaxVirtualSize;
 }
 
 bool LLViewerFetchedTexture::updateFetch()
@@ -1824,7 +1919,7 @@ bool LLViewerFetchedTexture::updateFetch()
 
     S32 current_discard = getCurrentDiscardLevelForFetching();
     S32 desired_discard = getDesiredDiscardLevel();
-    F32 decode_priority = mMaxVirtualSize;
+    F32 decode_priority = getFetchDecodePriority();
 
     if (mIsFetching)
     {
@@ -1971,8 +2066,12 @@ bool LLViewerFetchedTexture::updateFetch()
         }
         else
         {
-            static const F32 MAX_HOLD_TIME = 5.0f; //seconds to wait before canceling fecthing if decode_priority is 0.f.
-            if(decode_priority > 0.0f || mStopFetchingTimer.getElapsedTimeF32() > MAX_HOLD_TIME)
+            // seconds to wait before canceling fetching if decode_priority is 0.f.
+            // past the hold the worker sheds the request, including aborting an
+            // in-flight HTTP transfer, so a camera turn frees the fetch pipeline
+            // for newly visible work instead of finishing stale downloads
+            static LLCachedControl<F32> max_hold_time(gSavedSettings, "TextureFetchPriorityHoldTime", 1.f);
+            if(decode_priority > 0.0f || mStopFetchingTimer.getElapsedTimeF32() > max_hold_time)
             {
                 mStopFetchingTimer.reset();
                 LLAppViewer::getTextureFetch()->updateRequestPriority(mID, decode_priority);
@@ -2043,6 +2142,33 @@ bool LLViewerFetchedTexture::updateFetch()
             desired_discard = override_tex_discard_level;
         }
 
+        // consult the transcode cache before scheduling a fetch and decode
+        if (!mCheckedTranscodeCache && LLTextureTranscodeCache::enabled() &&
+            mFTType == FTT_DEFAULT && mUrl.empty() &&
+            !mForSculpt && !needsAux() && !needsToSaveRawImage())
+        {
+            mCheckedTranscodeCache = true;
+            S32 blob_discard = LLTextureTranscodeCache::getCachedDiscard(mID);
+            if (blob_discard >= 0 && blob_discard <= desired_discard &&
+                (current_discard < 0 || blob_discard < current_discard))
+            {
+                S32 full_w = 0;
+                S32 full_h = 0;
+                S32 comps = 0;
+                if (LLTextureTranscodeCache::fetch(mID, mGLTexturep, full_w, full_h, comps))
+                {
+                    mFullWidth = full_w;
+                    mFullHeight = full_h;
+                    mComponents = (S8)comps;
+                    mOrigWidth = full_w;
+                    mOrigHeight = full_h;
+                    setTexelsPerImage();
+                    setActive();
+                    return mIsFetching;
+                }
+            }
+        }
+
         // bypass texturefetch directly by pulling from LLTextureCache
         S32 fetch_request_discard = -1;
         fetch_request_discard = LLAppViewer::getTextureFetch()->createRequest(mFTType, mUrl, getID(), getTargetHost(), decode_priority,
@@ -140,6 +140,8 @@ public:
 
     void addTextureStats(F32 virtual_size, bool needs_gltexture = true) const;
     void resetTextureStats();
+    void setScreenCoverage(F32 pixels) const;
+    F32 getScreenCoverage() const { return mScreenCoverage; }
     void setMaxVirtualSizeResetInterval(S32 interval)const {mMaxVirtualSizeResetInterval = interval;}
     void resetMaxVirtualSizeResetCounter()const {mMaxVirtualSizeResetCounter = mMaxVirtualSizeResetInterval;}
     S32 getMaxVirtualSizeResetCounter() const { return mMaxVirtualSizeResetCounter; }
@@ -195,6 +197,7 @@ protected:
     S32 mTextureListType; // along with mID identifies where to search for this texture in TextureList
 
     mutable F32 mMaxVirtualSize = 0.f;  // The largest virtual size of the image, in pixels - how much data to we need?
+    mutable F32 mScreenCoverage = 0.f;  // Smoothed projected pixel coverage summed over in-frustum faces
     mutable S32  mMaxVirtualSizeResetCounter;
     mutable S32  mMaxVirtualSizeResetInterval;
     LLFrameTimer mLastReferencedTimer;
@@ -324,6 +327,11 @@ public:
 
     void destroyTexture() ;
 
+    // store the current mip chain to the transcode cache (if eligible) so a
+    // later discard decrease restores it without a J2C redecode; called just
+    // before scaleDown() drops the high mips.  Needs a current GL context.
+    void saveToTranscodeCache();
+
     virtual void processTextureStats() ;
 
     bool needsAux() const { return mNeedsAux; }
@@ -340,6 +348,10 @@ public:
     void setBoostLevel(S32 level) override;
     bool updateFetch();
 
+    // priority handed to the fetcher; screen coverage when the
+    // coverage-driven scheduler is enabled, else max virtual size
+    F32 getFetchDecodePriority() const;
+
     void clearFetchedResults(); //clear all fetched results, for debug use.
 
     // Override the computation of discard levels if we know the exact output
@@ -412,6 +424,7 @@ public:
 
     bool mCreatePending = false;    // if true, this is in gTextureList.mCreateTextureList
     mutable bool mDownScalePending = false; // if true, this is in gTextureList.mDownScaleQueue
+    bool mPriorityDirty = false;    // if true, this is in gTextureList.mDirtyPriorityList
 
 protected:
     S32 getCurrentDiscardLevelForFetching() ;
@@ -457,6 +470,7 @@ protected:
     bool mIsRawImageValid;
     bool mHasFetcher;               // We've made a fecth request
     bool mIsFetching;               // Fetch request is active
+    bool mCheckedTranscodeCache;    // Looked for a GPU-ready blob in the transcode cache
     bool mCanUseHTTP;              //This texture can be fetched through http if true.
     LLCore::HttpStatus mLastHttpGetStatus; // Result of the most recently completed http request for this texture.
 
@@ -54,6 +54,7 @@
 #include "llviewernetwork.h"
 #include "llviewerregion.h"
 #include "llviewerstats.h"
+#include "llperfstats.h"
 #include "pipeline.h"
 #include "llappviewer.h"
 #include "llxuiparser.h"
@@ -241,40 +242,40 @@ void LLViewerTextureList::doPrefetchImages()
     }
 
     // Pre-fetch textures from last logout
-    LLSD imagelist;
     std::string filename = get_texture_list_name();
     llifstream file;
     file.open(filename.c_str());
+    S32 texture_count = 0;
     if (file.is_open())
     {
-        if ( ! LLSDSerialize::fromXML(imagelist, file) )
+        // stream the entries straight out of the parser instead of building
+        // the whole list as an LLSD tree first -- the list can be thousands
+        // of entries at login
+        S32 parse_count = LLSDSerialize::fromXMLStreaming(file,
+            [&texture_count](const std::string&, const LLSD& imagesd)
+            {
+                LLUUID uuid = imagesd["uuid"];
+                S32 pixel_area = imagesd["area"];
+                S32 texture_type = imagesd["type"];
+
+                if(LLViewerTexture::FETCHED_TEXTURE == texture_type || LLViewerTexture::LOD_TEXTURE == texture_type)
+                {
+                    LLViewerFetchedTexture* image = LLViewerTextureManager::getFetchedTexture(uuid, FTT_DEFAULT, MIPMAP_TRUE, LLGLTexture::BOOST_NONE, texture_type);
+                    if (image)
+                    {
+                        texture_count += 1;
+                        image->addTextureStats((F32)pixel_area);
+                    }
+                }
+            });
+        file.close();
+        if (parse_count == LLSDParser::PARSE_FAILURE)
         {
-            file.close();
             LL_WARNS() << "XML parse error reading texture list '" << filename << "'" << LL_ENDL;
             LL_WARNS() << "Removing invalid texture list '" << filename << "'" << LL_ENDL;
             LLFile::remove(filename);
             return;
         }
-        file.close();
-    }
-    S32 texture_count = 0;
-    for (LLSD::array_iterator iter = imagelist.beginArray();
-         iter != imagelist.endArray(); ++iter)
-    {
-        LLSD imagesd = *iter;
-        LLUUID uuid = imagesd["uuid"];
-        S32 pixel_area = imagesd["area"];
-        S32 texture_type = imagesd["type"];
-
-        if(LLViewerTexture::FETCHED_TEXTURE == texture_type || LLViewerTexture::LOD_TEXTURE == texture_type)
-        {
-            LLViewerFetchedTexture* image = LLViewerTextureManager::getFetchedTexture(uuid, FTT_DEFAULT, MIPMAP_TRUE, LLGLTexture::BOOST_NONE, texture_type);
-            if (image)
-            {
-                texture_count += 1;
-                image->addTextureStats((F32)pixel_area);
-            }
-        }
     }
     LL_DEBUGS() << "fetched " << texture_count << " images from " << filename << LL_ENDL;
 }
@@ -357,6 +358,12 @@ void LLViewerTextureList::shutdown()
     }
     mFastCacheList.clear();
 
+    for (auto& imagep : mDirtyPriorityList)
+    {
+        imagep->mPriorityDirty = false;
+    }
+    mDirtyPriorityList.clear();
+
     mUUIDMap.clear();
 
     mImageList.clear();
@@ -863,6 +870,10 @@ void LLViewerTextureList::updateImages(F32 max_time)
     }
 
     updateImagesUpdateStats();
+
+    // tell the frame-budget governor how much work this frame's slice left behind
+    LLPerfStats::FrameBudget::reportBacklog(LLPerfStats::FrameBudget::Subsystem::TEXTURES,
+        (S32)(mCreateTextureList.size() + mDownScaleQueue.size() + mFastCacheList.size()));
 }
 
 void LLViewerTextureList::clearFetchingRequests()
@@ -896,6 +907,7 @@ void LLViewerTextureList::updateImageDecodePriority(LLViewerFetchedTexture* imag
         static LLCachedControl<F32> texture_scale_max(gSavedSettings, "TextureScaleMaxAreaFactor", 25.f);
 
         F32 max_vsize = 0.f;
+        F32 total_coverage = 0.f;
         bool on_screen = false;
 
         U32 face_count = 0;
@@ -928,6 +940,12 @@ void LLViewerTextureList::updateImageDecodePriority(LLViewerFetchedTexture* imag
 
                     on_screen = face->mInFrustum;
 
+                    if (face->mInFrustum)
+                    { // unscaled coverage summed over every visible face for
+                      // the coverage-driven fetch scheduler
+                        total_coverage += face->getPixelArea();
+                    }
+
                     // Scale desired texture resolution higher or lower depending on texture scale
                     //
                     // Minimum usage examples: a 1024x1024 texture with aplhabet, runing string
@@ -972,6 +990,7 @@ void LLViewerTextureList::updateImageDecodePriority(LLViewerFetchedTexture* imag
         }
 
         imagep->addTextureStats(max_vsize);
+        imagep->setScreenCoverage(llmin(total_coverage, LLViewerFetchedTexture::sMaxVirtualSize));
     }
 
 #if 0
@@ -1040,6 +1059,15 @@ void LLViewerTextureList::updateImageDecodePriority(LLViewerFetchedTexture* imag
     imagep->processTextureStats();
 }
 
+void LLViewerTextureList::dirtyImagePriority(LLViewerFetchedTexture* imagep)
+{
+    if (imagep && !imagep->mPriorityDirty)
+    {
+        imagep->mPriorityDirty = true;
+        mDirtyPriorityList.push_back(imagep);
+    }
+}
+
 F32 LLViewerTextureList::updateImagesCreateTextures(F32 max_time)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
@@ -1075,6 +1103,9 @@ F32 LLViewerTextureList::updateImagesCreateTextures(F32 max_time)
             LLImageGL* img = image->getGLTexture();
             if (img && img->getHasGLTexture())
             {
+                // stash the mips we're about to drop so a later camera swing
+                // restores them from the transcode cache instead of redecoding
+                image->saveToTranscodeCache();
                 img->scaleDown(image->getDesiredDiscardLevel());
             }
 
@@ -1171,11 +1202,36 @@ F32 LLViewerTextureList::updateImagesFetchTextures(F32 max_time)
     update_count = llmax((U32) MIN_UPDATE_COUNT, (U32) mUUIDMap.size()/20);
     update_count = llmin(update_count, (U32) mUUIDMap.size());
 
+    { // service textures whose priority inputs changed first; anything the
+      // dirty budget doesn't reach stays queued for next frame
+        LL_PROFILE_ZONE_NAMED_CATEGORY_TEXTURE("vtluift - dirty");
+
+        U32 dirty_count = llmin((U32) mDirtyPriorityList.size(), update_count);
+        entries.reserve(dirty_count);
+        while (dirty_count-- > 0)
+        {
+            LLPointer<LLViewerFetchedTexture> imagep = mDirtyPriorityList.back();
+            mDirtyPriorityList.pop_back();
+            imagep->mPriorityDirty = false;
+            if (imagep->getGLTexture())
+            {
+                entries.push_back(imagep);
+            }
+        }
+
+        // the round-robin scan continues below regardless -- it also drives
+        // texture lifecycle (lazy flush, saved raw purge) that dirty events
+        // alone won't trigger
+        update_count -= (U32) entries.size();
+    }
+
+    size_t dirty_entries = entries.size();
+
     { // copy entries out of UUID map to avoid iterator invalidation from deletion inside updateImageDecodeProiroty or updateFetch below
         LL_PROFILE_ZONE_NAMED_CATEGORY_TEXTURE("vtluift - copy");
 
         // copy entries out of UUID map for updating
-        entries.reserve(update_count);
+        entries.reserve(entries.size() + update_count);
         uuid_map_t::iterator iter = mUUIDMap.upper_bound(mLastUpdateKey);
         while (update_count-- > 0)
         {
@@ -1194,9 +1250,13 @@ F32 LLViewerTextureList::updateImagesFetchTextures(F32 max_time)
 
     LLTimer timer;
 
+    size_t entry_index = 0;
     for (auto& imagep : entries)
     {
-        mLastUpdateKey = LLTextureKey(imagep->getID(), (ETexListType)imagep->getTextureListType());
+        if (entry_index++ >= dirty_entries)
+        { // only the round-robin portion advances the resume key
+            mLastUpdateKey = LLTextureKey(imagep->getID(), (ETexListType)imagep->getTextureListType());
+        }
 
         if (imagep->getNumRefs() > 1) // make sure this image hasn't been deleted before attempting to update (may happen as a side effect of some other image updating)
         {
@@ -1503,6 +1563,7 @@ void LLUIImageList::cleanUp()
 {
     mUIImages.clear();
     mUITextureList.clear() ;
+    mUIAtlasPages.clear();
 }
 
 LLUIImagePtr LLUIImageList::getUIImageByID(const LLUUID& image_id, S32 priority)
@@ -1723,6 +1784,81 @@ struct UIImageDeclarations : public LLInitParam::Block<UIImageDeclarations>
     {}
 };
 
+//-----------------------------------------------------------------------------
+// UI icon atlas
+//
+// Small skin icons get packed into shared atlas pages at startup. Each
+// atlased LLUIImage points at a page texture with its clip region set to the
+// packed cell, so consecutive icon draws re-bind the same texture and the 2D
+// batcher folds them into one draw instead of one per icon.
+//-----------------------------------------------------------------------------
+
+static const S32 UI_ATLAS_PAGE_SIZE = 1024;
+static const S32 UI_ATLAS_MAX_ICON_DIM = 128;   // larger images keep their own texture
+static const S32 UI_ATLAS_GUTTER = 1;           // duplicated edge texels against filter bleed
+
+struct UIAtlasPlacement
+{
+    std::string mName;
+    LLPointer<LLImageRaw> mRaw;
+    const UIImageDeclaration* mDecl;
+    S32 mPage;
+    S32 mX;
+    S32 mY;
+};
+
+// decode a skin texture synchronously; returns null when the file is
+// missing or not usable as an atlas cell
+static LLPointer<LLImageRaw> load_ui_image_raw(const std::string& file_name)
+{
+    std::string full_path = gDirUtilp->findSkinnedFilename("textures", file_name);
+    if (full_path.empty())
+    {
+        return NULL;
+    }
+    LLPointer<LLImageFormatted> formatted = LLImageFormatted::createFromExtension(gDirUtilp->getExtension(full_path));
+    if (formatted.isNull() || !formatted->load(full_path))
+    {
+        return NULL;
+    }
+    LLPointer<LLImageRaw> raw = new LLImageRaw;
+    if (!formatted->decode(raw, 0.f))
+    {
+        return NULL;
+    }
+    if (raw->getComponents() != 3 && raw->getComponents() != 4)
+    {
+        return NULL;
+    }
+    return raw;
+}
+
+// blit an icon into an RGBA page, duplicating a one-texel border so CLAMP
+// plus linear filtering can't pull in a neighboring cell
+static void blit_into_atlas_page(LLImageRaw* page, const LLImageRaw* icon, S32 dst_x, S32 dst_y)
+{
+    const S32 w = icon->getWidth();
+    const S32 h = icon->getHeight();
+    const S32 comps = icon->getComponents();
+    const U8* src = icon->getData();
+    U8* dst = page->getData();
+    const S32 page_w = page->getWidth();
+    for (S32 y = -UI_ATLAS_GUTTER; y < h + UI_ATLAS_GUTTER; ++y)
+    {
+        S32 sy = llclamp(y, 0, h - 1);
+        for (S32 x = -UI_ATLAS_GUTTER; x < w + UI_ATLAS_GUTTER; ++x)
+        {
+            S32 sx = llclamp(x, 0, w - 1);
+            const U8* s = src + (sy * w + sx) * comps;
+            U8* d = dst + ((dst_y + y) * page_w + (dst_x + x)) * 4;
+            d[0] = s[0];
+            d[1] = s[1];
+            d[2] = s[2];
+            d[3] = (comps == 4) ? s[3] : 255;
+        }
+    }
+}
+
 bool LLUIImageList::initFromFile()
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_TEXTURE;
@@ -1775,6 +1911,126 @@ bool LLUIImageList::initFromFile()
         merged_declarations[image_it->name].overwriteFrom(*image_it);
     }
 
+    if (gSavedSettings.getBOOL("UIImageAtlas"))
+    {
+        LL_PROFILE_ZONE_NAMED("ui image atlas");
+
+        // gather and decode the icons that can live in a shared page
+        std::vector<UIAtlasPlacement> placements;
+        for (std::map<std::string, UIImageDeclaration>::const_iterator image_it = merged_declarations.begin();
+            image_it != merged_declarations.end();
+            ++image_it)
+        {
+            const UIImageDeclaration& image = image_it->second;
+            if (image.clip.isProvided() || image.use_mips)
+            {
+                // clipped declarations share files and mipped images need
+                // their own chain; both keep the regular path
+                continue;
+            }
+            std::string file_name = image.file_name.isProvided() ? image.file_name() : image.name();
+            LLPointer<LLImageRaw> raw = load_ui_image_raw(file_name);
+            if (raw.isNull()
+                || raw->getWidth() > UI_ATLAS_MAX_ICON_DIM
+                || raw->getHeight() > UI_ATLAS_MAX_ICON_DIM)
+            {
+                continue;
+            }
+            UIAtlasPlacement placement;
+            placement.mName = image_it->first;
+            placement.mRaw = raw;
+            placement.mDecl = &image;
+            placement.mPage = -1;
+            placement.mX = 0;
+            placement.mY = 0;
+            placements.push_back(placement);
+        }
+
+        // shelf-pack, tallest first, to keep the rows dense
+        std::sort(placements.begin(), placements.end(),
+            [](const UIAtlasPlacement& a, const UIAtlasPlacement& b)
+            {
+                return a.mRaw->getHeight() > b.mRaw->getHeight();
+            });
+
+        S32 num_pages = 0;
+        S32 cur_x = 0;
+        S32 cur_y = 0;
+        S32 shelf_height = 0;
+        for (UIAtlasPlacement& placement : placements)
+        {
+            S32 w = placement.mRaw->getWidth() + 2 * UI_ATLAS_GUTTER;
+            S32 h = placement.mRaw->getHeight() + 2 * UI_ATLAS_GUTTER;
+            if (num_pages == 0 || (cur_x + w > UI_ATLAS_PAGE_SIZE && cur_y + shelf_height + h > UI_ATLAS_PAGE_SIZE))
+            {
+                // new page
+                ++num_pages;
+                cur_x = 0;
+                cur_y = 0;
+                shelf_height = h;
+            }
+            else if (cur_x + w > UI_ATLAS_PAGE_SIZE)
+            {
+                // new shelf
+                cur_x = 0;
+                cur_y += shelf_height;
+                shelf_height = h;
+            }
+            placement.mPage = num_pages - 1;
+            placement.mX = cur_x + UI_ATLAS_GUTTER;
+            placement.mY = cur_y + UI_ATLAS_GUTTER;
+            cur_x += w;
+        }
+
+        // fill the pages and register the images; names registered here are
+        // skipped by the per-file load below
+        std::vector<LLPointer<LLImageRaw> > page_raws;
+        for (S32 i = 0; i < num_pages; ++i)
+        {
+            LLPointer<LLImageRaw> page_raw = new LLImageRaw(UI_ATLAS_PAGE_SIZE, UI_ATLAS_PAGE_SIZE, 4);
+            memset(page_raw->getData(), 0, UI_ATLAS_PAGE_SIZE * UI_ATLAS_PAGE_SIZE * 4);
+            page_raws.push_back(page_raw);
+        }
+        for (const UIAtlasPlacement& placement : placements)
+        {
+            blit_into_atlas_page(page_raws[placement.mPage], placement.mRaw, placement.mX, placement.mY);
+        }
+        for (S32 i = 0; i < num_pages; ++i)
+        {
+            LLPointer<LLViewerTexture> page_tex = LLViewerTextureManager::getLocalTexture(page_raws[i].get(), false);
+            page_tex->setAddressMode(LLTexUnit::TAM_CLAMP);
+            page_tex->getGLTexture()->setAllowCompression(false);
+            page_tex->setNoDelete();
+            mUIAtlasPages.push_back(page_tex);
+        }
+        const F32 inv_page = 1.f / (F32)UI_ATLAS_PAGE_SIZE;
+        for (const UIAtlasPlacement& placement : placements)
+        {
+            S32 w = placement.mRaw->getWidth();
+            S32 h = placement.mRaw->getHeight();
+            LLUIImagePtr new_imagep = new LLUIImage(placement.mName, mUIAtlasPages[placement.mPage]);
+            // raw rows run bottom-up, so the cell's bottom edge is mY
+            new_imagep->setClipRegion(LLRectf((F32)placement.mX * inv_page,
+                                              (F32)(placement.mY + h) * inv_page,
+                                              (F32)(placement.mX + w) * inv_page,
+                                              (F32)placement.mY * inv_page));
+            const LLRect& scale_rect = placement.mDecl->scale;
+            if (scale_rect != LLRect::null)
+            {
+                // same normalization as onUIImageLoaded: relative to the
+                // clipped image dimensions
+                new_imagep->setScaleRegion(LLRectf(llclamp((F32)scale_rect.mLeft / (F32)w, 0.f, 1.f),
+                                                   llclamp((F32)scale_rect.mTop / (F32)h, 0.f, 1.f),
+                                                   llclamp((F32)scale_rect.mRight / (F32)w, 0.f, 1.f),
+                                                   llclamp((F32)scale_rect.mBottom / (F32)h, 0.f, 1.f)));
+            }
+            new_imagep->setScaleStyle(placement.mDecl->scale_type);
+            mUIImages.insert(std::make_pair(placement.mName, new_imagep));
+        }
+        LL_INFOS() << "Packed " << placements.size() << " UI images into "
+                   << num_pages << " atlas pages" << LL_ENDL;
+    }
+
     enum e_decode_pass
     {
         PASS_DECODE_NOW,
@@ -1789,6 +2045,11 @@ bool LLUIImageList::initFromFile()
             ++image_it)
         {
             const UIImageDeclaration& image = image_it->second;
+            if (mUIImages.find(image.name()) != mUIImages.end())
+            {
+                // already packed into the ui image atlas
+                continue;
+            }
             std::string file_name = image.file_name.isProvided() ? image.file_name() : image.name();
 
             // load high priority textures on first pass (to kick off decode)
@@ -147,6 +147,11 @@ public:
     // - cleans up textures that haven't been referenced in awhile
     void updateImageDecodePriority(LLViewerFetchedTexture* imagep, bool flush_images = true);
 
+    // queue the texture for a decode priority update ahead of the
+    // round-robin scan; called when its priority inputs change (faces
+    // added or removed, boost level change, large virtual size jump)
+    void dirtyImagePriority(LLViewerFetchedTexture* imagep);
+
 private:
     F32  updateImagesCreateTextures(F32 max_time);
     F32  updateImagesFetchTextures(F32 max_time);
@@ -231,6 +236,10 @@ private:
     uuid_map_t mUUIDMap;
     LLTextureKey mLastUpdateKey;
 
+    // textures whose priority inputs changed since their last update; these
+    // jump the mUUIDMap round-robin in updateImagesFetchTextures
+    std::vector<LLPointer<LLViewerFetchedTexture> > mDirtyPriorityList;
+
     image_list_t mImageList;
 
     // simply holds on to LLViewerFetchedTexture references to stop them from being purged too soon
@@ -288,6 +297,10 @@ private:
     //keep a copy of UI textures to prevent them to be deleted.
     //mGLTexturep of each UI texture equals to some LLUIImage.mImage.
     std::list< LLPointer<LLViewerFetchedTexture> > mUITextureList ;
+
+    // shared pages holding the small skin icons packed at startup; the
+    // atlased LLUIImages point into these through their clip regions
+    std::vector< LLPointer<LLViewerTexture> > mUIAtlasPages;
 };
 
 const bool GLTEXTURE_TRUE = true;
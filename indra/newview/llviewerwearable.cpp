@@ -135,6 +135,113 @@ LLWearable::EImportResult LLViewerWearable::importStream( std::istream& input_st
     return result;
 }
 
+// Schema version of the cached parsed-wearable record; bump when the
+// record layout changes so stale records fall back to the text parse.
+static const S32 WEARABLE_RECORD_VERSION = 1;
+
+LLSD LLViewerWearable::asLLSDRecord() const
+{
+    LLSD record;
+    record["record_version"] = WEARABLE_RECORD_VERSION;
+    record["definition_version"] = mDefinitionVersion;
+    record["name"] = mName;
+    record["description"] = mDescription;
+    record["permissions"] = ll_create_sd_from_permissions(mPermissions);
+    record["sale_info"] = mSaleInfo.asLLSD();
+    record["type"] = (S32) mType;
+
+    LLSD params = LLSD::emptyMap();
+    for (const param_map_t::value_type& param_pair : mSavedVisualParamMap)
+    {
+        params[llformat("%d", param_pair.first)] = param_pair.second;
+    }
+    record["parameters"] = params;
+
+    LLSD textures = LLSD::emptyMap();
+    for (const te_map_t::value_type& te_pair : mTEMap)
+    {
+        textures[llformat("%d", te_pair.first)] = te_pair.second->getID();
+    }
+    record["textures"] = textures;
+
+    return record;
+}
+
+LLWearable::EImportResult LLViewerWearable::fromLLSDRecord(const LLSD& record, LLAvatarAppearance* avatarp)
+{
+    if (!avatarp)
+    {
+        return LLWearable::FAILURE;
+    }
+    if (record["record_version"].asInteger() != WEARABLE_RECORD_VERSION)
+    {
+        // record from an older viewer build; reparse from the text asset
+        return LLWearable::FAILURE;
+    }
+
+    // suppress texlayerset updates while the wearable is being rebuilt,
+    // just as importStream() does
+    LLOverrideBakedTextureUpdate stop_bakes(false);
+
+    mDefinitionVersion = record["definition_version"].asInteger();
+    if (mDefinitionVersion > LLWearable::getCurrentDefinitionVersion() && mDefinitionVersion != 24)
+    {
+        return LLWearable::FAILURE;
+    }
+
+    mName = record["name"].asString();
+    mDescription = record["description"].asString();
+    LLStringUtil::truncate(mName, DB_INV_ITEM_NAME_STR_LEN);
+    LLStringUtil::truncate(mDescription, DB_INV_ITEM_DESC_STR_LEN);
+
+    mPermissions = ll_permissions_from_sd(record["permissions"]);
+    bool has_perm_mask = false;
+    U32 perm_mask = 0;
+    mSaleInfo.fromLLSD(record["sale_info"], has_perm_mask, perm_mask);
+
+    S32 type = record["type"].asInteger();
+    if (type < 0 || type >= LLWearableType::WT_COUNT)
+    {
+        return LLWearable::FAILURE;
+    }
+    setType((LLWearableType::EType)type, avatarp);
+
+    const LLSD& params = record["parameters"];
+    for (LLSD::map_const_iterator it = params.beginMap(); it != params.endMap(); ++it)
+    {
+        S32 param_id = atoi(it->first.c_str());
+        mSavedVisualParamMap[param_id] = (F32) it->second.asReal();
+    }
+
+    const LLSD& textures = record["textures"];
+    for (LLSD::map_const_iterator it = textures.beginMap(); it != textures.endMap(); ++it)
+    {
+        S32 te = atoi(it->first.c_str());
+        if (te < 0 || te >= TEX_NUM_INDICES)
+        {
+            return LLWearable::FAILURE;
+        }
+        LLUUID textureid = it->second.asUUID();
+        LLViewerFetchedTexture* image = LLViewerTextureManager::getFetchedTexture(textureid);
+        if (mTEMap.find(te) != mTEMap.end())
+        {
+            delete mTEMap[te];
+        }
+        if (mSavedTEMap.find(te) != mSavedTEMap.end())
+        {
+            delete mSavedTEMap[te];
+        }
+        mTEMap[te] = new LLLocalTextureObject(image, textureid);
+        mSavedTEMap[te] = new LLLocalTextureObject(image, textureid);
+        createLayers(te, avatarp);
+    }
+
+    // copy all saved param values to working params
+    revertValues();
+
+    return LLWearable::SUCCESS;
+}
+
 
 // Avatar parameter and texture definitions can change over time.
 // This function returns true if parameters or textures have been added or removed
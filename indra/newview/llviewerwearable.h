@@ -67,6 +67,13 @@ public:
 
     /*virtual*/ EImportResult   importStream( std::istream& input_stream, LLAvatarAppearance* avatarp );
 
+    // Compact parsed form of the wearable, cached on disk so repeat
+    // logins can skip the text asset fetch and parse.  asLLSDRecord()
+    // captures everything importStream() reads out of the asset;
+    // fromLLSDRecord() rebuilds the wearable from such a record.
+    LLSD                        asLLSDRecord() const;
+    EImportResult               fromLLSDRecord(const LLSD& record, LLAvatarAppearance* avatarp);
+
     void                setParamsToDefaults();
     void                setTexturesToDefaults();
     void                setVolatile(bool is_volatile) { mVolatile = is_volatile; } // true when doing preview renders, some updates will be suppressed.
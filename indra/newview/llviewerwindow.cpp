@@ -1951,6 +1951,7 @@ LLViewerWindow::LLViewerWindow(const Params& p)
     LL_DEBUGS("Window") << "Loading feature tables." << LL_ENDL;
 
     // Initialize OpenGL Renderer
+    LLVertexBuffer::sUsePersistentMapping = gSavedSettings.getBOOL("RenderPersistentMappedVBO");
     LLVertexBuffer::initClass(mWindow);
     LL_INFOS("RenderInit") << "LLVertexBuffer initialization done." << LL_ENDL ;
     if (!gGL.init(true))
@@ -1978,7 +1979,9 @@ LLViewerWindow::LLViewerWindow(const Params& p)
 
     // Init the image list.  Must happen after GL is initialized and before the images that
     // LLViewerWindow needs are requested, as well as before LLViewerMedia starts updating images.
-    LLImageGL::initClass(mWindow, LLViewerTexture::MAX_GL_IMAGE_CATEGORY, false, gSavedSettings.getBOOL("RenderGLMultiThreadedTextures"), gSavedSettings.getBOOL("RenderGLMultiThreadedMedia"));
+    LLImageGL::sUsePBOUploadRing = gSavedSettings.getBOOL("RenderPBOTextureUploads");
+    LLImageGL::sUseSparseTextures = gSavedSettings.getBOOL("RenderSparseTextures");
+    LLImageGL::initClass(mWindow, LLViewerTexture::MAX_GL_IMAGE_CATEGORY, false, gSavedSettings.getBOOL("RenderGLMultiThreadedTextures"), gSavedSettings.getBOOL("RenderGLMultiThreadedMedia"), gSavedSettings.getBOOL("RenderGLMultiThreadedBuffers"));
     gTextureList.init();
     LLViewerTextureManager::init() ;
     gBumpImageList.init();
@@ -2046,6 +2049,7 @@ void LLViewerWindow::initBase()
     initialize_edit_menu();
 
     LLFontGL::loadCommonFonts();
+    LLFontGL::prewarmCommonGlyphs(LLUI::getLanguage());
 
     // Create the floater view at the start so that other views can add children to it.
     // (But wait to add it as a child of the root view so that it will be in front of the
@@ -4339,6 +4343,49 @@ LLPickInfo LLViewerWindow::pickImmediate(S32 x, S32 y_from_bot, bool pick_transp
     return mLastPick;
 }
 
+const LLPickInfo& LLViewerWindow::pickHover(S32 x, S32 y_from_bot, bool pick_transparent, bool pick_rigged)
+{
+    static LLCachedControl<F32> hover_interval_setting(gSavedSettings, "PickHoverAsyncInterval", 0.f);
+    F32 hover_interval = hover_interval_setting;
+
+    if (hover_interval <= 0.f)
+    { // legacy behavior -- full raycast on the spot, every call
+        mHoverPickResult = pickImmediate(x, y_from_bot, pick_transparent, pick_rigged);
+        return mHoverPickResult;
+    }
+
+    // refresh immediately when the probe changed, otherwise at most every
+    // hover_interval seconds -- objects can still move under a parked cursor
+    bool moved = x != mHoverPickPt.mX || y_from_bot != mHoverPickPt.mY ||
+        pick_transparent != mHoverPickTransparent || pick_rigged != mHoverPickRigged;
+
+    if (!mHoverPickPending &&
+        (moved || mHoverPickTimer.getElapsedTimeF32() > hover_interval) &&
+        mPicks.size() < 1024 && !mWindow->getMinimized())
+    {
+        mHoverPickPending = true;
+        mHoverPickPt.set(x, y_from_bot);
+        mHoverPickTransparent = pick_transparent;
+        mHoverPickRigged = pick_rigged;
+        mHoverPickTimer.reset();
+
+        MASK key_mask = gKeyboard->currentMask(true);
+        LLPickInfo pick_info(LLCoordGL(x, y_from_bot), key_mask, pick_transparent, pick_rigged, false, false, true, false, hoverPickCallback);
+        // queued directly rather than through schedulePick() -- hover picks
+        // are continuous and must not delay input processing
+        mPicks.push_back(pick_info);
+    }
+
+    return mHoverPickResult;
+}
+
+// static
+void LLViewerWindow::hoverPickCallback(const LLPickInfo& pick_info)
+{
+    gViewerWindow->mHoverPickResult = pick_info;
+    gViewerWindow->mHoverPickPending = false;
+}
+
 LLHUDIcon* LLViewerWindow::cursorIntersectIcon(S32 mouse_x, S32 mouse_y, F32 depth,
                                            LLVector4a* intersection)
 {
@@ -4939,6 +4986,8 @@ bool LLViewerWindow::rawSnapshot(LLImageRaw *raw, S32 image_width, S32 image_hei
     }
 
     // PRE SNAPSHOT
+    // show the last rendered frame before the clear below wipes it
+    present_pending_swap();
     gSnapshotNoPost = no_post;
     gDisplaySwapBuffers = false;
 
@@ -5114,6 +5163,36 @@ bool LLViewerWindow::rawSnapshot(LLImageRaw *raw, S32 image_width, S32 image_hei
                     swap();
                 }
 
+                // One bulk readback of the whole subimage through a pack
+                // PBO instead of a glReadPixels round-trip per scanline --
+                // each of those calls is a full pipeline sync, and at 4K
+                // they added up to most of the capture stall.
+                const U8* mapped = NULL;
+                GLuint read_pbo = 0;
+                if (!LLRender::sNsightDebugSupport && type == LLSnapshotModel::SNAPSHOT_TYPE_COLOR)
+                {
+                    LLAppViewer::instance()->pingMainloopTimeout("LLViewerWindow::rawSnapshot");
+
+                    glGenBuffers(1, &read_pbo);
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, read_pbo);
+                    glBufferData(GL_PIXEL_PACK_BUFFER, read_width * read_height * 3, nullptr, GL_STREAM_READ);
+                    glPixelStorei(GL_PACK_ALIGNMENT, 1); // rows in the PBO are tightly packed RGB
+                    glReadPixels(
+                             subimage_x_offset, subimage_y_offset,
+                             read_width, read_height,
+                             GL_RGB, GL_UNSIGNED_BYTE,
+                             nullptr
+                             );
+                    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+                    mapped = (const U8*)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+                    if (!mapped)
+                    { // unbind before the scanline fallback reads below
+                        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+                        glDeleteBuffers(1, &read_pbo);
+                        read_pbo = 0;
+                    }
+                }
+
                 for (U32 out_y = 0; out_y < read_height ; out_y++)
                 {
                     S32 output_buffer_offset = (
@@ -5134,12 +5213,19 @@ bool LLViewerWindow::rawSnapshot(LLImageRaw *raw, S32 image_width, S32 image_hei
                     {
                         if (type == LLSnapshotModel::SNAPSHOT_TYPE_COLOR)
                         {
-                            glReadPixels(
-                                     subimage_x_offset, out_y + subimage_y_offset,
-                                     read_width, 1,
-                                     GL_RGB, GL_UNSIGNED_BYTE,
-                                     raw->getData() + output_buffer_offset
-                                     );
+                            if (mapped)
+                            {
+                                memcpy(raw->getData() + output_buffer_offset, mapped + (out_y * read_width * 3), read_width * 3);
+                            }
+                            else
+                            { // couldn't map the PBO -- read the scanline directly
+                                glReadPixels(
+                                         subimage_x_offset, out_y + subimage_y_offset,
+                                         read_width, 1,
+                                         GL_RGB, GL_UNSIGNED_BYTE,
+                                         raw->getData() + output_buffer_offset
+                                         );
+                            }
                         }
                         else // LLSnapshotModel::SNAPSHOT_TYPE_DEPTH
                         {
@@ -5166,6 +5252,13 @@ bool LLViewerWindow::rawSnapshot(LLImageRaw *raw, S32 image_width, S32 image_hei
                         }
                     }
                 }
+
+                if (read_pbo)
+                {
+                    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+                    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+                    glDeleteBuffers(1, &read_pbo);
+                }
             }
             output_buffer_offset_x += subimage_x_offset;
             stop_glerror();
@@ -5243,6 +5336,8 @@ bool LLViewerWindow::rawSnapshot(LLImageRaw *raw, S32 image_width, S32 image_hei
 bool LLViewerWindow::simpleSnapshot(LLImageRaw* raw, S32 image_width, S32 image_height, const int num_render_passes)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_APP;
+    // show the last rendered frame before the clear below wipes it
+    present_pending_swap();
     gDisplaySwapBuffers = false;
 
     glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT); // stencil buffer is deprecated | GL_STENCIL_BUFFER_BIT);
@@ -5388,6 +5483,9 @@ bool LLViewerWindow::cubeSnapshot(const LLVector3& origin, LLCubeMapArray* cubea
         camera->setUserClipPlane(clipPlane);
     }
 
+    // show the last rendered frame before the clear below wipes it
+    present_pending_swap();
+
     glClear(GL_DEPTH_BUFFER_BIT | GL_COLOR_BUFFER_BIT); // stencil buffer is deprecated | GL_STENCIL_BUFFER_BIT);
 
     U32 dynamic_render_types[] = {
@@ -414,6 +414,12 @@ public:
                                 bool pick_unselectable = false,
                                 bool pick_reflection_probes = false);
     LLPickInfo      pickImmediate(S32 x, S32 y, bool pick_transparent, bool pick_rigged = false, bool pick_particle = false, bool pick_unselectable = true, bool pick_reflection_probe = false);
+    // Cached pick for continuous hover probing: returns the most recent
+    // completed hover pick and schedules a refresh that runs with the other
+    // queued picks in performPick(), so the raycast stays off the
+    // per-event path and callers see results one frame late. Enabled when
+    // PickHoverAsyncInterval > 0; falls through to pickImmediate() otherwise.
+    const LLPickInfo& pickHover(S32 x, S32 y_from_bot, bool pick_transparent, bool pick_rigged = false);
     LLHUDIcon* cursorIntersectIcon(S32 mouse_x, S32 mouse_y, F32 depth,
                                            LLVector4a* intersection);
 
@@ -528,6 +534,13 @@ private:
     bool            mCursorHidden;
     LLPickInfo      mLastPick;
     std::vector<LLPickInfo> mPicks;
+    LLPickInfo      mHoverPickResult;           // last completed hover pick (see pickHover)
+    LLCoordGL       mHoverPickPt;               // coordinates of the in-flight/last hover request
+    bool            mHoverPickTransparent = false;
+    bool            mHoverPickRigged = false;
+    bool            mHoverPickPending = false;  // a hover refresh is queued in mPicks
+    LLFrameTimer    mHoverPickTimer;            // throttles refreshes while the cursor is still
+    static void     hoverPickCallback(const LLPickInfo& pick_info);
     LLRect          mPickScreenRegion; // area of frame buffer for rendering pick frames (generally follows mouse to avoid going offscreen)
     LLTimer         mPickTimer;        // timer for scheduling n picks per second
 
@@ -472,11 +472,26 @@ void LLVLComposition::setSurface(LLSurface *surfacep)
 
 bool LLVLComposition::generateHeights(const F32 x, const F32 y,
                                       const F32 width, const F32 height)
+{
+    // synchronous fallback; the surface patch update path snapshots the
+    // inputs here and runs composeHeights on the thread pool instead
+    heights_job_ptr_t job = snapshotHeights(x, y, width, height);
+    if (!job)
+    {
+        return false;
+    }
+    composeHeights(job);
+    applyHeights(job);
+    return true;
+}
+
+LLVLComposition::heights_job_ptr_t LLVLComposition::snapshotHeights(const F32 x, const F32 y,
+                                                                    const F32 width, const F32 height)
 {
     if (!mParamsReady)
     {
         // All the parameters haven't been set yet (we haven't gotten the message from the sim)
-        return false;
+        return heights_job_ptr_t();
     }
 
     llassert(mSurfacep);
@@ -484,26 +499,58 @@ bool LLVLComposition::generateHeights(const F32 x, const F32 y,
     if (!mSurfacep || !mSurfacep->getRegion())
     {
         // We don't always have the region yet here....
-        return false;
+        return heights_job_ptr_t();
     }
 
-    S32 x_begin, y_begin, x_end, y_end;
+    heights_job_ptr_t job = std::make_shared<HeightsJob>();
 
-    x_begin = ll_round( x * mScaleInv );
-    y_begin = ll_round( y * mScaleInv );
-    x_end = ll_round( (x + width) * mScaleInv );
-    y_end = ll_round( (y + width) * mScaleInv );
+    job->mXBegin = ll_round( x * mScaleInv );
+    job->mYBegin = ll_round( y * mScaleInv );
+    job->mXEnd = ll_round( (x + width) * mScaleInv );
+    job->mYEnd = ll_round( (y + width) * mScaleInv );
 
-    if (x_end > mWidth)
+    if (job->mXEnd > mWidth)
     {
-        x_end = mWidth;
+        job->mXEnd = mWidth;
     }
-    if (y_end > mWidth)
+    if (job->mYEnd > mWidth)
     {
-        y_end = mWidth;
+        job->mYEnd = mWidth;
     }
 
-    LLVector3d origin_global = from_region_handle(mSurfacep->getRegion()->getHandle());
+    job->mGridWidth = mWidth;
+    job->mScale = mScale;
+    job->mOriginGlobal = from_region_handle(mSurfacep->getRegion()->getHandle());
+    for (S32 corner = 0; corner < CORNER_COUNT; corner++)
+    {
+        job->mStartHeight[corner] = mStartHeight[corner];
+        job->mHeightRange[corner] = mHeightRange[corner];
+    }
+
+    // Resolve the surface heights here; mSurfacep's data is owned by the
+    // main thread and must not be touched by the noise job.
+    job->mSurfaceHeights.reserve((job->mXEnd - job->mXBegin) * (job->mYEnd - job->mYBegin));
+    for (S32 j = job->mYBegin; j < job->mYEnd; j++)
+    {
+        for (S32 i = job->mXBegin; i < job->mXEnd; i++)
+        {
+            LLVector3 location(i*mScale, j*mScale, 0.f);
+            job->mSurfaceHeights.push_back(mSurfacep->resolveHeightRegion(location));
+        }
+    }
+
+    // The noise tables lazily initialize on first use; touch them here so
+    // that happens on the main thread rather than racing on the pool.
+    F32 vec[2] = { 0.f, 0.f };
+    noise2(vec);
+
+    return job;
+}
+
+// static
+void LLVLComposition::composeHeights(const heights_job_ptr_t& job)
+{
+    // Runs on the thread pool; reads nothing but the job snapshot.
 
     // For perlin noise generation...
     const F32 slope_squared = 1.5f*1.5f;
@@ -516,12 +563,15 @@ bool LLVLComposition::generateHeights(const F32 x, const F32 y,
     const F32 xyScaleInv = (1.f / xyScale);
     const F32 zScaleInv = (1.f / zScale);
 
-    const F32 inv_width = 1.f/mWidth;
+    const F32 inv_width = 1.f/job->mGridWidth;
+
+    job->mValues.reserve(job->mSurfaceHeights.size());
 
     // OK, for now, just have the composition value equal the height at the point.
-    for (S32 j = y_begin; j < y_end; j++)
+    const F32* surface_height = job->mSurfaceHeights.data();
+    for (S32 j = job->mYBegin; j < job->mYEnd; j++)
     {
-        for (S32 i = x_begin; i < x_end; i++)
+        for (S32 i = job->mXBegin; i < job->mXEnd; i++)
         {
 
             F32 vec[3];
@@ -529,24 +579,24 @@ bool LLVLComposition::generateHeights(const F32 x, const F32 y,
             F32 twiddle;
 
             // Bilinearly interpolate the start height and height range of the textures
-            F32 start_height = bilinear(mStartHeight[SOUTHWEST],
-                                        mStartHeight[SOUTHEAST],
-                                        mStartHeight[NORTHWEST],
-                                        mStartHeight[NORTHEAST],
+            F32 start_height = bilinear(job->mStartHeight[SOUTHWEST],
+                                        job->mStartHeight[SOUTHEAST],
+                                        job->mStartHeight[NORTHWEST],
+                                        job->mStartHeight[NORTHEAST],
                                         i*inv_width, j*inv_width); // These will be bilinearly interpolated
-            F32 height_range = bilinear(mHeightRange[SOUTHWEST],
-                                        mHeightRange[SOUTHEAST],
-                                        mHeightRange[NORTHWEST],
-                                        mHeightRange[NORTHEAST],
+            F32 height_range = bilinear(job->mHeightRange[SOUTHWEST],
+                                        job->mHeightRange[SOUTHEAST],
+                                        job->mHeightRange[NORTHWEST],
+                                        job->mHeightRange[NORTHEAST],
                                         i*inv_width, j*inv_width); // These will be bilinearly interpolated
 
-            LLVector3 location(i*mScale, j*mScale, 0.f);
+            LLVector3 location(i*job->mScale, j*job->mScale, 0.f);
 
-            F32 height = mSurfacep->resolveHeightRegion(location) + z_offset;
+            F32 height = *surface_height++ + z_offset;
 
             // Step 0: Measure the exact height at this texel
-            vec[0] = (F32)(origin_global.mdV[VX]+location.mV[VX])*xyScaleInv;   //  Adjust to non-integer lattice
-            vec[1] = (F32)(origin_global.mdV[VY]+location.mV[VY])*xyScaleInv;
+            vec[0] = (F32)(job->mOriginGlobal.mdV[VX]+location.mV[VX])*xyScaleInv;  //  Adjust to non-integer lattice
+            vec[1] = (F32)(job->mOriginGlobal.mdV[VY]+location.mV[VY])*xyScaleInv;
             vec[2] = height*zScaleInv;
             //
             //  Choose material value by adding to the exact height a random value
@@ -563,10 +613,27 @@ bool LLVLComposition::generateHeights(const F32 x, const F32 y,
 
             scaled_noisy_height = llmax(0.f, scaled_noisy_height);
             scaled_noisy_height = llmin(3.f, scaled_noisy_height);
-            *(mDatap + i + j*mWidth) = scaled_noisy_height;
+            job->mValues.push_back(scaled_noisy_height);
+        }
+    }
+}
+
+void LLVLComposition::applyHeights(const heights_job_ptr_t& job)
+{
+    if (job->mGridWidth != mWidth)
+    {
+        // layer was rebuilt at a different resolution while the job ran
+        return;
+    }
+
+    const F32* value = job->mValues.data();
+    for (S32 j = job->mYBegin; j < job->mYEnd; j++)
+    {
+        for (S32 i = job->mXBegin; i < job->mXEnd; i++)
+        {
+            *(mDatap + i + j*mWidth) = *value++;
         }
     }
-    return true;
 }
 
 LLTerrainMaterials gLocalTerrainMaterials;
@@ -29,6 +29,7 @@
 
 #include "llviewerlayer.h"
 #include "llviewershadermgr.h"
+#include "v3dmath.h"
 #include "llviewertexture.h"
 #include "llpointer.h"
 
@@ -137,6 +138,31 @@ public:
         CORNER_COUNT = 4
     };
 
+    // Snapshot of everything generateHeights reads for one subrect so the
+    // noise composition can run off the main thread. The surface heights are
+    // resolved at snapshot time; the computed values are copied back into the
+    // layer by applyHeights once the job lands on the main loop.
+    struct HeightsJob
+    {
+        S32 mXBegin, mXEnd, mYBegin, mYEnd;
+        S32 mGridWidth;                 // mWidth at snapshot time
+        LLVector3d mOriginGlobal;
+        F32 mScale;
+        F32 mStartHeight[CORNER_COUNT];
+        F32 mHeightRange[CORNER_COUNT];
+        std::vector<F32> mSurfaceHeights;   // row major over the subrect
+        std::vector<F32> mValues;           // row major over the subrect
+    };
+    typedef std::shared_ptr<HeightsJob> heights_job_ptr_t;
+
+    // Main thread: capture the inputs for a subrect. Returns null until the
+    // region parameters have arrived.
+    heights_job_ptr_t snapshotHeights(const F32 x, const F32 y, const F32 width, const F32 height);
+    // Any thread: run the noise composition over a snapshot.
+    static void composeHeights(const heights_job_ptr_t& job);
+    // Main thread: copy a finished job's values into the composition layer.
+    void applyHeights(const heights_job_ptr_t& job);
+
     void setDetailAssetID(S32 asset, const LLUUID& id) override;
     F32 getStartHeight(S32 corner);
     F32 getHeightRange(S32 corner);
@@ -31,10 +31,14 @@
 #include "indra_constants.h"
 #include "patch_code.h"
 #include "patch_dct.h"
+#include "llviewercontrol.h"
 #include "llviewerregion.h"
 #include "llframetimer.h"
 #include "llsurface.h"
 #include "llbitpack.h"
+#include "llwind.h"
+#include "llworld.h"
+#include "workqueue.h"
 
 const   char    LAND_LAYER_CODE                 = 'L';
 const   char    WIND_LAYER_CODE                 = '7';
@@ -74,15 +78,130 @@ void LLVLManager::addLayerData(LLVLData *vl_datap, const S32Bytes mesg_size)
     mPacketData.push_back(vl_datap);
 }
 
+// The DCT patch decoder in llmath keeps its quantization and cosine tables in
+// globals keyed off init_patch_decompressor(), so decode jobs serialize on
+// this mutex even when several worker threads pick them up.  The win is
+// getting the work off the main thread, not decode parallelism.
+static std::mutex sPatchDecodeMutex;
+
+// Decode one LayerData packet into patch-local buffers.  Runs on a worker
+// thread; must not touch the region or surface.
+static bool decode_layer_group(const S8 type, const U8 *data, const S32 size,
+                               const S32 patches_per_edge, LLVLDecodedGroup &out)
+{
+    LLBitPack bit_pack(const_cast<U8 *>(data), size);
+    LLGroupHeader goph;
+    LLPatchHeader ph;
+    S32 patch[LARGE_PATCH_SIZE*LARGE_PATCH_SIZE];
+
+    std::lock_guard<std::mutex> lock(sPatchDecodeMutex);
+
+    decode_patch_group_header(bit_pack, &goph);
+    init_patch_decompressor(goph.patch_size);
+    goph.stride = goph.patch_size;
+    set_group_of_patch_header(&goph);
+
+    if (LAND_LAYER_CODE == type)
+    {
+        while (1)
+        {
+            decode_patch_header(bit_pack, &ph);
+            if (ph.quant_wbits == END_OF_PATCHES)
+            {
+                break;
+            }
+
+            S32 i = ph.patchids >> 5;
+            S32 j = ph.patchids & 0x1F;
+
+            if ((i >= patches_per_edge) || (j >= patches_per_edge))
+            {
+                LL_WARNS() << "Received invalid terrain packet - patch header patch ID incorrect!"
+                    << " patches per edge " << patches_per_edge
+                    << " i " << i
+                    << " j " << j
+                    << " dc_offset " << ph.dc_offset
+                    << " range " << (S32)ph.range
+                    << " quant_wbits " << (S32)ph.quant_wbits
+                    << " patchids " << (S32)ph.patchids
+                    << LL_ENDL;
+                return false;
+            }
+
+            decode_patch(bit_pack, patch);
+
+            LLVLDecodedPatch decoded;
+            decoded.mPatchI = i;
+            decoded.mPatchJ = j;
+            decoded.mPatchSize = goph.patch_size;
+            decoded.mHeights.resize(goph.patch_size * goph.patch_size);
+            decompress_patch(decoded.mHeights.data(), patch, &ph);
+            out.mPatches.push_back(std::move(decoded));
+        }
+    }
+    else if (WIND_LAYER_CODE == type)
+    {
+        const S32 count = goph.patch_size * goph.patch_size;
+        out.mWindVelX.resize(count);
+        out.mWindVelY.resize(count);
+
+        decode_patch_header(bit_pack, &ph);
+        decode_patch(bit_pack, patch);
+        decompress_patch(out.mWindVelX.data(), patch, &ph);
+
+        decode_patch_header(bit_pack, &ph);
+        decode_patch(bit_pack, patch);
+        decompress_patch(out.mWindVelY.data(), patch, &ph);
+    }
+    return true;
+}
+
 void LLVLManager::unpackData(const S32 num_packets)
 {
     static LLFrameTimer decode_timer;
+    static LLCachedControl<bool> threaded_decode(gSavedSettings, "LayerDataThreadedDecode", true);
+
+    // Commit whatever the workers finished since last frame before queueing
+    // more, so decoded patches land on the surface in arrival order.
+    applyDecodedData();
+
+    LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
 
     S32 i;
     for (i = 0; i < mPacketData.size(); i++)
     {
         LLVLData *datap = mPacketData[i];
 
+        if (threaded_decode && general_queue && !general_queue->isClosed()
+            && CLOUD_LAYER_CODE != datap->mType)
+        {
+            // Hand the raw packet to the pool; ownership moves to the job.
+            const S8 type = datap->mType;
+            const U64 handle = datap->mRegionp->getHandle();
+            const S32 patches_per_edge = datap->mRegionp->getLand().getPatchesPerEdge();
+            LLVLManager *self = this;
+            bool posted = general_queue->post(
+                "terrain decode",
+                [self, datap, type, handle, patches_per_edge]()
+                {
+                    LLVLDecodedGroup group;
+                    group.mType = type;
+                    group.mRegionHandle = handle;
+                    if (decode_layer_group(type, datap->mData, datap->mSize,
+                                           patches_per_edge, group))
+                    {
+                        std::lock_guard<std::mutex> lock(self->mDecodedMutex);
+                        self->mDecodedData.push_back(std::move(group));
+                    }
+                    delete datap;
+                });
+            if (posted)
+            {
+                mPacketData[i] = NULL;
+                continue;
+            }
+        }
+
         LLBitPack bit_pack(datap->mData, datap->mSize);
         LLGroupHeader goph;
 
@@ -110,6 +229,38 @@ void LLVLManager::unpackData(const S32 num_packets)
 
 }
 
+void LLVLManager::applyDecodedData()
+{
+    std::vector<LLVLDecodedGroup> decoded;
+    {
+        std::lock_guard<std::mutex> lock(mDecodedMutex);
+        decoded.swap(mDecodedData);
+    }
+
+    for (LLVLDecodedGroup &group : decoded)
+    {
+        LLViewerRegion *regionp = LLWorld::getInstance()->getRegionFromHandle(group.mRegionHandle);
+        if (!regionp)
+        {
+            // Region went away while the decode was in flight.
+            continue;
+        }
+
+        if (LAND_LAYER_CODE == group.mType)
+        {
+            for (const LLVLDecodedPatch &patch : group.mPatches)
+            {
+                regionp->getLand().applyDecodedPatch(patch.mPatchI, patch.mPatchJ,
+                                                     patch.mPatchSize, patch.mHeights.data());
+            }
+        }
+        else if (WIND_LAYER_CODE == group.mType)
+        {
+            regionp->mWind.setVelocities(group.mWindVelX, group.mWindVelY);
+        }
+    }
+}
+
 void LLVLManager::resetBitCounts()
 {
     mLandBits = mWindBits = mCloudBits = (S32Bits)0;
@@ -31,9 +31,35 @@
 
 #include "stdtypes.h"
 
+#include <mutex>
+#include <vector>
+
 class LLVLData;
 class LLViewerRegion;
 
+// One patch decoded off the main thread, in patch-local (dense) layout.
+class LLVLDecodedPatch
+{
+public:
+    S32 mPatchI = 0;
+    S32 mPatchJ = 0;
+    S32 mPatchSize = 0;
+    std::vector<F32> mHeights;      // mPatchSize * mPatchSize, row major
+};
+
+// Result of decoding one LayerData packet on a worker thread.  Regions are
+// identified by handle so a region that dies while a decode is in flight
+// simply drops its results on commit.
+class LLVLDecodedGroup
+{
+public:
+    S8 mType = 0;
+    U64 mRegionHandle = 0;
+    std::vector<LLVLDecodedPatch> mPatches;     // land layer
+    std::vector<F32> mWindVelX;                 // wind layer
+    std::vector<F32> mWindVelY;
+};
+
 class LLVLManager
 {
 public:
@@ -53,11 +79,16 @@ public:
 
     void cleanupData(LLViewerRegion *regionp);
 protected:
+    // Commit worker-decoded patches to their surfaces in one main-thread batch.
+    void applyDecodedData();
 
     std::vector<LLVLData *> mPacketData;
     U32Bits mLandBits;
     U32Bits mWindBits;
     U32Bits mCloudBits;
+
+    std::mutex mDecodedMutex;
+    std::vector<LLVLDecodedGroup> mDecodedData;     // filled by worker threads
 };
 
 class LLVLData
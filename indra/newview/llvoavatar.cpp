@@ -3550,26 +3550,28 @@ void LLVOAvatar::idleUpdateNameTagText(bool new_name)
 
         if (LLAvatarName::useDisplayNames())
         {
-            LLAvatarName av_name;
-            if (!LLAvatarNameCache::get(getID(), &av_name))
+            static const LLAvatarName blank_name;
+            const LLAvatarName* av_name = LLAvatarNameCache::getCached(getID());
+            if (!av_name)
             {
                 // Force a rebuild at next idle
                 // Note: do not connect a callback on idle().
                 clearNameTag();
+                av_name = &blank_name;
             }
 
             // Might be blank if name not available yet, that's OK
             if (show_display_names)
             {
-                addNameTagLine(av_name.getDisplayName(), name_tag_color, LLFontGL::NORMAL,
+                addNameTagLine(av_name->getDisplayName(), name_tag_color, LLFontGL::NORMAL,
                     LLFontGL::getFontSansSerif(), true);
             }
             // Suppress SLID display if display name matches exactly (ugh)
-            if (show_usernames && !av_name.isDisplayNameDefault())
+            if (show_usernames && !av_name->isDisplayNameDefault())
             {
                 // *HACK: Desaturate the color
                 LLColor4 username_color = name_tag_color * 0.83f;
-                addNameTagLine(av_name.getUserName(), username_color, LLFontGL::NORMAL,
+                addNameTagLine(av_name->getUserName(), username_color, LLFontGL::NORMAL,
                     LLFontGL::getFontSansSerifSmall(), true);
             }
         }
@@ -3810,8 +3812,8 @@ LLColor4 LLVOAvatar::getNameTagColor(bool is_friend)
     else if (LLAvatarName::useDisplayNames())
     {
         // ...color based on whether username "matches" a computed display name
-        LLAvatarName av_name;
-        if (LLAvatarNameCache::get(getID(), &av_name) && av_name.isDisplayNameDefault())
+        const LLAvatarName* av_name = LLAvatarNameCache::getCached(getID());
+        if (av_name && av_name->isDisplayNameDefault())
         {
             color_name = "NameTagMatch";
         }
@@ -5734,8 +5736,15 @@ void LLVOAvatar::updateTextures()
         if (isIndexBakedTexture((ETextureIndex) texture_index) && render_avatar)
         {
             const S32 boost_level = getAvatarBakedBoostLevel();
+            F32 pixel_area = mPixelArea;
+            if (mRenderTier >= TIER_REDUCED_TEXTURES)
+            {
+                // graduated autotune: quarter the reported pixel area so the
+                // bakes of an over-budget avatar settle one mip lower
+                pixel_area *= 0.25f;
+            }
             imagep = LLViewerTextureManager::staticCastToFetchedTexture(getImage(texture_index,0), true);
-            addBakedTextureStats( imagep, mPixelArea, texel_area_ratio, boost_level );
+            addBakedTextureStats( imagep, pixel_area, texel_area_ratio, boost_level );
         }
     }
 
@@ -8604,6 +8613,19 @@ void LLVOAvatar::updateTooSlow()
         ((LLPerfStats::renderAvatarMaxART_ns > 0) &&
             (mGPURenderTime >= max_art_ms)); // NOTE: don't use getGPURenderTime accessor here to avoid "isTooSlow" feedback loop
 
+    static LLCachedControl<bool> use_tiers(gSavedSettings, "AutoTuneAvatarRenderTiers", true);
+    if (use_tiers && autotune && !ignore_tune && (LLPerfStats::renderAvatarMaxART_ns > 0))
+    {
+        updateRenderTier(max_art_ms);
+        // only the top tier falls through to the impostor path below; the
+        // lower tiers shed cost through the LOD and texture caps instead
+        exceeds_max_ART = (mRenderTier == TIER_IMPOSTOR);
+    }
+    else if (mRenderTier != TIER_FULL_DETAIL)
+    {
+        mRenderTier = TIER_FULL_DETAIL;
+    }
+
     if (exceeds_max_ART && !ignore_tune)
     {
         mTooSlow = true;
@@ -8643,6 +8665,44 @@ void LLVOAvatar::updateTooSlow()
     }
 }
 
+// Promote an over-budget avatar one tier at a time and demote only after a
+// hold period with clear headroom, so crowds degrade gradually instead of
+// snapping between full detail and impostors.
+void LLVOAvatar::updateRenderTier(F32 max_art_ms)
+{
+    // cost as a multiple of the ART limit that forces entry into tiers 1..3;
+    // the costliest avatars cross the higher multiples first
+    static const F32 TIER_ENTRY_MULT[TIER_IMPOSTOR] = { 1.f, 1.5f, 2.f };
+    const F32 TIER_EXIT_HEADROOM = 0.7f;
+    const U32 TIER_HOLD_FRAMES = 100;
+
+    if ((gFrameCount - mLastTierChangeFrame) < TIER_HOLD_FRAMES)
+    {
+        return;
+    }
+
+    U32 tier = mRenderTier;
+    if (tier < TIER_IMPOSTOR && mGPURenderTime >= max_art_ms * TIER_ENTRY_MULT[tier])
+    {
+        ++tier;
+    }
+    else if (tier > TIER_FULL_DETAIL
+             && !LLPerfStats::belowTargetFPS
+             && mGPURenderTime < max_art_ms * TIER_ENTRY_MULT[tier - 1] * TIER_EXIT_HEADROOM)
+    {
+        // only relax while the frame as a whole has headroom; the render
+        // time of a capped or impostored avatar is cheap by construction
+        // and says nothing about what full detail would cost
+        --tier;
+    }
+
+    if (tier != mRenderTier)
+    {
+        mRenderTier = tier;
+        mLastTierChangeFrame = gFrameCount;
+    }
+}
+
 //-----------------------------------------------------------------------------
 // findMotion()
 //-----------------------------------------------------------------------------
@@ -9939,6 +9999,61 @@ const LLVOAvatar::MatrixPaletteCache& LLVOAvatar::updateSkinInfoMatrixPalette(co
             mp[idx + 10] = m[10];
             mp[idx + 11] = m[14];
         }
+
+        // optional dual quaternion palette -- half the upload bytes and
+        // better deformation around twisting joints. Joint scale is dropped
+        // (dual quaternions only encode rigid transforms), which is why this
+        // stays opt-in via RenderAvatarDualQuaternionSkinning.
+        static LLCachedControl<bool> dq_skinning(gSavedSettings, "RenderAvatarDualQuaternionSkinning", false);
+        if (dq_skinning)
+        {
+            entry.mGLDq.resize(count * 8);
+            F32* dq = &(entry.mGLDq[0]);
+
+            for (U32 i = 0; i < count; ++i)
+            {
+                F32* m = (F32*)mat[i].mMatrix[0].getF32ptr();
+
+                // normalize the rotation rows to strip scale before
+                // extracting the quaternion
+                LLMatrix3 rot;
+                for (U32 row = 0; row < 3; ++row)
+                {
+                    LLVector3 r(m[row * 4 + 0], m[row * 4 + 1], m[row * 4 + 2]);
+                    r.normalize();
+                    rot.mMatrix[row][0] = r.mV[0];
+                    rot.mMatrix[row][1] = r.mV[1];
+                    rot.mMatrix[row][2] = r.mV[2];
+                }
+                LLQuaternion q(rot);
+                q.normalize();
+
+                const F32 qx = q.mQ[VX];
+                const F32 qy = q.mQ[VY];
+                const F32 qz = q.mQ[VZ];
+                const F32 qw = q.mQ[VW];
+                const F32 tx = m[12];
+                const F32 ty = m[13];
+                const F32 tz = m[14];
+
+                U32 idx = i * 8;
+
+                dq[idx + 0] = qx;
+                dq[idx + 1] = qy;
+                dq[idx + 2] = qz;
+                dq[idx + 3] = qw;
+
+                // dual part = 0.5 * (t 0) * q
+                dq[idx + 4] = 0.5f * ( tx * qw + ty * qz - tz * qy);
+                dq[idx + 5] = 0.5f * (-tx * qz + ty * qw + tz * qx);
+                dq[idx + 6] = 0.5f * ( tx * qy - ty * qx + tz * qw);
+                dq[idx + 7] = -0.5f * ( tx * qx + ty * qy + tz * qz);
+            }
+        }
+        else if (!entry.mGLDq.empty())
+        {
+            entry.mGLDq.clear();
+        }
     }
 
     return entry;
@@ -10809,6 +10924,10 @@ void LLVOAvatar::updateImpostors()
 {
     LLViewerCamera::sCurCameraID = LLViewerCamera::CAMERA_WORLD;
 
+    // 0 disables the budget and re-renders every stale impostor this frame
+    static LLCachedControl<F32> budget_ms(gSavedSettings, "RenderAvatarImpostorBudgetMS", 0.f);
+
+    std::vector<LLVOAvatar*> stale;
     for (LLCharacter* character : LLCharacter::sInstances)
     {
         LLVOAvatar* avatar = (LLVOAvatar*)character;
@@ -10817,8 +10936,32 @@ void LLVOAvatar::updateImpostors()
             && avatar->isImpostor()
             && avatar->needsImpostorUpdate())
         {
-            avatar->calcMutedAVColor();
-            gPipeline.generateImpostor(avatar);
+            stale.push_back(avatar);
+        }
+    }
+
+    if (budget_ms > 0.f && stale.size() > 1)
+    {
+        // most screen coverage first, boosted by how long each impostor has
+        // gone without a refresh so small background avatars still rotate
+        // through the budget instead of starving
+        std::sort(stale.begin(), stale.end(),
+                  [](const LLVOAvatar* lhs, const LLVOAvatar* rhs)
+                  {
+                      return lhs->getImpostorUpdatePriority() > rhs->getImpostorUpdatePriority();
+                  });
+    }
+
+    LLTimer update_timer;
+    for (LLVOAvatar* avatar : stale)
+    {
+        avatar->calcMutedAVColor();
+        gPipeline.generateImpostor(avatar);
+        // always refresh at least one impostor; anything over budget keeps
+        // mNeedsImpostorUpdate set and ages into the next frame's sort
+        if (budget_ms > 0.f && update_timer.getElapsedTimeF32() * 1000.f > budget_ms)
+        {
+            break;
         }
     }
 
@@ -10849,6 +10992,14 @@ bool LLVOAvatar::needsImpostorUpdate() const
     return mNeedsImpostorUpdate;
 }
 
+F32 LLVOAvatar::getImpostorUpdatePriority() const
+{
+    // screen coverage weighted by staleness, so a deferred impostor's
+    // priority keeps climbing until it gets its refresh
+    F32 staleness = llmax(0.f, (F32)(gFrameTimeSeconds - mLastImpostorUpdateFrameTime));
+    return mImpostorPixelArea * (1.f + staleness);
+}
+
 const LLVector3& LLVOAvatar::getImpostorOffset() const
 {
     return mImpostorOffset;
@@ -396,6 +396,19 @@ public:
 
     void            updateTooSlow();
 
+    // graduated autotune enforcement: avatars over their render budget step
+    // down through cheaper representations (capped rigged-attachment LODs,
+    // then reduced baked texture detail) before being impostored outright.
+    // The costliest avatars cross the higher tiers first.
+    enum ERenderTier : U32
+    {
+        TIER_FULL_DETAIL = 0,
+        TIER_REDUCED_LOD,       // rigged attachment LODs capped
+        TIER_REDUCED_TEXTURES,  // + baked textures held a mip lower
+        TIER_IMPOSTOR           // + impostored (same as the old cliff)
+    };
+    U32             getRenderTier() const { return mRenderTier; }
+
     bool            isTooComplex() const;
     bool            visualParamWeightsAreDefault();
     virtual bool    getIsCloud() const;
@@ -442,6 +455,10 @@ private:
 
     bool            mTuned{false};
 
+    void            updateRenderTier(F32 max_art_ms);
+    U32             mRenderTier{TIER_FULL_DETAIL};
+    U32             mLastTierChangeFrame{0};
+
 private:
     LLViewerStats::PhaseMap mPhases;
 
@@ -641,6 +658,7 @@ public:
     virtual bool isImpostor();
     bool        shouldImpostor(const F32 rank_factor = 1.0);
     bool        needsImpostorUpdate() const;
+    F32         getImpostorUpdatePriority() const;
     const LLVector3& getImpostorOffset() const;
     const LLVector2& getImpostorDim() const;
     void        getImpostorValues(LLVector4a* extents, LLVector3& angle, F32& distance) const;
@@ -830,6 +848,10 @@ public:
         // Float array ready to be sent to GL
         std::vector<F32> mGLMp;
 
+        // Dual quaternion palette (two vec4s per joint), only filled when
+        // RenderAvatarDualQuaternionSkinning is on
+        std::vector<F32> mGLDq;
+
         MatrixPaletteCache() :
             mFrame(gFrameCount - 1)
         {
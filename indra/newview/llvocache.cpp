@@ -259,6 +259,64 @@ LLVOCacheEntry::LLVOCacheEntry(LLAPRFile* apr_file)
     }
 }
 
+LLVOCacheEntry::LLVOCacheEntry(const U8* data_buffer, S32 buffer_size, S32& cursor)
+:   LLViewerOctreeEntryData(LLViewerOctreeEntry::LLVOCACHEENTRY),
+    mBuffer(NULL),
+    mUpdateFlags(-1),
+    mState(INACTIVE),
+    mSceneContrib(0.f),
+    mValid(false),
+    mParentID(0),
+    mBSphereRadius(-1.0f)
+{
+    S32 size = -1;
+    bool success = (buffer_size - cursor) >= ENTRY_HEADER_SIZE;
+
+    mDP.assignBuffer(mBuffer, 0);
+
+    if (success)
+    {
+        const U8* header = data_buffer + cursor;
+        memcpy(&mLocalID, header, sizeof(U32));
+        memcpy(&mCRC, header + sizeof(U32), sizeof(U32));
+        memcpy(&mHitCount, header + (2 * sizeof(U32)), sizeof(S32));
+        memcpy(&mDupeCount, header + (3 * sizeof(U32)), sizeof(S32));
+        memcpy(&mCRCChangeCount, header + (4 * sizeof(U32)), sizeof(S32));
+        memcpy(&size, header + (5 * sizeof(U32)), sizeof(S32));
+        cursor += ENTRY_HEADER_SIZE;
+
+        // Corruption in the cache entries
+        if ((size > MAX_ENTRY_BODY_SIZE) || (size < 1) || ((buffer_size - cursor) < size))
+        {
+            // We've got a bogus size; the rest of the buffer is likely
+            // bogus too and will be tossed anyway.
+            LL_WARNS() << "Bogus cache entry, size " << size << ", aborting!" << LL_ENDL;
+            success = false;
+        }
+    }
+    if (success)
+    {
+        mBuffer = new U8[size];
+        memcpy(mBuffer, data_buffer + cursor, size);
+        cursor += size;
+        mDP.assignBuffer(mBuffer, size);
+    }
+
+    if (!success)
+    {
+        mLocalID = 0;
+        mCRC = 0;
+        mHitCount = 0;
+        mDupeCount = 0;
+        mCRCChangeCount = 0;
+        mBuffer = NULL;
+        mEntry = NULL;
+        mState = INACTIVE;
+        // poison the cursor so the caller stops parsing
+        cursor = buffer_size;
+    }
+}
+
 LLVOCacheEntry::~LLVOCacheEntry()
 {
     mDP.freeBuffer();
@@ -1544,34 +1602,47 @@ bool LLVOCache::readFromCache(U64 handle, const LLUUID& id, LLVOCacheEntry::voca
         getObjectCacheFilename(handle, filename);
         LLAPRFile apr_file(filename, APR_READ|APR_BINARY, mLocalAPRFilePoolp);
 
-        success = check_read(&apr_file, cache_id.mData, UUID_BYTES);
+        // slurp the whole file in one read and parse entries from memory;
+        // reading entry by entry costs two file reads per object, which
+        // dominates region entry on object-heavy regions
+        S32 file_size = apr_file.seek(APR_END, 0);
+        success = (file_size >= (S32)(UUID_BYTES + sizeof(S32)))
+                  && (apr_file.seek(APR_SET, 0) == 0);
+
+        std::vector<U8> file_buffer;
+        if(success)
+        {
+            file_buffer.resize(file_size);
+            success = check_read(&apr_file, file_buffer.data(), file_size);
+        }
 
+        S32 cursor = 0;
         if(success)
         {
+            memcpy(cache_id.mData, file_buffer.data(), UUID_BYTES);
+            cursor += UUID_BYTES;
             if(cache_id != id)
             {
                 LL_INFOS() << "Cache ID doesn't match for this region, discarding"<< LL_ENDL;
                 success = false ;
             }
+        }
 
-            if(success)
-            {
-                success = check_read(&apr_file, &num_entries, sizeof(S32)) ;
+        if(success)
+        {
+            memcpy(&num_entries, file_buffer.data() + cursor, sizeof(S32));
+            cursor += (S32)sizeof(S32);
 
-                if(success)
+            for (S32 i = 0; i < num_entries && cursor < file_size; i++)
+            {
+                LLPointer<LLVOCacheEntry> entry = new LLVOCacheEntry(file_buffer.data(), file_size, cursor);
+                if (!entry->getLocalID())
                 {
-                    for (S32 i = 0; i < num_entries && apr_file.eof() != APR_EOF; i++)
-                    {
-                        LLPointer<LLVOCacheEntry> entry = new LLVOCacheEntry(&apr_file);
-                        if (!entry->getLocalID())
-                        {
-                            LL_WARNS() << "Aborting cache file load for " << filename << ", cache file corruption!" << LL_ENDL;
-                            success = false ;
-                            break ;
-                        }
-                        cache_entry_map[entry->getLocalID()] = entry;
-                    }
+                    LL_WARNS() << "Aborting cache file load for " << filename << ", cache file corruption!" << LL_ENDL;
+                    success = false ;
+                    break ;
                 }
+                cache_entry_map[entry->getLocalID()] = entry;
             }
         }
     }
@@ -103,6 +103,9 @@ protected:
 public:
     LLVOCacheEntry(U32 local_id, U32 crc, LLDataPackerBinaryBuffer &dp);
     LLVOCacheEntry(LLAPRFile* apr_file);
+    // parse one entry out of a whole cache file slurped into memory;
+    // advances cursor past the entry, or to buffer_size on corruption
+    LLVOCacheEntry(const U8* data_buffer, S32 buffer_size, S32& cursor);
     LLVOCacheEntry();
 
     void updateEntry(U32 crc, LLDataPackerBinaryBuffer &dp);
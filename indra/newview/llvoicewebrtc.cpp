@@ -2878,10 +2878,106 @@ bool LLVoiceWebRTCConnection::connectionStateMachine()
 // 'l'  - boolean, always true if exists.
 // 'v'  - boolean - voice activity has been detected.
 
-// llwebrtc callback
+// llwebrtc callback, on the webrtc networking thread.  Parse the packet
+// into a compact update list here so the main thread only pays for
+// applying the diffs, not for the json.
 void LLVoiceWebRTCConnection::OnDataReceived(const std::string& data, bool binary)
 {
-    LL::WorkQueue::postMaybe(mMainQueue, [=] { LLVoiceWebRTCConnection::OnDataReceivedImpl(data, binary); });
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_VOICE;
+
+    if (binary)
+    {
+        LL_WARNS("Voice") << "Binary data received from data channel." << LL_ENDL;
+        return;
+    }
+
+    participant_update_vec_t updates;
+    if (!parseParticipantUpdates(data, updates) || updates.empty())
+    {
+        return;
+    }
+
+    LL::WorkQueue::postMaybe(mMainQueue, [this, updates] { LLVoiceWebRTCConnection::OnDataReceivedImpl(updates); });
+}
+
+// static
+bool LLVoiceWebRTCConnection::parseParticipantUpdates(const std::string &data, participant_update_vec_t &updates)
+{
+    boost::system::error_code ec;
+    boost::json::value voice_data_parsed = boost::json::parse(data, ec);
+    if (ec)  // don't collect comments
+    {
+        return false;
+    }
+
+    if (!voice_data_parsed.is_object())
+    {
+        LL_WARNS("Voice") << "Expected object from data channel:" << data << LL_ENDL;
+        return false;
+    }
+
+    boost::json::object voice_data = voice_data_parsed.as_object();
+    for (auto &participant_elem : voice_data)
+    {
+        boost::json::string participant_id(participant_elem.key());
+        LLUUID agent_id(participant_id.c_str());
+        if (agent_id.isNull())
+        {
+           // probably a test client.
+           continue;
+        }
+
+        if (!participant_elem.value().is_object())
+        {
+            continue;
+        }
+
+        boost::json::object participant_obj = participant_elem.value().as_object();
+
+        ParticipantUpdate update;
+        update.mAgentID = agent_id;
+
+        if (participant_obj.contains("j") &&
+            participant_obj["j"].is_object())
+        {
+            // a new participant has announced that they're joining.
+            update.mJoined = true;
+            if (participant_obj["j"].as_object().contains("p") &&
+                participant_obj["j"].as_object()["p"].is_bool())
+            {
+                update.mPrimary = participant_obj["j"].as_object()["p"].as_bool();
+            }
+        }
+
+        if (participant_obj.contains("l") && participant_obj["l"].is_bool() && participant_obj["l"].as_bool())
+        {
+            update.mLeft = true;
+        }
+
+        if (participant_obj.contains("p") && participant_obj["p"].is_number())
+        {
+            // server sends up power as an integer which is level * 128 to save
+            // character count.
+            update.mHasLevel = true;
+            update.mLevel = (F32)participant_obj["p"].as_int64()/128.0f;
+        }
+
+        if (participant_obj.contains("v") && participant_obj["v"].is_bool())
+        {
+            update.mHasSpeaking = true;
+            update.mSpeaking = participant_obj["v"].as_bool();
+        }
+
+        if (participant_obj.contains("m") && participant_obj["m"].is_bool())
+        {
+            update.mHasModeratorMuted = true;
+            update.mModeratorMuted = participant_obj["m"].as_bool();
+        }
+
+        updates.push_back(update);
+    }
+
+    return true;
 }
 
 //
@@ -2889,7 +2985,7 @@ void LLVoiceWebRTCConnection::OnDataReceived(const std::string& data, bool binar
 // before the webrtc connection itself is shut down, so
 // we shouldn't be getting this callback on a nonexistant
 // this pointer.
-void LLVoiceWebRTCConnection::OnDataReceivedImpl(const std::string &data, bool binary)
+void LLVoiceWebRTCConnection::OnDataReceivedImpl(const participant_update_vec_t &updates)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_VOICE;
 
@@ -2898,130 +2994,90 @@ void LLVoiceWebRTCConnection::OnDataReceivedImpl(const std::string &data, bool b
         return;
     }
 
-    if (binary)
+    bool new_participant = false;
+    boost::json::object mute;
+    boost::json::object user_gain;
+    for (const ParticipantUpdate &update : updates)
     {
-        LL_WARNS("Voice") << "Binary data received from data channel." << LL_ENDL;
-        return;
-    }
+        const LLUUID &agent_id = update.mAgentID;
 
-    boost::system::error_code ec;
-    boost::json::value voice_data_parsed = boost::json::parse(data, ec);
-    if (!ec)  // don't collect comments
-    {
-        if (!voice_data_parsed.is_object())
-        {
-            LL_WARNS("Voice") << "Expected object from data channel:" << data << LL_ENDL;
-            return;
-        }
-        boost::json::object voice_data = voice_data_parsed.as_object();
-        bool new_participant = false;
-        boost::json::object mute;
-        boost::json::object user_gain;
-        for (auto &participant_elem : voice_data)
+        LLWebRTCVoiceClient::participantStatePtr_t participant =
+            LLWebRTCVoiceClient::getInstance()->findParticipantByID(mChannelID, agent_id);
+
+        if (update.mJoined)
         {
-            boost::json::string participant_id(participant_elem.key());
-            LLUUID agent_id(participant_id.c_str());
-            if (agent_id.isNull())
+            // track incoming participants that are muted so we can mute their connections (or set their volume)
+            std::string participant_id = agent_id.asString();
+            bool isMuted = LLMuteList::getInstance()->isMuted(agent_id, LLMute::flagVoiceChat);
+            if (isMuted)
             {
-               // probably a test client.
-               continue;
+                mute[participant_id] = true;
             }
-
-            if (!participant_elem.value().is_object())
+            F32 volume;
+            if(LLSpeakerVolumeStorage::getInstance()->getSpeakerVolume(agent_id, volume))
             {
-                continue;
+                user_gain[participant_id] = (uint32_t)(volume * 200);
             }
+        }
 
-            boost::json::object participant_obj = participant_elem.value().as_object();
-
-            LLWebRTCVoiceClient::participantStatePtr_t participant =
-                LLWebRTCVoiceClient::getInstance()->findParticipantByID(mChannelID, agent_id);
-            bool joined  = false;
-            bool primary = false;  // we ignore any 'joins' reported about participants
-                                   // that come from voice servers that aren't their primary
-                                   // voice server.  This will happen with cross-region voice
-                                   // where a participant on a neighboring region may be
-                                   // connected to multiple servers.  We don't want to
-                                   // add new identical participants from all of those servers.
-            if (participant_obj.contains("j") &&
-                participant_obj["j"].is_object())
-            {
-                // a new participant has announced that they're joining.
-                joined  = true;
-                if (participant_elem.value().as_object()["j"].as_object().contains("p") &&
-                    participant_elem.value().as_object()["j"].as_object()["p"].is_bool())
-                {
-                    primary = participant_elem.value().as_object()["j"].as_object()["p"].as_bool();
-                }
+        new_participant |= update.mJoined;
 
-                // track incoming participants that are muted so we can mute their connections (or set their volume)
-                bool isMuted = LLMuteList::getInstance()->isMuted(agent_id, LLMute::flagVoiceChat);
-                if (isMuted)
-                {
-                    mute[participant_id] = true;
-                }
-                F32 volume;
-                if(LLSpeakerVolumeStorage::getInstance()->getSpeakerVolume(agent_id, volume))
-                {
-                    user_gain[participant_id] = (uint32_t)(volume * 200);
-                }
-            }
+        // we ignore any 'joins' reported about participants that come
+        // from voice servers that aren't their primary voice server.
+        // This will happen with cross-region voice where a participant
+        // on a neighboring region may be connected to multiple servers.
+        // We don't want to add new identical participants from all of
+        // those servers.
+        if (!participant && update.mJoined && (update.mPrimary || !isSpatial()))
+        {
+            participant = LLWebRTCVoiceClient::getInstance()->addParticipantByID(mChannelID, agent_id, mRegionID);
+        }
 
-            new_participant |= joined;
-            if (!participant && joined && (primary || !isSpatial()))
+        if (participant)
+        {
+            if (update.mLeft)
             {
-                participant = LLWebRTCVoiceClient::getInstance()->addParticipantByID(mChannelID, agent_id, mRegionID);
+                // an existing participant is leaving.
+                if (agent_id != gAgentID)
+                {
+                    LLWebRTCVoiceClient::getInstance()->removeParticipantByID(mChannelID, agent_id, mRegionID);
+                }
             }
-
-            if (participant)
+            else
             {
-                if (participant_obj.contains("l") && participant_obj["l"].is_bool() && participant_obj["l"].as_bool())
+                if (update.mHasLevel)
                 {
-                    // an existing participant is leaving.
-                    if (agent_id != gAgentID)
-                    {
-                        LLWebRTCVoiceClient::getInstance()->removeParticipantByID(mChannelID, agent_id, mRegionID);
-                    }
+                    participant->mLevel = update.mLevel;
                 }
-                else
-                {
-                    // we got a 'power' update.
-                    if (participant_obj.contains("p") && participant_obj["p"].is_number())
-                    {
-                        // server sends up power as an integer which is level * 128 to save
-                        // character count.
-                        participant->mLevel = (F32)participant_obj["p"].as_int64()/128.0f;
-                    }
 
-                    if (participant_obj.contains("v") && participant_obj["v"].is_bool())
-                    {
-                        participant->mIsSpeaking = participant_obj["v"].as_bool();
-                    }
+                if (update.mHasSpeaking)
+                {
+                    participant->mIsSpeaking = update.mSpeaking;
+                }
 
-                    if (participant_obj.contains("m") && participant_obj["m"].is_bool())
-                    {
-                        participant->mIsModeratorMuted = participant_obj["m"].as_bool();
-                    }
+                if (update.mHasModeratorMuted)
+                {
+                    participant->mIsModeratorMuted = update.mModeratorMuted;
                 }
             }
         }
+    }
 
-        // tell the simulator to set the mute and volume data for this
-        // participant, if there are any updates.
-        boost::json::object root;
-        if (mute.size() > 0)
-        {
-            root["m"] = mute;
-        }
-        if (user_gain.size() > 0)
-        {
-            root["ug"] = user_gain;
-        }
-        if (root.size() > 0)
-        {
-            std::string json_data = boost::json::serialize(root);
-            mWebRTCDataInterface->sendData(json_data, false);
-        }
+    // tell the simulator to set the mute and volume data for this
+    // participant, if there are any updates.
+    boost::json::object root;
+    if (mute.size() > 0)
+    {
+        root["m"] = mute;
+    }
+    if (user_gain.size() > 0)
+    {
+        root["ug"] = user_gain;
+    }
+    if (root.size() > 0)
+    {
+        std::string json_data = boost::json::serialize(root);
+        mWebRTCDataInterface->sendData(json_data, false);
     }
 }
 
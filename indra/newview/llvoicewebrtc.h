@@ -605,7 +605,25 @@ class LLVoiceWebRTCConnection :
     void OnDataChannelReady(llwebrtc::LLWebRTCDataInterface *data_interface) override;
     //@}
 
-    void OnDataReceivedImpl(const std::string &data, bool binary);
+    // participant state diff extracted from a data channel packet on the
+    // webrtc networking thread; applied to viewer state on the main thread
+    struct ParticipantUpdate
+    {
+        LLUUID mAgentID;
+        bool   mJoined = false;
+        bool   mPrimary = false;
+        bool   mLeft = false;
+        bool   mHasLevel = false;
+        bool   mHasSpeaking = false;
+        bool   mHasModeratorMuted = false;
+        F32    mLevel = 0.f;
+        bool   mSpeaking = false;
+        bool   mModeratorMuted = false;
+    };
+    typedef std::vector<ParticipantUpdate> participant_update_vec_t;
+
+    static bool parseParticipantUpdates(const std::string &data, participant_update_vec_t &updates);
+    void OnDataReceivedImpl(const participant_update_vec_t &updates);
 
     void sendJoin();
     void sendData(const std::string &data);
@@ -500,10 +500,20 @@ void LLVOPartGroup::getGeometry(const LLViewerPart& part,
     }
     else
     {
-        LLVector4a part_pos_agent;
-        part_pos_agent.load3(part.mPosAgent.mV);
         LLVector4a camera_agent;
         camera_agent.load3(getCameraPosition().mV);
+        expandBillboard(part, camera_agent, verticesp);
+    }
+}
+
+//static
+void LLVOPartGroup::expandBillboard(const LLViewerPart& part,
+                                    const LLVector4a& camera_agent,
+                                    LLStrider<LLVector4a>& verticesp)
+{
+    {
+        LLVector4a part_pos_agent;
+        part_pos_agent.load3(part.mPosAgent.mV);
         LLVector4a at;
         at.setSub(part_pos_agent, camera_agent);
         LLVector4a up(0, 0, 1);
@@ -807,6 +817,13 @@ void LLParticlePartition::getGeometry(LLSpatialGroup* group)
 
     LLSpatialGroup::drawmap_elem_t& draw_vec = group->mDrawMap[mRenderPass];
 
+    // camera state hoisted out of the per-particle quad expansion; the camera
+    // position is per-object (HUD particles use a different one) but faces
+    // are grouped by object so it rarely changes between iterations
+    const LLViewerObject* camera_object = NULL;
+    LLVector4a camera_agent;
+    const LLVector3 part_normal = -LLViewerCamera::getInstance()->getXAxis();
+
     for (std::vector<LLFace*>::iterator i = mFaceList.begin(); i != mFaceList.end(); ++i)
     {
         LLFace* facep = *i;
@@ -830,7 +847,44 @@ void LLParticlePartition::getGeometry(LLSpatialGroup* group)
 
         LLColor4U* start_glow = cur_glow.get();
 
-        object->getGeometry(facep->getTEOffset(), cur_vert, cur_norm, cur_tc, cur_col, cur_glow, cur_idx);
+        LLVOPartGroup* part_object = (LLVOPartGroup*)object;
+        const LLViewerPart* part = part_object->getPart(facep->getTEOffset());
+        if (part && !(part->mFlags & LLPartData::LL_PART_RIBBON_MASK))
+        {
+            // fast path for plain billboards: expand the quad directly from
+            // the particle record without the virtual per-face dispatch
+            if (object != camera_object)
+            {
+                camera_agent.load3(part_object->getCameraPosition().mV);
+                camera_object = object;
+            }
+
+            LLVOPartGroup::expandBillboard(*part, camera_agent, cur_vert);
+
+            const LLColor4U color = part->mColor;
+            *cur_col++ = color;
+            *cur_col++ = color;
+            *cur_col++ = color;
+            *cur_col++ = color;
+
+            const LLColor4U glow = part->mGlow;
+            *cur_glow++ = glow;
+            *cur_glow++ = glow;
+            *cur_glow++ = glow;
+            *cur_glow++ = glow;
+
+            if (!(part->mFlags & LLPartData::LL_PART_EMISSIVE_MASK))
+            { //not fullbright, needs normal
+                *cur_norm++ = part_normal;
+                *cur_norm++ = part_normal;
+                *cur_norm++ = part_normal;
+                *cur_norm++ = part_normal;
+            }
+        }
+        else
+        {
+            object->getGeometry(facep->getTEOffset(), cur_vert, cur_norm, cur_tc, cur_col, cur_glow, cur_idx);
+        }
 
         bool has_glow = false;
 
@@ -82,6 +82,19 @@ public:
     void        getGeometry(const LLViewerPart& part,
                                 LLStrider<LLVector4a>& verticesp);
 
+    // expand one camera-facing billboard quad for a non-ribbon particle.
+    // Static so LLParticlePartition::getGeometry can batch-fill buffers with
+    // the camera position hoisted out of the per-particle loop.
+    static void expandBillboard(const LLViewerPart& part,
+                                const LLVector4a& camera_agent,
+                                LLStrider<LLVector4a>& verticesp);
+
+    // particle record for the given face index, or NULL if out of range
+    const LLViewerPart* getPart(S32 idx) const
+    {
+        return idx < (S32)mViewerPartGroupp->mParticles.size() ? mViewerPartGroupp->mParticles[idx] : NULL;
+    }
+
                 void        getGeometry(S32 idx,
                                 LLStrider<LLVector4a>& verticesp,
                                 LLStrider<LLVector3>& normalsp,
@@ -99,13 +112,13 @@ public:
     void setViewerPartGroup(LLViewerPartGroup *part_groupp)     { mViewerPartGroupp = part_groupp; }
     LLViewerPartGroup* getViewerPartGroup() { return mViewerPartGroupp; }
 
+    virtual LLVector3 getCameraPosition() const;
+
 protected:
     ~LLVOPartGroup();
 
     LLViewerPartGroup *mViewerPartGroupp;
 
-    virtual LLVector3 getCameraPosition() const;
-
 };
 
 
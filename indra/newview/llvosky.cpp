@@ -55,6 +55,7 @@
 
 #include "lltrace.h"
 #include "llfasttimer.h"
+#include "workqueue.h"
 
 #undef min
 #undef max
@@ -407,6 +408,7 @@ LLVOSky::LLVOSky(const LLUUID &id, const LLPCode pcode, LLViewerRegion *regionp)
     mForceUpdate(false),
     mNeedUpdate(true),
     mCubeMapUpdateStage(-1),
+    mSkyTexJobState(SKYTEX_JOB_IDLE),
     mWorldScale(1.f),
     mBumpSunDir(0.f, 0.f, 1.f)
 {
@@ -703,6 +705,17 @@ bool LLVOSky::updateSky()
 
     if (mCubeMapUpdateStage < 0)
     {
+        if (mSkyTexJobState != SKYTEX_JOB_IDLE)
+        {
+            // forceSkyUpdate() reset the stage while a face was still baking
+            // on the thread pool; let the job drain before starting over
+            if (mSkyTexJobState == SKYTEX_JOB_DONE)
+            {
+                mSkyTexJobState = SKYTEX_JOB_IDLE;
+            }
+            return true;
+        }
+
         calc();
 
         bool same_atmospherics = approximatelyEqual(m_lastAtmosphericsVars, m_atmosphericsVars, UPDATE_MIN_DELTA_THRESHOLD);
@@ -780,12 +793,52 @@ bool LLVOSky::updateSky()
     else if (mCubeMapUpdateStage >= 0 && mCubeMapUpdateStage < NUM_CUBEMAP_FACES && !LLPipeline::sReflectionProbesEnabled)
     {
         LL_PROFILE_ZONE_NAMED("updateSky - create");
+
+        if (mSkyTexJobState == SKYTEX_JOB_RUNNING)
+        { // face still baking on the thread pool
+            return true;
+        }
+
+        if (mSkyTexJobState == SKYTEX_JOB_DONE)
+        {
+            mSkyTexJobState = SKYTEX_JOB_IDLE;
+            mCubeMapUpdateStage++;
+            return true;
+        }
+
         S32 side = mCubeMapUpdateStage;
-        // CPU hungry part, createSkyTexture() is math heavy
-        // Prior to EEP it was mostly per tile, but since EPP it is per face.
-        // This still can be optimized further
-        // (i.e. potentially can be made per tile again, can be moved to thread
-        // instead of executing per face, or may be can be moved to shaders)
+        // CPU hungry part, createSkyTexture() is math heavy.
+        // Prior to EEP it was mostly per tile, but since EEP it is per face.
+        // Run each face on the "General" pool against a cloned sky so the
+        // main thread only pays for the GL upload in the finalize stage.
+        // The face's CPU-side pixel buffers aren't touched by the main
+        // thread until all six faces complete.
+        static LLCachedControl<bool> threaded_sky(gSavedSettings, "SkyTextureThreadedUpdate", true);
+        LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+
+        if (threaded_sky && general_queue && !general_queue->isClosed())
+        {
+            LLPointer<LLVOSky> self = this;
+            LLSettingsSky::ptr_t psky_clone = psky->buildClone();
+            AtmosphericsVars vars = m_atmosphericsVars;
+            mSkyTexJobState = SKYTEX_JOB_RUNNING;
+            bool posted = general_queue->post(
+                "sky texture",
+                [self, psky_clone, vars, side]() mutable
+                {
+                    for (S32 tile = 0; tile < NUM_TILES; tile++)
+                    {
+                        self->createSkyTexture(psky_clone, vars, side, tile);
+                    }
+                    self->mSkyTexJobState = SKYTEX_JOB_DONE;
+                });
+            if (posted)
+            {
+                return true;
+            }
+            mSkyTexJobState = SKYTEX_JOB_IDLE;
+        }
+
         for (S32 tile = 0; tile < NUM_TILES; tile++)
         {
             createSkyTexture(psky, m_atmosphericsVars, side, tile);
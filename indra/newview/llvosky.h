@@ -38,6 +38,8 @@
 #include "llsettingssky.h"
 #include "lllegacyatmospherics.h"
 
+#include <atomic>
+
 const F32 SKY_BOX_MULT          = 16.0f;
 const F32 HEAVENLY_BODY_DIST    = HORIZON_DIST - 20.f;
 const F32 HEAVENLY_BODY_FACTOR  = 0.1f;
@@ -342,6 +344,16 @@ protected:
     bool                mNeedUpdate;                // flag to force update of cubemap
     S32                 mCubeMapUpdateStage;        // state of cubemap uodate: -1 idle; 0-5 per-face updates; 6 finalizing
 
+    // per-face sky texture math can run on the "General" thread pool;
+    // a face's tiles are baked off-thread, then updateSky advances the stage
+    enum ESkyTexJob
+    {
+        SKYTEX_JOB_IDLE,
+        SKYTEX_JOB_RUNNING,
+        SKYTEX_JOB_DONE
+    };
+    std::atomic<S32>    mSkyTexJobState;
+
     F32                 mAmbientScale;
     LLColor3            mNightColorShift;
     F32                 mInterpVal;
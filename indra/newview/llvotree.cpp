@@ -349,27 +349,46 @@ void LLVOTree::idleUpdate(LLAgent &agent, const F64 &time)
         return;
     }
 
-    S32 trunk_LOD = sMAX_NUM_TREE_LOD_LEVELS ; // disabled
     F32 app_angle = getAppAngle()*LLVOTree::sTreeFactor;
     F32 distance = mDrawable->mDistanceWRTCamera * LLVOVolume::sDistanceFactor * (F_PI / 3.f);
     F32 diameter = getScale().length(); // trees have very broken scale, but length rougtly outlines proper diameter
     F32 sz = mBillboardScale * mBillboardRatio * diameter;
 
-    for (S32 j = 0; j < sMAX_NUM_TREE_LOD_LEVELS; j++)
+    auto compute_lod = [&](F32 bias)
     {
-        if (app_angle > LLVOTree::sLODAngles[j])
+        S32 lod = sMAX_NUM_TREE_LOD_LEVELS; // disabled
+        for (S32 j = 0; j < sMAX_NUM_TREE_LOD_LEVELS; j++)
         {
-            trunk_LOD = j;
-            break;
+            if (app_angle*bias > LLVOTree::sLODAngles[j])
+            {
+                lod = j;
+                break;
+            }
         }
-    }
 
-    F32 tan_angle = (LLVOTree::sTreeFactor * 64 * sz) / distance;
-    S32 cur_detail = LLVolumeLODGroup::getDetailFromTan(ll_round(tan_angle, 0.01f)); // larger value, better quality
+        F32 tan_angle = (LLVOTree::sTreeFactor * 64 * sz * bias) / distance;
+        S32 cur_detail = LLVolumeLODGroup::getDetailFromTan(ll_round(tan_angle, 0.01f)); // larger value, better quality
+
+        // for lod lower value means better quality, but both lod and cur_detail have 4 levels
+        lod = llmax(lod, LLVolumeLODGroup::NUM_LODS - cur_detail - 1);
+        lod = llmin(lod, sMAX_NUM_TREE_LOD_LEVELS);
+        return lod;
+    };
 
-    // for trunk_LOD lower value means better quality, but both trunk_LOD and cur_detail have 4 levels
-    trunk_LOD = llmax(trunk_LOD, LLVolumeLODGroup::NUM_LODS - cur_detail - 1);
-    trunk_LOD = llmin(trunk_LOD, sMAX_NUM_TREE_LOD_LEVELS);
+    S32 trunk_LOD = compute_lod(1.f);
+
+    // LOD hysteresis: a switch triggers a full mesh regeneration, so don't
+    // flip until the tree's apparent size clears the threshold by 10%.
+    // Re-test with the tree biased back toward the current LOD; if that
+    // keeps the current level, stay put.
+    if (mReferenceBuffer.notNull() && trunk_LOD != mTrunkLOD)
+    {
+        F32 bias = (trunk_LOD > mTrunkLOD) ? 1.1f : 0.9f;
+        if (compute_lod(bias) == mTrunkLOD)
+        {
+            trunk_LOD = mTrunkLOD;
+        }
+    }
 
     if (mReferenceBuffer.isNull())
     {
@@ -920,24 +939,33 @@ void LLVOTree::updateMesh()
 
     LLFace* facep = mDrawable->getFace(0);
     if (!facep) return;
-    LLVertexBuffer* buff = new LLVertexBuffer(LLDrawPoolTree::VERTEX_DATA_MASK);
-    if (!buff->allocateBuffer(vert_count, index_count))
+
+    // reuse the face's buffer when the size is unchanged (position/rotation
+    // rebuilds at the same LOD) rather than reallocating every update
+    LLVertexBuffer* buff = facep->getVertexBuffer();
+    if (!buff ||
+        buff->getNumVerts() != vert_count ||
+        buff->getNumIndices() != index_count)
     {
-        LL_WARNS() << "Failed to allocate Vertex Buffer on mesh update to "
-            << vert_count << " vertices and "
-            << index_count << " indices" << LL_ENDL;
-        buff->allocateBuffer(1, 3);
-        memset((U8*)buff->getMappedData(), 0, buff->getSize());
-        memset((U8*)buff->getMappedIndices(), 0, buff->getIndicesSize());
-        facep->setSize(1, 3);
+        buff = new LLVertexBuffer(LLDrawPoolTree::VERTEX_DATA_MASK);
+        if (!buff->allocateBuffer(vert_count, index_count))
+        {
+            LL_WARNS() << "Failed to allocate Vertex Buffer on mesh update to "
+                << vert_count << " vertices and "
+                << index_count << " indices" << LL_ENDL;
+            buff->allocateBuffer(1, 3);
+            memset((U8*)buff->getMappedData(), 0, buff->getSize());
+            memset((U8*)buff->getMappedIndices(), 0, buff->getIndicesSize());
+            facep->setSize(1, 3);
+            facep->setVertexBuffer(buff);
+            mReferenceBuffer->unmapBuffer();
+            buff->unmapBuffer();
+            return;
+        }
+
         facep->setVertexBuffer(buff);
-        mReferenceBuffer->unmapBuffer();
-        buff->unmapBuffer();
-        return;
     }
 
-    facep->setVertexBuffer(buff);
-
     LLStrider<LLVector3> vertices;
     LLStrider<LLVector3> normals;
     LLStrider<LLVector2> tex_coords;
@@ -52,6 +52,7 @@
 #include "lldrawpoolbump.h"
 #include "llface.h"
 #include "llspatialpartition.h"
+#include "llvboconsolidation.h"
 #include "llhudmanager.h"
 #include "llflexibleobject.h"
 #include "llskinningutil.h"
@@ -89,6 +90,7 @@
 #include "llavatarappearancedefines.h"
 #include "llgltfmateriallist.h"
 #include "gltfscenemanager.h"
+#include "workqueue.h"
 
 const F32 FORCE_SIMPLE_RENDER_AREA = 512.f;
 const F32 FORCE_CULL_AREA = 8.f;
@@ -227,6 +229,7 @@ LLVOVolume::LLVOVolume(const LLUUID &id, const LLPCode pcode, LLViewerRegion *re
     mNumFaces = 0;
     mLODChanged = false;
     mSculptChanged = false;
+    mSculptAsyncPending = false;
     mColorChanged = false;
     mSpotLightPriority = 0.f;
 
@@ -823,6 +826,14 @@ void LLVOVolume::updateTextureVirtualSize(bool forced)
             }
         }
 
+        // on a large virtual size jump (4x in area, 2x per dimension), queue
+        // a decode priority update instead of waiting for the round-robin
+        // scan in updateImagesFetchTextures to come back to this texture
+        if (vsize > old_size * 4.f || vsize * 4.f < old_size)
+        {
+            gTextureList.dirtyImagePriority(LLViewerTextureManager::staticCastToFetchedTexture(imagep));
+        }
+
         if (gPipeline.hasRenderDebugMask(LLPipeline::RENDER_DEBUG_TEXTURE_PRIORITY))
         {
             LLViewerFetchedTexture* img = LLViewerTextureManager::staticCastToFetchedTexture(imagep) ;
@@ -1101,9 +1112,10 @@ bool LLVOVolume::setVolume(const LLVolumeParams &params_in, const S32 detail, bo
             // if it's a mesh
             if ((volume_params.getSculptType() & LL_SCULPT_TYPE_MASK) == LL_SCULPT_TYPE_MESH)
             {
-                if (mSkinInfo && mSkinInfo->mMeshID != volume_params.getSculptID())
+                if (mSkinInfo && mSkinInfoMeshID != volume_params.getSculptID())
                 {
                     mSkinInfo = NULL;
+                    mSkinInfoMeshID.setNull();
                     mSkinInfoUnavaliable = false;
                 }
 
@@ -1132,7 +1144,7 @@ bool LLVOVolume::setVolume(const LLVolumeParams &params_in, const S32 detail, bo
                         const LLMeshSkinInfo* skin_info = gMeshRepo.getSkinInfo(mesh_id, this);
                         if (skin_info)
                         {
-                            notifySkinInfoLoaded(skin_info);
+                            notifySkinInfoLoaded(mesh_id, skin_info);
                         }
                     }
                 }
@@ -1178,6 +1190,7 @@ void LLVOVolume::updateSculptTexture()
 
         mSkinInfoUnavaliable = false;
         mSkinInfo = NULL;
+        mSkinInfoMeshID.setNull();
     }
     else
     {
@@ -1242,10 +1255,11 @@ void LLVOVolume::notifyMeshLoaded()
     updateVisualComplexity();
 }
 
-void LLVOVolume::notifySkinInfoLoaded(const LLMeshSkinInfo* skin)
+void LLVOVolume::notifySkinInfoLoaded(const LLUUID& mesh_id, const LLMeshSkinInfo* skin)
 {
     mSkinInfoUnavaliable = false;
     mSkinInfo = skin;
+    mSkinInfoMeshID = mesh_id;
 
     notifyMeshLoaded();
 }
@@ -1254,6 +1268,7 @@ void LLVOVolume::notifySkinInfoUnavailable()
 {
     mSkinInfoUnavaliable = true;
     mSkinInfo = nullptr;
+    mSkinInfoMeshID.setNull();
 }
 
 // sculpt replaces generate() for sculpted surfaces
@@ -1346,24 +1361,87 @@ void LLVOVolume::sculpt()
             {
                 LLViewerTextureManager::sTesterp->updateGrayTextureBinding();
             }
+
+            // the placeholder sculpt is trivial to generate; apply in place
+            getVolume()->sculpt(sculpt_width, sculpt_height, sculpt_components, sculpt_data, discard_level, mSculptTexture->isMissingAsset());
         }
         else
         {
-            LLImageDataSharedLock lock(raw_image);
-
-            sculpt_height = raw_image->getHeight();
-            sculpt_width = raw_image->getWidth();
-            sculpt_components = raw_image->getComponents();
-
-            sculpt_data = raw_image->getData();
-
             if(LLViewerTextureManager::sTesterp)
             {
                 mSculptTexture->updateBindStatsForTester() ;
             }
+
+            // apply the map against a detached volume on a worker; clusters
+            // of sculpties arriving together used to hitch the frame here
+            sculptAsync(raw_image, discard_level);
         }
+    }
+}
+
+void LLVOVolume::sculptAsync(LLImageRaw* raw_image, S32 discard_level)
+{
+    if (mSculptAsyncPending)
+    { // a fresh sculpt() is issued from onSculptComplete() when this lands
+        return;
+    }
+    mSculptAsyncPending = true;
+
+    LL::WorkQueue::ptr_t main_queue = LL::WorkQueue::getInstance("mainloop");
+    LL::WorkQueue::ptr_t general_queue = LL::WorkQueue::getInstance("General");
+
+    // inputs are captured by value; the raw image is thread-safe refcounted
+    // and only read under its shared lock
+    LLPointer<LLImageRaw> raw = raw_image;
+    const LLVolumeParams params = getVolume()->getParams();
+    const F32 detail = getVolume()->getDetail();
+    const bool is_missing = mSculptTexture->isMissingAsset();
+    const LLUUID obj_id = mID;
+
+    main_queue->postTo(
+        general_queue,
+        [raw, params, detail, discard_level, is_missing]() // work on general queue
+        {
+            // build against a detached volume; the live, shared one stays
+            // untouched until the main-thread callback copies the faces in
+            LLPointer<LLVolume> volume = new LLVolume(params, detail);
+            LLImageDataSharedLock lock(raw);
+            volume->sculpt(raw->getWidth(), raw->getHeight(), raw->getComponents(), raw->getData(), discard_level, is_missing);
+            return volume;
+        },
+        [obj_id](LLPointer<LLVolume> volume) // callback to main thread
+        {
+            LLVOVolume* vobj = dynamic_cast<LLVOVolume*>(gObjectList.findObject(obj_id));
+            if (vobj)
+            {
+                vobj->onSculptComplete(volume);
+            }
+        });
+}
+
+void LLVOVolume::onSculptComplete(LLVolume* volume)
+{
+    mSculptAsyncPending = false;
+
+    if (isDead() || !getVolume())
+    {
+        return;
+    }
+
+    if (getVolume()->getParams() == volume->getParams())
+    {
+        getVolume()->copyVolumeFaces(volume);
+        getVolume()->setSculptLevel(volume->getSculptLevel());
 
-        getVolume()->sculpt(sculpt_width, sculpt_height, sculpt_components, sculpt_data, discard_level, mSculptTexture->isMissingAsset());
+        mSculptChanged = true;
+        gPipeline.markRebuild(mDrawable, LLDrawable::REBUILD_GEOMETRY);
+    }
+
+    // if better sculpt data arrived while the worker ran, go again;
+    // no-op when the applied discard level is already current
+    if (isSculpted() && !isMesh() && mSculptTexture.notNull())
+    {
+        sculpt();
     }
 }
 
@@ -1533,8 +1611,11 @@ bool LLVOVolume::calcLOD()
         lod_factor *= DEFAULT_FIELD_OF_VIEW / LLViewerCamera::getInstance()->getDefaultFOV();
     }
 
+    F32 prev_distance = mLODAdjustedDistance;
     mLODAdjustedDistance = distance;
 
+    F32 cam_speed = LLViewerCamera::getInstance()->getAverageSpeed();
+
     if (isHUDAttachment())
     {
         // HUDs always show at highest detail
@@ -1543,6 +1624,42 @@ bool LLVOVolume::calcLOD()
     else
     {
         cur_detail = computeLODDetail(ll_round(distance, 0.01f), ll_round(radius, 0.01f), lod_factor);
+
+        // Velocity-aware hysteresis: while the camera is moving, probe the
+        // LOD a short distance further along the current approach.  A
+        // transition against the direction of travel is transient -- hold
+        // the current LOD so borderline objects don't flip during a pan --
+        // while a transition with it jumps straight to the probed
+        // destination, so sweeping across several LOD boundaries costs one
+        // rebuild instead of one per boundary.
+        if (cur_detail != mLOD && mLOD >= 0 && cam_speed > 0.5f &&
+            prev_distance > 0.f && distance != prev_distance)
+        {
+            bool approaching = distance < prev_distance;
+            F32 margin = llmin(cam_speed * 0.25f, distance * 0.25f);
+            F32 probe = approaching ? llmax(distance - margin, 0.01f) : distance + margin;
+            S32 probe_detail = computeLODDetail(ll_round(probe, 0.01f), ll_round(radius, 0.01f), lod_factor);
+
+            if ((cur_detail > mLOD) == approaching)
+            {
+                cur_detail = probe_detail;
+            }
+            else
+            {
+                cur_detail = mLOD;
+            }
+        }
+
+        if (mDrawable->isState(LLDrawable::RIGGED))
+        {
+            LLVOAvatar* avatar = getAvatar();
+            if (avatar && avatar->getRenderTier() >= LLVOAvatar::TIER_REDUCED_LOD)
+            {
+                // graduated autotune: cap rigged attachment LODs on avatars
+                // over their render budget before resorting to impostors
+                cur_detail = llmin(cur_detail, 1);
+            }
+        }
     }
 
     if (gPipeline.hasRenderDebugMask(LLPipeline::RENDER_DEBUG_TRIANGLE_COUNT) && mDrawable->getFace(0))
@@ -1563,6 +1680,27 @@ bool LLVOVolume::calcLOD()
 
     if (cur_detail != mLOD)
     {
+        // Rate-limit LOD-change rebuilds per spatial group while the camera
+        // is moving; a pan otherwise dumps every object in the swept region
+        // into the build queue in a single frame.  Objects past the budget
+        // re-evaluate next frame; a stationary camera is exempt so the
+        // scene always converges.
+        const U32 MAX_GROUP_LOD_CHANGES_PER_FRAME = 8;
+        LLSpatialGroup* group = mDrawable->getSpatialGroup();
+        if (group && cam_speed > 0.5f && !isHUDAttachment())
+        {
+            if (group->mLODChangeFrame != gFrameCount)
+            {
+                group->mLODChangeFrame = gFrameCount;
+                group->mLODChangeCount = 0;
+            }
+            if (group->mLODChangeCount >= MAX_GROUP_LOD_CHANGES_PER_FRAME)
+            {
+                return false;
+            }
+            group->mLODChangeCount++;
+        }
+
         mAppAngle = ll_round((F32) atan2( mDrawable->getRadius(), mDrawable->mDistanceWRTCamera) * RAD_TO_DEG, 0.01f);
         mLOD = cur_detail;
 
@@ -4949,7 +5087,24 @@ void LLRiggedVolume::update(
 
     LLMatrix4a mat[kMaxJoints];
     U32 maxJoints = LLSkinningUtil::getMeshJointCount(skin);
-    LLSkinningUtil::initSkinningMatrixPalette(mat, maxJoints, skin, avatar);
+    // The rigged render passes already cache one palette per
+    // (avatar, skin hash) per frame; reuse that instead of rebuilding the
+    // same palette for every rigged volume update this frame.
+    static LLCachedControl<bool> shared_palette(gSavedSettings, "RiggedSharedMatrixPalette", false);
+    bool palette_ready = false;
+    if (shared_palette)
+    {
+        const LLVOAvatar::MatrixPaletteCache& mpc = avatar->updateSkinInfoMatrixPalette(skin);
+        if (mpc.mMatrixPalette.size() >= maxJoints)
+        {
+            memcpy((void*)mat, &(mpc.mMatrixPalette[0]), maxJoints * sizeof(LLMatrix4a));
+            palette_ready = true;
+        }
+    }
+    if (!palette_ready)
+    {
+        LLSkinningUtil::initSkinningMatrixPalette(mat, maxJoints, skin, avatar);
+    }
     const LLMatrix4a bind_shape_matrix = skin->mBindShapeMatrix;
 
     S32 rigged_vert_count = 0;
@@ -6034,6 +6189,9 @@ void LLVolumeGeometryManager::rebuildGeom(LLSpatialGroup* group)
     group->mLastUpdateTime = gFrameTimeSeconds;
     group->mBuilt = 1.f;
     group->clearState(LLSpatialGroup::GEOM_DIRTY | LLSpatialGroup::ALPHA_DIRTY);
+
+    // candidate for migration into a shared vertex buffer if it stays quiet
+    LLVBOConsolidation::queueGroup(group);
 }
 
 void LLVolumeGeometryManager::rebuildMesh(LLSpatialGroup* group)
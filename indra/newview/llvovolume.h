@@ -232,6 +232,11 @@ public:
                 void    updateSculptTexture();
                 void    setIndexInTex(U32 ch, S32 index) { mIndexInTex[ch] = index ;}
                 void    sculpt();
+                // sculpt map application staged on the general worker pool
+                // against a detached volume; the finished faces are copied
+                // into the live volume on the main thread
+                void    sculptAsync(LLImageRaw* raw_image, S32 discard_level);
+                void    onSculptComplete(LLVolume* volume);
      static     void    rebuildMeshAssetCallback(const LLUUID& asset_uuid,
                                                  LLAssetType::EType type,
                                                  void* user_data, S32 status, LLExtStat ext_status);
@@ -389,7 +394,7 @@ public:
     void updateVisualComplexity();
 
     void notifyMeshLoaded();
-    void notifySkinInfoLoaded(const LLMeshSkinInfo* skin);
+    void notifySkinInfoLoaded(const LLUUID& mesh_id, const LLMeshSkinInfo* skin);
     void notifySkinInfoUnavailable();
 
     // Returns 'true' iff the media data for this object is in flight
@@ -459,6 +464,7 @@ private:
     S32         mLOD;
     bool        mLODChanged;
     bool        mSculptChanged;
+    bool        mSculptAsyncPending;
     bool        mColorChanged;
     F32         mSpotLightPriority;
     LLMatrix4   mRelativeXform;
@@ -487,6 +493,9 @@ private:
 
     bool mSkinInfoUnavaliable;
     LLConstPointer<LLMeshSkinInfo> mSkinInfo;
+    // mesh asset mSkinInfo was resolved for; the instance may be shared
+    // across identical assets, so its mMeshID is not authoritative
+    LLUUID mSkinInfoMeshID;
     // statics
 public:
     static F32 sLODSlopDistanceFactor;// Changing this to zero, effectively disables the LOD transition slop
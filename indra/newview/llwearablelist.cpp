@@ -30,6 +30,8 @@
 
 #include "message.h"
 #include "llassetstorage.h"
+#include "llfilesystem.h"
+#include "llsdserialize.h"
 #include "llagent.h"
 #include "llvoavatar.h"
 #include "llviewerstats.h"
@@ -62,6 +64,16 @@ struct LLWearableArrivedData
     LLAvatarAppearance *mAvatarp;
 };
 
+// Parsed-wearable records live in the disk cache under an id derived
+// from the asset id, so they never collide with the raw asset bytes
+// the asset system caches under the asset id itself.
+static LLUUID wearable_record_id(const LLAssetID& asset_id)
+{
+    LLUUID record_id;
+    record_id.generate(asset_id.asString() + "_parsed_wearable");
+    return record_id;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // LLWearableList
 
@@ -87,6 +99,15 @@ void LLWearableList::getAsset(const LLAssetID& assetID, const std::string& weara
     }
     else
     {
+        // try the parsed record cached on disk before going through
+        // the asset system and the text parser
+        LLViewerWearable* cached = loadCachedWearable(assetID, avatarp, asset_type);
+        if (cached)
+        {
+            mList[assetID] = cached;
+            asset_arrived_callback(cached, userdata);
+            return;
+        }
         gAssetStorage->getAssetData(assetID,
             asset_type,
             LLWearableList::processGetAssetReply,
@@ -95,6 +116,61 @@ void LLWearableList::getAsset(const LLAssetID& assetID, const std::string& weara
     }
 }
 
+LLViewerWearable* LLWearableList::loadCachedWearable(const LLAssetID& assetID, LLAvatarAppearance* avatarp, LLAssetType::EType asset_type)
+{
+    const LLUUID record_id = wearable_record_id(assetID);
+    if (!LLFileSystem::getExists(record_id, asset_type))
+    {
+        return NULL;
+    }
+
+    LLFileSystem file(record_id, asset_type, LLFileSystem::READ);
+    S32 size = file.getSize();
+    if (size <= 0)
+    {
+        return NULL;
+    }
+
+    std::vector<U8> buffer(size);
+    if (!file.read(buffer.data(), size))
+    {
+        return NULL;
+    }
+
+    LLSD record;
+    if (LLSDSerialize::fromBinaryBuffer(record, buffer.data(), size) < 0)
+    {
+        LL_WARNS("Wearable") << "Malformed cached wearable record for " << assetID << LL_ENDL;
+        return NULL;
+    }
+
+    LLViewerWearable* wearable = new LLViewerWearable(assetID);
+    if (LLWearable::SUCCESS != wearable->fromLLSDRecord(record, avatarp))
+    {
+        // stale or unusable record; reparse from the text asset
+        delete wearable;
+        return NULL;
+    }
+
+    LL_DEBUGS("Wearable") << "wearable " << assetID << " loaded from cached record" << LL_ENDL;
+    return wearable;
+}
+
+// static
+void LLWearableList::cacheWearable(LLViewerWearable* wearable)
+{
+    std::ostringstream stream;
+    LLSDSerialize::toBinary(wearable->asLLSDRecord(), stream);
+    const std::string& data = stream.str();
+    if (data.empty())
+    {
+        return;
+    }
+
+    LLFileSystem file(wearable_record_id(wearable->getAssetID()), wearable->getAssetType(), LLFileSystem::WRITE);
+    file.write((const U8*) data.data(), (S32) data.size());
+}
+
 // static
 void LLWearableList::processGetAssetReply( const char* filename, const LLAssetID& uuid, void* userdata, S32 status, LLExtStat ext_status )
 {
@@ -199,6 +275,8 @@ void LLWearableList::processGetAssetReply( const char* filename, const LLAssetID
 
     if (wearable) // success
     {
+        // cache the parsed form so the next session skips the text parse
+        cacheWearable(wearable);
         LLWearableList::instance().mList[ uuid ] = wearable;
         LL_DEBUGS("Wearable") << "processGetAssetReply()" << LL_ENDL;
         LL_DEBUGS("Wearable") << wearable << LL_ENDL;
@@ -64,6 +64,11 @@ public:
 protected:
     LLViewerWearable* generateNewWearable(); // used for the create... functions
 private:
+    // Disk-cached parsed wearable records; loadCachedWearable returns
+    // NULL on a miss, which falls through to the asset fetch and parse.
+    LLViewerWearable*   loadCachedWearable(const LLAssetID& assetID, LLAvatarAppearance* avatarp, LLAssetType::EType asset_type);
+    static void         cacheWearable(LLViewerWearable* wearable);
+
     std::map<LLUUID, LLViewerWearable*> mList;
 };
 
@@ -150,6 +150,19 @@ void LLWind::decompress(LLBitPack &bitpack, LLGroupHeader *group_headerp)
     }
 }
 
+void LLWind::setVelocities(const std::vector<F32> &vel_x, const std::vector<F32> &vel_y)
+{
+    const size_t count = (size_t)(mSize * mSize);
+    if (vel_x.size() != count || vel_y.size() != count)
+    {
+        LL_WARNS() << "Dropping decoded wind patch of unexpected size "
+            << vel_x.size() << "/" << vel_y.size() << LL_ENDL;
+        return;
+    }
+    memcpy(mVelX, vel_x.data(), count*sizeof(F32));
+    memcpy(mVelY, vel_y.data(), count*sizeof(F32));
+}
+
 
 LLVector3 LLWind::getAverage()
 {
@@ -31,6 +31,8 @@
 #include "v3math.h"
 #include "v3dmath.h"
 
+#include <vector>
+
 class LLVector3;
 class LLBitPack;
 class LLGroupHeader;
@@ -48,6 +50,8 @@ public:
     LLVector3 getVelocityNoisy(const LLVector3 &location, const F32 dim);   // "location" is region-local
 
     void decompress(LLBitPack &bitpack, LLGroupHeader *group_headerp);
+    // Adopt velocity patches that were decoded on a worker thread.
+    void setVelocities(const std::vector<F32> &vel_x, const std::vector<F32> &vel_y);
     LLVector3 getAverage();
 
     void setOriginGlobal(const LLVector3d &origin_global);
@@ -57,6 +57,7 @@
 #include "message.h"
 #include "pipeline.h"
 #include "llappviewer.h"        // for do_disconnect()
+#include "llperfstats.h"
 #include "llscenemonitor.h"
 #include <deque>
 #include <queue>
@@ -703,6 +704,30 @@ void LLWorld::updateRegions(F32 max_update_time)
         self_regionp->idleUpdate(max_time);
     }
 
+    //if the agent's velocity will carry it into a neighbor soon, give that
+    //region the same full-budget update as the self region so its cached
+    //objects are created before the crossing instead of after the handshake
+    LLViewerRegion* predicted_regionp = NULL;
+    static LLCachedControl<F32> prefetch_time(gSavedSettings, "RegionCrossingPrefetchTime", 0.f);
+    if ((F32)prefetch_time > 0.f && self_regionp)
+    {
+        LLVector3d predicted_pos = gAgent.getPositionGlobal() +
+            LLVector3d(gAgent.getVelocity()) * (F32)prefetch_time;
+        predicted_regionp = getRegionFromPosGlobal(predicted_pos);
+        if (predicted_regionp && predicted_regionp != self_regionp)
+        {
+            max_time = llmin((F32)(max_update_time - update_timer.getElapsedTimeF32()), max_update_time * 0.25f);
+            if (max_time > 0.f)
+            {
+                predicted_regionp->idleUpdate(max_time);
+            }
+        }
+        else
+        {
+            predicted_regionp = NULL;
+        }
+    }
+
     //sort regions by its mLastUpdate
     //smaller mLastUpdate first to make sure every region has chance to get updated.
     LLViewerRegion::region_priority_list_t region_list;
@@ -710,7 +735,7 @@ void LLWorld::updateRegions(F32 max_update_time)
          iter != mRegionList.end(); ++iter)
     {
         LLViewerRegion* regionp = *iter;
-        if(regionp != self_regionp)
+        if(regionp != self_regionp && regionp != predicted_regionp)
         {
             region_list.insert(regionp);
         }
@@ -718,6 +743,7 @@ void LLWorld::updateRegions(F32 max_update_time)
     }
 
     // Perform idle time updates for the regions (and associated surfaces)
+    S32 starved_regions = 0;
     for (LLViewerRegion::region_priority_list_t::iterator iter = region_list.begin();
          iter != region_list.end(); ++iter)
     {
@@ -734,9 +760,14 @@ void LLWorld::updateRegions(F32 max_update_time)
         {
             //perform some necessary but very light updates.
             (*iter)->lightIdleUpdate();
+            starved_regions++;
         }
     }
 
+    // regions that only got the light update are this frame's backlog for
+    // the frame-budget governor
+    LLPerfStats::FrameBudget::reportBacklog(LLPerfStats::FrameBudget::Subsystem::REGIONS, starved_regions);
+
     if(max_time > 0.f)
     {
         max_time = llmin((F32)(max_update_time - update_timer.getElapsedTimeF32()), max_update_time * 0.25f);
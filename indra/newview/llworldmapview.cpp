@@ -684,9 +684,49 @@ void LLWorldMapView::drawMipmap(S32 width, S32 height)
     // Render the current level
     sVisibleTilesLoaded = drawMipmapLevel(width, height, level);
 
+    // Once the visible set is complete, warm up the ring of tiles just
+    // outside the viewport so panning doesn't start from a cold fetch
+    if (sVisibleTilesLoaded)
+    {
+        prefetchNeighborTiles(width, height, level);
+    }
+
     return;
 }
 
+// Request (without drawing) the tiles one ring beyond the visible viewport at the given level
+void LLWorldMapView::prefetchNeighborTiles(S32 width, S32 height, S32 level)
+{
+    // Size in meters (global) of each tile of that level, as in drawMipmapLevel()
+    S32 tile_width = LLWorldMipmap::MAP_TILE_SIZE * (1 << (level - 1));
+    LLVector3d pos_SW = viewPosToGlobal(0, 0);
+    LLVector3d pos_NE = viewPosToGlobal(width, height);
+    pos_NE[VX] += tile_width;
+    pos_NE[VY] += tile_width;
+
+    U32 grid_x, grid_y;
+    for (F64 index_y = pos_SW[VY] - tile_width; index_y < pos_NE[VY] + tile_width; index_y += tile_width)
+    {
+        for (F64 index_x = pos_SW[VX] - tile_width; index_x < pos_NE[VX] + tile_width; index_x += tile_width)
+        {
+            if (index_x < 0 || index_y < 0)
+            {
+                continue;
+            }
+            // Skip the tiles the draw traversal already requested
+            if (index_x >= pos_SW[VX] && index_x < pos_NE[VX] &&
+                index_y >= pos_SW[VY] && index_y < pos_NE[VY])
+            {
+                continue;
+            }
+            LLWorldMipmap::globalToMipmap(index_x, index_y, level, &grid_x, &grid_y);
+            // Kicks off the fetch if the tile isn't resident; boost decay
+            // drops it back to BOOST_NONE once it leaves the prefetch ring
+            LLWorldMap::getInstance()->getObjectsTile(grid_x, grid_y, level, true);
+        }
+    }
+}
+
 // Return true if all the tiles required to render that level have been fetched or are truly missing
 bool LLWorldMapView::drawMipmapLevel(S32 width, S32 height, S32 level, bool load)
 {
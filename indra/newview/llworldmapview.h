@@ -97,6 +97,7 @@ public:
     void            drawFrustum();
     void            drawMipmap(S32 width, S32 height);
     bool            drawMipmapLevel(S32 width, S32 height, S32 level, bool load = true);
+    void            prefetchNeighborTiles(S32 width, S32 height, S32 level);
 
     static void     cleanupTextures();
 
@@ -44,6 +44,7 @@
 #include "llviewercontrol.h"
 #include "llxmlnode.h"
 #include "stringize.h"
+#include "workqueue.h"
 
 // Have to include these last to avoid queue redefinition!
 
@@ -99,6 +100,7 @@ public:
     std::string         mProxyAddress;
 
     std::string         mResponseText;
+    size_t              mResponseLength;    // remembered across the parse job, which consumes mResponseText
     LLSD                mResponseData;
     bool                mHasResponse;
     bool                mResponseParsed;
@@ -119,9 +121,23 @@ public:
     void setStatus(EStatus code, const std::string& message = "", const std::string& uri = "");
     void setHttpStatus(const LLCore::HttpStatus &status);
 
+    // Shared with the parse job on the General work queue so a transaction
+    // destroyed mid-parse (e.g. a cancelled login) can't leave the worker
+    // with a dangling pointer.
+    struct ParseState
+    {
+        std::string mText;          // response body, moved in
+        std::string mURI;           // for log messages only
+        LLSD mData;
+        bool mSuccess = false;
+        std::atomic<bool> mDone { false };
+    };
+
 private:
-    bool parseResponse(LLXMLNodePtr root);
-    bool parseValue(LLSD& target, LLXMLNodePtr source);
+    static bool parseMethodResponse(const std::string& uri, LLXMLNodePtr root, LLSD& data);
+    static void parseResponseText(ParseState& state);
+
+    std::shared_ptr<ParseState> mParseState;
 };
 
 LLXMLRPCTransaction::Handler::Handler(LLCore::HttpRequest::ptr_t &request,
@@ -165,6 +181,7 @@ void LLXMLRPCTransaction::Handler::onCompleted(LLCore::HttpHandle handle,
     mImpl->mResponseText.resize(body->size());
 
     body->read(0, mImpl->mResponseText.data(), body->size());
+    mImpl->mResponseLength = mImpl->mResponseText.size();
 
     // We do not do the parsing in the HTTP coroutine, since it could exhaust
     // the coroutine stack in extreme cases. Instead, we flag the data buffer
@@ -186,6 +203,7 @@ LLXMLRPCTransaction::Impl::Impl
     : mHttpRequest()
     , mStatus(LLXMLRPCTransaction::StatusNotStarted)
     , mURI(uri)
+    , mResponseLength(0)
     , mHasResponse(false)
     , mResponseParsed(false)
 {
@@ -250,14 +268,16 @@ LLXMLRPCTransaction::Impl::Impl
         mURI, body.get(), httpOpts, httpHeaders, mHandler);
 }
 
-bool LLXMLRPCTransaction::Impl::parseResponse(LLXMLNodePtr root)
+// static
+bool LLXMLRPCTransaction::Impl::parseMethodResponse(const std::string& uri,
+    LLXMLNodePtr root, LLSD& data)
 {
     // We have already checked in LLXMLNode::parseBuffer() that root contains
     // exactly one child.
     if (!root->hasName("methodResponse"))
     {
         LL_WARNS() << "Invalid root element in XML response; request URI: "
-                   << mURI << LL_ENDL;
+                   << uri << LL_ENDL;
         return false;
     }
 
@@ -269,14 +289,14 @@ bool LLXMLRPCTransaction::Impl::parseResponse(LLXMLNodePtr root)
         if (first->hasName("fault"))
         {
             LLSD fault;
-            if (parseValue(fault, second) && fault.isMap() &&
+            if (second->fromXMLRPCValue(fault) && fault.isMap() &&
                 fault.has("faultCode") && fault.has("faultString"))
             {
                 LL_WARNS() << "Request failed. faultCode: '"
                         << fault.get("faultCode").asString()
                         << "', faultString: '"
                         << fault.get("faultString").asString()
-                        << "', request URI: " << mURI << LL_ENDL;
+                        << "', request URI: " << uri << LL_ENDL;
                 return false;
             }
         }
@@ -285,20 +305,33 @@ bool LLXMLRPCTransaction::Impl::parseResponse(LLXMLNodePtr root)
         {
             LLXMLNodePtr third = second->getFirstChild();
             if (third && !third->getNextSibling() &&
-                parseValue(mResponseData, third))
+                third->fromXMLRPCValue(data))
             {
                 return true;
             }
         }
     }
 
-    LL_WARNS() << "Invalid response format; request URI: " << mURI << LL_ENDL;
+    LL_WARNS() << "Invalid response format; request URI: " << uri << LL_ENDL;
     return false;
 }
 
-bool LLXMLRPCTransaction::Impl::parseValue(LLSD& target, LLXMLNodePtr src)
+// static
+void LLXMLRPCTransaction::Impl::parseResponseText(ParseState& state)
 {
-    return src->fromXMLRPCValue(target);
+    // Runs on a General work queue thread; only touches the shared state.
+    LLXMLNodePtr root;
+    if (!LLXMLNode::parseBuffer(state.mText.data(), state.mText.size(), root,
+                                nullptr))
+    {
+        LL_WARNS() << "Failed parsing XML in response; request URI: "
+                   << state.mURI << LL_ENDL;
+    }
+    else
+    {
+        state.mSuccess = parseMethodResponse(state.mURI, root, state.mData);
+    }
+    state.mDone = true;
 }
 
 bool LLXMLRPCTransaction::Impl::process()
@@ -309,32 +342,53 @@ bool LLXMLRPCTransaction::Impl::process()
         return true; //failed, quit.
     }
 
-    // Parse the response when we have one and it has not yet been parsed. HB
+    // Parse the response when we have one and it has not yet been parsed.
+    // The login response can be megabytes of XML for inventory-heavy
+    // accounts, so the DOM parse and LLSD transcription run on the General
+    // work queue while we keep pumping; completion is not reported until
+    // the parsed data is in place.
     if (mHasResponse && !mResponseParsed)
     {
-        LLXMLNodePtr root;
-        if (!LLXMLNode::parseBuffer(mResponseText.data(), mResponseText.size(),
-                                    root, nullptr))
-        {
-            LL_WARNS() << "Failed parsing XML in response; request URI: "
-                       << mURI << LL_ENDL;
-        }
-        else if (parseResponse(root))
+        if (!mParseState)
         {
-            LL_INFOS() << "XMLRPC response parsed successfully; request URI: "
-                       << mURI << LL_ENDL;
+            mParseState = std::make_shared<ParseState>();
+            mParseState->mText = std::move(mResponseText);
+            mParseState->mURI = mURI;
+            std::shared_ptr<ParseState> state = mParseState;
+            auto job = [state]() { parseResponseText(*state); };
+            LL::WorkQueue::ptr_t queue = LL::WorkQueue::getInstance("General");
+            if (!queue || !queue->post(job))
+            {   // no worker pool (or shutting down) -- parse in place
+                job();
+            }
         }
-        else
+        if (mParseState->mDone)
         {
-            LL_WARNS() << "XMLRPC response parsing failed; request URI: "
-                       << mURI << LL_ENDL;
+            if (mParseState->mSuccess)
+            {
+                mResponseData = std::move(mParseState->mData);
+                LL_INFOS() << "XMLRPC response parsed successfully; request URI: "
+                           << mURI << LL_ENDL;
+            }
+            else
+            {
+                LL_WARNS() << "XMLRPC response parsing failed; request URI: "
+                           << mURI << LL_ENDL;
+            }
+            mResponseParsed = true;
+            mParseState.reset();
         }
-        mResponseParsed = true;
     }
 
     switch (mStatus)
     {
         case LLXMLRPCTransaction::StatusComplete:
+        {
+            // hold off reporting completion until the parse job has
+            // delivered mResponseData
+            return !mHasResponse || mResponseParsed;
+        }
+
         case LLXMLRPCTransaction::StatusCURLError:
         case LLXMLRPCTransaction::StatusXMLRPCError:
         case LLXMLRPCTransaction::StatusOtherError:
@@ -496,7 +550,7 @@ F64 LLXMLRPCTransaction::transferRate()
 
     double rate_bits_per_sec = impl.mTransferStats->mSpeedDownload * 8.0;
 
-    LL_INFOS("AppInit") << "Buffer size:   " << impl.mResponseText.size() << " B" << LL_ENDL;
+    LL_INFOS("AppInit") << "Buffer size:   " << impl.mResponseLength << " B" << LL_ENDL;
     LL_DEBUGS("AppInit") << "Transfer size: " << impl.mTransferStats->mSizeDownload << " B" << LL_ENDL;
     LL_DEBUGS("AppInit") << "Transfer time: " << impl.mTransferStats->mTotalTime << " s" << LL_ENDL;
     LL_INFOS("AppInit") << "Transfer rate: " << rate_bits_per_sec / 1000.0 << " Kb/s" << LL_ENDL;
@@ -45,6 +45,13 @@
 #include "llglheaders.h"
 #include "llrender.h"
 #include "llstartup.h"
+#include "llframearena.h"
+#include "workqueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
 #include "llwindow.h"   // swapBuffers()
 
 // newview includes
@@ -69,6 +76,7 @@
 #include "llhudtext.h"
 #include "lllightconstants.h"
 #include "llmeshrepository.h"
+#include "llperfstats.h"
 #include "llpipelinelistener.h"
 #include "llresmgr.h"
 #include "llselectmgr.h"
@@ -84,6 +92,7 @@
 #include "llviewerparcelmgr.h"
 #include "llviewerregion.h" // for audio debugging.
 #include "llviewerwindow.h" // For getSpinAxis
+#include "llvboconsolidation.h"
 #include "llvoavatarself.h"
 #include "llvocache.h"
 #include "llvosky.h"
@@ -338,6 +347,13 @@ static LLPipelineListener sPipelineListener;
 
 static LLCullResult* sCull = NULL;
 
+// When RenderParallelOctreeCull is enabled, updateCull fans per-partition
+// octree traversals out across the "General" thread pool.  The traversal
+// itself is read-only over octree state, but the workers funnel results into
+// sCull, so pushes are serialized while a parallel cull is in flight.
+static std::mutex sParallelCullMutex;
+static std::atomic<bool> sParallelCullActive(false);
+
 void validate_framebuffer_object();
 
 // Add color attachments for deferred rendering
@@ -407,6 +423,11 @@ void LLPipeline::init()
     sRenderAttachedLights = gSavedSettings.getBOOL("RenderAttachedLights");
     sRenderAttachedParticles = gSavedSettings.getBOOL("RenderAttachedParticles");
 
+    // multi-draw-indirect batch submission wants GL 4.3
+    LLVertexBuffer::sEnableMultiDrawIndirect =
+        gSavedSettings.getBOOL("RenderMultiDrawIndirect") &&
+        gGLManager.mGLVersion >= 4.29f;
+
     mInitialized = true;
 
     stop_glerror();
@@ -592,6 +613,8 @@ void LLPipeline::cleanup()
 
     mGroupQ1.clear() ;
 
+    LLVBOConsolidation::cleanup();
+
     for(pool_set_t::iterator iter = mPools.begin();
         iter != mPools.end(); )
     {
@@ -673,6 +696,8 @@ void LLPipeline::destroyGL()
     unloadShaders();
     mHighlightFaces.clear();
 
+    LLVBOConsolidation::cleanup();
+
     resetDrawOrders();
 
     releaseGLBuffers();
@@ -847,19 +872,8 @@ bool LLPipeline::allocateScreenBufferInternal(U32 resX, U32 resY)
             }
         }
 
-        if (RenderFSAAType > 0)
-        {
-            if (!mFXAAMap.allocate(resX, resY, GL_RGBA)) return false;
-            if (RenderFSAAType == 2)
-            {
-                if (!mSMAABlendBuffer.allocate(resX, resY, GL_RGBA, false)) return false;
-            }
-        }
-        else
-        {
-            mFXAAMap.release();
-            mSMAABlendBuffer.release();
-        }
+        //FXAA and SMAA scratch targets come from the transient pool on demand
+        //(see applyFXAA/generateSMAABuffers)
 
         //water reflection texture (always needed as scratch space whether or not transparent water is enabled)
         mWaterDis.allocate(resX, resY, GL_RGBA16F, true);
@@ -1130,11 +1144,28 @@ void LLPipeline::releaseGLBuffers()
 
     mWaterDis.release();
 
+    mHiZ.release();
+    if (mHiZPBO[0])
+    {
+        glDeleteBuffers(2, mHiZPBO);
+        mHiZPBO[0] = mHiZPBO[1] = 0;
+    }
+    mHiZValid = false;
+    mHiZFrame = 0;
+
     mSceneMap.release();
 
     mPostMap.release();
 
-    mFXAAMap.release();
+    //drop the transient target pool wholesale
+    for (TransientTarget& tt : mTransientTargets)
+    {
+        tt.mTarget->release();
+        delete tt.mTarget;
+    }
+    mTransientTargets.clear();
+    mSMAAEdgeBuffer = nullptr;
+    mSMAABlendBuffer = nullptr;
 
     mUIScreen.release();
 
@@ -1196,6 +1227,8 @@ void LLPipeline::releaseSunShadowTarget(U32 index)
 {
     llassert(index < 4);
     mRT->shadow[index].release();
+    mSunShadowCache[index].release();
+    mSunShadowCacheValid[index] = false;
 }
 
 void LLPipeline::releaseSunShadowTargets()
@@ -2418,6 +2451,12 @@ void LLPipeline::updateCull(LLCamera& camera, LLCullResult& result)
 
     sCull->clear();
 
+    static LLCachedControl<bool> parallel_cull(gSavedSettings, "RenderParallelOctreeCull", false);
+
+    // frame-transient scratch; reclaimed wholesale by the
+    // LLFrameArena::reset() at the top of display()
+    std::vector<LLSpatialPartition*, LLFrameArenaAllocator<LLSpatialPartition*> > parts;
+
     for (LLWorld::region_list_t::const_iterator iter = LLWorld::getInstance()->getRegionList().begin();
             iter != LLWorld::getInstance()->getRegionList().end(); ++iter)
     {
@@ -2430,13 +2469,55 @@ void LLPipeline::updateCull(LLCamera& camera, LLCullResult& result)
             {
                 if (hasRenderType(part->mDrawableType))
                 {
-                    part->cull(camera);
+                    parts.push_back(part);
                 }
             }
         }
+    }
 
-        //scan the VO Cache tree
-        LLVOCachePartition* vo_part = region->getVOCachePartition();
+    LL::WorkQueue::ptr_t queue;
+    if (parallel_cull && parts.size() > 1)
+    {
+        queue = LL::WorkQueue::getInstance("General");
+    }
+
+    if (queue)
+    {
+        LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("cull - parallel");
+        sParallelCullActive = true;
+        std::atomic<size_t> pending(parts.size());
+        for (LLSpatialPartition* part : parts)
+        {
+            auto job = [part, &camera, &pending]()
+                {
+                    part->cull(camera);
+                    --pending;
+                };
+            if (!queue->post(job))
+            { // pool is shutting down -- fall back to culling inline
+                job();
+            }
+        }
+        while (pending > 0)
+        {
+            std::this_thread::yield();
+        }
+        sParallelCullActive = false;
+    }
+    else
+    {
+        for (LLSpatialPartition* part : parts)
+        {
+            part->cull(camera);
+        }
+    }
+
+    // scan the VO Cache trees on the main thread -- occlusion queries want a
+    // current GL context
+    for (LLWorld::region_list_t::const_iterator iter = LLWorld::getInstance()->getRegionList().begin();
+            iter != LLWorld::getInstance()->getRegionList().end(); ++iter)
+    {
+        LLVOCachePartition* vo_part = (*iter)->getVOCachePartition();
         if(vo_part)
         {
             vo_part->cull(camera, sUseOcclusion > 0);
@@ -2479,13 +2560,23 @@ void LLPipeline::markNotCulled(LLSpatialGroup* group, LLCamera& camera)
 
     assertInitialized();
 
-    if (!group->getSpatialPartition()->mRenderByGroup)
-    { //render by drawable
-        sCull->pushDrawableGroup(group);
-    }
-    else
-    {   //render by group
-        sCull->pushVisibleGroup(group);
+    {
+        std::unique_lock<std::mutex> lock(sParallelCullMutex, std::defer_lock);
+        if (sParallelCullActive)
+        {
+            lock.lock();
+        }
+
+        if (!group->getSpatialPartition()->mRenderByGroup)
+        { //render by drawable
+            sCull->pushDrawableGroup(group);
+        }
+        else
+        {   //render by group
+            sCull->pushVisibleGroup(group);
+        }
+
+        mNumVisibleNodes++;
     }
 
     if (group->needsUpdate() ||
@@ -2495,13 +2586,17 @@ void LLPipeline::markNotCulled(LLSpatialGroup* group, LLCamera& camera)
         // an occlusion query to find out if it's an occluder
         markOccluder(group);
     }
-    mNumVisibleNodes++;
 }
 
 void LLPipeline::markOccluder(LLSpatialGroup* group)
 {
     if (sUseOcclusion > 1 && group && !group->isOcclusionState(LLSpatialGroup::ACTIVE_OCCLUSION))
     {
+        std::unique_lock<std::mutex> lock(sParallelCullMutex, std::defer_lock);
+        if (sParallelCullActive)
+        {
+            lock.lock();
+        }
         LLSpatialGroup* parent = group->getParent();
 
         if (!parent || !parent->isOcclusionState(LLSpatialGroup::OCCLUDED))
@@ -2521,12 +2616,163 @@ void LLPipeline::markOccluder(LLSpatialGroup* group)
     }
 }
 
+void LLPipeline::updateHiZ()
+{
+    LL_PROFILE_ZONE_SCOPED_CATEGORY_PIPELINE;
+    LL_PROFILE_GPU_ZONE("updateHiZ");
+
+    constexpr U32 hiz_res = 64;
+
+    if (!mHiZ.isComplete())
+    {
+        mHiZ.allocate(hiz_res, hiz_res, GL_R32F);
+    }
+
+    if (!mHiZPBO[0])
+    {
+        glGenBuffers(2, mHiZPBO);
+        for (U32 i = 0; i < 2; ++i)
+        {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, mHiZPBO[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, hiz_res * hiz_res * sizeof(F32), nullptr, GL_STREAM_READ);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        mHiZData.resize(hiz_res * hiz_res);
+    }
+
+    // build the coarse max-depth buffer from this frame's depth buffer
+    mHiZ.bindTarget();
+    gDeferredHiZMaxProgram.bind();
+    gDeferredHiZMaxProgram.bindTexture(LLShaderMgr::DEFERRED_DEPTH, &mRT->deferredScreen, true);
+    gDeferredHiZMaxProgram.uniform2f(LLShaderMgr::DEFERRED_SCREEN_RES, (GLfloat)hiz_res, (GLfloat)hiz_res);
+    mScreenTriangleVB->setBuffer();
+    mScreenTriangleVB->drawArrays(LLRender::TRIANGLES, 0, 3);
+    gDeferredHiZMaxProgram.unbind();
+
+    // kick this frame's async readback while the target is still bound
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mHiZPBO[mHiZFrame & 1]);
+    glReadPixels(0, 0, hiz_res, hiz_res, GL_RED, GL_FLOAT, nullptr);
+    mHiZ.flush();
+
+    // harvest last frame's readback -- by now it should be done, so mapping
+    // doesn't stall the way reading occlusion query results does
+    if (mHiZFrame > 0)
+    {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, mHiZPBO[(mHiZFrame + 1) & 1]);
+        F32* data = (F32*)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+        if (data)
+        {
+            memcpy(mHiZData.data(), data, hiz_res * hiz_res * sizeof(F32));
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+            mHiZValid = true;
+        }
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    // capture the matrices the CPU-side tests will project bounds with --
+    // current camera against last frame's depth, the same latency the query
+    // path has always had
+    F32 mvp[16];
+    for (U32 i = 0; i < 4; ++i)
+    {
+        for (U32 j = 0; j < 4; ++j)
+        {
+            mvp[i * 4 + j] = gGLProjection[j] * gGLModelView[i * 4] +
+                             gGLProjection[4 + j] * gGLModelView[i * 4 + 1] +
+                             gGLProjection[8 + j] * gGLModelView[i * 4 + 2] +
+                             gGLProjection[12 + j] * gGLModelView[i * 4 + 3];
+        }
+    }
+    memcpy(mHiZViewProj, mvp, sizeof(mvp));
+
+    ++mHiZFrame;
+}
+
+bool LLPipeline::isHiZOccluded(const LLVector4a* bounds)
+{
+    if (!mHiZValid)
+    {
+        return false;
+    }
+
+    constexpr S32 hiz_res = 64;
+
+    const LLVector4a& center = bounds[0];
+    LLVector4a size = bounds[1];
+
+    // inflate the same way the query path inflates its proxy cubes so the
+    // two modes cull comparably (see SG_OCCLUSION_FUDGE in llvieweroctree.cpp)
+    LLVector4a fudge(0.25f);
+    size.add(fudge);
+
+    F32 min_x = 1.f, min_y = 1.f, max_x = -1.f, max_y = -1.f;
+    F32 min_z = 1.f;
+
+    for (U32 i = 0; i < 8; ++i)
+    {
+        F32 cx = center[0] + ((i & 1) ? size[0] : -size[0]);
+        F32 cy = center[1] + ((i & 2) ? size[1] : -size[1]);
+        F32 cz = center[2] + ((i & 4) ? size[2] : -size[2]);
+
+        const F32* m = mHiZViewProj;
+        F32 x = cx * m[0] + cy * m[4] + cz * m[8] + m[12];
+        F32 y = cx * m[1] + cy * m[5] + cz * m[9] + m[13];
+        F32 z = cx * m[2] + cy * m[6] + cz * m[10] + m[14];
+        F32 w = cx * m[3] + cy * m[7] + cz * m[11] + m[15];
+
+        if (w <= 0.f)
+        { // box crosses the near plane -- never occluded
+            return false;
+        }
+
+        F32 inv_w = 1.f / w;
+        min_x = llmin(min_x, x * inv_w);
+        max_x = llmax(max_x, x * inv_w);
+        min_y = llmin(min_y, y * inv_w);
+        max_y = llmax(max_y, y * inv_w);
+        min_z = llmin(min_z, z * inv_w * 0.5f + 0.5f);
+    }
+
+    S32 x0 = llclamp((S32)((min_x * 0.5f + 0.5f) * hiz_res), 0, hiz_res - 1);
+    S32 x1 = llclamp((S32)((max_x * 0.5f + 0.5f) * hiz_res), 0, hiz_res - 1);
+    S32 y0 = llclamp((S32)((min_y * 0.5f + 0.5f) * hiz_res), 0, hiz_res - 1);
+    S32 y1 = llclamp((S32)((max_y * 0.5f + 0.5f) * hiz_res), 0, hiz_res - 1);
+
+    for (S32 y = y0; y <= y1; ++y)
+    {
+        for (S32 x = x0; x <= x1; ++x)
+        {
+            if (mHiZData[y * hiz_res + x] >= min_z)
+            { // something in this footprint reaches at least as deep as the
+              // nearest corner of the box -- can't prove occlusion
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 void LLPipeline::doOcclusion(LLCamera& camera)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_PIPELINE;
     LL_PROFILE_GPU_ZONE("doOcclusion");
     llassert(!gCubeSnapshot);
 
+    static LLCachedControl<bool> use_hiz(gSavedSettings, "RenderHiZOcclusion", false);
+
+    bool hiz_cull = use_hiz &&
+                    sUseOcclusion > 1 &&
+                    !sShadowRender &&
+                    LLViewerCamera::sCurCameraID == LLViewerCamera::CAMERA_WORLD &&
+                    gDeferredHiZMaxProgram.isComplete();
+
+    if (hiz_cull)
+    {
+        updateHiZ();
+        hiz_cull = mHiZValid;
+    }
+
     if (sReflectionProbesEnabled && sUseOcclusion > 1 && !LLPipeline::sShadowRender && !gCubeSnapshot)
     {
         gGL.setColorMask(false, false);
@@ -2594,7 +2840,22 @@ void LLPipeline::doOcclusion(LLCamera& camera)
             LLSpatialGroup* group = *iter;
             if (!group->isDead())
             {
-                group->doOcclusion(&camera);
+                if (hiz_cull)
+                { // resolve visibility on the CPU against the Hi-Z buffer
+                  // instead of issuing a query per group
+                    if (isHiZOccluded(group->getBounds()))
+                    {
+                        group->setOcclusionState(LLSpatialGroup::OCCLUDED, LLSpatialGroup::STATE_MODE_DIFF);
+                    }
+                    else
+                    {
+                        group->clearOcclusionState(LLSpatialGroup::OCCLUDED, LLSpatialGroup::STATE_MODE_DIFF);
+                    }
+                }
+                else
+                {
+                    group->doOcclusion(&camera);
+                }
                 group->clearOcclusionState(LLSpatialGroup::ACTIVE_OCCLUSION);
             }
         }
@@ -2722,17 +2983,52 @@ void LLPipeline::rebuildPriorityGroups()
     gMeshRepo.notifyLoadedMeshes();
 
     mGroupQ1Locked = true;
-    // Iterate through all drawables on the priority build queue,
+
+    // Order by screen impact: groups covering more of the screen build
+    // first, and entries aging in the queue gain priority so deferred
+    // work still converges.  After a teleport this makes what the user is
+    // looking at visibly finish first.
+    auto rebuild_priority = [](const LLSpatialGroup* group)
+    {
+        F32 age = (F32)(gFrameCount - group->mRebuildQueueFrame);
+        return group->mPixelArea + age * age * 256.f;
+    };
+    std::sort(mGroupQ1.begin(), mGroupQ1.end(),
+        [&rebuild_priority](const LLPointer<LLSpatialGroup>& lhs, const LLPointer<LLSpatialGroup>& rhs)
+        {
+            return rebuild_priority(lhs) > rebuild_priority(rhs);
+        });
+
+    // Everything visible this frame has already been rebuilt by postSort;
+    // what remains here is out of view, so once the minimum is met the
+    // tail can spill into later frames instead of hitching this one.
+    const F32 MAX_PRIORITY_REBUILD_TIME = 0.003f; // seconds
+    const S32 MIN_GROUP_BUILDS = 16;              // guaranteed progress
+
+    S32 built = 0;
+    F32 oldest_age = 0.f;
+    LLSpatialGroup::sg_vector_t deferred;
     for (LLSpatialGroup::sg_vector_t::iterator iter = mGroupQ1.begin();
          iter != mGroupQ1.end(); ++iter)
     {
         LLSpatialGroup* group = *iter;
+        if (built >= MIN_GROUP_BUILDS &&
+            update_timer.getElapsedTimeF32() > MAX_PRIORITY_REBUILD_TIME)
+        { // keeps IN_BUILD_Q1 so markRebuild won't re-queue it
+            deferred.push_back(group);
+            continue;
+        }
+        oldest_age = llmax(oldest_age, (F32)(gFrameCount - group->mRebuildQueueFrame));
         group->rebuildGeom();
         group->clearState(LLSpatialGroup::IN_BUILD_Q1);
+        ++built;
     }
 
+    sample(LLStatViewer::REBUILD_GROUP_QUEUE_DEPTH, (F32)mGroupQ1.size());
+    sample(LLStatViewer::REBUILD_GROUP_QUEUE_AGE, oldest_age);
+
     mGroupSaveQ1 = mGroupQ1;
-    mGroupQ1.clear();
+    mGroupQ1.swap(deferred);
     mGroupQ1Locked = false;
 
 }
@@ -2781,6 +3077,9 @@ void LLPipeline::updateGeom(F32 max_dtime)
     }
 
     updateMovedList(mMovedBridge);
+
+    // fold long-quiescent group geometry into shared vertex buffers
+    LLVBOConsolidation::update();
 }
 
 void LLPipeline::markVisible(LLDrawable *drawablep, LLCamera& camera)
@@ -2849,6 +3148,13 @@ void LLPipeline::markMoved(LLDrawable *drawablep, bool damped_motion)
 
     if (!drawablep->isState(LLDrawable::ON_MOVE_LIST))
     {
+        LLViewerObject* vobj = drawablep->getVObj();
+        if (!vobj || !(vobj->isAvatar() || vobj->isAttachment()))
+        { //avatars and attachments composite onto the cached shadow layer every
+          //frame, anything else moving invalidates it (see generateSunShadow)
+            mStaticGeometryStamp++;
+        }
+
         if (drawablep->isSpatialBridge())
         {
             mMovedBridge.push_back(drawablep);
@@ -2995,6 +3301,7 @@ void LLPipeline::markRebuild(LLSpatialGroup* group)
 
             mGroupQ1.push_back(group);
             group->setState(LLSpatialGroup::IN_BUILD_Q1);
+            group->mRebuildQueueFrame = gFrameCount;
         }
     }
 }
@@ -3005,6 +3312,12 @@ void LLPipeline::markRebuild(LLDrawable *drawablep, LLDrawable::EDrawableFlags f
     {
         if (!drawablep->isState(LLDrawable::IN_REBUILD_Q))
         {
+            LLViewerObject* vobj = drawablep->getVObj();
+            if (!vobj || !(vobj->isAvatar() || vobj->isAttachment()))
+            { //rebuilding non-avatar geometry invalidates the cached shadow layer
+                mStaticGeometryStamp++;
+            }
+
             mBuildQ1.push_back(drawablep);
             drawablep->setState(LLDrawable::IN_REBUILD_Q); // mark drawable as being in priority queue
         }
@@ -3467,6 +3780,123 @@ void renderSoundHighlights(LLDrawable *drawablep)
     }
 }
 
+// Packed state key for ordering draw batches within a pass so batches
+// sharing GL state land adjacent and redundant binds collapse.  The shader is
+// fixed per pass, so the key is avatar (for rigged passes), then texture,
+// then vertex buffer.  Pointer bits stand in for GL names; collisions only
+// cost a redundant bind.
+static U64 draw_info_sort_key(const LLDrawInfo* info)
+{
+    U64 avatar = ((U64)(uintptr_t)info->mAvatar.get()) >> 4;
+    U64 tex = ((U64)(uintptr_t)info->mTexture.get()) >> 4;
+    U64 vbo = ((U64)(uintptr_t)info->mVertexBuffer.get()) >> 4;
+
+    return ((avatar & 0xFFFF) << 48) | ((tex & 0xFFFFFF) << 24) | (vbo & 0xFFFFFF);
+}
+
+// LSD radix sort over 64-bit state keys -- byte digits, skipping digits that
+// are constant across the range
+static void radix_sort_draw_info(LLCullResult::drawinfo_iterator begin, LLCullResult::drawinfo_iterator end)
+{
+    size_t count = end - begin;
+    if (count < 2)
+    {
+        return;
+    }
+
+    typedef std::pair<U64, LLDrawInfo*> entry_t;
+    static std::vector<entry_t> src;
+    static std::vector<entry_t> dst;
+
+    src.resize(count);
+    dst.resize(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        src[i] = { draw_info_sort_key(begin[i]), begin[i] };
+    }
+
+    for (U32 shift = 0; shift < 64; shift += 8)
+    {
+        size_t buckets[256] = { 0 };
+        for (size_t i = 0; i < count; ++i)
+        {
+            buckets[(src[i].first >> shift) & 0xFF]++;
+        }
+
+        if (std::any_of(std::begin(buckets), std::end(buckets),
+                [count](size_t c) { return c == count; }))
+        { // digit is constant across the range -- nothing to do this pass
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            size_t c = buckets[i];
+            buckets[i] = offset;
+            offset += c;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            dst[buckets[(src[i].first >> shift) & 0xFF]++] = src[i];
+        }
+
+        src.swap(dst);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        begin[i] = src[i].second;
+    }
+}
+
+// bucketed back-to-front ordering for alpha groups (RenderBucketedAlphaSort).
+// distributes groups into fixed-width depth bins -- O(n) and cache friendly
+// compared to a full comparison sort -- and only runs a true sort inside the
+// near bins, where ordering errors between overlapping surfaces are actually
+// visible.  Beyond that range the bin granularity alone decides draw order.
+static void bucket_sort_alpha_groups(LLCullResult::sg_iterator begin, LLCullResult::sg_iterator end)
+{
+    constexpr U32 NUM_BUCKETS = 64;
+    constexpr F32 BUCKET_DEPTH = 8.f;       //meters of depth per bucket
+    constexpr F32 EXACT_SORT_DEPTH = 64.f;  //depth range that gets a true sort
+
+    static std::vector<LLSpatialGroup*> buckets[NUM_BUCKETS];
+
+    for (U32 i = 0; i < NUM_BUCKETS; ++i)
+    {
+        buckets[i].clear();
+    }
+
+    for (LLCullResult::sg_iterator i = begin; i != end; ++i)
+    {
+        U32 bucket = (U32) llclamp((S32) ((*i)->mDepth / BUCKET_DEPTH), 0, (S32) NUM_BUCKETS - 1);
+        buckets[bucket].push_back(*i);
+    }
+
+    LLCullResult::sg_iterator out = begin;
+    for (S32 i = NUM_BUCKETS - 1; i >= 0; --i)
+    { //far to near
+        std::vector<LLSpatialGroup*>& bucket = buckets[i];
+        if (bucket.empty())
+        {
+            continue;
+        }
+
+        if ((F32) i * BUCKET_DEPTH < EXACT_SORT_DEPTH)
+        {
+            std::sort(bucket.begin(), bucket.end(), LLSpatialGroup::CompareDepthGreater());
+        }
+
+        for (LLSpatialGroup* group : bucket)
+        {
+            *out++ = group;
+        }
+    }
+}
+
 void LLPipeline::postSort(LLCamera &camera)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_PIPELINE;
@@ -3579,6 +4009,25 @@ void LLPipeline::postSort(LLCamera &camera)
         }
     }
 
+    {
+        // order each pass by packed state key so runs of batches share
+        // shader/texture/buffer binds.  Alpha passes keep their
+        // depth-sorted submission order.
+        static LLCachedControl<bool> sort_batches(gSavedSettings, "RenderSortDrawBatches", false);
+        if (sort_batches)
+        {
+            LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("postSort - state sort");
+            for (U32 type = 0; type < LLRenderPass::NUM_RENDER_TYPES; ++type)
+            {
+                if (type == LLRenderPass::PASS_ALPHA || type == LLRenderPass::PASS_ALPHA_RIGGED)
+                {
+                    continue;
+                }
+                radix_sort_draw_info(sCull->beginRenderMap(type), sCull->endRenderMap(type));
+            }
+        }
+    }
+
     /*bool use_transform_feedback = gTransformPositionProgram.mProgramObject && !mMeshDirtyGroup.empty();
 
     if (use_transform_feedback)
@@ -3612,8 +4061,18 @@ void LLPipeline::postSort(LLCamera &camera)
 
     if (!sShadowRender)
     {
-        // order alpha groups by distance
-        std::sort(sCull->beginAlphaGroups(), sCull->endAlphaGroups(), LLSpatialGroup::CompareDepthGreater());
+        static LLCachedControl<bool> bucketed_alpha_sort(gSavedSettings, "RenderBucketedAlphaSort", false);
+        if (bucketed_alpha_sort)
+        {
+            // order alpha groups back to front with a bucketed depth sort --
+            // O(n) binning plus a true sort only inside the near bins
+            bucket_sort_alpha_groups(sCull->beginAlphaGroups(), sCull->endAlphaGroups());
+        }
+        else
+        {
+            // order alpha groups by distance
+            std::sort(sCull->beginAlphaGroups(), sCull->endAlphaGroups(), LLSpatialGroup::CompareDepthGreater());
+        }
 
         // order rigged alpha groups by avatar attachment order
         std::sort(sCull->beginRiggedAlphaGroups(), sCull->endRiggedAlphaGroups(), LLSpatialGroup::CompareRenderOrder());
@@ -3883,6 +4342,125 @@ void LLPipeline::renderHighlights()
 //debug use
 U32 LLPipeline::sCurRenderPoolType = 0 ;
 
+// ---- per-draw-pool GPU timing (RenderGPUTimerQueries) ----
+// wraps each deferred pool render in a pair of GL timestamp queries and
+// surfaces the previous frame's results through LLTrace so GPU cost lines
+// up with the CPU-side fast timers per pass.  timestamps are used instead
+// of GL_TIME_ELAPSED so this can coexist with the shader profiler, which
+// owns the elapsed-time query slot.
+namespace
+{
+    struct GPUPoolTimer
+    {
+        U32 mQuery[2][2] = { { 0, 0 }, { 0, 0 } }; //[buffer][begin/end]
+        bool mPending[2] = { false, false };
+        F64 mLastMS = 0.0; //last harvested reading
+        LLTrace::SampleStatHandle<F64Milliseconds>* mStat = nullptr;
+    };
+
+    GPUPoolTimer gGPUPoolTimers[LLDrawPool::NUM_POOL_TYPES];
+    U32 gGPUPoolWriteBuffer = 0;
+
+    const char* gpu_pool_name(U32 type)
+    {
+        switch (type)
+        {
+        case LLDrawPool::POOL_SKY: return "Sky";
+        case LLDrawPool::POOL_WL_SKY: return "Windlight Sky";
+        case LLDrawPool::POOL_SIMPLE: return "Simple";
+        case LLDrawPool::POOL_FULLBRIGHT: return "Fullbright";
+        case LLDrawPool::POOL_BUMP: return "Bump";
+        case LLDrawPool::POOL_MATERIALS: return "Materials";
+        case LLDrawPool::POOL_GLTF_PBR: return "GLTF PBR";
+        case LLDrawPool::POOL_TERRAIN: return "Terrain";
+        case LLDrawPool::POOL_GRASS: return "Grass";
+        case LLDrawPool::POOL_GLTF_PBR_ALPHA_MASK: return "GLTF PBR Alpha Mask";
+        case LLDrawPool::POOL_TREE: return "Tree";
+        case LLDrawPool::POOL_ALPHA_MASK: return "Alpha Mask";
+        case LLDrawPool::POOL_FULLBRIGHT_ALPHA_MASK: return "Fullbright Alpha Mask";
+        case LLDrawPool::POOL_AVATAR: return "Avatar";
+        case LLDrawPool::POOL_CONTROL_AV: return "Animesh";
+        case LLDrawPool::POOL_GLOW: return "Glow";
+        case LLDrawPool::POOL_ALPHA_PRE_WATER: return "Alpha Pre Water";
+        case LLDrawPool::POOL_VOIDWATER: return "Void Water";
+        case LLDrawPool::POOL_WATER: return "Water";
+        case LLDrawPool::POOL_ALPHA_POST_WATER: return "Alpha Post Water";
+        default: return "Unknown";
+        }
+    }
+
+    void begin_gpu_pool_timer(U32 type)
+    {
+        GPUPoolTimer& timer = gGPUPoolTimers[type];
+        if (timer.mPending[gGPUPoolWriteBuffer])
+        { //last result hasn't drained yet, skip timing this frame
+            return;
+        }
+
+        if (!timer.mQuery[0][0])
+        {
+            glGenQueries(4, &timer.mQuery[0][0]);
+            timer.mStat = new LLTrace::SampleStatHandle<F64Milliseconds>(
+                llformat("GPU %s", gpu_pool_name(type)),
+                llformat("GPU time spent rendering the %s draw pool", gpu_pool_name(type)));
+        }
+
+        glQueryCounter(timer.mQuery[gGPUPoolWriteBuffer][0], GL_TIMESTAMP);
+    }
+
+    void end_gpu_pool_timer(U32 type)
+    {
+        GPUPoolTimer& timer = gGPUPoolTimers[type];
+        if (timer.mPending[gGPUPoolWriteBuffer])
+        {
+            return;
+        }
+
+        glQueryCounter(timer.mQuery[gGPUPoolWriteBuffer][1], GL_TIMESTAMP);
+        timer.mPending[gGPUPoolWriteBuffer] = true;
+    }
+
+    void harvest_gpu_pool_timers()
+    { //flip buffers and record results from the frame before last --
+      //queries have had a full frame to drain so this doesn't stall
+        gGPUPoolWriteBuffer ^= 1;
+        const U32 read = gGPUPoolWriteBuffer;
+
+        F64 total_ms = 0.0;
+        for (U32 i = 0; i < LLDrawPool::NUM_POOL_TYPES; ++i)
+        {
+            GPUPoolTimer& timer = gGPUPoolTimers[i];
+            if (!timer.mPending[read])
+            { //pool didn't render that frame
+                timer.mLastMS = 0.0;
+                continue;
+            }
+
+            GLuint64 available = 0;
+            glGetQueryObjectui64v(timer.mQuery[read][1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available)
+            { //leave it for next frame, carry the previous reading meanwhile
+                total_ms += timer.mLastMS;
+                continue;
+            }
+
+            GLuint64 t0 = 0;
+            GLuint64 t1 = 0;
+            glGetQueryObjectui64v(timer.mQuery[read][0], GL_QUERY_RESULT, &t0);
+            glGetQueryObjectui64v(timer.mQuery[read][1], GL_QUERY_RESULT, &t1);
+            timer.mPending[read] = false;
+
+            timer.mLastMS = (F64) (t1 - t0) / 1000000.0;
+            total_ms += timer.mLastMS;
+            sample(*timer.mStat, F64Milliseconds(timer.mLastMS));
+        }
+
+        // publish the whole-frame sum so the autotune controller can tell a
+        // GPU-bound frame from a CPU-bound one
+        LLPerfStats::sGPUFrameTimeMS = (F32)total_ms;
+    }
+} //anonymous namespace
+
 void LLPipeline::renderGeomDeferred(LLCamera& camera, bool do_occlusion)
 {
     LLAppViewer::instance()->pingMainloopTimeout("Pipeline:RenderGeomDeferred");
@@ -3914,6 +4492,21 @@ void LLPipeline::renderGeomDeferred(LLCamera& camera, bool do_occlusion)
 
     bool occlude = LLPipeline::sUseOcclusion > 1 && do_occlusion && !LLGLSLShader::sProfileEnabled;
 
+    static LLCachedControl<bool> gpu_timer_queries(gSavedSettings, "RenderGPUTimerQueries", false);
+    bool gpu_timers = gpu_timer_queries &&
+                      !gCubeSnapshot &&
+                      &camera == LLViewerCamera::getInstance() &&
+                      gGLManager.mGLVersion >= 3.29f; //needs glQueryCounter
+
+    if (gpu_timers)
+    {
+        harvest_gpu_pool_timers();
+    }
+    else if (!gpu_timer_queries && LLPerfStats::sGPUFrameTimeMS != 0.f)
+    { //queries switched off; don't leave a stale reading steering the autotune
+        LLPerfStats::sGPUFrameTimeMS = 0.f;
+    }
+
     setupHWLights();
 
     {
@@ -3970,6 +4563,11 @@ void LLPipeline::renderGeomDeferred(LLCamera& camera, bool do_occlusion)
                 gGLLastMatrix = NULL;
                 gGL.loadMatrix(gGLModelView);
 
+                if (gpu_timers)
+                {
+                    begin_gpu_pool_timer(cur_type);
+                }
+
                 for( S32 i = 0; i < poolp->getNumDeferredPasses(); i++ )
                 {
                     LLVertexBuffer::unbind();
@@ -3989,6 +4587,11 @@ void LLPipeline::renderGeomDeferred(LLCamera& camera, bool do_occlusion)
 
                     LLGLState::checkStates();
                 }
+
+                if (gpu_timers)
+                {
+                    end_gpu_pool_timer(cur_type);
+                }
             }
             else
             {
@@ -7318,11 +7921,84 @@ void LLPipeline::applyCAS(LLRenderTarget* src, LLRenderTarget* dst)
     dst->flush();
 }
 
+LLRenderTarget* LLPipeline::acquireTransientTarget(U32 resx, U32 resy, U32 color_fmt, bool depth)
+{
+    for (TransientTarget& tt : mTransientTargets)
+    {
+        if (!tt.mInUse &&
+            tt.mColorFmt == color_fmt &&
+            tt.mDepth == depth &&
+            tt.mTarget->getWidth() == resx &&
+            tt.mTarget->getHeight() == resy)
+        {
+            tt.mInUse = true;
+            tt.mLastUseFrame = gFrameCount;
+            return tt.mTarget;
+        }
+    }
+
+    TransientTarget tt;
+    tt.mTarget = new LLRenderTarget();
+    if (!tt.mTarget->allocate(resx, resy, color_fmt, depth))
+    {
+        delete tt.mTarget;
+        return nullptr;
+    }
+
+    tt.mColorFmt = color_fmt;
+    tt.mDepth = depth;
+    tt.mInUse = true;
+    tt.mLastUseFrame = gFrameCount;
+    mTransientTargets.push_back(tt);
+
+    return tt.mTarget;
+}
+
+void LLPipeline::releaseTransientTarget(LLRenderTarget* target)
+{
+    for (TransientTarget& tt : mTransientTargets)
+    {
+        if (tt.mTarget == target)
+        {
+            tt.mInUse = false;
+            tt.mLastUseFrame = gFrameCount;
+            return;
+        }
+    }
+
+    llassert(false); //not a pooled target
+}
+
+void LLPipeline::updateTransientTargetPool()
+{ //return allocations that have gone idle (resolution change, AA mode change,
+  //feature toggled off) to the driver
+    constexpr U32 MAX_IDLE_FRAMES = 120;
+
+    for (auto iter = mTransientTargets.begin(); iter != mTransientTargets.end();)
+    {
+        if (!iter->mInUse && gFrameCount - iter->mLastUseFrame > MAX_IDLE_FRAMES)
+        {
+            iter->mTarget->release();
+            delete iter->mTarget;
+            iter = mTransientTargets.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
 void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
 {
     {
         llassert(!gCubeSnapshot);
-        bool multisample = RenderFSAAType == 1 && mFXAAMap.isComplete();
+        LLRenderTarget* fxaa_map = nullptr;
+        if (RenderFSAAType == 1)
+        {
+            fxaa_map = acquireTransientTarget(dst->getWidth(), dst->getHeight(), GL_RGBA);
+        }
+        bool multisample = fxaa_map != nullptr;
         LLGLSLShader* shader = &gGlowCombineProgram;
 
         // Present everything.
@@ -7333,8 +8009,8 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
             S32 height = dst->getHeight();
 
             // bake out texture2D with RGBL for FXAA shader
-            mFXAAMap.bindTarget();
-            mFXAAMap.clear(GL_COLOR_BUFFER_BIT);
+            fxaa_map->bindTarget();
+            fxaa_map->clear(GL_COLOR_BUFFER_BIT);
 
             shader = &gGlowCombineFXAAProgram;
             shader->bind();
@@ -7354,7 +8030,7 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
             shader->disableTexture(LLShaderMgr::DEFERRED_DIFFUSE, src->getUsage());
             shader->unbind();
 
-            mFXAAMap.flush();
+            fxaa_map->flush();
 
             dst->bindTarget();
 
@@ -7364,10 +8040,10 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
             shader = &gFXAAProgram[fsaa_quality];
             shader->bind();
 
-            channel = shader->enableTexture(LLShaderMgr::DIFFUSE_MAP, mFXAAMap.getUsage());
+            channel = shader->enableTexture(LLShaderMgr::DIFFUSE_MAP, fxaa_map->getUsage());
             if (channel > -1)
             {
-                mFXAAMap.bindTexture(0, channel, LLTexUnit::TFO_BILINEAR);
+                fxaa_map->bindTexture(0, channel, LLTexUnit::TFO_BILINEAR);
             }
 
             gGLViewport[0] = gViewerWindow->getWorldViewRectRaw().mLeft;
@@ -7377,8 +8053,8 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
 
             glViewport(gGLViewport[0], gGLViewport[1], gGLViewport[2], gGLViewport[3]);
 
-            F32 scale_x = (F32)width / mFXAAMap.getWidth();
-            F32 scale_y = (F32)height / mFXAAMap.getHeight();
+            F32 scale_x = (F32)width / fxaa_map->getWidth();
+            F32 scale_y = (F32)height / fxaa_map->getHeight();
             shader->uniform2f(LLShaderMgr::FXAA_TC_SCALE, scale_x, scale_y);
             shader->uniform2f(LLShaderMgr::FXAA_RCP_SCREEN_RES, 1.f / width * scale_x, 1.f / height * scale_y);
             shader->uniform4f(LLShaderMgr::FXAA_RCP_FRAME_OPT, -0.5f / width * scale_x, -0.5f / height * scale_y,
@@ -7397,6 +8073,8 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
 
             shader->unbind();
             dst->flush();
+
+            releaseTransientTarget(fxaa_map);
         }
         else {
             copyRenderTarget(src, dst);
@@ -7407,7 +8085,20 @@ void LLPipeline::applyFXAA(LLRenderTarget* src, LLRenderTarget* dst)
 void LLPipeline::generateSMAABuffers(LLRenderTarget* src)
 {
     llassert(!gCubeSnapshot);
-    bool multisample = RenderFSAAType == 2 && mFXAAMap.isComplete() && mSMAABlendBuffer.isComplete();
+    if (RenderFSAAType == 2)
+    { //borrow SMAA scratch from the transient pool -- held until the end of
+      //renderFinalize so the blend buffer survives into applySMAA and the
+      //buffer visualization debug views stay meaningful
+        if (!mSMAAEdgeBuffer)
+        {
+            mSMAAEdgeBuffer = acquireTransientTarget(src->getWidth(), src->getHeight(), GL_RGBA);
+        }
+        if (!mSMAABlendBuffer)
+        {
+            mSMAABlendBuffer = acquireTransientTarget(src->getWidth(), src->getHeight(), GL_RGBA);
+        }
+    }
+    bool multisample = RenderFSAAType == 2 && mSMAAEdgeBuffer && mSMAABlendBuffer;
 
     // Present everything.
     if (multisample)
@@ -7429,7 +8120,7 @@ void LLPipeline::generateSMAABuffers(LLRenderTarget* src)
             //LLGLState stencil(GL_STENCIL_TEST, use_stencil);
 
             // Bind setup:
-            LLRenderTarget& dest = mFXAAMap;
+            LLRenderTarget& dest = *mSMAAEdgeBuffer;
             LLGLSLShader& edge_shader = gSMAAEdgeDetectProgram[fsaa_quality];
 
             dest.bindTarget();
@@ -7472,7 +8163,7 @@ void LLPipeline::generateSMAABuffers(LLRenderTarget* src)
             //LLGLState stencil(GL_STENCIL_TEST, use_stencil);
 
             // Bind setup:
-            LLRenderTarget& dest = mSMAABlendBuffer;
+            LLRenderTarget& dest = *mSMAABlendBuffer;
             LLGLSLShader& blend_weights_shader = gSMAABlendWeightsProgram[fsaa_quality];
 
             dest.bindTarget();
@@ -7481,10 +8172,10 @@ void LLPipeline::generateSMAABuffers(LLRenderTarget* src)
             blend_weights_shader.bind();
             blend_weights_shader.uniform4fv(sSmaaRTMetrics, 1, rt_metrics);
 
-            S32 edge_tex_channel = blend_weights_shader.enableTexture(LLShaderMgr::SMAA_EDGE_TEX, mFXAAMap.getUsage());
+            S32 edge_tex_channel = blend_weights_shader.enableTexture(LLShaderMgr::SMAA_EDGE_TEX, mSMAAEdgeBuffer->getUsage());
             if (edge_tex_channel > -1)
             {
-                mFXAAMap.bindTexture(0, edge_tex_channel, LLTexUnit::TFO_BILINEAR);
+                mSMAAEdgeBuffer->bindTexture(0, edge_tex_channel, LLTexUnit::TFO_BILINEAR);
                 gGL.getTexUnit(edge_tex_channel)->setTextureAddressMode(LLTexUnit::TAM_CLAMP);
             }
             S32 area_tex_channel = blend_weights_shader.enableTexture(LLShaderMgr::SMAA_AREA_TEX, LLTexUnit::TT_TEXTURE);
@@ -7525,7 +8216,7 @@ void LLPipeline::generateSMAABuffers(LLRenderTarget* src)
 void LLPipeline::applySMAA(LLRenderTarget* src, LLRenderTarget* dst)
 {
     llassert(!gCubeSnapshot);
-    bool multisample = RenderFSAAType == 2 && mFXAAMap.isComplete() && mSMAABlendBuffer.isComplete();
+    bool multisample = RenderFSAAType == 2 && mSMAABlendBuffer;
 
     // Present everything.
     if (multisample)
@@ -7567,7 +8258,7 @@ void LLPipeline::applySMAA(LLRenderTarget* src, LLRenderTarget* dst)
             S32 blend_channel = blend_shader.enableTexture(LLShaderMgr::SMAA_BLEND_TEX);
             if (blend_channel > -1)
             {
-                mSMAABlendBuffer.bindTexture(0, blend_channel, LLTexUnit::TFO_BILINEAR);
+                mSMAABlendBuffer->bindTexture(0, blend_channel, LLTexUnit::TFO_BILINEAR);
             }
 
             mScreenTriangleVB->setBuffer();
@@ -7893,17 +8584,17 @@ void LLPipeline::renderFinalize()
             break;
         case 5:
         {
-            if (RenderFSAAType > 0)
+            if (mSMAAEdgeBuffer)
             {
-                visualizeBuffers(&mFXAAMap, finalBuffer, 0);
+                visualizeBuffers(mSMAAEdgeBuffer, finalBuffer, 0);
             }
             break;
         }
         case 6:
         {
-            if (RenderFSAAType == 2)
+            if (mSMAABlendBuffer)
             {
-                visualizeBuffers(&mSMAABlendBuffer, finalBuffer, 0);
+                visualizeBuffers(mSMAABlendBuffer, finalBuffer, 0);
             }
             break;
         }
@@ -7932,6 +8623,20 @@ void LLPipeline::renderFinalize()
 
     gGL.setSceneBlendType(LLRender::BT_ALPHA);
 
+    // return SMAA scratch to the transient pool and reclaim targets that
+    // have sat idle (resolution change, FSAA mode switch, etc.)
+    if (mSMAAEdgeBuffer)
+    {
+        releaseTransientTarget(mSMAAEdgeBuffer);
+        mSMAAEdgeBuffer = nullptr;
+    }
+    if (mSMAABlendBuffer)
+    {
+        releaseTransientTarget(mSMAABlendBuffer);
+        mSMAABlendBuffer = nullptr;
+    }
+    updateTransientTargetPool();
+
     if (hasRenderDebugMask(LLPipeline::RENDER_DEBUG_PHYSICS_SHAPES))
     {
         renderPhysicsDisplay();
@@ -9253,13 +9958,16 @@ static LLTrace::BlockTimerStatHandle FTM_SHADOW_ALPHA_TREE("Alpha Tree");
 static LLTrace::BlockTimerStatHandle FTM_SHADOW_ALPHA_GRASS("Alpha Grass");
 static LLTrace::BlockTimerStatHandle FTM_SHADOW_FULLBRIGHT_ALPHA_MASKED("Fullbright Alpha Masked");
 
-void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCamera& shadow_cam, LLCullResult& result, bool depth_clamp)
+void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCamera& shadow_cam, LLCullResult& result, bool depth_clamp, U32 passes)
 {
     LL_PROFILE_ZONE_SCOPED_CATEGORY_PIPELINE; //LL_RECORD_BLOCK_TIME(FTM_SHADOW_RENDER);
     LL_PROFILE_GPU_ZONE("renderShadow");
 
     LLPipeline::sShadowRender = true;
 
+    bool render_static = (passes & SHADOW_PASS_STATIC) != 0;
+    bool render_dynamic = (passes & SHADOW_PASS_DYNAMIC) != 0;
+
     // disable occlusion culling during shadow render
     U32 saved_occlusion = sUseOcclusion;
     sUseOcclusion = 0;
@@ -9321,6 +10029,10 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
     for (int j = 0; j < 2; ++j) // 0 -- static, 1 -- rigged
     {
         bool rigged = j == 1;
+        if (!(rigged ? render_dynamic : render_static))
+        {
+            continue;
+        }
         gDeferredShadowProgram.bind(rigged);
 
         gGL.diffuseColor4f(1, 1, 1, 1);
@@ -9347,13 +10059,14 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
         gGL.getTexUnit(0)->enable(LLTexUnit::TT_TEXTURE);
     }
 
-    if (LLPipeline::sUseOcclusion > 1)
+    if (LLPipeline::sUseOcclusion > 1 && render_static)
     { // do occlusion culling against non-masked only to take advantage of hierarchical Z
         doOcclusion(shadow_cam);
     }
 
 
-    {
+    if (render_dynamic)
+    { //avatar, terrain and tree pools render on top of the cached layer every frame
         LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("shadow geom");
         renderGeomShadow(shadow_cam);
     }
@@ -9367,7 +10080,9 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
         for (int i = 0; i < 2; ++i)
         {
             bool rigged = i == 1;
+            bool masked_pass = rigged ? render_dynamic : render_static;
 
+            if (masked_pass)
             {
                 LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("shadow alpha masked");
                 LL_PROFILE_GPU_ZONE("shadow alpha masked");
@@ -9377,12 +10092,14 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
                 renderMaskedObjects(LLRenderPass::PASS_ALPHA_MASK, true, true, rigged);
             }
 
-            {
+            if (render_dynamic)
+            { //alpha-blended shadows include particles, keep them out of the cached static layer
                 LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("shadow alpha blend");
                 LL_PROFILE_GPU_ZONE("shadow alpha blend");
                 renderAlphaObjects(rigged);
             }
 
+            if (masked_pass)
             {
                 LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("shadow fullbright alpha masked");
                 LL_PROFILE_GPU_ZONE("shadow alpha masked");
@@ -9392,6 +10109,7 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
                 renderFullbrightMaskedObjects(LLRenderPass::PASS_FULLBRIGHT_ALPHA_MASK, true, true, rigged);
             }
 
+            if (masked_pass)
             {
                 LL_PROFILE_ZONE_NAMED_CATEGORY_PIPELINE("shadow alpha grass");
                 LL_PROFILE_GPU_ZONE("shadow alpha grass");
@@ -9417,6 +10135,10 @@ void LLPipeline::renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCa
         for (int i = 0; i < 2; ++i)
         {
             bool rigged = i == 1;
+            if (!(rigged ? render_dynamic : render_static))
+            {
+                continue;
+            }
             gDeferredShadowGLTFAlphaMaskProgram.bind(rigged);
             LLGLSLShader::sCurBoundShaderPtr->uniform1i(LLShaderMgr::SUN_UP_FACTOR, sun_up);
             LLGLSLShader::sCurBoundShaderPtr->uniform1f(LLShaderMgr::DEFERRED_SHADOW_TARGET_WIDTH, (float)target_width);
@@ -10248,6 +10970,35 @@ void LLPipeline::generateSunShadow(LLCamera& camera)
 
             shadow_cam.setOrigin(0,0,0);
 
+            static LLCachedControl<bool> cached_shadows(gSavedSettings, "RenderCachedShadows", false);
+            bool use_cache = cached_shadows &&
+                             !gCubeSnapshot &&
+                             gGLManager.mGLVersion >= 4.29f && //needs glCopyImageSubData
+                             !hasRenderDebugMask(RENDER_DEBUG_SHADOW_FRUSTA);
+            bool cache_hit = false;
+
+            if (use_cache)
+            { //reuse the cached static layer while the light and camera are within
+              //tolerance and no static geometry changed -- on a hit the cached
+              //light matrices are reused wholesale so the cached depth stays aligned
+                const F32 dir_tolerance = cosf(0.5f * DEG_TO_RAD);
+                const F32 move_tolerance = 0.25f; //meters
+
+                if (mSunShadowCacheValid[j] &&
+                    mStaticGeometryStamp == mSunShadowCacheStamp[j] &&
+                    lightDir * mSunShadowCacheLightDir[j] > dir_tolerance &&
+                    (camera.getOrigin() - mSunShadowCacheOrigin[j]).length() < move_tolerance)
+                {
+                    cache_hit = true;
+                    view[j] = mSunShadowCacheView[j];
+                    proj[j] = mSunShadowCacheProj[j];
+                }
+                else
+                {
+                    mSunShadowCacheValid[j] = false;
+                }
+            }
+
             set_current_modelview(view[j]);
             set_current_projection(proj[j]);
 
@@ -10274,16 +11025,69 @@ void LLPipeline::generateSunShadow(LLCamera& camera)
 
             stop_glerror();
 
-            mRT->shadow[j].bindTarget();
-            mRT->shadow[j].getViewport(gGLViewport);
-            mRT->shadow[j].clear();
-
+            if (use_cache)
             {
-                static LLCullResult result[4];
-                renderShadow(view[j], proj[j], shadow_cam, result[j], true);
+                LLRenderTarget& cache = mSunShadowCache[j];
+
+                if (cache.getWidth() != mRT->shadow[j].getWidth() ||
+                    cache.getHeight() != mRT->shadow[j].getHeight())
+                {
+                    cache.allocate(mRT->shadow[j].getWidth(), mRT->shadow[j].getHeight(), 0, true);
+                    cache_hit = false;
+                }
+
+                if (!cache_hit)
+                { //re-render the static layer
+                    cache.bindTarget();
+                    cache.getViewport(gGLViewport);
+                    cache.clear();
+
+                    {
+                        static LLCullResult static_result[4];
+                        renderShadow(view[j], proj[j], shadow_cam, static_result[j], true, SHADOW_PASS_STATIC);
+                    }
+
+                    cache.flush();
+
+                    mSunShadowCacheValid[j] = true;
+                    mSunShadowCacheStamp[j] = mStaticGeometryStamp;
+                    mSunShadowCacheLightDir[j] = lightDir;
+                    mSunShadowCacheOrigin[j] = camera.getOrigin();
+                    mSunShadowCacheView[j] = view[j];
+                    mSunShadowCacheProj[j] = proj[j];
+                }
+
+                //composite -- restore the cached static depth, then draw
+                //dynamic objects (avatars, attachments, alpha blends) on top
+                glCopyImageSubData(cache.getDepth(), GL_TEXTURE_2D, 0, 0, 0, 0,
+                                   mRT->shadow[j].getDepth(), GL_TEXTURE_2D, 0, 0, 0, 0,
+                                   cache.getWidth(), cache.getHeight(), 1);
+
+                mRT->shadow[j].bindTarget();
+                mRT->shadow[j].getViewport(gGLViewport);
+
+                {
+                    static LLCullResult dynamic_result[4];
+                    renderShadow(view[j], proj[j], shadow_cam, dynamic_result[j], true, SHADOW_PASS_DYNAMIC);
+                }
+
+                mRT->shadow[j].flush();
             }
+            else
+            {
+                mSunShadowCacheValid[j] = false;
+
+                mRT->shadow[j].bindTarget();
+                mRT->shadow[j].getViewport(gGLViewport);
+                mRT->shadow[j].clear();
 
-            mRT->shadow[j].flush();
+                {
+                    static LLCullResult result[4];
+                    renderShadow(view[j], proj[j], shadow_cam, result[j], true);
+                }
+
+                mRT->shadow[j].flush();
+            }
 
             if (!gPipeline.hasRenderDebugMask(LLPipeline::RENDER_DEBUG_SHADOW_FRUSTA) && !gCubeSnapshot)
             {
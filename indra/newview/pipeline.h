@@ -167,6 +167,14 @@ public:
     void combineGlow(LLRenderTarget* src, LLRenderTarget* dst);
     void visualizeBuffers(LLRenderTarget* src, LLRenderTarget* dst, U32 bufferIndex);
 
+    // borrow a scratch render target matching the given size/format from the
+    // transient pool, allocating one if no idle match exists.  Returns NULL on
+    // allocation failure.  Release with releaseTransientTarget when the stage
+    // is done so later stages can alias the same memory.
+    LLRenderTarget* acquireTransientTarget(U32 resx, U32 resy, U32 color_fmt, bool depth = false);
+    void releaseTransientTarget(LLRenderTarget* target);
+    void updateTransientTargetPool(); //free pool entries that have gone unused
+
     void init();
     void cleanup();
     bool isInit() { return mInitialized; };
@@ -197,6 +205,13 @@ public:
     void        markOccluder(LLSpatialGroup* group);
 
     void        doOcclusion(LLCamera& camera);
+
+    // Hi-Z occlusion culling (RenderHiZOcclusion) -- build a coarse
+    // max-depth buffer from the current depth buffer and read it back a
+    // frame later for CPU-side bounding box tests in doOcclusion
+    void        updateHiZ();
+    bool        isHiZOccluded(const LLVector4a* bounds);
+
     void        markNotCulled(LLSpatialGroup* group, LLCamera &camera);
     void        markMoved(LLDrawable *drawablep, bool damped_motion = false);
     void        markShift(LLDrawable *drawablep);
@@ -345,7 +360,16 @@ public:
 
     void renderHighlight(const LLViewerObject* obj, F32 fade);
 
-    void renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCamera& camera, LLCullResult& result, bool depth_clamp);
+    //which layers renderShadow() draws -- the cached shadow path renders
+    //static and dynamic geometry in separate passes (see generateSunShadow)
+    enum eShadowPass : U32
+    {
+        SHADOW_PASS_STATIC  = 0x1,
+        SHADOW_PASS_DYNAMIC = 0x2,
+        SHADOW_PASS_ALL     = SHADOW_PASS_STATIC | SHADOW_PASS_DYNAMIC,
+    };
+
+    void renderShadow(const glm::mat4& view, const glm::mat4& proj, LLCamera& camera, LLCullResult& result, bool depth_clamp, U32 passes = SHADOW_PASS_ALL);
     void renderSelectedFaces(const LLColor4& color);
     void renderHighlights();
     void renderDebug();
@@ -727,9 +751,24 @@ public:
     // tonemapped and gamma corrected render ready for post
     LLRenderTarget          mPostMap;
 
-    // FXAA helper target
-    LLRenderTarget          mFXAAMap;
-    LLRenderTarget          mSMAABlendBuffer;
+    // transient render target pool -- post-process stages borrow scratch
+    // targets by size/format instead of holding allocations permanently,
+    // so non-overlapping stages alias the same GPU memory and targets for
+    // disabled features decay back to the driver
+    struct TransientTarget
+    {
+        LLRenderTarget* mTarget = nullptr;
+        U32             mColorFmt = 0;
+        bool            mDepth = false;
+        bool            mInUse = false;
+        U32             mLastUseFrame = 0;
+    };
+    std::vector<TransientTarget> mTransientTargets;
+
+    // SMAA scratch targets borrowed from the transient pool for the duration
+    // of renderFinalize (edge detect through buffer visualization)
+    LLRenderTarget*         mSMAAEdgeBuffer = nullptr;
+    LLRenderTarget*         mSMAABlendBuffer = nullptr;
 
     // render ui to buffer target
     LLRenderTarget          mUIScreen;
@@ -750,6 +789,15 @@ public:
     // a single triangle that covers the whole screen
     LLPointer<LLVertexBuffer> mScreenTriangleVB;
 
+    // Hi-Z occlusion culling state -- coarse max-depth target, double
+    // buffered PBOs for async readback, and the one-frame-late CPU copy
+    LLRenderTarget          mHiZ;
+    U32                     mHiZPBO[2] = { 0, 0 };
+    U32                     mHiZFrame = 0;
+    bool                    mHiZValid = false;
+    std::vector<F32>        mHiZData;
+    F32                     mHiZViewProj[16];
+
     //utility buffer for rendering cubes, 8 vertices are corners of a cube [-1, 1]
     LLPointer<LLVertexBuffer> mCubeVB;
 
@@ -768,6 +816,18 @@ public:
     glm::mat4               mShadowProjection[6];
     glm::mat4               mReflectionModelView;
 
+    //cached static-geometry sun shadow layers (RenderCachedShadows) -- one
+    //depth layer per split holding everything but avatars, attachments and
+    //alpha-blended objects, reused until the light or scene moves
+    LLRenderTarget          mSunShadowCache[4];
+    glm::mat4               mSunShadowCacheView[4];
+    glm::mat4               mSunShadowCacheProj[4];
+    LLVector3               mSunShadowCacheLightDir[4];
+    LLVector3               mSunShadowCacheOrigin[4];
+    U32                     mSunShadowCacheStamp[4] = { 0, 0, 0, 0 };
+    bool                    mSunShadowCacheValid[4] = { false, false, false, false };
+    U32                     mStaticGeometryStamp = 0; //bumped whenever non-avatar geometry moves or rebuilds
+
     LLPointer<LLDrawable>   mShadowSpotLight[2];
     F32                     mSpotLightFade[2];
     LLPointer<LLDrawable>   mTargetShadowSpotLight[2];